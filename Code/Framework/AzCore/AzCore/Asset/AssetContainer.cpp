@@ -10,6 +10,8 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
 
 namespace AZ::Data
 {
@@ -56,19 +58,28 @@ namespace AZ::Data
         }
 
         // Queue the loading of all of the dependent assets before loading the root asset.
+        // The file reads are collected and handed to the streamer in one batch, so it only syncs with the streaming thread
+        // once and its scheduler sees all the reads together, which lets it order them by file and offset.
+        AssetDataStream::FileRequestBatch streamerRequests;
+        streamerRequests.reserve(dependencyAssets.size());
         for (auto& [dependentAssetInfo, dependentAsset] : dependencyAssets)
         {
             // Queue each asset to load.
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
                 AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
-                dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
+                dependentAssetInfo, HasPreloads(dependentAsset.GetId()), &streamerRequests);
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
             AZ_Assert(dependentAsset == queuedDependentAsset, "GetAssetInternal returned an unexpected asset reference for Asset %s",
                       dependentAsset.GetId().ToString<AZStd::string>().c_str());
         }
 
+        if (!streamerRequests.empty())
+        {
+            AZ::Interface<AZ::IO::IStreamer>::Get()->QueueRequestBatch(AZStd::move(streamerRequests));
+        }
+
         return dependencyAssets;
     }
 
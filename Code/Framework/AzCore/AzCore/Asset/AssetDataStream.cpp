@@ -111,7 +111,8 @@ namespace AZ::Data
     }
 
     void AssetDataStream::Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
-        AZ::IO::IStreamerTypes::Deadline deadline, AZ::IO::IStreamerTypes::Priority priority, OnCompleteCallback loadCallback)
+        AZ::IO::IStreamerTypes::Deadline deadline, AZ::IO::IStreamerTypes::Priority priority, OnCompleteCallback loadCallback,
+        FileRequestBatch* requestBatch)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -178,7 +179,14 @@ namespace AZ::Data
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_privateData->m_curReadRequest, streamerCallback);
 
-            streamer->QueueRequest(m_privateData->m_curReadRequest);
+            if (requestBatch)
+            {
+                requestBatch->push_back(m_privateData->m_curReadRequest);
+            }
+            else
+            {
+                streamer->QueueRequest(m_privateData->m_curReadRequest);
+            }
         }
         else
         {
@@ -316,5 +324,18 @@ namespace AZ::Data
         return bytes;
     }
 
+    AZStd::span<const AZ::u8> AssetDataStream::ReadInPlace(AZ::IO::SizeType bytes)
+    {
+        if (m_curOffset >= m_loadedSize)
+        {
+            return {};
+        }
+
+        const size_t size = aznumeric_cast<size_t>(AZ::GetMin(bytes, aznumeric_cast<AZ::IO::SizeType>(m_loadedSize - m_curOffset)));
+        AZStd::span<const AZ::u8> data(reinterpret_cast<const AZ::u8*>(m_buffer) + m_curOffset, size);
+        m_curOffset += size;
+        return data;
+    }
+
 } // AZ::Data
 
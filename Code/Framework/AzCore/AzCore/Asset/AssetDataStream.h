@@ -9,7 +9,9 @@
 
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZStd
@@ -18,6 +20,12 @@ namespace AZStd
     class vector;
 }
 
+namespace AZ::IO
+{
+    class ExternalFileRequest;
+    using FileRequestPtr = AZStd::intrusive_ptr<ExternalFileRequest>;
+}
+
 namespace AZ::Data
 {
     namespace DataStreamInternal
@@ -44,11 +52,14 @@ namespace AZ::Data
         void Open(VectorDataSource&& data);
 
         // Open the AssetDataStream and load it via file streaming
+        // If requestBatch is provided the read request is appended to it instead of being queued, and the caller is
+        // responsible for queueing the batch with IStreamer::QueueRequestBatch.
         using OnCompleteCallback = AZStd::function<void(AZ::IO::IStreamerTypes::RequestStatus)>;
+        using FileRequestBatch = AZStd::vector<AZ::IO::FileRequestPtr, AZStd::allocator>;
         void Open(const AZStd::string& filePath, size_t fileOffset, size_t assetSize,
             AZ::IO::IStreamerTypes::Deadline deadline = AZ::IO::IStreamerTypes::s_noDeadline,
             AZ::IO::IStreamerTypes::Priority priority = AZ::IO::IStreamerTypes::s_priorityMedium,
-            OnCompleteCallback loadCallback = {});
+            OnCompleteCallback loadCallback = {}, FileRequestBatch* requestBatch = nullptr);
 
         // Reschedule the outstanding request.  Will only update with shorter deadline values or higher priority values
         void Reschedule(AZ::IO::IStreamerTypes::Deadline newDeadline, AZ::IO::IStreamerTypes::Priority newPriority);
@@ -73,6 +84,11 @@ namespace AZ::Data
 
         AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override;
 
+        //! Reads up to the requested number of bytes without copying them, by returning a view of the loaded data instead.
+        //! The view stays valid until the stream is closed, so handlers that keep referring to the data after loading
+        //! need to hold on to the stream as well.
+        AZStd::span<const AZ::u8> ReadInPlace(AZ::IO::SizeType bytes);
+
         AZ::IO::SizeType GetCurPos() const override { return m_curOffset; }
         AZ::IO::SizeType GetLength() const override { return m_requestedAssetSize; }
         void Close() override;
@@ -630,6 +630,8 @@ namespace AZ::Data
     {
         m_cancelAllActiveJobs = true;
 
+        ClearReleasedAssets();
+
         // We want to ensure that no active load jobs are in flight and
         // therefore we need to wait till all jobs have completed. Please note that jobs get deleted automatically once they complete.
         WaitForActiveJobsAndStreamerRequestsToFinish();
@@ -697,6 +699,9 @@ namespace AZ::Data
                     // (~1 per 5000 runs) trigger the error case if we didn't wait for the jobs to finish here.
                     WaitForActiveJobsAndStreamerRequestsToFinish();
 
+                    // Released assets kept loaded by the budget still need the handler to be destroyed.
+                    ClearReleasedAssetsOfType(it->first);
+
                     {
                         // this scope is used to control the scope of the lock.
                         AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
@@ -832,6 +837,132 @@ namespace AZ::Data
         }
     }
 
+    void AssetManager::SetReleasedAssetBudget(const AssetType& assetType, AZ::u64 budgetBytes)
+    {
+        AZStd::vector<AssetData*> evictedAssets;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+            ReleasedAssetPool& pool = m_releasedAssetPools[assetType];
+            pool.m_stats.m_budgetBytes = budgetBytes;
+            EvictReleasedAssets(pool, budgetBytes, evictedAssets);
+        }
+        ReleaseEvictedAssets(evictedAssets);
+    }
+
+    AssetManager::ReleasedAssetStats AssetManager::GetReleasedAssetStats(const AssetType& assetType) const
+    {
+        AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+        auto poolIt = m_releasedAssetPools.find(assetType);
+        return poolIt != m_releasedAssetPools.end() ? poolIt->second.m_stats : ReleasedAssetStats{};
+    }
+
+    void AssetManager::ClearReleasedAssets()
+    {
+        AZStd::vector<AssetData*> evictedAssets;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+            for (auto& [assetType, pool] : m_releasedAssetPools)
+            {
+                EvictReleasedAssets(pool, 0, evictedAssets);
+            }
+        }
+        ReleaseEvictedAssets(evictedAssets);
+    }
+
+    void AssetManager::ClearReleasedAssetsOfType(const AssetType& assetType)
+    {
+        AZStd::vector<AssetData*> evictedAssets;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+            auto poolIt = m_releasedAssetPools.find(assetType);
+            if (poolIt != m_releasedAssetPools.end())
+            {
+                EvictReleasedAssets(poolIt->second, 0, evictedAssets);
+            }
+        }
+        ReleaseEvictedAssets(evictedAssets);
+    }
+
+    void AssetManager::RetainReleasedAsset(AssetData* asset)
+    {
+        // Only ready assets in the asset map can be found again by a later GetAsset call
+        if (asset->GetStatus() != AssetData::AssetStatus::Ready || !asset->IsRegisterReadonlyAndShareable() ||
+            asset->m_creationToken == s_defaultCreationToken)
+        {
+            return;
+        }
+
+        const AssetType assetType = asset->GetType();
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+            auto poolIt = m_releasedAssetPools.find(assetType);
+            if (poolIt == m_releasedAssetPools.end() || poolIt->second.m_stats.m_budgetBytes == 0)
+            {
+                return;
+            }
+
+            // The asset was requested again while it was kept loaded, make it the most recently released one
+            auto lookupIt = m_releasedAssetLookup.find(asset);
+            if (lookupIt != m_releasedAssetLookup.end())
+            {
+                ReleasedAssetList& releasedAssets = poolIt->second.m_assets;
+                releasedAssets.splice(releasedAssets.end(), releasedAssets, lookupIt->second);
+                ++poolIt->second.m_stats.m_reuseCount;
+                return;
+            }
+        }
+
+        // Query the catalog without holding the lock, the asset is still referenced by the AssetData::Release call that got here.
+        AssetInfo assetInfo;
+        AssetCatalogRequestBus::BroadcastResult(assetInfo, &AssetCatalogRequestBus::Events::GetAssetInfoById, asset->GetId());
+        // Assets of unknown size still count for a byte so the budget bounds their number
+        const AZ::u64 sizeBytes = AZStd::max<AZ::u64>(assetInfo.m_sizeBytes, 1);
+
+        AZStd::vector<AssetData*> evictedAssets;
+        {
+            AZStd::scoped_lock<AZStd::recursive_mutex> releasedAssetLock(m_releasedAssetMutex);
+            auto poolIt = m_releasedAssetPools.find(assetType);
+            if (poolIt == m_releasedAssetPools.end() || sizeBytes > poolIt->second.m_stats.m_budgetBytes ||
+                m_releasedAssetLookup.contains(asset))
+            {
+                return;
+            }
+
+            ReleasedAssetPool& pool = poolIt->second;
+            asset->AcquireWeak();
+            pool.m_assets.push_back({ asset, sizeBytes });
+            m_releasedAssetLookup.emplace(asset, AZStd::prev(pool.m_assets.end()));
+            pool.m_stats.m_residentBytes += sizeBytes;
+            ++pool.m_stats.m_residentCount;
+
+            EvictReleasedAssets(pool, pool.m_stats.m_budgetBytes, evictedAssets);
+        }
+        ReleaseEvictedAssets(evictedAssets);
+    }
+
+    void AssetManager::EvictReleasedAssets(ReleasedAssetPool& pool, AZ::u64 budgetBytes, AZStd::vector<AssetData*>& evictedAssets)
+    {
+        while (pool.m_stats.m_residentBytes > budgetBytes)
+        {
+            const ReleasedAsset& releasedAsset = pool.m_assets.front();
+            pool.m_stats.m_residentBytes -= releasedAsset.m_sizeBytes;
+            --pool.m_stats.m_residentCount;
+            ++pool.m_stats.m_evictionCount;
+            evictedAssets.push_back(releasedAsset.m_asset);
+            m_releasedAssetLookup.erase(releasedAsset.m_asset);
+            pool.m_assets.pop_front();
+        }
+    }
+
+    void AssetManager::ReleaseEvictedAssets(const AZStd::vector<AssetData*>& evictedAssets)
+    {
+        // Dropping the last weak reference destroys the asset if nothing else references it
+        for (AssetData* asset : evictedAssets)
+        {
+            asset->ReleaseWeak();
+        }
+    }
+
     AssetData::AssetStatus AssetManager::BlockUntilLoadComplete(const Asset<AssetData>& asset)
     {
         if(asset.GetStatus() == AssetData::AssetStatus::NotLoaded)
@@ -962,7 +1093,8 @@ namespace AZ::Data
     }
 
     Asset<AssetData> AssetManager::GetAssetInternal(const AssetId& assetId, [[maybe_unused]] const AssetType& assetType,
-        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */)
+        AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams, AssetInfo assetInfo /*= () */, bool signalLoaded /*= false */,
+        AssetDataStream::FileRequestBatch* requestBatch /*= nullptr */)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1109,7 +1241,7 @@ namespace AZ::Data
             AZ_Assert(loadInfo.IsValid(), "Expected valid stream info when dataStream is valid.");
             constexpr bool isReload = false;
             QueueAsyncStreamLoad(asset, dataStream, loadInfo, isReload,
-                handler, loadParams, signalLoaded);
+                handler, loadParams, signalLoaded, requestBatch);
         }
         else
         {
@@ -1378,6 +1510,7 @@ namespace AZ::Data
         }
 
         ReleaseAssetContainersForAsset(asset);
+        RetainReleasedAsset(asset);
     }
 
     void AssetManager::ReleaseAssetContainersForAsset(AssetData* asset)
@@ -1762,7 +1895,8 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
         const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
+        AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded,
+        AssetDataStream::FileRequestBatch* requestBatch)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1854,7 +1988,7 @@ namespace AZ::Data
             streamInfo.m_streamName,
             streamInfo.m_dataOffset,
             streamInfo.m_dataLen,
-            deadline, priority, assetDataStreamCallback);
+            deadline, priority, assetDataStreamCallback, requestBatch);
     }
 
     //=========================================================================
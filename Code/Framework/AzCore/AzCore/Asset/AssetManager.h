@@ -19,6 +19,7 @@
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 
@@ -150,6 +151,16 @@ namespace AZ
                 Descriptor() = default;
             };
 
+            //! Statistics of the released assets of one type that are kept loaded by SetReleasedAssetBudget
+            struct ReleasedAssetStats
+            {
+                AZ::u64 m_budgetBytes = 0;
+                AZ::u64 m_residentBytes = 0; //!< Combined size of the released assets kept loaded, as reported by the asset catalog
+                size_t m_residentCount = 0;
+                AZ::u64 m_reuseCount = 0; //!< Number of times an asset was requested again while it was kept loaded
+                AZ::u64 m_evictionCount = 0; //!< Number of released assets unloaded to stay within the budget
+            };
+
             typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
             typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
@@ -191,6 +202,18 @@ namespace AZ
             /// Resumes releasing assets that are no longer referenced.  Any currently un-referenced assets will be released upon calling this.
             void ResumeAssetRelease();
 
+            /**
+             * Keeps ready assets of the given type loaded after their last reference is released, so that requesting them again
+             * doesn't reload them. When the released assets of the type get larger than budgetBytes, the least recently released
+             * ones are unloaded first. Assets that are referenced again keep counting toward the budget until they're evicted.
+             * \param budgetBytes budget for the type, in bytes of the asset files as reported by the asset catalog.
+             * A budget of 0, the default, unloads the assets as soon as they're released.
+             */
+            void SetReleasedAssetBudget(const AssetType& assetType, AZ::u64 budgetBytes);
+            ReleasedAssetStats GetReleasedAssetStats(const AssetType& assetType) const;
+            /// Unloads all the released assets that are kept loaded by the released asset budgets.  The budgets stay as they are.
+            void ClearReleasedAssets();
+
             /**
              * Blocks the current thread until the specified asset has finished loading (whether successful or not)
              * \param asset a valid asset which has already been requested to load.  It is an error to block on an asset which has not been requested to load already
@@ -354,7 +377,10 @@ namespace AZ
             void ValidateAndPostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
             void PostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
-            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
+            //! When requestBatch is provided the streamer read for the asset is appended to it instead of being queued right away,
+            //! so callers loading several assets at once can queue all the reads with a single IStreamer::QueueRequestBatch.
+            Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false,
+                AssetDataStream::FileRequestBatch* requestBatch = nullptr);
             // Alternative path to GetAssetInternal intended to be called by the AssetContainer when reloading an asset
             // Assumes the asset is already ready to go and just needs to be set up for loading
             void QueueAssetReload(AZ::Data::Asset<AZ::Data::AssetData> asset, bool signalLoaded);
@@ -404,7 +430,8 @@ namespace AZ
             //! Queue an async file load with the AssetDataStream as the first step in an asset load
             void QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
-                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded);
+                AssetHandler* handler, const AssetLoadParameters& loadParameters, bool signalLoaded,
+                AssetDataStream::FileRequestBatch* requestBatch = nullptr);
 
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
@@ -417,6 +444,29 @@ namespace AZ
             AZStd::unordered_multimap<AssetId, AssetContainer*> m_ownedAssetContainerLookup;
             AZStd::recursive_mutex  m_assetContainerMutex;       // lock when accessing the assetContainers map
 
+            //! Keeps a weak reference on a ready asset after its last reference was released, see SetReleasedAssetBudget
+            struct ReleasedAsset
+            {
+                AssetData* m_asset = nullptr;
+                AZ::u64 m_sizeBytes = 0;
+            };
+            using ReleasedAssetList = AZStd::list<ReleasedAsset>;
+            struct ReleasedAssetPool
+            {
+                ReleasedAssetStats m_stats;
+                ReleasedAssetList m_assets; // least recently released first
+            };
+            void RetainReleasedAsset(AssetData* asset);
+            //! Removes released assets from the pool until it fits in budgetBytes, the caller releases the evicted assets
+            //! once m_releasedAssetMutex is unlocked since that can destroy them.
+            void EvictReleasedAssets(ReleasedAssetPool& pool, AZ::u64 budgetBytes, AZStd::vector<AssetData*>& evictedAssets);
+            void ReleaseEvictedAssets(const AZStd::vector<AssetData*>& evictedAssets);
+            void ClearReleasedAssetsOfType(const AssetType& assetType);
+
+            AZStd::unordered_map<AssetType, ReleasedAssetPool> m_releasedAssetPools;
+            AZStd::unordered_map<AssetData*, ReleasedAssetList::iterator> m_releasedAssetLookup;
+            mutable AZStd::recursive_mutex m_releasedAssetMutex;
+
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
 
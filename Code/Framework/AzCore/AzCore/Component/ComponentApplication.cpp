@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -1632,6 +1633,9 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        // Transient frame data from the oldest frame becomes invalid here
+        static_cast<FrameAllocator&>(AllocatorInstance<FrameAllocator>::Get()).AdvanceFrame();
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -37,6 +37,7 @@
 DECLARE_EBUS_INSTANTIATION(EntityEvents);
 DECLARE_EBUS_INSTANTIATION(TransformInterface);
 DECLARE_EBUS_INSTANTIATION(TransformNotification);
+DECLARE_EBUS_INSTANTIATION(TransformBatchNotification);
 DECLARE_EBUS_INSTANTIATION(TransformHierarchyInformation);
 
 namespace AZ
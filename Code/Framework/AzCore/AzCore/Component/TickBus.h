@@ -100,6 +100,12 @@ namespace AZ
          * This mutex is for the event queue, not TickEvents. Do not add a mutex to TickEvents.
          */
         typedef AZStd::recursive_mutex EventQueueMutexType; 
+
+        /**
+         * Walks a contiguous array of the connected handlers when ticking, handlers rarely change between ticks.
+         * Handlers that connect during a tick receive OnTick starting with the next tick.
+         */
+        static const bool EnableContiguousDispatch = true;
         
         /**
          * Determines the order in which handlers receive tick events. 
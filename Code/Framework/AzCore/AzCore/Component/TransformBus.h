@@ -17,6 +17,7 @@
 #include <AzCore/Math/InterpolationSample.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/EBus/Event.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -314,6 +315,8 @@ namespace AZ
         : public ComponentBus
     {
     public:
+        //! Transform changes are dispatched far more often than handlers connect, so walk a contiguous array of the handlers.
+        static const bool EnableContiguousDispatch = true;
 
         //! Destroys the instance of the class.
         virtual ~TransformNotification() {}
@@ -359,6 +362,47 @@ namespace AZ
     //! The events are defined in the AZ::TransformNotification class.
     using TransformNotificationBus = AZ::EBus<TransformNotification>;
 
+    //! Interface for AZ::TransformBatchNotificationBus, which dispatches the world transform changes of a frame in a single batch.
+    //! Listeners that update many entities, like render feature processors or spatial structures, can use this
+    //! instead of connecting to the TransformNotificationBus of every entity, and react once to the final transform
+    //! of each entity rather than to every intermediate change.
+    class TransformBatchNotification
+        : public AZ::EBusTraits
+    {
+    public:
+        static const EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::Multiple;
+        static const bool EnableContiguousDispatch = true;
+
+        virtual ~TransformBatchNotification() = default;
+
+        //! Signals that the world transform of entities changed since the last batch.
+        //! Every entity appears once, with the world transform it had when the batch was flushed.
+        //! @param entityIds The entities whose world transform changed.
+        //! @param worldTransforms The new world transforms, in the same order as entityIds.
+        virtual void OnTransformsChanged(AZStd::span<const EntityId> entityIds, AZStd::span<const Transform> worldTransforms) = 0;
+    };
+
+    //! The EBus for batched transform notification events.
+    using TransformBatchNotificationBus = AZ::EBus<TransformBatchNotification>;
+
+    //! Collects the world transform changes of entities and sends them to the TransformBatchNotificationBus.
+    //! The transform component queues its changes here when there are batch listeners, and changes are flushed
+    //! once per frame after all the tick handlers ran, so several changes to the same entity are coalesced.
+    class TransformBatchRequests
+    {
+    public:
+        AZ_RTTI(TransformBatchRequests, "{5C8B1E2A-7F43-4D6B-A0E5-93C1D2F8B746}");
+
+        virtual ~TransformBatchRequests() = default;
+
+        //! Queues the world transform change of an entity for the next batch.
+        virtual void QueueTransformChanged(EntityId entityId, const Transform& worldTransform) = 0;
+
+        //! Sends the queued transform changes to the TransformBatchNotificationBus.
+        //! Changes queued while the batch is dispatched are sent with the next batch.
+        virtual void FlushTransformChanges() = 0;
+    };
+
     //! The typeId of game component AzFramework::TransformComponent.
     static constexpr TypeId TransformComponentTypeId{ AZStd::string_view("{22B10178-39B6-4C12-BB37-77DB45FDD3B6}") };
 
@@ -490,4 +534,5 @@ namespace AZ
 
 DECLARE_EBUS_EXTERN(TransformInterface);
 DECLARE_EBUS_EXTERN(TransformNotification);
+DECLARE_EBUS_EXTERN(TransformBatchNotification);
 DECLARE_EBUS_EXTERN(TransformHierarchyInformation);
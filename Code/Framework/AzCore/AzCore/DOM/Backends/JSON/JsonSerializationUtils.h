@@ -112,72 +112,6 @@ namespace AZ::Dom::Json
         Lifetime m_stringLifetime;
     };
 
-    //! rapidjson stream wrapper for AZStd::string suitable for in-situ parsing
-    //! Faster than rapidjson::MemoryStream for reading from AZStd::string / AZStd::string_view (because it requires a null terminator)
-    //! \note This needs to be inlined for performance reasons.
-    struct NullDelimitedStringStream
-    {
-        using Ch = char; //<! Denotes the string character storage type for rapidjson
-
-        AZ_FORCE_INLINE NullDelimitedStringStream(char* buffer)
-        {
-            m_cursor = buffer;
-            m_begin = m_cursor;
-        }
-
-        AZ_FORCE_INLINE NullDelimitedStringStream(AZStd::string_view buffer)
-        {
-            // rapidjson won't actually call PutBegin or Put unless kParseInSituFlag is set, so this is safe
-            m_cursor = const_cast<char*>(buffer.data());
-            m_begin = m_cursor;
-        }
-
-        AZ_FORCE_INLINE char Peek() const
-        {
-            return *m_cursor;
-        }
-
-        AZ_FORCE_INLINE char Take()
-        {
-            return *m_cursor++;
-        }
-
-        AZ_FORCE_INLINE size_t Tell() const
-        {
-            return static_cast<size_t>(m_cursor - m_begin);
-        }
-
-        AZ_FORCE_INLINE char* PutBegin()
-        {
-            m_write = m_cursor;
-            return m_cursor;
-        }
-
-        AZ_FORCE_INLINE void Put(char c)
-        {
-            (*m_write++) = c;
-        }
-
-        AZ_FORCE_INLINE void Flush()
-        {
-        }
-
-        AZ_FORCE_INLINE size_t PutEnd(char* begin)
-        {
-            return m_write - begin;
-        }
-
-        AZ_FORCE_INLINE const char* Peek4() const
-        {
-            AZ_Assert(false, "Not implemented, encoding is hard-coded to UTF-8");
-            return m_cursor;
-        }
-
-        char* m_cursor; //!< Current read position.
-        char* m_write; //!< Current write position.
-        const char* m_begin; //!< Head of string.
-    };
-
     //! Creates a Visitor that will write serialized JSON to the specified stream.
     //! \param stream The stream the visitor will write to.
     //! \param format The format to write in.
@@ -229,10 +163,11 @@ namespace AZ::Dom::Json
         rapidjson::Reader reader;
         RapidJsonReadHandler handler(&visitor, lifetime);
 
-        // If the string is null terminated, we can use the faster AzStringStream path - otherwise we fall back on rapidjson::MemoryStream
+        // If the string is null terminated, we can use the faster string stream path - otherwise we fall back on rapidjson::MemoryStream.
+        // rapidjson only uses its SIMD scanning of whitespace and strings for its own string streams.
         if (buffer.data()[buffer.size()] == '\0')
         {
-            NullDelimitedStringStream stream(buffer);
+            rapidjson::StringStream stream(buffer.data());
             reader.Parse<aznumeric_cast<unsigned>(parseFlags)>(stream, handler);
         }
         else
@@ -247,7 +182,7 @@ namespace AZ::Dom::Json
     Visitor::Result VisitSerializedJsonInPlace(char* buffer, Visitor& visitor)
     {
         rapidjson::Reader reader;
-        NullDelimitedStringStream stream(buffer);
+        rapidjson::InsituStringStream stream(buffer);
         RapidJsonReadHandler handler(&visitor, Lifetime::Persistent);
 
         reader.Parse<aznumeric_cast<unsigned>(parseFlags) | rapidjson::kParseInsituFlag>(stream, handler);
@@ -573,7 +573,7 @@ namespace AZ::Dom
 
     const Value& Value::operator[](AZStd::string_view name) const
     {
-        return operator[](AZ::Name(name));
+        return FindMember(name)->second;
     }
 
     Object::ConstIterator Value::MemberBegin() const
@@ -609,7 +609,15 @@ namespace AZ::Dom
 
     Object::ConstIterator Value::FindMember(AZStd::string_view name) const
     {
-        return FindMember(AZ::Name(name));
+        // Compare against the key strings rather than constructing an AZ::Name, which would lock the name dictionary
+        // and intern the name even when it isn't a member
+        const Object::ContainerType& object = GetObjectInternal();
+        return AZStd::find_if(
+            object.begin(), object.end(),
+            [name](const Object::EntryType& entry)
+            {
+                return entry.first.GetStringView() == name;
+            });
     }
 
     Object::Iterator Value::FindMutableMember(KeyType name)
@@ -625,7 +633,13 @@ namespace AZ::Dom
 
     Object::Iterator Value::FindMutableMember(AZStd::string_view name)
     {
-        return FindMutableMember(AZ::Name(name));
+        Object::ContainerType& object = GetObjectInternal();
+        return AZStd::find_if(
+            object.begin(), object.end(),
+            [name](const Object::EntryType& entry)
+            {
+                return entry.first.GetStringView() == name;
+            });
     }
 
     Value& Value::MemberReserve(size_t newCapacity)
@@ -641,7 +655,7 @@ namespace AZ::Dom
 
     bool Value::HasMember(AZStd::string_view name) const
     {
-        return HasMember(AZ::Name(name));
+        return FindMember(name) != GetObjectInternal().end();
     }
 
     Value& Value::AddMember(KeyType name, Value value)
@@ -715,7 +729,7 @@ namespace AZ::Dom
 
     Object::Iterator Value::EraseMember(AZStd::string_view name)
     {
-        return EraseMember(AZ::Name(name));
+        return GetObjectInternal().erase(FindMember(name));
     }
 
     Object::ContainerType& Value::GetMutableObject()
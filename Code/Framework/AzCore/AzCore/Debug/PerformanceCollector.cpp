@@ -29,8 +29,9 @@ namespace AZ::Debug
     {
         for (const auto& metricName : m_metricNames)
         {
-            [[maybe_unused]] const auto statisticPtr = m_statisticsManager.AddStatistic(metricName, metricName, "us");
+            const auto statisticPtr = m_statisticsManager.AddStatistic(metricName, metricName, "us");
             AZ_Assert(statisticPtr, "Failed to add metric with name <%.*s>. Maybe already added?", AZ_STRING_ARG(metricName));
+            m_metricStates.emplace(AZStd::string(metricName), MetricState{ statisticPtr });
         }
         RestartPeriodicEventStamps();
     }
@@ -100,9 +101,19 @@ namespace AZ::Debug
 
     void PerformanceCollector::RecordSample(AZStd::string_view metricName, AZStd::chrono::microseconds microSeconds)
     {
+        if (IsWaitingBeforeCapture())
+        {
+            // Samples outside of a batch would otherwise leak into the statistics of the next one
+            return;
+        }
+
         if (m_dataLogType == DataLogType::LogStatistics)
         {
-            m_statisticsManager.PushSampleForStatistic(metricName, aznumeric_caster(microSeconds.count()));
+            auto metricIter = m_metricStates.find(metricName);
+            if (metricIter != m_metricStates.end() && metricIter->second.m_statistic)
+            {
+                metricIter->second.m_statistic->PushSample(aznumeric_caster(microSeconds.count()));
+            }
         }
         else
         {
@@ -120,9 +131,14 @@ namespace AZ::Debug
         {
             return;
         }
-        auto prevStamp = m_periodicEventStamps[metricName];
+        auto metricIter = m_metricStates.find(metricName);
+        if (metricIter == m_metricStates.end())
+        {
+            metricIter = m_metricStates.emplace(AZStd::string(metricName), MetricState{}).first;
+        }
         AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
-        m_periodicEventStamps[metricName] = now;
+        const auto prevStamp = metricIter->second.m_periodicEventStamp;
+        metricIter->second.m_periodicEventStamp = now;
         if (prevStamp.time_since_epoch().count() == 0)
         {
             return;
@@ -160,12 +176,9 @@ namespace AZ::Debug
 
     void PerformanceCollector::RestartPeriodicEventStamps()
     {
-        AZStd::vector<Statistics::NamedRunningStatistic*> statistics;
-        m_statisticsManager.GetAllStatistics(statistics);
-        m_periodicEventStamps.clear();
-        for (auto statistic : statistics)
+        for (auto& metricState : m_metricStates)
         {
-            m_periodicEventStamps[statistic->GetName()] = {};
+            metricState.second.m_periodicEventStamp = {};
         }
     }
 
@@ -130,9 +130,13 @@ namespace AZ::Debug
         //! Only used when @m_captureType == CaptureType::LogStatistics.
         AZ::Statistics::StatisticsManager<AZStd::string> m_statisticsManager;
 
-        //! Only used to store the previous value when RecordPeriodicEvent() is called
-        //! for any given metrics.
-        AZStd::unordered_map<AZStd::string, AZStd::chrono::steady_clock::time_point> m_periodicEventStamps;
+        //! Per metric state, looked up without allocating from the metric name passed to RecordSample() and RecordPeriodicEvent().
+        struct MetricState
+        {
+            Statistics::NamedRunningStatistic* m_statistic = nullptr; //!< Owned by @m_statisticsManager.
+            AZStd::chrono::steady_clock::time_point m_periodicEventStamp; //!< The previous time RecordPeriodicEvent() was called.
+        };
+        AZStd::unordered_map<AZStd::string, MetricState, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_metricStates;
 
         //! In some circumstances, like running under UnitTests, an output file won't be created.
         //! Instead the output data will be streamed into this buffer.
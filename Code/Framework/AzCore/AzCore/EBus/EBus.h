@@ -206,6 +206,18 @@ namespace AZ
         */
         static constexpr bool LocklessDispatch = false;
 
+        /**
+         * Determines whether forward Event and Broadcast dispatches walk a contiguous array of
+         * the handlers connected to an address instead of the intrusive handler container.
+         * The array is rebuilt by the first dispatch after a handler connects or disconnects,
+         * so this suits hot buses whose handlers rarely change, like the tick bus.
+         * Handlers connected during a dispatch receive events starting with the next dispatch.
+         * Only supported on buses with multiple handlers per address that are used from a single
+         * thread, which means the #MutexType must be NullMutex and LocklessDispatch must be false.
+         * By default, dispatches walk the handler container.
+         */
+        static constexpr bool EnableContiguousDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -592,6 +604,10 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::EnableContiguousDispatch || BusTraits::HandlerPolicy != EBusHandlerPolicy::Single),
+            "EnableContiguousDispatch is only supported when there are multiple handlers per address!");
+        static_assert((!BusTraits::EnableContiguousDispatch || (AZStd::is_same<MutexType, AZ::NullMutex>::value && !BusTraits::LocklessDispatch)),
+            "EnableContiguousDispatch is only supported on single threaded buses, MutexType must be NullMutex and LocklessDispatch must be false!");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -10,6 +10,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 AZ_TYPE_SAFE_INTEGRAL_CVARBINDING(TimeMs);
 
@@ -57,6 +58,9 @@ namespace AZ
     {
         TickBus::Handler::BusDisconnect();
 
+        m_queue.clear();
+        m_queueCompactSize = 0;
+
         // Clear all of these on Deactivate() so that they're properly deallocated before reaching the destructor.
         m_ownedEvents.clear();
         m_freeEvents.clear();
@@ -71,12 +75,13 @@ namespace AZ
 
         while (!m_queue.empty())
         {
-            ScheduledEventHandle* handle = m_queue.top();
+            ScheduledEventHandle* handle = m_queue.front();
             if (handle->GetExecuteTimeMs() > startTime)
             {
                 break;
             }
-            m_queue.pop();
+            AZStd::pop_heap(m_queue.begin(), m_queue.end(), CompareScheduledEventPtrs());
+            m_queue.pop_back();
             m_pendingQueue.push(handle);
         }
 
@@ -89,6 +94,10 @@ namespace AZ
             }
             ScheduledEventHandle* handle = m_pendingQueue.top();
             m_pendingQueue.pop();
+            if (handle->GetScheduledEvent() != nullptr)
+            {
+                ++m_firedEventCount;
+            }
             if (!handle->Notify()) // if Notify return false, the event has been deleted and we should delete its handle.
             {
                 FreeHandle(handle);
@@ -117,7 +126,7 @@ namespace AZ
         const bool ownsScheduledEvent = false;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        PushHandle(timedEvent->m_handle);
         return timedEvent->m_handle;
     }
 
@@ -133,7 +142,7 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        PushHandle(timedEvent->m_handle);
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -151,6 +160,11 @@ namespace AZ
         return m_queue.size();
     }
 
+    AZStd::size_t EventSchedulerSystemComponent::GetFiredEventCount() const
+    {
+        return m_firedEventCount;
+    }
+
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
         AZLOG_INFO("EventSchedulerSystemComponent::HandleCount = %u", aznumeric_cast<uint32_t>(GetHandleCount()));
@@ -158,6 +172,7 @@ namespace AZ
         AZLOG_INFO("EventSchedulerSystemComponent::OwnedEventCount = %u", aznumeric_cast<uint32_t>(m_ownedEvents.size()));
         AZLOG_INFO("EventSchedulerSystemComponent::FreeEventCount = %u", aznumeric_cast<uint32_t>(m_freeEvents.size()));
         AZLOG_INFO("EventSchedulerSystemComponent::QueueSize = %u", aznumeric_cast<uint32_t>(GetQueueSize()));
+        AZLOG_INFO("EventSchedulerSystemComponent::FiredEventCount = %u", aznumeric_cast<uint32_t>(GetFiredEventCount()));
     }
 
     ScheduledEventHandle* EventSchedulerSystemComponent::AllocateHandle()
@@ -195,6 +210,35 @@ namespace AZ
         return scheduledEvent;
     }
 
+    void EventSchedulerSystemComponent::PushHandle(ScheduledEventHandle* handle)
+    {
+        // Below this size the removed handles are cheap enough to leave until they expire.
+        constexpr AZStd::size_t MinCompactSize = 1024;
+        if (m_queue.size() >= AZStd::max(m_queueCompactSize, MinCompactSize))
+        {
+            auto liveEnd = m_queue.begin();
+            for (ScheduledEventHandle* queuedHandle : m_queue)
+            {
+                if (queuedHandle->GetScheduledEvent() != nullptr)
+                {
+                    *liveEnd++ = queuedHandle;
+                }
+                else
+                {
+                    FreeHandle(queuedHandle);
+                }
+            }
+            m_queue.erase(liveEnd, m_queue.end());
+            AZStd::make_heap(m_queue.begin(), m_queue.end(), CompareScheduledEventPtrs());
+
+            // Wait for the queue to double again, so compacting stays amortized O(1) per push.
+            m_queueCompactSize = m_queue.size() * 2;
+        }
+
+        m_queue.push_back(handle);
+        AZStd::push_heap(m_queue.begin(), m_queue.end(), CompareScheduledEventPtrs());
+    }
+
     void EventSchedulerSystemComponent::FreeHandle(ScheduledEventHandle* handle)
     {
         if (handle->GetOwnsScheduledEvent())
@@ -82,6 +82,7 @@ namespace AZ
         AZStd::size_t GetHandleCount() const;
         AZStd::size_t GetFreeHandleCount() const;
         AZStd::size_t GetQueueSize() const;
+        AZStd::size_t GetFiredEventCount() const;
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
@@ -93,12 +94,19 @@ namespace AZ
 
         void FreeHandle(ScheduledEventHandle* handle);
 
+        //! Pushes a handle on m_queue, dropping the handles of removed events first when they make up most of the queue.
+        void PushHandle(ScheduledEventHandle* handle);
+
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
-        // Priority queues of scheduled events sorted by execution time
-        AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
+        // Heap of scheduled events sorted by execution time, kept as a vector so handles of removed events can be dropped in one pass.
+        // Removing or re-enqueuing an event only clears its old handle, which otherwise stays queued until its execution time.
+        AZStd::vector<ScheduledEventHandle*> m_queue;
+        AZStd::size_t m_queueCompactSize = 0;
+        // Priority queue of the events due this tick
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
+        AZStd::size_t m_firedEventCount = 0;
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
         AZStd::deque<ScheduledEventHandle> m_handles;
@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 
@@ -69,6 +71,83 @@ namespace AZ
             }
         }
 
+        /**
+         * Contiguous copy of the interfaces connected to an address, used to dispatch on buses that set EnableContiguousDispatch.
+         * The copy is rebuilt by the first dispatch after a connect or disconnect. Handlers that disconnect while the copy is
+         * being dispatched to are cleared from it, so they don't receive calls after they were removed.
+         * If the copy is out of date while a dispatch is already in progress, the nested dispatch walks the handler container.
+         */
+        template <typename Interface, typename Traits, bool IsEnabled = Traits::EnableContiguousDispatch>
+        struct HandlerDispatchCache
+        {
+            template <typename Handlers, typename Callback>
+            bool Dispatch(void*, const typename Traits::BusIdType*, const Handlers&, Callback&&)
+            {
+                return false;
+            }
+            void OnConnect() {}
+            void OnDisconnect(Interface*) {}
+        };
+
+        template <typename Interface, typename Traits>
+        struct HandlerDispatchCache<Interface, Traits, true>
+        {
+            // Calls callback for every handler connected to the address, returns false if the caller needs to walk the handlers instead
+            template <typename Handlers, typename Callback>
+            bool Dispatch(void* context, const typename Traits::BusIdType* busId, const Handlers& handlers, Callback&& callback)
+            {
+                if (m_isDirty)
+                {
+                    if (m_dispatchDepth > 0)
+                    {
+                        return false;
+                    }
+
+                    m_interfaces.clear();
+                    for (const auto& handler : handlers)
+                    {
+                        m_interfaces.push_back(handler.m_interface);
+                    }
+                    m_isDirty = false;
+                }
+
+                // This must be done via void* and static cast because the EBus type
+                // is not available for resolution while function signatures are compiled.
+                using BusType = EBus<Interface, Traits>;
+                CallstackEntry<Interface, Traits> entry(static_cast<typename BusType::Context*>(context), busId);
+
+                // The array is not resized while it is dispatched to, disconnected handlers are only cleared
+                ++m_dispatchDepth;
+                for (size_t index = 0; index < m_interfaces.size(); ++index)
+                {
+                    if (Interface* handler = m_interfaces[index])
+                    {
+                        callback(handler);
+                    }
+                }
+                --m_dispatchDepth;
+                return true;
+            }
+
+            void OnConnect()
+            {
+                m_isDirty = true;
+            }
+
+            void OnDisconnect(Interface* handler)
+            {
+                m_isDirty = true;
+                if (m_dispatchDepth > 0)
+                {
+                    AZStd::replace(m_interfaces.begin(), m_interfaces.end(), handler, static_cast<Interface*>(nullptr));
+                }
+            }
+
+            AZStd::vector<Interface*, typename Traits::AllocatorType> m_interfaces;
+            uint32_t m_dispatchDepth = 0;
+            bool m_isDirty = true;
+        };
+
 // Executes router handling in a generic way
 #define EBUS_DO_ROUTING(contextParam, id, isQueued, isReverse) \
     do {                                                                                        \
@@ -125,6 +204,13 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if (holder.m_dispatchCache.Dispatch(context, &id, holder.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                            {
+                                holder.release();
+                                return;
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -168,6 +254,13 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if (holder.m_dispatchCache.Dispatch(context, &id, holder.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                            {
+                                holder.release();
+                                return;
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -265,6 +358,12 @@ namespace AZ
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if (busPtr->m_dispatchCache.Dispatch(context, &busPtr->m_busId, busPtr->m_handlers,
+                            [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                        {
+                            return;
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -301,6 +400,12 @@ namespace AZ
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if (busPtr->m_dispatchCache.Dispatch(context, &busPtr->m_busId, busPtr->m_handlers,
+                            [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                        {
+                            return;
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -387,6 +492,16 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if (holder.m_dispatchCache.Dispatch(context, &holder.m_busId, holder.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                            {
+                                // Increment before release so that if holder goes away, iterator is still valid
+                                ++addressIt;
+
+                                holder.release();
+                                continue;
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -433,6 +548,16 @@ namespace AZ
                             HandlerHolder& holder = *addressIt;
                             holder.add_ref();
 
+                            if (holder.m_dispatchCache.Dispatch(context, &holder.m_busId, holder.m_handlers,
+                                [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                            {
+                                // Increment before release so that if holder goes away, iterator is still valid
+                                ++addressIt;
+
+                                holder.release();
+                                continue;
+                            }
+
                             auto& handlers = holder.m_handlers;
                             auto handlerIt = handlers.begin();
                             auto handlersEnd = handlers.end();
@@ -684,6 +809,7 @@ namespace AZ
                 IdType m_busId;
                 typename HandlerStorage::StorageType m_handlers;
                 AZStd::atomic_uint m_refCount{ 0 };
+                HandlerDispatchCache<Interface, Traits> m_dispatchCache;
 
                 HandlerHolder(ContainerType& storage, const IdType& id)
                     : m_busContainer(storage)
@@ -694,6 +820,7 @@ namespace AZ
                     : m_busContainer(rhs.m_busContainer)
                     , m_busId(rhs.m_busId)
                     , m_handlers(AZStd::move(rhs.m_handlers))
+                    , m_dispatchCache(AZStd::move(rhs.m_dispatchCache))
                 {
                     m_refCount.store(rhs.m_refCount.load());
                     rhs.m_refCount.store(0);
@@ -745,6 +872,7 @@ namespace AZ
 
                 HandlerHolder& holder = FindOrCreateHandlerHolder(id);
                 holder.m_handlers.insert(handler);
+                holder.m_dispatchCache.OnConnect();
                 handler.m_holder = &holder;
             }
 
@@ -753,6 +881,7 @@ namespace AZ
                 EBUS_ASSERT(handler.m_holder, "Internal error: disconnecting handler that is incompletely connected");
 
                 handler.m_holder->m_handlers.erase(handler);
+                handler.m_holder->m_dispatchCache.OnDisconnect(handler.m_interface);
 
                 // Must reset handler after removing it from the list, otherwise m_holder could have been destroyed already (and handlerList would be invalid)
                 handler.m_holder.reset();
@@ -1339,6 +1468,12 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if (context->m_buses.m_dispatchCache.Dispatch(context, nullptr, context->m_buses.m_handlers,
+                            [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); }))
+                        {
+                            return;
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1374,6 +1509,12 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if (context->m_buses.m_dispatchCache.Dispatch(context, nullptr, context->m_buses.m_handlers,
+                            [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); }))
+                        {
+                            return;
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1488,15 +1629,18 @@ namespace AZ
             {
                 // Don't need to check for duplicates here, because BusConnect would have caught it already
                 m_handlers.insert(handler);
+                m_dispatchCache.OnConnect();
             }
 
             void Disconnect(HandlerNode& handler)
             {
                 // Don't need to check that handler is already connected here, because BusDisconnect would have caught it already
                 m_handlers.erase(handler);
+                m_dispatchCache.OnDisconnect(handler.m_interface);
             }
 
             typename HandlerStorage::StorageType m_handlers;
+            HandlerDispatchCache<Interface, Traits> m_dispatchCache;
         };
 
         // Specialization for single address, single handler
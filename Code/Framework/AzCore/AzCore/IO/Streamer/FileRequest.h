@@ -82,6 +82,7 @@ namespace AZ::IO::Requests
         u64 m_size; //!< The number of bytes to read from the file.
         IStreamerTypes::Priority m_priority; //!< Priority used for ordering requests. This is used when requests have the same deadline.
         IStreamerTypes::MemoryType m_memoryType; //!< The type of memory provided by the allocator if used.
+        u32 m_bandwidthClass{ 0 }; //!< Index of the bandwidth class the scheduler assigned this request to.
     };
 
     //! Creates a cache dedicated to a single file. This is best used for files where blocks are read from
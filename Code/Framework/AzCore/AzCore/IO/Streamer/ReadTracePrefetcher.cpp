@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadTracePrefetcher.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    namespace ReadTracePrefetcherInternal
+    {
+        static constexpr char TraceHeader[] = "O3DE read trace 1";
+        static constexpr char PrefetchHitRateName[] = "Prefetch hit rate";
+        static constexpr char WastedPrefetchesName[] = "Wasted prefetches";
+    } // namespace ReadTracePrefetcherInternal
+
+    bool SaveReadTrace(GenericStream& stream, const ReadTrace& trace)
+    {
+        using namespace ReadTracePrefetcherInternal;
+
+        AZStd::string text = AZStd::string::format("%s\n", TraceHeader);
+        for (const ReadTraceEntry& entry : trace)
+        {
+            // The path goes last as it's the only field that can contain spaces.
+            text += AZStd::string::format("%llu %llu %.*s\n", entry.m_offset, entry.m_size, AZ_STRING_ARG(entry.m_path.Native()));
+        }
+        return stream.Write(text.size(), text.data()) == text.size();
+    }
+
+    bool LoadReadTrace(GenericStream& stream, ReadTrace& trace)
+    {
+        using namespace ReadTracePrefetcherInternal;
+
+        AZStd::string text;
+        text.resize_no_construct(stream.GetLength() - stream.GetCurPos());
+        if (stream.Read(text.size(), text.data()) != text.size())
+        {
+            return false;
+        }
+
+        AZStd::string_view remaining = text;
+        auto nextLine = [&remaining]()
+        {
+            size_t end = remaining.find('\n');
+            AZStd::string_view line = remaining.substr(0, end);
+            remaining = end == AZStd::string_view::npos ? AZStd::string_view() : remaining.substr(end + 1);
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+            return line;
+        };
+
+        if (nextLine() != TraceHeader)
+        {
+            AZ_Error("Streamer", false, "Stream doesn't contain a read trace.");
+            return false;
+        }
+
+        trace.clear();
+        while (!remaining.empty())
+        {
+            AZStd::string_view line = nextLine();
+            if (line.empty())
+            {
+                continue;
+            }
+
+            size_t offsetEnd = line.find(' ');
+            size_t sizeEnd = offsetEnd == AZStd::string_view::npos ? AZStd::string_view::npos : line.find(' ', offsetEnd + 1);
+            if (sizeEnd == AZStd::string_view::npos || sizeEnd + 1 >= line.size())
+            {
+                AZ_Error("Streamer", false, "Read trace contains an invalid entry '%.*s'.", AZ_STRING_ARG(line));
+                trace.clear();
+                return false;
+            }
+
+            ReadTraceEntry& entry = trace.emplace_back();
+            entry.m_offset = AZStd::stoull(AZStd::string(line.substr(0, offsetEnd)));
+            entry.m_size = AZStd::stoull(AZStd::string(line.substr(offsetEnd + 1, sizeEnd - offsetEnd - 1)));
+            entry.m_path = line.substr(sizeEnd + 1);
+        }
+        return true;
+    }
+
+    AZStd::shared_ptr<StreamStackEntry> ReadTracePrefetcherConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<ReadTracePrefetcher>(
+            m_cacheSizeMib * 1_mib, AZStd::max(m_maxNumPrefetches, 1u), aznumeric_cast<u32>(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void ReadTracePrefetcherConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ReadTracePrefetcherConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("CacheSizeMib", &ReadTracePrefetcherConfig::m_cacheSizeMib)
+                ->Field("MaxNumPrefetches", &ReadTracePrefetcherConfig::m_maxNumPrefetches);
+        }
+    }
+
+    ReadTracePrefetcher::ReadTracePrefetcher(u64 cacheSize, u32 maxNumPrefetches, u32 alignment)
+        : StreamStackEntry("Read trace prefetcher")
+        , m_cacheSize(cacheSize)
+        , m_maxNumPrefetches(maxNumPrefetches)
+        , m_alignment(alignment)
+    {
+        AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
+    }
+
+    ReadTracePrefetcher::~ReadTracePrefetcher()
+    {
+        for (Prefetch& prefetch : m_prefetches)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(prefetch.m_buffer, prefetch.m_size, m_alignment);
+        }
+    }
+
+    void ReadTracePrefetcher::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                ReadFile(request, args);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CustomData>)
+            {
+                if (HandleCustomRequest(request, args.m_data))
+                {
+                    return;
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+                {
+                    FlushPrefetches(&args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+                {
+                    FlushPrefetches(nullptr);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool ReadTracePrefetcher::ExecuteRequests()
+    {
+        bool issuedPrefetches = IssuePrefetches();
+        bool nextResult = StreamStackEntry::ExecuteRequests();
+        return nextResult || issuedPrefetches;
+    }
+
+    void ReadTracePrefetcher::UpdateStatus(Status& status) const
+    {
+        // Available slots are not updated as prefetches are limited by their own count and are only issued once the next
+        // node has had a chance to process the demand reads.
+        StreamStackEntry::UpdateStatus(status);
+        status.m_isIdle = status.m_isIdle && m_numInFlightPrefetches == 0 && !CanIssuePrefetch();
+    }
+
+    void ReadTracePrefetcher::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        // Demand reads that are waiting for a prefetch complete when the prefetch does.
+        for (const Prefetch& prefetch : m_prefetches)
+        {
+            if (prefetch.m_inFlight)
+            {
+                for (const Waiter& waiter : prefetch.m_waiters)
+                {
+                    waiter.m_wait->SetEstimatedCompletion(prefetch.m_inFlight->GetEstimatedCompletion());
+                }
+            }
+        }
+    }
+
+    void ReadTracePrefetcher::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        using namespace ReadTracePrefetcherInternal;
+
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, PrefetchHitRateName, CalculateHitRatePercentage(),
+            "The percentage of reads during prefetching that were served from prefetched data. A low value indicates that the reads "
+            "differ from the recorded trace, in which case a new trace should be recorded."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, WastedPrefetchesName, aznumeric_cast<s64>(m_numWastedPrefetches),
+            "The number of prefetches that were released without being read."));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    double ReadTracePrefetcher::CalculateHitRatePercentage() const
+    {
+        return m_hitRateStat.GetAverage();
+    }
+
+    void ReadTracePrefetcher::ReadFile(FileRequest* request, Requests::ReadData& data)
+    {
+        using namespace ReadTracePrefetcherInternal;
+
+        if (m_isRecording)
+        {
+            m_recording.push_back({ AZ::IO::Path(data.m_path.GetRelativePath()), data.m_offset, data.m_size });
+        }
+
+        if (m_prefetches.empty() && m_traceCursor >= m_trace.size())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        for (size_t i = 0; i < m_prefetches.size(); ++i)
+        {
+            Prefetch& prefetch = m_prefetches[i];
+            if (prefetch.m_discard || data.m_offset < prefetch.m_offset ||
+                data.m_offset + data.m_size > prefetch.m_offset + prefetch.m_size || prefetch.m_path != data.m_path)
+            {
+                continue;
+            }
+
+            m_hitRateStat.PushSample(1.0);
+            Statistic::PlotImmediate(m_name, PrefetchHitRateName, m_hitRateStat.GetMostRecentSample());
+
+            u64 offset = data.m_offset - prefetch.m_offset;
+            if (prefetch.m_inFlight)
+            {
+                FileRequest* wait = m_context->GetNewInternalRequest();
+                wait->CreateWait(request);
+                prefetch.m_waiters.push_back({ wait, reinterpret_cast<u8*>(data.m_output), offset, data.m_size });
+            }
+            else
+            {
+                memcpy(data.m_output, prefetch.m_buffer + offset, data.m_size);
+                ReleasePrefetch(i);
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            // Reads are expected to arrive in the order of the trace, so anything prefetched before this read has been skipped.
+            ReleaseCompletedPrefetches(i);
+            return;
+        }
+
+        m_hitRateStat.PushSample(0.0);
+        Statistic::PlotImmediate(m_name, PrefetchHitRateName, m_hitRateStat.GetMostRecentSample());
+
+        // If the read arrived before it could be prefetched there's no reason to prefetch it anymore.
+        if (m_traceCursor < m_trace.size())
+        {
+            const ReadTraceEntry& entry = m_trace[m_traceCursor];
+            if (entry.m_offset == data.m_offset && entry.m_size == data.m_size && RequestPath(entry.m_path) == data.m_path)
+            {
+                m_traceCursor++;
+            }
+        }
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    bool ReadTracePrefetcher::HandleCustomRequest(FileRequest* request, AZStd::any& data)
+    {
+        if (AZStd::any_cast<ReadTraceRequests::StartRecording>(&data))
+        {
+            m_recording.clear();
+            m_isRecording = true;
+        }
+        else if (auto stopRecording = AZStd::any_cast<ReadTraceRequests::StopRecording>(&data))
+        {
+            if (stopRecording->m_output)
+            {
+                *stopRecording->m_output = AZStd::move(m_recording);
+            }
+            m_recording.clear();
+            m_isRecording = false;
+        }
+        else if (auto startPrefetching = AZStd::any_cast<ReadTraceRequests::StartPrefetching>(&data))
+        {
+            StopPrefetching();
+            m_trace = AZStd::move(startPrefetching->m_trace);
+            m_traceCursor = 0;
+            m_hitRateStat.Reset();
+        }
+        else if (AZStd::any_cast<ReadTraceRequests::StopPrefetching>(&data))
+        {
+            StopPrefetching();
+        }
+        else
+        {
+            return false;
+        }
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+        return true;
+    }
+
+    bool ReadTracePrefetcher::CanIssuePrefetch() const
+    {
+        if (m_traceCursor >= m_trace.size() || m_numInFlightPrefetches >= m_maxNumPrefetches || !m_next)
+        {
+            return false;
+        }
+        // Entries that can never fit are skipped, otherwise wait for demand reads to free up space.
+        u64 size = m_trace[m_traceCursor].m_size;
+        return size > m_cacheSize || m_usedCacheSize + size <= m_cacheSize;
+    }
+
+    bool ReadTracePrefetcher::IssuePrefetches()
+    {
+        bool issuedPrefetches = false;
+        while (CanIssuePrefetch())
+        {
+            const ReadTraceEntry& entry = m_trace[m_traceCursor++];
+            if (entry.m_size == 0 || entry.m_size > m_cacheSize)
+            {
+                continue;
+            }
+
+            Prefetch& prefetch = m_prefetches.emplace_back();
+            prefetch.m_path = RequestPath(entry.m_path);
+            prefetch.m_offset = entry.m_offset;
+            prefetch.m_size = entry.m_size;
+            prefetch.m_buffer = reinterpret_cast<u8*>(
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(prefetch.m_size, m_alignment));
+            m_usedCacheSize += prefetch.m_size;
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(
+                nullptr, prefetch.m_buffer, prefetch.m_size, prefetch.m_path, prefetch.m_offset, prefetch.m_size);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AzCore);
+                    CompletePrefetch(request);
+                });
+            prefetch.m_inFlight = readRequest;
+            m_numInFlightPrefetches++;
+
+            m_next->QueueRequest(readRequest);
+            issuedPrefetches = true;
+        }
+        return issuedPrefetches;
+    }
+
+    void ReadTracePrefetcher::CompletePrefetch(FileRequest& request)
+    {
+        auto it = AZStd::find_if(m_prefetches.begin(), m_prefetches.end(),
+            [&request](const Prefetch& prefetch) { return prefetch.m_inFlight == &request; });
+        AZ_Assert(it != m_prefetches.end(), "Read trace prefetcher was asked to complete a prefetch it never queued.");
+        AZ_Assert(m_numInFlightPrefetches > 0, "Completing a prefetch, but there shouldn't be any in flight according to records.");
+        m_numInFlightPrefetches--;
+
+        Prefetch& prefetch = *it;
+        prefetch.m_inFlight = nullptr;
+
+        IStreamerTypes::RequestStatus requestStatus = request.GetStatus();
+        bool requestWasSuccessful = requestStatus == IStreamerTypes::RequestStatus::Completed;
+        for (Waiter& waiter : prefetch.m_waiters)
+        {
+            if (requestWasSuccessful)
+            {
+                memcpy(waiter.m_output, prefetch.m_buffer + waiter.m_offset, waiter.m_size);
+            }
+            waiter.m_wait->SetStatus(requestStatus);
+            m_context->MarkRequestAsCompleted(waiter.m_wait);
+        }
+
+        if (!requestWasSuccessful || prefetch.m_discard || !prefetch.m_waiters.empty())
+        {
+            if (requestWasSuccessful && prefetch.m_waiters.empty())
+            {
+                m_numWastedPrefetches++;
+            }
+            ReleasePrefetch(AZStd::distance(m_prefetches.begin(), it));
+        }
+    }
+
+    void ReadTracePrefetcher::ReleasePrefetch(size_t index)
+    {
+        Prefetch& prefetch = m_prefetches[index];
+        AZ_Assert(!prefetch.m_inFlight, "Releasing a prefetch that's still being read.");
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(prefetch.m_buffer, prefetch.m_size, m_alignment);
+        AZ_Assert(m_usedCacheSize >= prefetch.m_size, "Releasing more prefetched data than was allocated.");
+        m_usedCacheSize -= prefetch.m_size;
+        m_prefetches.erase(m_prefetches.begin() + index);
+    }
+
+    void ReadTracePrefetcher::ReleaseCompletedPrefetches(size_t end)
+    {
+        for (size_t i = end; i > 0; --i)
+        {
+            if (!m_prefetches[i - 1].m_inFlight)
+            {
+                m_numWastedPrefetches++;
+                ReleasePrefetch(i - 1);
+            }
+            else
+            {
+                m_prefetches[i - 1].m_discard = true;
+            }
+        }
+    }
+
+    void ReadTracePrefetcher::StopPrefetching()
+    {
+        ReleaseCompletedPrefetches(m_prefetches.size());
+        m_trace.clear();
+        m_traceCursor = 0;
+    }
+
+    void ReadTracePrefetcher::FlushPrefetches(const RequestPath* filePath)
+    {
+        for (size_t i = m_prefetches.size(); i > 0; --i)
+        {
+            Prefetch& prefetch = m_prefetches[i - 1];
+            if (filePath && prefetch.m_path != *filePath)
+            {
+                continue;
+            }
+
+            if (prefetch.m_inFlight)
+            {
+                // Demand reads that are already waiting still get the data, but it won't be used for further reads.
+                prefetch.m_discard = true;
+            }
+            else
+            {
+                ReleasePrefetch(i - 1);
+            }
+        }
+    }
+
+    void ReadTracePrefetcher::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Cache size", m_cacheSize,
+                "The maximum amount of memory used to hold prefetched data until it's read. Increasing the size allows prefetching "
+                "further ahead of the demand reads."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max prefetches", m_maxNumPrefetches,
+                "The maximum number of prefetches that are queued on the next node at the same time. Higher values keep the storage "
+                "device busier, but can delay demand reads that weren't recorded in the trace."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Recording", m_isRecording, "Whether or not the reads are being recorded."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Trace length", aznumeric_cast<s64>(m_trace.size()),
+                "The number of reads in the trace that's being prefetched."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace AZ::IO
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/any.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+    namespace Requests
+    {
+        struct ReadData;
+        struct ReportData;
+    } // namespace Requests
+
+    //! A single read from a recorded read trace.
+    struct ReadTraceEntry
+    {
+        AZ::IO::Path m_path;
+        u64 m_offset{ 0 };
+        u64 m_size{ 0 };
+    };
+    //! The reads in the order they were received during a recording, for instance while a level was loading.
+    using ReadTrace = AZStd::vector<ReadTraceEntry>;
+
+    //! Writes the trace as text with one read per line.
+    bool SaveReadTrace(GenericStream& stream, const ReadTrace& trace);
+    //! Reads a trace written by SaveReadTrace. Returns false if the stream doesn't contain a valid trace.
+    bool LoadReadTrace(GenericStream& stream, ReadTrace& trace);
+
+    //! Commands for the read trace prefetcher. These are sent to AZ::IO::Streamer with IStreamer::Custom.
+    namespace ReadTraceRequests
+    {
+        //! Starts recording every read that reaches the prefetcher. Any previous recording is discarded.
+        struct StartRecording
+        {
+            AZ_TYPE_INFO(AZ::IO::ReadTraceRequests::StartRecording, "{0B6A3D52-91C4-4E8F-A6B1-3C8D27F5E914}");
+        };
+
+        //! Stops recording and moves the recorded reads into the output, which needs to stay alive until the request completes.
+        struct StopRecording
+        {
+            AZ_TYPE_INFO(AZ::IO::ReadTraceRequests::StopRecording, "{7E2F1C90-5D3B-4A76-8E4C-D19B60A2F3C7}");
+            ReadTrace* m_output{ nullptr };
+        };
+
+        //! Starts prefetching the reads in the trace in order. Reads that match a prefetch are served from the prefetched data.
+        //! Any previous trace that's being prefetched is replaced.
+        struct StartPrefetching
+        {
+            AZ_TYPE_INFO(AZ::IO::ReadTraceRequests::StartPrefetching, "{C4593E1A-0F7D-4B2C-9A68-5E2D8B17C6F0}");
+            ReadTrace m_trace;
+        };
+
+        //! Stops prefetching and releases the data that was prefetched but not used.
+        struct StopPrefetching
+        {
+            AZ_TYPE_INFO(AZ::IO::ReadTraceRequests::StopPrefetching, "{59D1B8E3-2A4F-4C07-B3E6-8F0A7C9D2E15}");
+        };
+    } // namespace ReadTraceRequests
+
+    struct ReadTracePrefetcherConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::ReadTracePrefetcherConfig, "{E3A8C6F1-74B2-4D95-8C0E-2B6F19D4A7C3}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(ReadTracePrefetcherConfig, AZ::SystemAllocator);
+
+        ~ReadTracePrefetcherConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The maximum amount of memory in megabytes used to hold prefetched data until it's read.
+        u32 m_cacheSizeMib{ 16 };
+        //! The maximum number of prefetches that are queued on the next node at the same time.
+        u32 m_maxNumPrefetches{ 4 };
+    };
+
+    //! Records the reads that pass through this node and prefetches them in the recorded order when the same sequence is
+    //! played back, for instance during the next time the same level is loaded. This warms up the data before it's requested,
+    //! so that the demand reads can be served from memory instead of waiting for the storage device.
+    //! This node should be placed above the caches and the drive so it only sees the reads to the files themselves.
+    class ReadTracePrefetcher
+        : public StreamStackEntry
+    {
+    public:
+        ReadTracePrefetcher(u64 cacheSize, u32 maxNumPrefetches, u32 alignment);
+        ReadTracePrefetcher(ReadTracePrefetcher&& rhs) = delete;
+        ReadTracePrefetcher(const ReadTracePrefetcher& rhs) = delete;
+        ~ReadTracePrefetcher() override;
+
+        ReadTracePrefetcher& operator=(ReadTracePrefetcher&& rhs) = delete;
+        ReadTracePrefetcher& operator=(const ReadTracePrefetcher& rhs) = delete;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        double CalculateHitRatePercentage() const;
+
+    private:
+        struct Waiter
+        {
+            FileRequest* m_wait; //!< The wait request that holds back the demand read until the prefetch has completed.
+            u8* m_output; //!< The buffer of the demand read.
+            u64 m_offset; //!< Offset into the prefetched data to start copying from.
+            u64 m_size; //!< Number of bytes to copy.
+        };
+
+        struct Prefetch
+        {
+            RequestPath m_path;
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            u8* m_buffer{ nullptr };
+            //! If set, the read that's filling the buffer. If null, the data has been read.
+            FileRequest* m_inFlight{ nullptr };
+            //! Demand reads that arrived while the prefetch was still in flight.
+            AZStd::vector<Waiter> m_waiters;
+            //! If set, the data is no longer needed and is released as soon as the read completes.
+            bool m_discard{ false };
+        };
+
+        void ReadFile(FileRequest* request, Requests::ReadData& data);
+        bool HandleCustomRequest(FileRequest* request, AZStd::any& data);
+        bool CanIssuePrefetch() const;
+        bool IssuePrefetches();
+        void CompletePrefetch(FileRequest& request);
+        void ReleasePrefetch(size_t index);
+        void ReleaseCompletedPrefetches(size_t end);
+        void StopPrefetching();
+        void FlushPrefetches(const RequestPath* filePath);
+
+        void Report(const Requests::ReportData& data) const;
+
+        //! Prefetches in the order of the trace.
+        AZStd::deque<Prefetch> m_prefetches;
+        ReadTrace m_recording;
+        ReadTrace m_trace;
+        //! The next entry in the trace to prefetch.
+        size_t m_traceCursor{ 0 };
+
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+        u64 m_numWastedPrefetches{ 0 };
+
+        u64 m_cacheSize;
+        u64 m_usedCacheSize{ 0 };
+        u32 m_maxNumPrefetches;
+        u32 m_numInFlightPrefetches{ 0 };
+        u32 m_alignment;
+        bool m_isRecording{ false };
+    };
+} // namespace AZ::IO
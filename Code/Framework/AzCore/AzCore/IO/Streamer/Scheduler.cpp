@@ -11,7 +11,9 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::IO
@@ -176,6 +178,13 @@ namespace AZ::IO
             "The number of read requests that were queued and needed immediate processing. These requests are immediately set to be "
             "processed and don't get scheduled. If this value is high there may be too many requests that are set to 'now' or have "
             "deadlines that too tight. Reducing these cases will help allow Streamer to schedule better and improves performance."));
+        for (const BandwidthClass& bandwidthClass : m_threadData.m_bandwidthClasses)
+        {
+            statistics.push_back(Statistic::CreatePercentage(
+                SchedulerName, bandwidthClass.m_missedDeadlinesName, bandwidthClass.m_missedDeadlinePercentageStat.GetAverage(),
+                "The percentage of read requests in the bandwidth class that completed after their deadline. If this is high for "
+                "one class, but not for the others, increasing the weight of the class will give it a larger share of the bandwidth."));
+        }
 #endif
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
@@ -186,6 +195,43 @@ namespace AZ::IO
         recommendations = m_recommendations;
     }
 
+    void Scheduler::SetBandwidthClasses(const AZStd::map<AZStd::string, BandwidthClassConfig>& classes)
+    {
+        AZ_Assert(!m_isRunning, "Bandwidth classes can only be set before the scheduler is started.");
+
+        AZStd::vector<BandwidthClass>& bandwidthClasses = m_threadData.m_bandwidthClasses;
+        bandwidthClasses.clear();
+        if (classes.empty())
+        {
+            return;
+        }
+
+        AZ_Warning("Streamer", classes.size() < MaxBandwidthClasses,
+            "Only %zu out of %zu bandwidth classes are used as up to %zu are supported.",
+            MaxBandwidthClasses - 1, classes.size(), MaxBandwidthClasses - 1);
+        for (auto&& [name, config] : classes)
+        {
+            if (bandwidthClasses.size() == MaxBandwidthClasses - 1)
+            {
+                break;
+            }
+
+            BandwidthClass& bandwidthClass = bandwidthClasses.emplace_back();
+            bandwidthClass.m_name = name;
+            bandwidthClass.m_weight = aznumeric_cast<double>(AZStd::max(config.m_weight, 1u));
+            for (const AZStd::string& extension : config.m_extensions)
+            {
+                bandwidthClass.m_extensions.push_back(extension.starts_with('.') ? extension : AZStd::string::format(".%s", extension.c_str()));
+            }
+        }
+        bandwidthClasses.emplace_back().m_name = "Other";
+
+        for (BandwidthClass& bandwidthClass : bandwidthClasses)
+        {
+            bandwidthClass.m_missedDeadlinesName = AZStd::string::format("Missed deadlines (%s)", bandwidthClass.m_name.c_str());
+        }
+    }
+
     void Scheduler::Thread_MainLoop()
     {
         m_threadData.m_streamStack->SetContext(m_context);
@@ -261,6 +307,67 @@ namespace AZ::IO
         Thread_ProcessTillIdle();
     }
 
+    FileRequest* Scheduler::Thread_PopNextRequest()
+    {
+        AZStd::vector<BandwidthClass>& bandwidthClasses = m_threadData.m_bandwidthClasses;
+        auto& pendingQueue = m_context.GetPreparedRequests();
+        // Requests that don't read, such as cancels, are sorted in front of the reads and always go first.
+        if (bandwidthClasses.empty() || !pendingQueue.front()->GetCommandFromChain<Requests::ReadRequestData>())
+        {
+            return m_context.PopPreparedRequest();
+        }
+
+        // Pick the first request of the class that has received the smallest share of the bandwidth. Within a class the order
+        // from the last scheduling pass is kept, so deadlines and priorities still decide which request of the class goes next.
+        auto selected = pendingQueue.end();
+        double selectedVirtualTime = AZStd::numeric_limits<double>::max();
+        u32 foundClasses = 0;
+        size_t numFoundClasses = 0;
+        for (auto it = pendingQueue.begin(); it != pendingQueue.end() && numFoundClasses < bandwidthClasses.size(); ++it)
+        {
+            const Requests::ReadRequestData* readRequest = (*it)->GetCommandFromChain<Requests::ReadRequestData>();
+            if (readRequest == nullptr || (foundClasses & (1u << readRequest->m_bandwidthClass)) != 0)
+            {
+                continue;
+            }
+            foundClasses |= 1u << readRequest->m_bandwidthClass;
+            numFoundClasses++;
+
+            double virtualTime = AZStd::max(
+                bandwidthClasses[readRequest->m_bandwidthClass].m_virtualTime, m_threadData.m_bandwidthVirtualTime);
+            if (virtualTime < selectedVirtualTime)
+            {
+                selectedVirtualTime = virtualTime;
+                selected = it;
+            }
+        }
+
+        FileRequest* next = *selected;
+        pendingQueue.erase(selected);
+
+        auto readSize = [](auto&& args) -> u64
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                return args.m_size;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                return args.m_compressionInfo.m_compressedSize;
+            }
+            else
+            {
+                return 0;
+            }
+        };
+        BandwidthClass& bandwidthClass = bandwidthClasses[next->GetCommandFromChain<Requests::ReadRequestData>()->m_bandwidthClass];
+        m_threadData.m_bandwidthVirtualTime = selectedVirtualTime;
+        bandwidthClass.m_virtualTime = selectedVirtualTime + aznumeric_cast<double>(AZStd::visit(readSize, next->GetCommand())) /
+            bandwidthClass.m_weight;
+        return next;
+    }
+
     void Scheduler::Thread_QueueNextRequest()
     {
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -268,7 +375,7 @@ namespace AZ::IO
 #endif
         AZ_PROFILE_FUNCTION(AzCore);
 
-        FileRequest* next = m_context.PopPreparedRequest();
+        FileRequest* next = Thread_PopNextRequest();
         next->SetStatus(IStreamerTypes::RequestStatus::Processing);
 
         AZStd::visit([this, next](auto&& args)
@@ -400,7 +507,7 @@ namespace AZ::IO
         AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
         auto visitor = [this, now](auto&& args) -> void
 #else
-        auto visitor = [](auto&& args) -> void
+        auto visitor = [this](auto&& args) -> void
 #endif
         {
             using Command = AZStd::decay_t<decltype(args)>;
@@ -410,6 +517,10 @@ namespace AZ::IO
                 {
                     args.m_allocator->LockAllocator();
                 }
+                if (!m_threadData.m_bandwidthClasses.empty())
+                {
+                    args.m_bandwidthClass = Thread_FindBandwidthClass(args.m_path);
+                }
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 m_immediateReadsPercentageStat.PushSample(args.m_deadline < now ? 1.0 : 0.0);
                 Statistic::PlotImmediate(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetMostRecentSample());
@@ -427,6 +538,24 @@ namespace AZ::IO
             FileRequest* requestPtr = &request->m_request;
             FileRequest* linkRequest = m_context.GetNewInternalRequest();
             linkRequest->CreateRequestLink(AZStd::move(request));
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            if (auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&requestPtr->GetCommand());
+                readRequest && !m_threadData.m_bandwidthClasses.empty())
+            {
+                // The link completes after the external request and keeps it alive until its own callback has been called.
+                linkRequest->SetCompletionCallback([this, readRequest](FileRequest& link)
+                    {
+                        if (link.GetStatus() != IStreamerTypes::RequestStatus::Canceled)
+                        {
+                            BandwidthClass& bandwidthClass = m_threadData.m_bandwidthClasses[readRequest->m_bandwidthClass];
+                            bool missedDeadline = AZStd::chrono::steady_clock::now() > readRequest->m_deadline;
+                            bandwidthClass.m_missedDeadlinePercentageStat.PushSample(missedDeadline ? 1.0 : 0.0);
+                            Statistic::PlotImmediate(SchedulerName, bandwidthClass.m_missedDeadlinesName,
+                                bandwidthClass.m_missedDeadlinePercentageStat.GetMostRecentSample());
+                        }
+                    });
+            }
+#endif
             requestPtr->SetStatus(IStreamerTypes::RequestStatus::Queued);
             m_threadData.m_streamStack->PrepareRequest(requestPtr);
         }
@@ -668,4 +797,24 @@ namespace AZ::IO
             AZStd::sort(pendingQueue.begin(), pendingQueue.end(), sorter);
         }
     }
+
+    u32 Scheduler::Thread_FindBandwidthClass(const RequestPath& path) const
+    {
+        const AZStd::vector<BandwidthClass>& bandwidthClasses = m_threadData.m_bandwidthClasses;
+        AZ_Assert(!bandwidthClasses.empty(), "Looking up a bandwidth class while no bandwidth classes have been set.");
+
+        AZStd::string_view extension = path.GetRelativePath().Extension().Native();
+        // The last class is for requests that don't match any other class.
+        for (size_t i = 0; i < bandwidthClasses.size() - 1; ++i)
+        {
+            for (const AZStd::string& classExtension : bandwidthClasses[i].m_extensions)
+            {
+                if (AZ::StringFunc::Equal(extension, classExtension))
+                {
+                    return aznumeric_cast<u32>(i);
+                }
+            }
+        }
+        return aznumeric_cast<u32>(bandwidthClasses.size() - 1);
+    }
 } // namespace AZ::IO
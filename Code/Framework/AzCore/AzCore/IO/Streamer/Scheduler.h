@@ -14,17 +14,20 @@
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 
 namespace AZ::IO
 {
     class FileRequest;
     class Streamer_SchedulerTest_RequestSorting_Test;
+    class Streamer_SchedulerTest_BandwidthClasses_PopNextRequest_ClassesShareBandwidthByWeight_Test;
 
     namespace Requests
     {
@@ -65,11 +68,18 @@ namespace AZ::IO
 
         void GetRecommendations(IStreamerTypes::Recommendations& recommendations) const;
 
+        //! Sets the classes that share the available bandwidth. Requests for files that don't match any of the classes are
+        //! grouped in an additional class with a weight of one. This needs to be called before the scheduler is started.
+        void SetBandwidthClasses(const AZStd::map<AZStd::string, BandwidthClassConfig>& classes);
+
     private:
         friend class Streamer_SchedulerTest_RequestSorting_Test;
+        friend class Streamer_SchedulerTest_BandwidthClasses_PopNextRequest_ClassesShareBandwidthByWeight_Test;
+        inline static constexpr size_t MaxBandwidthClasses = 32;
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
         void Thread_MainLoop();
+        FileRequest* Thread_PopNextRequest();
         void Thread_QueueNextRequest();
         bool Thread_ExecuteRequests();
         bool Thread_PrepareRequests(AZStd::vector<FileRequestPtr>& outstandingRequests);
@@ -86,6 +96,20 @@ namespace AZ::IO
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
+        u32 Thread_FindBandwidthClass(const RequestPath& path) const;
+
+        struct BandwidthClass final
+        {
+            AZStd::string m_name;
+            AZStd::string m_missedDeadlinesName;
+            AZStd::vector<AZStd::string> m_extensions;
+            double m_weight{ 1.0 };
+            //! The number of bytes queued for this class divided by its weight. The class with the lowest value goes next.
+            double m_virtualTime{ 0.0 };
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            AZ::Statistics::RunningStatistic m_missedDeadlinePercentageStat;
+#endif
+        };
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
@@ -95,6 +119,11 @@ namespace AZ::IO
             AZStd::vector<FileRequest*> m_internalPendingRequests;
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
+            //! The classes that share the bandwidth. If not empty, the last entry is for requests that don't match any of the others.
+            AZStd::vector<BandwidthClass> m_bandwidthClasses;
+            //! The virtual time of the class that was last queued. A class that was idle is moved up to this time so it can't
+            //! claim the bandwidth it didn't use while it was idle.
+            double m_bandwidthVirtualTime{ 0.0 };
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
         };
         ThreadData m_threadData;
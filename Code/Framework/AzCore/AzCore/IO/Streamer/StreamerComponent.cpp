@@ -9,12 +9,14 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadTracePrefetcher.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -103,8 +105,10 @@ namespace AZ
         }
         if (stack)
         {
-            return AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
+            auto scheduler = AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(stack), hardwareInfo.m_maxPhysicalSectorSize,
                 hardwareInfo.m_maxLogicalSectorSize, hardwareInfo.m_maxTransfer);
+            scheduler->SetBandwidthClasses(config.m_bandwidthClasses);
+            return scheduler;
         }
         else
         {
@@ -200,6 +204,7 @@ namespace AZ
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
+        ReadTracePrefetcherConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
         ReflectNative(context);
@@ -241,4 +246,60 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::RecordReadTrace(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            m_streamer->QueueRequest(m_streamer->Custom(AZStd::any(AZ::IO::ReadTraceRequests::StartRecording{})));
+        }
+    }
+
+    void StreamerComponent::SaveReadTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (someStrings.empty())
+        {
+            AZ_Error("Streamer", false, "A path to save the read trace to is required.");
+            return;
+        }
+
+        if (m_streamer)
+        {
+            auto trace = new AZ::IO::ReadTrace();
+            AZ::IO::FileRequestPtr request = m_streamer->Custom(AZStd::any(AZ::IO::ReadTraceRequests::StopRecording{ trace }));
+            auto callback = [trace, path = AZ::IO::FixedMaxPathString(someStrings.front())](AZ::IO::FileRequestHandle)
+            {
+                AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, true);
+                if (stream.IsOpen() && AZ::IO::SaveReadTrace(stream, *trace))
+                {
+                    AZ_Printf("Streamer", "Saved read trace with %zu reads to '%s'.\n", trace->size(), path.c_str());
+                }
+                delete trace;
+            };
+            m_streamer->SetRequestCompleteCallback(request, AZStd::move(callback));
+            m_streamer->QueueRequest(request);
+        }
+    }
+
+    void StreamerComponent::PrefetchReadTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (!m_streamer)
+        {
+            return;
+        }
+
+        if (someStrings.empty())
+        {
+            m_streamer->QueueRequest(m_streamer->Custom(AZStd::any(AZ::IO::ReadTraceRequests::StopPrefetching{})));
+            return;
+        }
+
+        AZ::IO::FixedMaxPathString path(someStrings.front());
+        AZ::IO::ReadTraceRequests::StartPrefetching command;
+        AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, true);
+        if (stream.IsOpen() && AZ::IO::LoadReadTrace(stream, command.m_trace))
+        {
+            m_streamer->QueueRequest(m_streamer->Custom(AZStd::any(AZStd::move(command))));
+        }
+    }
 } // namespace AZ
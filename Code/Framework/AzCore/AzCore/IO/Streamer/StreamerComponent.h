@@ -49,11 +49,20 @@ namespace AZ
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void RecordReadTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void SaveReadTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void PrefetchReadTrace(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, RecordReadTrace, AZ::ConsoleFunctorFlags::Null,
+            "Starts recording the reads of AZ::IO::Streamer for the read trace prefetcher");
+        AZ_CONSOLEFUNC(StreamerComponent, SaveReadTrace, AZ::ConsoleFunctorFlags::Null,
+            "Stops recording the reads of AZ::IO::Streamer and saves them to the provided path");
+        AZ_CONSOLEFUNC(StreamerComponent, PrefetchReadTrace, AZ::ConsoleFunctorFlags::Null,
+            "Prefetches the reads in the read trace at the provided path, or stops prefetching if no path is provided");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
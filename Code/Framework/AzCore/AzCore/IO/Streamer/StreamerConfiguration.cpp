@@ -21,13 +21,27 @@ namespace AZ::IO
         }
     }
 
+    void BandwidthClassConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<BandwidthClassConfig>()
+                ->Version(1)
+                ->Field("Extensions", &BandwidthClassConfig::m_extensions)
+                ->Field("Weight", &BandwidthClassConfig::m_weight);
+        }
+    }
+
     void StreamerConfig::Reflect(AZ::ReflectContext* context)
     {
+        BandwidthClassConfig::Reflect(context);
+
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
             serializeContext->Class<StreamerConfig>()
                 ->Version(1)
-                ->Field("Stack", &StreamerConfig::m_stackConfig);
+                ->Field("Stack", &StreamerConfig::m_stackConfig)
+                ->Field("BandwidthClasses", &StreamerConfig::m_bandwidthClasses);
         }
     }
 } // namespace AZ::IO
@@ -55,6 +55,22 @@ namespace AZ::IO
         static void Reflect(ReflectContext* context);
     };
 
+    //! A group of files that shares in the bandwidth of AZ::IO::Streamer, for instance textures or audio banks.
+    //! While requests from multiple classes are waiting, the scheduler alternates between the classes based on their weights
+    //! so a burst of requests in one class can't hold up the requests in the others.
+    struct BandwidthClassConfig final
+    {
+        AZ_TYPE_INFO(AZ::IO::BandwidthClassConfig, "{3F9B6E21-8C4D-4A7E-B5D2-61E0C8A94F37}");
+        AZ_CLASS_ALLOCATOR(BandwidthClassConfig, SystemAllocator);
+
+        static void Reflect(ReflectContext* context);
+
+        //! The extensions of the files that belong to this class, such as ".streamingimage".
+        AZStd::vector<AZStd::string> m_extensions;
+        //! The share of the bandwidth this class gets relative to the other classes with pending requests.
+        u32 m_weight{ 1 };
+    };
+
     class StreamerConfig final
     {
     public:
@@ -62,6 +78,8 @@ namespace AZ::IO
         AZ_CLASS_ALLOCATOR(StreamerConfig, SystemAllocator);
 
         ConfigurableStack<AZ::IO::IStreamerStackConfig> m_stackConfig;
+        //! Optional bandwidth classes by name. If not set, requests are scheduled purely on their deadline and priority.
+        AZStd::map<AZStd::string, BandwidthClassConfig> m_bandwidthClasses;
         static void Reflect(ReflectContext* context);
     };
 
@@ -30,18 +30,47 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
-void WorkQueue::LocalInsert(Job* job)
+WorkQueue::~WorkQueue()
 {
+    delete[] m_ring;
+}
+
+void WorkQueue::InitLockFree(AZ::u32 capacity)
+{
+    AZ_Assert(!m_ring && m_queue.empty(), "WorkQueue must be switched to lock-free before it's used");
+
+    AZ::s64 ringSize = 2;
+    while (ringSize < static_cast<AZ::s64>(capacity))
+    {
+        ringSize <<= 1;
+    }
+    m_ring = new AZStd::atomic<Job*>[ringSize];
+    m_ringMask = ringSize - 1;
+}
+
+bool WorkQueue::LocalInsert(Job* job)
+{
+    if (m_ring)
+    {
+        return LockFreePush(job);
+    }
+
     LockGuard lock(m_lock);
     const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
                                                                                    m_queue.end(),
                                                                                    job->GetPriority(),
                                                                                    CompareJobPriorities);
     m_queue.insert(locationToinsert, job);
+    return true;
 }
 
 Job* WorkQueue::LocalPopFront()
 {
+    if (m_ring)
+    {
+        return LockFreePop();
+    }
+
     LockGuard lock(m_lock);
 
     Job* result = nullptr;
@@ -56,6 +85,11 @@ Job* WorkQueue::LocalPopFront()
 
 Job* WorkQueue::TryStealFront()
 {
+    if (m_ring)
+    {
+        return LockFreeSteal();
+    }
+
     AZStd::exponential_backoff backoff;
     for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
     {
@@ -79,11 +113,74 @@ Job* WorkQueue::TryStealFront()
     return nullptr;
 }
 
+bool WorkQueue::LockFreePush(Job* job)
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+    const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    if (bottom - top > m_ringMask)
+    {
+        return false; // full
+    }
+
+    m_ring[bottom & m_ringMask].store(job, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_release);
+    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    return true;
+}
+
+Job* WorkQueue::LockFreePop()
+{
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, AZStd::memory_order_relaxed);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    AZ::s64 top = m_top.load(AZStd::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // empty, restore bottom
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = m_ring[bottom & m_ringMask].load(AZStd::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // last element, race any thief for it
+        if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* WorkQueue::LockFreeSteal()
+{
+    AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return nullptr;
+    }
+
+    Job* job = m_ring[top & m_ringMask].load(AZStd::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+    {
+        // lost the race against the owner or another thief
+        return nullptr;
+    }
+    return job;
+}
+
 
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
 
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
+    , m_idleSpinCount(desc.m_idleSpinCount)
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc)))
 {
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
@@ -146,12 +243,25 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     else if (info && info->m_isWorker && (info->m_owningManager == this))
     {
         //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
+        if (info->m_pendingJobs.LocalInsert(job))
+        {
 #ifdef JOBMANAGER_ENABLE_STATS
-        ++info->m_jobsForked;
+            ++info->m_jobsForked;
 #endif
-        // if there are threads asleep wake one up
-        ActivateWorker();
+            // if there are threads asleep and nobody is looking for work wake one up
+            ActivateWorkerIfNoneSpinning();
+        }
+        else
+        {
+            //local queue is full, overflow to the global queue
+            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
+                                                                                       m_globalJobQueue.end(),
+                                                                                       job->GetPriority(),
+                                                                                       CompareJobPriorities);
+            m_globalJobQueue.insert(locationToinsert, job);
+            ActivateWorker();
+        }
     }
     else
     {
@@ -350,6 +460,12 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
+                //spin for a while before parking, workers forking jobs won't wake anybody while we do
+                job = SpinForWork(info, victim);
+            }
+
+            if (info->m_isWorker && !suspendedJob && !job)
+            {
                 bool shouldSleep = false;
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
@@ -381,13 +497,15 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 }
             }
 
-            //check if suspended job is ready, before we try to get a new job
+            //check if suspended job is ready, before we try to get a new job (job can only be set on workers with no suspended job)
             if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
                 (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
             {
+                AZ_Assert(!job, "Job acquired while spinning would be dropped");
                 return;
             }
 
+            if (!job)
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
                 if (!m_globalJobQueue.empty())
@@ -438,7 +556,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
-                        ActivateWorker();
+                        ActivateWorkerIfNoneSpinning();
                     }
                 }
                 else
@@ -619,6 +737,62 @@ JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::FindCurrentThreadInf
     return info;
 }
 
+Job* JobManagerWorkStealing::SpinForWork(ThreadInfo* info, unsigned int& victim)
+{
+    if (m_idleSpinCount == 0)
+    {
+        return nullptr;
+    }
+
+    AZ_Assert(info->m_isWorker, "Only workers can spin for work");
+
+    Job* job = nullptr;
+    m_numSpinningWorkers.fetch_add(1, AZStd::memory_order_acq_rel);
+
+    AZStd::exponential_backoff backoff;
+    for (AZ::u32 spin = 0; spin < m_idleSpinCount && !job && !m_quitRequested; ++spin)
+    {
+        //never block on the global queue while spinning, we'll check it properly before going to sleep
+        if (m_globalJobQueueMutex.try_lock())
+        {
+            if (!m_globalJobQueue.empty())
+            {
+                job = m_globalJobQueue.front();
+                m_globalJobQueue.pop_front();
+#ifdef JOBMANAGER_ENABLE_STATS
+                ++info->m_globalJobs;
+#endif
+            }
+            m_globalJobQueueMutex.unlock();
+        }
+
+        if (!job && m_workerThreads.size() > 1)
+        {
+            if (m_workerThreads[victim] == info)
+            {
+                victim = (victim + 1) % m_workerThreads.size();
+            }
+            job = m_workerThreads[victim]->m_pendingJobs.TryStealFront();
+            if (job)
+            {
+#ifdef JOBMANAGER_ENABLE_STATS
+                ++info->m_jobsStolen;
+#endif
+            }
+            else
+            {
+                victim = (victim + 1) % m_workerThreads.size();
+                backoff.wait();
+            }
+        }
+    }
+
+    //must stop counting as spinning before checking the global queue under its lock before sleeping,
+    //otherwise a job queued in between could be left with no worker woken up for it
+    m_numSpinningWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+    return job;
+}
+
 JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(const JobManagerDesc& jmDesc)
 {
     const JobManagerDesc::DescList& workerDescList = jmDesc.m_workerThreads;
@@ -633,6 +807,10 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         info->m_isWorker = true;
         info->m_owningManager = this;
         info->m_workerId = iThread;
+        if (jmDesc.m_workQueueType == JobQueueType::LockFree)
+        {
+            info->m_pendingJobs.InitLockFree(jmDesc.m_lockFreeQueueCapacity);
+        }
 
         AZStd::fixed_string<128> threadName = AZStd::fixed_string<128>::format(
             "%s worker thread %d", 
@@ -686,3 +864,11 @@ inline void JobManagerWorkStealing::ActivateWorker()
     }
 }
 
+inline void JobManagerWorkStealing::ActivateWorkerIfNoneSpinning()
+{
+    // a spinning worker will steal the job, no need to pay for waking up a sleeping one
+    if (m_numSpinningWorkers.load(AZStd::memory_order_acquire) == 0)
+    {
+        ActivateWorker();
+    }
+}
@@ -15,6 +15,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -27,10 +28,24 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue. Only the owning worker inserts and pops, any other worker can steal.
+         * By default this is a priority sorted deque behind a lock, after a call to InitLockFree it becomes a bounded
+         * Chase-Lev work stealing deque (see "Dynamic Circular Work-Stealing Deque", Chase and Lev 2005, and
+         * "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al. 2013 for the memory ordering).
+         */
         class WorkQueue final
         {
         public:
-            void LocalInsert(Job *job);
+            WorkQueue() = default;
+            ~WorkQueue();
+
+            //! Switches the queue to the lock-free implementation, must be called before the queue is used.
+            void InitLockFree(AZ::u32 capacity);
+            bool IsLockFree() const { return m_ring != nullptr; }
+
+            //! Inserts a job, returns false if the queue is full (only possible with the lock-free implementation).
+            bool LocalInsert(Job *job);
             Job* LocalPopFront();
             Job* TryStealFront();
 
@@ -42,17 +57,28 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
+            bool LockFreePush(Job* job);
+            Job* LockFreePop();
+            Job* LockFreeSteal();
+
             AZStd::deque<Job*> m_queue;
             LockType m_lock;
+
+            // lock-free implementation, top is touched by thieves and bottom by the owner so keep them on separate cache lines
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            [[maybe_unused]] char m_topPadding[64 - sizeof(AZStd::atomic<AZ::s64>)];
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<Job*>* m_ring = nullptr;
+            AZ::s64 m_ringMask = 0;
         };
 
         /**
          * Work stealing is in practice a very efficient way for processing fine grained jobs.
          * IMPORTANT: Because we want to put worker threads to sleep we do have extra locks and condition
-         * variable in the code. In addition we are constantly kicking sleeping threads when we add jobs,
-         * this is NOT efficient. Once we have heavier job loads (in practice) try to optimize and remove
-         * those sticky points (if they are a problem). In addition we can think about writing a more advanced
-         * scheduler or use some off the shelf.
+         * variable in the code. By default we are constantly kicking sleeping threads when we add jobs,
+         * which is NOT efficient under heavy loads. Set JobManagerDesc::m_idleSpinCount to have idle workers spin
+         * for a while before parking, forked jobs won't wake sleeping threads while a worker is spinning.
+         * JobManagerDesc::m_workQueueType selects a lock-free local queue which removes the lock from the fork/steal path.
          */
         class JobManagerWorkStealing final
             : public JobManagerBase
@@ -83,6 +109,7 @@ namespace AZ
         private:
 
             void ActivateWorker();
+            void ActivateWorkerIfNoneSpinning();
 
             struct ThreadInfo
             {
@@ -115,6 +142,7 @@ namespace AZ
             void ProcessJobsAssist(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
+            Job* SpinForWork(ThreadInfo* info, unsigned int& victim);
             ThreadList CreateWorkerThreads(const JobManagerDesc& jmDesc);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
@@ -123,6 +151,7 @@ namespace AZ
             ThreadInfo* GetCurrentOrCreateThreadInfo();
 
             bool m_isAsynchronous;
+            const AZ::u32 m_idleSpinCount;
 
             ThreadList m_threads;
             mutable AZStd::mutex m_threadsMutex;
@@ -139,6 +168,7 @@ namespace AZ
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
+            AZStd::atomic_uint          m_numSpinningWorkers{0};
 
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
@@ -44,6 +44,19 @@ namespace AZ
         }
     };
 
+    /**
+     * Implementation used for the per worker thread local job queues.
+     */
+    enum class JobQueueType : AZ::u8
+    {
+        //! Priority sorted deque guarded by a lock, jobs are always popped in priority order.
+        Locked,
+        //! Bounded lock-free Chase-Lev deque. The owning worker pushes and pops without any lock, thieves take the
+        //! oldest job with a single CAS. Job priorities are only honored on the global queue in this mode, local
+        //! jobs are processed most recent first. When the deque is full jobs overflow to the global queue.
+        LockFree,
+    };
+
     /**
      *  Job manager create descriptor.
      */
@@ -55,5 +68,15 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        JobQueueType m_workQueueType = JobQueueType::Locked; ///< Implementation of the worker local queues.
+        AZ::u32 m_lockFreeQueueCapacity = 1024; ///< Number of jobs each lock-free local queue can hold, rounded up to a power of 2.
+
+        /**
+         * Number of times an idle worker polls the global queue and tries to steal before it goes to sleep.
+         * While at least one worker is spinning, workers forking new jobs don't wake sleeping threads, the spinning
+         * worker will pick the job up. 0 disables spinning and workers park as soon as they run out of work.
+         */
+        AZ::u32 m_idleSpinCount = 0;
     };
 }
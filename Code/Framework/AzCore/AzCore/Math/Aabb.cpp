@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Aabb.h>
 
+#include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/MathScriptHelpers.h>
@@ -273,4 +274,40 @@ namespace AZ
         m_min = newMin;
         m_max = newMax;
     }
+
+    void Aabb::TransformAabbs(AZStd::span<const Aabb> aabbs, const Matrix3x4& matrix3x4, AZStd::span<Aabb> outAabbs)
+    {
+        AZ_MATH_ASSERT(outAabbs.size() >= aabbs.size(), "Not enough room for the transformed AABBs");
+
+        // The center is transformed as a point, and the half extents by the absolute value of the 3x3 part of the matrix,
+        // which gives the same box as projecting all the corners.
+        const Simd::Vec3::FloatType col0 = matrix3x4.GetColumn(0).GetSimdValue();
+        const Simd::Vec3::FloatType col1 = matrix3x4.GetColumn(1).GetSimdValue();
+        const Simd::Vec3::FloatType col2 = matrix3x4.GetColumn(2).GetSimdValue();
+        const Simd::Vec3::FloatType col3 = matrix3x4.GetColumn(3).GetSimdValue();
+        const Simd::Vec3::FloatType absCol0 = Simd::Vec3::Abs(col0);
+        const Simd::Vec3::FloatType absCol1 = Simd::Vec3::Abs(col1);
+        const Simd::Vec3::FloatType absCol2 = Simd::Vec3::Abs(col2);
+        const Simd::Vec3::FloatType half = Simd::Vec3::Splat(0.5f);
+
+        for (size_t index = 0; index < aabbs.size(); ++index)
+        {
+            const Simd::Vec3::FloatType min = aabbs[index].m_min.GetSimdValue();
+            const Simd::Vec3::FloatType max = aabbs[index].m_max.GetSimdValue();
+            // Separate multiplies before the addition and subtraction avoid overflowing on boxes that extend to FLT_MAX
+            const Simd::Vec3::FloatType center = Simd::Vec3::Madd(min, half, Simd::Vec3::Mul(max, half));
+            const Simd::Vec3::FloatType halfExtents = Simd::Vec3::Sub(Simd::Vec3::Mul(max, half), Simd::Vec3::Mul(min, half));
+
+            Simd::Vec3::FloatType newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex0(center), col0, col3);
+            newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(center), col1, newCenter);
+            newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(center), col2, newCenter);
+
+            Simd::Vec3::FloatType newHalfExtents = Simd::Vec3::Mul(Simd::Vec3::SplatIndex0(halfExtents), absCol0);
+            newHalfExtents = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(halfExtents), absCol1, newHalfExtents);
+            newHalfExtents = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(halfExtents), absCol2, newHalfExtents);
+
+            outAabbs[index] = Aabb::CreateFromMinMax(
+                Vector3(Simd::Vec3::Sub(newCenter, newHalfExtents)), Vector3(Simd::Vec3::Add(newCenter, newHalfExtents)));
+        }
+    }
 }
@@ -144,6 +144,12 @@ namespace AZ
         //! Returns a new AABB containing the transformed AABB.
         [[nodiscard]] Aabb GetTransformedAabb(const Matrix3x4& matrix3x4) const;
 
+        //! Transforms each AABB of a span, the results match GetTransformedAabb within floating point precision.
+        //! @param aabbs the valid AABBs to transform
+        //! @param matrix3x4 the transform to apply to all the AABBs
+        //! @param outAabbs room for aabbs.size() results, it can be the same memory as aabbs
+        static void TransformAabbs(AZStd::span<const Aabb> aabbs, const Matrix3x4& matrix3x4, AZStd::span<Aabb> outAabbs);
+
         //! Checks if this aabb is equal to another within a floating point tolerance.
         bool IsClose(const Aabb& rhs, float tolerance = Constants::Tolerance) const;
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BoundingVolumeBatch.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AZ
+{
+    namespace
+    {
+        // Frustum planes with each component splat across all lanes
+        struct SplatPlane
+        {
+            Simd::Vec4::FloatType m_normalX;
+            Simd::Vec4::FloatType m_normalY;
+            Simd::Vec4::FloatType m_normalZ;
+            Simd::Vec4::FloatType m_distance;
+        };
+
+        void SplatFrustumPlanes(const Frustum& frustum, SplatPlane (&outPlanes)[Frustum::PlaneId::MAX])
+        {
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane plane = frustum.GetPlane(planeId);
+                outPlanes[planeId].m_normalX = Simd::Vec4::Splat(plane.GetNormal().GetX());
+                outPlanes[planeId].m_normalY = Simd::Vec4::Splat(plane.GetNormal().GetY());
+                outPlanes[planeId].m_normalZ = Simd::Vec4::Splat(plane.GetNormal().GetZ());
+                outPlanes[planeId].m_distance = Simd::Vec4::Splat(plane.GetDistance());
+            }
+        }
+
+        Simd::Vec4::FloatType PlaneDistance(
+            const SplatPlane& plane, Simd::Vec4::FloatArgType x, Simd::Vec4::FloatArgType y, Simd::Vec4::FloatArgType z)
+        {
+            using Simd::Vec4;
+            const Vec4::FloatType dot = Vec4::Madd(plane.m_normalZ, z, Vec4::Madd(plane.m_normalY, y, Vec4::Mul(plane.m_normalX, x)));
+            return Vec4::Add(dot, plane.m_distance);
+        }
+    }
+
+    void BoundingVolumeBatch::Reserve(size_t capacity)
+    {
+        const size_t columnStride = RoundUpToMultiple(capacity, LaneCount);
+        if (columnStride <= m_columnStride)
+        {
+            return;
+        }
+
+        AZStd::vector<float> columns(columnStride * ColumnCount, 0.0f);
+        for (size_t column = 0; column < ColumnCount; ++column)
+        {
+            const float* source = m_columns.data() + column * m_columnStride;
+            AZStd::copy(source, source + m_size, columns.data() + column * columnStride);
+        }
+        m_columns = AZStd::move(columns);
+        m_columnStride = columnStride;
+    }
+
+    void BoundingVolumeBatch::ClassifySpheres(const Frustum& frustum, IntersectResult* outResults) const
+    {
+        using Simd::Vec4;
+
+        SplatPlane planes[Frustum::PlaneId::MAX];
+        SplatFrustumPlanes(frustum, planes);
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const float* centerX = GetColumn(SphereCenterX);
+        const float* centerY = GetColumn(SphereCenterY);
+        const float* centerZ = GetColumn(SphereCenterZ);
+        const float* radii = GetColumn(SphereRadius);
+
+        // Columns are padded to a multiple of LaneCount, so the last group can be loaded in full
+        for (size_t groupStart = 0; groupStart < m_size; groupStart += LaneCount)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(centerX + groupStart);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(centerY + groupStart);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(centerZ + groupStart);
+            const Vec4::FloatType radius = Vec4::LoadUnaligned(radii + groupStart);
+            const Vec4::FloatType negativeRadius = Vec4::Sub(zero, radius);
+
+            Vec4::FloatType exterior = Vec4::CmpLt(zero, zero);
+            Vec4::FloatType intersect = exterior;
+            for (const SplatPlane& plane : planes)
+            {
+                const Vec4::FloatType distance = PlaneDistance(plane, x, y, z);
+                exterior = Vec4::Or(exterior, Vec4::CmpLt(distance, negativeRadius));
+                intersect = Vec4::Or(intersect, Vec4::CmpLt(Vec4::Abs(distance), radius));
+            }
+
+            alignas(16) int32_t exteriorLanes[LaneCount];
+            alignas(16) int32_t intersectLanes[LaneCount];
+            Vec4::StoreAligned(exteriorLanes, Vec4::CastToInt(exterior));
+            Vec4::StoreAligned(intersectLanes, Vec4::CastToInt(intersect));
+
+            const size_t laneCount = AZStd::min(LaneCount, m_size - groupStart);
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                outResults[groupStart + lane] = exteriorLanes[lane] ? IntersectResult::Exterior
+                    : (intersectLanes[lane] ? IntersectResult::Overlaps : IntersectResult::Interior);
+            }
+        }
+    }
+
+    void BoundingVolumeBatch::OverlapsAabbs(const Frustum& frustum, bool* outResults) const
+    {
+        using Simd::Vec4;
+
+        SplatPlane planes[Frustum::PlaneId::MAX];
+        SplatPlane absPlanes[Frustum::PlaneId::MAX];
+        SplatFrustumPlanes(frustum, planes);
+        for (size_t planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+        {
+            absPlanes[planeIndex].m_normalX = Vec4::Abs(planes[planeIndex].m_normalX);
+            absPlanes[planeIndex].m_normalY = Vec4::Abs(planes[planeIndex].m_normalY);
+            absPlanes[planeIndex].m_normalZ = Vec4::Abs(planes[planeIndex].m_normalZ);
+        }
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const float* centerX = GetColumn(AabbCenterX);
+        const float* centerY = GetColumn(AabbCenterY);
+        const float* centerZ = GetColumn(AabbCenterZ);
+        const float* halfExtentX = GetColumn(AabbHalfExtentX);
+        const float* halfExtentY = GetColumn(AabbHalfExtentY);
+        const float* halfExtentZ = GetColumn(AabbHalfExtentZ);
+
+        for (size_t groupStart = 0; groupStart < m_size; groupStart += LaneCount)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(centerX + groupStart);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(centerY + groupStart);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(centerZ + groupStart);
+            const Vec4::FloatType extentX = Vec4::LoadUnaligned(halfExtentX + groupStart);
+            const Vec4::FloatType extentY = Vec4::LoadUnaligned(halfExtentY + groupStart);
+            const Vec4::FloatType extentZ = Vec4::LoadUnaligned(halfExtentZ + groupStart);
+
+            // The projection of the half extents onto the plane normal is the radius of the box along that normal
+            Vec4::FloatType exterior = Vec4::CmpLt(zero, zero);
+            for (size_t planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+            {
+                const SplatPlane& absPlane = absPlanes[planeIndex];
+                const Vec4::FloatType distance = PlaneDistance(planes[planeIndex], x, y, z);
+                const Vec4::FloatType projectedRadius =
+                    Vec4::Madd(absPlane.m_normalZ, extentZ, Vec4::Madd(absPlane.m_normalY, extentY, Vec4::Mul(absPlane.m_normalX, extentX)));
+                exterior = Vec4::Or(exterior, Vec4::CmpLtEq(Vec4::Add(distance, projectedRadius), zero));
+            }
+
+            alignas(16) int32_t exteriorLanes[LaneCount];
+            Vec4::StoreAligned(exteriorLanes, Vec4::CastToInt(exterior));
+
+            const size_t laneCount = AZStd::min(LaneCount, m_size - groupStart);
+            for (size_t lane = 0; lane < laneCount; ++lane)
+            {
+                outResults[groupStart + lane] = (exteriorLanes[lane] == 0);
+            }
+        }
+    }
+} // namespace AZ
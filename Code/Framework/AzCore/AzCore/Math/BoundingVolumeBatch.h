@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! A struct-of-arrays store of bounding spheres and axis-aligned bounding boxes.
+    //! Each component of the bounding volumes is kept in its own contiguous column, so that intersection kernels can test
+    //! several volumes per instruction rather than one volume at a time. Columns are padded to a multiple of LaneCount.
+    class BoundingVolumeBatch final
+    {
+    public:
+        //! The number of bounding volumes tested per instruction by the batch intersection kernels.
+        static constexpr size_t LaneCount = 4;
+
+        BoundingVolumeBatch() = default;
+
+        //! Constructs an empty batch with storage for the provided number of bounding volumes.
+        //! @param capacity the number of bounding volumes to reserve storage for
+        explicit BoundingVolumeBatch(size_t capacity);
+
+        //! Reserves storage for the provided number of bounding volumes, existing bounding volumes are preserved.
+        //! @param capacity the number of bounding volumes to reserve storage for
+        void Reserve(size_t capacity);
+
+        //! Removes all bounding volumes, storage is retained.
+        void Clear();
+
+        //! Appends a bounding volume to the batch.
+        //! @param sphere the bounding sphere of the object
+        //! @param aabb the axis-aligned bounding box of the object
+        //! @return the index of the appended bounding volume
+        size_t PushBack(const Sphere& sphere, const Aabb& aabb);
+
+        //! Returns the number of bounding volumes in the batch.
+        size_t GetSize() const;
+
+        //! Returns the bounding sphere at the provided index.
+        Sphere GetSphere(size_t index) const;
+
+        //! Returns the axis-aligned bounding box at the provided index.
+        Aabb GetAabb(size_t index) const;
+
+        //! Classifies every bounding sphere in the batch against a frustum.
+        //! Results match Frustum::IntersectSphere for each sphere.
+        //! @param frustum the frustum to test against
+        //! @param outResults array with room for GetSize() results
+        void ClassifySpheres(const Frustum& frustum, IntersectResult* outResults) const;
+
+        //! Tests whether every axis-aligned bounding box in the batch overlaps a frustum.
+        //! Results match ShapeIntersection::Overlaps(frustum, aabb) for each box.
+        //! @param frustum the frustum to test against
+        //! @param outResults array with room for GetSize() results
+        void OverlapsAabbs(const Frustum& frustum, bool* outResults) const;
+
+    private:
+        enum Column
+        {
+            SphereCenterX,
+            SphereCenterY,
+            SphereCenterZ,
+            SphereRadius,
+            AabbCenterX,
+            AabbCenterY,
+            AabbCenterZ,
+            AabbHalfExtentX,
+            AabbHalfExtentY,
+            AabbHalfExtentZ,
+            ColumnCount
+        };
+
+        const float* GetColumn(Column column) const;
+        float* GetColumn(Column column);
+
+        AZStd::vector<float> m_columns;
+        size_t m_columnStride = 0;
+        size_t m_size = 0;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/BoundingVolumeBatch.inl>
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE BoundingVolumeBatch::BoundingVolumeBatch(size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
+    AZ_MATH_INLINE void BoundingVolumeBatch::Clear()
+    {
+        m_size = 0;
+    }
+
+    AZ_MATH_INLINE size_t BoundingVolumeBatch::PushBack(const Sphere& sphere, const Aabb& aabb)
+    {
+        if (m_size == m_columnStride)
+        {
+            Reserve(AZStd::max<size_t>(m_columnStride * 2, LaneCount));
+        }
+
+        // Separate multiplies before the subtraction avoid overflowing on boxes that extend to FLT_MAX
+        const Vector3 aabbCenter = aabb.GetCenter();
+        const Vector3 aabbHalfExtents = (0.5f * aabb.GetMax()) - (0.5f * aabb.GetMin());
+
+        const size_t index = m_size++;
+        GetColumn(SphereCenterX)[index] = sphere.GetCenter().GetX();
+        GetColumn(SphereCenterY)[index] = sphere.GetCenter().GetY();
+        GetColumn(SphereCenterZ)[index] = sphere.GetCenter().GetZ();
+        GetColumn(SphereRadius)[index] = sphere.GetRadius();
+        GetColumn(AabbCenterX)[index] = aabbCenter.GetX();
+        GetColumn(AabbCenterY)[index] = aabbCenter.GetY();
+        GetColumn(AabbCenterZ)[index] = aabbCenter.GetZ();
+        GetColumn(AabbHalfExtentX)[index] = aabbHalfExtents.GetX();
+        GetColumn(AabbHalfExtentY)[index] = aabbHalfExtents.GetY();
+        GetColumn(AabbHalfExtentZ)[index] = aabbHalfExtents.GetZ();
+        return index;
+    }
+
+    AZ_MATH_INLINE size_t BoundingVolumeBatch::GetSize() const
+    {
+        return m_size;
+    }
+
+    AZ_MATH_INLINE Sphere BoundingVolumeBatch::GetSphere(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Bounding volume index out of range");
+        return Sphere(
+            Vector3(GetColumn(SphereCenterX)[index], GetColumn(SphereCenterY)[index], GetColumn(SphereCenterZ)[index]),
+            GetColumn(SphereRadius)[index]);
+    }
+
+    AZ_MATH_INLINE Aabb BoundingVolumeBatch::GetAabb(size_t index) const
+    {
+        AZ_MATH_ASSERT(index < m_size, "Bounding volume index out of range");
+        const Vector3 center(GetColumn(AabbCenterX)[index], GetColumn(AabbCenterY)[index], GetColumn(AabbCenterZ)[index]);
+        const Vector3 halfExtents(GetColumn(AabbHalfExtentX)[index], GetColumn(AabbHalfExtentY)[index], GetColumn(AabbHalfExtentZ)[index]);
+        return Aabb::CreateFromMinMax(center - halfExtents, center + halfExtents);
+    }
+
+    AZ_MATH_INLINE const float* BoundingVolumeBatch::GetColumn(Column column) const
+    {
+        return m_columns.data() + column * m_columnStride;
+    }
+
+    AZ_MATH_INLINE float* BoundingVolumeBatch::GetColumn(Column column)
+    {
+        return m_columns.data() + column * m_columnStride;
+    }
+} // namespace AZ
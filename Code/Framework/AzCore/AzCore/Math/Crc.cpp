@@ -14,6 +14,83 @@
 namespace AZ::Internal
 {
     template struct AggregateTypes<Crc32>;
+
+    namespace
+    {
+        //! Tables for computing the crc of 8 bytes at a time (slice by 8).
+        //! Table n holds the crc of each byte value followed by n zero bytes, table 0 is crc_table.
+        struct Crc32SliceTables
+        {
+            AZ::u32 m_tables[8][256];
+        };
+
+        constexpr Crc32SliceTables CreateCrc32SliceTables()
+        {
+            Crc32SliceTables sliceTables{};
+            for (size_t index = 0; index < 256; ++index)
+            {
+                sliceTables.m_tables[0][index] = crc_table[index];
+            }
+            for (size_t table = 1; table < 8; ++table)
+            {
+                for (size_t index = 0; index < 256; ++index)
+                {
+                    const AZ::u32 previous = sliceTables.m_tables[table - 1][index];
+                    sliceTables.m_tables[table][index] = (previous >> 8) ^ crc_table[previous & 0xff];
+                }
+            }
+            return sliceTables;
+        }
+
+        constexpr Crc32SliceTables s_crc32SliceTables = CreateCrc32SliceTables();
+
+        //! Converts the upper case ASCII letters of 8 bytes at once, same as converting 'A' to 'Z' one byte at a time.
+        AZ::u64 ToLowerAscii8(AZ::u64 bytes)
+        {
+            constexpr AZ::u64 Ones = 0x0101010101010101ull;
+            constexpr AZ::u64 HighBits = 0x8080808080808080ull;
+            // None of the additions carry into the next byte once the high bits are cleared
+            const AZ::u64 lowBits = bytes & ~HighBits;
+            const AZ::u64 atLeastA = lowBits + Ones * (0x80 - 'A');
+            const AZ::u64 aboveZ = lowBits + Ones * (0x7F - 'Z');
+            const AZ::u64 isUpper = (atLeastA ^ aboveZ) & ~bytes & HighBits;
+            // The high bit moved down to 0x20, the difference between the upper and the lower case letters
+            return bytes | (isUpper >> 2);
+        }
+    }
+
+    AZ::u32 ComputeCrc32(const void* data, size_t size, bool forceLowerCase)
+    {
+        const auto& tables = s_crc32SliceTables.m_tables;
+        const uint8_t* buf = static_cast<const uint8_t*>(data);
+        AZ::u32 crc = 0xffffffff;
+
+        // The words are read as little endian, like all the platforms supported
+        for (; size >= 8; size -= 8, buf += 8)
+        {
+            AZ::u64 bytes;
+            memcpy(&bytes, buf, sizeof(bytes));
+            if (forceLowerCase)
+            {
+                bytes = ToLowerAscii8(bytes);
+            }
+            const AZ::u32 low = static_cast<AZ::u32>(bytes) ^ crc;
+            const AZ::u32 high = static_cast<AZ::u32>(bytes >> 32);
+            crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^ tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+                tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^ tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+        }
+
+        for (; size > 0; --size, ++buf)
+        {
+            uint8_t byte = *buf;
+            if (forceLowerCase && byte >= 'A' && byte <= 'Z')
+            {
+                byte = static_cast<uint8_t>(byte + 'a' - 'A');
+            }
+            crc = ComputeCrc32Octet(crc, byte);
+        }
+        return crc ^ 0xffffffff;
+    }
 }
 
 namespace AZ
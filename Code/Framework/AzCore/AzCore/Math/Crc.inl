@@ -85,6 +85,9 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Computes the same crc as Crc32Set, 8 bytes at a time. Only usable at runtime.
+        AZ::u32 ComputeCrc32(const void* data, size_t size, bool forceLowerCase);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -93,6 +96,10 @@ namespace AZ
             {
                 value = 0;
             }
+            else if (!az_builtin_is_constant_evaluated())
+            {
+                value = ComputeCrc32(static_cast<const void*>(buf), size, forceLowerCase);
+            }
             else
             {
                 unsigned int crc = 0xffffffffL;
@@ -61,6 +61,8 @@ namespace AZ
         bool Load(void* classPtr, IO::GenericStream& stream, unsigned int /*version*/, bool isDataBigEndian = false) override;
 
         bool CompareValueData(const void* lhs, const void* rhs) override;
+
+        bool IsTriviallyCopyable() const override { return true; }
     };
 
     class FloatArrayTextSerializer
@@ -151,5 +153,11 @@ namespace AZ
 
             return match;
         }
+
+        bool IsTriviallyCopyable() const override
+        {
+            // The math types only hold their floats, so their bytes can be copied as is.
+            return true;
+        }
     };
 }
@@ -546,4 +546,41 @@ namespace AZ
         SetRow(1, txy + twz, 1.0f - (txx + tzz), tyz - twx, m_rows[1].GetW());
         SetRow(2, txz - twy, tyz + twx, 1.0f - (txx + tyy), m_rows[2].GetW());
     }
+
+    void Matrix3x4::TransformPoints(AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints) const
+    {
+        AZ_MATH_ASSERT(outPoints.size() >= points.size(), "Not enough room for the transformed points");
+
+        const Simd::Vec3::FloatType col0 = GetColumn(0).GetSimdValue();
+        const Simd::Vec3::FloatType col1 = GetColumn(1).GetSimdValue();
+        const Simd::Vec3::FloatType col2 = GetColumn(2).GetSimdValue();
+        const Simd::Vec3::FloatType col3 = GetColumn(3).GetSimdValue();
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const Simd::Vec3::FloatType point = points[index].GetSimdValue();
+            Simd::Vec3::FloatType result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex0(point), col0, col3);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(point), col1, result);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(point), col2, result);
+            outPoints[index] = Vector3(result);
+        }
+    }
+
+    void Matrix3x4::TransformVectors(AZStd::span<const Vector3> vectors, AZStd::span<Vector3> outVectors) const
+    {
+        AZ_MATH_ASSERT(outVectors.size() >= vectors.size(), "Not enough room for the transformed vectors");
+
+        const Simd::Vec3::FloatType col0 = GetColumn(0).GetSimdValue();
+        const Simd::Vec3::FloatType col1 = GetColumn(1).GetSimdValue();
+        const Simd::Vec3::FloatType col2 = GetColumn(2).GetSimdValue();
+
+        for (size_t index = 0; index < vectors.size(); ++index)
+        {
+            const Simd::Vec3::FloatType vector = vectors[index].GetSimdValue();
+            Simd::Vec3::FloatType result = Simd::Vec3::Mul(Simd::Vec3::SplatIndex0(vector), col0);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(vector), col1, result);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(vector), col2, result);
+            outVectors[index] = Vector3(result);
+        }
+    }
 } // namespace AZ
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -269,6 +270,18 @@ namespace AZ
         //! Post-multiplies the matrix by a point, using the rotation and translation part of the matrix.
         [[nodiscard]] Vector3 TransformPoint(const Vector3& rhs) const;
 
+        //! Transforms each point of a span, the results match TransformPoint within floating point precision.
+        //! The columns of the matrix are only extracted once, so it's faster than transforming the points one by one.
+        //! @param points the points to transform
+        //! @param outPoints room for points.size() results, it can be the same memory as points
+        void TransformPoints(AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints) const;
+
+        //! Transforms each vector of a span using only the 3x3 part of the matrix, the results match TransformVector
+        //! within floating point precision.
+        //! @param vectors the vectors to transform
+        //! @param outVectors room for vectors.size() results, it can be the same memory as vectors
+        void TransformVectors(AZStd::span<const Vector3> vectors, AZStd::span<Vector3> outVectors) const;
+
         //! Gets the result of transposing the 3x3 part of the matrix, setting the translation part to zero.
         [[nodiscard]] Matrix3x4 GetTranspose() const;
 
@@ -388,6 +388,16 @@ namespace AZ
         return result;
     }
 
+    void Transform::TransformPoints(AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints) const
+    {
+        Matrix3x4::CreateFromTransform(*this).TransformPoints(points, outPoints);
+    }
+
+    void Transform::TransformVectors(AZStd::span<const Vector3> vectors, AZStd::span<Vector3> outVectors) const
+    {
+        Matrix3x4::CreateFromTransform(*this).TransformVectors(vectors, outVectors);
+    }
+
     Transform Transform::CreateLookAt(const Vector3& from, const Vector3& to, Transform::Axis forwardAxis)
     {
         Transform result = CreateIdentity();
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -121,6 +122,17 @@ namespace AZ
         //! Applies rotation and scale, but not translation.
         Vector3 TransformVector(const Vector3& rhs) const;
 
+        //! Transforms each point of a span, the results match TransformPoint within floating point precision.
+        //! The transform is converted to a matrix once, which is much cheaper per point than rotating by the quaternion.
+        //! @param points the points to transform
+        //! @param outPoints room for points.size() results, it can be the same memory as points
+        void TransformPoints(AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints) const;
+
+        //! Applies rotation and scale to each vector of a span, the results match TransformVector within floating point precision.
+        //! @param vectors the vectors to transform
+        //! @param outVectors room for vectors.size() results, it can be the same memory as vectors
+        void TransformVectors(AZStd::span<const Vector3> vectors, AZStd::span<Vector3> outVectors) const;
+
         Transform GetInverse() const;
         void Invert();
 
@@ -224,9 +224,19 @@ namespace AZ
         m_registrationEnabled = false;
     }
 
+    void AllocatorBase::DisableAllocationSampling()
+    {
+        m_isAllocationSamplingEnabled = false;
+    }
+
     void AllocatorBase::ProfileAllocation(
         void* ptr, size_t byteSize, size_t alignment, int suppressStackRecord)
     {
+        if (m_isAllocationSamplingEnabled && ptr && AllocatorManager::IsReady())
+        {
+            AllocatorManager::Instance().SampleAllocation(this, byteSize);
+        }
+
         if (m_isProfilingActive)
         {
             if (m_records)
@@ -256,6 +266,11 @@ namespace AZ
 
     void AllocatorBase::ProfileReallocation(void* ptr, void* newPtr, size_t newSize, size_t newAlignment)
     {
+        if (m_isAllocationSamplingEnabled && newPtr && AllocatorManager::IsReady())
+        {
+            AllocatorManager::Instance().SampleAllocation(this, newSize);
+        }
+
         if (newSize && m_isProfilingActive)
         {
             if (m_records)
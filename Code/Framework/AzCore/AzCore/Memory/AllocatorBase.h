@@ -69,6 +69,10 @@ namespace AZ
         /// Only kernel-level allocators where it would be especially problematic for them to be registered with the AllocatorManager should do this.
         void DisableRegistration();
 
+        /// Call to exclude this allocator from the allocation sampling of the AllocatorManager.
+        /// Allocators that forward their allocations to another allocator should do this, so allocations are only sampled once.
+        void DisableAllocationSampling();
+
         /// Records an allocation for profiling.
         void ProfileAllocation(void* ptr, size_t byteSize, size_t alignment, int suppressStackRecord);
 
@@ -90,5 +94,6 @@ namespace AZ
         bool m_isProfilingActive = false;
         bool m_isReady = false;
         bool m_registrationEnabled = true;
+        bool m_isAllocationSamplingEnabled = true;
     };
 }
@@ -18,11 +18,14 @@
 #include <AzCore/Memory/IAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
 
 #include <AzCore/Platform.h>
 
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Utils/Utils.h>
 
@@ -422,6 +425,58 @@ namespace AZ
         "NOTE: smaller values for the max index can be specified and still print out all the allocations, as long as it larger than the "
         "total number of allocation records\n");
 
+    static void SetAllocationSamplingInterval(const AZ::ConsoleCommandContainer& arguments)
+    {
+        size_t samplingInterval = 0;
+        if (arguments.size() != 1 || !ConsoleTypeHelpers::ToValue(samplingInterval, arguments[0]))
+        {
+            AZ_Error("mem", false, R"("sys_SetAllocationSamplingInterval" requires the number of bytes between samples as its only argument.)");
+            return;
+        }
+        AllocatorManager::Instance().SetAllocationSamplingInterval(samplingInterval);
+    }
+    AZ_CONSOLEFREEFUNC("sys_SetAllocationSamplingInterval", SetAllocationSamplingInterval, AZ::ConsoleFunctorFlags::Null,
+        "Record the callstack of about one allocation every <bytes> bytes allocated, 0 turns allocation sampling off.\n"
+        "Samples are aggregated by callsite, use sys_DumpAllocationCallsites to write them out.\n"
+        "usage: sys_SetAllocationSamplingInterval <bytes>\n"
+        "Ex. `sys_SetAllocationSamplingInterval 524288`");
+
+    static void DumpAllocationCallsites(const AZ::ConsoleCommandContainer& arguments)
+    {
+        // By default write to <dev-write-storage>/allocation_callsites/callsites.<iso8601-timestamp>.<process-id>.json
+        AZ::IO::FixedMaxPath filePath;
+        if (!arguments.empty())
+        {
+            filePath = arguments[0];
+        }
+        else
+        {
+            AZ::Date::Iso8601TimestampString utcTimestampString;
+            AZ::Date::GetFilenameCompatibleFormatNow(utcTimestampString);
+            AZStd::fixed_string<32> processIdString;
+            AZStd::to_string(processIdString, AZ::Platform::GetCurrentProcessId());
+            filePath = AZ::IO::FixedMaxPath{ AZ::Utils::GetDevWriteStoragePath() } / "allocation_callsites" /
+                AZ::IO::FixedMaxPathString::format("callsites.%s.%s.json", utcTimestampString.c_str(), processIdString.c_str());
+        }
+
+        constexpr auto openMode = AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeWrite;
+        auto fileStream = AZStd::make_unique<AZ::IO::SystemFileStream>(filePath.c_str(), openMode);
+        if (!fileStream->IsOpen())
+        {
+            AZ_Error("mem", false, R"("sys_DumpAllocationCallsites" command could not open file path of "%s".)", filePath.c_str());
+            return;
+        }
+
+        Metrics::JsonTraceEventLogger eventLogger(AZStd::move(fileStream));
+        AllocatorManager::Instance().RecordAllocationCallsites(eventLogger);
+        eventLogger.Flush();
+        AZ_Printf("mem", "Allocation callsites written to %s\n", filePath.c_str());
+    }
+    AZ_CONSOLEFREEFUNC("sys_DumpAllocationCallsites", DumpAllocationCallsites, AZ::ConsoleFunctorFlags::Null,
+        "Write the allocation callsites recorded by allocation sampling as trace events to the specified file.\n"
+        "If no file is specified, they are written to <dev-write-storage>/allocation_callsites/callsites.<iso8601-timestamp>.<process-id>.json\n"
+        "usage: sys_DumpAllocationCallsites [<file-path>]");
+
     static EnvironmentVariable<AllocatorManager>& GetAllocatorManagerEnvVar()
     {
         static EnvironmentVariable<AllocatorManager> s_allocManager;
@@ -729,7 +784,7 @@ namespace AZ
 
         memset(m_dumpInfo, 0, sizeof(m_dumpInfo));
 
-        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Parent Allocator\n");
+        AZ_Printf(AZ::Debug::NoWindow, "Index,Name,Used KiB,Reserved KiB,Consumed KiB,Parent Allocator,Cache Hits,Cache Misses\n");
 
         for (int i = 0; i < m_numAllocators; i++)
         {
@@ -753,15 +808,18 @@ namespace AZ
             m_dumpInfo[i].m_used = usedBytes;
             m_dumpInfo[i].m_reserved = reservedBytes;
             m_dumpInfo[i].m_consumed = consumedBytes;
+            const AllocatorCacheStats cacheStats = allocator->GetCacheStats();
             AZ_Printf(
                 AZ::Debug::NoWindow,
-                "%d,%s,%.2f,%.2f,%.2f,%s\n",
+                "%d,%s,%.2f,%.2f,%.2f,%s,%zu,%zu\n",
                 i,
                 name,
                 usedBytes / 1024.0f,
                 reservedBytes / 1024.0f,
                 consumedBytes / 1024.0f,
-                parentName);
+                parentName,
+                cacheStats.m_hits,
+                cacheStats.m_misses);
         }
 
         AZ_Printf(AZ::Debug::NoWindow, "-,Totals,%.2f,%.2f,%.2f,\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
@@ -784,7 +842,8 @@ namespace AZ
 
             if (outStats)
             {
-                outStats->emplace(outStats->end(), allocator->GetName(), allocator->NumAllocatedBytes(), allocator->Capacity());
+                outStats->emplace(
+                    outStats->end(), allocator->GetName(), allocator->NumAllocatedBytes(), allocator->Capacity(), allocator->GetCacheStats());
             }
         }
     }
@@ -907,4 +966,132 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // Allocation sampling
+    //=========================================================================
+    namespace
+    {
+        //! Bytes left to allocate on this thread before the next allocation is sampled
+        AZ_THREAD_LOCAL AZ::s64 s_bytesUntilNextSample = 0;
+        AZ_THREAD_LOCAL AZ::u32 s_samplingRandomState = 0;
+
+        size_t GetNextSampleDistance(size_t samplingInterval)
+        {
+            // Randomize the distance between samples in [interval / 2, interval * 3 / 2) so allocation patterns that repeat
+            // with the same period as the interval don't always sample the same callsite
+            AZ::u32& state = s_samplingRandomState;
+            if (state == 0)
+            {
+                state = static_cast<AZ::u32>(reinterpret_cast<uintptr_t>(&state)) | 1;
+            }
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return samplingInterval / 2 + state % AZStd::max<size_t>(samplingInterval, 1);
+        }
+    }
+
+    void AllocatorManager::SetAllocationSamplingInterval(size_t samplingInterval)
+    {
+        m_allocationSamplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+    }
+
+    void AllocatorManager::SampleAllocationSlow(IAllocator* allocator, size_t byteSize)
+    {
+        const size_t samplingInterval = m_allocationSamplingInterval.load(AZStd::memory_order_relaxed);
+        s_bytesUntilNextSample -= static_cast<AZ::s64>(byteSize);
+        if (s_bytesUntilNextSample > 0 || samplingInterval == 0)
+        {
+            return;
+        }
+        s_bytesUntilNextSample = static_cast<AZ::s64>(GetNextSampleDistance(samplingInterval));
+
+        // Skip this function and AllocatorBase::ProfileAllocation
+        Debug::StackFrame stackFrames[MaxSampledStackFrames];
+        const unsigned int numStackFrames = Debug::StackRecorder::Record(stackFrames, MaxSampledStackFrames, 2);
+
+        size_t callsiteHash = 0;
+        AZStd::hash_combine(callsiteHash, allocator);
+        for (unsigned int i = 0; i < numStackFrames; ++i)
+        {
+            AZStd::hash_combine(callsiteHash, stackFrames[i].m_programCounter);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_allocationCallsitesMutex);
+        auto [callsiteIt, inserted] = m_allocationCallsites.try_emplace(callsiteHash);
+        AllocationCallsite& callsite = callsiteIt->second;
+        if (inserted)
+        {
+            callsite.m_allocatorName = allocator->GetName();
+            AZStd::copy(stackFrames, stackFrames + numStackFrames, callsite.m_stackFrames);
+            callsite.m_numStackFrames = numStackFrames;
+        }
+        ++callsite.m_sampleCount;
+        callsite.m_estimatedBytes += AZStd::max(byteSize, samplingInterval);
+    }
+
+    void AllocatorManager::GetAllocationCallsites(AZStd::vector<AllocationCallsite>& outCallsites) const
+    {
+        // Copy the callsites out with the stateless allocator first, so the lock isn't held while allocating from a sampled allocator
+        AZStd::vector<AllocationCallsite, AZStd::stateless_allocator> callsites;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_allocationCallsitesMutex);
+            callsites.reserve(m_allocationCallsites.size());
+            for (const auto& [callsiteHash, callsite] : m_allocationCallsites)
+            {
+                callsites.push_back(callsite);
+            }
+        }
+
+        AZStd::sort(callsites.begin(), callsites.end(),
+            [](const AllocationCallsite& lhs, const AllocationCallsite& rhs)
+            {
+                return lhs.m_estimatedBytes > rhs.m_estimatedBytes;
+            });
+        outCallsites.assign(callsites.begin(), callsites.end());
+    }
+
+    void AllocatorManager::ResetAllocationSamples()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_allocationCallsitesMutex);
+        m_allocationCallsites.clear();
+    }
+
+    void AllocatorManager::RecordAllocationCallsites(Metrics::IEventLogger& eventLogger, size_t maxCallsites) const
+    {
+        AZStd::vector<AllocationCallsite> callsites;
+        GetAllocationCallsites(callsites);
+        if (callsites.size() > maxCallsites)
+        {
+            callsites.resize(maxCallsites);
+        }
+
+        const size_t samplingInterval = GetAllocationSamplingInterval();
+        for (const AllocationCallsite& callsite : callsites)
+        {
+            Debug::SymbolStorage::StackLine decodedStackLines[MaxSampledStackFrames];
+            Debug::SymbolStorage::DecodeFrames(callsite.m_stackFrames, callsite.m_numStackFrames, decodedStackLines);
+
+            Metrics::EventArrayStorage stackStorage;
+            for (unsigned int i = 0; i < callsite.m_numStackFrames; ++i)
+            {
+                stackStorage.emplace_back(AZStd::string_view(decodedStackLines[i]));
+            }
+
+            Metrics::EventObjectStorage argsStorage;
+            argsStorage.emplace_back("allocator", AZStd::string_view(callsite.m_allocatorName));
+            argsStorage.emplace_back("sampleCount", static_cast<AZ::u64>(callsite.m_sampleCount));
+            argsStorage.emplace_back("estimatedBytes", static_cast<AZ::u64>(callsite.m_estimatedBytes));
+            argsStorage.emplace_back("samplingInterval", static_cast<AZ::u64>(samplingInterval));
+            argsStorage.emplace_back("callstack", Metrics::EventArray(stackStorage));
+
+            Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "AllocationCallsite";
+            instantArgs.m_cat = "Memory";
+            instantArgs.m_args = argsStorage;
+            instantArgs.m_scope = Metrics::InstantEventScope::Process;
+            eventLogger.RecordInstantEvent(instantArgs);
+        }
+    }
+
 } // namespace AZ
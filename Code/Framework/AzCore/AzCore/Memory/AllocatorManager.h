@@ -8,8 +8,11 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
 
@@ -22,6 +25,11 @@ namespace AZ
 {
     class IAllocator;
 
+    namespace Metrics
+    {
+        class IEventLogger;
+    }
+
     /**
     * Global allocation manager. It has access to all
     * created allocators IAllocator interface. And control
@@ -107,19 +115,62 @@ namespace AZ
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, size_t allocatedBytes, size_t capacityBytes)
+            AllocatorStats(const char* name, size_t allocatedBytes, size_t capacityBytes, const AllocatorCacheStats& cacheStats = {})
                 : m_name(name)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_cacheHits(cacheStats.m_hits)
+                , m_cacheMisses(cacheStats.m_misses)
             {}
 
             AZStd::string m_name;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            size_t m_cacheHits;
+            size_t m_cacheMisses;
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
 
+        //////////////////////////////////////////////////////////////////////////
+        // Allocation sampling
+        // Records the callstack of about one allocation for every sampling interval of bytes allocated, and aggregates
+        // the samples by callsite. Unlike the allocation records it only costs a thread local counter on most allocations,
+        // so it can be left running on live processes to find the code responsible for allocation churn.
+        static constexpr unsigned int MaxSampledStackFrames = 16;
+
+        struct AllocationCallsite
+        {
+            AZStd::fixed_string<64> m_allocatorName;
+            Debug::StackFrame m_stackFrames[MaxSampledStackFrames];
+            unsigned int m_numStackFrames = 0;
+            //! Number of allocations sampled at this callsite
+            size_t m_sampleCount = 0;
+            //! Estimate of the bytes allocated at this callsite, each sample stands for at least one sampling interval of bytes
+            size_t m_estimatedBytes = 0;
+        };
+
+        //! Sets the average number of bytes allocated between two samples. 0 turns allocation sampling off.
+        void SetAllocationSamplingInterval(size_t samplingInterval);
+        size_t GetAllocationSamplingInterval() const { return m_allocationSamplingInterval.load(AZStd::memory_order_relaxed); }
+
+        //! Returns the sampled callsites, sorted from the largest estimated number of bytes
+        void GetAllocationCallsites(AZStd::vector<AllocationCallsite>& outCallsites) const;
+        //! Discards all samples recorded so far
+        void ResetAllocationSamples();
+        //! Records the sampled callsites as instant events with the allocator, count, bytes and decoded callstack as arguments
+        void RecordAllocationCallsites(Metrics::IEventLogger& eventLogger, size_t maxCallsites = 256) const;
+
+        // Called from AllocatorBase for every allocation
+        AZ_FORCE_INLINE void SampleAllocation(IAllocator* allocator, size_t byteSize)
+        {
+            if (m_allocationSamplingInterval.load(AZStd::memory_order_relaxed) != 0)
+            {
+                SampleAllocationSlow(allocator, byteSize);
+            }
+        }
+        //////////////////////////////////////////////////////////////////////////
+
         //////////////////////////////////////////////////////////////////////////
         // Debug support
         static const int MaxNumMemoryBreaks = 5;
@@ -148,6 +199,7 @@ namespace AZ
     private:
         void InternalDestroy();
         void DebugBreak(void* address, const Debug::AllocationInfo& info);
+        void SampleAllocationSlow(IAllocator* allocator, size_t byteSize);
 
         AllocatorManager(const AllocatorManager&);
         AllocatorManager& operator=(const AllocatorManager&);
@@ -177,6 +229,14 @@ namespace AZ
         };
         AZStd::fixed_vector<AllocatorTrackingConfig, m_maxNumAllocators> m_allocatorTrackingConfigs;
 
+        AZStd::atomic<size_t> m_allocationSamplingInterval{ 0 };
+        //! Sampled callsites keyed by the hash of their allocator and callstack.
+        //! The map uses the stateless allocator so that recording a sample never allocates from a sampled allocator.
+        using AllocationCallsiteMap = AZStd::unordered_map<size_t, AllocationCallsite, AZStd::hash<size_t>, AZStd::equal_to<size_t>,
+            AZStd::stateless_allocator>;
+        AllocationCallsiteMap m_allocationCallsites;
+        mutable AZStd::mutex m_allocationCallsitesMutex;
+
         static AllocatorManager g_allocMgr;    ///< The single instance of the allocator manager
 
     private:
@@ -48,7 +48,19 @@ namespace AZ
     {
     public:
         AZ_RTTI(ChildAllocatorSchemaBase, "{AF5C2C64-EED4-4BF7-BBD9-3328A81BBC00}", AllocatorBase);
-        using AllocatorBase::AllocatorBase;
+
+        // The parent allocator samples the allocations made through the child allocator
+        ChildAllocatorSchemaBase()
+        {
+            DisableAllocationSampling();
+        }
+
+        explicit ChildAllocatorSchemaBase(bool enableProfiling)
+            : AllocatorBase(enableProfiling)
+        {
+            DisableAllocationSampling();
+        }
+
         virtual IAllocator* GetParentAllocator() const = 0;
     };
 
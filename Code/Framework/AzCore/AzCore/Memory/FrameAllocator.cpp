@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace
+    {
+        // Every allocation is preceded by its size, which is needed by get_allocated_size and reallocate
+        constexpr size_t AllocationHeaderSize = sizeof(size_t);
+
+        AZStd::atomic<AZ::u64> s_nextInstanceId{ 1 };
+    }
+
+    struct FrameAllocator::Block
+    {
+        Block* m_next = nullptr;
+        //! Size of the data following the block header
+        size_t m_size = 0;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    struct FrameAllocator::FrameBuffer
+    {
+        //! Blocks allocated from this frame, the first one is the block being allocated from
+        Block* m_usedBlocks = nullptr;
+        //! Blocks of BlockSize kept from previous frames
+        Block* m_freeBlocks = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        //! The last allocation made from this buffer and the cursor before it, used to give it back on deallocate
+        char* m_lastAllocation = nullptr;
+        char* m_lastCursor = nullptr;
+        AZ::u64 m_frameIndex = 0;
+        AZ::u64 m_garbageCollectIndex = 0;
+    };
+
+    struct FrameAllocator::ThreadArena
+    {
+        FrameBuffer m_buffers[FrameCount];
+        AZStd::thread_id m_threadId;
+    };
+
+    namespace
+    {
+        struct ThreadArenaCache
+        {
+            AZ::u64 m_instanceId = 0;
+            void* m_arena = nullptr;
+        };
+
+        AZ_THREAD_LOCAL ThreadArenaCache s_threadArenaCache;
+    }
+
+    FrameAllocator::FrameAllocator()
+        : m_instanceId(s_nextInstanceId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+        PostCreate();
+    }
+
+    FrameAllocator::~FrameAllocator()
+    {
+        PreDestroy();
+
+        // Like the thread pool allocator, this relies on all the other threads having stopped using the allocator
+        for (ThreadArena* arena : m_arenas)
+        {
+            for (FrameBuffer& buffer : arena->m_buffers)
+            {
+                for (Block* blockList : { buffer.m_usedBlocks, buffer.m_freeBlocks })
+                {
+                    while (blockList)
+                    {
+                        Block* next = blockList->m_next;
+                        FreeBlock(blockList);
+                        blockList = next;
+                    }
+                }
+            }
+            arena->~ThreadArena();
+            AZ_OS_FREE(arena);
+        }
+        m_arenas.clear();
+    }
+
+    void FrameAllocator::AdvanceFrame()
+    {
+        m_frameIndex.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    AZ::u64 FrameAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_relaxed);
+    }
+
+    AllocateAddress FrameAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        FrameBuffer& buffer = GetFrameBuffer();
+
+        alignment = AZStd::max<size_type>(alignment, alignof(size_t));
+        char* address = buffer.m_cursor ? PointerAlignUp(buffer.m_cursor + AllocationHeaderSize, alignment) : nullptr;
+        if (!address || address + byteSize > buffer.m_end)
+        {
+            const size_t requiredSize = AllocationHeaderSize + alignment + byteSize;
+            Block* block = nullptr;
+            if (requiredSize <= BlockSize && buffer.m_freeBlocks)
+            {
+                block = buffer.m_freeBlocks;
+                buffer.m_freeBlocks = block->m_next;
+            }
+            else
+            {
+                block = AllocateBlock(AZStd::max(requiredSize, BlockSize));
+                if (!block)
+                {
+                    OnOutOfMemory(byteSize, alignment);
+                    return AllocateAddress{};
+                }
+            }
+
+            block->m_next = buffer.m_usedBlocks;
+            buffer.m_usedBlocks = block;
+            buffer.m_cursor = block->GetData();
+            buffer.m_end = block->GetData() + block->m_size;
+            address = PointerAlignUp(buffer.m_cursor + AllocationHeaderSize, alignment);
+        }
+
+        reinterpret_cast<size_t*>(address)[-1] = byteSize;
+        buffer.m_lastCursor = buffer.m_cursor;
+        buffer.m_lastAllocation = address;
+        buffer.m_cursor = address + byteSize;
+        return AllocateAddress{ address, byteSize };
+    }
+
+    auto FrameAllocator::deallocate(pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment) -> size_type
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        // Only memory on top of the calling thread's current buffer can be reused before the buffer is reset
+        const size_type allocatedSize = get_allocated_size(ptr);
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        FrameBuffer& buffer = GetThreadArena()->m_buffers[frameIndex % FrameCount];
+        if (buffer.m_frameIndex == frameIndex && buffer.m_lastAllocation == ptr)
+        {
+            buffer.m_cursor = buffer.m_lastCursor;
+            buffer.m_lastAllocation = nullptr;
+        }
+        return allocatedSize;
+    }
+
+    AllocateAddress FrameAllocator::reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+
+        // Grow or shrink the last allocation in place when it is still on top of the buffer
+        const size_type oldSize = get_allocated_size(ptr);
+        FrameBuffer& buffer = GetFrameBuffer();
+        char* address = static_cast<char*>(ptr);
+        if (buffer.m_lastAllocation == address && PointerAlignUp(address, AZStd::max<align_type>(newAlignment, 1)) == address && address + newSize <= buffer.m_end)
+        {
+            reinterpret_cast<size_t*>(address)[-1] = newSize;
+            buffer.m_cursor = address + newSize;
+            return AllocateAddress{ address, newSize };
+        }
+
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress.GetAddress())
+        {
+            memcpy(newAddress.GetAddress(), ptr, AZStd::min(oldSize, newSize));
+        }
+        return newAddress;
+    }
+
+    auto FrameAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        return ptr ? reinterpret_cast<const size_t*>(ptr)[-1] : 0;
+    }
+
+    void FrameAllocator::GarbageCollect()
+    {
+        // Arenas are only ever touched by their own thread, so each thread trims its buffers when it next resets them
+        m_garbageCollectIndex.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    FrameAllocator::size_type FrameAllocator::NumAllocatedBytes() const
+    {
+        return m_numAllocatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameAllocator::ThreadArena* FrameAllocator::GetThreadArena()
+    {
+        ThreadArenaCache& cache = s_threadArenaCache;
+        if (cache.m_instanceId == m_instanceId)
+        {
+            return static_cast<ThreadArena*>(cache.m_arena);
+        }
+
+        // First allocation of this thread, or the thread last used another frame allocator instance
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        ThreadArena* threadArena = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            for (ThreadArena* arena : m_arenas)
+            {
+                if (arena->m_threadId == threadId)
+                {
+                    threadArena = arena;
+                    break;
+                }
+            }
+
+            if (!threadArena)
+            {
+                threadArena = new (AZ_OS_MALLOC(sizeof(ThreadArena), alignof(ThreadArena))) ThreadArena();
+                threadArena->m_threadId = threadId;
+                for (FrameBuffer& buffer : threadArena->m_buffers)
+                {
+                    // Make sure every buffer is reset on its first use
+                    buffer.m_frameIndex = AZStd::numeric_limits<AZ::u64>::max();
+                }
+                m_arenas.push_back(threadArena);
+            }
+        }
+
+        cache.m_instanceId = m_instanceId;
+        cache.m_arena = threadArena;
+        return threadArena;
+    }
+
+    FrameAllocator::FrameBuffer& FrameAllocator::GetFrameBuffer()
+    {
+        const AZ::u64 frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        FrameBuffer& buffer = GetThreadArena()->m_buffers[frameIndex % FrameCount];
+        if (buffer.m_frameIndex != frameIndex)
+        {
+            ResetBuffer(buffer, frameIndex);
+        }
+        return buffer;
+    }
+
+    void FrameAllocator::ResetBuffer(FrameBuffer& buffer, AZ::u64 frameIndex)
+    {
+        const AZ::u64 garbageCollectIndex = m_garbageCollectIndex.load(AZStd::memory_order_relaxed);
+        const bool releaseBlocks = buffer.m_garbageCollectIndex != garbageCollectIndex;
+        buffer.m_garbageCollectIndex = garbageCollectIndex;
+
+        // Keep the regular blocks around for the next frames, oversized blocks are only kept for the frame that needed them
+        while (buffer.m_usedBlocks)
+        {
+            Block* block = buffer.m_usedBlocks;
+            buffer.m_usedBlocks = block->m_next;
+            if (block->m_size == BlockSize && !releaseBlocks)
+            {
+                block->m_next = buffer.m_freeBlocks;
+                buffer.m_freeBlocks = block;
+            }
+            else
+            {
+                FreeBlock(block);
+            }
+        }
+
+        if (releaseBlocks)
+        {
+            while (buffer.m_freeBlocks)
+            {
+                Block* block = buffer.m_freeBlocks;
+                buffer.m_freeBlocks = block->m_next;
+                FreeBlock(block);
+            }
+        }
+
+        buffer.m_cursor = nullptr;
+        buffer.m_end = nullptr;
+        buffer.m_lastAllocation = nullptr;
+        buffer.m_lastCursor = nullptr;
+        buffer.m_frameIndex = frameIndex;
+    }
+
+    FrameAllocator::Block* FrameAllocator::AllocateBlock(size_t size)
+    {
+        void* memory = AZ_OS_MALLOC(sizeof(Block) + size, alignof(Block));
+        if (!memory)
+        {
+            return nullptr;
+        }
+
+        m_numAllocatedBytes.fetch_add(sizeof(Block) + size, AZStd::memory_order_relaxed);
+        Block* block = new (memory) Block();
+        block->m_size = size;
+        return block;
+    }
+
+    void FrameAllocator::FreeBlock(Block* block)
+    {
+        m_numAllocatedBytes.fetch_sub(sizeof(Block) + block->m_size, AZStd::memory_order_relaxed);
+        block->~Block();
+        AZ_OS_FREE(block);
+    }
+} // namespace AZ
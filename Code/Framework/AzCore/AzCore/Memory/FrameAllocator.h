@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Linear allocator for transient data that only needs to live for a frame, like work lists and scratch containers.
+     * Every thread allocates from its own arena, so allocating never takes a lock. Deallocate only gives memory back when
+     * it is called for the last allocation of the calling thread, everything else is released when the frame buffer is reset.
+     * Each arena holds FrameCount buffers that are used round robin, one per frame. When a thread allocates for the
+     * first time in a frame, the buffer it used FrameCount frames earlier is reset.
+     * IMPORTANT: memory from the frame allocator is only valid until AdvanceFrame() was called FrameCount - 1 more times,
+     * never keep frame allocated containers in members that outlive that.
+     * The ComponentApplication advances the frame at the start of every tick.
+     */
+    class FrameAllocator final
+        : public AllocatorBase
+    {
+    public:
+        AZ_RTTI(FrameAllocator, "{6E0B8D47-0F0A-4F6C-9D4E-2C18A5B3E7D1}", AllocatorBase)
+
+        //! The number of frame buffers in each thread arena
+        static constexpr size_t FrameCount = 3;
+        //! Size of the blocks arenas allocate memory in, larger allocations get a block of their own
+        static constexpr size_t BlockSize = 256 * 1024;
+
+        FrameAllocator();
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+        ~FrameAllocator() override;
+
+        //! Starts a new frame. Allocations made FrameCount - 1 frames ago become invalid.
+        void AdvanceFrame();
+
+        //! Returns the number of frames advanced since the allocator was created
+        AZ::u64 GetFrameIndex() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        size_type deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        AllocateAddress reallocate(pointer ptr, size_type newSize, align_type newAlignment) override;
+        size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        //! Spare blocks are released by each thread the next time it resets one of its buffers
+        void GarbageCollect() override;
+        //! Returns the size of the blocks held by all thread arenas
+        size_type NumAllocatedBytes() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct Block;
+        struct FrameBuffer;
+        struct ThreadArena;
+
+        ThreadArena* GetThreadArena();
+        //! Returns the buffer of the calling thread for the current frame, resetting it if it was last used for an older frame
+        FrameBuffer& GetFrameBuffer();
+        void ResetBuffer(FrameBuffer& buffer, AZ::u64 frameIndex);
+        Block* AllocateBlock(size_t size);
+        void FreeBlock(Block* block);
+
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+        AZStd::atomic<AZ::u64> m_garbageCollectIndex{ 0 };
+        AZStd::atomic<size_type> m_numAllocatedBytes{ 0 };
+        //! Identifies this instance in the thread local arena cache, in case an allocator is created at the same address
+        const AZ::u64 m_instanceId;
+
+        AZStd::mutex m_arenasMutex;
+        AZStd::vector<ThreadArena*, AZStd::stateless_allocator> m_arenas;
+    };
+
+    using FrameAllocator_for_std_t = AZStdAlloc<FrameAllocator>;
+
+    //! Vector for transient data, allocated from the FrameAllocator
+    template<class T>
+    using FrameVector = AZStd::vector<T, FrameAllocator_for_std_t>;
+} // namespace AZ
@@ -64,8 +64,26 @@ namespace AZ
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+#ifdef MULTITHREADED
+// Enabled per-thread magazines caching the smallest size classes in front of the buckets
+#define USE_THREAD_MAGAZINES
+#endif
+
     //////////////////////////////////////////////////////////////////////////
 
+#if defined(USE_THREAD_MAGAZINES)
+    namespace HphaInternal
+    {
+        // Returns a small index that is unique to the calling thread until the index wraps around
+        static unsigned GetThreadOrdinal()
+        {
+            static AZStd::atomic<unsigned> s_nextThreadOrdinal{ 0 };
+            thread_local const unsigned t_threadOrdinal = s_nextThreadOrdinal++;
+            return t_threadOrdinal;
+        }
+    } // namespace HphaInternal
+#endif
+
     template<bool DebugAllocatorEnable>
     class HphaSchemaBase<DebugAllocatorEnable>::HpAllocator
         : public IAllocator
@@ -337,6 +355,46 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#if defined(USE_THREAD_MAGAZINES)
+        // Magazines cache free blocks of the smallest size classes, so threads can reuse them without locking the bucket.
+        // Threads are spread over a fixed number of magazine slots, so each slot lock is rarely contended.
+        // Blocks move between a magazine and its bucket in batches of half a magazine, under a single bucket lock.
+        // The debug allocator doesn't use magazines, so it keeps tracking the state of every block exactly.
+        static constexpr bool USE_MAGAZINES = !DebugAllocatorEnable;
+        static const size_t MAGAZINE_MAX_ALLOCATION = 256UL;
+        static const unsigned NUM_MAGAZINE_BUCKETS = MAGAZINE_MAX_ALLOCATION / MIN_ALLOCATION;
+        static const unsigned MAGAZINE_CAPACITY = 16;
+        static const unsigned MAGAZINE_BATCH_SIZE = MAGAZINE_CAPACITY / 2;
+        static const unsigned NUM_MAGAZINE_SLOTS = 16;
+
+        struct magazine
+        {
+            unsigned mCount = 0;
+            void* mBlocks[MAGAZINE_CAPACITY];
+        };
+
+        struct alignas(64) magazine_slot
+        {
+            AZStd::mutex mLock;
+            size_t mHits = 0;
+            size_t mMisses = 0;
+            magazine mMagazines[NUM_MAGAZINE_BUCKETS];
+        };
+
+        magazine_slot* mMagazineSlots = nullptr;
+
+        magazine_slot& magazine_get_slot() const
+        {
+            return mMagazineSlots[HphaInternal::GetThreadOrdinal() % NUM_MAGAZINE_SLOTS];
+        }
+        AllocateAddress magazine_alloc(unsigned bi);
+        size_type magazine_free(void* ptr, unsigned bi);
+        // return all blocks cached in magazines to their buckets
+        void magazine_flush();
+        unsigned bucket_alloc_batch(unsigned bi, void** blocks, unsigned count);
+        void bucket_free_batch(unsigned bi, void* const* blocks, unsigned count);
+#endif
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -929,6 +987,10 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#if defined(USE_THREAD_MAGAZINES)
+            // Blocks cached in magazines keep their pages in use
+            magazine_flush();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -946,6 +1008,9 @@ namespace AZ
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
         }
 
+        // return the hit and miss counters of the magazines
+        AllocatorCacheStats get_cache_stats() const;
+
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
         size_t  AllocationSize(void* ptr);
         size_t  GetMaxAllocationSize() const;
@@ -1027,6 +1092,22 @@ namespace AZ
         mTotalAllocatedSizeBuckets = 0;
         mTotalAllocatedSizeTree = 0;
 
+#if defined(USE_THREAD_MAGAZINES)
+        if constexpr (USE_MAGAZINES)
+        {
+            // Magazines are allocated directly from the OS, they are too large to be part of the HpAllocator
+            // If this fails all small allocations go straight to the buckets
+            if (void* mem = SystemAlloc(AZ::SizeAlignUp(sizeof(magazine_slot) * NUM_MAGAZINE_SLOTS, OS_VIRTUAL_PAGE_SIZE), OS_VIRTUAL_PAGE_SIZE))
+            {
+                mMagazineSlots = static_cast<magazine_slot*>(mem);
+                for (unsigned i = 0; i < NUM_MAGAZINE_SLOTS; i++)
+                {
+                    new (&mMagazineSlots[i]) magazine_slot();
+                }
+            }
+        }
+#endif
+
 #if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #if defined(MULTITHREADED)
         // For some platforms we can use an actual spin lock, test and profile. We don't expect much contention there
@@ -1056,6 +1137,18 @@ namespace AZ
 
         purge();
 
+#if defined(USE_THREAD_MAGAZINES)
+        if (mMagazineSlots)
+        {
+            for (unsigned i = 0; i < NUM_MAGAZINE_SLOTS; i++)
+            {
+                mMagazineSlots[i].~magazine_slot();
+            }
+            SystemFree(mMagazineSlots);
+            mMagazineSlots = nullptr;
+        }
+#endif
+
         if constexpr (DebugAllocatorEnable)
         {
             // Check if all the memory was returned to the OS
@@ -1204,6 +1297,12 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_MAGAZINES)
+        if (bi < NUM_MAGAZINE_BUCKETS && mMagazineSlots)
+        {
+            return magazine_alloc(bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1233,6 +1332,12 @@ namespace AZ
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_MAGAZINES)
+        if (bi < NUM_MAGAZINE_BUCKETS && mMagazineSlots)
+        {
+            return magazine_alloc(bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1303,6 +1408,12 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_MAGAZINES)
+        if (bi < NUM_MAGAZINE_BUCKETS && mMagazineSlots)
+        {
+            return magazine_free(ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1436,12 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#if defined(USE_THREAD_MAGAZINES)
+        if (bi < NUM_MAGAZINE_BUCKETS && mMagazineSlots)
+        {
+            return magazine_free(ptr, bi);
+        }
+#endif
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1448,6 +1565,138 @@ namespace AZ
         }
     }
 
+#if defined(USE_THREAD_MAGAZINES)
+    template<bool DebugAllocatorEnable>
+    AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::magazine_alloc(unsigned bi)
+    {
+        magazine_slot& slot = magazine_get_slot();
+        AZStd::lock_guard<AZStd::mutex> lock(slot.mLock);
+        magazine& mag = slot.mMagazines[bi];
+        if (mag.mCount == 0)
+        {
+            ++slot.mMisses;
+            mag.mCount = bucket_alloc_batch(bi, mag.mBlocks, MAGAZINE_BATCH_SIZE);
+            if (mag.mCount == 0)
+            {
+                return AllocateAddress{};
+            }
+        }
+        else
+        {
+            ++slot.mHits;
+        }
+
+        // Blocks in magazines are counted as free, only blocks handed out are counted as allocated
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        mTotalAllocatedSizeBuckets += elemSize;
+        return AllocateAddress(mag.mBlocks[--mag.mCount], elemSize);
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::magazine_free(void* ptr, unsigned bi) -> size_type
+    {
+        magazine_slot& slot = magazine_get_slot();
+        AZStd::lock_guard<AZStd::mutex> lock(slot.mLock);
+        magazine& mag = slot.mMagazines[bi];
+        if (mag.mCount == MAGAZINE_CAPACITY)
+        {
+            // Return the least recently freed half to the bucket, the most recent blocks are more likely to be in the cache
+            bucket_free_batch(bi, mag.mBlocks, MAGAZINE_BATCH_SIZE);
+            memmove(mag.mBlocks, mag.mBlocks + MAGAZINE_BATCH_SIZE, (MAGAZINE_CAPACITY - MAGAZINE_BATCH_SIZE) * sizeof(void*));
+            mag.mCount -= MAGAZINE_BATCH_SIZE;
+        }
+        mag.mBlocks[mag.mCount++] = ptr;
+
+        const size_type allocatedByteCount = ptr_get_page(ptr)->elem_size();
+        mTotalAllocatedSizeBuckets -= allocatedByteCount;
+        return allocatedByteCount;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::magazine_flush()
+    {
+        if (!mMagazineSlots)
+        {
+            return;
+        }
+
+        for (unsigned i = 0; i < NUM_MAGAZINE_SLOTS; i++)
+        {
+            magazine_slot& slot = mMagazineSlots[i];
+            AZStd::lock_guard<AZStd::mutex> lock(slot.mLock);
+            for (unsigned bi = 0; bi < NUM_MAGAZINE_BUCKETS; bi++)
+            {
+                magazine& mag = slot.mMagazines[bi];
+                if (mag.mCount > 0)
+                {
+                    bucket_free_batch(bi, mag.mBlocks, mag.mCount);
+                    mag.mCount = 0;
+                }
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    unsigned HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_batch(unsigned bi, void** blocks, unsigned count)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+        unsigned allocatedCount = 0;
+        while (allocatedCount < count)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                p = bucket_grow(bucket_spacing_function_inverse(bi), mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            blocks[allocatedCount++] = mBuckets[bi].alloc(p);
+        }
+        return allocatedCount;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_free_batch(unsigned bi, void* const* blocks, unsigned count)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+        for (unsigned i = 0; i < count; i++)
+        {
+            mBuckets[bi].free(ptr_get_page(blocks[i]), blocks[i]);
+        }
+    }
+#endif
+
+    template<bool DebugAllocatorEnable>
+    AllocatorCacheStats HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_cache_stats() const
+    {
+        AllocatorCacheStats stats;
+#if defined(USE_THREAD_MAGAZINES)
+        if (mMagazineSlots)
+        {
+            for (unsigned i = 0; i < NUM_MAGAZINE_SLOTS; i++)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(mMagazineSlots[i].mLock);
+                stats.m_hits += mMagazineSlots[i].mHits;
+                stats.m_misses += mMagazineSlots[i].mMisses;
+            }
+        }
+#endif
+        return stats;
+    }
+
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::split_block(block_header* bl, size_t size)
     {
@@ -1482,7 +1731,15 @@ namespace AZ
     {
         size_t allocSize = AZ::SizeAlignUp(size, OS_VIRTUAL_PAGE_SIZE);
         mTotalCapacitySizeTree += allocSize;
-        return SystemAlloc(size, m_treePageAlignment);
+        void* mem = SystemAlloc(size, m_treePageAlignment);
+#if defined(AZ_OS_ADVISE_HUGE_PAGES)
+        // large tree blocks back big buffers, huge pages reduce the TLB misses when walking them
+        if (mem && size >= AZ_OS_HUGE_PAGE_SIZE)
+        {
+            AZ_OS_ADVISE_HUGE_PAGES(mem, size);
+        }
+#endif
+        return mem;
     }
 
     template<bool DebugAllocatorEnable>
@@ -2598,6 +2855,12 @@ namespace AZ
     // GarbageCollect
     // [2/22/2011]
     //=========================================================================
+    template<bool DebugAllocator>
+    AllocatorCacheStats HphaSchemaBase<DebugAllocator>::GetCacheStats() const
+    {
+        return m_allocator->get_cache_stats();
+    }
+
     template<bool DebugAllocator>
     void HphaSchemaBase<DebugAllocator>::GarbageCollect()
     {
@@ -37,6 +37,9 @@ namespace AZ
 
         size_type       NumAllocatedBytes() const override;
 
+        /// Returns the hit and miss counters of the per-thread magazines that cache small allocations.
+        AllocatorCacheStats GetCacheStats() const override;
+
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
         void            GarbageCollect() override;
 
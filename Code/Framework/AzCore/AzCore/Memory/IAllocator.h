@@ -114,6 +114,15 @@ namespace AZ
         bool m_marksUnallocatedMemory = false;
     };
 
+    /**
+    * Counters of a cache an allocator keeps in front of its shared memory pool.
+    */
+    struct AllocatorCacheStats
+    {
+        size_t m_hits = 0; ///< Allocations served from the cache
+        size_t m_misses = 0; ///< Allocations that had to refill the cache from the shared pool
+    };
+
     /**
      * Allocator interface base class
      */
@@ -257,6 +266,9 @@ namespace AZ
         /// Returns the debug configuration for this allocator.
         virtual AllocatorDebugConfig GetDebugConfig() { return {}; }
 
+        /// Returns the hit and miss counters of the allocator's cache. Allocators without a cache return zeros.
+        virtual AllocatorCacheStats GetCacheStats() const { return {}; }
+
         /// Returns a pointer to the allocation records. They might be available or not depending on the build type. \ref Debug::AllocationRecords
         virtual const Debug::AllocationRecords* GetRecords() const { return nullptr; }
         Debug::AllocationRecords* GetRecords() { return const_cast<Debug::AllocationRecords*>(static_cast<const IAllocator*>(this)->GetRecords()); }
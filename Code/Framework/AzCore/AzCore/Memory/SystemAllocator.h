@@ -50,6 +50,7 @@ namespace AZ
         void            GarbageCollect() override                 { m_subAllocator->GarbageCollect(); }
 
         size_type       NumAllocatedBytes() const override       { return m_subAllocator->NumAllocatedBytes(); }
+        AllocatorCacheStats GetCacheStats() const override        { return m_subAllocator->GetCacheStats(); }
 
         //////////////////////////////////////////////////////////////////////////
 
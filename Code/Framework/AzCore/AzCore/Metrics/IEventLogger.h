@@ -299,6 +299,15 @@ namespace AZ::Metrics
 
         //! (Optional) Specifies the thread clock duration of the event in microseconds
         AZStd::optional<AZStd::chrono::microseconds> m_tdur;
+
+        //! (Optional) Specifies the start timestamp of the event in microseconds
+        //! Used to record events after they have completed, such as the regions of a profiler capture
+        //! Defaults to the time the event is recorded
+        AZStd::optional<AZStd::chrono::microseconds> m_ts;
+
+        //! (Optional) Specifies the thread the event occurred on
+        //! Defaults to the thread recording the event
+        AZStd::optional<AZStd::thread::id> m_tid;
     };
 
     //! Enums used to populate the scope key for instant events
@@ -42,7 +42,8 @@ namespace AZ::Metrics
     using EventJsonWriter = rapidjson::Writer<AZ::IO::RapidJSONWriteStreamUnbuffered, rapidjson::UTF8<char>, rapidjson::UTF8<char>,
         AZ::Json::RapidjsonStackAllocator<StackAllocatorSize>>;
 
-    static void AppendNewlineWithIndent(JsonTraceEventLogger::JsonEventString& eventString, int32_t indent, bool prependComma)
+    template<class StringType>
+    static void AppendNewlineWithIndent(StringType& eventString, int32_t indent, bool prependComma)
     {
         eventString += prependComma ? CommaNewline : Newline;
         eventString.append_range(AZStd::views::repeat(' ', indent));
@@ -279,9 +280,16 @@ namespace AZ::Metrics
         eventDesc.SetCategory(completeArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::Complete);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        eventDesc.SetThreadId(completeArgs.m_tid ? *completeArgs.m_tid : AZStd::this_thread::get_id());
+        if (completeArgs.m_ts)
+        {
+            eventDesc.SetTimestamp(*completeArgs.m_ts);
+        }
+        else
+        {
+            auto utcTimestamp = AZStd::chrono::utc_clock::now();
+            eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        }
         eventDesc.SetArgs(completeArgs.m_args);
 
         // The "id" field is optional for a complete event
@@ -543,10 +551,14 @@ namespace AZ::Metrics
 
     bool JsonTraceEventLogger::FlushRequest(const EventDesc& eventDesc)
     {
-        JsonEventString eventString;
+        // The event is formatted after its ",\n" separator so it can be written to the stream in a single call.
+        // The comma is skipped for the first event, which is only known once the stream lock is held.
+        AZStd::fixed_string<CommaNewline.size() + IndentStep + MaxEventJsonStringSize> eventString;
+        AppendNewlineWithIndent(eventString, IndentStep, true);
 
         AZ::Json::RapidjsonStackAllocator<StackAllocatorSize> stackAllocator;
         AZ::IO::ByteContainerStream byteStream(&eventString);
+        byteStream.Seek(aznumeric_cast<AZ::IO::GenericStream::OffsetType>(eventString.size()), AZ::IO::GenericStream::ST_SEEK_BEGIN);
         AZ::IO::RapidJSONWriteStreamUnbuffered rapidJsonStream(byteStream);
 
         EventJsonWriter jsonWriter(rapidJsonStream, &stackAllocator);
@@ -591,18 +603,15 @@ namespace AZ::Metrics
         bool result{};
         {
             AZStd::scoped_lock flushLock(m_flushToStreamMutex);
-            // Prepend a comma to the stream if an existing event was written previously
-            {
-                JsonEventString eventSeparatorString;
-                bool expected{};
-                AppendNewlineWithIndent(eventSeparatorString, IndentStep, !m_prependComma.compare_exchange_strong(expected, true));
-                totalBytesWritten += m_stream->Write(eventSeparatorString.size(), eventSeparatorString.data());
-            }
+            // Only keep the leading comma if an existing event was written previously
+            bool expected{};
+            const size_t separatorOffset = m_prependComma.compare_exchange_strong(expected, true) ? 1 : 0;
+            const size_t eventSize = eventString.size() - separatorOffset;
 
-            AZ::IO::SizeType eventBytesWritten = m_stream->Write(eventString.size(), eventString.data());
+            AZ::IO::SizeType eventBytesWritten = m_stream->Write(eventSize, eventString.data() + separatorOffset);
             currentEventIndex = m_eventCount++;
             // Validate the event has written eventString characters
-            result = eventBytesWritten == eventString.size();
+            result = eventBytesWritten == eventSize;
             totalBytesWritten += eventBytesWritten;
         }
 
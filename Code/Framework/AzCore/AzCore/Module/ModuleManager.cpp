@@ -19,6 +19,7 @@
 #include <AzCore/NativeUI/NativeUIRequests.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace
@@ -734,21 +735,13 @@ namespace AZ
             return;
         }
 
-        for (auto componentIt = componentsToActivate.begin(); componentIt != componentsToActivate.end(); )
+        // Remove the system entity and already activated components, we don't need to activate or store those.
+        // Every module that is loaded after startup sorts all the activated system components again, so this is done in a single pass.
+        const AZStd::unordered_set<Component*> activatedComponents(m_systemComponents.begin(), m_systemComponents.end());
+        AZStd::erase_if(componentsToActivate, [&activatedComponents](Component* component)
         {
-            Component* component = *componentIt;
-
-            // Remove the system entity and already activated components, we don't need to activate or store those
-            if (component->GetEntityId() == SystemEntityId ||
-                AZStd::find(m_systemComponents.begin(), m_systemComponents.end(), component) != m_systemComponents.end())
-            {
-                componentIt = componentsToActivate.erase(componentIt);
-            }
-            else
-            {
-                ++componentIt;
-            }
-        }
+            return component->GetEntityId() == SystemEntityId || activatedComponents.contains(component);
+        });
 
         AZStd::string componentNamesArray = R"({ "SystemComponents":[)";
         const char* comma = "";
@@ -757,7 +750,10 @@ namespace AZ
         {
             ModuleEntity::ActivateComponent(*component);
 
-            componentNamesArray += AZStd::string::format(R"(%s"%s")", comma, component->RTTI_GetTypeName());
+            componentNamesArray += comma;
+            componentNamesArray += '"';
+            componentNamesArray += component->RTTI_GetTypeName();
+            componentNamesArray += '"';
             comma = ", ";
         }
         componentNamesArray += R"(]})";
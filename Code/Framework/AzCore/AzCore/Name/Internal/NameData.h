@@ -42,6 +42,10 @@ namespace AZ
             void add_ref();
             void release();
 
+            //! Takes a reference only if the NameData is still referenced, which prevents reviving a NameData that is being released.
+            //! Used by lookups that don't hold the NameDictionary lock.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
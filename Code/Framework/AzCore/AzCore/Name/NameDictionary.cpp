@@ -25,6 +25,9 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        // Initial number of slots in the lookup table, must be a power of two
+        static constexpr size_t InitialLookupTableCapacity = 1024;
     }
 
     void NameDictionary::Create()
@@ -92,6 +95,9 @@ namespace AZ
         // This prevents our list head from being destroyed from a module that has shut down its AZ::Environment and
         // invalidating our list.
         m_deferredHead.m_linkedToDictionary = true;
+
+        m_lookupTables.emplace_back(AZStd::make_unique<LookupTable>(NameDictionaryInternal::InitialLookupTableCapacity));
+        m_lookupTable.store(m_lookupTables.back().get(), AZStd::memory_order_release);
     }
     
     NameDictionary::~NameDictionary()
@@ -125,10 +131,60 @@ namespace AZ
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
+
+        for (Internal::NameData* nameData : m_freeNameData)
+        {
+            delete nameData;
+        }
+        m_freeNameData.clear();
+    }
+
+    Name NameDictionary::FindNameLockFree(Name::Hash hash) const
+    {
+        const LookupTable* table = m_lookupTable.load(AZStd::memory_order_acquire);
+        const size_t mask = table->m_mask;
+        for (size_t probeCount = 0, index = hash & mask; probeCount <= mask; ++probeCount, index = (index + 1) & mask)
+        {
+            const LookupTable::Slot& slot = table->m_slots[index];
+            Internal::NameData* nameData = slot.m_nameData.load(AZStd::memory_order_acquire);
+            if (nameData == nullptr)
+            {
+                break;
+            }
+            if (slot.m_hash.load(AZStd::memory_order_relaxed) != hash)
+            {
+                continue;
+            }
+
+            // The entry may have been released, and its NameData recycled for another name, since it was read from the slot.
+            // A reference can only be taken while the NameData is still in use, and once it is held the NameData can't be
+            // recycled, so checking the hash afterwards guarantees this is the entry that was searched for.
+            if (!nameData->TryAddRef())
+            {
+                break;
+            }
+            if (nameData->GetHash() != hash)
+            {
+                nameData->release();
+                break;
+            }
+
+            Name name(nameData);
+            // The Name holds its own reference, so this can't release the NameData
+            nameData->m_useCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            return name;
+        }
+        return Name();
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
+        if (Name name = FindNameLockFree(hash); !name.IsEmpty())
+        {
+            return name;
+        }
+
+        // The name doesn't exist or was modified while searching, search again while preventing modifications
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
@@ -226,10 +282,10 @@ namespace AZ
 
         Name::Hash hash = CalcHash(nameString);
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // If we find the same name with the same hash, just return it.
+        // This path is faster than the loop below because FindNameLockFree() doesn't take any lock whereas the
         // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
+        Name name = FindNameLockFree(hash);
         if (name.GetStringView() == nameString)
         {
             return AZStd::move(name);
@@ -245,10 +301,11 @@ namespace AZ
             // No existing entry, add a new one and we're done
             if (iter == m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                Internal::NameData* nameData = AcquireNameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
                 m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                AddToLookupTable(nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -312,7 +369,10 @@ namespace AZ
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
             m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            m_lookupTable.load(AZStd::memory_order_relaxed)->Remove(nameData->GetHash());
+            // Readers that don't hold the lock may still be looking at this NameData, so it is kept for reuse.
+            // Its use count stays at -1 until it is reused, which prevents those readers from taking a reference.
+            m_freeNameData.push_back(nameData);
         }
 
         ReportStats();
@@ -384,6 +444,108 @@ namespace AZ
 #endif // AZ_DEBUG_BUILD
     }
 
+    Internal::NameData* NameDictionary::AcquireNameData(AZStd::string_view name, Name::Hash hash)
+    {
+        if (m_freeNameData.empty())
+        {
+            return aznew Internal::NameData(name, hash);
+        }
+
+        Internal::NameData* nameData = m_freeNameData.back();
+        m_freeNameData.pop_back();
+        nameData->m_name = name;
+        nameData->m_hash = hash;
+        nameData->m_hashCollision = false;
+        // Publishes the new name to readers whose reference is taken after the NameData starts being used
+        nameData->m_useCount.store(0, AZStd::memory_order_release);
+        return nameData;
+    }
+
+    void NameDictionary::AddToLookupTable(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+
+        // Keep the table at most half full so probe sequences stay short
+        if (m_dictionary.size() * 2 <= table->GetCapacity())
+        {
+            table->Insert(nameData);
+            return;
+        }
+
+        // m_dictionary already contains the new entry
+        auto grownTable = AZStd::make_unique<LookupTable>(table->GetCapacity() * 2);
+        for (const auto& entry : m_dictionary)
+        {
+            grownTable->Insert(entry.second.m_nameData);
+        }
+        m_lookupTable.store(grownTable.get(), AZStd::memory_order_release);
+        m_lookupTables.emplace_back(AZStd::move(grownTable));
+    }
+
+    // NameDictionary::LookupTable implementation
+    NameDictionary::LookupTable::LookupTable(size_t capacity)
+        : m_slots(AZStd::make_unique<Slot[]>(capacity))
+        , m_mask(capacity - 1)
+    {
+        AZ_Assert((capacity & m_mask) == 0, "LookupTable capacity must be a power of two");
+    }
+
+    size_t NameDictionary::LookupTable::GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+    void NameDictionary::LookupTable::Insert(Internal::NameData* nameData)
+    {
+        const Name::Hash hash = nameData->GetHash();
+        size_t index = hash & m_mask;
+        while (m_slots[index].m_nameData.load(AZStd::memory_order_relaxed) != nullptr)
+        {
+            index = (index + 1) & m_mask;
+        }
+
+        m_slots[index].m_hash.store(hash, AZStd::memory_order_relaxed);
+        m_slots[index].m_nameData.store(nameData, AZStd::memory_order_release);
+    }
+
+    void NameDictionary::LookupTable::Remove(Name::Hash hash)
+    {
+        size_t emptyIndex = hash & m_mask;
+        while (true)
+        {
+            if (m_slots[emptyIndex].m_nameData.load(AZStd::memory_order_relaxed) == nullptr)
+            {
+                return;
+            }
+            if (m_slots[emptyIndex].m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                break;
+            }
+            emptyIndex = (emptyIndex + 1) & m_mask;
+        }
+
+        // Move later entries of the probe sequence back into the emptied slot, so searches don't stop early at it.
+        // An entry can only move if the emptied slot lies between the entry's home slot and its current slot.
+        for (size_t index = (emptyIndex + 1) & m_mask;; index = (index + 1) & m_mask)
+        {
+            Internal::NameData* nameData = m_slots[index].m_nameData.load(AZStd::memory_order_relaxed);
+            if (nameData == nullptr)
+            {
+                break;
+            }
+
+            const Name::Hash entryHash = m_slots[index].m_hash.load(AZStd::memory_order_relaxed);
+            const size_t homeIndex = entryHash & m_mask;
+            if (((index - homeIndex) & m_mask) >= ((index - emptyIndex) & m_mask))
+            {
+                m_slots[emptyIndex].m_hash.store(entryHash, AZStd::memory_order_relaxed);
+                m_slots[emptyIndex].m_nameData.store(nameData, AZStd::memory_order_release);
+                emptyIndex = index;
+            }
+        }
+        m_slots[emptyIndex].m_nameData.store(nullptr, AZStd::memory_order_release);
+    }
+
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
         // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
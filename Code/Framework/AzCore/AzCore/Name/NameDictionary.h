@@ -9,6 +9,9 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
@@ -43,6 +46,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! Looking up a name that already exists doesn't take a lock. Only adding and releasing names, and
+    //! lookups that race with them, are serialized by the dictionary's mutex.
     class NameDictionary final
     {
     public:
@@ -112,6 +118,39 @@ namespace AZ
         //! Unloads the data with all deferred names registered using LoadDeferredName.
         void UnloadDeferredNames();
 
+        //! Searches the lookup table for a name without taking m_sharedMutex.
+        //! Returns an empty Name if the name wasn't found, or if it was modified during the search.
+        Name FindNameLockFree(Name::Hash hash) const;
+
+        //! Returns a NameData for a new dictionary entry, reusing a released one when available.
+        Internal::NameData* AcquireNameData(AZStd::string_view name, Name::Hash hash);
+
+        //! Adds a new entry of m_dictionary to the lookup table, growing it if needed.
+        void AddToLookupTable(Internal::NameData* nameData);
+
+        //! Open addressed table of the entries in m_dictionary, keyed by hash using linear probing.
+        //! It is searched without any lock but is only modified while m_sharedMutex is held exclusively.
+        //! Removed entries are back-filled rather than marked, so concurrent readers may briefly miss an
+        //! entry that is being moved. Readers fall back to m_dictionary whenever the lock-free search fails.
+        struct LookupTable
+        {
+            AZ_CLASS_ALLOCATOR(LookupTable, AZ::OSAllocator);
+
+            explicit LookupTable(size_t capacity);
+
+            size_t GetCapacity() const;
+            void Insert(Internal::NameData* nameData);
+            void Remove(Name::Hash hash);
+
+            struct Slot
+            {
+                AZStd::atomic<Name::Hash> m_hash{ 0 };
+                AZStd::atomic<Internal::NameData*> m_nameData{ nullptr };
+            };
+            AZStd::unique_ptr<Slot[]> m_slots;
+            size_t m_mask = 0;
+        };
+
         //! Wrapper structure around a NameData pointer
         //! Which sets the Internal::NameData::m_nameDictionary pointer to this name dictionary
         //! instance on construction and to nullptr on destruction
@@ -130,6 +169,16 @@ namespace AZ
         AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
 
+        //! The lookup table searched by readers. Tables replaced when growing are kept in m_lookupTables
+        //! until the dictionary is destroyed, since a reader may still be searching them.
+        AZStd::atomic<LookupTable*> m_lookupTable{ nullptr };
+        AZStd::vector<AZStd::unique_ptr<LookupTable>> m_lookupTables;
+
+        //! Released NameData are recycled instead of deleted while the dictionary is alive. This guarantees that
+        //! a NameData pointer read from the lookup table always refers to a NameData, even if it was released since,
+        //! so readers can safely attempt to take a reference to it and validate it afterwards.
+        AZStd::vector<Internal::NameData*> m_freeNameData;
+
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
         //! so we keep track of them here to ensure their name data gets correctly cleaned up
@@ -3440,6 +3440,7 @@ LUA_API const Node* lua_getDummyNode()
                         , arg->m_name, method->m_name.c_str(), arg->m_name, arg->m_name, arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    m_hasArgumentDestructors = m_hasArgumentDestructors || (argClass && argClass->m_destructor);
                 }
 
                 if (method->HasResult())
@@ -3512,6 +3513,7 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
                 int numResults = 0;
+                AssignedResultState resultState;
 
                 if (thisPtr->m_resultToLua)
                 {
@@ -3523,12 +3525,15 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // The lambda only captures a single pointer, so it fits the small object buffer of the function and calls returning
+                    // a value don't allocate.
+                    resultState = { lua, thisPtr, &result, &numResults };
+                    result.m_onAssignedResult = AZStd::function<void()>([state = &resultState]()
                     {
-                        if (result.m_value)
+                        if (state->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            state->m_caller->m_resultToLua(state->m_lua, *state->m_result);
+                            ++(*state->m_numResults);
                         }
                     });
                 }
@@ -3573,7 +3578,7 @@ LUA_API const Node* lua_getDummyNode()
                 {
                     backupAllocator.deallocate(result.m_value, thisPtr->m_resultClass->m_size, thisPtr->m_resultClass->m_alignment);
                 }
-                for (int i = 0; i < numArguments; ++i)
+                for (int i = 0; thisPtr->m_hasArgumentDestructors && i < numArguments; ++i)
                 {
                     BehaviorClass* argClass = thisPtr->m_fromLua[i].second;
                     if (argClass && argClass->m_destructor)
@@ -3589,12 +3594,22 @@ LUA_API const Node* lua_getDummyNode()
                 return numResults;
             }
 
+            //! State the result callback needs to push the result to Lua, kept on the stack of the call.
+            struct AssignedResultState
+            {
+                lua_State* m_lua = nullptr;
+                LuaScriptCaller* m_caller = nullptr;
+                BehaviorArgument* m_result = nullptr;
+                int* m_numResults = nullptr;
+            };
+
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
 
             bool m_isResult;
+            bool m_hasArgumentDestructors = false; ///< True if any of the arguments can need its destructor called after the call.
         };
 
         class LuaGenericCaller : public LuaCaller
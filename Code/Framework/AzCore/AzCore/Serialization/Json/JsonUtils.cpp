@@ -205,7 +205,10 @@ namespace AZ::JsonSerializationUtils
     }
 
 
-    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
+    //! Parses the JSON text into a document. If the text is known to be followed by a null terminator it's parsed as a string
+    //! stream, which lets rapidjson use its SIMD paths for skipping whitespace and scanning strings. Otherwise the text is
+    //! parsed through a memory stream, which can only skip whitespace with SIMD.
+    static AZ::Outcome<rapidjson::Document, AZStd::string> ParseJsonText(AZStd::string_view jsonText, bool isNullTerminated)
     {
         if (jsonText.empty())
         {
@@ -213,7 +216,16 @@ namespace AZ::JsonSerializationUtils
         }
 
         rapidjson::Document jsonDocument;
-        jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
+        if (isNullTerminated)
+        {
+            AZ_Assert(jsonText.data()[jsonText.size()] == '\0', "JSON text was marked as null terminated but isn't.");
+            jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data());
+        }
+        else
+        {
+            jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
+        }
+
         if (jsonDocument.HasParseError())
         {
             size_t lineNumber = 1;
@@ -234,6 +246,11 @@ namespace AZ::JsonSerializationUtils
         }
     }
 
+    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
+    {
+        return ParseJsonText(jsonText, false);
+    }
+
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
     {
         IO::SizeType length = stream.GetLength();
@@ -249,7 +266,7 @@ namespace AZ::JsonSerializationUtils
 
         memoryBuffer.back() = 0;
 
-        return ReadJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size()});
+        return ParseJsonText(AZStd::string_view{ memoryBuffer.data(), static_cast<size_t>(length) }, true);
     }
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
@@ -265,7 +282,7 @@ namespace AZ::JsonSerializationUtils
 
         AZStd::string jsonContent = readResult.TakeValue();
 
-        auto result = ReadJsonString(jsonContent);
+        auto result = ParseJsonText(jsonContent, true);
         if (!result.IsSuccess())
         {
             return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. %s", AZ_STRING_ARG(filePath), result.GetError().c_str()));
@@ -23,6 +23,7 @@
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/parallel/lock.h>
 
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/Math/MathUtils.h>
@@ -84,6 +85,11 @@ namespace AZ
             AZ_SERIALIZE_SWAP_ENDIAN(value, isDataBigEndian);
             return static_cast<size_t>(stream.Write(sizeof(T), reinterpret_cast<const void*>(&value)));
         }
+
+        bool IsTriviallyCopyable() const override
+        {
+            return true;
+        }
     };
 
 
@@ -1785,6 +1791,22 @@ namespace AZ
             }
         }
 
+        // Flat classes are copied using their compiled plan instead of being walked element by element.
+        if (const ClonePlan* plan = FindFlatClonePlan(classData))
+        {
+            for (const CloneCopyRun& run : plan->m_runs)
+            {
+                memcpy(reinterpret_cast<char*>(destPtr) + run.m_offset, reinterpret_cast<const char*>(srcPtr) + run.m_offset, run.m_size);
+            }
+
+            ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.emplace_back();
+            parentInfo.m_ptr = destPtr;
+            parentInfo.m_reservePtr = reservePtr;
+            parentInfo.m_classData = classData;
+            parentInfo.m_containerIndexCounter = 0;
+            return false; // all elements have been copied
+        }
+
         if (classData->m_eventHandler)
         {
             classData->m_eventHandler->OnWriteBegin(destPtr);
@@ -1792,7 +1814,11 @@ namespace AZ
 
         if (classData->m_serializer)
         {
-            if (const auto* genericInfo = elementData ? elementData->m_genericClassInfo : FindGenericClassInfo(classData->m_typeId);
+            if (elementData && !(elementData->m_flags & ClassElement::FLG_POINTER) && classData->m_serializer->IsTriviallyCopyable())
+            {
+                memcpy(destPtr, srcPtr, elementData->m_dataSize);
+            }
+            else if (const auto* genericInfo = elementData ? elementData->m_genericClassInfo : FindGenericClassInfo(classData->m_typeId);
                     genericInfo && genericInfo->GetGenericTypeId() == GetAssetClassId())
             {
                 // Optimized clone path for asset references.
@@ -1869,6 +1895,97 @@ namespace AZ
         return true;
     }
 
+    //=========================================================================
+    // FindFlatClonePlan
+    //=========================================================================
+    auto SerializeContext::FindFlatClonePlan(const ClassData* classData) const -> const ClonePlan*
+    {
+        // Only classes made up of elements are compiled, everything else is left to the regular clone path.
+        if (classData->m_serializer || classData->m_container || classData->m_eventHandler || classData->m_elements.empty())
+        {
+            return nullptr;
+        }
+
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+            if (auto planIt = m_clonePlans.find(classData); planIt != m_clonePlans.end())
+            {
+                return planIt->second.m_isFlat ? &planIt->second : nullptr;
+            }
+        }
+
+        ClonePlan plan;
+        plan.m_isFlat = CompileClonePlan(classData, 0, plan);
+        if (!plan.m_isFlat)
+        {
+            plan.m_runs.clear();
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+        // Another thread may have compiled the same plan in the meantime, in which case that one is kept.
+        auto planIt = m_clonePlans.emplace(classData, AZStd::move(plan)).first;
+        return planIt->second.m_isFlat ? &planIt->second : nullptr;
+    }
+
+    //=========================================================================
+    // CompileClonePlan
+    //=========================================================================
+    bool SerializeContext::CompileClonePlan(const ClassData* classData, size_t baseOffset, ClonePlan& plan) const
+    {
+        if (classData->m_serializer || classData->m_container || classData->m_eventHandler || classData->IsDeprecated())
+        {
+            return false;
+        }
+
+        // The value of a dynamic field is injected per instance, so it isn't described by the elements.
+        if (classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+        {
+            return false;
+        }
+
+        constexpr unsigned int NonFlatElementFlags =
+            ClassElement::FLG_POINTER | ClassElement::FLG_DYNAMIC_FIELD | ClassElement::FLG_UI_ELEMENT;
+        for (const ClassElement& element : classData->m_elements)
+        {
+            if (element.m_flags & NonFlatElementFlags)
+            {
+                return false;
+            }
+
+            const ClassData* elementClassData = element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : FindClassData(element.m_typeId, classData, element.m_nameCrc);
+            if (!elementClassData)
+            {
+                return false;
+            }
+
+            const size_t elementOffset = baseOffset + element.m_offset;
+            if (elementClassData->m_serializer)
+            {
+                if (!elementClassData->m_serializer->IsTriviallyCopyable())
+                {
+                    return false;
+                }
+
+                // Merge runs of adjacent values so they're copied in one go.
+                if (!plan.m_runs.empty() && plan.m_runs.back().m_offset + plan.m_runs.back().m_size == elementOffset)
+                {
+                    plan.m_runs.back().m_size += element.m_dataSize;
+                }
+                else
+                {
+                    plan.m_runs.push_back({ elementOffset, element.m_dataSize });
+                }
+            }
+            else if (!CompileClonePlan(elementClassData, elementOffset, plan))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //=========================================================================
     // EnumerateDerived
     // [11/13/2012]
@@ -2032,6 +2149,12 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        {
+            // Plans of other classes may include the removed class, so all of them are compiled again on their next use.
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+            m_clonePlans.clear();
+        }
+
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -28,6 +28,7 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -444,6 +445,26 @@ namespace AZ
         bool BeginCloneElementInplace(void* rootDestPtr, void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
         bool EndCloneElement(void* stackData);
 
+        /// A contiguous range of bytes that can be copied as is when cloning an object.
+        struct CloneCopyRun
+        {
+            size_t m_offset;
+            size_t m_size;
+        };
+
+        /// Lazily compiled description of how to clone a class. A flat class only holds values that can be copied byte for byte,
+        /// so cloning it comes down to copying its runs instead of walking its elements.
+        struct ClonePlan
+        {
+            AZStd::vector<CloneCopyRun> m_runs;
+            bool m_isFlat = false;
+        };
+
+        /// Returns the clone plan for the class, compiling it on first use. Returns null if the class isn't flat.
+        const ClonePlan* FindFlatClonePlan(const ClassData* classData) const;
+        /// Appends the copy runs for all elements of the class to the plan. Returns false if the class isn't flat.
+        bool CompileClonePlan(const ClassData* classData, size_t baseOffset, ClonePlan& plan) const;
+
         /**
          * Internal structure to maintain class information while we are describing a class.
          * User should call variety of functions to describe class features and data.
@@ -678,6 +699,9 @@ namespace AZ
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
 
+        mutable AZStd::unordered_map<const ClassData*, ClonePlan> m_clonePlans; ///< Compiled clone plans, created on first clone of a class
+        mutable AZStd::shared_mutex m_clonePlanMutex; ///< Guards m_clonePlans as objects can be cloned from multiple threads
+
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
 
@@ -1051,6 +1075,9 @@ namespace AZ::Serialize
 
         /// Optional post processing of the cloned data to deal with members that are not serialize-reflected.
         virtual void PostClone(void* /*classPtr*/) {}
+
+        /// Returns true if the data is fully described by its bytes, so cloning can copy them instead of saving and loading them.
+        virtual bool IsTriviallyCopyable() const { return false; }
     };
 
     /**
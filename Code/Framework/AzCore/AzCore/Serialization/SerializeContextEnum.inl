@@ -124,6 +124,11 @@ namespace AZ
             {
                 return SerializeContext::EqualityCompareHelper<EnumType>::CompareValues(lhs, rhs);
             }
+
+            bool IsTriviallyCopyable() const override
+            {
+                return true;
+            }
         };
     }
 
@@ -18,7 +18,10 @@
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/ranges/split_view.h>
 
@@ -870,7 +873,17 @@ namespace AZ
                 return result;
             }
 
-            // Load the registry files in the sorted order.
+            // Reading and parsing the files doesn't touch the registry, so it can be done on multiple threads.
+            // The documents are then merged in the sorted order, so the result is the same as merging the files one by one.
+            struct ParsedRegistryFile
+            {
+                AZ::IO::FixedMaxPath m_path;
+                AZStd::string m_jsonData;
+                rapidjson::Document m_jsonPatch;
+                MergeSettingsResult m_parseResult;
+            };
+            AZStd::vector<AZStd::unique_ptr<ParsedRegistryFile>> parsedFiles;
+            parsedFiles.reserve(fileList.size());
             for (RegistryFile& registryFile : fileList)
             {
                 folderPath.Native().erase(platformKeyOffset); // Erase all characters after the platformKeyOffset
@@ -882,16 +895,54 @@ namespace AZ
 
                 folderPath /= registryFile.m_relativePath;
 
-                // Combine the MergeSettings result of each MergeSettingsFileInternal
-                // operation
-                if (!registryFile.m_isPatch)
+                auto& parsedFile = parsedFiles.emplace_back(AZStd::make_unique<ParsedRegistryFile>());
+                parsedFile->m_path = folderPath;
+            }
+
+            AZStd::atomic<size_t> nextFileIndex{ 0 };
+            auto ParseFiles = [this, &parsedFiles, &nextFileIndex]()
+            {
+                for (size_t fileIndex = nextFileIndex++; fileIndex < parsedFiles.size(); fileIndex = nextFileIndex++)
                 {
-                    multiFileResult.Combine(MergeSettingsFileInternal(folderPath.c_str(), Format::JsonMergePatch, rootKey));
+                    ParsedRegistryFile& parsedFile = *parsedFiles[fileIndex];
+                    parsedFile.m_parseResult = LoadJsonFileIntoString(parsedFile.m_jsonData, parsedFile.m_path.c_str());
+                    if (parsedFile.m_parseResult)
+                    {
+                        parsedFile.m_parseResult = ParseSettingsString(parsedFile.m_jsonData, parsedFile.m_jsonPatch, parsedFile.m_path);
+                    }
                 }
-                else
+            };
+
+            const size_t threadCount = AZStd::min<size_t>(
+                AZStd::thread::hardware_concurrency(), parsedFiles.size() / MinRegistryFilesPerParseThread);
+            AZStd::fixed_vector<AZStd::thread, MaxRegistryFolderEntries / MinRegistryFilesPerParseThread> parseThreads;
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "SetregParse";
+            // The calling thread parses files as well
+            for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+            {
+                parseThreads.emplace_back(threadDesc, ParseFiles);
+            }
+            ParseFiles();
+            for (AZStd::thread& parseThread : parseThreads)
+            {
+                parseThread.join();
+            }
+
+            // Merge the registry files in the sorted order.
+            for (size_t fileIndex = 0; fileIndex < parsedFiles.size(); ++fileIndex)
+            {
+                ParsedRegistryFile& parsedFile = *parsedFiles[fileIndex];
+                if (!parsedFile.m_parseResult)
                 {
-                    multiFileResult.Combine(MergeSettingsFileInternal(folderPath.c_str(), Format::JsonPatch, rootKey));
+                    multiFileResult.Combine(parsedFile.m_parseResult);
+                    continue;
                 }
+
+                // Combine the MergeSettings result of each MergeSettingsJsonDocument
+                // operation
+                const Format format = fileList[fileIndex].m_isPatch ? Format::JsonPatch : Format::JsonMergePatch;
+                multiFileResult.Combine(MergeSettingsJsonDocument(parsedFile.m_jsonPatch, format, rootKey, parsedFile.m_path));
             }
         }
 
@@ -1274,6 +1325,19 @@ namespace AZ
         }
 
         rapidjson::Document jsonPatch;
+        if (MergeSettingsResult parseResult = ParseSettingsString(jsonData, jsonPatch, filePath);
+            !parseResult)
+        {
+            return parseResult;
+        }
+
+        // Delegate to the MergeSettingsJsonDocument function to merge the settings to registry
+        return MergeSettingsJsonDocument(jsonPatch, format, anchorKey, filePath);
+    }
+
+    auto SettingsRegistryImpl::ParseSettingsString(AZStd::string& jsonData, rapidjson::Document& jsonPatch, AZ::IO::PathView filePath)
+        -> MergeSettingsResult
+    {
         constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
         jsonPatch.ParseInsitu<flags>(jsonData.data());
         if (jsonPatch.HasParseError())
@@ -1288,8 +1352,9 @@ namespace AZ
             return mergeResult;
         }
 
-        // Delegate to the MergeSettingsJsonDocument function to merge the settings to registry
-        return MergeSettingsJsonDocument(jsonPatch, format, anchorKey, filePath);
+        MergeSettingsResult parseResult;
+        parseResult.Combine(MergeSettingsReturnCode::Success);
+        return parseResult;
     }
 
     auto SettingsRegistryImpl::MergeSettingsJsonDocument(const rapidjson::Document& jsonPatch, Format format,
@@ -32,6 +32,8 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
+        //! Folders with at least this many files per available core read and parse their files on multiple threads.
+        static constexpr size_t MinRegistryFilesPerParseThread = 8;
         
         SettingsRegistryImpl();
         //! @param useFileIo - If true attempt to redirect
@@ -122,6 +124,8 @@ namespace AZ
         MergeSettingsResult MergeSettingsString(AZStd::string jsonData, Format format, AZStd::string_view anchorKey,
             AZ::IO::PathView filePath);
         MergeSettingsResult LoadJsonFileIntoString(AZStd::string& jsonData, const char* filePath);
+        //! Parses the json data in place, so the document references the json data which must outlive it
+        static MergeSettingsResult ParseSettingsString(AZStd::string& jsonData, rapidjson::Document& jsonPatch, AZ::IO::PathView filePath);
 
         void SignalNotifier(AZStd::string_view jsonPath, SettingsType type);
 
@@ -18,6 +18,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/Threading/ThreadUtils.h>
 
 #include <random>
 
@@ -185,7 +186,7 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
+                        Task* task = m_queues[priority][head];
                         if (status.head.compare_exchange_weak(head, head + 1))
                         {
                             return task;
@@ -202,23 +203,27 @@ namespace AZ
         public:
             static thread_local TaskWorker* t_worker;
 
-            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
+            static constexpr uint32_t NoCore = ~0u;
+
+            void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, uint32_t logicalCore = NoCore)
             {
                 m_executor = &executor;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
                 desc.m_name = m_threadName.c_str();
-                if (affinitize)
-                {
-                    desc.m_cpuId = 1 << id;
-                }
                 m_active.store(true, AZStd::memory_order_release);
 
                 m_thread = AZStd::thread{ desc,
-                                          [this, &initSemaphore]
+                                          [this, &initSemaphore, logicalCore]
                                           {
                                               t_worker = this;
+                                              if (logicalCore != NoCore)
+                                              {
+                                                  // thread_desc::m_cpuId semantics differ per platform, pin from the thread itself
+                                                  [[maybe_unused]] const bool pinned = ::AZ::Threading::PinCurrentThreadToCore(logicalCore);
+                                                  AZ_Warning("TaskExecutor", pinned, "Unable to pin %s to logical core %u", m_threadName.c_str(), logicalCore);
+                                              }
                                               initSemaphore.release();
                                               Run();
                                           } };
@@ -268,7 +273,7 @@ namespace AZ
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    Task* task = NextTask();
                     while (task)
                     {
                         task->Invoke();
@@ -288,11 +293,21 @@ namespace AZ
                             m_executor->ReleaseGraph();
                         }
 
-                        task = m_queue.TryDequeue();
+                        task = NextTask();
                     }
                 }
             }
 
+            Task* NextTask()
+            {
+                Task* task = m_queue.TryDequeue();
+                if (!task && m_executor->m_topologyAware)
+                {
+                    task = m_executor->StealTask(*this);
+                }
+                return task;
+            }
+
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
@@ -301,6 +316,11 @@ namespace AZ
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
             AZStd::string m_threadName;
+
+            // Topology aware mode only
+            uint32_t m_domain = 0;
+            uint32_t m_nextLocalSubmission = 0; // only touched by the worker's own thread
+            AZStd::vector<uint32_t> m_stealOrder; // same domain workers first, then remote domains
             friend class ::AZ::TaskExecutor;
         };
 
@@ -371,10 +391,70 @@ namespace AZ
     }
 
     TaskExecutor::TaskExecutor(uint32_t threadCount)
+        : TaskExecutor(TaskExecutorDesc{ threadCount })
+    {
+    }
+
+    TaskExecutor::TaskExecutor(const TaskExecutorDesc& desc)
         : m_eventTracker(this)
     {
-        // TODO: Configure thread count + affinity based on configuration
-        m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
+        // Restrict the cache domains to the allowed cores
+        AZStd::vector<Threading::CacheDomain> domains;
+        if (desc.m_topologyAware)
+        {
+            for (Threading::CacheDomain& domain : Threading::GetLastLevelCacheDomains())
+            {
+                if (!desc.m_cpuSet.empty())
+                {
+                    AZStd::erase_if(domain,
+                        [&desc](uint32_t core)
+                        {
+                            return AZStd::find(desc.m_cpuSet.begin(), desc.m_cpuSet.end(), core) == desc.m_cpuSet.end();
+                        });
+                }
+                if (!domain.empty())
+                {
+                    domains.push_back(AZStd::move(domain));
+                }
+            }
+        }
+        if (domains.empty())
+        {
+            domains.emplace_back(desc.m_cpuSet);
+        }
+
+        size_t allowedCoreCount = 0;
+        for (const Threading::CacheDomain& domain : domains)
+        {
+            allowedCoreCount += domain.size();
+        }
+        const bool pinWorkers = desc.m_topologyAware || !desc.m_cpuSet.empty();
+
+        m_topologyAware = desc.m_topologyAware;
+        if (desc.m_threadCount != 0)
+        {
+            m_threadCount = desc.m_threadCount;
+        }
+        else
+        {
+            m_threadCount = allowedCoreCount != 0 ? static_cast<uint32_t>(allowedCoreCount) : AZStd::thread::hardware_concurrency();
+        }
+
+        // Spread the workers evenly across the domains, filling each domain's cores in order
+        AZStd::vector<uint32_t> workerCores(m_threadCount, Internal::TaskWorker::NoCore);
+        AZStd::vector<uint32_t> workerDomains(m_threadCount, 0);
+        m_domainWorkers.resize(domains.size());
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            const uint32_t domainIndex = i % domains.size();
+            const Threading::CacheDomain& domain = domains[domainIndex];
+            if (pinWorkers && !domain.empty())
+            {
+                workerCores[i] = domain[m_domainWorkers[domainIndex].size() % domain.size()];
+            }
+            workerDomains[i] = domainIndex;
+            m_domainWorkers[domainIndex].push_back(i);
+        }
 
         m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
 
@@ -383,7 +463,27 @@ namespace AZ
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
-            m_workers[i].Spawn(*this, i, initSemaphore, false);
+            Internal::TaskWorker& worker = m_workers[i];
+            worker.m_domain = workerDomains[i];
+
+            if (m_topologyAware)
+            {
+                // Siblings first, then remote domains starting with the next one so thieves don't all hit the same domain
+                for (uint32_t sibling : m_domainWorkers[worker.m_domain])
+                {
+                    if (sibling != i)
+                    {
+                        worker.m_stealOrder.push_back(sibling);
+                    }
+                }
+                for (size_t offset = 1; offset < m_domainWorkers.size(); ++offset)
+                {
+                    const auto& remoteWorkers = m_domainWorkers[(worker.m_domain + offset) % m_domainWorkers.size()];
+                    worker.m_stealOrder.insert(worker.m_stealOrder.end(), remoteWorkers.begin(), remoteWorkers.end());
+                }
+            }
+
+            worker.Spawn(*this, i, initSemaphore, workerCores[i]);
         }
 
         for (size_t i = 0; i != m_threadCount; ++i)
@@ -451,9 +551,25 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        if (m_topologyAware)
+        {
+            // Keep tasks spawned by a worker within its cache domain, the data they touch is likely already in that cache
+            if (Internal::TaskWorker* localWorker = GetTaskWorker(); localWorker)
+            {
+                const AZStd::vector<uint32_t>& siblings = m_domainWorkers[localWorker->m_domain];
+                for (size_t attempt = 0; attempt != siblings.size(); ++attempt)
+                {
+                    Internal::TaskWorker& sibling = m_workers[siblings[localWorker->m_nextLocalSubmission++ % siblings.size()]];
+                    if (sibling.Enabled())
+                    {
+                        sibling.Enqueue(&task);
+                        return;
+                    }
+                }
+            }
+        }
+
+        // TODO: Some heuristics on core availability will help distribute work more effectively
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -465,6 +581,18 @@ namespace AZ
         m_workers[nextWorker].Enqueue(&task);
     }
 
+    Internal::Task* TaskExecutor::StealTask(Internal::TaskWorker& thief)
+    {
+        for (uint32_t victim : thief.m_stealOrder)
+        {
+            if (Internal::Task* task = m_workers[victim].m_queue.TryDequeue(); task)
+            {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
     void TaskExecutor::ReleaseGraph()
     {
         --m_graphsRemaining;
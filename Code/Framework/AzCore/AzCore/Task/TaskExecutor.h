@@ -116,6 +116,20 @@ namespace AZ
         class TaskWorker;
     } // namespace Internal
 
+    //! Configuration of the worker threads created by a TaskExecutor.
+    struct TaskExecutorDesc
+    {
+        //! Number of worker threads, 0 matches the number of allowed cores (or the hardware concurrency if m_cpuSet is empty).
+        uint32_t m_threadCount = 0;
+
+        //! Groups workers by the last level cache they share. Tasks submitted from a worker are queued on workers of the same
+        //! cache domain and idle workers steal from their own domain before stealing from remote ones.
+        bool m_topologyAware = false;
+
+        //! Logical cores the workers are allowed to run on. When not empty (or when topology aware) each worker is pinned to a core.
+        AZStd::vector<uint32_t> m_cpuSet;
+    };
+
     class TaskExecutor final
     {
     public:
@@ -128,6 +142,7 @@ namespace AZ
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
         explicit TaskExecutor(uint32_t threadCount = 0);
+        explicit TaskExecutor(const TaskExecutorDesc& desc);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -138,17 +153,25 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        uint32_t GetWorkerCount() const { return m_threadCount; }
+        //! Number of last level cache domains the workers are spread across, 1 when not topology aware.
+        uint32_t GetCacheDomainCount() const { return static_cast<uint32_t>(m_domainWorkers.size()); }
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
         friend class Internal::CompiledTaskGraphTracker;
 
         Internal::TaskWorker* GetTaskWorker();
+        Internal::Task* StealTask(Internal::TaskWorker& thief);
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
+        bool m_topologyAware = false;
+        // Worker indices for each last level cache domain
+        AZStd::vector<AZStd::vector<uint32_t>> m_domainWorkers;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
 
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Threading/ThreadUtils.h>
 
  // PERFORMANCE NOTE & TODO
@@ -30,6 +31,10 @@ AZ_CVAR(uint32_t, cl_taskGraphThreadsMaxNumber, 0, nullptr, AZ::ConsoleFunctorFl
 
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
+// Settings registry keys to configure the placement of the task graph worker threads
+static constexpr const char* TaskGraphTopologyAwareKey = "/O3DE/AzCore/TaskGraph/TopologyAware";
+static constexpr const char* TaskGraphCpuSetKey = "/O3DE/AzCore/TaskGraph/CpuSet"; // cpu list such as "0-7,16-23"
+
 namespace AZ
 {
     void TaskGraphSystemComponent::Activate()
@@ -54,8 +59,21 @@ namespace AZ
                 cl_taskGraphThreadsConcurrencyRatio, cl_taskGraphThreadsMinNumber, cl_taskGraphThreadsMaxNumber,
                 cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
+            TaskExecutorDesc executorDesc;
+            executorDesc.m_threadCount = numberOfWorkerThreads;
+            if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry)
+            {
+                settingsRegistry->Get(executorDesc.m_topologyAware, TaskGraphTopologyAwareKey);
+
+                AZStd::string cpuSet;
+                if (settingsRegistry->Get(cpuSet, TaskGraphCpuSetKey) && !Threading::ParseCpuList(cpuSet, executorDesc.m_cpuSet))
+                {
+                    AZ_Warning("TaskGraph", false, "Ignoring malformed cpu list '%s' at %s", cpuSet.c_str(), TaskGraphCpuSetKey);
+                }
+            }
+
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            m_taskExecutor = aznew TaskExecutor(executorDesc);
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
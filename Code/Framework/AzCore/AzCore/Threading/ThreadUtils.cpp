@@ -9,6 +9,8 @@
 #include <AzCore/Threading/ThreadUtils.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/functional.h>
 
 namespace AZ::Threading
 {
@@ -22,4 +24,69 @@ namespace AZ::Threading
         const uint32_t numWorkerThreads = AZ::GetMax<uint32_t>(minNumWorkerThreads, requestedWorkerThreadsRounded);
         return numWorkerThreads;
     }
+
+    // Matches CPU_SETSIZE in glibc. Rejecting anything larger also keeps the number parsing in ParseCpuList from overflowing.
+    static constexpr uint32_t MaxLogicalCores = 1024;
+
+    bool ParseCpuList(AZStd::string_view cpuList, AZStd::vector<uint32_t>& cores)
+    {
+        AZStd::vector<uint32_t> parsed;
+
+        auto parseNumber = [](AZStd::string_view text, uint32_t& value)
+        {
+            text = AZ::StringFunc::StripEnds(text, " \t\r\n");
+            if (text.empty())
+            {
+                return false;
+            }
+            value = 0;
+            for (char c : text)
+            {
+                if (c < '0' || c > '9')
+                {
+                    return false;
+                }
+                value = value * 10 + static_cast<uint32_t>(c - '0');
+                if (value >= MaxLogicalCores)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        bool valid = true;
+        AZ::StringFunc::TokenizeVisitor(
+            cpuList,
+            [&](AZStd::string_view range)
+            {
+                if (!valid)
+                {
+                    return;
+                }
+                uint32_t first = 0;
+                uint32_t last = 0;
+                if (const size_t dash = range.find('-'); dash != AZStd::string_view::npos)
+                {
+                    valid = parseNumber(range.substr(0, dash), first) && parseNumber(range.substr(dash + 1), last) && first <= last;
+                }
+                else
+                {
+                    valid = parseNumber(range, first);
+                    last = first;
+                }
+                for (uint32_t core = first; valid && core <= last; ++core)
+                {
+                    parsed.push_back(core);
+                }
+            },
+            ',');
+
+        if (!valid)
+        {
+            return false;
+        }
+        cores.insert(cores.end(), parsed.begin(), parsed.end());
+        return true;
+    }
 };
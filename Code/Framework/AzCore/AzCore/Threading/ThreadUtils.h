@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
 
 namespace AZ::Threading
 {
@@ -20,4 +22,19 @@ namespace AZ::Threading
     //! @param reservedNumThreads number of hardware threads to reserve for O3DE system threads. Value clamped to num_hardware_threads.
     //! @return number of worker threads for the calling system to allocate
     uint32_t CalcNumWorkerThreads(float workerThreadsRatio, uint32_t minNumWorkerThreads, uint32_t maxNumWorkerThreads, uint32_t reservedNumThreads);
+
+    //! Logical cores sharing the same last level cache, e.g. a CCX on Zen parts or a socket on most Intel parts.
+    using CacheDomain = AZStd::vector<uint32_t>;
+
+    //! Returns the logical cores of the system grouped by the last level cache they share, sorted by their first core.
+    //! Platforms which can't query the cache topology return a single domain containing all the hardware threads.
+    AZStd::vector<CacheDomain> GetLastLevelCacheDomains();
+
+    //! Parses a list of logical cores in the Linux cpu list format, e.g. "0-3,8,10-11", and appends them to cores.
+    //! @return false if the list is malformed or contains a core of 1024 or higher, cores is left unchanged in that case.
+    bool ParseCpuList(AZStd::string_view cpuList, AZStd::vector<uint32_t>& cores);
+
+    //! Restricts the calling thread to a single logical core.
+    //! @return false if the platform doesn't support setting the affinity or the call failed.
+    bool PinCurrentThreadToCore(uint32_t logicalCore);
 };
@@ -200,6 +200,8 @@ set(FILES
     IO/Streamer/FullFileDecompressor.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
+    IO/Streamer/ReadTracePrefetcher.h
+    IO/Streamer/ReadTracePrefetcher.cpp
     IO/Streamer/RequestPath.h
     IO/Streamer/RequestPath.cpp
     IO/Streamer/Scheduler.h
@@ -271,6 +273,9 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BoundingVolumeBatch.cpp
+    Math/BoundingVolumeBatch.h
+    Math/BoundingVolumeBatch.inl
     Math/Capsule.h
     Math/Capsule.inl
     Math/Color.cpp
@@ -419,6 +424,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameAllocator.cpp
+    Memory/FrameAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -27,6 +27,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    flat_hash_table.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -97,6 +98,8 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -151,6 +154,7 @@ set(FILES
     delegate/delegate_fwd.h
     function/function_base.h
     function/function_fwd.h
+    function/function_ref.h
     function/function_template.h
     function/identity.h
     function/invoke.h
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<const Key, MappedType>;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+
+            //! Move constructs the element into the destination slot, the source element is destroyed right after.
+            //! The key is const in the pair, it's moved anyway since it's never observed again.
+            static AZ_FORCE_INLINE void relocate(value_type* destination, value_type& source)
+            {
+                ::new (destination) value_type(AZStd::move(const_cast<key_type&>(source.first)), AZStd::move(source.second));
+            }
+        };
+    }
+
+    /**
+     * Open addressing hash map, the elements are stored in one array of slots instead of one node per element.
+     * It has the interface of \ref unordered_map without the bucket and node handle functions, and is faster for lookups
+     * and insertions, especially with small elements. Prefer unordered_map when the elements are large, or when pointers
+     * or references to the elements need to stay valid while inserting, since growing the table moves the elements.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+        using mapped_type = MappedType;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_map()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_hash_map(size_type numElementsHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(numElementsHint);
+        }
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type numElementsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(numElementsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_map(initializer_list<value_type> list, size_type numElementsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(AZStd::max(numElementsHint, list.size()));
+            base_type::insert(list);
+        }
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator) {}
+
+        flat_hash_map(const flat_hash_map& rhs)
+            : base_type(rhs) {}
+        flat_hash_map(flat_hash_map&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        flat_hash_map(const flat_hash_map& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(rhs, allocator) {}
+        flat_hash_map(flat_hash_map&& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(AZStd::move(rhs), allocator) {}
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        //! C++17 try_emplace function that does nothing to the arguments if the key exist in the container,
+        //! otherwise it constructs the element in place with the key and arguments, without any temporary element.
+        template<class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return TryEmplace(key, AZStd::forward<Args>(arguments)...);
+        }
+        template<class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return TryEmplace(AZStd::move(key), AZStd::forward<Args>(arguments)...);
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, const key_type& key, Args&&... arguments)
+        {
+            return TryEmplace(key, AZStd::forward<Args>(arguments)...).first;
+        }
+        template<class... Args>
+        iterator try_emplace(const_iterator, key_type&& key, Args&&... arguments)
+        {
+            return TryEmplace(AZStd::move(key), AZStd::forward<Args>(arguments)...).first;
+        }
+
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            return InsertOrAssign(key, AZStd::forward<M>(value));
+        }
+        template<class M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            return InsertOrAssign(AZStd::move(key), AZStd::forward<M>(value));
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, const key_type& key, M&& value)
+        {
+            return InsertOrAssign(key, AZStd::forward<M>(value)).first;
+        }
+        template<class M>
+        iterator insert_or_assign(const_iterator, key_type&& key, M&& value)
+        {
+            return InsertOrAssign(AZStd::move(key), AZStd::forward<M>(value)).first;
+        }
+
+    private:
+        template<class KeyType, class... Args>
+        pair_iter_bool TryEmplace(KeyType&& key, Args&&... arguments)
+        {
+            return base_type::FindOrConstruct(key, [this, &key, &arguments...](pointer slot)
+            {
+                AZStd::allocator_traits<allocator_type>::construct(base_type::m_allocator, slot, AZStd::piecewise_construct,
+                    AZStd::forward_as_tuple(AZStd::forward<KeyType>(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+            });
+        }
+
+        template<class KeyType, class M>
+        pair_iter_bool InsertOrAssign(KeyType&& key, M&& value)
+        {
+            pair_iter_bool insertResult = TryEmplace(AZStd::forward<KeyType>(key), AZStd::forward<M>(value));
+            if (!insertResult.second)
+            {
+                insertResult.first->second = AZStd::forward<M>(value);
+            }
+            return insertResult;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/typetraits/type_identity.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTableTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = Key;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+
+            //! Move constructs the element into the destination slot, the source element is destroyed right after.
+            static AZ_FORCE_INLINE void relocate(value_type* destination, value_type& source)
+            {
+                ::new (destination) value_type(AZStd::move(source));
+            }
+        };
+    }
+
+    /**
+     * Open addressing hash set, the elements are stored in one array of slots instead of one node per element.
+     * It has the interface of \ref unordered_set without the bucket and node handle functions.
+     * Growing the table moves the elements, see \ref flat_hash_table for the iterator invalidation rules.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_set<Key, Hasher, EqualKey, Allocator>;
+        using base_type = flat_hash_table<Internal::FlatHashSetTableTraits<Key, Hasher, EqualKey, Allocator>>;
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_set()
+            : base_type(hasher(), key_equal(), allocator_type()) {}
+        explicit flat_hash_set(size_type numElementsHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(numElementsHint);
+        }
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type numElementsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(numElementsHint);
+            base_type::insert(first, last);
+        }
+        flat_hash_set(initializer_list<value_type> list, size_type numElementsHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(AZStd::max(numElementsHint, list.size()));
+            base_type::insert(list);
+        }
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(hasher(), key_equal(), allocator) {}
+
+        flat_hash_set(const flat_hash_set& rhs)
+            : base_type(rhs) {}
+        flat_hash_set(flat_hash_set&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+        flat_hash_set(const flat_hash_set& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(rhs, allocator) {}
+        flat_hash_set(flat_hash_set&& rhs, const type_identity_t<allocator_type>& allocator)
+            : base_type(AZStd::move(rhs), allocator) {}
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+        this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator, class Predicate>
+    decltype(auto) erase_if(flat_hash_set<Key, Hasher, EqualKey, Allocator>& container, Predicate predicate)
+    {
+        auto originalSize = container.size();
+        for (auto iter = container.begin(); iter != container.end();)
+        {
+            if (predicate(*iter))
+            {
+                iter = container.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+        return originalSize - container.size();
+    }
+} // namespace AZStd
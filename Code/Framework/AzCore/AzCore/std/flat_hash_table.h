@@ -0,0 +1,927 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/allocator_traits.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/typetraits/is_convertible.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    template<class Traits>
+    class flat_hash_table;
+
+    namespace Internal
+    {
+        //! Control bytes of the flat hash table. A full slot stores the low 7 bits of the hash of its element,
+        //! so most mismatches are rejected without comparing keys or touching the slots.
+        namespace FlatHashControl
+        {
+            using ctrl_t = signed char;
+            inline constexpr ctrl_t Empty = -128;
+            inline constexpr ctrl_t Deleted = -2;
+            //! Placed after the last control byte, so the iterators stop without knowing the capacity.
+            inline constexpr ctrl_t Sentinel = -1;
+
+            //! Number of control bytes probed at once
+            inline constexpr size_t GroupWidth = 8;
+            //! The first control bytes are copied after the sentinel, so a group starting at any slot can be loaded without wrapping.
+            inline constexpr size_t NumClonedBytes = GroupWidth - 1;
+
+            //! Control bytes shared by all the tables that have not allocated yet, so iteration doesn't need to check for it.
+            inline ctrl_t* EmptyControl()
+            {
+                alignas(16) static ctrl_t s_emptyControl[1] = { Sentinel };
+                return s_emptyControl;
+            }
+
+            //! Group of control bytes loaded in a 64 bit integer, which are matched all at once with integer operations,
+            //! so it works on all the platforms without SIMD instructions.
+            //! The masks have the high bit set for each matching control byte, the control bytes are little endian in the integer.
+            class Group
+            {
+            public:
+                using mask_type = AZ::u64;
+
+                explicit Group(const ctrl_t* ctrl)
+                {
+                    ::memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+                }
+
+                //! Full slots with the 7 bits of the hash. It can have false positives next to a real match, which the key comparison rejects.
+                mask_type Match(ctrl_t h2) const
+                {
+                    const mask_type x = m_ctrl ^ (Lsbs * static_cast<unsigned char>(h2));
+                    return (x - Lsbs) & ~x & Msbs;
+                }
+                //! Empty is the only control byte with the high bit set and the second bit cleared
+                mask_type MaskEmpty() const
+                {
+                    return m_ctrl & (~m_ctrl << 6) & Msbs;
+                }
+                //! Empty and deleted are the only control bytes with the high bit set and the low bit cleared
+                mask_type MaskEmptyOrDeleted() const
+                {
+                    return m_ctrl & (~m_ctrl << 7) & Msbs;
+                }
+
+                //! Index in the group of the first control byte of the mask
+                static size_t LowestIndex(mask_type mask)
+                {
+                    return static_cast<size_t>(az_ctz_u64(mask)) >> 3;
+                }
+                //! Number of control bytes at the end of the group before the last one of the mask
+                static size_t LeadingCount(mask_type mask)
+                {
+                    return static_cast<size_t>(az_clz_u64(mask)) >> 3;
+                }
+
+            private:
+                static constexpr mask_type Lsbs = 0x0101010101010101ull;
+                static constexpr mask_type Msbs = 0x8080808080808080ull;
+
+                mask_type m_ctrl;
+            };
+
+            //! Probes the groups quadratically, which visits every group once before repeating when the capacity is one less than a power of two.
+            struct ProbeSequence
+            {
+                ProbeSequence(size_t hash, size_t mask)
+                    : m_mask(mask)
+                    , m_offset(hash & mask)
+                {
+                }
+
+                size_t Offset(size_t index) const
+                {
+                    return (m_offset + index) & m_mask;
+                }
+                void Next()
+                {
+                    m_index += GroupWidth;
+                    m_offset = (m_offset + m_index) & m_mask;
+                }
+
+                size_t m_mask;
+                size_t m_offset;
+                size_t m_index = 0;
+            };
+        } // namespace FlatHashControl
+
+        template<class Traits, bool IsConst>
+        class flat_hash_table_iterator
+        {
+            template<class>
+            friend class AZStd::flat_hash_table;
+            friend class flat_hash_table_iterator<Traits, !IsConst>;
+
+            using ctrl_t = FlatHashControl::ctrl_t;
+
+        public:
+            using iterator_category = forward_iterator_tag;
+            using value_type = typename Traits::value_type;
+            using difference_type = AZStd::ptrdiff_t;
+            using pointer = conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = conditional_t<IsConst, const value_type&, value_type&>;
+
+            flat_hash_table_iterator() = default;
+
+            template<bool WasConst, class = enable_if_t<IsConst && !WasConst>>
+            flat_hash_table_iterator(const flat_hash_table_iterator<Traits, WasConst>& rhs)
+                : m_ctrl(rhs.m_ctrl)
+                , m_slot(rhs.m_slot)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *m_slot;
+            }
+            pointer operator->() const
+            {
+                return m_slot;
+            }
+
+            flat_hash_table_iterator& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                SkipEmptyOrDeleted();
+                return *this;
+            }
+            flat_hash_table_iterator operator++(int)
+            {
+                flat_hash_table_iterator it = *this;
+                ++*this;
+                return it;
+            }
+
+            template<bool OtherConst>
+            bool operator==(const flat_hash_table_iterator<Traits, OtherConst>& rhs) const
+            {
+                return m_ctrl == rhs.m_ctrl;
+            }
+            template<bool OtherConst>
+            bool operator!=(const flat_hash_table_iterator<Traits, OtherConst>& rhs) const
+            {
+                return m_ctrl != rhs.m_ctrl;
+            }
+
+        private:
+            flat_hash_table_iterator(const ctrl_t* ctrl, pointer slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+                SkipEmptyOrDeleted();
+            }
+
+            void SkipEmptyOrDeleted()
+            {
+                // Empty and deleted are the only control bytes below the sentinel
+                while (*m_ctrl < FlatHashControl::Sentinel)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const ctrl_t* m_ctrl = nullptr;
+            pointer m_slot = nullptr;
+        };
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table that stores its elements in a single allocation, the base of
+     * \ref flat_hash_map and \ref flat_hash_set.
+     * Each slot has a control byte holding 7 bits of the hash of its element, lookups probe the control bytes
+     * 8 at a time and only compare the keys when those bits match.
+     * Unlike the node based \ref hash_table, inserting an element doesn't allocate unless the table grows,
+     * but growing or rehashing moves the elements, which invalidates all the iterators, pointers and references.
+     * Erasing an element only invalidates the iterators, pointers and references to that element.
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using this_type = flat_hash_table<Traits>;
+        using ctrl_t = Internal::FlatHashControl::ctrl_t;
+
+    public:
+        using traits_type = Traits;
+
+        using key_type = typename Traits::key_type;
+        using key_equal = typename Traits::key_equal;
+        using hasher = typename Traits::hasher;
+        using value_type = typename Traits::value_type;
+        using allocator_type = typename Traits::allocator_type;
+
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+        using iterator = Internal::flat_hash_table_iterator<Traits, false>;
+        using const_iterator = Internal::flat_hash_table_iterator<Traits, true>;
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+        //! Smallest capacity allocated by the table, the capacities are always one less than a power of two
+        static constexpr size_type MinCapacity = 7;
+
+        flat_hash_table(const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : flat_hash_table(rhs, rhs.m_allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs, const allocator_type& allocator)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(allocator)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                InsertUnique(value);
+            }
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(AZStd::move(rhs.m_allocator))
+        {
+            StealStorage(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs, const allocator_type& allocator)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(allocator)
+        {
+            if (m_allocator == rhs.m_allocator)
+            {
+                StealStorage(rhs);
+            }
+            else
+            {
+                MoveElementsFrom(rhs);
+            }
+        }
+
+        ~flat_hash_table()
+        {
+            DestroyAndDeallocate();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                reserve(rhs.m_size);
+                for (const value_type& value : rhs)
+                {
+                    InsertUnique(value);
+                }
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                if (m_allocator == rhs.m_allocator)
+                {
+                    DestroyAndDeallocate();
+                    StealStorage(rhs);
+                }
+                else
+                {
+                    clear();
+                    MoveElementsFrom(rhs);
+                }
+            }
+            return *this;
+        }
+
+        iterator begin()
+        {
+            return iterator(m_ctrl, m_slots);
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(m_ctrl, m_slots);
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+        iterator end()
+        {
+            return iterator(m_ctrl + m_capacity, m_slots + m_capacity);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity);
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+        size_type size() const
+        {
+            return m_size;
+        }
+        size_type max_size() const
+        {
+            return AZStd::allocator_traits<allocator_type>::max_size(m_allocator) / (sizeof(value_type) + sizeof(ctrl_t));
+        }
+        //! Number of slots, the table grows when the elements and the erased slots fill 7/8 of them.
+        size_type capacity() const
+        {
+            return m_capacity;
+        }
+        float load_factor() const
+        {
+            return m_capacity != 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_allocator;
+        }
+        hasher hash_function() const
+        {
+            return m_hasher;
+        }
+        key_equal key_eq() const
+        {
+            return m_keyEqual;
+        }
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            return InsertUnique(value);
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            return InsertUnique(AZStd::move(value));
+        }
+        iterator insert(const_iterator, const value_type& value)
+        {
+            return InsertUnique(value).first;
+        }
+        iterator insert(const_iterator, value_type&& value)
+        {
+            return InsertUnique(AZStd::move(value)).first;
+        }
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                InsertUnique(*first);
+            }
+        }
+        void insert(initializer_list<value_type> list)
+        {
+            insert(list.begin(), list.end());
+        }
+
+        template<class... Args>
+        pair_iter_bool emplace(Args&&... arguments)
+        {
+            // The key is needed to find the slot, so the element is constructed first and then moved into its slot
+            return InsertUnique(value_type(AZStd::forward<Args>(arguments)...));
+        }
+        template<class... Args>
+        iterator emplace_hint(const_iterator, Args&&... arguments)
+        {
+            return emplace(AZStd::forward<Args>(arguments)...).first;
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            AZSTD_CONTAINER_ASSERT(erasePos != end(), "AZStd::flat_hash_table::erase - can't erase the end iterator");
+            const size_type index = static_cast<size_type>(erasePos.m_ctrl - m_ctrl);
+            EraseAt(index);
+            return iterator(m_ctrl + index + 1, m_slots + index + 1);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            // Erasing doesn't move the other elements, so the last iterator stays valid
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(m_ctrl + (last.m_ctrl - m_ctrl), m_slots + (last.m_ctrl - m_ctrl));
+        }
+        size_type erase(const key_type& key)
+        {
+            return EraseKey(key);
+        }
+        template<class ComparableToKey>
+        auto erase(const ComparableToKey& key)
+            -> enable_if_t<(Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value)
+                && !is_convertible_v<ComparableToKey, const_iterator>, size_type>
+        {
+            return EraseKey(key);
+        }
+
+        //! Destroys all the elements, but keeps the allocated slots
+        void clear()
+        {
+            DestroyElements();
+            if (m_capacity != 0)
+            {
+                ResetControl();
+            }
+            m_size = 0;
+        }
+
+        void swap(this_type& rhs)
+        {
+            AZStd::swap(m_ctrl, rhs.m_ctrl);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            AZStd::swap(m_allocator, rhs.m_allocator);
+        }
+
+        iterator find(const key_type& key)
+        {
+            return IteratorAt(FindIndex(key));
+        }
+        const_iterator find(const key_type& key) const
+        {
+            return ConstIteratorAt(FindIndex(key));
+        }
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, iterator>
+        {
+            return IteratorAt(FindIndex(key));
+        }
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, const_iterator>
+        {
+            return ConstIteratorAt(FindIndex(key));
+        }
+
+        bool contains(const key_type& key) const
+        {
+            return FindIndex(key) != m_capacity;
+        }
+        template<class ComparableToKey>
+        auto contains(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, bool>
+        {
+            return FindIndex(key) != m_capacity;
+        }
+
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+        template<class ComparableToKey>
+        auto count(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, size_type>
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        //! Makes room for at least numElements elements without growing.
+        void reserve(size_type numElements)
+        {
+            const size_type newCapacity = CapacityForElements(numElements);
+            if (newCapacity > m_capacity)
+            {
+                Resize(newCapacity);
+            }
+        }
+
+        //! Rehashes the elements into at least numSlots slots, which also removes the erased slots.
+        void rehash(size_type numSlots)
+        {
+            size_type newCapacity = AZStd::max(CapacityForElements(m_size), MinCapacity);
+            while (newCapacity < numSlots)
+            {
+                newCapacity = newCapacity * 2 + 1;
+            }
+            if (m_size == 0 && numSlots == 0)
+            {
+                DestroyAndDeallocate();
+                ResetToEmpty();
+            }
+            else
+            {
+                Resize(newCapacity);
+            }
+        }
+
+        bool validate() const
+        {
+            size_type fullSlots = 0;
+            for (size_type index = 0; index < m_capacity; ++index)
+            {
+                if (m_ctrl[index] >= 0)
+                {
+                    if (m_ctrl[index] != H2(Mix(m_hasher(Traits::key_from_value(m_slots[index])))))
+                    {
+                        return false;
+                    }
+                    ++fullSlots;
+                }
+            }
+            if (m_capacity != 0)
+            {
+                for (size_type index = 0; index < Internal::FlatHashControl::NumClonedBytes; ++index)
+                {
+                    if (m_ctrl[m_capacity + 1 + index] != m_ctrl[index])
+                    {
+                        return false;
+                    }
+                }
+            }
+            return fullSlots == m_size && m_ctrl[m_capacity] == Internal::FlatHashControl::Sentinel;
+        }
+
+    protected:
+        template<class ComparableToKey>
+        size_type FindIndex(const ComparableToKey& key) const
+        {
+            if (m_size == 0)
+            {
+                return m_capacity;
+            }
+
+            const size_t hash = Mix(m_hasher(key));
+            const ctrl_t h2 = H2(hash);
+            // The tables are never full, so a group with an empty slot ends the probing
+            for (Internal::FlatHashControl::ProbeSequence sequence(H1(hash), m_capacity);; sequence.Next())
+            {
+                const Group group(m_ctrl + sequence.m_offset);
+                for (auto match = group.Match(h2); match != 0; match &= match - 1)
+                {
+                    const size_type index = sequence.Offset(Group::LowestIndex(match));
+                    if (m_keyEqual(key, Traits::key_from_value(m_slots[index])))
+                    {
+                        return index;
+                    }
+                }
+                if (group.MaskEmpty() != 0)
+                {
+                    return m_capacity;
+                }
+            }
+        }
+
+        //! Finds the element with the key, or constructs one with the construct function in the slot the key belongs to.
+        template<class ComparableToKey, class ConstructFunction>
+        pair_iter_bool FindOrConstruct(const ComparableToKey& key, ConstructFunction&& constructFunction)
+        {
+            const size_t hash = Mix(m_hasher(key));
+            const ctrl_t h2 = H2(hash);
+            size_type insertIndex = m_capacity;
+            if (m_capacity != 0)
+            {
+                for (Internal::FlatHashControl::ProbeSequence sequence(H1(hash), m_capacity);; sequence.Next())
+                {
+                    const Group group(m_ctrl + sequence.m_offset);
+                    for (auto match = group.Match(h2); match != 0; match &= match - 1)
+                    {
+                        const size_type index = sequence.Offset(Group::LowestIndex(match));
+                        if (m_keyEqual(key, Traits::key_from_value(m_slots[index])))
+                        {
+                            return { IteratorAt(index), false };
+                        }
+                    }
+                    if (group.MaskEmpty() != 0)
+                    {
+                        break;
+                    }
+                }
+                // The first empty or erased slot of the probe sequence
+                insertIndex = FindFirstNonFull(hash);
+            }
+
+            // Reusing an erased slot doesn't use up any growth
+            if (insertIndex == m_capacity || m_ctrl[insertIndex] == Internal::FlatHashControl::Empty)
+            {
+                if (m_growthLeft == 0)
+                {
+                    GrowOrPurge();
+                    insertIndex = FindFirstNonFull(hash);
+                }
+                --m_growthLeft;
+            }
+
+            SetCtrl(insertIndex, h2);
+            ++m_size;
+            constructFunction(m_slots + insertIndex);
+            return { IteratorAt(insertIndex), true };
+        }
+
+        template<class Value>
+        pair_iter_bool InsertUnique(Value&& value)
+        {
+            return FindOrConstruct(Traits::key_from_value(value), [this, &value](pointer slot)
+            {
+                AZStd::allocator_traits<allocator_type>::construct(m_allocator, slot, AZStd::forward<Value>(value));
+            });
+        }
+
+        iterator IteratorAt(size_type index)
+        {
+            return iterator(m_ctrl + index, m_slots + index);
+        }
+        const_iterator ConstIteratorAt(size_type index) const
+        {
+            return const_iterator(m_ctrl + index, m_slots + index);
+        }
+
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+
+    private:
+        using Group = Internal::FlatHashControl::Group;
+
+        static size_t Mix(size_t hash)
+        {
+            // Many hashers, such as the integer ones, return the value itself. Multiplying spreads them
+            // over all the bits, so both the slot index and the 7 bits kept in the control bytes differ.
+            constexpr size_t Multiplier = static_cast<size_t>(0x9E3779B97F4A7C15ull);
+            hash *= Multiplier;
+            return hash ^ (hash >> (sizeof(size_t) * 4));
+        }
+        static size_type H1(size_t hash)
+        {
+            return hash >> 7;
+        }
+        static ctrl_t H2(size_t hash)
+        {
+            return static_cast<ctrl_t>(hash & 0x7F);
+        }
+
+        //! Number of elements and erased slots the capacity can hold before the table grows, 7/8 of the slots.
+        //! At least one slot stays empty, so the probing always ends.
+        static size_type CapacityToGrowth(size_type capacity)
+        {
+            return capacity - (capacity + 1) / 8;
+        }
+        static size_type CapacityForElements(size_type numElements)
+        {
+            if (numElements == 0)
+            {
+                return 0;
+            }
+            size_type capacity = MinCapacity;
+            while (CapacityToGrowth(capacity) < numElements)
+            {
+                capacity = capacity * 2 + 1;
+            }
+            return capacity;
+        }
+
+        static size_type SlotsOffset(size_type capacity)
+        {
+            // The control bytes, the sentinel and the cloned control bytes are placed before the slots
+            return (capacity + Internal::FlatHashControl::GroupWidth + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+        }
+        static size_type AllocationSize(size_type capacity)
+        {
+            return SlotsOffset(capacity) + capacity * sizeof(value_type);
+        }
+        static constexpr size_type AllocationAlignment = alignof(value_type) > 16 ? alignof(value_type) : 16;
+
+        size_type FindFirstNonFull(size_t hash) const
+        {
+            for (Internal::FlatHashControl::ProbeSequence sequence(H1(hash), m_capacity);; sequence.Next())
+            {
+                if (const auto mask = Group(m_ctrl + sequence.m_offset).MaskEmptyOrDeleted(); mask != 0)
+                {
+                    return sequence.Offset(Group::LowestIndex(mask));
+                }
+            }
+        }
+
+        void GrowOrPurge()
+        {
+            if (m_capacity == 0)
+            {
+                Resize(MinCapacity);
+            }
+            else if (m_size <= CapacityToGrowth(m_capacity) / 2)
+            {
+                // Most of the growth was used up by erased slots, rehashing in place is enough to get rid of them
+                Resize(m_capacity);
+            }
+            else
+            {
+                Resize(m_capacity * 2 + 1);
+            }
+        }
+
+        void Resize(size_type newCapacity)
+        {
+            ctrl_t* oldCtrl = m_ctrl;
+            pointer oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            auto* memory = static_cast<unsigned char*>(m_allocator.allocate(AllocationSize(newCapacity), AllocationAlignment));
+            m_ctrl = reinterpret_cast<ctrl_t*>(memory);
+            m_slots = reinterpret_cast<pointer>(memory + SlotsOffset(newCapacity));
+            m_capacity = newCapacity;
+            ResetControl();
+
+            for (size_type index = 0; index < oldCapacity; ++index)
+            {
+                if (oldCtrl[index] >= 0)
+                {
+                    const size_t hash = Mix(m_hasher(Traits::key_from_value(oldSlots[index])));
+                    const size_type newIndex = FindFirstNonFull(hash);
+                    SetCtrl(newIndex, H2(hash));
+                    Traits::relocate(m_slots + newIndex, oldSlots[index]);
+                    AZStd::allocator_traits<allocator_type>::destroy(m_allocator, oldSlots + index);
+                }
+            }
+            m_growthLeft -= m_size;
+
+            if (oldCapacity != 0)
+            {
+                m_allocator.deallocate(oldCtrl, AllocationSize(oldCapacity), AllocationAlignment);
+            }
+        }
+
+        //! Marks all the slots as empty
+        void ResetControl()
+        {
+            ::memset(m_ctrl, Internal::FlatHashControl::Empty, m_capacity + Internal::FlatHashControl::GroupWidth);
+            m_ctrl[m_capacity] = Internal::FlatHashControl::Sentinel;
+            m_growthLeft = CapacityToGrowth(m_capacity);
+        }
+
+        //! Sets the control byte of the slot and its clone after the sentinel, the slots past the clones write themselves twice.
+        void SetCtrl(size_type index, ctrl_t ctrl)
+        {
+            constexpr size_type NumClonedBytes = Internal::FlatHashControl::NumClonedBytes;
+            m_ctrl[index] = ctrl;
+            m_ctrl[((index - NumClonedBytes) & m_capacity) + NumClonedBytes] = ctrl;
+        }
+
+        void EraseAt(size_type index)
+        {
+            AZStd::allocator_traits<allocator_type>::destroy(m_allocator, m_slots + index);
+            --m_size;
+            // If the slot is in a run of less than a group of full slots, every probe that reached it also saw an
+            // empty slot and stopped, so it can go back to empty. Otherwise it's marked as deleted, so the lookups
+            // of the elements after it keep probing.
+            const size_type indexBefore = (index - Internal::FlatHashControl::GroupWidth) & m_capacity;
+            const auto emptyAfter = Group(m_ctrl + index).MaskEmpty();
+            const auto emptyBefore = Group(m_ctrl + indexBefore).MaskEmpty();
+            if (emptyAfter != 0 && emptyBefore != 0 &&
+                Group::LowestIndex(emptyAfter) + Group::LeadingCount(emptyBefore) < Internal::FlatHashControl::GroupWidth)
+            {
+                SetCtrl(index, Internal::FlatHashControl::Empty);
+                ++m_growthLeft;
+            }
+            else
+            {
+                SetCtrl(index, Internal::FlatHashControl::Deleted);
+            }
+        }
+
+        template<class ComparableToKey>
+        size_type EraseKey(const ComparableToKey& key)
+        {
+            const size_type index = FindIndex(key);
+            if (index == m_capacity)
+            {
+                return 0;
+            }
+            EraseAt(index);
+            return 1;
+        }
+
+        void DestroyElements()
+        {
+            if constexpr (!is_trivially_destructible_v<value_type>)
+            {
+                for (size_type index = 0; index < m_capacity; ++index)
+                {
+                    if (m_ctrl[index] >= 0)
+                    {
+                        AZStd::allocator_traits<allocator_type>::destroy(m_allocator, m_slots + index);
+                    }
+                }
+            }
+        }
+
+        void DestroyAndDeallocate()
+        {
+            DestroyElements();
+            if (m_capacity != 0)
+            {
+                m_allocator.deallocate(m_ctrl, AllocationSize(m_capacity), AllocationAlignment);
+            }
+        }
+
+        void ResetToEmpty()
+        {
+            m_ctrl = Internal::FlatHashControl::EmptyControl();
+            m_slots = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        void StealStorage(flat_hash_table& rhs)
+        {
+            m_ctrl = rhs.m_ctrl;
+            m_slots = rhs.m_slots;
+            m_size = rhs.m_size;
+            m_capacity = rhs.m_capacity;
+            m_growthLeft = rhs.m_growthLeft;
+            rhs.ResetToEmpty();
+        }
+
+        void MoveElementsFrom(flat_hash_table& rhs)
+        {
+            reserve(rhs.m_size);
+            for (value_type& value : rhs)
+            {
+                InsertUnique(AZStd::move(value));
+            }
+            rhs.clear();
+        }
+
+        ctrl_t* m_ctrl = Internal::FlatHashControl::EmptyControl();
+        pointer m_slots = nullptr;
+        size_type m_size = 0;
+        size_type m_capacity = 0;
+        size_type m_growthLeft = 0;
+    };
+
+    template<class Traits>
+    bool operator==(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (const auto& value : lhs)
+        {
+            auto rhsIt = rhs.find(Traits::key_from_value(value));
+            if (rhsIt == rhs.end() || !(*rhsIt == value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Traits>
+    bool operator!=(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+} // namespace AZStd
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/is_function.h>
+#include <AzCore/std/typetraits/remove_cvref.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    template<class Signature>
+    class function_ref;
+
+    /**
+     * Non owning reference to a callable, based on the C++26 std::function_ref.
+     * Unlike AZStd::function it never allocates and never copies the callable, it only stores a pointer to it
+     * and a pointer to the function that invokes it. This makes it the preferred type for callback parameters
+     * that are only called before the function returns, such as the enumerate callbacks.
+     * The callable must outlive the function_ref, so it should not be stored or returned.
+     */
+    template<class R, class... Args>
+    class function_ref<R(Args...)>
+    {
+    public:
+        //! References a function
+        template<class F, class = enable_if_t<is_function_v<F> && is_invocable_r_v<R, F&, Args...>>>
+        function_ref(F* function) noexcept
+            : m_invoke([](Storage storage, Args... arguments) -> R
+                {
+                    return Invoke(reinterpret_cast<F*>(storage.m_function), AZStd::forward<Args>(arguments)...);
+                })
+        {
+            m_storage.m_function = reinterpret_cast<void (*)()>(function);
+        }
+
+        //! References a callable object, such as a lambda or an AZStd::function.
+        template<class F, class T = remove_reference_t<F>, class = enable_if_t<
+            !is_same_v<remove_cvref_t<F>, function_ref> && !is_function_v<T> && !is_pointer_v<T> && is_invocable_r_v<R, T&, Args...>>>
+        function_ref(F&& callable) noexcept
+            : m_invoke([](Storage storage, Args... arguments) -> R
+                {
+                    return Invoke(*static_cast<T*>(storage.m_object), AZStd::forward<Args>(arguments)...);
+                })
+        {
+            m_storage.m_object = const_cast<void*>(static_cast<const void*>(AZStd::addressof(callable)));
+        }
+
+        function_ref(const function_ref&) noexcept = default;
+        function_ref& operator=(const function_ref&) noexcept = default;
+
+        R operator()(Args... arguments) const
+        {
+            return m_invoke(m_storage, AZStd::forward<Args>(arguments)...);
+        }
+
+    private:
+        //! Discards the result of the callable when the function_ref returns void
+        template<class F>
+        static R Invoke(F&& callable, Args... arguments)
+        {
+            if constexpr (is_void_v<R>)
+            {
+                AZStd::invoke(AZStd::forward<F>(callable), AZStd::forward<Args>(arguments)...);
+            }
+            else
+            {
+                return AZStd::invoke(AZStd::forward<F>(callable), AZStd::forward<Args>(arguments)...);
+            }
+        }
+
+        //! Object pointers can't hold function pointers on all the platforms
+        union Storage
+        {
+            void* m_object;
+            void (*m_function)();
+        };
+
+        Storage m_storage;
+        R (*m_invoke)(Storage, Args...);
+    };
+
+    template<class R, class... Args>
+    function_ref(R (*)(Args...)) -> function_ref<R(Args...)>;
+} // namespace AZStd
@@ -99,4 +99,5 @@ ly_add_source_properties(
     SOURCES ${CMAKE_CURRENT_LIST_DIR}/../../AzCore/Math/IntersectSegment.cpp
     PROPERTY COMPILE_OPTIONS
     VALUES -fno-fast-math -Wno-overriding-t-option
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
 )
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Threading
+{
+    AZStd::vector<CacheDomain> GetLastLevelCacheDomains()
+    {
+        // Cache topology isn't queried on this platform, treat all the cores as sharing one cache.
+        CacheDomain domain;
+        for (uint32_t core = 0; core < AZStd::thread::hardware_concurrency(); ++core)
+        {
+            domain.push_back(core);
+        }
+        AZStd::vector<CacheDomain> domains;
+        domains.push_back(AZStd::move(domain));
+        return domains;
+    }
+
+    bool PinCurrentThreadToCore([[maybe_unused]] uint32_t logicalCore)
+    {
+        return false;
+    }
+} // namespace AZ::Threading
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        // The generic drive is always added at the end of the stack so requests the io_uring drive can't service, such as
+        // files that fail to open, still have a place to go.
+        if (!parent)
+        {
+            parent = AZStd::make_shared<StorageDrive>(m_fallbackMaxFileHandles);
+        }
+
+        if (!StorageDriveLinux::IsSupported())
+        {
+            AZ_Warning("Streamer", false, "The kernel doesn't support the required io_uring features. Using the generic storage drive.\n");
+            return parent;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableDirectIo = m_enableDirectIo;
+        options.m_minimalReporting = m_minimalReporting;
+
+        size_t physicalSectorSize = hardware.m_maxPhysicalSectorSize;
+        size_t logicalSectorSize = hardware.m_maxLogicalSectorSize;
+        if (const DriveInformation* drive = AZStd::any_cast<DriveInformation>(&hardware.m_platformData); drive != nullptr)
+        {
+            options.m_hasSeekPenalty = drive->m_hasSeekPenalty;
+            physicalSectorSize = drive->m_physicalSectorSize;
+            logicalSectorSize = drive->m_logicalSectorSize;
+        }
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, m_maxMetaDataCache, physicalSectorSize,
+            logicalSectorSize, m_queueDepth, m_overcommit, m_registeredBufferCount, m_registeredBufferSize, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("RegisteredBufferCount", &LinuxStorageDriveConfig::m_registeredBufferCount)
+                ->Field("RegisteredBufferSize", &LinuxStorageDriveConfig::m_registeredBufferSize)
+                ->Field("FallbackMaxFileHandles", &LinuxStorageDriveConfig::m_fallbackMaxFileHandles)
+                ->Field("EnableDirectIo", &LinuxStorageDriveConfig::m_enableDirectIo)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{6B0E5A4C-2F3D-4C61-9E7B-8A1D3C5F7E92}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::s32 m_overcommit{ 8 };
+        AZ::u32 m_queueDepth{ 32 };
+        AZ::u32 m_registeredBufferCount{ 16 };
+        AZ::u32 m_registeredBufferSize{ 256 * 1024 };
+        //! The number of file handles used by the generic drive that's placed after the io_uring drive to pick up
+        //! requests it can't service, or that's used instead if io_uring isn't available.
+        AZ::u32 m_fallbackMaxFileHandles{ 32 };
+        bool m_enableDirectIo{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1555 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    static constexpr char RegisteredBufferReadsName[] = "Registered buffer reads";
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    // glibc doesn't provide wrappers for the io_uring system calls, so call into the kernel directly.
+    static int IoUringSetup(u32 entries, io_uring_params* params)
+    {
+        return aznumeric_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    static int IoUringEnter(int ringFd, u32 toSubmit, u32 minComplete, u32 flags)
+    {
+        return aznumeric_cast<int>(syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    static int IoUringRegister(int ringFd, u32 opcode, const void* arg, u32 argCount)
+    {
+        return aznumeric_cast<int>(syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+    }
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableDirectIo(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize,
+        ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a queue depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        if (InitializeRing())
+        {
+            RegisterBuffers(registeredBufferCount, registeredBufferSize);
+            if (!m_constructionOptions.m_minimalReporting)
+            {
+                AZ_Printf("Streamer", "%s created with a queue depth of %u and %u registered buffers.\n",
+                    m_name.c_str(), m_queueDepth, m_registeredBufferCount);
+            }
+        }
+        else
+        {
+            AZ_Warning("StorageDriveLinux", false, "Failed to create the io_uring instance for %s. All requests will be forwarded.\n",
+                m_name.c_str());
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        if (m_eventFdRegistered)
+        {
+            m_context->GetStreamerThreadSynchronizer().UnregisterIoEventFd(m_eventFd);
+        }
+        // Closing the ring doesn't wait for in-flight operations, so any outstanding reads need to be canceled and reaped
+        // before the buffers they're writing to are released.
+        DrainRing();
+        ShutdownRing();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            m_readSlots_readInfo[i].Clear();
+        }
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        io_uring_params params{};
+        int ringFd = IoUringSetup(1, &params);
+        if (ringFd < 0)
+        {
+            return false;
+        }
+
+        // Besides the ring itself, plain reads and cancellation are required. Both need at least a 5.6 kernel.
+        constexpr size_t OpCount = IORING_OP_LAST;
+        constexpr size_t ProbeSize = sizeof(io_uring_probe) + OpCount * sizeof(io_uring_probe_op);
+        alignas(io_uring_probe) u8 probeBuffer[ProbeSize]{};
+        auto probe = reinterpret_cast<io_uring_probe*>(probeBuffer);
+        bool isSupported = false;
+        if (IoUringRegister(ringFd, IORING_REGISTER_PROBE, probe, OpCount) == 0)
+        {
+            auto isOpSupported = [probe](u32 op)
+            {
+                return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+            };
+            isSupported = isOpSupported(IORING_OP_READ) && isOpSupported(IORING_OP_READ_FIXED) && isOpSupported(IORING_OP_ASYNC_CANCEL);
+        }
+        ::close(ringFd);
+        return isSupported;
+    }
+
+    bool StorageDriveLinux::InitializeRing()
+    {
+        io_uring_params params{};
+        // Leave room in the completion queue for the cancel operations that can be queued next to the reads.
+        params.flags = IORING_SETUP_CQSIZE;
+        params.cq_entries = m_queueDepth * 2;
+        m_ringFd = IoUringSetup(m_queueDepth, &params);
+        if (m_ringFd < 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "io_uring_setup failed with error: %i\n", errno);
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+            IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            ShutdownRing();
+            return false;
+        }
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+                IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                ShutdownRing();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* entries = mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd,
+            IORING_OFF_SQES);
+        if (entries == MAP_FAILED)
+        {
+            ShutdownRing();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(entries);
+
+        u8* submissionRing = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRing + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRing + params.sq_off.tail);
+        m_submissionArray = reinterpret_cast<u32*>(submissionRing + params.sq_off.array);
+        m_submissionMask = *reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_mask);
+        m_submissionEntryCount = params.sq_entries;
+        m_submissionLocalTail = *m_submissionTail;
+
+        u8* completionRing = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRing + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRing + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completionRing + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+        // The kernel may have rounded up the number of entries. Reads are limited to what the submission queue can hold.
+        m_queueDepth = AZStd::min(m_queueDepth, m_submissionEntryCount);
+
+        m_eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (m_eventFd < 0 || IoUringRegister(m_ringFd, IORING_REGISTER_EVENTFD, &m_eventFd, 1) != 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Unable to attach a completion event to the io_uring instance (Error: %i).\n", errno);
+            ShutdownRing();
+            return false;
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::ShutdownRing()
+    {
+        if (m_submissionEntries)
+        {
+            munmap(m_submissionEntries, m_submissionEntriesSize);
+            m_submissionEntries = nullptr;
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            munmap(m_completionRing, m_completionRingSize);
+        }
+        m_completionRing = nullptr;
+        if (m_submissionRing)
+        {
+            munmap(m_submissionRing, m_submissionRingSize);
+            m_submissionRing = nullptr;
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+            m_ringFd = -1;
+        }
+        if (m_eventFd >= 0)
+        {
+            ::close(m_eventFd);
+            m_eventFd = -1;
+        }
+        if (m_registeredBuffers)
+        {
+            azfree(m_registeredBuffers, AZ::SystemAllocator);
+            m_registeredBuffers = nullptr;
+        }
+        m_registeredBuffers_free.clear();
+        m_registeredBufferCount = 0;
+    }
+
+    void StorageDriveLinux::DrainRing()
+    {
+        if (m_ringFd < 0)
+        {
+            return;
+        }
+
+        // Reads waiting for a resubmit don't have an operation in the kernel, all other active reads do.
+        u32 outstandingReads = 0;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (!m_readSlots_active[readSlot] || m_readSlots_resubmitPending[readSlot])
+            {
+                continue;
+            }
+            outstandingReads++;
+
+            if (!m_readSlots_cancelRequested[readSlot])
+            {
+                io_uring_sqe* entry = GetSubmissionEntry();
+                if (!entry)
+                {
+                    SubmitQueuedEntries();
+                    entry = GetSubmissionEntry();
+                }
+                if (entry)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserData;
+                    m_readSlots_cancelRequested[readSlot] = true;
+                }
+                // If no entry is available the read is still waited on below, it just won't be cut short.
+            }
+        }
+
+        __atomic_store_n(m_submissionTail, m_submissionLocalTail, __ATOMIC_RELEASE);
+        while (outstandingReads > 0)
+        {
+            const int result = IoUringEnter(m_ringFd, m_queuedSubmissions, 1, IORING_ENTER_GETEVENTS);
+            if (result < 0)
+            {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                {
+                    continue;
+                }
+                AZ_Error("StorageDriveLinux", false, "Unable to wait for %u outstanding reads on %s (Error: %i).\n",
+                    outstandingReads, m_name.c_str(), errno);
+                return;
+            }
+            m_queuedSubmissions -= AZStd::min(m_queuedSubmissions, aznumeric_cast<u32>(result));
+
+            u32 head = *m_completionHead;
+            const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+            while (head != tail)
+            {
+                const u64 userData = m_completionEntries[head & m_completionMask].user_data;
+                head++;
+                if (userData != CancelUserData)
+                {
+                    // Requests aren't completed here as the scheduler is shutting down, only the read slot is released.
+                    m_readSlots_active[aznumeric_cast<size_t>(userData)] = false;
+                    outstandingReads--;
+                }
+            }
+            __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+        }
+    }
+
+    void StorageDriveLinux::RegisterBuffers(u32 count, size_t size)
+    {
+        if (count == 0 || size == 0)
+        {
+            return;
+        }
+
+        size = AZ_SIZE_ALIGN_UP(size, m_physicalSectorSize);
+        m_registeredBuffers = azmalloc(count * size, m_physicalSectorSize, AZ::SystemAllocator);
+
+        AZStd::vector<iovec> buffers;
+        buffers.resize(count);
+        u8* memory = reinterpret_cast<u8*>(m_registeredBuffers);
+        for (u32 i = 0; i < count; ++i)
+        {
+            buffers[i].iov_base = memory + (i * size);
+            buffers[i].iov_len = size;
+        }
+
+        if (IoUringRegister(m_ringFd, IORING_REGISTER_BUFFERS, buffers.data(), count) != 0)
+        {
+            // This typically happens when the locked memory limit (RLIMIT_MEMLOCK) is too low. The drive still works, but
+            // realigned reads will use temporary allocations instead.
+            AZ_Warning("StorageDriveLinux", false, "Unable to register %u buffers of %zu bytes with io_uring (Error: %i).\n",
+                count, size, errno);
+            azfree(m_registeredBuffers, AZ::SystemAllocator);
+            m_registeredBuffers = nullptr;
+            return;
+        }
+
+        m_registeredBufferCount = count;
+        m_registeredBufferSize = size;
+        m_registeredBuffers_free.reserve(count);
+        for (u32 i = count; i > 0; --i)
+        {
+            m_registeredBuffers_free.push_back(i - 1);
+        }
+    }
+
+    io_uring_sqe* StorageDriveLinux::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_submissionLocalTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_submissionLocalTail & m_submissionMask;
+        m_submissionArray[index] = index;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionLocalTail++;
+        m_queuedSubmissions++;
+        return entry;
+    }
+
+    void StorageDriveLinux::PrepareReadEntry(io_uring_sqe* entry, size_t readSlot)
+    {
+        const FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        AZ_Assert(readInfo.m_bytesRead < readInfo.m_readSize, "Read entry requested for a read that has already completed.");
+
+        const bool isFixed = readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex;
+        entry->opcode = isFixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        entry->fd = m_fileCache_handles[readInfo.m_fileHandleIndex];
+        entry->off = readInfo.m_readOffset + readInfo.m_bytesRead;
+        entry->addr = reinterpret_cast<u64>(readInfo.m_readBuffer + readInfo.m_bytesRead);
+        entry->len = aznumeric_cast<u32>(readInfo.m_readSize - readInfo.m_bytesRead);
+        entry->buf_index = isFixed ? aznumeric_cast<u16>(readInfo.m_registeredBufferIndex) : 0;
+        entry->user_data = readSlot;
+    }
+
+    void StorageDriveLinux::SubmitQueuedEntries()
+    {
+        if (m_queuedSubmissions == 0)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::SubmitQueuedEntries %s", m_name.c_str());
+
+        __atomic_store_n(m_submissionTail, m_submissionLocalTail, __ATOMIC_RELEASE);
+        int result;
+        do
+        {
+            result = IoUringEnter(m_ringFd, m_queuedSubmissions, 0, 0);
+        } while (result < 0 && errno == EINTR);
+
+        if (result >= 0)
+        {
+            m_submissionsPerCallAverage.PushEntry(aznumeric_cast<u64>(result));
+            m_queuedSubmissions -= AZStd::min(m_queuedSubmissions, aznumeric_cast<u32>(result));
+        }
+        else if (errno != EAGAIN && errno != EBUSY)
+        {
+            AZ_Error("StorageDriveLinux", false, "io_uring_enter failed with error: %i\n", errno);
+        }
+        // On EAGAIN/EBUSY the kernel is temporarily out of resources. The entries remain in the ring and will be submitted
+        // on the next call.
+    }
+
+    void StorageDriveLinux::SetContext(StreamerContext& context)
+    {
+        StreamStackEntry::SetContext(context);
+        if (m_eventFd >= 0 && !m_eventFdRegistered)
+        {
+            m_eventFdRegistered = m_context->GetStreamerThreadSynchronizer().RegisterIoEventFd(m_eventFd);
+            AZ_Error("StorageDriveLinux", m_eventFdRegistered,
+                "Unable to register the completion event for %s. Completed reads will only be picked up when the scheduler wakes up.",
+                m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (m_ringFd >= 0 && AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (m_ringFd < 0)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (m_ringFd < 0)
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Queue as many reads as there are free slots. These are all submitted to the kernel in a single call below.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+        SubmitQueuedEntries();
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand()) || hasWorked;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (m_ringFd < 0)
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData> ||
+                AZStd::is_same_v<Command, Requests::CompressedReadData> ||
+                AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file >= 0, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                bool directIo = m_constructionOptions.m_enableDirectIo;
+                file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC | (directIo ? O_DIRECT : 0));
+                if (file < 0 && directIo && errno == EINVAL)
+                {
+                    // Not all file systems support O_DIRECT (e.g. tmpfs), so fall back to buffered reads for these.
+                    directIo = false;
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+                m_fileCache_directIo[cacheIndex] = directIo;
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_directIo.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+            m_readSlots_cancelRequested.resize(m_queueDepth);
+            m_readSlots_resubmitPending.resize(m_queueDepth);
+
+            m_cachesInitialized = true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = GetSubmissionEntry();
+        if (!entry)
+        {
+            // The submission queue is full with pending cancellations. Try again after they've been submitted.
+            return false;
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        u8* output = reinterpret_cast<u8*>(data->m_output);
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_directIo[fileCacheSlot])
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, make adjustments and use an aligned intermediate buffer.
+            // See StorageDriveWin::ReadRequest for a detailed explanation of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSize <= m_registeredBufferSize && !m_registeredBuffers_free.empty())
+                {
+                    readInfo.m_registeredBufferIndex = m_registeredBuffers_free.back();
+                    m_registeredBuffers_free.pop_back();
+                    output = reinterpret_cast<u8*>(m_registeredBuffers) + (readInfo.m_registeredBufferIndex * m_registeredBufferSize);
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = reinterpret_cast<u8*>(readInfo.m_sectorAlignedOutput);
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+        m_registeredBufferReadsPercentageStat.PushSample(
+            readInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex ? 1.0 : 0.0);
+
+        AZ_Assert(readSize <= std::numeric_limits<u32>::max(), "Read of %llu bytes is larger than io_uring supports in a single read.",
+            readSize);
+        readInfo.m_readBuffer = output;
+        readInfo.m_readOffset = readOffs;
+        readInfo.m_readSize = aznumeric_cast<u32>(readSize);
+        PrepareReadEntry(entry, readSlot);
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+        m_readSlots_cancelRequested[readSlot] = false;
+        m_readSlots_resubmitPending[readSlot] = false;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads and ask the kernel to cancel them.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && !m_readSlots_cancelRequested[readSlot] &&
+                m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+
+                if (m_readSlots_resubmitPending[readSlot])
+                {
+                    // There's no operation in the kernel to cancel. The read will be finalized as canceled instead of resubmitted.
+                    m_readSlots_cancelRequested[readSlot] = true;
+                    continue;
+                }
+
+                io_uring_sqe* entry = GetSubmissionEntry();
+                if (!entry)
+                {
+                    SubmitQueuedEntries();
+                    entry = GetSubmissionEntry();
+                }
+                if (entry)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelUserData;
+                    m_readSlots_cancelRequested[readSlot] = true;
+                }
+                else
+                {
+                    AZ_Warning("StorageDriveLinux", false, "Unable to queue cancellation of a read as the submission queue is full.\n");
+                }
+            }
+        }
+        SubmitQueuedEntries();
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStats;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileStats) == 0)
+        {
+            if (S_ISREG(fileStats.st_mode))
+            {
+                size_t cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStats.st_size);
+                fileExists.m_found = true;
+            }
+            else
+            {
+                // The path exists but isn't a regular file, such as a directory.
+                fileExists.m_found = false;
+            }
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStats;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        const int result = (cacheIndex != InvalidFileCacheIndex)
+            ? ::fstat(m_fileCache_handles[cacheIndex], &fileStats)
+            : ::stat(command.m_path.GetAbsolutePathCStr(), &fileStats);
+        if (result != 0 || !S_ISREG(fileStats.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStats.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Reset the completion event before reaping so any completion that arrives afterwards wakes up the scheduler again.
+        // This is done even without active reads as completed cancellations also signal the event.
+        eventfd_t eventCount;
+        [[maybe_unused]] int eventResult = eventfd_read(m_eventFd, &eventCount);
+
+        bool hasWorked = false;
+        u32 head = *m_completionHead;
+        const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = m_completionEntries[head & m_completionMask];
+            const u64 userData = completion.user_data;
+            const s32 result = completion.res;
+            head++;
+            // Release the entry before handling it as the handling can queue new entries.
+            __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+
+            if (userData != CancelUserData)
+            {
+                FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+                hasWorked = true;
+            }
+        }
+        hasWorked = ResubmitPartialReads() || hasWorked;
+        // Submit any reads that were requeued because they only partially completed.
+        SubmitQueuedEntries();
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+            "io_uring returned a completion for read slot %zu which isn't active.", readSlot);
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        const bool isCanceled = m_readSlots_cancelRequested[readSlot] && (result == -ECANCELED || result == -EINTR);
+        const bool encounteredError = !isCanceled && result < 0;
+        if (encounteredError)
+        {
+            AZ_Error("StorageDriveLinux", false, "Async file read operation for '%s' failed with error %i\n",
+                readCommand->m_path.GetRelativePath(), -result);
+        }
+
+        const size_t requiredBytes = fileReadInfo.m_copyBackOffset + readCommand->m_size;
+        if (result > 0)
+        {
+            fileReadInfo.m_bytesRead += aznumeric_cast<size_t>(result);
+            m_activeReads_ByteCount += aznumeric_cast<size_t>(result);
+
+            // Reads are allowed to return less than requested, so queue the remainder unless the end of the file was reached.
+            if (fileReadInfo.m_bytesRead < requiredBytes && !m_readSlots_cancelRequested[readSlot])
+            {
+                io_uring_sqe* entry = GetSubmissionEntry();
+                if (entry)
+                {
+                    PrepareReadEntry(entry, readSlot);
+                }
+                else
+                {
+                    // The submission queue is full, so keep the read active and try again on the next cycle.
+                    m_readSlots_resubmitPending[readSlot] = true;
+                }
+                return;
+            }
+        }
+
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && !isCanceled && (requiredBytes <= fileReadInfo.m_bytesRead);
+        if (isSuccess && fileReadInfo.m_readBuffer != readCommand->m_output)
+        {
+            ::memcpy(readCommand->m_output, fileReadInfo.m_readBuffer + fileReadInfo.m_copyBackOffset, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        if (fileReadInfo.m_registeredBufferIndex != InvalidRegisteredBufferIndex)
+        {
+            m_registeredBuffers_free.push_back(fileReadInfo.m_registeredBufferIndex);
+        }
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        m_readSlots_cancelRequested[readSlot] = false;
+        m_readSlots_resubmitPending[readSlot] = false;
+        fileReadInfo.Clear();
+
+        // There's now a slot available to queue the next request, if there is one.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    bool StorageDriveLinux::ResubmitPartialReads()
+    {
+        bool hasWorked = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_resubmitPending.size(); ++readSlot)
+        {
+            if (!m_readSlots_resubmitPending[readSlot])
+            {
+                continue;
+            }
+
+            if (m_readSlots_cancelRequested[readSlot])
+            {
+                FinalizeSingleRequest(readSlot, -ECANCELED);
+                hasWorked = true;
+                continue;
+            }
+
+            io_uring_sqe* entry = GetSubmissionEntry();
+            if (!entry)
+            {
+                break;
+            }
+            PrepareReadEntry(entry, readSlot);
+            m_readSlots_resubmitPending[readSlot] = false;
+            hasWorked = true;
+        }
+        return hasWorked;
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed in megabytes per second this drive achieved. This is the maximum achievable speed for reading from "
+                "disk. If this is lower than expected it may indicate that there's an overhead from the operating system, the drive has "
+                "seen a lot of use or other applications are using the same drive. Disabling direct IO through the Settings Registry "
+                "can increase the read speeds as the page cache is used, but this will typically only accelerate files that are read "
+                "multiple times and will be slower for the first read."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Queue depth in use", m_activeReads_Count,
+                "The number of reads that are currently in flight in the kernel. If this is often at the configured queue depth the "
+                "drive may benefit from a larger queue depth."));
+            statistics.push_back(Statistic::CreateFloat(m_name, "Submissions per call", m_submissionsPerCallAverage.CalculateAverage(),
+                "The average number of operations handed to the kernel per system call. Higher numbers mean the cost of the system "
+                "call is shared between more reads."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, RegisteredBufferReadsName, m_registeredBufferReadsPercentageStat.GetAverage(),
+                m_registeredBufferReadsPercentageStat.GetMinimum(), m_registeredBufferReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that were realigned through one of the buffers registered with the kernel. Reads that need "
+                "realigning but can't use a registered buffer require a temporary allocation. Increasing the number or size of "
+                "registered buffers can help if this is low while direct reads are also low."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                "performance will suffer as intermediate buffers need to be used. The best way to avoid this is by adding a "
+                "block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            {
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max file handles", m_maxFileHandles,
+                    "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                    "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                    "that can be in use at the same time."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                    "The maximum number of meta data like file sizes this drive node will cache."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Physical sector size", m_physicalSectorSize,
+                    "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                    "this value."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Logical sector size", m_logicalSectorSize,
+                    "The sector size used by the operating system. Direct reads need their offset and size aligned to this value."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Queue depth", m_queueDepth, "The number of reads that can be in flight in the kernel at the same time."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Overcommit", m_overCommit,
+                    "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                    "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                    "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                    "poorer hardware and software cache performance and slower cancellations, among others."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Registered buffers", m_registeredBufferCount,
+                    "The number of intermediate buffers registered with the kernel for realigning reads."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Registered buffer size", m_registeredBufferSize,
+                    "The size of each of the registered buffers. Realigned reads larger than this use temporary allocations."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                    "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                    "head to retrieve data, which can cause additional seek times for non-consecutive reads."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Direct IO enabled", m_constructionOptions.m_enableDirectIo,
+                    "Whether or not this drive will bypass the page cache by opening files with O_DIRECT. Buffered reads are beneficial "
+                    "when reading the same file frequently, which happens during development. Direct reads typically are faster for the "
+                    "initial read and are optimal for released games as these don't often read the same file."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                    "Whether or not this node only reports issues or reports all information."));
+                data.m_output.push_back(Statistic::CreateReferenceString(
+                    m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                    "The name of the node that follows this node or none."));
+            }
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
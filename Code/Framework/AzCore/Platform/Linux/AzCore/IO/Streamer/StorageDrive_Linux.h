@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive that uses io_uring to asynchronously read from disk. Multiple reads are queued on the submission ring
+    //! and are handed to the kernel in a single system call per scheduler update. Completions are signaled through an eventfd
+    //! that wakes up the scheduler thread.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use O_DIRECT to bypass the page cache. This results in a faster read the first time a file is read, but subsequent
+            //! reads will possibly be slower as those could have been serviced from the page cache. Direct reads have alignment
+            //! restrictions, so any read that isn't sector aligned will be read into an aligned intermediate buffer. If a file
+            //! system doesn't support O_DIRECT the file will be opened for buffered reads instead.
+            u8 m_enableDirectIo : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that uses io_uring for reading.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache.
+        //!     Needs to be a power of 2.
+        //! @param physicalSectorSize The sector size used by the hardware. When direct reads are used the output buffer needs
+        //!     to be aligned to this value.
+        //! @param logicalSectorSize The sector size used by the operating system. When direct reads are used the file size and
+        //!     read offset need to be aligned to this value.
+        //! @param queueDepth The number of reads that can be in flight at the same time. This is also the size of the io_uring
+        //!     submission queue.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param registeredBufferCount The number of intermediate buffers that are registered with the kernel. These are used
+        //!     for reads that need to be realigned and avoid the cost of mapping the pages for every read.
+        //! @param registeredBufferSize The size of each of the registered buffers. Will be rounded up to the physical sector size.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 queueDepth, s32 overCommit, u32 registeredBufferCount, size_t registeredBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        //! Checks if the running kernel supports the io_uring features this drive depends on.
+        static bool IsSupported();
+
+        void SetContext(StreamerContext& context) override;
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr u32 InvalidRegisteredBufferIndex = std::numeric_limits<u32>::max();
+        //! User data attached to cancel submissions so their completions can be told apart from reads.
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            u8* m_readBuffer{ nullptr };               // The buffer the kernel reads into.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_bytesRead{ 0 };
+            u64 m_readOffset{ 0 };
+            u32 m_readSize{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u32 m_registeredBufferIndex{ InvalidRegisteredBufferIndex };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool InitializeRing();
+        void ShutdownRing();
+        void DrainRing();
+        void RegisterBuffers(u32 count, size_t size);
+        io_uring_sqe* GetSubmissionEntry();
+        void PrepareReadEntry(io_uring_sqe* entry, size_t readSlot);
+        void SubmitQueuedEntries();
+
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+        bool ResubmitPartialReads();
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_submissionsPerCallAverage;
+        AZ::Statistics::RunningStatistic m_registeredBufferReadsPercentageStat;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+        AZStd::vector<bool> m_readSlots_cancelRequested;
+        //! Set for partially completed reads that couldn't get a submission entry to read the remainder.
+        AZStd::vector<bool> m_readSlots_resubmitPending;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_directIo;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        // io_uring state. The rings are shared with the kernel and only accessed from the scheduler thread.
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        io_uring_cqe* m_completionEntries{ nullptr };
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_submissionLocalTail{ 0 };
+        u32 m_queuedSubmissions{ 0 };
+        int m_ringFd{ -1 };
+        int m_eventFd{ -1 };
+
+        // Intermediate buffers that are registered with the kernel for fixed reads.
+        void* m_registeredBuffers{ nullptr };
+        AZStd::vector<u32> m_registeredBuffers_free;
+        size_t m_registeredBufferSize{ 0 };
+        u32 m_registeredBufferCount{ 0 };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        bool m_eventFdRegistered{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <dirent.h>
+#include <stdio.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(const char* device, const char* property, size_t& value)
+    {
+        AZStd::fixed_string<256> path = AZStd::fixed_string<256>::format("/sys/block/%s/queue/%s", device, property);
+        FILE* file = fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        const bool success = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        value = aznumeric_cast<size_t>(result);
+        return success;
+    }
+
+    bool CollectIoHardwareInformation(
+        HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        // The numbers below are based on common defaults from a local hardware survey and are used if the block devices
+        // can't be queried.
+        info.m_maxPageSize = 4096;
+        info.m_maxTransfer = 512_kib;
+        info.m_maxPhysicalSectorSize = 4096;
+        info.m_maxLogicalSectorSize = 512;
+        info.m_profile = "Generic";
+
+        DIR* blockDevices = opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return true;
+        }
+
+        DriveInformation drive;
+        bool foundDevice = false;
+        while (dirent* entry = readdir(blockDevices))
+        {
+            if (entry->d_name[0] == '.')
+            {
+                continue;
+            }
+
+            size_t physicalSectorSize = 0;
+            size_t logicalSectorSize = 0;
+            if (!ReadBlockDeviceValue(entry->d_name, "physical_block_size", physicalSectorSize) ||
+                !ReadBlockDeviceValue(entry->d_name, "logical_block_size", logicalSectorSize))
+            {
+                continue;
+            }
+            size_t rotational = 0;
+            ReadBlockDeviceValue(entry->d_name, "rotational", rotational);
+            size_t maxTransferKib = 0;
+            ReadBlockDeviceValue(entry->d_name, "max_sectors_kb", maxTransferKib);
+
+            if (reportHardware)
+            {
+                AZ_Trace("Streamer",
+                    "Block device '%s':\n"
+                    "    Physical sector size: %zu bytes\n"
+                    "    Logical sector size: %zu bytes\n"
+                    "    Max transfer: %zu kb\n"
+                    "    Drive type: %s\n",
+                    entry->d_name, physicalSectorSize, logicalSectorSize, maxTransferKib, rotational ? "HDD" : "SSD");
+            }
+
+            // Files can live on any of the devices, so the most restrictive requirements are used.
+            drive.m_physicalSectorSize = foundDevice ? AZStd::max(drive.m_physicalSectorSize, physicalSectorSize) : physicalSectorSize;
+            drive.m_logicalSectorSize = foundDevice ? AZStd::max(drive.m_logicalSectorSize, logicalSectorSize) : logicalSectorSize;
+            drive.m_maxTransfer = AZStd::max(drive.m_maxTransfer, maxTransferKib * 1024);
+            drive.m_hasSeekPenalty = drive.m_hasSeekPenalty || rotational != 0;
+            foundDevice = true;
+        }
+        closedir(blockDevices);
+
+        if (foundDevice && IStreamerTypes::IsPowerOf2(drive.m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(drive.m_logicalSectorSize))
+        {
+            info.m_maxPhysicalSectorSize = drive.m_physicalSectorSize;
+            info.m_maxLogicalSectorSize = drive.m_logicalSectorSize;
+            if (drive.m_maxTransfer > 0)
+            {
+                info.m_maxTransfer = drive.m_maxTransfer;
+            }
+            info.m_platformData = drive;
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
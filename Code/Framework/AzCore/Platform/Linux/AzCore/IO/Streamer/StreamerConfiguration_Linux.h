@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+
+namespace AZ::IO
+{
+    //! Combined information of the block devices in the system. Because Linux paths don't map to drives the way they do
+    //! on Windows, the most restrictive values across all devices are used.
+    struct DriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::DriveInformation, "{3F1C7A92-5D4B-4E8A-B6C1-0E9F2D7A4B35}");
+
+        size_t m_physicalSectorSize{ 4096 };
+        size_t m_logicalSectorSize{ 512 };
+        size_t m_maxTransfer{ 0 };
+        bool m_hasSeekPenalty{ false };
+    };
+} // namespace AZ::IO
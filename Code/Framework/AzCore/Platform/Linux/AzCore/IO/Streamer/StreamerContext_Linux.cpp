@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_eventFds[0] = eventfd(0, EFD_CLOEXEC);
+        AZ_Assert(m_eventFds[0] >= 0, "Failed to create the wake up event for the IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        AZ_Assert(m_eventFdCount == 1, "There are still %zu IO events registered while destroying the IO Scheduler synchronizer.",
+            m_eventFdCount - 1);
+        if (m_eventFds[0] >= 0)
+        {
+            close(m_eventFds[0]);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        pollfd fds[MaxIoEvents + 1];
+        for (size_t i = 0; i < m_eventFdCount; ++i)
+        {
+            fds[i].fd = m_eventFds[i];
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+
+        int result;
+        do
+        {
+            result = poll(fds, static_cast<nfds_t>(m_eventFdCount), -1);
+        } while (result < 0 && errno == EINTR);
+        AZ_Assert(result > 0, "Unexpected poll result %i (Error: %i).", result, errno);
+
+        // Only the wake up event is owned by the synchronizer, the IO events are reset by the node that owns them
+        // when it reaps its completions.
+        if (fds[0].revents & POLLIN)
+        {
+            eventfd_t value;
+            [[maybe_unused]] int readResult = eventfd_read(m_eventFds[0], &value);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        [[maybe_unused]] int result = eventfd_write(m_eventFds[0], 1);
+        AZ_Assert(result == 0, "Failed to wake up the IO Scheduler (Error: %i).", errno);
+    }
+
+    bool StreamerContextThreadSync::RegisterIoEventFd(int fd)
+    {
+        if (!AreEventHandlesAvailable())
+        {
+            return false;
+        }
+        m_eventFds[m_eventFdCount++] = fd;
+        return true;
+    }
+
+    void StreamerContextThreadSync::UnregisterIoEventFd(int fd)
+    {
+        for (size_t i = 1; i < m_eventFdCount; ++i)
+        {
+            if (m_eventFds[i] == fd)
+            {
+                m_eventFdCount--;
+                AZStd::swap(m_eventFds[i], m_eventFds[m_eventFdCount]);
+                return;
+            }
+        }
+        AZ_Assert(false, "IO event %i couldn't be unregistered as it wasn't found.", fd);
+    }
+
+    bool StreamerContextThreadSync::AreEventHandlesAvailable() const
+    {
+        return m_eventFdCount < MaxIoEvents + 1;
+    }
+} // namespace AZ::Platform
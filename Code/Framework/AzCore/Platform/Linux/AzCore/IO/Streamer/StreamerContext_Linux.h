@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Suspends the Streamer scheduler thread until either an external wake up call is made or one of the
+    //! registered IO event file descriptors (e.g. the eventfd attached to an io_uring instance) is signaled.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Adds a file descriptor that wakes up the scheduler thread when it becomes readable.
+        //! The descriptor is not owned by the synchronizer and needs to stay valid until it's unregistered.
+        bool RegisterIoEventFd(int fd);
+        void UnregisterIoEventFd(int fd);
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // The first descriptor is reserved for the external wake up calls, the remaining ones are for Streamer's internals.
+        int m_eventFds[MaxIoEvents + 1];
+        size_t m_eventFdCount{ 1 };
+    };
+} // namespace AZ::Platform
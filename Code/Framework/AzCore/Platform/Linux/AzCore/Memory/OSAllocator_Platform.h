@@ -8,3 +8,9 @@
 #pragma once
 
 #include <../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h>
+
+#include <sys/mman.h>
+
+// Hints the kernel to back a large allocation with transparent huge pages, it's a no-op when THP is set to "never"
+# define AZ_OS_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+# define AZ_OS_ADVISE_HUGE_PAGES(pointer, byteSize) ::madvise(pointer, byteSize, MADV_HUGEPAGE)
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/fixed_string.h>
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+namespace AZ::Threading
+{
+    namespace Platform
+    {
+        // Reads a small sysfs file, returns false if it doesn't exist.
+        static bool ReadSysFile(const char* path, AZStd::fixed_string<256>& contents)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+            char buffer[256];
+            const size_t bytesRead = fread(buffer, 1, sizeof(buffer) - 1, file);
+            fclose(file);
+            contents.assign(buffer, bytesRead);
+            return bytesRead > 0;
+        }
+    } // namespace Platform
+
+    AZStd::vector<CacheDomain> GetLastLevelCacheDomains()
+    {
+        AZStd::vector<uint32_t> onlineCores;
+        AZStd::fixed_string<256> contents;
+        if (!Platform::ReadSysFile("/sys/devices/system/cpu/online", contents) || !ParseCpuList(contents, onlineCores))
+        {
+            onlineCores.clear();
+            for (uint32_t core = 0; core < AZStd::thread::hardware_concurrency(); ++core)
+            {
+                onlineCores.push_back(core);
+            }
+        }
+
+        AZStd::vector<CacheDomain> domains;
+        AZStd::vector<bool> assigned;
+        for (uint32_t core : onlineCores)
+        {
+            if (core < assigned.size() && assigned[core])
+            {
+                continue;
+            }
+
+            // Find the highest level cache this core has, that's the one shared with the rest of its domain.
+            CacheDomain domain;
+            int highestLevel = 0;
+            for (int index = 0; index < 8; ++index)
+            {
+                AZStd::fixed_string<128> path =
+                    AZStd::fixed_string<128>::format("/sys/devices/system/cpu/cpu%u/cache/index%d/level", core, index);
+                if (!Platform::ReadSysFile(path.c_str(), contents))
+                {
+                    break;
+                }
+                const int level = atoi(contents.c_str());
+                if (level <= highestLevel)
+                {
+                    continue;
+                }
+
+                path = AZStd::fixed_string<128>::format("/sys/devices/system/cpu/cpu%u/cache/index%d/shared_cpu_list", core, index);
+                CacheDomain sharedCores;
+                if (Platform::ReadSysFile(path.c_str(), contents) && ParseCpuList(contents, sharedCores))
+                {
+                    highestLevel = level;
+                    domain = AZStd::move(sharedCores);
+                }
+            }
+
+            if (domain.empty())
+            {
+                domain.push_back(core);
+            }
+
+            // Only keep cores that are online and not part of a domain already.
+            CacheDomain filtered;
+            for (uint32_t sharedCore : domain)
+            {
+                if (AZStd::find(onlineCores.begin(), onlineCores.end(), sharedCore) == onlineCores.end())
+                {
+                    continue;
+                }
+                if (sharedCore >= assigned.size())
+                {
+                    assigned.resize(sharedCore + 1, false);
+                }
+                if (!assigned[sharedCore])
+                {
+                    assigned[sharedCore] = true;
+                    filtered.push_back(sharedCore);
+                }
+            }
+            if (!filtered.empty())
+            {
+                domains.push_back(AZStd::move(filtered));
+            }
+        }
+
+        AZStd::sort(domains.begin(), domains.end(),
+            [](const CacheDomain& lhs, const CacheDomain& rhs)
+            {
+                return lhs.front() < rhs.front();
+            });
+        return domains;
+    }
+
+    bool PinCurrentThreadToCore(uint32_t logicalCore)
+    {
+        if (logicalCore >= CPU_SETSIZE)
+        {
+            return false;
+        }
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(logicalCore, &cpuset);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) == 0;
+    }
+} // namespace AZ::Threading
@@ -75,4 +75,5 @@ set(FILES
     ../Common/UnixLike/AzCore/Utils/Utils_UnixLike.cpp
     AzCore/Debug/Profiler_Platform.inl
     ../Common/Unimplemented/AzCore/Debug/Profiler_Unimplemented.inl
+    ../Common/Default/AzCore/Threading/ThreadUtils_Default.cpp
 )
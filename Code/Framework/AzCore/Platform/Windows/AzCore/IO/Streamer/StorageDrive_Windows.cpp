@@ -827,10 +827,15 @@ namespace AZ::IO
                 m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
                 m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileSize.QuadPart);
                 fileExists.m_found = true;
-
-                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
-                m_context->MarkRequestAsCompleted(request);
             }
+            else
+            {
+                // The path exists but isn't a regular file, such as a directory.
+                fileExists.m_found = false;
+            }
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
             return;
         }
 
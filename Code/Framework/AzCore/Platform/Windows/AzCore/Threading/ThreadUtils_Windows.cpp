@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Threading/ThreadUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Threading
+{
+    AZStd::vector<CacheDomain> GetLastLevelCacheDomains()
+    {
+        AZStd::vector<CacheDomain> domains;
+
+        DWORD bufferSize = 0;
+        GetLogicalProcessorInformationEx(RelationCache, nullptr, &bufferSize);
+        AZStd::vector<AZ::u8> buffer(bufferSize);
+        if (bufferSize == 0 ||
+            !GetLogicalProcessorInformationEx(
+                RelationCache, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &bufferSize))
+        {
+            CacheDomain domain;
+            for (uint32_t core = 0; core < AZStd::thread::hardware_concurrency(); ++core)
+            {
+                domain.push_back(core);
+            }
+            domains.push_back(AZStd::move(domain));
+            return domains;
+        }
+
+        // First pass finds the last level, second pass collects the caches of that level.
+        BYTE lastLevel = 0;
+        for (DWORD offset = 0; offset < bufferSize;)
+        {
+            auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+            lastLevel = AZStd::max(lastLevel, info->Cache.Level);
+            offset += info->Size;
+        }
+
+        for (DWORD offset = 0; offset < bufferSize;)
+        {
+            auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+            offset += info->Size;
+            if (info->Cache.Level != lastLevel || (info->Cache.Type != CacheUnified && info->Cache.Type != CacheData))
+            {
+                continue;
+            }
+
+            CacheDomain domain;
+            const KAFFINITY mask = info->Cache.GroupMask.Mask;
+            const uint32_t groupBase = static_cast<uint32_t>(info->Cache.GroupMask.Group) * 64;
+            for (uint32_t bit = 0; bit < 64; ++bit)
+            {
+                if (mask & (KAFFINITY(1) << bit))
+                {
+                    domain.push_back(groupBase + bit);
+                }
+            }
+            if (!domain.empty())
+            {
+                domains.push_back(AZStd::move(domain));
+            }
+        }
+
+        AZStd::sort(domains.begin(), domains.end(),
+            [](const CacheDomain& lhs, const CacheDomain& rhs)
+            {
+                return lhs.front() < rhs.front();
+            });
+        return domains;
+    }
+
+    bool PinCurrentThreadToCore(uint32_t logicalCore)
+    {
+        // Only the calling thread's processor group is addressable through the affinity mask
+        if (logicalCore >= 64)
+        {
+            return false;
+        }
+        return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << logicalCore) != 0;
+    }
+} // namespace AZ::Threading
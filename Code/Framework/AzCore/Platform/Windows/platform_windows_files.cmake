@@ -75,4 +75,5 @@ set(FILES
     AzCore/Utils/Utils_Windows.cpp
     AzCore/Debug/Profiler_Platform.inl
     ../Common/WinAPI/AzCore/Debug/Profiler_WinAPI.inl
+    AzCore/Threading/ThreadUtils_Windows.cpp
 )
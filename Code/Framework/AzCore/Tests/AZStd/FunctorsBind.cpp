@@ -9,6 +9,7 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/functional.h>
+#include <AzCore/std/function/function_ref.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/delegate/delegate_bind.h>
 #include <AzCore/std/string/string.h>
@@ -1648,4 +1649,64 @@ namespace UnitTest
         constexpr double expectedResult = static_cast<double>(32 + 16 + 128.0 + 512);
         EXPECT_DOUBLE_EQ(expectedResult, result);
     }
+
+    inline int FunctionRefSum(const AZStd::function_ref<int(int)>& function, int count)
+    {
+        int sum = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            sum += function(i);
+        }
+        return sum;
+    }
+
+    inline int FunctionRefTimesTwo(int value)
+    {
+        return value * 2;
+    }
+
+    TEST(FunctionRef, InvokesLambda_WithoutCopyingCaptures)
+    {
+        int numCalls = 0;
+        AZStd::vector<int> capturedValues{ 1, 2, 3 };
+        auto lambda = [&numCalls, capturedValues](int value)
+        {
+            ++numCalls;
+            return value + capturedValues[0];
+        };
+        EXPECT_EQ(0 + 1 + 2 + 3 + 4 * 1, FunctionRefSum(lambda, 4));
+        EXPECT_EQ(4, numCalls);
+
+        // Temporaries live until the end of the full expression
+        EXPECT_EQ(3, FunctionRefSum([](int value) { return value; }, 3));
+    }
+
+    TEST(FunctionRef, InvokesFunctionPointerAndFunction)
+    {
+        EXPECT_EQ(2 * (0 + 1 + 2), FunctionRefSum(&FunctionRefTimesTwo, 3));
+        EXPECT_EQ(2 * (0 + 1 + 2), FunctionRefSum(FunctionRefTimesTwo, 3));
+
+        AZStd::function<int(int)> function = [](int value) { return value + 1; };
+        EXPECT_EQ(1 + 2 + 3, FunctionRefSum(function, 3));
+    }
+
+    TEST(FunctionRef, VoidFunctionRef_DiscardsResult)
+    {
+        int value = 0;
+        auto increment = [&value]() { return ++value; };
+        AZStd::function_ref<void()> functionRef = increment;
+        functionRef();
+        AZStd::function_ref<void()> functionRefCopy = functionRef;
+        functionRefCopy();
+        EXPECT_EQ(2, value);
+    }
+
+    TEST(FunctionRef, MutableCallable_KeepsStateInReferencedObject)
+    {
+        auto counter = [count = 0]() mutable { return ++count; };
+        AZStd::function_ref<int()> functionRef = counter;
+        functionRef();
+        functionRef();
+        EXPECT_EQ(3, counter());
+    }
 }
@@ -12,6 +12,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/string/string.h>
@@ -1160,6 +1162,168 @@ namespace UnitTest
         EXPECT_EQ(idx, map.size());
     }
 
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(0, map.capacity());
+        EXPECT_EQ(map.end(), map.find(1));
+        EXPECT_TRUE(map.validate());
+
+        // Enough elements to grow a few times
+        const int count = 1000;
+        for (int i = 0; i < count; ++i)
+        {
+            EXPECT_TRUE(map.emplace(i, i * 2).second);
+        }
+        EXPECT_FALSE(map.emplace(10, 0).second);
+        EXPECT_EQ(count, map.size());
+        EXPECT_GE(map.capacity(), map.size());
+        EXPECT_TRUE(map.validate());
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto iter = map.find(i);
+            ASSERT_NE(map.end(), iter);
+            EXPECT_EQ(i * 2, iter->second);
+        }
+        EXPECT_FALSE(map.contains(count));
+        EXPECT_EQ(0, map.count(-1));
+
+        size_t numIterated = 0;
+        for (const auto& [key, value] : map)
+        {
+            EXPECT_EQ(key * 2, value);
+            ++numIterated;
+        }
+        EXPECT_EQ(map.size(), numIterated);
+
+        map[count] = 5;
+        EXPECT_EQ(5, map.at(count));
+        EXPECT_FALSE(map.insert_or_assign(count, 6).second);
+        EXPECT_EQ(6, map.at(count));
+
+        // Erase the odd keys
+        for (int i = 1; i < count; i += 2)
+        {
+            EXPECT_EQ(1, map.erase(i));
+        }
+        EXPECT_EQ(0, map.erase(1));
+        EXPECT_EQ(count / 2 + 1, map.size());
+        EXPECT_TRUE(map.validate());
+        for (int i = 0; i < count; ++i)
+        {
+            EXPECT_EQ(i % 2 == 0, map.contains(i));
+        }
+
+        EXPECT_EQ(count / 2, AZStd::erase_if(map, [](const auto& element) { return element.first < count; }));
+        EXPECT_EQ(1, map.size());
+
+        const size_t capacity = map.capacity();
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_TRUE(map.validate());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapEraseAndReinsert_ReusesErasedSlots)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        map.reserve(100);
+        const size_t capacity = map.capacity();
+        EXPECT_GE(capacity, 100);
+
+        // Churning through a lot more keys than the capacity rehashes in place instead of growing
+        for (int i = 0; i < 10000; ++i)
+        {
+            map.emplace(i, i);
+            if (i >= 50)
+            {
+                EXPECT_EQ(1, map.erase(i - 50));
+            }
+        }
+        EXPECT_EQ(50, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_TRUE(map.validate());
+        for (int i = 10000 - 50; i < 10000; ++i)
+        {
+            EXPECT_TRUE(map.contains(i));
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapNonTrivialValue)
+    {
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.try_emplace(AZStd::string::format("Key%d", i), AZStd::string::format("Long enough value to allocate %d", i));
+        }
+
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> copy(map);
+        EXPECT_EQ(map, copy);
+        EXPECT_EQ("Long enough value to allocate 42", copy["Key42"]);
+
+        AZStd::flat_hash_map<AZStd::string, AZStd::string> moved(AZStd::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(map, moved);
+
+        moved.erase(moved.find("Key42"));
+        EXPECT_NE(map, moved);
+        copy = moved;
+        EXPECT_EQ(moved, copy);
+        EXPECT_TRUE(copy.validate());
+
+        AZStd::flat_hash_map<int, MoveOnlyType> moveOnlyMap;
+        moveOnlyMap.try_emplace(1, "First");
+        for (int i = 2; i < 100; ++i)
+        {
+            moveOnlyMap.emplace(i, MoveOnlyType(AZStd::string::format("%d", i)));
+        }
+        EXPECT_EQ("First", moveOnlyMap.at(1).m_name);
+        EXPECT_EQ("42", moveOnlyMap.at(42).m_name);
+    }
+
+    TEST_F(HashedContainers, FlatHashMapTransparentLookup_FindsStringViewKeys)
+    {
+        AZStd::flat_hash_map<AZStd::string, int, AZStd::hash<AZStd::string>, AZStd::equal_to<>> map;
+        map.emplace("Transform", 1);
+        map.emplace("Mesh", 2);
+
+        constexpr AZStd::string_view transformName = "Transform";
+        auto iter = map.find(transformName);
+        ASSERT_NE(map.end(), iter);
+        EXPECT_EQ(1, iter->second);
+        EXPECT_TRUE(map.contains(AZStd::string_view("Mesh")));
+        EXPECT_EQ(1, map.erase(AZStd::string_view("Mesh")));
+        EXPECT_FALSE(map.contains(AZStd::string_view("Mesh")));
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        AZStd::flat_hash_set<int> set{ 1, 2, 3, 4, 5 };
+        EXPECT_EQ(5, set.size());
+        EXPECT_FALSE(set.insert(3).second);
+        EXPECT_TRUE(set.insert(6).second);
+        EXPECT_TRUE(set.contains(6));
+        EXPECT_EQ(1, set.erase(1));
+        EXPECT_FALSE(set.contains(1));
+        EXPECT_TRUE(set.validate());
+
+        AZStd::flat_hash_set<int> otherSet{ 2, 3, 4, 5, 6 };
+        EXPECT_EQ(set, otherSet);
+
+        otherSet.swap(set);
+        EXPECT_EQ(set, otherSet);
+
+        set.rehash(0);
+        EXPECT_EQ(5, set.size());
+        EXPECT_TRUE(set.validate());
+        set.clear();
+        set.rehash(0);
+        EXPECT_EQ(0, set.capacity());
+    }
+
     template<typename ContainerType>
     class HashedSetContainers
         : public LeakDetectionFixture
@@ -2333,6 +2497,30 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
 #endif
 } // namespace UnitTest
 
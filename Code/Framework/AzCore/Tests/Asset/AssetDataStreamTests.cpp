@@ -434,6 +434,40 @@ TEST_F(AssetDataStreamTest, Read_ReadDataIncrementally_PartialDataReadSuccessful
     assetDataStream.Close();
 }
 
+TEST_F(AssetDataStreamTest, ReadInPlace_ReadDataInChunks_ViewsReferToStreamBuffer)
+{
+    // Create an arbitrary buffer with different data in every byte
+    constexpr int bufferSize = 256;
+    constexpr int chunkSize = 100;
+    AZStd::vector<AZ::u8> buffer(bufferSize);
+    for (int offset = 0; offset < bufferSize; offset++)
+    {
+        buffer[offset] = offset & 0xFF;
+    }
+    const AZ::u8* bufferData = buffer.data();
+
+    // Give the stream ownership of the buffer, so the views should point straight into it.
+    AZ::Data::AssetDataStream assetDataStream;
+    assetDataStream.Open(AZStd::move(buffer));
+
+    for (int offset = 0; offset < bufferSize; offset += chunkSize)
+    {
+        EXPECT_EQ(offset, assetDataStream.GetCurPos());
+
+        AZStd::span<const AZ::u8> chunk = assetDataStream.ReadInPlace(chunkSize);
+
+        // The last chunk only contains the remaining data.
+        EXPECT_EQ(chunk.size(), AZStd::min(chunkSize, bufferSize - offset));
+        EXPECT_EQ(chunk.data(), bufferData + offset);
+        EXPECT_EQ(chunk[0], offset & 0xFF);
+    }
+
+    // Verify that nothing is returned once all data has been read.
+    EXPECT_TRUE(assetDataStream.ReadInPlace(chunkSize).empty());
+
+    assetDataStream.Close();
+}
+
 TEST_F(AssetDataStreamTest, Seek_SeekForward_SeekingForwardWorksSuccessfully)
 {
     // Create an arbitrary buffer with different data in every byte
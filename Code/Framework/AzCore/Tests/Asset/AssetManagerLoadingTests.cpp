@@ -661,6 +661,48 @@ namespace UnitTest
         AssetManager::Destroy();
     }
 
+    TEST_F(AssetJobsFloodTest, ReleasedAssetBudget_ReleasedAssetsStayLoadedUntilEvicted)
+    {
+        const AssetType assetType = azrtti_typeid<AssetWithSerializedData>();
+        m_testAssetManager->SetReleasedAssetBudget(assetType, 1024 * 1024);
+
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+        {
+            auto asset = m_testAssetManager->GetAsset<AssetWithSerializedData>(MyAsset4Id, AZ::Data::AssetLoadBehavior::Default);
+            asset.BlockUntilLoadComplete();
+            EXPECT_TRUE(asset.IsReady());
+        }
+        BlockUntilAssetJobsAreComplete();
+        m_testAssetManager->DispatchEvents();
+
+        EXPECT_EQ(m_assetHandlerAndCatalog->m_numCreations, 1);
+        EXPECT_EQ(m_assetHandlerAndCatalog->m_numDestructions, 0);
+        EXPECT_EQ(m_testAssetManager->GetReleasedAssetStats(assetType).m_residentCount, 1);
+
+        // Requesting the released asset again returns the loaded asset instead of loading it again
+        {
+            auto asset = m_testAssetManager->GetAsset<AssetWithSerializedData>(MyAsset4Id, AZ::Data::AssetLoadBehavior::Default);
+            EXPECT_TRUE(asset.IsReady());
+        }
+        EXPECT_EQ(m_assetHandlerAndCatalog->m_numCreations, 1);
+
+        AssetManager::ReleasedAssetStats stats = m_testAssetManager->GetReleasedAssetStats(assetType);
+        EXPECT_EQ(stats.m_residentCount, 1);
+        EXPECT_EQ(stats.m_reuseCount, 1);
+        EXPECT_EQ(stats.m_evictionCount, 0);
+
+        // Removing the budget unloads the released assets
+        m_testAssetManager->SetReleasedAssetBudget(assetType, 0);
+        stats = m_testAssetManager->GetReleasedAssetStats(assetType);
+        EXPECT_EQ(stats.m_residentCount, 0);
+        EXPECT_EQ(stats.m_residentBytes, 0);
+        EXPECT_EQ(stats.m_evictionCount, 1);
+
+        CheckFinishedCreationsAndDestructions();
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_AssetLoadBehaviorIsPreserved)
 #else
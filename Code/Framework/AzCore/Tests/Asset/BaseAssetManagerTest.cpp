@@ -259,6 +259,15 @@ namespace UnitTest
                 }
             });
 
+        ON_CALL(m_mockStreamer, QueueRequestBatch(::testing::An<AZStd::vector<FileRequestPtr>&&>()))
+            .WillByDefault([this](AZStd::vector<FileRequestPtr>&& fileRequests)
+            {
+                for (const auto& fileRequest : fileRequests)
+                {
+                    m_mockStreamer.QueueRequest(fileRequest);
+                }
+            });
+
         ON_CALL(m_mockStreamer, GetRequestStatus(_))
             .WillByDefault([]([[maybe_unused]] FileRequestHandle request)
             {
@@ -12,6 +12,7 @@
 #include <AzCore/DOM/Backends/JSON/JsonSerializationUtils.h>
 #include <AzCore/DOM/DomUtils.h>
 #include <AzCore/DOM/DomValue.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
@@ -128,6 +129,23 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, RapidjsonDeserializeToRapidjson)
 
+    BENCHMARK_DEFINE_F(DomJsonBenchmark, RapidjsonDeserializeToRapidjsonFromStream)(benchmark::State& state)
+    {
+        AZStd::string serializedPayload = GenerateDomJsonBenchmarkPayload(state.range(0), state.range(1));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Streams are read into a null terminated buffer, which is parsed with rapidjson's string stream.
+            AZ::IO::MemoryStream stream(serializedPayload.data(), serializedPayload.size());
+            auto result = AZ::JsonSerializationUtils::ReadJsonStream(stream);
+
+            TakeAndDiscardWithoutTimingDtor(result.TakeValue(), state);
+        }
+
+        state.SetBytesProcessed(serializedPayload.size() * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomJsonBenchmark, RapidjsonDeserializeToRapidjsonFromStream)
+
     BENCHMARK_DEFINE_F(DomJsonBenchmark, RapidjsonMakeComplexObject)(benchmark::State& state)
     {
         for ([[maybe_unused]] auto _ : state)
@@ -115,6 +115,25 @@ namespace AZ::Dom::Tests
         PerformValueChecks();
     }
 
+    TEST_F(DomValueTests, FindMemberByString)
+    {
+        m_value.SetObject();
+        m_value.AddMember("Key0", Value(0));
+        m_value.AddMember("Key1", Value(1));
+
+        EXPECT_TRUE(m_value.HasMember("Key1"));
+        EXPECT_FALSE(m_value.HasMember("Key"));
+        EXPECT_FALSE(m_value.HasMember("Key10"));
+        EXPECT_EQ(m_value.FindMember("Key1")->second.GetInt64(), 1);
+        EXPECT_EQ(m_value.FindMember("Key2"), m_value.MemberEnd());
+
+        m_value.EraseMember("Key0");
+        EXPECT_EQ(m_value.MemberCount(), 1);
+        EXPECT_FALSE(m_value.HasMember("Key0"));
+
+        PerformValueChecks();
+    }
+
     TEST_F(DomValueTests, NestedObjects)
     {
         m_value.SetObject();
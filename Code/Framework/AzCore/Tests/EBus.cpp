@@ -66,6 +66,17 @@ namespace BusImplementation
         using BusIdOrderCompare = AZStd::conditional_t<AddressPolicy != EBusAddressPolicy::ByIdAndOrdered, AZ::NullBusIdCompare, AZStd::less<int>>;
     };
 
+    // Traits for the benchmark bus dispatching through the contiguous handler array, which requires a single threaded bus
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+    class ContiguousDispatchTraits
+        : public Traits<addressPolicy, handlerPolicy>
+    {
+    public:
+        static const bool EnableContiguousDispatch = true;
+
+        using MutexType = AZ::NullMutex;
+    };
+
     template <typename Bus>
     class HandlerCommon
         : public Bus::Handler
@@ -200,6 +211,14 @@ using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
     namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
 
+// Definition of the benchmark bus with contiguous dispatch
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy>
+using ContiguousTestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::ContiguousDispatchTraits<addressPolicy, handlerPolicy>>;
+
+#define EBUS_CONTIGUOUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                             \
+    using BusType = ContiguousTestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
 // Predefined benchmark bus instantiations
 // Single
 EBUS_TEST_ALIAS(OneToOne, Single, Single)
@@ -213,6 +232,11 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Contiguous dispatch
+EBUS_CONTIGUOUS_TEST_ALIAS(OneToManyContiguous, Single, Multiple)
+EBUS_CONTIGUOUS_TEST_ALIAS(OneToManyOrderedContiguous, Single, MultipleAndOrdered)
+EBUS_CONTIGUOUS_TEST_ALIAS(ManyToManyContiguous, ById, Multiple)
+EBUS_CONTIGUOUS_TEST_ALIAS(ManyToManyOrderedContiguous, ById, MultipleAndOrdered)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -362,11 +386,13 @@ namespace UnitTest
 {
     using BusTypesId = ::testing::Types<
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManyContiguous, ManyToManyOrderedContiguous>;
     using BusTypesAll = ::testing::Types<
         OneToOne,         OneToMany,         OneToManyOrdered,
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        OneToManyContiguous, OneToManyOrderedContiguous, ManyToManyContiguous, ManyToManyOrderedContiguous>;
 
     template <typename Bus>
     class EBusTestAll
@@ -564,7 +590,8 @@ namespace UnitTest
 
     using BusTypesIdMultiHandlers = ::testing::Types<
         ManyToMany, ManyToManyOrdered,
-        ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManyContiguous, ManyToManyOrderedContiguous>;
     template <typename Bus>
     class EBusTestIdMultiHandlers
         : public EBusTestAll<Bus>
@@ -2158,6 +2185,92 @@ namespace UnitTest
         EXPECT_EQ(0, addressHandler2.m_addressDisconnectCounter);
     }
 
+    class ContiguousDispatchInterface
+        : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr bool EnableContiguousDispatch = true;
+
+        virtual void OnEvent() = 0;
+    };
+
+    using ContiguousDispatchBus = AZ::EBus<ContiguousDispatchInterface>;
+
+    class ContiguousDispatchHandler
+        : public ContiguousDispatchBus::Handler
+    {
+    public:
+        void OnEvent() override
+        {
+            ++m_calls;
+            if (m_handlerToDisconnect)
+            {
+                m_handlerToDisconnect->BusDisconnect();
+            }
+            if (m_handlerToConnect)
+            {
+                m_handlerToConnect->BusConnect();
+                m_handlerToConnect = nullptr;
+            }
+            if (m_dispatchNested)
+            {
+                m_dispatchNested = false;
+                ContiguousDispatchBus::Broadcast(&ContiguousDispatchInterface::OnEvent);
+            }
+        }
+
+        ContiguousDispatchHandler* m_handlerToDisconnect = nullptr;
+        ContiguousDispatchHandler* m_handlerToConnect = nullptr;
+        bool m_dispatchNested = false;
+        int m_calls = 0;
+    };
+
+    TEST_F(EBus, ContiguousDispatch_DisconnectOtherHandlerDuringDispatch_OtherHandlerIsNotCalled)
+    {
+        ContiguousDispatchHandler handler1;
+        ContiguousDispatchHandler handler2;
+        handler1.BusConnect();
+        handler2.BusConnect();
+        handler1.m_handlerToDisconnect = &handler2;
+        handler2.m_handlerToDisconnect = &handler1;
+
+        // Whichever handler is called first disconnects the other one
+        ContiguousDispatchBus::Broadcast(&ContiguousDispatchInterface::OnEvent);
+        EXPECT_EQ(1, handler1.m_calls + handler2.m_calls);
+        EXPECT_EQ(1, ContiguousDispatchBus::GetTotalNumOfEventHandlers());
+    }
+
+    TEST_F(EBus, ContiguousDispatch_ConnectDuringDispatch_HandlerIsCalledFromTheNextDispatch)
+    {
+        ContiguousDispatchHandler handler;
+        ContiguousDispatchHandler connectedHandler;
+        handler.BusConnect();
+        handler.m_handlerToConnect = &connectedHandler;
+
+        ContiguousDispatchBus::Broadcast(&ContiguousDispatchInterface::OnEvent);
+        EXPECT_EQ(1, handler.m_calls);
+        EXPECT_EQ(0, connectedHandler.m_calls);
+
+        ContiguousDispatchBus::Broadcast(&ContiguousDispatchInterface::OnEvent);
+        EXPECT_EQ(2, handler.m_calls);
+        EXPECT_EQ(1, connectedHandler.m_calls);
+    }
+
+    TEST_F(EBus, ContiguousDispatch_NestedDispatchAfterConnect_ReachesConnectedHandler)
+    {
+        ContiguousDispatchHandler handler;
+        ContiguousDispatchHandler connectedHandler;
+        handler.BusConnect();
+        handler.m_handlerToConnect = &connectedHandler;
+        handler.m_dispatchNested = true;
+
+        // The nested dispatch can't rebuild the array the outer dispatch is walking, so it walks the handlers instead
+        ContiguousDispatchBus::Broadcast(&ContiguousDispatchInterface::OnEvent);
+        EXPECT_EQ(2, handler.m_calls);
+        EXPECT_EQ(1, connectedHandler.m_calls);
+    }
+
     /**
      * Test multiple handler.
      */
@@ -4469,6 +4582,17 @@ namespace Benchmark
     cb(fn, OneToManyOrdered, OneToMany)         \
     BUS_BENCHMARK_PRIVATE_LIST_ID(cb, fn)
 
+// Internal macro callback for listing the buses with contiguous dispatch requiring ids
+#define BUS_BENCHMARK_PRIVATE_LIST_CONTIGUOUS_ID(cb, fn)    \
+    cb(fn, ManyToManyContiguous, ManyToMany)                \
+    cb(fn, ManyToManyOrderedContiguous, ManyToMany)
+
+// Internal macro callback for listing all buses with contiguous dispatch
+#define BUS_BENCHMARK_PRIVATE_LIST_CONTIGUOUS_ALL(cb, fn)   \
+    cb(fn, OneToManyContiguous, OneToMany)                  \
+    cb(fn, OneToManyOrderedContiguous, OneToMany)           \
+    BUS_BENCHMARK_PRIVATE_LIST_CONTIGUOUS_ID(cb, fn)
+
 // Internal macro callback for registering a benchmark
 #define BUS_BENCHMARK_PRIVATE_REGISTER(fn, BusDef, SettingsFn) BENCHMARK_TEMPLATE(fn, BusDef)->Apply(&BenchmarkSettings::SettingsFn);
 
@@ -4478,6 +4602,12 @@ namespace Benchmark
 // Register a benchmark for all bus permutations
 #define BUS_BENCHMARK_REGISTER_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
+// Register a benchmark for the contiguous dispatch buses requiring ids
+#define BUS_BENCHMARK_REGISTER_CONTIGUOUS_ID(fn) BUS_BENCHMARK_PRIVATE_LIST_CONTIGUOUS_ID(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
+// Register a benchmark for all contiguous dispatch buses
+#define BUS_BENCHMARK_REGISTER_CONTIGUOUS_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_CONTIGUOUS_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
     //////////////////////////////////////////////////////////////////////////
     // Single Threaded Events/Broadcasts
     //////////////////////////////////////////////////////////////////////////
@@ -4565,6 +4695,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_Broadcast);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ALL(BM_EBus_Broadcast);
 
     template <typename Bus>
     static void BM_EBus_BroadcastResult(::benchmark::State& state)
@@ -4579,6 +4710,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_BroadcastResult);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ALL(BM_EBus_BroadcastResult);
 
     template <typename Bus>
     static void BM_EBus_Event(::benchmark::State& state)
@@ -4591,6 +4723,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_Event);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ID(BM_EBus_Event);
 
     template <typename Bus>
     static void BM_EBus_EventResult(::benchmark::State& state)
@@ -4605,6 +4738,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventResult);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ID(BM_EBus_EventResult);
 
     template <typename Bus>
     static void BM_EBus_EventCached(::benchmark::State& state)
@@ -4621,6 +4755,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCached);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ID(BM_EBus_EventCached);
 
     template <typename Bus>
     static void BM_EBus_EventCachedResult(::benchmark::State& state)
@@ -4639,6 +4774,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCachedResult);
+    BUS_BENCHMARK_REGISTER_CONTIGUOUS_ID(BM_EBus_EventCachedResult);
 
     //////////////////////////////////////////////////////////////////////////
     // Broadcast/Event Queuing
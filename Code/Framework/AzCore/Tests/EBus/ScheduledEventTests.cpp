@@ -81,6 +81,20 @@ namespace UnitTest
             }
         }
         EXPECT_EQ(m_basicEventTriggerCount, 1);
+        EXPECT_EQ(m_eventSchedulerComponent->GetFiredEventCount(), 1u);
+    }
+
+    TEST_F(ScheduledEventTests, TestReenqueue_RemovedHandlesAreCompacted)
+    {
+        // Every enqueue of an already scheduled event leaves its previous handle in the queue, these must not pile up.
+        constexpr uint32_t EnqueueCount = 10000;
+        for (uint32_t i = 0; i < EnqueueCount; ++i)
+        {
+            m_testEvent->Enqueue(AZ::TimeMs(100000));
+        }
+        EXPECT_TRUE(m_testEvent->IsScheduled());
+        EXPECT_LT(m_eventSchedulerComponent->GetQueueSize(), 2048u);
+        EXPECT_LT(m_eventSchedulerComponent->GetHandleCount(), 2048u);
     }
 
     TEST_F(ScheduledEventTests, TestRequeue)
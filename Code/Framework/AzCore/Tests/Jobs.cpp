@@ -97,11 +97,15 @@ namespace UnitTest
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
             }
 
+            ConfigureJobManagerDesc(desc);
+
             m_jobManager = aznew JobManager(desc);
             m_jobContext = aznew JobContext(*m_jobManager);
 
             JobContext::SetGlobalContext(m_jobContext);
         }
+
+        virtual void ConfigureJobManagerDesc([[maybe_unused]] JobManagerDesc& desc) {}
         
         void TearDown() override
         {
@@ -427,6 +431,39 @@ namespace UnitTest
     }
     // FibonacciJob2Example-End
 
+    class JobLockFreeQueueFibonacciTest
+        : public JobFibonacciTest
+    {
+    public:
+        void ConfigureJobManagerDesc(JobManagerDesc& desc) override
+        {
+            desc.m_workQueueType = JobQueueType::LockFree;
+            // small enough for the fork heavy fibonacci to overflow into the global queue
+            desc.m_lockFreeQueueCapacity = 8;
+        }
+    };
+
+    TEST_F(JobLockFreeQueueFibonacciTest, Test)
+    {
+        run();
+    }
+
+    class JobIdleSpinFibonacciTest
+        : public JobFibonacciTest
+    {
+    public:
+        void ConfigureJobManagerDesc(JobManagerDesc& desc) override
+        {
+            desc.m_workQueueType = JobQueueType::LockFree;
+            desc.m_idleSpinCount = 64;
+        }
+    };
+
+    TEST_F(JobIdleSpinFibonacciTest, Test)
+    {
+        run();
+    }
+
     // MergeSortJobExample-Begin
     class MergeSortJobJoin
         : public Job
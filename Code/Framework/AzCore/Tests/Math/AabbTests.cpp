@@ -463,6 +463,30 @@ namespace UnitTest
         EXPECT_THAT(transformedAabb.GetMax(), IsClose(Vector3(16.3216f, 6.54272f, 5.98112f)));
     }
 
+    TEST(MATH_AabbTransform, TransformAabbs_MatchesGetTransformedAabb)
+    {
+        Matrix3x4 matrix3x4 = Matrix3x4::CreateFromQuaternionAndTranslation(Quaternion(0.34f, 0.46f, 0.58f, 0.58f), Vector3(-3.0f, -4.0f, -5.0f));
+        matrix3x4.MultiplyByScale(Vector3(1.2f, 0.8f, 2.0f));
+
+        Aabb aabbs[] = {
+            Aabb::CreateFromMinMax(Vector3(2.0f, 3.0f, 5.0f), Vector3(6.0f, 5.0f, 11.0f)),
+            Aabb::CreateFromMinMax(Vector3(-1.0f, -2.0f, -3.0f), Vector3(4.0f, 3.0f, 2.0f)),
+            Aabb::CreateFromPoint(Vector3(7.0f, -8.0f, 9.0f))
+        };
+        Aabb expected[AZ_ARRAY_SIZE(aabbs)];
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(aabbs); ++i)
+        {
+            expected[i] = aabbs[i].GetTransformedAabb(matrix3x4);
+        }
+
+        Aabb::TransformAabbs(aabbs, matrix3x4, aabbs);
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(aabbs); ++i)
+        {
+            EXPECT_THAT(aabbs[i].GetMin(), IsClose(expected[i].GetMin()));
+            EXPECT_THAT(aabbs[i].GetMax(), IsClose(expected[i].GetMax()));
+        }
+    }
+
     TEST(MATH_AabbTransform, GetTransformedObbFitsInsideTransformedAabb)
     {
         Vector3 min(4.0f, 3.0f, 1.0f);
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BoundingVolumeBatch.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+#include <random>
+
+namespace UnitTest
+{
+    class MATH_BoundingVolumeBatch
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_frustum = AZ::Frustum(AZ::ViewFrustumAttributes(AZ::Transform::CreateIdentity(), 1.0f, 2.0f * atanf(0.5f), 10.0f, 90.0f));
+        }
+
+        // Generates volumes in a box around the frustum so every classification is represented
+        void FillRandom(AZ::BoundingVolumeBatch& batch, size_t count)
+        {
+            std::mt19937_64 rng(1);
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const AZ::Vector3 center(unif(rng) * 60.0f, unif(rng) * 60.0f + 50.0f, unif(rng) * 60.0f);
+                const AZ::Vector3 halfExtents = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f;
+                batch.PushBack(
+                    AZ::Sphere(center, halfExtents.GetLength()), AZ::Aabb::CreateFromMinMax(center - halfExtents, center + halfExtents));
+            }
+        }
+
+        AZ::Frustum m_frustum;
+    };
+
+    TEST_F(MATH_BoundingVolumeBatch, PushBackStoresVolumes)
+    {
+        AZ::BoundingVolumeBatch batch;
+        EXPECT_EQ(batch.GetSize(), 0);
+
+        const AZ::Sphere sphere(AZ::Vector3(1.0f, 2.0f, 3.0f), 4.0f);
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f, -2.0f, -3.0f), AZ::Vector3(5.0f, 6.0f, 7.0f));
+        for (size_t i = 0; i < 9; ++i)
+        {
+            EXPECT_EQ(batch.PushBack(sphere, aabb), i);
+        }
+
+        EXPECT_EQ(batch.GetSize(), 9);
+        for (size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            EXPECT_THAT(batch.GetSphere(i).GetCenter(), IsClose(sphere.GetCenter()));
+            EXPECT_FLOAT_EQ(batch.GetSphere(i).GetRadius(), sphere.GetRadius());
+            EXPECT_THAT(batch.GetAabb(i).GetMin(), IsClose(aabb.GetMin()));
+            EXPECT_THAT(batch.GetAabb(i).GetMax(), IsClose(aabb.GetMax()));
+        }
+
+        batch.Clear();
+        EXPECT_EQ(batch.GetSize(), 0);
+    }
+
+    TEST_F(MATH_BoundingVolumeBatch, ClassifySpheresMatchesFrustum)
+    {
+        // Use a size that isn't a multiple of the lane count to cover the partial last group
+        AZ::BoundingVolumeBatch batch;
+        FillRandom(batch, 1023);
+
+        AZStd::vector<AZ::IntersectResult> results(batch.GetSize());
+        batch.ClassifySpheres(m_frustum, results.data());
+
+        size_t resultCounts[3] = {};
+        for (size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            EXPECT_EQ(results[i], m_frustum.IntersectSphere(batch.GetSphere(i)));
+            ++resultCounts[static_cast<size_t>(results[i])];
+        }
+
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Interior)], 0);
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Overlaps)], 0);
+        EXPECT_GT(resultCounts[static_cast<size_t>(AZ::IntersectResult::Exterior)], 0);
+    }
+
+    TEST_F(MATH_BoundingVolumeBatch, OverlapsAabbsMatchesShapeIntersection)
+    {
+        AZ::BoundingVolumeBatch batch;
+        FillRandom(batch, 1023);
+
+        AZStd::unique_ptr<bool[]> results = AZStd::make_unique<bool[]>(batch.GetSize());
+        batch.OverlapsAabbs(m_frustum, results.get());
+
+        for (size_t i = 0; i < batch.GetSize(); ++i)
+        {
+            EXPECT_EQ(results[i], AZ::ShapeIntersection::Overlaps(m_frustum, batch.GetAabb(i)));
+        }
+    }
+
+    TEST_F(MATH_BoundingVolumeBatch, ReservePreservesVolumes)
+    {
+        AZ::BoundingVolumeBatch batch(2);
+        const AZ::Sphere sphere(AZ::Vector3(0.0f, 50.0f, 0.0f), 1.0f);
+        const AZ::Aabb aabb = AZ::Aabb::CreateCenterRadius(sphere.GetCenter(), 1.0f);
+        batch.PushBack(sphere, aabb);
+        batch.Reserve(64);
+
+        ASSERT_EQ(batch.GetSize(), 1);
+        EXPECT_THAT(batch.GetSphere(0).GetCenter(), IsClose(sphere.GetCenter()));
+        EXPECT_THAT(batch.GetAabb(0).GetMax(), IsClose(aabb.GetMax()));
+
+        AZ::IntersectResult result = AZ::IntersectResult::Exterior;
+        batch.ClassifySpheres(m_frustum, &result);
+        EXPECT_EQ(result, AZ::IntersectResult::Interior);
+    }
+} // namespace UnitTest
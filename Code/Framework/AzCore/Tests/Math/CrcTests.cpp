@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -67,6 +68,23 @@ namespace Benchmark
 
 namespace UnitTest
 {
+    namespace Crc32TestInternal
+    {
+        // Long enough to go through the runtime code that handles 8 bytes at a time, and the remaining bytes
+        constexpr AZStd::string_view MixedCaseText = "The Quick Brown Fox Jumps Over The Lazy Dog @[`{ 0123456789";
+
+        template<bool ForceLowerCase>
+        constexpr AZStd::array<AZ::Crc32, MixedCaseText.size() + 1> CreatePrefixCrcs()
+        {
+            AZStd::array<AZ::Crc32, MixedCaseText.size() + 1> crcs{};
+            for (size_t length = 0; length <= MixedCaseText.size(); ++length)
+            {
+                crcs[length] = AZ::Crc32(MixedCaseText.data(), length, ForceLowerCase);
+            }
+            return crcs;
+        }
+    }
+
     class Crc32Fixture
         : public UnitTest::LeakDetectionFixture
     {
@@ -88,6 +106,22 @@ namespace UnitTest
         static_assert(AZ::Crc32(AZStd::span(byteData)) == AZ::Crc32(0x3528a896));
     }
 
+    TEST_F(Crc32Fixture, RuntimeCrc_MatchesCompileTimeCrc)
+    {
+        using namespace Crc32TestInternal;
+        constexpr auto compileTimeCrcs = CreatePrefixCrcs<false>();
+        constexpr auto compileTimeLowerCaseCrcs = CreatePrefixCrcs<true>();
+
+        const AZStd::string runtimeText(MixedCaseText);
+        for (size_t length = 0; length <= runtimeText.size(); ++length)
+        {
+            EXPECT_EQ(compileTimeCrcs[length], AZ::Crc32(runtimeText.data(), length, false));
+            EXPECT_EQ(compileTimeLowerCaseCrcs[length], AZ::Crc32(runtimeText.data(), length, true));
+            EXPECT_EQ(compileTimeLowerCaseCrcs[length], AZ::Crc32(static_cast<const void*>(runtimeText.data()), length, true));
+        }
+        EXPECT_EQ(AZ::Crc32(0xf44f1a1d), AZ::Crc32(AZStd::string("EditorData")));
+    }
+
     TEST_F(Crc32Fixture, OperatorUint32t_IsConstexpr)
     {
         static_assert(static_cast<AZ::u32>(AZ::Crc32("EditorData")) == 0xf44f1a1d, R"(Crc32 should match the calculation on the string "editordata")");
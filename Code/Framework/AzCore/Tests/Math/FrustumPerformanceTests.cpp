@@ -6,7 +6,9 @@
  *
  */
 
+#include <AzCore/Math/BoundingVolumeBatch.h>
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -38,6 +40,15 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            m_batch.Clear();
+            m_batch.Reserve(m_dataArray.size());
+            for (const Data& data : m_dataArray)
+            {
+                m_batch.PushBack(AZ::Sphere(data.sphereCenter, data.sphereRadius), AZ::Aabb::CreateFromMinMax(data.aabbMin, data.aabbMax));
+            }
+            m_sphereResults.resize(m_dataArray.size());
+            m_aabbResults = AZStd::make_unique<bool[]>(m_dataArray.size());
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -59,6 +70,11 @@ namespace Benchmark
 
         std::vector<Data> m_dataArray;
         AZ::Frustum m_testFrustum;
+
+        // The same volumes in struct-of-arrays form for the batch kernels
+        AZ::BoundingVolumeBatch m_batch;
+        AZStd::vector<AZ::IntersectResult> m_sphereResults;
+        AZStd::unique_ptr<bool[]> m_aabbResults;
     };
 
     BENCHMARK_F(BM_MathFrustum, SphereIntersect)(benchmark::State& state)
@@ -84,6 +100,38 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, AabbOverlaps)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& data : m_dataArray)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_testFrustum, AZ::Aabb::CreateFromMinMax(data.aabbMin, data.aabbMax));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathFrustum, SphereIntersectBatch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_batch.ClassifySpheres(m_testFrustum, m_sphereResults.data());
+            benchmark::DoNotOptimize(m_sphereResults.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_F(BM_MathFrustum, AabbOverlapsBatch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_batch.OverlapsAabbs(m_testFrustum, m_aabbResults.get());
+            benchmark::DoNotOptimize(m_aabbResults.get());
+            benchmark::ClobberMemory();
+        }
+    }
 }
 
 #endif
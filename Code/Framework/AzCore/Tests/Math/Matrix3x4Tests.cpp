@@ -419,6 +419,24 @@ namespace UnitTest
         EXPECT_THAT(result, IsClose(expected));
     }
 
+    TEST(MATH_Matrix3x4, TransformPointsAndVectors_MatchSingleTransforms)
+    {
+        AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.34f, 0.46f, 0.58f, 0.58f), AZ::Vector3(-3.0f, -4.0f, -5.0f));
+        matrix3x4.MultiplyByScale(AZ::Vector3(1.2f, 0.8f, 2.0f));
+        const AZ::Vector3 inputs[] = { AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(-2.5f, 3.0f, 0.7f), AZ::Vector3(10.0f, -20.0f, 30.0f) };
+
+        AZ::Vector3 points[AZ_ARRAY_SIZE(inputs)];
+        matrix3x4.TransformPoints(inputs, points);
+        AZ::Vector3 vectors[AZ_ARRAY_SIZE(inputs)];
+        matrix3x4.TransformVectors(inputs, vectors);
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(inputs); ++i)
+        {
+            EXPECT_THAT(points[i], IsClose(matrix3x4.TransformPoint(inputs[i])));
+            EXPECT_THAT(vectors[i], IsClose(matrix3x4.TransformVector(inputs[i])));
+        }
+    }
+
     TEST(MATH_Matrix3x4, CreateScale)
     {
         const AZ::Vector3 scale(1.7f, 0.3f, 2.4f);
@@ -13,6 +13,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <random>
 #include <benchmark/benchmark.h>
@@ -423,6 +424,43 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_F(BM_MathTransform, TransformPointVector3_SameTransform)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> points;
+        for (auto& testData : m_testDataArray)
+        {
+            points.push_back(testData.v3);
+        }
+        AZStd::vector<AZ::Vector3> results(points.size());
+        const AZ::Transform transform = m_testDataArray.front().t1;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                results[i] = transform.TransformPoint(points[i]);
+            }
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathTransform, TransformPoints)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Vector3> points;
+        for (auto& testData : m_testDataArray)
+        {
+            points.push_back(testData.v3);
+        }
+        AZStd::vector<AZ::Vector3> results(points.size());
+        const AZ::Transform transform = m_testDataArray.front().t1;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            transform.TransformPoints(points, results);
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
     BENCHMARK_F(BM_MathTransform, TransformPointVector4)(benchmark::State& state)
     {
         for ([[maybe_unused]] auto _ : state)
@@ -280,6 +280,32 @@ namespace UnitTest
         EXPECT_THAT(product, IsClose(expected));
     }
 
+    TEST(MATH_Transform, TransformPointsAndVectors_MatchSingleTransforms)
+    {
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.08f, 0.44f, 0.16f, 0.88f), AZ::Vector3(1.0f, 2.0f, 3.0f));
+        transform.MultiplyByUniformScale(1.5f);
+        const AZ::Vector3 inputs[] = { AZ::Vector3(0.2f, 0.1f, -0.3f), AZ::Vector3(-4.0f, 6.0f, 2.5f), AZ::Vector3::CreateZero() };
+
+        AZ::Vector3 points[AZ_ARRAY_SIZE(inputs)];
+        transform.TransformPoints(inputs, points);
+        AZ::Vector3 vectors[AZ_ARRAY_SIZE(inputs)];
+        transform.TransformVectors(inputs, vectors);
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(inputs); ++i)
+        {
+            EXPECT_THAT(points[i], IsClose(transform.TransformPoint(inputs[i])));
+            EXPECT_THAT(vectors[i], IsClose(transform.TransformVector(inputs[i])));
+        }
+
+        // Transforming in place
+        AZ::Vector3 inPlace[AZ_ARRAY_SIZE(inputs)] = { inputs[0], inputs[1], inputs[2] };
+        transform.TransformPoints(inPlace, inPlace);
+        for (size_t i = 0; i < AZ_ARRAY_SIZE(inputs); ++i)
+        {
+            EXPECT_THAT(inPlace[i], IsClose(points[i]));
+        }
+    }
+
     using TransformInvertFixture = ::testing::TestWithParam<AZ::Transform>;
 
     TEST_P(TransformInvertFixture, GetInverse)
@@ -11,6 +11,7 @@
 #include <AzCore/Memory/HphaAllocator.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Debug/StackTracer.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -892,6 +893,71 @@ namespace UnitTest
         run();
     }
 
+    class AllocationSamplingTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::AllocatorManager::Instance().ResetAllocationSamples();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(0);
+            AZ::AllocatorManager::Instance().ResetAllocationSamples();
+            LeakDetectionFixture::TearDown();
+        }
+
+        void AllocateAndFree(size_t count, size_t byteSize)
+        {
+            auto& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            for (size_t i = 0; i < count; ++i)
+            {
+                allocator.deallocate(allocator.allocate(byteSize, 8), byteSize, 8);
+            }
+        }
+    };
+
+    TEST_F(AllocationSamplingTest, SamplingDisabled_NoCallsitesAreRecorded)
+    {
+        AllocateAndFree(1000, 256);
+
+        AZStd::vector<AZ::AllocatorManager::AllocationCallsite> callsites;
+        AZ::AllocatorManager::Instance().GetAllocationCallsites(callsites);
+        EXPECT_TRUE(callsites.empty());
+    }
+
+    TEST_F(AllocationSamplingTest, SamplingEnabled_CallsitesAreAggregatedAndReset)
+    {
+        constexpr size_t samplingInterval = 4096;
+        constexpr size_t allocationCount = 1000;
+        constexpr size_t allocationSize = 256;
+        AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(samplingInterval);
+        AllocateAndFree(allocationCount, allocationSize);
+        AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(0);
+
+        AZStd::vector<AZ::AllocatorManager::AllocationCallsite> callsites;
+        AZ::AllocatorManager::Instance().GetAllocationCallsites(callsites);
+        ASSERT_FALSE(callsites.empty());
+
+        // Every allocation happened at the same callsite, so it should have gathered the most bytes
+        const AZ::AllocatorManager::AllocationCallsite& topCallsite = callsites.front();
+        EXPECT_STREQ(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().GetName(), topCallsite.m_allocatorName.c_str());
+        EXPECT_GT(topCallsite.m_sampleCount, 1);
+        EXPECT_GT(topCallsite.m_numStackFrames, 0);
+        EXPECT_GE(topCallsite.m_estimatedBytes, topCallsite.m_sampleCount * samplingInterval);
+        for (size_t i = 1; i < callsites.size(); ++i)
+        {
+            EXPECT_GE(callsites[i - 1].m_estimatedBytes, callsites[i].m_estimatedBytes);
+        }
+
+        AZ::AllocatorManager::Instance().ResetAllocationSamples();
+        AZ::AllocatorManager::Instance().GetAllocationCallsites(callsites);
+        EXPECT_TRUE(callsites.empty());
+    }
+
 #if AZ_TRAIT_PERF_MEMORYBENCHMARK_IS_AVAILABLE
     class PERF_MemoryBenchmark
         : public ::testing::Test
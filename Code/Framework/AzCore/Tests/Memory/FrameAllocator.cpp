@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace UnitTest
+{
+    class FrameAllocatorTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_allocator = AZStd::make_unique<AZ::FrameAllocator>();
+        }
+
+        void TearDown() override
+        {
+            m_allocator.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        void AdvanceFrames(size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_allocator->AdvanceFrame();
+            }
+        }
+
+        AZStd::unique_ptr<AZ::FrameAllocator> m_allocator;
+    };
+
+    TEST_F(FrameAllocatorTest, Allocate_ReturnsAlignedMemoryOfRequestedSize)
+    {
+        for (size_t alignment : { 1, 8, 16, 64, 256 })
+        {
+            void* address = m_allocator->allocate(24, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(address) % alignment);
+            EXPECT_EQ(24, m_allocator->get_allocated_size(address));
+            memset(address, 0xcd, 24);
+        }
+        EXPECT_GE(m_allocator->NumAllocatedBytes(), AZ::FrameAllocator::BlockSize);
+    }
+
+    TEST_F(FrameAllocatorTest, AdvanceFrame_MemoryIsReusedAfterFrameCountFrames)
+    {
+        void* firstFrameAddress = m_allocator->allocate(64, 16);
+
+        // Allocations stay valid for FrameCount - 1 frames
+        for (size_t frame = 1; frame < AZ::FrameAllocator::FrameCount; ++frame)
+        {
+            m_allocator->AdvanceFrame();
+            EXPECT_NE(firstFrameAddress, m_allocator->allocate(64, 16).GetAddress());
+        }
+
+        m_allocator->AdvanceFrame();
+        EXPECT_EQ(AZ::FrameAllocator::FrameCount, m_allocator->GetFrameIndex());
+        EXPECT_EQ(firstFrameAddress, m_allocator->allocate(64, 16).GetAddress());
+    }
+
+    TEST_F(FrameAllocatorTest, Deallocate_LastAllocation_MemoryIsReused)
+    {
+        void* first = m_allocator->allocate(32, 8);
+        void* second = m_allocator->allocate(32, 8);
+        EXPECT_EQ(32, m_allocator->deallocate(second, 32, 8));
+        EXPECT_EQ(second, m_allocator->allocate(32, 8).GetAddress());
+
+        // Only the allocation on top of the buffer can be given back
+        m_allocator->deallocate(first, 32, 8);
+        EXPECT_NE(first, m_allocator->allocate(32, 8).GetAddress());
+    }
+
+    TEST_F(FrameAllocatorTest, Reallocate_GrowsLastAllocationInPlaceAndCopiesOtherwise)
+    {
+        char* first = static_cast<char*>(m_allocator->allocate(16, 8).GetAddress());
+        memset(first, 1, 16);
+
+        char* grown = static_cast<char*>(m_allocator->reallocate(first, 128, 8).GetAddress());
+        EXPECT_EQ(first, grown);
+        EXPECT_EQ(128, m_allocator->get_allocated_size(grown));
+
+        m_allocator->allocate(16, 8);
+        char* moved = static_cast<char*>(m_allocator->reallocate(grown, 256, 8).GetAddress());
+        ASSERT_NE(grown, moved);
+        for (size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(1, moved[i]);
+        }
+    }
+
+    TEST_F(FrameAllocatorTest, LargeAllocation_BlockIsReleasedWhenTheFrameIsReset)
+    {
+        m_allocator->allocate(16, 8);
+        const size_t regularBytes = m_allocator->NumAllocatedBytes();
+
+        void* large = m_allocator->allocate(AZ::FrameAllocator::BlockSize * 2, 16);
+        ASSERT_NE(nullptr, large);
+        memset(large, 0, AZ::FrameAllocator::BlockSize * 2);
+        EXPECT_GT(m_allocator->NumAllocatedBytes(), regularBytes + AZ::FrameAllocator::BlockSize * 2);
+
+        AdvanceFrames(AZ::FrameAllocator::FrameCount);
+        m_allocator->allocate(16, 8);
+        EXPECT_EQ(regularBytes, m_allocator->NumAllocatedBytes());
+    }
+
+    TEST_F(FrameAllocatorTest, GarbageCollect_SpareBlocksAreReleasedOnTheNextReset)
+    {
+        // Fill several blocks in the first frame
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m_allocator->allocate(AZ::FrameAllocator::BlockSize / 2 + 1, 8);
+        }
+        const size_t filledBytes = m_allocator->NumAllocatedBytes();
+
+        // Resetting the buffer keeps the blocks for later frames
+        AdvanceFrames(AZ::FrameAllocator::FrameCount);
+        m_allocator->allocate(16, 8);
+        EXPECT_EQ(filledBytes, m_allocator->NumAllocatedBytes());
+
+        m_allocator->GarbageCollect();
+        AdvanceFrames(AZ::FrameAllocator::FrameCount);
+        m_allocator->allocate(16, 8);
+        EXPECT_LT(m_allocator->NumAllocatedBytes(), filledBytes);
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_FromSeveralThreads_EachThreadUsesItsOwnArena)
+    {
+        constexpr size_t threadCount = 4;
+        constexpr size_t allocationsPerThread = 1000;
+        void* lastAddresses[threadCount] = {};
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex, &lastAddresses]()
+                {
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        size_t* value = static_cast<size_t*>(m_allocator->allocate(sizeof(size_t), alignof(size_t)).GetAddress());
+                        *value = threadIndex;
+                        lastAddresses[threadIndex] = value;
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            EXPECT_EQ(threadIndex, *static_cast<size_t*>(lastAddresses[threadIndex]));
+        }
+        EXPECT_GE(m_allocator->NumAllocatedBytes(), threadCount * AZ::FrameAllocator::BlockSize);
+    }
+
+    TEST_F(FrameAllocatorTest, FrameVector_UsesTheFrameAllocatorInstance)
+    {
+        AZ::FrameVector<int> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+
+        ASSERT_EQ(1000, values.size());
+        for (int i = 0; i < 1000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+        EXPECT_GT(AZ::AllocatorInstance<AZ::FrameAllocator>::Get().NumAllocatedBytes(), 0);
+    }
+} // namespace UnitTest
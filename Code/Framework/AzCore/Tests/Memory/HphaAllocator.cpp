@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -102,4 +103,83 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaMagazineTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(HphaSchemaMagazineTest, FreedSmallBlocks_AreReusedFromMagazine)
+    {
+        auto schema = AZStd::make_unique<AZ::HphaSchema>();
+        const AZ::AllocatorCacheStats initialStats = schema->GetCacheStats();
+
+        constexpr size_t allocationCount = 100;
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            AZ::IAllocator::pointer address = schema->allocate(64, 8);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(64, schema->NumAllocatedBytes());
+            schema->deallocate(address, 64);
+            EXPECT_EQ(0, schema->NumAllocatedBytes());
+        }
+
+        const AZ::AllocatorCacheStats stats = schema->GetCacheStats();
+        if (stats.m_hits + stats.m_misses > 0)
+        {
+            // Only the first allocation needs to refill the magazine
+            EXPECT_GE(stats.m_hits - initialStats.m_hits, allocationCount - 1);
+        }
+
+        schema->GarbageCollect();
+        EXPECT_EQ(0, schema->NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaMagazineTest, SmallBlocksFreedOnOtherThreads_AreReturnedToTheAllocator)
+    {
+        auto schema = AZStd::make_unique<AZ::HphaSchema>();
+
+        constexpr size_t threadCount = 4;
+        constexpr size_t allocationsPerThread = 1000;
+        AZStd::vector<void*> allocations[threadCount];
+        AZStd::vector<AZStd::thread> threads;
+
+        // Allocate on each thread, then free every thread's allocations on another thread
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&schema, &allocations, threadIndex]()
+                {
+                    for (size_t i = 0; i < allocationsPerThread; ++i)
+                    {
+                        const size_t size = 8 + (i % 32) * 8;
+                        allocations[threadIndex].push_back(schema->allocate(size, 8).GetAddress());
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
+
+        for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back([&schema, &allocations, threadIndex]()
+                {
+                    for (void* allocation : allocations[(threadIndex + 1) % threadCount])
+                    {
+                        EXPECT_NE(nullptr, allocation);
+                        schema->deallocate(allocation);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, schema->NumAllocatedBytes());
+        schema->GarbageCollect();
+        EXPECT_EQ(0, schema->NumAllocatedBytes());
+    }
 }
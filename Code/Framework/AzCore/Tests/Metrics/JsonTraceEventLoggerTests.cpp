@@ -341,6 +341,36 @@ namespace UnitTest
             << R"(" at offset (%u))";
     }
 
+    TEST_F(JsonTraceEventLoggerTest, RecordCompleteEvent_WithTimestampAndThread_WritesThemToStream)
+    {
+        AZStd::string metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput);
+        AZ::Metrics::JsonTraceEventLogger googleTraceLogger(AZStd::move(metricsStream));
+
+        // Record the event on behalf of another thread, the way captured profiler regions are saved after the capture
+        AZStd::thread_id otherThreadId;
+        AZStd::thread otherThread([&otherThreadId]()
+        {
+            otherThreadId = AZStd::this_thread::get_id();
+        });
+        otherThread.join();
+
+        AZ::Metrics::CompleteArgs completeArgs;
+        completeArgs.m_name = "Captured Region";
+        completeArgs.m_cat = "Test";
+        completeArgs.m_ts = AZStd::chrono::microseconds(1234567);
+        completeArgs.m_dur = AZStd::chrono::microseconds(89);
+        completeArgs.m_tid = otherThreadId;
+        EXPECT_TRUE(googleTraceLogger.RecordCompleteEvent(completeArgs));
+        googleTraceLogger.ResetStream(nullptr);
+
+        uintptr_t numericThreadId{};
+        *reinterpret_cast<AZStd::thread_id*>(&numericThreadId) = otherThreadId;
+
+        EXPECT_TRUE(JsonStringContains(metricsOutput, R"("ts": 1234567)"));
+        EXPECT_TRUE(JsonStringContains(metricsOutput, R"("dur": 89)"));
+        EXPECT_TRUE(JsonStringContains(metricsOutput, AZStd::string::format(R"("tid": %llu)", static_cast<unsigned long long>(numericThreadId))));
+    }
 
     TEST_F(JsonTraceEventLoggerTest, TogglingActiveSetting_CanTurnOrOffEventRecording_Succeeds)
     {
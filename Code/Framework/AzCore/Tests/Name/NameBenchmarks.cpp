@@ -9,6 +9,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace AZ::NameBenchmarks
@@ -19,24 +20,40 @@ namespace AZ::NameBenchmarks
         void SetUp(const ::benchmark::State& st) override
         {
             UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
-            AZ::NameDictionary::Create();
+            // Multi-threaded benchmarks share a single dictionary, which is created by the first thread
+            if (st.thread_index() == 0)
+            {
+                AZ::NameDictionary::Create();
+            }
         }
 
         void SetUp(::benchmark::State& st) override
         {
             UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
-            AZ::NameDictionary::Create();
+            // Multi-threaded benchmarks share a single dictionary, which is created by the first thread
+            if (st.thread_index() == 0)
+            {
+                AZ::NameDictionary::Create();
+            }
         }
 
         void TearDown(::benchmark::State& st) override
         {
-            AZ::NameDictionary::Destroy();
+            if (st.thread_index() == 0)
+            {
+                m_sharedNames = {};
+                AZ::NameDictionary::Destroy();
+            }
             UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
         }
 
         void TearDown(const ::benchmark::State& st) override
         {
-            AZ::NameDictionary::Destroy();
+            if (st.thread_index() == 0)
+            {
+                m_sharedNames = {};
+                AZ::NameDictionary::Destroy();
+            }
             UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
         }
 
@@ -49,6 +66,9 @@ namespace AZ::NameBenchmarks
         {
             return AZ::Name("test_literal");
         }
+
+        //! Names shared by all threads of a multi-threaded benchmark, created by the first thread.
+        AZStd::vector<AZ::Name> m_sharedNames;
     };
 
     BENCHMARK_DEFINE_F(NameBenchmarkFixture, CreateNameCacheHit)(::benchmark::State& state)
@@ -177,4 +197,55 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    // Every thread looks up the same existing names, which is the access pattern of asset loading threads
+    BENCHMARK_DEFINE_F(NameBenchmarkFixture, CreateNameCacheHit_Contended)(::benchmark::State& state)
+    {
+        constexpr size_t poolSize = 100;
+        if (state.thread_index() == 0)
+        {
+            for (size_t i = 0; i < poolSize; ++i)
+            {
+                m_sharedNames.emplace_back(AZStd::string::format("name%zu", i));
+            }
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < poolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_sharedNames[i].GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * poolSize);
+    }
+    BENCHMARK_REGISTER_F(NameBenchmarkFixture, CreateNameCacheHit_Contended)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameBenchmarkFixture, FindNameByHash_Contended)(::benchmark::State& state)
+    {
+        constexpr size_t poolSize = 100;
+        if (state.thread_index() == 0)
+        {
+            for (size_t i = 0; i < poolSize; ++i)
+            {
+                m_sharedNames.emplace_back(AZStd::string::format("name%zu", i));
+            }
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < poolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_sharedNames[i].GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * poolSize);
+    }
+    BENCHMARK_REGISTER_F(NameBenchmarkFixture, FindNameByHash_Contended)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
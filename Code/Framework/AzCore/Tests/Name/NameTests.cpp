@@ -439,6 +439,42 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, NameConstructFromHash_AfterReleasingNames_RemainingNamesAreFound)
+    {
+        // Use enough names to grow the dictionary's lookup table several times
+        constexpr size_t nameCount = 4000;
+        AZStd::vector<AZ::Name> nameList;
+        nameList.reserve(nameCount);
+        for (size_t i = 0; i < nameCount; ++i)
+        {
+            nameList.emplace_back(AZStd::string::format("name %zu", i));
+        }
+
+        // Release every other name, which moves entries around in the lookup table
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            nameList[i] = AZ::Name();
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameCount / 2);
+
+        for (size_t i = 1; i < nameCount; i += 2)
+        {
+            AZ::Name nameFromHash{ nameList[i].GetHash() };
+            EXPECT_EQ(nameFromHash, nameList[i]);
+            EXPECT_EQ(nameFromHash.GetStringView(), nameList[i].GetStringView());
+        }
+
+        // Released names are created again with their original contents
+        for (size_t i = 0; i < nameCount; i += 2)
+        {
+            const AZStd::string nameString = AZStd::string::format("name %zu", i);
+            nameList[i] = AZ::Name(nameString);
+            EXPECT_EQ(nameList[i].GetStringView(), nameString);
+            EXPECT_EQ(AZ::Name(nameList[i].GetHash()), nameList[i]);
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), nameCount);
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
@@ -761,11 +761,18 @@ namespace SerializeTestClasses {
 
         int m_field = 0;
     };
+
+    enum class FlatClonableEnum : AZ::u8
+    {
+        First,
+        Second
+    };
 } //SerializeTestClasses
 
 namespace AZ
 {
     AZ_TYPE_INFO_SPECIALIZE(SerializeTestClasses::Generics::GenericEnum, "{1D382230-EF25-4583-812B-7576334AB1A9}");
+    AZ_TYPE_INFO_SPECIALIZE(SerializeTestClasses::FlatClonableEnum, "{E83B6D21-94A7-4F0C-B5D8-3C1F2A7E9064}");
 }
 
 namespace SerializeTestClasses
@@ -3130,6 +3137,67 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             AZStd::unordered_map<int, float*> m_mapOfFloatPointers;
             AZStd::shared_ptr<AZ::Entity> m_sharedEntityPointer;
         };
+
+        struct FlatClonableBase
+        {
+            AZ_RTTI(FlatClonableBase, "{5A1C8E2B-7F3D-4B96-A0E4-2D8C6B91F374}");
+            AZ_CLASS_ALLOCATOR(FlatClonableBase, AZ::SystemAllocator);
+
+            virtual ~FlatClonableBase() = default;
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<FlatClonableBase>()
+                    ->Field("baseInt", &FlatClonableBase::m_baseInt)
+                    ;
+            }
+
+            int m_baseInt = 0;
+        };
+
+        struct FlatClonableInner
+        {
+            AZ_TYPE_INFO(FlatClonableInner, "{C64F0B7A-3E91-4D5C-8B2A-F07D1E6C9A53}");
+            AZ_CLASS_ALLOCATOR(FlatClonableInner, AZ::SystemAllocator);
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<FlatClonableInner>()
+                    ->Field("float", &FlatClonableInner::m_float)
+                    ->Field("vector", &FlatClonableInner::m_vector)
+                    ;
+            }
+
+            float m_float = 0.0f;
+            AZ::Vector3 m_vector = AZ::Vector3::CreateZero();
+        };
+
+        // Only holds values that can be copied byte for byte, so it's cloned through its compiled clone plan.
+        struct FlatClonable
+            : public FlatClonableBase
+        {
+            AZ_RTTI(FlatClonable, "{9E27D5B3-1C48-4A6F-B3D0-86E5A7C2F419}", FlatClonableBase);
+            AZ_CLASS_ALLOCATOR(FlatClonable, AZ::SystemAllocator);
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Enum<SerializeTestClasses::FlatClonableEnum>();
+                serializeContext.Class<FlatClonable, FlatClonableBase>()
+                    ->Field("int", &FlatClonable::m_int)
+                    ->Field("bool", &FlatClonable::m_bool)
+                    ->Field("enum", &FlatClonable::m_enum)
+                    ->Field("inner", &FlatClonable::m_inner)
+                    ->Field("uuid", &FlatClonable::m_uuid)
+                    ;
+            }
+
+            AZ::s64 m_int = 0;
+            bool m_bool = false;
+            SerializeTestClasses::FlatClonableEnum m_enum = SerializeTestClasses::FlatClonableEnum::First;
+            FlatClonableInner m_inner;
+            int m_notReflected = 0;
+            AZ::Uuid m_uuid = AZ::Uuid::CreateNull();
+        };
     }
     TEST_F(Serialization, CloneTest)
     {
@@ -3544,6 +3612,56 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
         m_serializeContext->DisableRemoveReflection();
     }
 
+    TEST_F(Serialization, Clone_FlatClass_CopiesReflectedValuesOnly)
+    {
+        using namespace Clone;
+
+        FlatClonableBase::Reflect(*m_serializeContext);
+        FlatClonableInner::Reflect(*m_serializeContext);
+        FlatClonable::Reflect(*m_serializeContext);
+
+        FlatClonable testObj;
+        testObj.m_baseInt = 7;
+        testObj.m_int = -1234567890123;
+        testObj.m_bool = true;
+        testObj.m_enum = SerializeTestClasses::FlatClonableEnum::Second;
+        testObj.m_inner.m_float = 2.5f;
+        testObj.m_inner.m_vector = AZ::Vector3(1.0f, 2.0f, 3.0f);
+        testObj.m_notReflected = 42;
+        testObj.m_uuid = AZ::Uuid("{0F4B2A6D-8C31-4E57-9A2B-D6E1C7F30584}");
+
+        // The second clone uses the plan that was compiled for the first one.
+        for (int i = 0; i < 2; ++i)
+        {
+            AZStd::unique_ptr<FlatClonable> cloneObj(m_serializeContext->CloneObject(&testObj));
+            ASSERT_NE(nullptr, cloneObj);
+            EXPECT_EQ(testObj.m_baseInt, cloneObj->m_baseInt);
+            EXPECT_EQ(testObj.m_int, cloneObj->m_int);
+            EXPECT_EQ(testObj.m_bool, cloneObj->m_bool);
+            EXPECT_EQ(testObj.m_enum, cloneObj->m_enum);
+            EXPECT_EQ(testObj.m_inner.m_float, cloneObj->m_inner.m_float);
+            EXPECT_EQ(testObj.m_inner.m_vector, cloneObj->m_inner.m_vector);
+            EXPECT_EQ(testObj.m_uuid, cloneObj->m_uuid);
+            EXPECT_EQ(0, cloneObj->m_notReflected);
+        }
+
+        // Every element of a container of flat classes is copied.
+        AZStd::vector<FlatClonable> testVector(3, testObj);
+        testVector[2].m_int = 99;
+        AZStd::vector<FlatClonable> cloneVector;
+        m_serializeContext->CloneObjectInplace(cloneVector, &testVector);
+        ASSERT_EQ(testVector.size(), cloneVector.size());
+        EXPECT_EQ(testObj.m_int, cloneVector[0].m_int);
+        EXPECT_EQ(99, cloneVector[2].m_int);
+        EXPECT_EQ(testObj.m_inner.m_vector, cloneVector[2].m_inner.m_vector);
+
+        m_serializeContext->EnableRemoveReflection();
+        FlatClonable::Reflect(*m_serializeContext);
+        FlatClonableInner::Reflect(*m_serializeContext);
+        FlatClonableBase::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
 
     // Prove that if a member of a vector of baseclass pointers is unreadable, the container
     // removes the element instead of leaving a null.  This is an arbitrary choice (to remove or leave
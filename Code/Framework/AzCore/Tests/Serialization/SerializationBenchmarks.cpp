@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/Json/JsonSerializationSettings.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <benchmark/benchmark.h>
+
+namespace AZ::SerializationBenchmarks
+{
+    //! Roughly the shape of an entity in a prefab: a few scalars, a name and a list of component names.
+    struct BenchmarkRecord
+    {
+        AZ_TYPE_INFO(BenchmarkRecord, "{6D1E4A43-3B5C-4F0B-9F79-6A2E2B7F8C51}");
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<BenchmarkRecord>()
+                    ->Version(1)
+                    ->Field("Id", &BenchmarkRecord::m_id)
+                    ->Field("Name", &BenchmarkRecord::m_name)
+                    ->Field("Scale", &BenchmarkRecord::m_scale)
+                    ->Field("Active", &BenchmarkRecord::m_active)
+                    ->Field("Components", &BenchmarkRecord::m_components)
+                    ;
+            }
+        }
+
+        AZ::u64 m_id = 0;
+        AZStd::string m_name;
+        float m_scale = 1.0f;
+        bool m_active = true;
+        AZStd::vector<AZStd::string> m_components;
+    };
+
+    struct BenchmarkDocument
+    {
+        AZ_TYPE_INFO(BenchmarkDocument, "{0B7C5E9A-2F4D-4C8E-8E3B-5D1A9C6F2E47}");
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<BenchmarkDocument>()
+                    ->Version(1)
+                    ->Field("Records", &BenchmarkDocument::m_records)
+                    ;
+            }
+        }
+
+        AZStd::vector<BenchmarkRecord> m_records;
+    };
+
+    class SerializationBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpContexts();
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            SetUpContexts();
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            TearDownContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            TearDownContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        //! Creates a document with the given number of records, each with a handful of components.
+        BenchmarkDocument CreateDocument(int64_t recordCount) const
+        {
+            BenchmarkDocument document;
+            document.m_records.resize(aznumeric_cast<size_t>(recordCount));
+            for (size_t i = 0; i < document.m_records.size(); ++i)
+            {
+                BenchmarkRecord& record = document.m_records[i];
+                record.m_id = i;
+                record.m_name = AZStd::string::format("Entity_%zu", i);
+                record.m_scale = 1.0f + static_cast<float>(i % 10);
+                record.m_active = (i % 3) != 0;
+                record.m_components = { "TransformComponent", "MeshComponent", "MaterialComponent", "ScriptComponent" };
+            }
+            return document;
+        }
+
+        AZStd::vector<char> SaveToObjectStream(const BenchmarkDocument& document, AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, streamType, &document, m_serializeContext.get());
+            return buffer;
+        }
+
+        void LoadFromObjectStream(AZ::DataStream::StreamType streamType, ::benchmark::State& state)
+        {
+            const AZStd::vector<char> buffer = SaveToObjectStream(CreateDocument(state.range(0)), streamType);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                BenchmarkDocument document;
+                AZ::IO::ByteContainerStream<const AZStd::vector<char>> stream(&buffer);
+                AZ::Utils::LoadObjectFromStreamInPlace(stream, document, m_serializeContext.get());
+                benchmark::DoNotOptimize(document.m_records.data());
+            }
+
+            state.SetBytesProcessed(state.iterations() * aznumeric_cast<int64_t>(buffer.size()));
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+    protected:
+        void SetUpContexts()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            m_jsonSystemComponent = AZStd::make_unique<AZ::JsonSystemComponent>();
+
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            BenchmarkRecord::Reflect(m_serializeContext.get());
+            BenchmarkDocument::Reflect(m_serializeContext.get());
+
+            m_serializerSettings.m_serializeContext = m_serializeContext.get();
+            m_serializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+        }
+
+        void TearDownContexts()
+        {
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            m_jsonSystemComponent->Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+
+            m_serializeContext->EnableRemoveReflection();
+            BenchmarkRecord::Reflect(m_serializeContext.get());
+            BenchmarkDocument::Reflect(m_serializeContext.get());
+            m_serializeContext->DisableRemoveReflection();
+
+            m_serializerSettings = {};
+            m_deserializerSettings = {};
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+            m_jsonSystemComponent.reset();
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZStd::unique_ptr<AZ::JsonSystemComponent> m_jsonSystemComponent;
+        AZ::JsonSerializerSettings m_serializerSettings;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+    };
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, ObjectStreamBinaryLoad)(::benchmark::State& state)
+    {
+        LoadFromObjectStream(AZ::DataStream::ST_BINARY, state);
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, ObjectStreamBinaryLoad)->RangeMultiplier(10)->Range(10, 10000);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, ObjectStreamXmlLoad)(::benchmark::State& state)
+    {
+        LoadFromObjectStream(AZ::DataStream::ST_XML, state);
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, ObjectStreamXmlLoad)->RangeMultiplier(10)->Range(10, 10000);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, JsonLoad)(::benchmark::State& state)
+    {
+        AZStd::string jsonText;
+        {
+            const BenchmarkDocument source = CreateDocument(state.range(0));
+            AZ::IO::ByteContainerStream<AZStd::string> stream(&jsonText);
+            AZ::JsonSerializationUtils::SaveObjectToStream(&source, stream, nullptr, &m_serializerSettings);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            BenchmarkDocument document;
+            AZ::JsonSerializationUtils::LoadObjectFromStringByType(
+                &document, azrtti_typeid<BenchmarkDocument>(), jsonText, &m_deserializerSettings);
+            benchmark::DoNotOptimize(document.m_records.data());
+        }
+
+        state.SetBytesProcessed(state.iterations() * aznumeric_cast<int64_t>(jsonText.size()));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, JsonLoad)->RangeMultiplier(10)->Range(10, 10000);
+} // namespace AZ::SerializationBenchmarks
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadTracePrefetcher.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ReadTracePrefetcherTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ReadTracePrefetcher>
+    {
+    public:
+        ReadTracePrefetcher CreateInstance() override
+        {
+            return ReadTracePrefetcher(1 * 1024 * 1024, 4, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_ReadTracePrefetcherConformityTests, StreamStackEntryConformityTests, ReadTracePrefetcherTestDescription);
+
+    class Streamer_ReadTracePrefetcherTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::Return;
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_prefetcher = AZStd::make_shared<ReadTracePrefetcher>(m_cacheSize, 2, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_prefetcher->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_prefetcher->SetContext(*m_context);
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).WillRepeatedly(Invoke(this, &Streamer_ReadTracePrefetcherTest::QueueReadRequest));
+        }
+
+        void TearDown() override
+        {
+            m_prefetcher = nullptr;
+            m_mock = nullptr;
+            m_context.reset();
+
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        void QueueReadRequest(FileRequest* request)
+        {
+            auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+            ASSERT_NE(nullptr, data);
+
+            u8* buffer = reinterpret_cast<u8*>(data->m_output);
+            for (u64 i = 0; i < data->m_size; ++i)
+            {
+                buffer[i] = aznumeric_cast<u8>(data->m_offset + i);
+            }
+            ++m_numReadsOnNext;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void RunProcessLoop()
+        {
+            do
+            {
+                while (m_context->FinalizeCompletedRequests())
+                {
+                }
+            } while (m_prefetcher->ExecuteRequests());
+        }
+
+        void SendCommand(AZStd::any command)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCustom(AZStd::move(command));
+            m_prefetcher->QueueRequest(request);
+            RunProcessLoop();
+        }
+
+        IStreamerTypes::RequestStatus Read(u8* output, u64 offset, u64 size)
+        {
+            IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, size, m_path, offset, size);
+            request->SetCompletionCallback([&result](const FileRequest& request)
+                {
+                    result = request.GetStatus();
+                });
+            m_prefetcher->QueueRequest(request);
+            RunProcessLoop();
+            return result;
+        }
+
+        void VerifyBuffer(const u8* buffer, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(aznumeric_cast<u8>(offset + i), buffer[i]);
+            }
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<ReadTracePrefetcher> m_prefetcher;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        RequestPath m_path{ "Test" };
+        u64 m_cacheSize{ 64 * 1024 };
+        u32 m_numReadsOnNext{ 0 };
+    };
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, SaveAndLoad_TraceWithPathWithSpaces_TraceIsRestored)
+    {
+        ReadTrace trace;
+        trace.push_back({ AZ::IO::Path("levels/test level/level.spawnable"), 512, 1024 });
+        trace.push_back({ AZ::IO::Path("textures/test.dds"), 0, 4096 });
+
+        AZStd::vector<u8> data;
+        AZ::IO::ByteContainerStream stream(&data);
+        ASSERT_TRUE(SaveReadTrace(stream, trace));
+
+        stream.Seek(0, GenericStream::ST_SEEK_BEGIN);
+        ReadTrace loaded;
+        ASSERT_TRUE(LoadReadTrace(stream, loaded));
+        ASSERT_EQ(trace.size(), loaded.size());
+        for (size_t i = 0; i < trace.size(); ++i)
+        {
+            EXPECT_EQ(trace[i].m_path, loaded[i].m_path);
+            EXPECT_EQ(trace[i].m_offset, loaded[i].m_offset);
+            EXPECT_EQ(trace[i].m_size, loaded[i].m_size);
+        }
+    }
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, Load_StreamWithoutTrace_Fails)
+    {
+        AZStd::string text = "Not a read trace";
+        AZ::IO::ByteContainerStream stream(&text);
+
+        ReadTrace loaded;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(LoadReadTrace(stream, loaded));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, StopRecording_ReadsWhileRecording_ReadsAreInTrace)
+    {
+        u8 buffer[256];
+        SendCommand(AZStd::any(ReadTraceRequests::StartRecording{}));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 1024, 256));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 0, 128));
+
+        ReadTrace trace;
+        SendCommand(AZStd::any(ReadTraceRequests::StopRecording{ &trace }));
+        ASSERT_EQ(2, trace.size());
+        EXPECT_EQ(1024, trace[0].m_offset);
+        EXPECT_EQ(256, trace[0].m_size);
+        EXPECT_EQ(0, trace[1].m_offset);
+        EXPECT_EQ(128, trace[1].m_size);
+
+        // Reads after the recording stopped aren't added.
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 0, 128));
+        ReadTrace emptyTrace;
+        SendCommand(AZStd::any(ReadTraceRequests::StopRecording{ &emptyTrace }));
+        EXPECT_TRUE(emptyTrace.empty());
+    }
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, ReadFile_ReadsMatchTrace_ReadsServedFromPrefetches)
+    {
+        ReadTraceRequests::StartPrefetching command;
+        command.m_trace.push_back({ AZ::IO::Path(m_path.GetRelativePath()), 1024, 256 });
+        command.m_trace.push_back({ AZ::IO::Path(m_path.GetRelativePath()), 0, 128 });
+        SendCommand(AZStd::any(AZStd::move(command)));
+        EXPECT_EQ(2, m_numReadsOnNext);
+
+        u8 buffer[256];
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 1024, 256));
+        VerifyBuffer(buffer, 1024, 256);
+        // Part of a prefetch is also served from the prefetched data.
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 32, 64));
+        VerifyBuffer(buffer, 32, 64);
+
+        EXPECT_EQ(2, m_numReadsOnNext);
+        EXPECT_DOUBLE_EQ(1.0, m_prefetcher->CalculateHitRatePercentage());
+    }
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, ReadFile_ReadNotInTrace_ReadIsForwarded)
+    {
+        ReadTraceRequests::StartPrefetching command;
+        command.m_trace.push_back({ AZ::IO::Path(m_path.GetRelativePath()), 0, 128 });
+        SendCommand(AZStd::any(AZStd::move(command)));
+        EXPECT_EQ(1, m_numReadsOnNext);
+
+        u8 buffer[256];
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer, 4096, 256));
+        VerifyBuffer(buffer, 4096, 256);
+        EXPECT_EQ(2, m_numReadsOnNext);
+    }
+
+    TEST_F(Streamer_ReadTracePrefetcherTest, ExecuteRequests_TraceLargerThanCache_PrefetchesWaitForReads)
+    {
+        ReadTraceRequests::StartPrefetching command;
+        command.m_trace.push_back({ AZ::IO::Path(m_path.GetRelativePath()), 0, m_cacheSize });
+        command.m_trace.push_back({ AZ::IO::Path(m_path.GetRelativePath()), m_cacheSize, 256 });
+        SendCommand(AZStd::any(AZStd::move(command)));
+        EXPECT_EQ(1, m_numReadsOnNext);
+
+        AZStd::vector<u8> buffer(m_cacheSize);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer.data(), 0, m_cacheSize));
+        // Reading the first prefetch released enough memory for the second one.
+        EXPECT_EQ(2, m_numReadsOnNext);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Read(buffer.data(), m_cacheSize, 256));
+        VerifyBuffer(buffer.data(), m_cacheSize, 256);
+        EXPECT_EQ(2, m_numReadsOnNext);
+    }
+} // namespace AZ::IO
@@ -10,6 +10,7 @@
 #include <AzCore/IO/Streamer/Streamer.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/containers/map.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -428,4 +429,62 @@ namespace AZ::IO
             m_streamer->m_streamStack->Thread_PrioritizeRequests(&sameFileRequest->m_request, &sameFileRequest2->m_request),
             Scheduler::Order::Equal);
     }
+
+    TEST_F(Streamer_SchedulerTest, BandwidthClasses_PopNextRequest_ClassesShareBandwidthByWeight)
+    {
+        using ::testing::_;
+
+        // Use a scheduler that isn't running so the prepared requests can be inspected directly.
+        auto mock = AZStd::make_shared<StreamStackEntryMock>();
+        ON_CALL(*mock, UpdateStatus(_)).WillByDefault([](StreamStackEntry::Status& status)
+            {
+                status.m_numAvailableSlots = 1;
+                status.m_isIdle = true;
+            });
+        EXPECT_CALL(*mock, UpdateStatus(_)).Times(1);
+        Scheduler scheduler(mock);
+
+        AZStd::map<AZStd::string, BandwidthClassConfig> classes;
+        classes["Textures"].m_extensions.push_back(".tex");
+        classes["Textures"].m_weight = 2;
+        classes["Audio"].m_extensions.push_back("wav");
+        classes["Audio"].m_weight = 1;
+        scheduler.SetBandwidthClasses(classes);
+
+        char fakeBuffer[100];
+        auto queueRead = [&scheduler, &fakeBuffer](const char* path)
+        {
+            FileRequest* readRequest = scheduler.m_context.GetNewInternalRequest();
+            readRequest->CreateReadRequest(RequestPath(path), fakeBuffer, sizeof(fakeBuffer), 0, sizeof(fakeBuffer),
+                AZStd::chrono::steady_clock::time_point::max(), IStreamerTypes::s_priorityMedium);
+            auto readRequestData = AZStd::get_if<Requests::ReadRequestData>(&readRequest->GetCommand());
+            readRequestData->m_bandwidthClass = scheduler.Thread_FindBandwidthClass(readRequestData->m_path);
+
+            FileRequest* read = scheduler.m_context.GetNewInternalRequest();
+            read->CreateRead(readRequest, fakeBuffer, sizeof(fakeBuffer), readRequestData->m_path, 0, sizeof(fakeBuffer));
+            scheduler.m_context.PushPreparedRequest(read);
+        };
+        queueRead("texture0.tex");
+        queueRead("texture1.TEX");
+        queueRead("texture2.tex");
+        queueRead("texture3.tex");
+        queueRead("sound0.wav");
+        queueRead("sound1.wav");
+
+        // Textures get twice the bandwidth of audio, so the audio reads are interleaved with the texture reads instead of
+        // waiting for all texture reads to complete.
+        const char* expectedOrder[] = { "texture0.tex", "sound0.wav", "texture1.TEX", "texture2.tex", "sound1.wav", "texture3.tex" };
+        for (const char* expected : expectedOrder)
+        {
+            FileRequest* next = scheduler.Thread_PopNextRequest();
+            ASSERT_NE(nullptr, next);
+            auto readData = AZStd::get_if<Requests::ReadData>(&next->GetCommand());
+            ASSERT_NE(nullptr, readData);
+            EXPECT_STREQ(expected, readData->m_path.GetRelativePathCStr());
+
+            FileRequest* parent = scheduler.m_context.RejectRequest(next);
+            scheduler.m_context.RejectRequest(parent);
+        }
+        EXPECT_TRUE(scheduler.m_context.GetPreparedRequests().empty());
+    }
 } // namespace AZ::IO
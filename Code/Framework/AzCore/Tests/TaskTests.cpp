@@ -9,6 +9,7 @@
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Threading/ThreadUtils.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -624,6 +625,89 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    class TopologyAwareTaskGraphTestFixture : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            AZ::TaskExecutorDesc desc;
+            desc.m_topologyAware = true;
+            m_executor = aznew TaskExecutor(desc);
+        }
+
+        void TearDown() override
+        {
+            azdestroy(m_executor);
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        TaskExecutor* m_executor;
+    };
+
+    TEST_F(TopologyAwareTaskGraphTestFixture, WorkersCoverAllCacheDomains)
+    {
+        size_t coreCount = 0;
+        for (const AZ::Threading::CacheDomain& domain : AZ::Threading::GetLastLevelCacheDomains())
+        {
+            EXPECT_FALSE(domain.empty());
+            coreCount += domain.size();
+        }
+        EXPECT_EQ(coreCount, m_executor->GetWorkerCount());
+        EXPECT_EQ(AZ::Threading::GetLastLevelCacheDomains().size(), m_executor->GetCacheDomainCount());
+    }
+
+    TEST_F(TopologyAwareTaskGraphTestFixture, WideFanOut)
+    {
+        AZStd::atomic<int> x = 0;
+        constexpr int numTasks = 1000;
+
+        TaskGraph graph{ "WideFanOut" };
+        auto root = graph.AddTask(defaultTD, [] {});
+        auto join = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x += 1;
+            });
+        for (int i = 0; i < numTasks; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    x += 2;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(numTasks * 2 + 1, x);
+    }
+
+    TEST(ThreadUtilsTests, ParseCpuList_RangesAndSingles_Parsed)
+    {
+        AZStd::vector<uint32_t> cores;
+        EXPECT_TRUE(AZ::Threading::ParseCpuList("0-3,8, 10-11\n", cores));
+        EXPECT_EQ((AZStd::vector<uint32_t>{ 0, 1, 2, 3, 8, 10, 11 }), cores);
+    }
+
+    TEST(ThreadUtilsTests, ParseCpuList_Malformed_LeavesCoresUnchanged)
+    {
+        AZStd::vector<uint32_t> cores{ 5 };
+        EXPECT_FALSE(AZ::Threading::ParseCpuList("0-3,x", cores));
+        EXPECT_FALSE(AZ::Threading::ParseCpuList("4-2", cores));
+        EXPECT_FALSE(AZ::Threading::ParseCpuList("0-4294967295", cores));
+        EXPECT_FALSE(AZ::Threading::ParseCpuList("99999999999", cores));
+        EXPECT_EQ(AZStd::vector<uint32_t>{ 5 }, cores);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
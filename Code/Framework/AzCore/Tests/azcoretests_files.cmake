@@ -111,6 +111,7 @@ set(FILES
     GenericStreamMock.h
     GenericStreamTests.cpp
     Math/AabbTests.cpp
+    Math/BoundingVolumeBatchTests.cpp
     Math/CapsuleTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
@@ -164,6 +165,7 @@ set(FILES
     Math/VectorNTests.cpp
     Math/VectorNPerformanceTests.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -229,6 +231,7 @@ set(FILES
     Serialization/Json/UnorderedSetSerializerTests.cpp
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
+    Serialization/SerializationBenchmarks.cpp
     Serialization.cpp
     SerializeContextFixture.h
     Settings/CommandLineTests.cpp
@@ -253,6 +256,7 @@ set(FILES
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
     Streamer/ReadSplitterTests.cpp
+    Streamer/ReadTracePrefetcherTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
@@ -24,6 +24,7 @@
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -2122,7 +2123,12 @@ namespace AZ::IO
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
         AZ_Assert(serializeContext, "Failed to retrieve serialize context.");
-        auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
+        auto catalogInfo = AZStd::make_shared<AzFramework::AssetRegistry>();
+        AZ::IO::MemoryStream catalogStream(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed);
+        if (!AzFramework::AssetRegistry::LoadFromStream(catalogStream, *catalogInfo, serializeContext))
+        {
+            return {};
+        }
 
         return catalogInfo;
     }
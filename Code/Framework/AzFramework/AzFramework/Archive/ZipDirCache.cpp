@@ -150,9 +150,31 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_fileIndex.clear();
+        m_hasFileIndex = false;
         m_treeDir.Clear();
     }
 
+    void Cache::BuildFileIndex()
+    {
+        m_fileIndex.clear();
+        m_fileIndex.reserve(m_treeDir.NumFilesTotal());
+
+        auto AddFiles = [this](auto&& self, FileEntryTree* tree, const AZ::IO::Path& parentPath) -> void
+        {
+            for (auto fileIt = tree->GetFileBegin(); fileIt != tree->GetFileEnd(); ++fileIt)
+            {
+                m_fileIndex.emplace(parentPath / fileIt->first, fileIt->second.get());
+            }
+            for (auto dirIt = tree->GetDirBegin(); dirIt != tree->GetDirEnd(); ++dirIt)
+            {
+                self(self, dirIt->second.get(), parentPath / dirIt->first);
+            }
+        };
+        AddFiles(AddFiles, &m_treeDir, AZ::IO::Path{});
+        m_hasFileIndex = true;
+    }
+
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
     {
         if (size == 0)
@@ -735,8 +757,20 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry{};
+        // Rooted paths are resolved by FindExact, which locates the root directory first
+        if (m_hasFileIndex && !szPath.HasRootPath())
+        {
+            if (auto fileIt = m_fileIndex.find(szPath); fileIt != m_fileIndex.end())
+            {
+                fileEntry = fileIt->second;
+            }
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
@@ -18,6 +18,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
@@ -113,6 +114,10 @@ namespace AZ::IO::ZipDir
         bool WriteCDR(AZ::IO::HandleType fTarget);
 
         bool RelinkZip();
+
+        // builds the table of full file paths used by FindFile, so that lookups don't walk the directory tree.
+        // only used for read-only caches, since the table isn't updated when files are added or removed
+        void BuildFileIndex();
     protected:
         bool RelinkZip(AZ::IO::HandleType fTmp);
         // writes out the file data in the queue into the given file. Empties the queue
@@ -137,6 +142,19 @@ namespace AZ::IO::ZipDir
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZ::IO::Path> m_relativePathPool;
 
+        // Hashes and compares the paths in the file index, allows finding a Path key with a PathView
+        struct FileIndexHasher
+        {
+            using is_transparent = void;
+            size_t operator()(AZ::IO::PathView path) const
+            {
+                return AZStd::hash<AZ::IO::PathView>{}(path);
+            }
+        };
+        // Full path of every file in the tree, filled in by BuildFileIndex
+        AZStd::flat_hash_map<AZ::IO::Path, FileEntry*, FileIndexHasher, AZStd::equal_to<>> m_fileIndex;
+        bool m_hasFileIndex = false;
+
         // offset to the start of CDR in the file,even if there's no CDR there currently
         // when a new file is added, it can start from here, but this value will need to be updated then
         uint32_t m_lCDROffset = 0;
@@ -89,6 +89,8 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+            // the tree of a read-only pack never changes, so the file paths can be hashed once at mount time
+            pCache->BuildFileIndex();
         }
         else
         {
@@ -606,12 +606,12 @@ namespace AzFramework
                     AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
                     [this, &catalogStream, &serializeContext]
                     {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        AssetRegistry::LoadFromStream(catalogStream, *m_registry.get(), serializeContext);
                     },
                         "Asset Catalog Loading Thread"
                         );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                AssetRegistry::LoadFromStream(catalogStream, *m_registry.get(), serializeContext);
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
 
                 AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
@@ -1086,7 +1086,22 @@ namespace AzFramework
     AZStd::shared_ptr<AzFramework::AssetRegistry> AssetCatalog::LoadCatalogFromFile(const char* catalogFile)
     {
         AZStd::shared_ptr<AzFramework::AssetRegistry> deltaCatalog;
-        deltaCatalog.reset(AZ::Utils::LoadObjectFromFile<AzFramework::AssetRegistry>(catalogFile));
+        AZ::IO::FileIOStream fileStream;
+        if (fileStream.Open(catalogFile, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
+        {
+            // Read the whole file at once, the catalog is loaded with many small reads
+            AZStd::vector<char> bytes;
+            bytes.resize_no_construct(fileStream.GetLength());
+            if (fileStream.Read(bytes.size(), bytes.data()) == bytes.size())
+            {
+                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+                deltaCatalog = AZStd::make_shared<AzFramework::AssetRegistry>();
+                if (!AssetRegistry::LoadFromStream(catalogStream, *deltaCatalog))
+                {
+                    deltaCatalog.reset();
+                }
+            }
+        }
         if (!deltaCatalog)
         {
             AZ_Error("AssetCatalog", false, "Failed to load catalog %s", catalogFile);
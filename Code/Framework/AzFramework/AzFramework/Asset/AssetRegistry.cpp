@@ -8,8 +8,11 @@
  */
 
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/IO/SystemFile.h> // for max path
@@ -42,6 +45,83 @@ namespace AssetRegistryInternal
 
         return AZ::Uuid::CreateData(name | AZStd::views::transform(TransformPath));
     }
+
+    // Layout of AssetRegistry::SaveCompact, the tag is followed by the version and then one section per map.
+    // Each section starts with its number of entries as a u64.
+    constexpr char CompactFormatTag[8] = { 'A', 'Z', 'A', 'S', 'S', 'R', 'E', 'G' };
+    constexpr AZ::u32 CompactFormatVersion = 1;
+    // Smallest size of an entry in any section, used to reject entry counts that can't fit in the stream
+    constexpr AZ::u64 MinCompactEntrySize = sizeof(AZ::Uuid) + sizeof(AZ::u32);
+
+    static_assert(AZStd::is_trivially_copyable_v<AZ::Uuid> && sizeof(AZ::Uuid) == 16, "Uuid is expected to be copyable as 16 bytes");
+
+    template<class T>
+    void WriteValue(AZ::IO::GenericStream& stream, const T& value)
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as bytes");
+        stream.Write(sizeof(T), &value);
+    }
+
+    template<class T>
+    bool ReadValue(AZ::IO::GenericStream& stream, T& value)
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "Only trivially copyable values can be read as bytes");
+        return stream.Read(sizeof(T), &value) == sizeof(T);
+    }
+
+    void WriteAssetId(AZ::IO::GenericStream& stream, const AZ::Data::AssetId& assetId)
+    {
+        WriteValue(stream, assetId.m_guid);
+        WriteValue(stream, assetId.m_subId);
+    }
+
+    bool ReadAssetId(AZ::IO::GenericStream& stream, AZ::Data::AssetId& assetId)
+    {
+        return ReadValue(stream, assetId.m_guid) && ReadValue(stream, assetId.m_subId);
+    }
+
+    bool ReadEntryCount(AZ::IO::GenericStream& stream, AZ::u64& count)
+    {
+        if (!ReadValue(stream, count))
+        {
+            return false;
+        }
+        const AZ::u64 remainingSize = stream.GetLength() - stream.GetCurPos();
+        return count <= remainingSize / MinCompactEntrySize;
+    }
+
+    template<class Map>
+    void WriteAssetIdPairs(AZ::IO::GenericStream& stream, const Map& map)
+    {
+        WriteValue(stream, static_cast<AZ::u64>(map.size()));
+        for (const auto& [key, value] : map)
+        {
+            WriteAssetId(stream, key);
+            WriteAssetId(stream, value);
+        }
+    }
+
+    template<class Map>
+    bool ReadAssetIdPairs(AZ::IO::GenericStream& stream, Map& map)
+    {
+        AZ::u64 count = 0;
+        if (!ReadEntryCount(stream, count))
+        {
+            return false;
+        }
+        map.reserve(count);
+        for (AZ::u64 index = 0; index < count; ++index)
+        {
+            AZ::Data::AssetId key;
+            AZ::Data::AssetId value;
+            if (!ReadAssetId(stream, key) || !ReadAssetId(stream, value))
+            {
+                return false;
+            }
+            map.emplace(key, value);
+        }
+        return true;
+    }
 }
 
 namespace AzFramework
@@ -88,6 +168,191 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // AssetRegistry::SaveCompact
+    //=========================================================================
+    bool AssetRegistry::SaveCompact(AZ::IO::GenericStream& stream) const
+    {
+        if (!stream.CanWrite())
+        {
+            return false;
+        }
+
+        stream.Write(sizeof(CompactFormatTag), CompactFormatTag);
+        WriteValue(stream, CompactFormatVersion);
+
+        WriteValue(stream, static_cast<AZ::u64>(m_assetIdToInfo.size()));
+        for (const auto& [assetId, assetInfo] : m_assetIdToInfo)
+        {
+            WriteAssetId(stream, assetId);
+            WriteAssetId(stream, assetInfo.m_assetId);
+            WriteValue(stream, assetInfo.m_assetType);
+            WriteValue(stream, assetInfo.m_sizeBytes);
+            WriteValue(stream, static_cast<AZ::u32>(assetInfo.m_relativePath.size()));
+            stream.Write(assetInfo.m_relativePath.size(), assetInfo.m_relativePath.data());
+        }
+
+        WriteValue(stream, static_cast<AZ::u64>(m_assetPathToId.size()));
+        for (const auto& [pathUuid, assetId] : m_assetPathToId)
+        {
+            WriteValue(stream, pathUuid);
+            WriteAssetId(stream, assetId);
+        }
+
+        WriteAssetIdPairs(stream, m_legacyAssetIdToRealAssetId);
+        WriteAssetIdPairs(stream, m_realAssetIdToLegacyAssetIdMap);
+
+        WriteValue(stream, static_cast<AZ::u64>(m_assetDependencies.size()));
+        for (const auto& [assetId, dependencies] : m_assetDependencies)
+        {
+            WriteAssetId(stream, assetId);
+            WriteValue(stream, static_cast<AZ::u32>(dependencies.size()));
+            for (const AZ::Data::ProductDependency& dependency : dependencies)
+            {
+                WriteAssetId(stream, dependency.m_assetId);
+                WriteValue(stream, static_cast<AZ::u64>(dependency.m_flags.to_ullong()));
+            }
+        }
+        return true;
+    }
+
+    //=========================================================================
+    // AssetRegistry::IsCompactStream
+    //=========================================================================
+    bool AssetRegistry::IsCompactStream(AZ::IO::GenericStream& stream)
+    {
+        if (!stream.CanRead() || !stream.CanSeek())
+        {
+            return false;
+        }
+
+        const AZ::IO::SizeType startPosition = stream.GetCurPos();
+        char tag[sizeof(CompactFormatTag)];
+        const bool isCompact = stream.Read(sizeof(tag), tag) == sizeof(tag) && memcmp(tag, CompactFormatTag, sizeof(tag)) == 0;
+        stream.Seek(startPosition, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        return isCompact;
+    }
+
+    //=========================================================================
+    // AssetRegistry::LoadCompact
+    //=========================================================================
+    bool AssetRegistry::LoadCompact(AZ::IO::GenericStream& stream)
+    {
+        Clear();
+        m_legacyAssetIdToRealAssetId.clear();
+        m_realAssetIdToLegacyAssetIdMap.clear();
+
+        char tag[sizeof(CompactFormatTag)];
+        AZ::u32 version = 0;
+        if (stream.Read(sizeof(tag), tag) != sizeof(tag) || memcmp(tag, CompactFormatTag, sizeof(tag)) != 0 ||
+            !ReadValue(stream, version) || version != CompactFormatVersion)
+        {
+            AZ_Error("AssetRegistry", false, "Stream doesn't contain an asset registry in the compact format version %u.", CompactFormatVersion);
+            return false;
+        }
+
+        auto loadSections = [this, &stream]()
+        {
+            AZ::u64 count = 0;
+            if (!ReadEntryCount(stream, count))
+            {
+                return false;
+            }
+            m_assetIdToInfo.reserve(count);
+            for (AZ::u64 index = 0; index < count; ++index)
+            {
+                AZ::Data::AssetId assetId;
+                AZ::Data::AssetInfo assetInfo;
+                AZ::u32 pathLength = 0;
+                if (!ReadAssetId(stream, assetId) || !ReadAssetId(stream, assetInfo.m_assetId) ||
+                    !ReadValue(stream, assetInfo.m_assetType) || !ReadValue(stream, assetInfo.m_sizeBytes) ||
+                    !ReadValue(stream, pathLength) || pathLength > stream.GetLength() - stream.GetCurPos())
+                {
+                    return false;
+                }
+                assetInfo.m_relativePath.resize_no_construct(pathLength);
+                if (stream.Read(pathLength, assetInfo.m_relativePath.data()) != pathLength)
+                {
+                    return false;
+                }
+                m_assetIdToInfo.emplace(assetId, AZStd::move(assetInfo));
+            }
+
+            if (!ReadEntryCount(stream, count))
+            {
+                return false;
+            }
+            m_assetPathToId.reserve(count);
+            for (AZ::u64 index = 0; index < count; ++index)
+            {
+                AZ::Uuid pathUuid;
+                AZ::Data::AssetId assetId;
+                if (!ReadValue(stream, pathUuid) || !ReadAssetId(stream, assetId))
+                {
+                    return false;
+                }
+                m_assetPathToId.emplace(pathUuid, assetId);
+            }
+
+            if (!ReadAssetIdPairs(stream, m_legacyAssetIdToRealAssetId) || !ReadAssetIdPairs(stream, m_realAssetIdToLegacyAssetIdMap))
+            {
+                return false;
+            }
+
+            if (!ReadEntryCount(stream, count))
+            {
+                return false;
+            }
+            m_assetDependencies.reserve(count);
+            for (AZ::u64 index = 0; index < count; ++index)
+            {
+                AZ::Data::AssetId assetId;
+                AZ::u32 dependencyCount = 0;
+                if (!ReadAssetId(stream, assetId) || !ReadValue(stream, dependencyCount) ||
+                    dependencyCount > (stream.GetLength() - stream.GetCurPos()) / MinCompactEntrySize)
+                {
+                    return false;
+                }
+                AZStd::vector<AZ::Data::ProductDependency>& dependencies = m_assetDependencies[assetId];
+                dependencies.reserve(dependencyCount);
+                for (AZ::u32 dependencyIndex = 0; dependencyIndex < dependencyCount; ++dependencyIndex)
+                {
+                    AZ::Data::AssetId dependencyId;
+                    AZ::u64 flags = 0;
+                    if (!ReadAssetId(stream, dependencyId) || !ReadValue(stream, flags))
+                    {
+                        return false;
+                    }
+                    dependencies.emplace_back(dependencyId, AZStd::bitset<64>(flags));
+                }
+            }
+            return true;
+        };
+
+        if (!loadSections())
+        {
+            AZ_Error("AssetRegistry", false, "Asset registry in the compact format is truncated or corrupted.");
+            Clear();
+            m_legacyAssetIdToRealAssetId.clear();
+            m_realAssetIdToLegacyAssetIdMap.clear();
+            return false;
+        }
+        return true;
+    }
+
+    //=========================================================================
+    // AssetRegistry::LoadFromStream
+    //=========================================================================
+    bool AssetRegistry::LoadFromStream(AZ::IO::GenericStream& stream, AssetRegistry& registry, AZ::SerializeContext* serializeContext)
+    {
+        if (IsCompactStream(stream))
+        {
+            return registry.LoadCompact(stream);
+        }
+        return AZ::Utils::LoadObjectFromStreamInPlace<AssetRegistry>(stream, registry, serializeContext,
+            AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+    }
+
     //=========================================================================
     // AssetRegistry::RegisterAsset
     //=========================================================================
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformBatchNotificationSystem.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    void TransformBatchNotificationSystem::Connect()
+    {
+        AZ::Interface<AZ::TransformBatchRequests>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformBatchNotificationSystem::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<AZ::TransformBatchRequests>::Unregister(this);
+
+        m_queuedIndices.clear();
+        m_queuedEntityIds.clear();
+        m_queuedWorldTransforms.clear();
+    }
+
+    void TransformBatchNotificationSystem::QueueTransformChanged(AZ::EntityId entityId, const AZ::Transform& worldTransform)
+    {
+        // nothing to coalesce the changes for if nobody listens to the batches
+        if (!AZ::TransformBatchNotificationBus::HasHandlers())
+        {
+            return;
+        }
+
+        // an entity that already changed this frame only keeps its latest transform
+        auto [indexIt, inserted] = m_queuedIndices.emplace(entityId, m_queuedEntityIds.size());
+        if (inserted)
+        {
+            m_queuedEntityIds.push_back(entityId);
+            m_queuedWorldTransforms.push_back(worldTransform);
+        }
+        else
+        {
+            m_queuedWorldTransforms[indexIt->second] = worldTransform;
+        }
+    }
+
+    void TransformBatchNotificationSystem::FlushTransformChanges()
+    {
+        // listeners moving entities during the flush have their changes sent with the next batch
+        if (m_isFlushing || m_queuedEntityIds.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        m_dispatchedEntityIds.swap(m_queuedEntityIds);
+        m_dispatchedWorldTransforms.swap(m_queuedWorldTransforms);
+        m_queuedIndices.clear();
+
+        m_isFlushing = true;
+        AZ::TransformBatchNotificationBus::Broadcast(
+            &AZ::TransformBatchNotificationBus::Events::OnTransformsChanged,
+            AZStd::span<const AZ::EntityId>(m_dispatchedEntityIds),
+            AZStd::span<const AZ::Transform>(m_dispatchedWorldTransforms));
+        m_isFlushing = false;
+
+        m_dispatchedEntityIds.clear();
+        m_dispatchedWorldTransforms.clear();
+    }
+
+    void TransformBatchNotificationSystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        FlushTransformChanges();
+    }
+
+    int TransformBatchNotificationSystem::GetTickOrder()
+    {
+        // flush once every other tick handler had a chance to move entities this frame
+        return AZ::TICK_LAST;
+    }
+} // namespace AzFramework
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzFramework
+{
+    //! Coalesces the world transform changes of entities during a frame and sends them to the
+    //! AZ::TransformBatchNotificationBus in one batch, after all the other tick handlers ran.
+    class TransformBatchNotificationSystem
+        : public AZ::TransformBatchRequests
+        , private AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(TransformBatchNotificationSystem, "{3E6F2C91-B0D4-4A7E-8C15-6D9A4F0B2E73}", AZ::TransformBatchRequests);
+
+        void Connect();
+        void Disconnect();
+
+        // TransformBatchRequests overrides ...
+        void QueueTransformChanged(AZ::EntityId entityId, const AZ::Transform& worldTransform) override;
+        void FlushTransformChanges() override;
+
+    private:
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        AZStd::unordered_map<AZ::EntityId, size_t> m_queuedIndices; //!< Index of each queued entity in the queued arrays.
+        AZStd::vector<AZ::EntityId> m_queuedEntityIds;
+        AZStd::vector<AZ::Transform> m_queuedWorldTransforms;
+
+        //! The batch being dispatched, kept between flushes to reuse its memory.
+        AZStd::vector<AZ::EntityId> m_dispatchedEntityIds;
+        AZStd::vector<AZ::Transform> m_dispatchedWorldTransforms;
+        bool m_isFlushing = false;
+    };
+} // namespace AzFramework
@@ -197,7 +197,8 @@ namespace AzFramework
 
     void TransformComponent::SetLocalTM(const AZ::Transform& tm)
     {
-        if (AreMoveRequestsAllowed())
+        // Setting the same transform again would update and notify the whole child hierarchy for nothing.
+        if (AreMoveRequestsAllowed() && !(tm == m_localTM && IsLocalAndWorldTMConsistent()))
         {
             SetLocalTMImpl(tm);
         }
@@ -205,7 +206,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTM(const AZ::Transform& tm)
     {
-        if (AreMoveRequestsAllowed())
+        if (AreMoveRequestsAllowed() && !(tm == m_worldTM && IsLocalAndWorldTMConsistent()))
         {
             SetWorldTMImpl(tm);
         }
@@ -589,9 +590,7 @@ namespace AzFramework
 
             if (oldParent.IsValid())
             {
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                SendTransformChangedNotifications();
             }
         }
 
@@ -637,9 +636,7 @@ namespace AzFramework
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
                 m_worldTM = parentWorldTM * m_localTM;
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                SendTransformChangedNotifications();
             }
             else
             {
@@ -663,9 +660,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
-        AZ::TransformNotificationBus::Event(
-            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+        SendTransformChangedNotifications();
 
         AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         if (boundsUnion != nullptr)
@@ -685,9 +680,19 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        SendTransformChangedNotifications();
+    }
+
+    void TransformComponent::SendTransformChangedNotifications()
+    {
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        if (AZ::TransformBatchRequests* transformBatch = AZ::Interface<AZ::TransformBatchRequests>::Get())
+        {
+            transformBatch->QueueTransformChanged(GetEntityId(), m_worldTM);
+        }
     }
 
     bool TransformComponent::AreMoveRequestsAllowed() const
@@ -702,6 +707,21 @@ namespace AzFramework
         return true;
     }
 
+    bool TransformComponent::IsLocalAndWorldTMConsistent() const
+    {
+        // Only trust the cached transforms once activated. With an active parent they're kept in sync by OnTransformChangedImpl,
+        // without one the local transform is the world transform. Anything else is in the middle of a parent change.
+        if (!m_entity || m_entity->GetState() != AZ::Entity::State::Active)
+        {
+            return false;
+        }
+        if (m_parentTM)
+        {
+            return m_parentActive;
+        }
+        return !m_parentActive && m_localTM == m_worldTM;
+    }
+
     void TransformComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC("TransformService", 0x8ee22c50));
@@ -162,9 +162,16 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Notifies listeners of the current local and world transforms, and queues the change for the batched notifications.
+        void SendTransformChangedNotifications();
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
+        //! Returns whether the local and world transforms are known to agree with the current parent,
+        //! so setting either of them to its current value can't change anything.
+        bool IsLocalAndWorldTMConsistent() const;
+
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
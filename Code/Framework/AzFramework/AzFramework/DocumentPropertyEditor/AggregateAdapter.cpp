@@ -628,17 +628,17 @@ namespace AZ::DocumentPropertyEditor
     }
 
     RowAggregateAdapter::AggregateNode* RowAggregateAdapter::AddChildRow(
-        size_t adapterIndex, AggregateNode* parentNode, const Dom::Value& childValue, size_t childIndex, Dom::Patch* outgoingPatch)
+        size_t adapterIndex,
+        AggregateNode* parentNode,
+        const Dom::Value& childValue,
+        size_t childIndex,
+        Dom::Patch* outgoingPatch,
+        size_t matchHint)
     {
         AggregateNode* addedToNode = nullptr;
 
-        // check each existing child to see if we belong there.
-        for (auto matchIter = parentNode->m_childRows.begin(), endIter = parentNode->m_childRows.end();
-             !addedToNode && matchIter != endIter;
-             ++matchIter)
+        auto tryToAddToNode = [&](AggregateNode* possibleMatch)
         {
-            AggregateNode* possibleMatch = matchIter->get();
-
             // make sure there isn't already an entry for this adapter. This can happen in
             // edge cases where multiple rows can match, like in multi-sets
             if (!possibleMatch->HasEntryForAdapter(adapterIndex))
@@ -652,6 +652,23 @@ namespace AZ::DocumentPropertyEditor
                     addedToNode = possibleMatch;
                 }
             }
+        };
+
+        // try the hinted child first, so that adding an adapter with the same rows as the others doesn't compare
+        // each row against all of its siblings
+        const bool hasMatchHint = matchHint < parentNode->m_childRows.size();
+        if (hasMatchHint)
+        {
+            tryToAddToNode(parentNode->m_childRows[matchHint].get());
+        }
+
+        // check each existing child to see if we belong there.
+        for (size_t matchIndex = 0, numChildRows = parentNode->m_childRows.size(); !addedToNode && matchIndex < numChildRows; ++matchIndex)
+        {
+            if (!hasMatchHint || matchIndex != matchHint)
+            {
+                tryToAddToNode(parentNode->m_childRows[matchIndex].get());
+            }
         }
         if (!addedToNode)
         {
@@ -675,6 +692,7 @@ namespace AZ::DocumentPropertyEditor
     {
         // go through each DOM child of parentValue, ignoring non-rows
         const auto numChildren = parentValue.ArraySize();
+        size_t rowIndex = 0;
         for (size_t childIndex = 0; childIndex < numChildren; ++childIndex)
         {
             const auto& childValue = parentValue[childIndex];
@@ -682,7 +700,7 @@ namespace AZ::DocumentPropertyEditor
             // the RowAggregateAdapter groups nodes by row, so we ignore non-child rows here
             if (IsRow(childValue))
             {
-                AddChildRow(adapterIndex, parentNode, childValue, childIndex, nullptr);
+                AddChildRow(adapterIndex, parentNode, childValue, childIndex, nullptr, rowIndex++);
             }
         }
     }
@@ -124,8 +124,14 @@ namespace AZ::DocumentPropertyEditor
 
         //! adds a child row given the adapter index, parentNode, new value, and new index.
         //! \param outgoingPatch If generating a patch operation for this add is desirable, specify a non-null outgoingPatch
+        //! \param matchHint index of the child of parentNode that is tried first, since the adapters usually have the same rows in the same order
         AggregateNode* AddChildRow(
-            size_t adapterIndex, AggregateNode* parentNode, const Dom::Value& childValue, size_t childIndex, Dom::Patch* outgoingPatch);
+            size_t adapterIndex,
+            AggregateNode* parentNode,
+            const Dom::Value& childValue,
+            size_t childIndex,
+            Dom::Patch* outgoingPatch,
+            size_t matchHint = AggregateNode::InvalidEntry);
 
         void PopulateChildren(size_t adapterIndex, const Dom::Value& parentValue, AggregateNode* parentNode);
 
@@ -743,11 +743,10 @@ namespace AZ
             AZ_Assert(path && path[0] != '%', "%% is deprecated, @ is the only valid alias token");
             AZStd::string_view pathView(path);
 
-            const auto found = AZStd::find_if(m_aliases.begin(), m_aliases.end(),
-                [pathView](const auto& alias)
-                {
-                    return pathView.starts_with(alias.first);
-                });
+            // An alias must be followed by a path separator or the end of the path, so the alias key candidate is
+            // everything before the first separator and can be looked up directly instead of testing every alias
+            const AZStd::string_view aliasCandidate = pathView.substr(0, pathView.find_first_of("/\\"));
+            const auto found = m_aliases.find(aliasCandidate);
 
             using string_view_pair = AZStd::pair<AZStd::string_view, AZStd::string_view>;
             auto [aliasKey, aliasValue] = (found != m_aliases.end()) ? string_view_pair(*found)
@@ -91,8 +91,10 @@ namespace AZ
             mutable AZStd::recursive_mutex m_openFileGuard;
             AZStd::atomic<HandleType> m_nextHandle;
             AZStd::unordered_map<HandleType, SystemFile> m_openFiles;
-            AZStd::unordered_map<AZStd::string, AZStd::string> m_aliases;
-            AZStd::unordered_map<AZStd::string, AZStd::string> m_deprecatedAliases;
+            // Transparent key comparison lets the aliases be looked up by string_view without making a temporary string
+            using AliasMap = AZStd::unordered_map<AZStd::string, AZStd::string, AZStd::hash<AZStd::string>, AZStd::equal_to<>>;
+            AliasMap m_aliases;
+            AliasMap m_deprecatedAliases;
 
             void CheckInvalidWrite(const char* path);
         };
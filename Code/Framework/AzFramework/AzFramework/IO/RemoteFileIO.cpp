@@ -1170,14 +1170,22 @@ namespace AZ
 
             AZ::u64 remainingBytesToRead = size;
             AZ::u64 bytesReadFromCache = 0;
-            AZ::u64 remainingBytesInCache = cache.RemainingBytes();
-            if (remainingBytesInCache)
+            auto ReadFromCache = [&cache, buffer, &remainingBytesToRead, &bytesReadFromCache]()
             {
-                AZ::u64 bytesToReadFromCache = AZStd::GetMin<AZ::u64>(remainingBytesInCache, remainingBytesToRead);
-                memcpy(buffer, cache.m_cacheLookaheadBuffer.data() + cache.m_cacheLookaheadPos, bytesToReadFromCache);
-                bytesReadFromCache = bytesToReadFromCache;
+                AZ::u64 bytesToReadFromCache = AZStd::GetMin<AZ::u64>(cache.RemainingBytes(), remainingBytesToRead);
+                memcpy(reinterpret_cast<char*>(buffer) + bytesReadFromCache, cache.m_cacheLookaheadBuffer.data() + cache.m_cacheLookaheadPos, bytesToReadFromCache);
+                bytesReadFromCache += bytesToReadFromCache;
                 remainingBytesToRead -= bytesToReadFromCache;
                 cache.m_cacheLookaheadPos += bytesToReadFromCache;
+            };
+            ReadFromCache();
+
+            // A small read crossing the end of the cache is served from the refilled cache, so its bytes and the
+            // next read ahead come back with a single request instead of one request each
+            if (remainingBytesToRead && remainingBytesToRead < CACHE_LOOKAHEAD_SIZE && !Eof(fileHandle))
+            {
+                RefillCache(fileHandle, cache);
+                ReadFromCache();
             }
 
             REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u) bytesReadFromCache=%u remainingBytesToRead=%u", fileHandle, bytesReadFromCache, remainingBytesToRead).c_str());
@@ -1232,33 +1240,38 @@ namespace AZ
             //if the cache is empty try to refill it if not eof.
             if (!cache.RemainingBytes() && !Eof(fileHandle))
             {
-                //make sure the cache file size is up to date
-                AZ::u64 fsize = 0;
-                Size(fileHandle, fsize);
+                RefillCache(fileHandle, cache);
+            }
+            REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, bytesThatHaveBeenRead=%u) return Success", fileHandle, bytesThatHaveBeenRead).c_str());
+            return ResultCode::Success;
+        }
 
-                AZ::u64 remainingFileBytes = cache.m_fileSize - cache.m_filePosition;
-                AZ::u64 readSize = AZStd::GetMin<AZ::u64>(remainingFileBytes, CACHE_LOOKAHEAD_SIZE);
+        void RemoteFileIO::RefillCache(HandleType fileHandle, RemoteFileCache& cache)
+        {
+            //make sure the cache file size is up to date
+            AZ::u64 fsize = 0;
+            Size(fileHandle, fsize);
 
-                cache.m_cacheLookaheadBuffer.clear();
-                cache.m_cacheLookaheadBuffer.resize_no_construct(readSize);
-                REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=-", fileHandle, readSize).c_str());
-                AZ::u64 actualRead = 0;
-                Result returnValue = NetworkFileIO::Read(fileHandle, cache.m_cacheLookaheadBuffer.data(), readSize, false, &actualRead);
-                if (actualRead)
-                {
-                    cache.m_cacheLookaheadBuffer.resize(actualRead);
-                    cache.OffsetFilePosition(actualRead);
-                    cache.m_cacheLookaheadPos = 0;
-                }
+            AZ::u64 remainingFileBytes = cache.m_fileSize - cache.m_filePosition;
+            AZ::u64 readSize = AZStd::GetMin<AZ::u64>(remainingFileBytes, CACHE_LOOKAHEAD_SIZE);
 
-                if (returnValue == ResultCode::Error)
-                {
-                    AZ_TracePrintf(RemoteFileIOChannel, "RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=- actualRead=%i Failed", fileHandle, readSize, actualRead);
-                }
-                REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=- actualRead=%i %s", fileHandle, readSize, actualRead, returnValue == ResultCode::Success ? "Success" : "Fail").c_str());
+            cache.m_cacheLookaheadBuffer.clear();
+            cache.m_cacheLookaheadBuffer.resize_no_construct(readSize);
+            cache.m_cacheLookaheadPos = 0;
+            REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=-", fileHandle, readSize).c_str());
+            AZ::u64 actualRead = 0;
+            Result returnValue = NetworkFileIO::Read(fileHandle, cache.m_cacheLookaheadBuffer.data(), readSize, false, &actualRead);
+            cache.m_cacheLookaheadBuffer.resize(actualRead);
+            if (actualRead)
+            {
+                cache.OffsetFilePosition(actualRead);
             }
-            REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, bytesThatHaveBeenRead=%u) return Success", fileHandle, bytesThatHaveBeenRead).c_str());
-            return ResultCode::Success;
+
+            if (returnValue == ResultCode::Error)
+            {
+                AZ_TracePrintf(RemoteFileIOChannel, "RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=- actualRead=%i Failed", fileHandle, readSize, actualRead);
+            }
+            REMOTEFILE_LOG_APPEND(AZStd::string::format("RemoteFileIO::Read(fileHandle=%u, size=%u) -=CACHE READ=- actualRead=%i %s", fileHandle, readSize, actualRead, returnValue == ResultCode::Success ? "Success" : "Fail").c_str());
         }
 
         Result RemoteFileIO::Write(HandleType fileHandle, const void* buffer, AZ::u64 size, AZ::u64* bytesWritten)
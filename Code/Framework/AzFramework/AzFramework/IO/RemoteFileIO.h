@@ -226,6 +226,9 @@ namespace AZ
             RemoteFileCache& GetCache(HandleType fileHandle);
 
         private:
+            //! Reads ahead from the current file position into the empty cache
+            void RefillCache(HandleType fileHandle, RemoteFileCache& cache);
+
             FileIOBase* m_excludedFileIO;
         };
 #endif
@@ -134,6 +134,8 @@ namespace AzFramework
             AZ_Warning("Log Component", result.GetResultCode() == AZ::IO::ResultCode::Success, "Unable to open the log file for writing");
         }
 
+        UpdateFileSize();
+
     }
 
     void LogFile::Init(const char* baseDirectory, const char* fileName, AZ::u64 rolloverLength, bool forceOverwriteFile)
@@ -177,6 +179,8 @@ namespace AzFramework
         {
             AZ_Warning("Log Component", result.GetResultCode() == AZ::IO::ResultCode::Success, "Unable to open the log file for writing");
         }
+
+        UpdateFileSize();
     }
 
     AZStd::string LogFile::CreateNewBackupFileName()
@@ -197,22 +201,24 @@ namespace AzFramework
         return backupFileName;
     }
 
+    void LogFile::UpdateFileSize()
+    {
+        m_fileSize = 0;
+        if (m_fileIO && m_fileHandle)
+        {
+            m_fileIO->Size(m_fileHandle, m_fileSize);
+        }
+    }
+
     void LogFile::CheckSizeAndCycleFiles()
     {
         if (m_fileHandle && m_fileIO)
         {
-            AZ::u64 fileSize;
-            AZ::IO::Result result = m_fileIO->Tell(m_fileHandle, fileSize);
-
-            if (result.GetResultCode() != AZ::IO::ResultCode::Success)
-            {
-                return;
-            }
-            if ((m_runtimeRolloverLength) && (fileSize >= m_runtimeRolloverLength))
+            if ((m_runtimeRolloverLength) && (m_fileSize >= m_runtimeRolloverLength))
             {
                 //If the file size is more than the rollover length than close the current log file,
                 //rename it and open a new logfile having  the same name as the old one
-                result = m_fileIO->Close(m_fileHandle);
+                AZ::IO::Result result = m_fileIO->Close(m_fileHandle);
                 if (result.GetResultCode() != AZ::IO::ResultCode::Success)
                 {
                     m_fileHandle = AZ::IO::InvalidHandle;
@@ -266,6 +272,7 @@ namespace AzFramework
                         printf("Log Component:Unable to open the log file for writing");
                     }
                 }
+                UpdateFileSize();
             }
         }
     }
@@ -319,6 +326,8 @@ namespace AzFramework
 
         if (m_fileIO && m_fileHandle && dataSource)
         {
+            // The whole line is composed first and written at once, log file handles are unbuffered so each write is a system call.
+            m_recordBuffer.clear();
             char buffer[80] = { 0 };
 
             if (m_machineReadable)
@@ -329,74 +338,53 @@ namespace AzFramework
                 AZ::u64 rawTime = time ? time : AZStd::GetTimeUTCMilliSecond();
 
                 azsnprintf(buffer, 80, "~~%llu~~%i", rawTime, severity);
-                m_fileIO->Write(m_fileHandle, buffer, strlen(buffer));
-                if (m_machineReadable) // Branching instead of using a ternary on the format string to avoid warning 4774 (format literal expected)
-                {
-                    azsnprintf(buffer, 80, "~~%p~~%s~~", reinterpret_cast<void*>(threadID), categoryActual);
-                }
-                else
-                {
-                    azsnprintf(buffer, 80, "{%p}[%14s]", reinterpret_cast<void*>(threadID), categoryActual);
-                }
-                m_fileIO->Write(m_fileHandle, buffer, strlen(buffer));
-
-                m_fileIO->Write(m_fileHandle, dataSource, dataLength);
-                if (addNewLine)
-                {
-                    m_fileIO->Write(m_fileHandle, "\n", 1);
-                }
+                m_recordBuffer.append(buffer);
+                azsnprintf(buffer, 80, "~~%p~~%s~~", reinterpret_cast<void*>(threadID), categoryActual);
+                m_recordBuffer.append(buffer);
             }
             else
             {
                 TimeNowAsString(buffer, 80);
-
-                AZ::IO::Result result = m_fileIO->Write(m_fileHandle, buffer, strlen(buffer));
-                if (result.GetResultCode() != AZ::IO::ResultCode::Success)
-                {
-                    return;
-                }
-                if (m_machineReadable) // Branching instead of using a ternary on the format string to avoid warning 4774 (format literal expected)
-                {
-                    azsnprintf(categorybuffer, 64, "~~%p~~%s~~", reinterpret_cast<void*>(threadID), categoryActual);
-                }
-                else
-                {
-                    azsnprintf(categorybuffer, 64, "{%p}[%14s]", reinterpret_cast<void*>(threadID), categoryActual);
-                }
+                m_recordBuffer.append(buffer);
 
                 if ((category) && (categoryLen))
                 {
-                    m_fileIO->Write(m_fileHandle, categorybuffer, strlen(categorybuffer));
+                    azsnprintf(categorybuffer, 64, "{%p}[%14s]", reinterpret_cast<void*>(threadID), categoryActual);
+                    m_recordBuffer.append(categorybuffer);
                 }
 
                 switch (severity)
                 {
                 case SEV_DEBUG:
-                    m_fileIO->Write(m_fileHandle, " DBG ", 5);
+                    m_recordBuffer.append(" DBG ");
                     break;
                 case SEV_WARNING:
-                    m_fileIO->Write(m_fileHandle, " WRN ", 5);
+                    m_recordBuffer.append(" WRN ");
                     break;
                 case SEV_ERROR:
-                    m_fileIO->Write(m_fileHandle, " ERR ", 5);
+                    m_recordBuffer.append(" ERR ");
                     break;
                 case SEV_ASSERT:
-                    m_fileIO->Write(m_fileHandle, " AST ", 5);
+                    m_recordBuffer.append(" AST ");
                     break;
                 case SEV_EXCEPTION:
-                    m_fileIO->Write(m_fileHandle, " EXC ", 5);
+                    m_recordBuffer.append(" EXC ");
                     break;
                 default:
-                    m_fileIO->Write(m_fileHandle, "     ", 5);
+                    m_recordBuffer.append("     ");
                     break;
                 }
+            }
 
-                m_fileIO->Write(m_fileHandle, dataSource, dataLength);
-                if (addNewLine)
-                {
-                    m_fileIO->Write(m_fileHandle, "\n", 1);
-                }
+            m_recordBuffer.append(dataSource, dataLength);
+            if (addNewLine)
+            {
+                m_recordBuffer.push_back('\n');
             }
+
+            AZ::u64 bytesWritten = 0;
+            m_fileIO->Write(m_fileHandle, m_recordBuffer.data(), m_recordBuffer.size(), &bytesWritten);
+            m_fileSize += bytesWritten;
             
             if ((severity == SEV_ERROR) || (severity == SEV_ASSERT) || (severity == SEV_EXCEPTION))
             {
@@ -62,6 +62,7 @@ namespace AzFramework
         void InitAbsolute(const char* absolutePath, bool forceOverwriteFile);
         void CheckSizeAndCycleFiles();
         AZStd::string CreateNewBackupFileName();
+        void UpdateFileSize();
 
         AZ::IO::FileIOBase* m_fileIO;
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
@@ -69,6 +70,8 @@ namespace AzFramework
         AZStd::string m_fileName;
         AZStd::string m_directoryName;
         AZ::u64 m_runtimeRolloverLength;
+        AZ::u64 m_fileSize = 0; ///< Tracked while appending, so the rollover check doesn't need to query the file for every line.
+        AZStd::string m_recordBuffer; ///< Reused to compose each log line, so it's sent to the file in a single write.
         AZStd::recursive_mutex m_logProtector;
         bool m_machineReadable = true; // if you switch
 
@@ -110,6 +110,10 @@ namespace AzPhysics
         //! see RegisterOnCollisionBeginHandler
         void RegisterOnCollisionEndHandler(SimulatedBodyEvents::OnCollisionEnd::Handler& handler);
 
+        //! Returns if a handler is registered to any of the collision events of this body.
+        //! Allows the physics backend to skip building collision events nobody listens to.
+        bool HasCollisionEventHandlers() const;
+
         //! Helpers to register a handler for Trigger Events on this Simulated body.
         //! OnTriggerEnter is when a body enters a trigger.
         //! OnTriggerExit is when a body leaves a trigger.
@@ -171,6 +175,12 @@ namespace AzPhysics
         handler.Connect(m_collisionBeginEvent);
     }
 
+    inline bool SimulatedBody::HasCollisionEventHandlers() const
+    {
+        return m_collisionBeginEvent.HasHandlerConnected() || m_collisionPersistEvent.HasHandlerConnected() ||
+            m_collisionEndEvent.HasHandlerConnected();
+    }
+
     inline void SimulatedBody::RegisterOnCollisionPersistHandler(SimulatedBodyEvents::OnCollisionPersist::Handler& handler)
     {
         handler.Connect(m_collisionPersistEvent);
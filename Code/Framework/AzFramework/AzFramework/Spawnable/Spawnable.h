@@ -173,6 +173,8 @@ namespace AzFramework
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        friend class SpawnableBinaryFormat;
+
         SpawnableMetaData m_metaData;
 
         // Aliases that optionally replace the ones stored in this spawnable.
@@ -12,6 +12,7 @@
 #include <AzCore/std/sort.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
+#include <AzFramework/Spawnable/SpawnableBinaryFormat.h>
 #include <AzFramework/Spawnable/SpawnableAssetUtils.h>
 
 namespace AzFramework
@@ -52,7 +53,19 @@ namespace AzFramework
         AZ_Assert(spawnable, "Loaded asset data handed to the SpawnableAssetHandler didn't contain a Spawanble.");
 
         AZ::ObjectStream::FilterDescriptor filter(assetLoadFilterCB);
-        if (AZ::Utils::LoadObjectFromStreamInPlace(*stream, *spawnable, nullptr /*SerializeContext*/, filter))
+
+        // The stream can't seek back, so all data is taken in one go to check which layout it's stored in. The data is
+        // decoded straight from the stream's buffer instead of a copy of it, as nothing refers to it after loading.
+        AZStd::span<const AZ::u8> data = stream->ReadInPlace(stream->GetLength());
+        bool loaded = data.size() == stream->GetLength();
+        if (loaded)
+        {
+            loaded = SpawnableBinaryFormat::IsPackedBinary(data.data(), data.size())
+                ? SpawnableBinaryFormat::Load(data.data(), data.size(), *spawnable, filter)
+                : AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.size(), *spawnable, nullptr /*SerializeContext*/, filter);
+        }
+
+        if (loaded)
         {
             SpawnableAssetUtils::ResolveEntityAliases(spawnable, asset.GetHint(), AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(stream->GetStreamingDeadline()), stream->GetStreamingPriority(), assetLoadFilterCB);
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableBinaryFormat.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    namespace SpawnableBinaryFormatInternal
+    {
+        static constexpr uint8_t Magic[8] = { 'O', '3', 'D', 'E', 'S', 'P', 'W', 'N' };
+
+        // Spawnables with fewer entities than this are decoded on the calling thread as scheduling the tasks would cost more than
+        // it saves.
+        static constexpr size_t ParallelDecodeThreshold = 64;
+        static constexpr size_t EntitiesPerTask = 16;
+
+        struct Range
+        {
+            uint64_t m_offset;
+            uint64_t m_size;
+        };
+
+        struct Header
+        {
+            uint8_t m_magic[8];
+            uint32_t m_version;
+            uint32_t m_entityCount;
+            //! The spawnable without its entities.
+            Range m_spawnable;
+            //! Offset of the table with a Range for every entity.
+            uint64_t m_entityTableOffset;
+        };
+
+        static bool IsInBounds(const Range& range, size_t size)
+        {
+            return range.m_offset <= size && range.m_size <= size - range.m_offset;
+        }
+
+        static bool ShouldDecodeInParallel(size_t entityCount)
+        {
+            if (entityCount < ParallelDecodeThreshold)
+            {
+                return false;
+            }
+            auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            return taskGraphActive && taskGraphActive->IsTaskGraphActive();
+        }
+    } // namespace SpawnableBinaryFormatInternal
+
+    bool SpawnableBinaryFormat::IsPackedBinary(const void* data, size_t size)
+    {
+        using namespace SpawnableBinaryFormatInternal;
+        return size >= sizeof(Header) && memcmp(data, Magic, sizeof(Magic)) == 0;
+    }
+
+    bool SpawnableBinaryFormat::Save(AZ::IO::GenericStream& stream, const Spawnable& spawnable, AZ::SerializeContext* serializeContext)
+    {
+        using namespace SpawnableBinaryFormatInternal;
+
+        // Everything but the entities is stored in a spawnable of its own, so the regular reflection can be used for it.
+        Spawnable spawnableWithoutEntities(spawnable.GetId(), AZ::Data::AssetData::AssetStatus::Ready);
+        spawnableWithoutEntities.m_metaData = spawnable.m_metaData;
+        spawnableWithoutEntities.m_entityAliases = spawnable.m_entityAliases;
+
+        AZStd::vector<uint8_t> blobs;
+        AZ::IO::ByteContainerStream blobStream(&blobs);
+        if (!AZ::Utils::SaveObjectToStream(blobStream, AZ::DataStream::ST_BINARY, &spawnableWithoutEntities, serializeContext))
+        {
+            return false;
+        }
+
+        const Spawnable::EntityList& entities = spawnable.GetEntities();
+        const uint64_t blobsOffset = sizeof(Header) + entities.size() * sizeof(Range);
+
+        Header header;
+        memcpy(header.m_magic, Magic, sizeof(Magic));
+        header.m_version = Version;
+        header.m_entityCount = aznumeric_caster(entities.size());
+        header.m_spawnable = { blobsOffset, blobs.size() };
+        header.m_entityTableOffset = sizeof(Header);
+
+        AZStd::vector<Range> entityTable;
+        entityTable.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            size_t blobStart = blobs.size();
+            if (!AZ::Utils::SaveObjectToStream(blobStream, AZ::DataStream::ST_BINARY, entity.get(), serializeContext))
+            {
+                return false;
+            }
+            entityTable.push_back({ blobsOffset + blobStart, blobs.size() - blobStart });
+        }
+
+        return stream.Write(sizeof(Header), &header) == sizeof(Header) &&
+            stream.Write(entityTable.size() * sizeof(Range), entityTable.data()) == entityTable.size() * sizeof(Range) &&
+            stream.Write(blobs.size(), blobs.data()) == blobs.size();
+    }
+
+    bool SpawnableBinaryFormat::Load(
+        const void* data,
+        size_t size,
+        Spawnable& spawnable,
+        const AZ::ObjectStream::FilterDescriptor& filter,
+        AZ::SerializeContext* serializeContext)
+    {
+        using namespace SpawnableBinaryFormatInternal;
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        if (!IsPackedBinary(data, size))
+        {
+            AZ_Error("Spawnable", false, "Data doesn't contain a spawnable in the packed binary layout.");
+            return false;
+        }
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        Header header;
+        memcpy(&header, bytes, sizeof(Header));
+        if (header.m_version != Version)
+        {
+            AZ_Error(
+                "Spawnable", false, "Packed binary spawnable has version %u, but only version %u is supported.", header.m_version, Version);
+            return false;
+        }
+
+        const Range entityTableRange{ header.m_entityTableOffset, uint64_t(header.m_entityCount) * sizeof(Range) };
+        if (!IsInBounds(header.m_spawnable, size) || !IsInBounds(entityTableRange, size))
+        {
+            AZ_Error("Spawnable", false, "Packed binary spawnable is truncated.");
+            return false;
+        }
+
+        AZStd::vector<Range> entityTable(header.m_entityCount);
+        memcpy(entityTable.data(), bytes + entityTableRange.m_offset, entityTableRange.m_size);
+        for (const Range& range : entityTable)
+        {
+            if (!IsInBounds(range, size))
+            {
+                AZ_Error("Spawnable", false, "Packed binary spawnable is truncated.");
+                return false;
+            }
+        }
+
+        if (serializeContext == nullptr)
+        {
+            // Retrieve this once up front instead of from every task.
+            AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+            if (serializeContext == nullptr)
+            {
+                AZ_Error("Spawnable", false, "No serialize context available to load the packed binary spawnable with.");
+                return false;
+            }
+        }
+
+        if (!AZ::Utils::LoadObjectFromBufferInPlace(
+                bytes + header.m_spawnable.m_offset, header.m_spawnable.m_size, spawnable, serializeContext, filter))
+        {
+            return false;
+        }
+
+        Spawnable::EntityList& entities = spawnable.m_entities;
+        entities.clear();
+        entities.resize(header.m_entityCount);
+
+        AZStd::atomic_bool succeeded{ true };
+        auto decodeEntities = [&entities, &entityTable, &succeeded, &filter, bytes, serializeContext](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                entities[i].reset(AZ::Utils::LoadObjectFromBuffer<AZ::Entity>(
+                    bytes + entityTable[i].m_offset, entityTable[i].m_size, serializeContext, filter));
+                if (!entities[i])
+                {
+                    succeeded = false;
+                }
+            }
+        };
+
+        if (ShouldDecodeInParallel(entities.size()))
+        {
+            static const AZ::TaskDescriptor decodeTaskDescriptor{ "Decode spawnable entities", "Spawnables" };
+
+            AZ::TaskGraph taskGraph{ "SpawnableEntitiesDecoding" };
+            for (size_t begin = 0; begin < entities.size(); begin += EntitiesPerTask)
+            {
+                size_t end = AZStd::min(begin + EntitiesPerTask, entities.size());
+                taskGraph.AddTask(
+                    decodeTaskDescriptor,
+                    [&decodeEntities, begin, end]()
+                    {
+                        decodeEntities(begin, end);
+                    });
+            }
+
+            AZ::TaskGraphEvent finished{ "SpawnableEntitiesDecoding wait" };
+            taskGraph.Submit(&finished);
+            finished.Wait();
+        }
+        else
+        {
+            decodeEntities(0, entities.size());
+        }
+
+        if (!succeeded)
+        {
+            AZ_Error("Spawnable", false, "Failed to decode one or more entities in the packed binary spawnable.");
+            entities.clear();
+            return false;
+        }
+        return true;
+    }
+} // namespace AzFramework
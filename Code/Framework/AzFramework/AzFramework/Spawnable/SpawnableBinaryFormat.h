@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Serialization/ObjectStream.h>
+
+namespace AZ
+{
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    class Spawnable;
+
+    //! Packed binary layout for spawnables.
+    //! Instead of a single object stream for the entire spawnable, the spawnable without its entities and every entity are stored
+    //! as independent binary object streams. A table with the location of every stream follows a small header. All locations are
+    //! relative to the start of the data, so the loaded file can be decoded from wherever it ends up in memory without copying the
+    //! entities out again. Because the entities don't depend on each other they're decoded in parallel on the task graph for
+    //! larger spawnables.
+    //! Like other processed assets the layout is platform specific and is written in the byte order of the platform.
+    class SpawnableBinaryFormat final
+    {
+    public:
+        static constexpr uint32_t Version = 1;
+
+        //! Returns true if the data starts with the header of the packed binary layout.
+        static bool IsPackedBinary(const void* data, size_t size);
+
+        //! Writes the spawnable to the stream in the packed binary layout.
+        static bool Save(AZ::IO::GenericStream& stream, const Spawnable& spawnable, AZ::SerializeContext* serializeContext = nullptr);
+
+        //! Restores the spawnable from data in the packed binary layout. The spawnable will be empty if loading failed.
+        static bool Load(
+            const void* data,
+            size_t size,
+            Spawnable& spawnable,
+            const AZ::ObjectStream::FilterDescriptor& filter = {},
+            AZ::SerializeContext* serializeContext = nullptr);
+    };
+} // namespace AzFramework
@@ -17,6 +17,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/functional.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 
@@ -203,6 +204,7 @@ namespace AzFramework
 
     using EntitySpawnCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
     using EntityPreInsertionCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableEntityContainerView)>;
+    using EntitySpawnProgressCallback = AZStd::function<void(EntitySpawnTicket::Id, size_t activatedCount, size_t totalCount)>;
     using EntityDespawnCallback = AZStd::function<void(EntitySpawnTicket::Id)>;
     using RetrieveEntitySpawnTicketCallback = AZStd::function<void(EntitySpawnTicket&&)>;
     using ReloadSpawnableCallback = AZStd::function<void(EntitySpawnTicket::Id, SpawnableConstEntityContainerView)>;
@@ -220,6 +222,9 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a part of the newly created entities has been added to the world. This is called more
+        //!     than once if adding the entities didn't fit in the entity activation budget, see SetEntityActivationBudget.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
@@ -234,6 +239,9 @@ namespace AzFramework
         //! Callback that's called when spawning entities has completed. This can be triggered from a different thread than the one that
         //!     made the function call to spawn. The returned list of entities contains all the newly created entities.
         EntitySpawnCallback m_completionCallback;
+        //! Callback that's called every time a part of the newly created entities has been added to the world. This is called more
+        //!     than once if adding the entities didn't fit in the entity activation budget, see SetEntityActivationBudget.
+        EntitySpawnProgressCallback m_progressCallback;
         //! The Serialize Context used to clone entities with. If this is not provided the global Serialize Contetx will be used.
         AZ::SerializeContext* m_serializeContext{ nullptr };
         //! The priority at which this call will be executed.
@@ -421,6 +429,14 @@ namespace AzFramework
         virtual void LoadBarrier(
             EntitySpawnTicket& ticket, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs = {}) = 0;
 
+        //! Sets the time that may be spent per update on adding newly spawned entities to the world. Spawn calls that don't fit in
+        //!     the budget continue adding their entities in the next update, while the calls after them on the same ticket wait.
+        //!     At least one entity of a spawn call is added per update so spawning always makes progress.
+        //! @param budget The time per update, or zero to add all entities of a spawn call at once.
+        virtual void SetEntityActivationBudget(AZStd::chrono::microseconds budget) = 0;
+        //! Returns the time that may be spent per update on adding newly spawned entities to the world, or zero if unbounded.
+        [[nodiscard]] virtual AZStd::chrono::microseconds GetEntityActivationBudget() const = 0;
+
     protected:
         [[nodiscard]] virtual void* CreateTicket(AZ::Data::Asset<Spawnable>&& spawnable) = 0;
         virtual void IncrementTicketReference(void* ticket) = 0;
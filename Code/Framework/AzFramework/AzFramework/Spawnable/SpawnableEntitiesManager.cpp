@@ -8,16 +8,22 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 
+AZ_DECLARE_BUDGET(AzFramework);
+
 namespace AzFramework
 {
     template<typename T>
@@ -44,6 +50,14 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            value = m_parallelCloneThreshold;
+            settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            m_parallelCloneThreshold = aznumeric_cast<size_t>(value);
+
+            value = 0;
+            settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/EntityActivationBudgetMicroseconds");
+            m_entityActivationBudget = aznumeric_cast<AZStd::chrono::microseconds::rep>(value);
         }
     }
 
@@ -62,6 +76,10 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
+        queueEntry.m_firstSpawnedEntity = 0;
+        queueEntry.m_nextEntityToActivate = 0;
+        queueEntry.m_entitiesCloned = false;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -77,6 +95,10 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_progressCallback = AZStd::move(optionalArgs.m_progressCallback);
+        queueEntry.m_firstSpawnedEntity = 0;
+        queueEntry.m_nextEntityToActivate = 0;
+        queueEntry.m_entitiesCloned = false;
         queueEntry.m_referencePreviouslySpawnedEntities = optionalArgs.m_referencePreviouslySpawnedEntities;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
@@ -210,8 +232,21 @@ namespace AzFramework
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
+    void SpawnableEntitiesManager::SetEntityActivationBudget(AZStd::chrono::microseconds budget)
+    {
+        m_entityActivationBudget = AZStd::max(budget.count(), AZStd::chrono::microseconds::rep(0));
+    }
+
+    AZStd::chrono::microseconds SpawnableEntitiesManager::GetEntityActivationBudget() const
+    {
+        return AZStd::chrono::microseconds(m_entityActivationBudget.load());
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        // The activation budget is shared between both queues, so the high priority requests get the first pick.
+        m_entityActivationDeadline = AZStd::chrono::steady_clock::now() + GetEntityActivationBudget();
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -352,6 +387,78 @@ namespace AzFramework
             &entityPrototype, prototypeToCloneMap, &serializeContext);
     }
 
+    bool SpawnableEntitiesManager::ShouldCloneInParallel(size_t entityCount) const
+    {
+        if (m_parallelCloneThreshold == 0 || entityCount < m_parallelCloneThreshold)
+        {
+            return false;
+        }
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        return taskGraphActive && taskGraphActive->IsTaskGraphActive();
+    }
+
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        const Spawnable::EntityList& entityPrototypes,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext,
+        AZStd::vector<AZ::Entity*>& spawnedEntities)
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        // Mirrors the id mapping done by CloneSingleEntity. The ids of the prototypes are generated before cloning starts, so the
+        // exclusive lock is only needed for the rare id that the mapping doesn't know about yet.
+        AZStd::shared_mutex mapMutex;
+        auto idMapper = [&prototypeToCloneMap, &mapMutex](
+                            const AZ::EntityId& originalId,
+                            bool replaceId,
+                            const AZ::IdUtils::Remapper<AZ::EntityId>::IdGenerator& idGenerator) -> AZ::EntityId
+        {
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(mapMutex);
+                if (auto it = prototypeToCloneMap.find(originalId); it != prototypeToCloneMap.end())
+                {
+                    return it->second;
+                }
+            }
+            if (replaceId && idGenerator)
+            {
+                AZStd::unique_lock<AZStd::shared_mutex> lock(mapMutex);
+                return prototypeToCloneMap.emplace(originalId, idGenerator()).first->second;
+            }
+            return originalId;
+        };
+
+        size_t firstClone = spawnedEntities.size();
+        size_t entityCount = entityPrototypes.size();
+        spawnedEntities.resize(firstClone + entityCount, nullptr);
+        AZ::Entity** clones = spawnedEntities.data() + firstClone;
+
+        // Enough entities per task to amortize scheduling, while still giving every worker a share of large spawnables.
+        constexpr size_t EntitiesPerTask = 16;
+        static const AZ::TaskDescriptor cloneTaskDescriptor{ "Clone spawnable entities", "Spawnables" };
+
+        AZ::TaskGraph taskGraph{ "SpawnableEntitiesCloning" };
+        for (size_t begin = 0; begin < entityCount; begin += EntitiesPerTask)
+        {
+            size_t end = AZStd::min(begin + EntitiesPerTask, entityCount);
+            taskGraph.AddTask(
+                cloneTaskDescriptor,
+                [&entityPrototypes, &serializeContext, &idMapper, clones, begin, end]()
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        AZ::Entity* clone = serializeContext.CloneObject(entityPrototypes[i].get());
+                        AZ::IdUtils::Remapper<AZ::EntityId>::ReplaceIdsAndIdRefs(clone, idMapper, &serializeContext);
+                        clones[i] = clone;
+                    }
+                });
+        }
+
+        AZ::TaskGraphEvent finished{ "SpawnableEntitiesCloning wait" };
+        taskGraph.Submit(&finished);
+        finished.Wait();
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
         const AZ::Entity& entityPrototype,
         const Spawnable::EntityAlias& alias,
@@ -444,9 +551,65 @@ namespace AzFramework
         }
     }
 
+    bool SpawnableEntitiesManager::IsEntityActivationBudgetExhausted() const
+    {
+        return m_entityActivationBudget != 0 && AZStd::chrono::steady_clock::now() >= m_entityActivationDeadline;
+    }
+
+    template<typename Command>
+    auto SpawnableEntitiesManager::ActivateSpawnedEntities(Command& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        size_t spawnedEntitiesEnd = ticket.m_spawnedEntities.size();
+
+        // Add to the game context, now the entities are active
+        while (request.m_nextEntityToActivate < spawnedEntitiesEnd)
+        {
+            AZ::Entity* clone = ticket.m_spawnedEntities[request.m_nextEntityToActivate++];
+            clone->SetEntitySpawnTicketId(request.m_ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+
+            if (IsEntityActivationBudgetExhausted())
+            {
+                break;
+            }
+        }
+
+        if (request.m_progressCallback)
+        {
+            request.m_progressCallback(
+                request.m_ticketId, request.m_nextEntityToActivate - request.m_firstSpawnedEntity,
+                spawnedEntitiesEnd - request.m_firstSpawnedEntity);
+        }
+
+        if (request.m_nextEntityToActivate < spawnedEntitiesEnd)
+        {
+            // Continue in the next update. Later requests on this ticket will wait as the current request id isn't updated yet.
+            return CommandResult::Requeue;
+        }
+
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            request.m_completionCallback(
+                request.m_ticketId,
+                SpawnableConstEntityContainerView(
+                    ticket.m_spawnedEntities.begin() + request.m_firstSpawnedEntity, ticket.m_spawnedEntities.end()));
+        }
+
+        ticket.m_currentRequestId++;
+        return CommandResult::Executed;
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
+        if (request.m_entitiesCloned)
+        {
+            // The entities were created by an earlier call, but didn't all fit in the activation budget.
+            return ActivateSpawnedEntities(request);
+        }
+
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
             if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
@@ -476,7 +639,19 @@ namespace AzFramework
 
                 auto aliasIt = aliases.begin();
                 auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                if (aliasIt == aliasEnd && ShouldCloneInParallel(entitiesToSpawnSize))
+                {
+                    // The reference map was just reset so every entity keeps the id that was generated for it up front, which means
+                    // the order in which the entities are cloned doesn't affect how references are resolved.
+                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    {
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        spawnedEntityIndices.push_back(i);
+                    }
+                    CloneEntitiesInParallel(entitiesToSpawn, ticket.m_entityIdReferenceMap, *request.m_serializeContext, spawnedEntities);
+                }
+                else if (aliasIt == aliasEnd)
                 {
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
@@ -537,22 +712,10 @@ namespace AzFramework
                     request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
-                }
-
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_firstSpawnedEntity = spawnedEntitiesInitialCount;
+                request.m_nextEntityToActivate = spawnedEntitiesInitialCount;
+                request.m_entitiesCloned = true;
+                return ActivateSpawnedEntities(request);
             }
         }
         return CommandResult::Requeue;
@@ -561,6 +724,12 @@ namespace AzFramework
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
+        if (request.m_entitiesCloned)
+        {
+            // The entities were created by an earlier call, but didn't all fit in the activation budget.
+            return ActivateSpawnedEntities(request);
+        }
+
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
             if (Spawnable::EntityAliasConstVisitor aliases = ticket.m_spawnable->TryGetAliasesConst();
@@ -670,24 +839,10 @@ namespace AzFramework
                             ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
-                // Add to the game context, now the entities are active
-                for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
-                }
-
-                if (request.m_completionCallback)
-                {
-                    request.m_completionCallback(
-                        request.m_ticketId,
-                        SpawnableConstEntityContainerView(
-                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
-                }
-
-                ticket.m_currentRequestId++;
-                return CommandResult::Executed;
+                request.m_firstSpawnedEntity = spawnedEntitiesInitialCount;
+                request.m_nextEntityToActivate = spawnedEntitiesInitialCount;
+                request.m_entitiesCloned = true;
+                return ActivateSpawnedEntities(request);
             }
         }
         return CommandResult::Requeue;
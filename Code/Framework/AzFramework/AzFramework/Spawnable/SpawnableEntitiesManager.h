@@ -82,6 +82,9 @@ namespace AzFramework
         void LoadBarrier(
             EntitySpawnTicket& spawnInfo, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs = {}) override;
 
+        void SetEntityActivationBudget(AZStd::chrono::microseconds budget) override;
+        AZStd::chrono::microseconds GetEntityActivationBudget() const override;
+
         //
         // The following function is thread safe but intended to be run from the main thread.
         //
@@ -130,21 +133,33 @@ namespace AzFramework
         {
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Index of the first entity created by this command in the ticket. Only valid once the entities have been cloned.
+            size_t m_firstSpawnedEntity;
+            //! Index in the ticket of the next entity to add to the game world.
+            size_t m_nextEntityToActivate;
+            bool m_entitiesCloned;
         };
         struct SpawnEntitiesCommand final
         {
             AZStd::vector<uint32_t> m_entityIndices;
             EntitySpawnCallback m_completionCallback;
             EntityPreInsertionCallback m_preInsertionCallback;
+            EntitySpawnProgressCallback m_progressCallback;
             AZ::SerializeContext* m_serializeContext;
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            //! Index of the first entity created by this command in the ticket. Only valid once the entities have been cloned.
+            size_t m_firstSpawnedEntity;
+            //! Index in the ticket of the next entity to add to the game world.
+            size_t m_nextEntityToActivate;
             bool m_referencePreviouslySpawnedEntities;
+            bool m_entitiesCloned;
         };
         struct DespawnAllEntitiesCommand final
         {
@@ -266,6 +281,15 @@ namespace AzFramework
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Returns true if there are enough entities to clone for the cost of distributing the work over the task graph.
+        bool ShouldCloneInParallel(size_t entityCount) const;
+        //! Clones the prototypes in parallel on the task graph and appends the clones to spawnedEntities, in the same order as a
+        //! serial clone would. Only the entity id map is shared between the clones, access to it is synchronized.
+        void CloneEntitiesInParallel(
+            const Spawnable::EntityList& entityPrototypes,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext,
+            AZStd::vector<AZ::Entity*>& spawnedEntities);
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
@@ -278,6 +302,12 @@ namespace AzFramework
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
         
+        //! Adds the entities cloned by a spawn command to the game world until the activation budget runs out.
+        //! Returns Requeue if there are entities left to add, in which case the next call continues where this one left off.
+        template<typename Command>
+        CommandResult ActivateSpawnedEntities(Command& request);
+        bool IsEntityActivationBudgetExhausted() const;
+
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
         CommandResult ProcessRequest(DespawnAllEntitiesCommand& request);
@@ -311,6 +341,17 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities a SpawnAllEntities call needs to create before the entities are cloned in parallel. This
+        //! can be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold",
+        //! where 0 disables parallel cloning.
+        size_t m_parallelCloneThreshold { 64 };
+
+        //! Time in microseconds that may be spent per call to ProcessQueue on adding spawned entities to the game world, 0 if unbounded.
+        //! The starting value can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/EntityActivationBudgetMicroseconds".
+        AZStd::atomic<AZStd::chrono::microseconds::rep> m_entityActivationBudget{ 0 };
+        //! The moment the activation budget of the current call to ProcessQueue runs out.
+        AZStd::chrono::steady_clock::time_point m_entityActivationDeadline;
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
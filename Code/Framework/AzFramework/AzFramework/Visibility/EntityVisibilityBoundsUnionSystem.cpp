@@ -89,7 +89,7 @@ namespace AzFramework
         }
     }
 
-    void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    bool EntityVisibilityBoundsUnionSystem::UpdateWorldBounds(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance) const
     {
         if (const auto& localEntityBoundsUnions = instance.m_localEntityBoundsUnion; localEntityBoundsUnions.IsValid())
         {
@@ -97,10 +97,21 @@ namespace AzFramework
             // there will be some wasted space but it should be sufficient for the visibility system
             AZ::TransformInterface* transformInterface = entity->GetTransform();
             const AZ::Aabb worldEntityBoundsUnion = localEntityBoundsUnions.GetTransformedAabb(transformInterface->GetWorldTM());
-            IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
-            if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
+            if (!worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
+        if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get())
+        {
+            if (UpdateWorldBounds(entity, instance))
+            {
                 visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
             }
         }
@@ -153,6 +164,12 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AzFramework);
 
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+        if (!visibilitySystem)
+        {
+            return;
+        }
+
         // iterate over all entities whose bounds changed and recalculate them
         for (const auto& entity : m_entityBoundsDirty)
         {
@@ -160,21 +177,46 @@ namespace AzFramework
                 instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instanceIt->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instanceIt->second);
+                if (UpdateWorldBounds(entity, instanceIt->second))
+                {
+                    m_pendingVisibilityEntries.push_back(&instanceIt->second.m_visibilityEntry);
+                }
             }
         }
 
+        // iterate over all entities that moved, entities deactivated since they moved are no longer in the mapping
+        for (AZ::Entity* entity : m_entityTransformsDirty)
+        {
+            if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
+                instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
+            {
+                instanceIt->second.m_transformDirty = false;
+
+                // entities that also changed bounds have already had their world bounds updated above
+                if (m_entityBoundsDirty.find(entity) == m_entityBoundsDirty.end() && UpdateWorldBounds(entity, instanceIt->second))
+                {
+                    m_pendingVisibilityEntries.push_back(&instanceIt->second.m_visibilityEntry);
+                }
+            }
+        }
+
+        visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_pendingVisibilityEntries);
+
         // clear dirty entities once the visibility system has been updated
+        m_pendingVisibilityEntries.clear();
+        m_entityTransformsDirty.clear();
         m_entityBoundsDirty.clear();
     }
 
     void EntityVisibilityBoundsUnionSystem::OnTransformUpdated(AZ::Entity* entity)
     {
-        // update the world transform of the visibility bounds union
+        // track entities that moved, their world bounds are written to the visibility system in one batch
+        // the next time ProcessEntityBoundsUnionRequests is called
         if (auto instanceIt = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
-            instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end())
+            instanceIt != m_entityVisibilityBoundsUnionInstanceMapping.end() && !instanceIt->second.m_transformDirty)
         {
-            UpdateVisibilitySystem(entity, instanceIt->second);
+            instanceIt->second.m_transformDirty = true;
+            m_entityTransformsDirty.push_back(entity);
         }
     }
 
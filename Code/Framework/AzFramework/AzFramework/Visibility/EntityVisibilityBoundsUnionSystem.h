@@ -40,6 +40,7 @@ namespace AzFramework
         {
             AZ::Aabb m_localEntityBoundsUnion = AZ::Aabb::CreateNull(); //!< Entity union bounding volume in local space.
             VisibilityEntry m_visibilityEntry; //!< Hook into the IVisibilitySystem interface.
+            bool m_transformDirty = false; //!< Set while the entity is queued in m_entityTransformsDirty.
         };
 
         using UniqueEntities = AZStd::set<AZ::Entity*>;
@@ -54,8 +55,13 @@ namespace AzFramework
 
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
+        //! Recalculates the world bounds of the instance, returns true if the visibility entry needs to be updated.
+        bool UpdateWorldBounds(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance) const;
+
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        AZStd::vector<AZ::Entity*> m_entityTransformsDirty; //!< Entities that moved since the visibility system was last updated.
+        AZStd::vector<VisibilityEntry*> m_pendingVisibilityEntries; //!< Scratch list of entries written to the visibility system in one batch.
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
@@ -19,7 +19,9 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_ref.h>
 
 namespace AzFramework
 {
@@ -61,7 +63,8 @@ namespace AzFramework
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
         };
-        using EnumerateCallback = AZStd::function<void(const NodeData&)>;
+        //! The callback is only called during the enumeration, so it references the callable instead of copying it.
+        using EnumerateCallback = AZStd::function_ref<void(const NodeData&)>;
 
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
@@ -75,6 +78,17 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a set of entries within the visibility system, see InsertOrUpdateEntry.
+        //! Implementations may apply the whole set at once, so prefer this when many entries change together (e.g. once per tick).
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> visibilityEntries)
+        {
+            for (VisibilityEntry* visibilityEntry : visibilityEntries)
+            {
+                InsertOrUpdateEntry(*visibilityEntry);
+            }
+        }
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
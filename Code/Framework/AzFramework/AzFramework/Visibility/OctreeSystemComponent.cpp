@@ -16,6 +16,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,           1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the bounds of each octree node for newly created scenes, values greater than 1 create a loose octree that re-inserts moving entries less often");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,14 +25,14 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
-    OctreeNode::OctreeNode(const AZ::Aabb& bounds)
-        : m_bounds(bounds)
+    OctreeNode::OctreeNode(const AZ::Aabb& bounds, float looseness)
     {
-        ;
+        SetBounds(bounds, looseness);
     }
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -46,6 +47,7 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -64,17 +66,9 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
         // If this is not a leaf node, try to insert into the child nodes
-        if (m_children != nullptr)
+        if (OctreeNode* child = FindChildForEntry(entry->m_boundingVolume))
         {
-            const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
-            {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
-            }
+            return child->Insert(octreeScene, entry);
         }
 
         // If we reach here, either we don't have children or the entry overlaps multiple child nodes
@@ -98,32 +92,49 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume) && !FindChildForEntry(boundingVolume))
         {
-            // Entry moved, but is still fully contained within the current node
-            // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
-            // even when one of the child nodes would be an adequate fit, due to this early out check
+            // Entry moved, but is still fully contained within the current node and wouldn't be pushed down to a child node
+            // Checking the child nodes prevents entries getting 'stuck' in non-leaf nodes when a child node would be an adequate fit
             return;
         }
 
         // Remove the entry from our current node, since it is no longer contained
-        Remove(octreeScene, entry);
+        // Merging is deferred until the entry has been re-inserted, an entry that moves to a sibling node would otherwise
+        // merge the parent only for the insertion to split it again
+        RemoveEntryFromNode(entry);
 
         // Traverse up our ancestor nodes to find the first node that fully contains the entry
         // This strategy assumes an entry will typically move a small distance relative to the total world
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
-                return insertCheck->Insert(octreeScene, entry);
+                insertCheck->Insert(octreeScene, entry);
+                break;
             }
             insertCheck = insertCheck->m_parent;
         }
+
+        if (m_parent != nullptr)
+        {
+            m_parent->TryMerge(octreeScene);
+        }
     }
 
     void OctreeNode::Remove(OctreeScene& octreeScene, VisibilityEntry* entry)
+    {
+        RemoveEntryFromNode(entry);
+
+        if (m_parent != nullptr)
+        {
+            m_parent->TryMerge(octreeScene);
+        }
+    }
+
+    void OctreeNode::RemoveEntryFromNode(VisibilityEntry* entry)
     {
         AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different OctreeNode");
         AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
@@ -138,16 +149,42 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+    }
 
-        if (m_parent != nullptr)
+    OctreeNode* OctreeNode::FindChildForEntry(const AZ::Aabb& boundingVolume) const
+    {
+        if (m_children == nullptr)
         {
-            m_parent->TryMerge(octreeScene);
+            return nullptr;
+        }
+
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (m_children[child].m_bounds.Contains(center))
+            {
+                // The entry stays in this node if it overlaps the loose bounds of the child that owns its center
+                return AZ::ShapeIntersection::Contains(m_children[child].m_looseBounds, boundingVolume) ? &m_children[child] : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    void OctreeNode::SetBounds(const AZ::Aabb& bounds, float looseness)
+    {
+        m_bounds = bounds;
+        m_looseBounds = bounds;
+        if (looseness != 1.0f)
+        {
+            const AZ::Vector3 looseHalfExtents = bounds.GetExtents() * (0.5f * looseness);
+            m_looseBounds = AZ::Aabb::CreateCenterHalfExtents(bounds.GetCenter(), looseHalfExtents);
         }
     }
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(aabb, m_looseBounds))
         {
             EnumerateHelper(aabb, callback);
         }
@@ -155,7 +192,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(sphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(sphere, m_looseBounds))
         {
             EnumerateHelper(sphere, callback);
         }
@@ -163,7 +200,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(hemisphere, m_looseBounds))
         {
             EnumerateHelper(hemisphere, callback);
         }
@@ -171,7 +208,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(capsule, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(capsule, m_looseBounds))
         {
             EnumerateHelper(capsule, callback);
         }
@@ -179,7 +216,7 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(frustum, m_looseBounds))
         {
             EnumerateHelper(frustum, callback);
         }
@@ -187,12 +224,12 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_bounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_bounds))
+        if (AZ::ShapeIntersection::Overlaps(includeFrustum, m_looseBounds) && !AZ::ShapeIntersection::Contains(excludeFrustum, m_looseBounds))
         {
             // Invoke the callback for the current node
             if (!m_entries.empty())
             {
-                callback({ m_bounds, m_entries });
+                callback({ m_looseBounds, m_entries });
             }
 
             if (m_children != nullptr)
@@ -212,7 +249,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -231,6 +268,11 @@ namespace AzFramework
         return m_entries;
     }
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
     OctreeNode* OctreeNode::GetChildren() const
     {
         return m_children;
@@ -271,12 +313,12 @@ namespace AzFramework
     template <typename T>
     void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_looseBounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
 
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -285,7 +327,7 @@ namespace AzFramework
             const uint32_t childCount = GetChildNodeCount();
             for (uint32_t child = 0; child < childCount; ++child)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_looseBounds))
                 {
                     m_children[child].EnumerateHelper(boundingVolume, callback);
                 }
@@ -327,7 +369,7 @@ namespace AzFramework
                     childOffset.SetZ(childExtent.GetZ());
                 }
 
-                m_children[child].m_bounds = childBound.GetTranslated(childOffset);
+                m_children[child].SetBounds(childBound.GetTranslated(childOffset), octreeScene.GetLooseness());
                 m_children[child].m_parent = this;
             }
         }
@@ -366,9 +408,11 @@ namespace AzFramework
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
         : m_sceneName(sceneName)
-        , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)))
+        , m_looseness(AZStd::max(static_cast<float>(bg_octreeLooseness), 1.0f))
+        , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)), m_looseness)
     {
         AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        AZ_Warning("OctreeScene", bg_octreeLooseness >= 1.0f, "bg_octreeLooseness must be at least 1, clamping to 1");
     }
 
     OctreeScene::~OctreeScene()
@@ -389,6 +433,20 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryInternal(entry);
+    }
+
+    void OctreeScene::InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryInternal(*entry);
+        }
+    }
+
+    void OctreeScene::InsertOrUpdateEntryInternal(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -478,6 +536,11 @@ namespace AzFramework
         return AzFramework::GetChildNodeCount();
     }
 
+    float OctreeScene::GetLooseness() const
+    {
+        return m_looseness;
+    }
+
     void OctreeScene::DumpStats()
     {
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
@@ -485,6 +548,7 @@ namespace AzFramework
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
         AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+        AZ_TracePrintf("Console", "OctreeScene[\"%s\"]::Looseness = %.2f", GetName().GetCStr(), GetLooseness());
     }
 
     static inline uint32_t CreateNodeIndex(uint32_t page, uint32_t offset)
@@ -22,14 +22,16 @@ namespace AzFramework
     class OctreeScene;
 
     //! An internal node within the tree.
-    //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! It contains all objects that are *fully contained* by the loose bounds of the node, if an object doesn't fit within the loose bounds of any
+    //! child node that object will be stored in the parent.
+    //! The loose bounds are the node bounds scaled about their center by the looseness of the scene, see bg_octreeLooseness.
     class OctreeNode
         : public VisibilityNode
     {
     public:
 
         OctreeNode() = default;
-        explicit OctreeNode(const AZ::Aabb& bounds);
+        OctreeNode(const AZ::Aabb& bounds, float looseness);
         OctreeNode(OctreeNode&& rhs);
 
         virtual ~OctreeNode() = default;
@@ -63,6 +65,9 @@ namespace AzFramework
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
+        //! Returns the bounds of this node, every entry bound to this node is contained by these bounds.
+        const AZ::Aabb& GetLooseBounds() const;
+
         //! Returns the array of child nodes for this OctreeNode, may be nullptr if this OctreeNode is a leaf node.
         OctreeNode* GetChildren() const;
 
@@ -79,11 +84,21 @@ namespace AzFramework
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
 
+        //! Unbinds an entry from this node without attempting to merge the parent node.
+        void RemoveEntryFromNode(VisibilityEntry* entry);
+
+        //! Returns the child node an entry would be pushed down to, or nullptr if it should remain in this node.
+        //! The child is selected by the center of the entry, so entries spread across children even when loose bounds overlap.
+        OctreeNode* FindChildForEntry(const AZ::Aabb& boundingVolume) const;
+
+        void SetBounds(const AZ::Aabb& bounds, float looseness);
+
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds; //< Cached m_bounds scaled by the looseness of the scene, used for all containment and intersection tests
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
@@ -91,6 +106,8 @@ namespace AzFramework
 
     //! Implementation of the visibility system interface.
     //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! When bg_octreeLooseness is greater than one the octree is a loose octree, so entries that move by a fraction of the node size
+    //! stay bound to their node instead of being re-inserted.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -106,6 +123,7 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(AZStd::span<VisibilityEntry* const> entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
@@ -123,10 +141,13 @@ namespace AzFramework
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
+        float GetLooseness() const;
         void DumpStats();
         //! @}
 
     private:
+        void InsertOrUpdateEntryInternal(VisibilityEntry& entry);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
@@ -134,6 +155,7 @@ namespace AzFramework
         mutable AZStd::shared_mutex m_sharedMutex;
 
         AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        float m_looseness = 1.0f; //< The scale applied to the bounds of each node, captured from bg_octreeLooseness on creation.
         OctreeNode m_root; //< The root node for the octreeSystemComponent.
 
         uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Asset/AssetRegistry.h>
 
@@ -51,4 +52,79 @@ namespace UnitTest
 
         EXPECT_THAT(id2Set, ::testing::UnorderedElementsAre());
     }
+
+    TEST_F(AssetRegistry, CompactFormat_SaveAndLoad_RoundTripsRegistry)
+    {
+        using namespace ::testing;
+
+        AzFramework::AssetRegistry registry;
+
+        AZ::Data::AssetId assetId1("{914F8E72-5EBB-461E-A029-90B07DD7D0E4}", 1);
+        AZ::Data::AssetId assetId2("{8735EA11-CB48-41D5-8D63-2A5AFB269952}", 4);
+        AZ::Data::AssetId legacyId("{C94A4B65-5F1E-48C6-9704-42BB6CF61E11}", 2);
+
+        AZ::Data::AssetInfo assetInfo1;
+        assetInfo1.m_assetId = assetId1;
+        assetInfo1.m_assetType = AZ::Uuid("{153CC980-91FC-4766-92CE-67222DF91F3C}");
+        assetInfo1.m_sizeBytes = 1234;
+        assetInfo1.m_relativePath = "objects/asset1.azmodel";
+        registry.RegisterAsset(assetId1, assetInfo1);
+
+        AZ::Data::AssetInfo assetInfo2 = assetInfo1;
+        assetInfo2.m_assetId = assetId2;
+        assetInfo2.m_relativePath = "objects/asset2.azmodel";
+        registry.RegisterAsset(assetId2, assetInfo2);
+
+        registry.RegisterLegacyAssetMapping(legacyId, assetId1);
+        registry.RegisterAssetDependency(assetId1, AZ::Data::ProductDependency(assetId2, AZStd::bitset<64>(5)));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(registry.SaveCompact(saveStream));
+
+        AZ::IO::MemoryStream loadStream(buffer.data(), buffer.size());
+        EXPECT_TRUE(AzFramework::AssetRegistry::IsCompactStream(loadStream));
+        EXPECT_EQ(loadStream.GetCurPos(), 0);
+
+        AzFramework::AssetRegistry loadedRegistry;
+        ASSERT_TRUE(loadedRegistry.LoadCompact(loadStream));
+
+        ASSERT_EQ(loadedRegistry.m_assetIdToInfo.size(), 2);
+        const AZ::Data::AssetInfo& loadedInfo = loadedRegistry.m_assetIdToInfo[assetId1];
+        EXPECT_EQ(loadedInfo.m_assetId, assetId1);
+        EXPECT_EQ(loadedInfo.m_assetType, assetInfo1.m_assetType);
+        EXPECT_EQ(loadedInfo.m_sizeBytes, assetInfo1.m_sizeBytes);
+        EXPECT_EQ(loadedInfo.m_relativePath, assetInfo1.m_relativePath);
+
+        EXPECT_EQ(loadedRegistry.GetAssetIdByPath("objects/asset2.azmodel"), assetId2);
+        EXPECT_EQ(loadedRegistry.GetAssetIdByLegacyAssetId(legacyId), assetId1);
+        EXPECT_THAT(loadedRegistry.GetLegacyMappingSubsetFromRealIds({ assetId1 }), UnorderedElementsAre(Pair(legacyId, assetId1)));
+
+        auto dependencies = loadedRegistry.GetAssetDependencies(assetId1);
+        ASSERT_EQ(dependencies.size(), 1);
+        EXPECT_EQ(dependencies[0].m_assetId, assetId2);
+        EXPECT_EQ(dependencies[0].m_flags, AZStd::bitset<64>(5));
+    }
+
+    TEST_F(AssetRegistry, CompactFormat_TruncatedStream_FailsToLoad)
+    {
+        AzFramework::AssetRegistry registry;
+
+        AZ::Data::AssetId assetId("{914F8E72-5EBB-461E-A029-90B07DD7D0E4}", 1);
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = assetId;
+        assetInfo.m_relativePath = "objects/asset1.azmodel";
+        registry.RegisterAsset(assetId, assetInfo);
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> saveStream(&buffer);
+        ASSERT_TRUE(registry.SaveCompact(saveStream));
+
+        AZ::IO::MemoryStream loadStream(buffer.data(), buffer.size() / 2);
+        AzFramework::AssetRegistry loadedRegistry;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loadedRegistry.LoadCompact(loadStream));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_TRUE(loadedRegistry.m_assetIdToInfo.empty());
+    }
 }
@@ -70,6 +70,8 @@ namespace AzFramework
 
         MOCK_METHOD3(Barrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, BarrierOptionalArgs optionalArgs));
         MOCK_METHOD3(LoadBarrier, void(EntitySpawnTicket& ticket, BarrierCallback completionCallback, LoadBarrierOptionalArgs optionalArgs));
+        MOCK_METHOD1(SetEntityActivationBudget, void(AZStd::chrono::microseconds budget));
+        MOCK_CONST_METHOD0(GetEntityActivationBudget, AZStd::chrono::microseconds());
 
         MOCK_METHOD1(CreateTicket, void*(AZ::Data::Asset<Spawnable>&& spawnable));
         MOCK_METHOD1(IncrementTicketReference, void(void* ticket));
@@ -32,6 +32,7 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -57,6 +58,8 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -74,6 +77,7 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 0.0f;
         AZ::Console* m_console;
     };
 
@@ -227,6 +231,78 @@ namespace UnitTest
         gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
     }
 
+    TEST_F(OctreeTests, InsertOrUpdateEntries_BatchOfEntries_AllEntriesInsertedAndUpdated)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        VisibilityEntry* entries[] = { &visEntry[0], &visEntry[1], &visEntry[2] };
+
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        // Swap the entries around and update them all in a single batch
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        for (const AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(entry.m_boundingVolume, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+            EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &entry), gatheredEntries.end());
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
+    }
+
+    TEST_F(OctreeTests, UpdateEntry_LooseOctree_SmallMoveStaysInNode)
+    {
+        // Looseness is captured when a scene is created
+        m_console->PerformCommand("bg_octreeLooseness 2");
+        IVisibilityScene* visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeLooseUnitTestScene"));
+        OctreeScene* looseScene = azdynamic_cast<OctreeScene*>(visScene);
+        ASSERT_NE(looseScene, nullptr);
+        EXPECT_FLOAT_EQ(looseScene->GetLooseness(), 2.0f);
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        looseScene->InsertOrUpdateEntry(visEntry[0]);
+        looseScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        ValidateEntryCountEqualsExpectedCount(looseScene, 2);
+        EXPECT_TRUE(looseScene->GetNodeCount() == 1 + looseScene->GetChildNodeCount());
+        EXPECT_NE(visEntry[0].m_internalNode, visEntry[1].m_internalNode);
+
+        // Move the entry across the boundary of its node, it should remain within the node's loose bounds
+        const VisibilityNode* previousNode = visEntry[1].m_internalNode;
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.2f), AZ::Vector3(0.1f));
+        looseScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, previousNode);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 2);
+        EXPECT_TRUE(looseScene->GetNodeCount() == 1 + looseScene->GetChildNodeCount());
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        looseScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.15f), AZ::Vector3(-0.1f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry[1]), gatheredEntries.end());
+
+        looseScene->RemoveEntry(visEntry[1]);
+        looseScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(looseScene, 0);
+        m_octreeSystemComponent->DestroyVisibilityScene(looseScene);
+    }
+
     template <typename BoundType>
     void EnumerateSingleEntryHelper(IVisibilityScene* visScene, const BoundType& bounds)
     {
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableBinaryFormat.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class SpawnableBinaryFormatTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_application = new AzFramework::Application();
+            AZ::ComponentApplication::Descriptor descriptor;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start(descriptor, startupParameters);
+
+            // Without this, the user settings component would attempt to save on finalize/shutdown. Since the file is
+            // shared across the whole engine, if multiple tests are run in parallel, the saving could cause a crash
+            // in the unit tests.
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+        }
+
+        void TearDown() override
+        {
+            delete m_application;
+            m_application = nullptr;
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        void FillSpawnable(AzFramework::Spawnable& spawnable, size_t numEntities)
+        {
+            AzFramework::Spawnable::EntityList& entities = spawnable.GetEntities();
+            for (size_t i = 0; i < numEntities; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(EntityIdStartId + i), AZStd::string::format("Entity %zu", i));
+                auto transform = aznew AzFramework::TransformComponent();
+                transform->SetWorldTM(AZ::Transform::CreateTranslation(AZ::Vector3(aznumeric_cast<float>(i), 0.0f, 0.0f)));
+                entity->AddComponent(transform);
+                entities.push_back(AZStd::move(entity));
+            }
+        }
+
+        void ExpectMatchingEntities(const AzFramework::Spawnable& expected, const AzFramework::Spawnable& actual)
+        {
+            const AzFramework::Spawnable::EntityList& expectedEntities = expected.GetEntities();
+            const AzFramework::Spawnable::EntityList& actualEntities = actual.GetEntities();
+            ASSERT_EQ(expectedEntities.size(), actualEntities.size());
+            for (size_t i = 0; i < expectedEntities.size(); ++i)
+            {
+                ASSERT_NE(nullptr, actualEntities[i]);
+                EXPECT_EQ(expectedEntities[i]->GetId(), actualEntities[i]->GetId());
+                EXPECT_EQ(expectedEntities[i]->GetName(), actualEntities[i]->GetName());
+
+                auto transform = actualEntities[i]->FindComponent<AzFramework::TransformComponent>();
+                ASSERT_NE(nullptr, transform);
+                EXPECT_EQ(
+                    expectedEntities[i]->FindComponent<AzFramework::TransformComponent>()->GetWorldTM().GetTranslation(),
+                    transform->GetWorldTM().GetTranslation());
+            }
+        }
+
+    protected:
+        static constexpr AZ::u64 EntityIdStartId = 40;
+        const AZ::Data::AssetId SpawnableId{ AZ::Uuid("{8F3A6C1E-2B59-4D07-9E84-C1A7D36B5F20}"), 0 };
+
+        AzFramework::Application* m_application{ nullptr };
+    };
+
+    TEST_F(SpawnableBinaryFormatTest, SaveAndLoad_FewEntities_EntitiesAreRestored)
+    {
+        AzFramework::Spawnable original(SpawnableId, AZ::Data::AssetData::AssetStatus::Ready);
+        FillSpawnable(original, 4);
+
+        AZStd::vector<uint8_t> data;
+        AZ::IO::ByteContainerStream stream(&data);
+        ASSERT_TRUE(AzFramework::SpawnableBinaryFormat::Save(stream, original));
+        EXPECT_TRUE(AzFramework::SpawnableBinaryFormat::IsPackedBinary(data.data(), data.size()));
+
+        AzFramework::Spawnable loaded(SpawnableId);
+        ASSERT_TRUE(AzFramework::SpawnableBinaryFormat::Load(data.data(), data.size(), loaded));
+        ExpectMatchingEntities(original, loaded);
+    }
+
+    TEST_F(SpawnableBinaryFormatTest, SaveAndLoad_ManyEntities_EntitiesAreRestoredInOrder)
+    {
+        // Enough entities to be decoded in parallel if the task graph is available.
+        AzFramework::Spawnable original(SpawnableId, AZ::Data::AssetData::AssetStatus::Ready);
+        FillSpawnable(original, 200);
+
+        AZStd::vector<uint8_t> data;
+        AZ::IO::ByteContainerStream stream(&data);
+        ASSERT_TRUE(AzFramework::SpawnableBinaryFormat::Save(stream, original));
+
+        AzFramework::Spawnable loaded(SpawnableId);
+        ASSERT_TRUE(AzFramework::SpawnableBinaryFormat::Load(data.data(), data.size(), loaded));
+        ExpectMatchingEntities(original, loaded);
+    }
+
+    TEST_F(SpawnableBinaryFormatTest, IsPackedBinary_ObjectStreamData_ReturnsFalse)
+    {
+        AzFramework::Spawnable original(SpawnableId, AZ::Data::AssetData::AssetStatus::Ready);
+        FillSpawnable(original, 2);
+
+        AZStd::vector<uint8_t> data;
+        AZ::IO::ByteContainerStream stream(&data);
+        ASSERT_TRUE(AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &original));
+        EXPECT_FALSE(AzFramework::SpawnableBinaryFormat::IsPackedBinary(data.data(), data.size()));
+    }
+
+    TEST_F(SpawnableBinaryFormatTest, Load_TruncatedData_Fails)
+    {
+        AzFramework::Spawnable original(SpawnableId, AZ::Data::AssetData::AssetStatus::Ready);
+        FillSpawnable(original, 4);
+
+        AZStd::vector<uint8_t> data;
+        AZ::IO::ByteContainerStream stream(&data);
+        ASSERT_TRUE(AzFramework::SpawnableBinaryFormat::Save(stream, original));
+        data.resize(data.size() / 2);
+
+        AzFramework::Spawnable loaded(SpawnableId);
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AzFramework::SpawnableBinaryFormat::Load(data.data(), data.size(), loaded));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_TRUE(loaded.GetEntities().empty());
+    }
+} // namespace UnitTest
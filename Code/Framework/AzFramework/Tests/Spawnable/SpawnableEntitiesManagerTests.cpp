@@ -622,6 +622,80 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ManyEntitiesReferenceOtherEntities_EntityIdsAreMappedCorrectly)
+    {
+        // Enough entities to go over the threshold for cloning in parallel, which needs to map references the same as a serial clone.
+        for (EntityReferenceScheme refScheme :
+             { EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceNextCircular,
+               EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 256;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount = entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            ProcessQueueTillEmtpy();
+
+            EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_WithActivationBudget_ProgressIsReportedUntilAllEntitiesAreSpawned)
+    {
+        static constexpr size_t NumEntities = 8;
+        FillSpawnable(NumEntities);
+        m_manager->SetEntityActivationBudget(AZStd::chrono::microseconds(1));
+        EXPECT_EQ(AZStd::chrono::microseconds(1), m_manager->GetEntityActivationBudget());
+
+        size_t progressCalls = 0;
+        size_t lastActivatedCount = 0;
+        size_t completionCalls = 0;
+        size_t spawnedEntitiesCount = 0;
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_progressCallback = [&](AzFramework::EntitySpawnTicket::Id, size_t activatedCount, size_t totalCount)
+        {
+            ++progressCalls;
+            EXPECT_EQ(NumEntities, totalCount);
+            EXPECT_GT(activatedCount, lastActivatedCount);
+            lastActivatedCount = activatedCount;
+        };
+        optionalArgs.m_completionCallback =
+            [&](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            ++completionCalls;
+            spawnedEntitiesCount = entities.size();
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        // Requests queued after the spawn on the same ticket have to wait for all entities to be added.
+        bool barrierReached = false;
+        m_manager->Barrier(
+            *m_ticket,
+            [&](AzFramework::EntitySpawnTicket::Id)
+            {
+                EXPECT_EQ(1, completionCalls);
+                barrierReached = true;
+            });
+        ProcessQueueTillEmtpy();
+
+        EXPECT_TRUE(barrierReached);
+        EXPECT_LE(1, progressCalls);
+        EXPECT_EQ(NumEntities, lastActivatedCount);
+        EXPECT_EQ(1, completionCalls);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+
+        m_manager->SetEntityActivationBudget(AZStd::chrono::microseconds(0));
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformBatchNotificationSystem.h>
+
+namespace UnitTest
+{
+    class TransformBatchListener
+        : public AZ::TransformBatchNotificationBus::Handler
+    {
+    public:
+        TransformBatchListener()
+        {
+            AZ::TransformBatchNotificationBus::Handler::BusConnect();
+        }
+
+        ~TransformBatchListener() override
+        {
+            AZ::TransformBatchNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnTransformsChanged(AZStd::span<const AZ::EntityId> entityIds, AZStd::span<const AZ::Transform> worldTransforms) override
+        {
+            ++m_batchCount;
+            m_entityIds.assign(entityIds.begin(), entityIds.end());
+            m_worldTransforms.assign(worldTransforms.begin(), worldTransforms.end());
+
+            if (m_queueDuringBatch.IsValid())
+            {
+                AZ::Interface<AZ::TransformBatchRequests>::Get()->QueueTransformChanged(m_queueDuringBatch, AZ::Transform::CreateIdentity());
+                m_queueDuringBatch = AZ::EntityId();
+            }
+        }
+
+        int m_batchCount = 0;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Transform> m_worldTransforms;
+        AZ::EntityId m_queueDuringBatch;
+    };
+
+    class TransformBatchNotificationFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_system = AZStd::make_unique<AzFramework::TransformBatchNotificationSystem>();
+            m_system->Connect();
+        }
+
+        void TearDown() override
+        {
+            m_system->Disconnect();
+            m_system.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<AzFramework::TransformBatchNotificationSystem> m_system;
+    };
+
+    TEST_F(TransformBatchNotificationFixture, SeveralChangesToAnEntity_AreCoalescedIntoItsLatestTransform)
+    {
+        TransformBatchListener listener;
+        const AZ::EntityId first(1);
+        const AZ::EntityId second(2);
+
+        m_system->QueueTransformChanged(first, AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 0.0f, 0.0f)));
+        m_system->QueueTransformChanged(second, AZ::Transform::CreateTranslation(AZ::Vector3(2.0f, 0.0f, 0.0f)));
+        m_system->QueueTransformChanged(first, AZ::Transform::CreateTranslation(AZ::Vector3(3.0f, 0.0f, 0.0f)));
+        EXPECT_EQ(0, listener.m_batchCount);
+
+        m_system->FlushTransformChanges();
+        EXPECT_EQ(1, listener.m_batchCount);
+        ASSERT_EQ(2, listener.m_entityIds.size());
+        ASSERT_EQ(2, listener.m_worldTransforms.size());
+        EXPECT_EQ(first, listener.m_entityIds[0]);
+        EXPECT_EQ(second, listener.m_entityIds[1]);
+        EXPECT_EQ(AZ::Vector3(3.0f, 0.0f, 0.0f), listener.m_worldTransforms[0].GetTranslation());
+        EXPECT_EQ(AZ::Vector3(2.0f, 0.0f, 0.0f), listener.m_worldTransforms[1].GetTranslation());
+
+        // Nothing changed since the last batch
+        m_system->FlushTransformChanges();
+        EXPECT_EQ(1, listener.m_batchCount);
+    }
+
+    TEST_F(TransformBatchNotificationFixture, ChangesQueuedDuringABatch_AreSentWithTheNextBatch)
+    {
+        TransformBatchListener listener;
+        listener.m_queueDuringBatch = AZ::EntityId(2);
+
+        m_system->QueueTransformChanged(AZ::EntityId(1), AZ::Transform::CreateIdentity());
+        m_system->FlushTransformChanges();
+        EXPECT_EQ(1, listener.m_batchCount);
+        ASSERT_EQ(1, listener.m_entityIds.size());
+        EXPECT_EQ(AZ::EntityId(1), listener.m_entityIds[0]);
+
+        m_system->FlushTransformChanges();
+        EXPECT_EQ(2, listener.m_batchCount);
+        ASSERT_EQ(1, listener.m_entityIds.size());
+        EXPECT_EQ(AZ::EntityId(2), listener.m_entityIds[0]);
+    }
+
+    TEST_F(TransformBatchNotificationFixture, ChangesWithoutListeners_AreNotQueued)
+    {
+        m_system->QueueTransformChanged(AZ::EntityId(1), AZ::Transform::CreateIdentity());
+
+        TransformBatchListener listener;
+        m_system->FlushTransformChanges();
+        EXPECT_EQ(0, listener.m_batchCount);
+    }
+} // namespace UnitTest
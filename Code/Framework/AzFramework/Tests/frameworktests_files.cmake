@@ -8,6 +8,7 @@
 
 set(FILES
     Main.cpp
+    Spawnable/SpawnableBinaryFormatTests.cpp
     Spawnable/SpawnableEntitiesInterfaceTests.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
     Spawnable/SpawnableScriptMediatorTests.cpp
@@ -25,6 +26,7 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    TransformBatchNotificationTests.cpp
     AssetCatalog.cpp
     AssetRegistry.cpp
     AssetProcessorConnection.cpp
@@ -136,6 +136,12 @@ namespace AzNetworking
         uint32_t m_packetsLost  = 0;
         uint32_t m_packetsAcked = 0;
 
+        //! Number of packets lost since the last acked packet, used to back off the packet timeouts while the connection is congested
+        uint32_t m_consecutivePacketsLost = 0;
+
+        //! Time the encryption handshake took to complete, zero for unencrypted connections
+        AZ::TimeMs m_handshakeTimeMs = AZ::Time::ZeroTimeMs;
+
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
         ConnectionComputeRtt m_connectionRtt;
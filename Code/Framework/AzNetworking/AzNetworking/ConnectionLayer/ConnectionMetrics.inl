@@ -62,11 +62,13 @@ namespace AzNetworking
     inline void ConnectionMetrics::LogPacketLost()
     {
         m_packetsLost++;
+        m_consecutivePacketsLost++;
         m_sendDatarate.LogPacketLost();
     }
 
     inline void ConnectionMetrics::LogPacketAcked()
     {
         m_packetsAcked++;
+        m_consecutivePacketsLost = 0;
     }
 }
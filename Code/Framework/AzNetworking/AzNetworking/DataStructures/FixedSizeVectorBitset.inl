@@ -33,6 +33,38 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (m_count != rhs.m_count)
+        {
+            return false;
+        }
+        const uint32_t fullElementCount = m_count / BitsetType::ElementTypeBits;
+        for (uint32_t i = 0; i < fullElementCount; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        // Bits past the end of a partially used element aren't guaranteed to be cleared, so compare the tail bit by bit
+        for (uint32_t i = fullElementCount * BitsetType::ElementTypeBits; i < m_count; ++i)
+        {
+            if (m_bitset.GetBit(i) != rhs.m_bitset.GetBit(i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
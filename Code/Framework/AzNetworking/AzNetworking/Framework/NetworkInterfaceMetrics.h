@@ -46,5 +46,13 @@ namespace AzNetworking
         uint64_t m_recvBytesUncompressed = 0;
         //! Returns the total number of packets that were discarded due to timeslice budgets.
         uint64_t m_discardedPackets = 0;
+        //! Returns the total number of batched send system calls made on this socket.
+        uint64_t m_sendBatches = 0;
+        //! Returns the total number of packets sent on this socket through batched send system calls.
+        uint64_t m_sendBatchedPackets = 0;
+        //! Returns the total number of batched receive system calls that returned data on this socket.
+        uint64_t m_recvBatches = 0;
+        //! Returns the total number of packets received on this socket through batched receive system calls.
+        uint64_t m_recvBatchedPackets = 0;
     };
 }
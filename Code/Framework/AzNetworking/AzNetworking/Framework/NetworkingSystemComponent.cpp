@@ -205,6 +205,10 @@ namespace AzNetworking
             AZLOG_INFO(" - Total received bytes after compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytes));
             AZLOG_INFO(" - Total received bytes before compression: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBytesUncompressed));
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
+            AZLOG_INFO(" - Total batched send calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBatches));
+            AZLOG_INFO(" - Total packets sent through batched calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_sendBatchedPackets));
+            AZLOG_INFO(" - Total batched receive calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBatches));
+            AZLOG_INFO(" - Total packets received through batched calls: %llu", aznumeric_cast<AZ::u64>(metrics.m_recvBatchedPackets));
         }
     }
 }
@@ -35,8 +35,9 @@ namespace AzNetworking
             return false;
         }
 
+        // Level triggered, like the select implementation, since connections read and send at most one block per event
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        fdEvents.events = EPOLLIN | EPOLLOUT;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -52,18 +53,32 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        if (socketFd >= SocketFd{ 0 })
+        {
+            // Fails harmlessly if the socket was already closed, since closing removes it from the epoll set
+            epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr);
+        }
         ClearSocketHelper(socketFd);
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
+        if (m_socketFds.empty())
+        {
+            // There are no available sockets to process
+            return;
+        }
+
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (error != EINTR)
+            {
+                AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
         }
 
         if (numEpollEvents > 0)
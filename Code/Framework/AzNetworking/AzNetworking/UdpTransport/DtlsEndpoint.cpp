@@ -21,10 +21,13 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(bool, net_DtlsSessionResumption, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables resuming the previous DTLS session when reconnecting to the same address, skipping the full handshake");
     AZ_CVAR(bool, net_UseDtlsCookies, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables DTLS cookie exchange during the connection handshake");
 
     DtlsEndpoint::DtlsEndpoint()
         : m_state(HandshakeState::None)
+        , m_socket(nullptr)
+        , m_handshakeStartTimeMs(AZ::Time::ZeroTimeMs)
         , m_sslSocket(nullptr)
         , m_readBio(nullptr)
         , m_writeBio(nullptr)
@@ -47,6 +50,11 @@ namespace AzNetworking
         {
             // This SSL should be configured to initiate connections
             SSL_set_connect_state(m_sslSocket);
+            if (SSL_SESSION* session = socket.FindSession(address); session != nullptr && net_DtlsSessionResumption)
+            {
+                // Offer the session of the last connection to this address, the server falls back to a full handshake if it can't resume it
+                SSL_set_session(m_sslSocket, session);
+            }
             m_state = HandshakeState::Connecting;
             return PerformHandshakeInternal(outDtlsData);
         }
@@ -90,6 +98,17 @@ namespace AzNetworking
         DtlsEndpoint::HandshakeState prevState = m_state;
         result = PerformHandshakeInternal(outDtlsData);
 
+        if ((result == ConnectResult::Complete) && (prevState != DtlsEndpoint::HandshakeState::Complete))
+        {
+            connection.GetMetrics().m_handshakeTimeMs = AZ::GetElapsedTimeMs() - m_handshakeStartTimeMs;
+            AZLOG(NET_DebugDtls, "dtls handshake took %lld ms (%s)",
+                aznumeric_cast<AZ::s64>(connection.GetMetrics().m_handshakeTimeMs), SSL_session_reused(m_sslSocket) ? "resumed" : "full");
+            if ((prevState == DtlsEndpoint::HandshakeState::Connecting) && (m_socket != nullptr) && net_DtlsSessionResumption)
+            {
+                m_socket->StoreSession(m_address, m_sslSocket);
+            }
+        }
+
         // Pass along any remaining handshake data
         // If we're the connecting endpoint and the handshake is complete, both sides are encrypted and this isn't necessary so skip it
         bool continueHandshake = prevState != DtlsEndpoint::HandshakeState::Connecting || m_state != DtlsEndpoint::HandshakeState::Complete;
@@ -138,6 +157,8 @@ namespace AzNetworking
         }
 #if AZ_TRAIT_USE_OPENSSL
         m_address = address;
+        m_socket = &socket;
+        m_handshakeStartTimeMs = AZ::GetElapsedTimeMs();
         m_sslSocket = SSL_new(socket.m_sslContext);
         m_readBio = BIO_new(BIO_s_mem());
         BIO_set_mem_eof_return(m_readBio, -1);
@@ -10,6 +10,7 @@
 
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Time/ITime.h>
 
 // OpenSSL forward declarations
 typedef struct ssl_st SSL;
@@ -98,6 +99,8 @@ namespace AzNetworking
 
         HandshakeState m_state;
         IpAddress m_address;
+        const DtlsSocket* m_socket;
+        AZ::TimeMs m_handshakeStartTimeMs;
         SSL* m_sslSocket;
         BIO* m_readBio;
         BIO* m_writeBio;
@@ -19,6 +19,7 @@ namespace AzNetworking
 {
     DtlsSocket::~DtlsSocket()
     {
+        ClearSessions();
         FreeSslContext(m_sslContext);
     }
 
@@ -65,6 +66,7 @@ namespace AzNetworking
 
     void DtlsSocket::Close()
     {
+        ClearSessions();
         FreeSslContext(m_sslContext);
         UdpSocket::Close();
     }
@@ -84,9 +86,23 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
-        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         // Write out the packet we were requested to send
         SSL_write(dtlsEndpoint.m_sslSocket, data, size);
+
+        // When sends are being batched, read the encrypted packet straight into the batch instead of copying it there afterwards
+        if (uint8_t* batchedSendBuffer = ReserveBatchedSend(MaxUdpTransmissionUnit))
+        {
+            const int32_t batchedBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, batchedSendBuffer, MaxUdpTransmissionUnit);
+            if (batchedBytesEnc > 0)
+            {
+                m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(batchedBytesEnc - aznumeric_cast<int32_t>(size));
+                m_sentPacketsEncrypted++;
+                CommitBatchedSend(address, aznumeric_cast<uint32_t>(batchedBytesEnc));
+            }
+            return batchedBytesEnc;
+        }
+
+        uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
         const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
 
         // Track encryption metrics
@@ -98,4 +114,39 @@ namespace AzNetworking
         return 0;
 #endif
     }
+
+    void DtlsSocket::StoreSession([[maybe_unused]] const IpAddress& address, [[maybe_unused]] SSL* sslSocket) const
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        SSL_SESSION* session = SSL_get1_session(sslSocket);
+        if (session == nullptr)
+        {
+            return;
+        }
+
+        SSL_SESSION*& storedSession = m_sessions[address];
+        if (storedSession != nullptr)
+        {
+            SSL_SESSION_free(storedSession);
+        }
+        storedSession = session;
+#endif
+    }
+
+    SSL_SESSION* DtlsSocket::FindSession(const IpAddress& address) const
+    {
+        auto iter = m_sessions.find(address);
+        return (iter != m_sessions.end()) ? iter->second : nullptr;
+    }
+
+    void DtlsSocket::ClearSessions()
+    {
+#if AZ_TRAIT_USE_OPENSSL
+        for (auto& session : m_sessions)
+        {
+            SSL_SESSION_free(session.second);
+        }
+#endif
+        m_sessions.clear();
+    }
 }
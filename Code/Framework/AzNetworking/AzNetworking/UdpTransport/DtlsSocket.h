@@ -11,6 +11,9 @@
 #include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/EncryptionCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+typedef struct ssl_session_st SSL_SESSION;
 
 namespace AzNetworking
 {
@@ -59,6 +62,18 @@ namespace AzNetworking
 
         int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
 
+        //! Keeps the session of a completed handshake, so reconnecting to the same address can resume it.
+        //! @param address    the address of the remote endpoint
+        //! @param sslSocket  the ssl socket that completed the handshake
+        void StoreSession(const IpAddress& address, SSL* sslSocket) const;
+
+        //! Returns the session kept for the remote address, or nullptr if there is none.
+        SSL_SESSION* FindSession(const IpAddress& address) const;
+
+        //! Frees all the kept sessions.
+        void ClearSessions();
+
         SSL_CTX* m_sslContext = nullptr;
+        mutable AZStd::unordered_map<IpAddress, SSL_SESSION*> m_sessions;
     };
 }
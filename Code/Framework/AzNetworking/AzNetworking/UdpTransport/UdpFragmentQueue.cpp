@@ -22,7 +22,7 @@ namespace AzNetworking
     {
         m_timeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item)
         {
-            const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFF);
+            const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFFFF);
             AZLOG(NET_FragmentQueue, "Timing out unreliable fragmented packet %u", static_cast<uint32_t>(fragmentSequence));
             m_packetFragments.erase(fragmentSequence);
             return TimeoutResult::Delete;
@@ -83,40 +83,46 @@ namespace AzNetworking
         const uint32_t chunkIndex = packet->GetChunkIndex();
 
         // If this is the first time we've heard about this sequence, resize the vector appropriately
-        const bool isNewPacketFragment = m_packetFragments.find(fragmentSequence) == m_packetFragments.end();
-        PacketFragments& packetFragments = m_packetFragments[fragmentSequence];
+        auto [fragmentsIter, isNewPacketFragment] = m_packetFragments.try_emplace(fragmentSequence);
+        PacketFragments& packetFragments = fragmentsIter->second;
 
         if (isNewPacketFragment)
         {
-            packetFragments.resize(chunkCount);
+            packetFragments.m_chunks.resize(chunkCount);
+            if (!isReliable)
+            {
+                // A single timeout per fragmented packet, rather than one per received chunk
+                m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
+            }
         }
 
-        if ((chunkCount != packetFragments.size()) || (chunkIndex >= chunkCount))
+        if ((chunkCount != packetFragments.m_chunks.size()) || (chunkIndex >= chunkCount))
         {
             // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
-            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
+            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.m_chunks.size()));
             return PacketDispatchResult::Failure;
         }
 
-        packetFragments[chunkIndex] = AZStd::move(packet);
-
-        uint32_t totalPacketSize = 0;
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        AZStd::unique_ptr<CorePackets::FragmentedPacket>& chunk = packetFragments.m_chunks[chunkIndex];
+        if (chunk == nullptr)
         {
-            if (packetFragments[index] == nullptr)
-            {
-                if (!isReliable)
-                {
-                    m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
-                }
-
-                // We haven't received all chunks required to complete this packet yet
-                return PacketDispatchResult::Success;
-            }
+            ++packetFragments.m_receivedChunkCount;
+        }
+        else
+        {
+            packetFragments.m_totalPacketSize -= static_cast<uint32_t>(chunk->GetChunkBuffer().GetSize());
+        }
+        packetFragments.m_totalPacketSize += static_cast<uint32_t>(packet->GetChunkBuffer().GetSize());
+        chunk = AZStd::move(packet);
 
-            totalPacketSize += static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
+        if (packetFragments.m_receivedChunkCount < chunkCount)
+        {
+            // We haven't received all chunks required to complete this packet yet
+            return PacketDispatchResult::Success;
         }
 
+        const uint32_t totalPacketSize = packetFragments.m_totalPacketSize;
+
         // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
         m_deliveredFragments.SetBit(static_cast<uint32_t>(sequenceDelta), true);
 
@@ -129,15 +135,15 @@ namespace AzNetworking
         }
 
         uint8_t* bufferPointer = buffer.GetBuffer();
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        for (const AZStd::unique_ptr<CorePackets::FragmentedPacket>& packetChunk : packetFragments.m_chunks)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
-            memcpy(bufferPointer, packetFragments[index]->GetChunkBuffer().GetBuffer(), chunkSize);
+            const uint32_t chunkSize = static_cast<uint32_t>(packetChunk->GetChunkBuffer().GetSize());
+            memcpy(bufferPointer, packetChunk->GetChunkBuffer().GetBuffer(), chunkSize);
             bufferPointer += chunkSize;
         }
 
         // We can erase all the chunks now, packet is completed
-        m_packetFragments.erase(fragmentSequence);
+        m_packetFragments.erase(fragmentsIter);
 
         NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
         {
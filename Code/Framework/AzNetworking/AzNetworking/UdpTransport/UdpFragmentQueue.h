@@ -53,7 +53,13 @@ namespace AzNetworking
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
-        using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
+        //! The chunks received so far for a fragmented packet, along with running totals so completion is checked without a scan
+        struct PacketFragments
+        {
+            AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>> m_chunks;
+            uint32_t m_receivedChunkCount = 0;
+            uint32_t m_totalPacketSize = 0;
+        };
         AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
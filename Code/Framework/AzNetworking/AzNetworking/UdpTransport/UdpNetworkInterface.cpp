@@ -35,6 +35,7 @@ namespace AzNetworking
     AZ_CVAR(AZ::TimeMs, net_UdpDefaultTimeoutMs, AZ::TimeMs{ 10 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Time in milliseconds before we timeout an idle Udp connection");
     AZ_CVAR(AZ::TimeMs, net_MinPacketTimeoutMs, AZ::TimeMs{ 200 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum time to wait before timing out an unacked packet");
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
+    AZ_CVAR(uint32_t, net_MaxPacketTimeoutBackoff, 4, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of times the packet timeout doubles while consecutive packets are lost, 0 disables the backoff");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
@@ -188,6 +189,9 @@ namespace AzNetworking
             return;
         }
 
+        // Gather everything sent while processing this update so it can be flushed in as few system calls as possible
+        m_socket->BeginSendBatch();
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -346,6 +350,8 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->EndSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -354,6 +360,10 @@ namespace AzNetworking
         GetMetrics().m_recvTimeMs += receiveTimeMs;
         GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
         GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
+        GetMetrics().m_sendBatches = m_socket->GetSendBatches();
+        GetMetrics().m_sendBatchedPackets = m_socket->GetSendBatchedPackets();
+        GetMetrics().m_recvBatches = m_socket->GetRecvBatches();
+        GetMetrics().m_recvBatchedPackets = m_socket->GetRecvBatchedPackets();
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -436,7 +446,10 @@ namespace AzNetworking
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
         const AZ::TimeMs expectedTimeoutMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(avgRtt * 1000.0f * net_RttFudgeScalar));
-        const AZ::TimeMs packetTimeoutMs = AZStd::max<AZ::TimeMs>(expectedTimeoutMs, net_MinPacketTimeoutMs); // Consider packets lost after twice the current connection Rtt
+        AZ::TimeMs packetTimeoutMs = AZStd::max<AZ::TimeMs>(expectedTimeoutMs, net_MinPacketTimeoutMs); // Consider packets lost after twice the current connection Rtt
+        // Double the timeout for each consecutive loss, so a congested connection doesn't get flooded with reliable resends
+        const uint32_t backoff = AZStd::min<uint32_t>(metrics.m_consecutivePacketsLost, net_MaxPacketTimeoutBackoff);
+        packetTimeoutMs = aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(packetTimeoutMs) << backoff);
         AZLOG(NET_Debug, "Registering packetId %u with timeout %u", aznumeric_cast<uint32_t>(packetId), aznumeric_cast<uint32_t>(packetTimeoutMs));
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
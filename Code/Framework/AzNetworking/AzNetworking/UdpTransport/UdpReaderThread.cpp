@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -108,8 +109,11 @@ namespace AzNetworking
                 back.m_entries.emplace_back(SocketEntry{ socket, ReceivedPackets() });
             }
             m_pendingAdds.clear();
-            AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
-            AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), [](auto& socketEntry) { return socketEntry.m_socket == nullptr; });
+            // Erase the entries of unregistered sockets, remove_if alone leaves copies of the remaining entries at the end, which
+            // makes the reader thread read the same socket into more than one entry and drop the packets read into the copies
+            const auto isUnregistered = [](const SocketEntry& socketEntry) { return socketEntry.m_socket == nullptr; };
+            front.m_entries.erase(AZStd::remove_if(front.m_entries.begin(), front.m_entries.end(), isUnregistered), front.m_entries.end());
+            back.m_entries.erase(AZStd::remove_if(back.m_entries.begin(), back.m_entries.end(), isUnregistered), back.m_entries.end());
             m_backIndex = 1 - m_backIndex;
             m_readerBuffers[m_backIndex].m_receiveBuffer.Resize(0);
         }
@@ -176,7 +180,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +188,46 @@ namespace AzNetworking
                     break;
                 }
 
+                if (receivedPackets.full())
+                {
+                    break;
+                }
+
+                // Hand out one MTU sized slot per datagram, bounded by the space left in both the receive buffer and the packet list
+                const uint32_t bufferSlots = static_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t packetSlots = static_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(AZStd::min(bufferSlots, packetSlots), UdpSocket::MaxBatchedPacketCount);
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                AZStd::array<UdpSocket::ReceiveBatchEntry, UdpSocket::MaxBatchedPacketCount> entries;
+                for (uint32_t i = 0; i < batchSize; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    entries[i].m_buffer = dstData + i * MaxUdpTransmissionUnit;
+                    entries[i].m_bufferSize = MaxUdpTransmissionUnit;
                 }
-                else
+
+                const int32_t receivedCount = socket->ReceiveBatch(entries.data(), batchSize);
+
+                // Compact the received datagrams so the buffer stays tightly packed
+                uint32_t receivedBytes = 0;
+                for (int32_t i = 0; i < receivedCount; ++i)
+                {
+                    const UdpSocket::ReceiveBatchEntry& entry = entries[i];
+                    uint8_t* packetData = dstData + receivedBytes;
+                    if (packetData != entry.m_buffer)
+                    {
+                        memmove(packetData, entry.m_buffer, entry.m_receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(entry.m_address, packetData, entry.m_receivedBytes));
+                    receivedBytes += entry.m_receivedBytes;
+                }
+                receiveBuffer.Resize(bufferHead + receivedBytes);
+
+                if (receivedCount < aznumeric_cast<int32_t>(batchSize))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
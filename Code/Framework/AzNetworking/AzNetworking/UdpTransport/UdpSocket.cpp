@@ -23,6 +23,7 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchedIo, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets will gather sends and receives into batched system calls on platforms that support it");
 
     UdpSocket::~UdpSocket()
     {
@@ -96,6 +97,9 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        m_sendBatch.clear();
+        m_sendBatchBufferSize = 0;
+        m_sendBatchDepth = 0;
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -224,9 +228,203 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(ReceiveBatchEntry* outEntries, uint32_t entryCount) const
+    {
+        AZ_Assert(outEntries != nullptr, "NULL entry pointer passed to receive");
+
+        if (!IsOpen() || (entryCount == 0))
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchedIo)
+        {
+            entryCount = AZStd::min(entryCount, MaxBatchedPacketCount);
+
+            AZStd::array<mmsghdr, MaxBatchedPacketCount> messages;
+            AZStd::array<iovec, MaxBatchedPacketCount> buffers;
+            AZStd::array<sockaddr_in, MaxBatchedPacketCount> fromAddresses;
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                AZ_Assert(outEntries[i].m_buffer != nullptr && outEntries[i].m_bufferSize > 0, "Invalid buffer passed to receive");
+                buffers[i].iov_base = outEntries[i].m_buffer;
+                buffers[i].iov_len = outEntries[i].m_bufferSize;
+                memset(&messages[i], 0, sizeof(mmsghdr));
+                messages[i].msg_hdr.msg_name = &fromAddresses[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t receivedCount = static_cast<int32_t>(recvmmsg(static_cast<int32_t>(m_socketFd), messages.data(), entryCount, 0, nullptr));
+            if (receivedCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+
+                if (ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    return 0;
+                }
+
+                bool ignoreForciblyClosedError = false;
+                if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+                {
+                    return ignoreForciblyClosedError ? 0 : SocketOpResultError;
+                }
+
+                AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                return 0;
+            }
+
+            // Drop empty datagrams so callers only see valid payloads, matching the behaviour of Receive
+            int32_t packetCount = 0;
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                const int32_t receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+                if (receivedBytes <= 0)
+                {
+                    continue;
+                }
+
+                ReceiveBatchEntry& entry = outEntries[packetCount++];
+                if (entry.m_buffer != buffers[i].iov_base)
+                {
+                    memmove(entry.m_buffer, buffers[i].iov_base, receivedBytes);
+                }
+                entry.m_address = IpAddress(ByteOrder::Network, fromAddresses[i].sin_addr.s_addr, fromAddresses[i].sin_port);
+                entry.m_receivedBytes = receivedBytes;
+                m_recvBytes += receivedBytes;
+            }
+
+            if (receivedCount > 0)
+            {
+                m_recvBatches++;
+            }
+            m_recvPackets += packetCount;
+            m_recvBatchedPackets += packetCount;
+            return packetCount;
+        }
+#endif
+
+        int32_t packetCount = 0;
+        while (aznumeric_cast<uint32_t>(packetCount) < entryCount)
+        {
+            ReceiveBatchEntry& entry = outEntries[packetCount];
+            const int32_t receivedBytes = Receive(entry.m_address, entry.m_buffer, entry.m_bufferSize);
+            if (receivedBytes < 0)
+            {
+                return (packetCount > 0) ? packetCount : receivedBytes;
+            }
+            else if (receivedBytes == 0)
+            {
+                break;
+            }
+            entry.m_receivedBytes = receivedBytes;
+            ++packetCount;
+        }
+        return packetCount;
+    }
+
+    void UdpSocket::BeginSendBatch() const
+    {
+        if (IsBatchedIoEnabled())
+        {
+            ++m_sendBatchDepth;
+        }
+    }
+
+    void UdpSocket::EndSendBatch() const
+    {
+        if (m_sendBatchDepth == 0)
+        {
+            return;
+        }
+
+        if (--m_sendBatchDepth == 0)
+        {
+            FlushSendBatch();
+        }
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        if (m_sendBatch.empty())
+        {
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        AZStd::array<mmsghdr, MaxBatchedPacketCount> messages;
+        AZStd::array<iovec, MaxBatchedPacketCount> buffers;
+        AZStd::array<sockaddr_in, MaxBatchedPacketCount> destAddresses;
+        const uint32_t messageCount = aznumeric_cast<uint32_t>(m_sendBatch.size());
+        for (uint32_t i = 0; i < messageCount; ++i)
+        {
+            const BatchedSend& batchedSend = m_sendBatch[i];
+            memset(&destAddresses[i], 0, sizeof(sockaddr_in));
+            destAddresses[i].sin_family = AF_INET;
+            destAddresses[i].sin_addr.s_addr = batchedSend.m_address.GetAddress(ByteOrder::Network);
+            destAddresses[i].sin_port = batchedSend.m_address.GetPort(ByteOrder::Network);
+            buffers[i].iov_base = m_sendBatchBuffer.data() + batchedSend.m_offset;
+            buffers[i].iov_len = batchedSend.m_size;
+            memset(&messages[i], 0, sizeof(mmsghdr));
+            messages[i].msg_hdr.msg_name = &destAddresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        uint32_t sentCount = 0;
+        while (sentCount < messageCount)
+        {
+            const int32_t result = static_cast<int32_t>(sendmmsg(static_cast<int32_t>(m_socketFd), messages.data() + sentCount, messageCount - sentCount, 0));
+            if (result > 0)
+            {
+                m_sendBatches++;
+                m_sendBatchedPackets += result;
+                sentCount += result;
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages, the remainder of the batch is dropped as a normal send would be
+            {
+                break;
+            }
+
+            // Skip the datagram that failed and carry on with the rest of the batch
+            AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            ++sentCount;
+        }
+#endif
+
+        m_sendBatch.clear();
+        m_sendBatchBufferSize = 0;
+    }
+
+    bool UdpSocket::IsBatchedIoEnabled()
+    {
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        return net_UdpBatchedIo;
+#else
+        return false;
+#endif
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+        if (uint8_t* batchedData = ReserveBatchedSend(size))
+        {
+            memcpy(batchedData, data, size);
+            CommitBatchedSend(address, size);
+            return static_cast<int32_t>(size);
+        }
+
+        // Anything that can't be gathered has to go out after whatever was queued ahead of it
+        FlushSendBatch();
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -235,6 +433,27 @@ namespace AzNetworking
         return static_cast<int32_t>(sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr)));
     }
 
+    uint8_t* UdpSocket::ReserveBatchedSend(uint32_t maxSize) const
+    {
+        if (m_sendBatchDepth == 0 || maxSize > MaxUdpTransmissionUnit)
+        {
+            return nullptr;
+        }
+
+        if (m_sendBatch.full() || (m_sendBatchBufferSize + maxSize > m_sendBatchBuffer.size()))
+        {
+            FlushSendBatch();
+        }
+        return m_sendBatchBuffer.data() + m_sendBatchBufferSize;
+    }
+
+    void UdpSocket::CommitBatchedSend(const IpAddress& address, uint32_t size) const
+    {
+        AZ_Assert(m_sendBatchBufferSize + size <= m_sendBatchBuffer.size(), "Batched send is larger than the space reserved for it");
+        m_sendBatch.push_back(BatchedSend{ address, m_sendBatchBufferSize, size });
+        m_sendBatchBufferSize += size;
+    }
+
 #ifdef ENABLE_LATENCY_DEBUG
     int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
     {
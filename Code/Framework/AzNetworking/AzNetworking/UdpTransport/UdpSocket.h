@@ -13,6 +13,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
 #ifndef _RELEASE
@@ -42,6 +43,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams gathered into a single batched send or receive system call.
+        static constexpr uint32_t MaxBatchedPacketCount = 64;
+
+        //! A single datagram slot used by ReceiveBatch.
+        struct ReceiveBatchEntry
+        {
+            IpAddress m_address;               //< On success, the address of the endpoint that sent the data
+            uint8_t*  m_buffer = nullptr;      //< Address to write the received data to
+            uint32_t  m_bufferSize = 0;        //< Maximum size the output buffer supports for receiving
+            int32_t   m_receivedBytes = 0;     //< On success, the number of bytes received into m_buffer
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +106,28 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to entryCount payloads from the UDP socket.
+        //! Uses a single system call where the platform supports it, otherwise falls back to repeated calls to Receive.
+        //! @param outEntries the datagram slots to receive into, filled in order
+        //! @param entryCount the number of slots provided in outEntries
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(ReceiveBatchEntry* outEntries, uint32_t entryCount) const;
+
+        //! Starts gathering sends into a batch rather than issuing one system call per payload.
+        //! Calls may be nested, the batch is flushed once the outermost EndSendBatch is called.
+        //! Has no effect if batched IO is disabled or not supported on this platform.
+        void BeginSendBatch() const;
+
+        //! Ends a send batch started with BeginSendBatch, flushing any gathered payloads to the socket.
+        void EndSendBatch() const;
+
+        //! Writes any payloads gathered by the current send batch to the socket.
+        void FlushSendBatch() const;
+
+        //! Returns true if batched sends and receives are supported and enabled.
+        //! @return boolean true if batched sends and receives are supported and enabled
+        static bool IsBatchedIoEnabled();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -121,6 +156,22 @@ namespace AzNetworking
         //! @return the total number of bytes received on this socket
         uint32_t GetRecvBytes() const;
 
+        //! Returns the total number of batched send system calls made on this socket.
+        //! @return the total number of batched send system calls made on this socket
+        uint32_t GetSendBatches() const;
+
+        //! Returns the total number of packets sent on this socket through batched send system calls.
+        //! @return the total number of packets sent on this socket through batched send system calls
+        uint32_t GetSendBatchedPackets() const;
+
+        //! Returns the total number of batched receive system calls that returned data on this socket.
+        //! @return the total number of batched receive system calls that returned data on this socket
+        uint32_t GetRecvBatches() const;
+
+        //! Returns the total number of packets received on this socket through batched receive system calls.
+        //! @return the total number of packets received on this socket through batched receive system calls
+        uint32_t GetRecvBatchedPackets() const;
+
     protected:
 
         mutable uint32_t m_sentPacketsEncrypted = 0;
@@ -128,6 +179,16 @@ namespace AzNetworking
 
         virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
+        //! Reserves space at the end of the open send batch so a payload can be written to it in place, without a copy.
+        //! @param maxSize the maximum size of the payload that will be written
+        //! @return pointer to write the payload to, nullptr if there is no open send batch or the payload can't be batched
+        uint8_t* ReserveBatchedSend(uint32_t maxSize) const;
+
+        //! Adds the payload written to the space returned by ReserveBatchedSend to the send batch.
+        //! @param address the address to send the payload to
+        //! @param size    the size of the payload that was written
+        void CommitBatchedSend(const IpAddress& address, uint32_t size) const;
+
     private:
 
         SocketFd m_socketFd = InvalidSocketFd;
@@ -135,6 +196,23 @@ namespace AzNetworking
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
+        mutable uint32_t m_sendBatches = 0;
+        mutable uint32_t m_sendBatchedPackets = 0;
+        mutable uint32_t m_recvBatches = 0;
+        mutable uint32_t m_recvBatchedPackets = 0;
+
+        struct BatchedSend
+        {
+            IpAddress m_address;
+            uint32_t  m_offset = 0;
+            uint32_t  m_size = 0;
+        };
+
+        // Payloads gathered between BeginSendBatch and EndSendBatch, stored after any encryption has been applied
+        mutable uint32_t m_sendBatchDepth = 0;
+        mutable AZStd::fixed_vector<BatchedSend, MaxBatchedPacketCount> m_sendBatch;
+        mutable AZStd::array<uint8_t, MaxBatchedPacketCount * MaxUdpTransmissionUnit> m_sendBatchBuffer;
+        mutable uint32_t m_sendBatchBufferSize = 0;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
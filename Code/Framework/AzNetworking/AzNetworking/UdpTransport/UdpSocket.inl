@@ -49,4 +49,24 @@ namespace AzNetworking
     {
         return m_recvBytes;
     }
+
+    inline uint32_t UdpSocket::GetSendBatches() const
+    {
+        return m_sendBatches;
+    }
+
+    inline uint32_t UdpSocket::GetSendBatchedPackets() const
+    {
+        return m_sendBatchedPackets;
+    }
+
+    inline uint32_t UdpSocket::GetRecvBatches() const
+    {
+        return m_recvBatches;
+    }
+
+    inline uint32_t UdpSocket::GetRecvBatchedPackets() const
+    {
+        return m_recvBatchedPackets;
+    }
 }
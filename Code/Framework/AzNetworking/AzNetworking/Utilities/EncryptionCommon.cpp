@@ -518,6 +518,14 @@ namespace AzNetworking
         // Validate the clients certificate only on handshake
         SSL_CTX_set_verify(context, SSL_VERIFY_PEER | SSL_VERIFY_CLIENT_ONCE, ValidateCertificateCallback);
 
+        // Required for resuming sessions when peers are verified, sessions are only resumed between contexts of the same trust zone
+        const AZ::u8 sessionIdContext[] = { 'A', 'z', 'N', 'e', 't', static_cast<AZ::u8>(trustZone) };
+        if (SSL_CTX_set_session_id_context(context, sessionIdContext, sizeof(sessionIdContext)) != OpenSslResultSuccess)
+        {
+            AZLOG_ERROR("Failed to set the session id context");
+            return nullptr;
+        }
+
         // Only support a single cipher suite in OpenSSL that supports:
         //
         //  ECDHE       Primary key exchange using ephemeral elliptic curve diffie-hellman.
@@ -11,4 +11,32 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.Resize(11);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.Resize(11);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(9, true);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.SetBit(9, true);
+        EXPECT_TRUE(lhs == rhs);
+    }
+
+    TEST(FixedSizeVectorBitset, TestEqualityIgnoresBitsPastSize)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        lhs.Resize(20);
+        lhs.SetBit(7, true);
+        lhs.SetBit(12, true);
+        lhs.Resize(6);
+        rhs.Resize(6);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -320,4 +321,67 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, BatchedSendReceive)
+    {
+        constexpr uint32_t NumTestPackets = UdpSocket::MaxBatchedPacketCount + 8;
+        constexpr uint16_t ReceivePort = 12346;
+
+        UdpSocket sendSocket;
+        UdpSocket recvSocket;
+        EXPECT_TRUE(sendSocket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(recvSocket.Open(ReceivePort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        const IpAddress recvAddress(127, 0, 0, 1, ReceivePort);
+
+        // Overflow the batch once to make sure a full batch is flushed and gathering continues
+        sendSocket.BeginSendBatch();
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            const uint32_t payload = i;
+            EXPECT_EQ(sendSocket.Send(recvAddress, reinterpret_cast<const uint8_t*>(&payload), sizeof(payload), false, dtlsEndpoint, connectionQuality), aznumeric_cast<int32_t>(sizeof(payload)));
+        }
+        sendSocket.EndSendBatch();
+        EXPECT_EQ(sendSocket.GetSentPackets(), NumTestPackets);
+
+        AZStd::array<AZStd::array<uint8_t, MaxUdpTransmissionUnit>, UdpSocket::MaxBatchedPacketCount> buffers;
+        AZStd::array<UdpSocket::ReceiveBatchEntry, UdpSocket::MaxBatchedPacketCount> entries;
+        for (uint32_t i = 0; i < UdpSocket::MaxBatchedPacketCount; ++i)
+        {
+            entries[i].m_buffer = buffers[i].data();
+            entries[i].m_bufferSize = MaxUdpTransmissionUnit;
+        }
+
+        uint32_t receivedPackets = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while ((receivedPackets < NumTestPackets) && (AZ::GetElapsedTimeMs() - startTimeMs < AZ::TimeMs{ 1000 }))
+        {
+            const int32_t receivedCount = recvSocket.ReceiveBatch(entries.data(), UdpSocket::MaxBatchedPacketCount);
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                uint32_t payload = 0;
+                EXPECT_EQ(entries[i].m_receivedBytes, aznumeric_cast<int32_t>(sizeof(payload)));
+                memcpy(&payload, entries[i].m_buffer, sizeof(payload));
+                EXPECT_EQ(payload, receivedPackets);
+                ++receivedPackets;
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(receivedPackets, NumTestPackets);
+        EXPECT_EQ(recvSocket.GetRecvPackets(), NumTestPackets);
+
+        if (UdpSocket::IsBatchedIoEnabled())
+        {
+            EXPECT_EQ(sendSocket.GetSendBatchedPackets(), NumTestPackets);
+            EXPECT_GE(sendSocket.GetSendBatches(), 2u);
+            EXPECT_EQ(recvSocket.GetRecvBatchedPackets(), NumTestPackets);
+        }
+        else
+        {
+            EXPECT_EQ(sendSocket.GetSendBatches(), 0u);
+            EXPECT_EQ(recvSocket.GetRecvBatches(), 0u);
+        }
+    }
 }
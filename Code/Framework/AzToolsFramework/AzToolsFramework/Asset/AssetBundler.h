@@ -59,6 +59,9 @@ namespace AzToolsFramework
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
         AZStd::string m_comment;
+        // optional text file listing product paths one per line, in the order they are first loaded at runtime.
+        // the listed products are written first in the bundles, in that order, so loads read the bundles sequentially.
+        AZStd::string m_loadOrderFilePath;
     };
 
    /*
@@ -13,7 +13,11 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -57,6 +61,59 @@ namespace AzToolsFramework
         return true;
     }
 
+    //! Orders the files by the position of their first access in the load order file.
+    //! Files that aren't in the load order file go after the listed ones, keeping their order from the asset list,
+    //! which already groups each seed with its dependencies.
+    bool ApplyLoadOrder(const AZStd::string& loadOrderFilePath, AZStd::vector<AssetFileInfo>& fileInfoList)
+    {
+        auto loadOrderOutcome = AZ::Utils::ReadFile(loadOrderFilePath);
+        if (!loadOrderOutcome.IsSuccess())
+        {
+            AZ_Error(logWindowName, false, "Unable to read load order file (%s): %s\n", loadOrderFilePath.c_str(), loadOrderOutcome.GetError().c_str());
+            return false;
+        }
+
+        AZStd::unordered_map<AZStd::string, size_t> loadOrder;
+        AZ::StringFunc::TokenizeVisitor(loadOrderOutcome.GetValue(), [&loadOrder](AZStd::string_view line)
+            {
+                AZStd::string productPath{ AZ::StringFunc::StripEnds(line, " \t") };
+                if (!productPath.empty())
+                {
+                    AZStd::replace(productPath.begin(), productPath.end(), AZ_WRONG_DATABASE_SEPARATOR, AZ_CORRECT_DATABASE_SEPARATOR);
+                    AZStd::to_lower(productPath.begin(), productPath.end());
+                    // only the first access of a file decides its position
+                    loadOrder.emplace(AZStd::move(productPath), loadOrder.size());
+                }
+            }, "\r\n");
+
+        auto GetLoadIndex = [&loadOrder](const AssetFileInfo& assetFileInfo)
+        {
+            AZStd::string productPath = assetFileInfo.m_assetRelativePath;
+            AZStd::to_lower(productPath.begin(), productPath.end());
+            auto loadOrderIt = loadOrder.find(productPath);
+            return loadOrderIt != loadOrder.end() ? loadOrderIt->second : AZStd::numeric_limits<size_t>::max();
+        };
+
+        AZStd::vector<AZStd::pair<size_t, AssetFileInfo>> indexedFileInfoList;
+        indexedFileInfoList.reserve(fileInfoList.size());
+        for (AssetFileInfo& assetFileInfo : fileInfoList)
+        {
+            size_t loadIndex = GetLoadIndex(assetFileInfo);
+            indexedFileInfoList.emplace_back(loadIndex, AZStd::move(assetFileInfo));
+        }
+        AZStd::stable_sort(indexedFileInfoList.begin(), indexedFileInfoList.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        for (size_t index = 0; index < fileInfoList.size(); ++index)
+        {
+            fileInfoList[index] = AZStd::move(indexedFileInfoList[index].second);
+        }
+        return true;
+    }
+
     //! This helper class can be used to create a temp folder from a filename.
     //! It strips the extension and than adds _temp token to the name and tries to create that directory on disk.
     struct TemporaryDir
@@ -292,7 +349,20 @@ namespace AzToolsFramework
             }
         }
 
-        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        const AZStd::vector<AssetFileInfo>* fileInfoList = &assetFileInfoList.m_fileInfoList;
+        AZStd::vector<AssetFileInfo> orderedFileInfoList;
+        if (!assetBundleSettings.m_loadOrderFilePath.empty())
+        {
+            orderedFileInfoList = assetFileInfoList.m_fileInfoList;
+            AZ::IO::Path loadOrderFilePath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / assetBundleSettings.m_loadOrderFilePath;
+            if (!ApplyLoadOrder(loadOrderFilePath.Native(), orderedFileInfoList))
+            {
+                return false;
+            }
+            fileInfoList = &orderedFileInfoList;
+        }
+
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : *fileInfoList)
         {
             AZ::u64 fileSize = 0;
             AZStd::string fullAssetFilePath;
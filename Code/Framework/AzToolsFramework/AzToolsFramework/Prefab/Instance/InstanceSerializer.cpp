@@ -201,18 +201,18 @@ namespace AzToolsFramework
             }
             else
             {
-                PrefabDom jsonPatch;
-                AZ::JsonSerialization::CreatePatch(
-                    jsonPatch, jsonPatch.GetAllocator(), cachedInstanceDom->get(), inputValue, AZ::JsonMergeApproach::JsonPatch);
+                // Only the entities and nested instances whose part of the DOM changed since the last load are loaded again.
+                PrefabDomUtils::PatchesMetadata patchesMetadata =
+                    PrefabDomUtils::IdentifyModifiedInstanceMembers(cachedInstanceDom->get(), inputValue);
 
-                if (jsonPatch.IsArray() && jsonPatch.GetArray().Empty())
+                if (patchesMetadata.IsEmpty())
                 {
                     JSR::ResultCode skippedResult(JSR::Tasks::CreatePatch, JSR::Outcomes::Skipped);
                     result.Combine(skippedResult);
                 }
                 else
                 {
-                    Reload(inputValue, context, instance, AZStd::move(jsonPatch), result);
+                    Reload(inputValue, context, instance, patchesMetadata, result);
                 }
             }
 
@@ -293,11 +293,9 @@ namespace AzToolsFramework
             const rapidjson::Value& inputValue,
             AZ::JsonDeserializerContext& context,
             Instance* instance,
-            PrefabDom patches,
+            const PrefabDomUtils::PatchesMetadata& patchesMetadata,
             AZ::JsonSerializationResult::ResultCode& result)
         {
-            PrefabDomUtils::PatchesMetadata patchesMetadata = PrefabDomUtils::IdentifyModifiedInstanceMembers(patches);
-
             if (patchesMetadata.m_clearAndLoadAllInstances)
             {
                 ClearAndLoadInstances(inputValue, context, instance, result);
@@ -17,6 +17,11 @@ namespace AzToolsFramework
     {
         class Instance;
 
+        namespace PrefabDomUtils
+        {
+            struct PatchesMetadata;
+        }
+
         class JsonInstanceSerializer
             : public AZ::BaseJsonSerializer
         {
@@ -33,17 +38,17 @@ namespace AzToolsFramework
 
         private:
 
-            //! Identifies the entities to reload from the patches provided and reloads them from the Dom provided.
+            //! Reloads the instance members identified in the patches metadata from the Dom provided.
             //! @param inputValue The Dom that contains the instance information.
             //! @param context The context that could contain additional metadata needed for the deserialization.
             //! @instance The instance in which the entities need to be reloaded.
-            //! @patches The patches to use to identify entities that need reloading.
+            //! @patchesMetadata The metadata identifying the entities and nested instances that need reloading.
             //! @result The result code that could be modified during the process of reloading.
             void Reload(
                 const rapidjson::Value& inputValue,
                 AZ::JsonDeserializerContext& context,
                 Instance* instance,
-                PrefabDom patches,
+                const PrefabDomUtils::PatchesMetadata& patchesMetadata,
                 AZ::JsonSerializationResult::ResultCode& result);
 
             //! Clears all the entities in the instance and loads them from scratch using the DOM provided.
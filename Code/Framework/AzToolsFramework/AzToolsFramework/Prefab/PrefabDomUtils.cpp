@@ -246,6 +246,70 @@ namespace AzToolsFramework
                         }
                     }
                 }
+
+                //! Compares the members of an object in the cached instance DOM with the same object in the updated instance DOM.
+                //! The members are looked up by name through a map, as searching the members of a rapidjson object is linear and
+                //! instances can hold tens of thousands of entities.
+                //! @param cachedMembers The object in the cached instance DOM, or null if the DOM didn't have it.
+                //! @param members The object in the updated instance DOM, or null if the DOM doesn't have it.
+                //! @param membersToAdd The set to add the names of members that are only in the updated object to.
+                //! @param membersToReload The set to add the names of members that differ between the objects to.
+                //! @param membersToRemove The set to add the names of members that are only in the cached object to.
+                //! @return False if one of the values isn't an object, in which case all members need to be loaded again.
+                static bool IdentifyModifiedMembers(
+                    const PrefabDomValue* cachedMembers,
+                    const PrefabDomValue* members,
+                    AZStd::unordered_set<AZStd::string>& membersToAdd,
+                    AZStd::unordered_set<AZStd::string>& membersToReload,
+                    AZStd::unordered_set<AZStd::string>& membersToRemove)
+                {
+                    if (cachedMembers == nullptr && members == nullptr)
+                    {
+                        return true;
+                    }
+                    if (cachedMembers == nullptr || members == nullptr || !cachedMembers->IsObject() || !members->IsObject())
+                    {
+                        return false;
+                    }
+
+                    AZStd::unordered_map<AZStd::string_view, const PrefabDomValue*> cachedMembersByName;
+                    cachedMembersByName.reserve(cachedMembers->MemberCount());
+                    for (const auto& cachedMember : cachedMembers->GetObject())
+                    {
+                        cachedMembersByName.emplace(
+                            AZStd::string_view(cachedMember.name.GetString(), cachedMember.name.GetStringLength()), &cachedMember.value);
+                    }
+
+                    for (const auto& member : members->GetObject())
+                    {
+                        AZStd::string_view memberName(member.name.GetString(), member.name.GetStringLength());
+                        auto cachedMember = cachedMembersByName.find(memberName);
+                        if (cachedMember == cachedMembersByName.end())
+                        {
+                            membersToAdd.emplace(memberName);
+                        }
+                        else
+                        {
+                            if (*cachedMember->second != member.value)
+                            {
+                                membersToReload.emplace(memberName);
+                            }
+                            cachedMembersByName.erase(cachedMember);
+                        }
+                    }
+
+                    for (const auto& [cachedMemberName, cachedMember] : cachedMembersByName)
+                    {
+                        membersToRemove.emplace(cachedMemberName);
+                    }
+                    return true;
+                }
+
+                static const PrefabDomValue* FindMemberValue(const PrefabDomValue& instanceDom, const char* memberName)
+                {
+                    PrefabDomValue::ConstMemberIterator memberIterator = instanceDom.FindMember(memberName);
+                    return memberIterator != instanceDom.MemberEnd() ? &memberIterator->value : nullptr;
+                }
             }
 
             PrefabDomValueReference FindPrefabDomValue(PrefabDomValue& parentValue, const char* valueName)
@@ -525,6 +589,45 @@ namespace AzToolsFramework
                 return AZStd::move(patchesMetadata);
             }
 
+            PatchesMetadata IdentifyModifiedInstanceMembers(const PrefabDomValue& cachedInstanceDom, const PrefabDomValue& instanceDom)
+            {
+                PrefabDomUtils::PatchesMetadata patchesMetadata;
+
+                // Added entities are loaded the same way as modified ones.
+                patchesMetadata.m_clearAndLoadAllEntities = !Internal::IdentifyModifiedMembers(
+                    Internal::FindMemberValue(cachedInstanceDom, EntitiesName),
+                    Internal::FindMemberValue(instanceDom, EntitiesName),
+                    patchesMetadata.m_entitiesToReload,
+                    patchesMetadata.m_entitiesToReload,
+                    patchesMetadata.m_entitiesToRemove);
+                if (patchesMetadata.m_clearAndLoadAllEntities)
+                {
+                    patchesMetadata.m_entitiesToReload.clear();
+                    patchesMetadata.m_entitiesToRemove.clear();
+                }
+
+                patchesMetadata.m_clearAndLoadAllInstances = !Internal::IdentifyModifiedMembers(
+                    Internal::FindMemberValue(cachedInstanceDom, InstancesName),
+                    Internal::FindMemberValue(instanceDom, InstancesName),
+                    patchesMetadata.m_instancesToAdd,
+                    patchesMetadata.m_instancesToReload,
+                    patchesMetadata.m_instancesToRemove);
+                if (patchesMetadata.m_clearAndLoadAllInstances)
+                {
+                    patchesMetadata.m_instancesToAdd.clear();
+                    patchesMetadata.m_instancesToReload.clear();
+                    patchesMetadata.m_instancesToRemove.clear();
+                }
+
+                const PrefabDomValue* cachedContainerEntity = Internal::FindMemberValue(cachedInstanceDom, ContainerEntityName);
+                const PrefabDomValue* containerEntity = Internal::FindMemberValue(instanceDom, ContainerEntityName);
+                patchesMetadata.m_shouldReloadContainerEntity = (cachedContainerEntity == nullptr || containerEntity == nullptr)
+                    ? cachedContainerEntity != containerEntity
+                    : *cachedContainerEntity != *containerEntity;
+
+                return patchesMetadata;
+            }
+
             void PrintPrefabDomValue(
                 [[maybe_unused]] const AZStd::string_view printMessage,
                 [[maybe_unused]] const PrefabDomValue& prefabDomValue)
@@ -76,6 +76,14 @@ namespace AzToolsFramework
                 bool m_shouldReloadContainerEntity = false;
                 bool m_clearAndLoadAllEntities = false;
                 bool m_clearAndLoadAllInstances = false;
+
+                //! Returns true if no instance member needs to be loaded again.
+                bool IsEmpty() const
+                {
+                    return m_entitiesToReload.empty() && m_entitiesToRemove.empty() && m_instancesToRemove.empty() &&
+                        m_instancesToAdd.empty() && m_instancesToReload.empty() && !m_shouldReloadContainerEntity &&
+                        !m_clearAndLoadAllEntities && !m_clearAndLoadAllInstances;
+                }
             };
 
             /**
@@ -203,6 +211,14 @@ namespace AzToolsFramework
             //! @return PatchesMetada The metadata object indicating which instance members get modified with the provided patches.
             PatchesMetadata IdentifyModifiedInstanceMembers(const PrefabDom& patches);
 
+            //! Identifies instance members modified by comparing the entities, nested instances and container entity of two instance
+            //! DOMs. This finds the same members as creating a patch between the DOMs and inspecting it, without generating the patch.
+            //! Members that didn't change are only compared, so only the modified subtrees of the instance need to be loaded again.
+            //! @param cachedInstanceDom The instance DOM the instance was last loaded from.
+            //! @param instanceDom The instance DOM the instance is going to be loaded from.
+            //! @return PatchesMetada The metadata object indicating which instance members differ between the DOMs.
+            PatchesMetadata IdentifyModifiedInstanceMembers(const PrefabDomValue& cachedInstanceDom, const PrefabDomValue& instanceDom);
+
             /**
              * Prints the contents of the given prefab DOM value to the debug output console in a readable format.
              * @param printMessage The message that will be printed before printing the PrefabDomValue
@@ -13,6 +13,7 @@
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Utils/Utils.h>
 
 #include <AzFramework/Asset/AssetSystemBus.h>
@@ -70,11 +71,126 @@ namespace AzToolsFramework
 
         TemplateId PrefabLoader::LoadTemplateFromFile(AZ::IO::PathView filePath)
         {
+            PrefetchPrefabFiles(filePath);
+
             AZStd::unordered_set<AZ::IO::Path> progressedFilePathsSet;
             TemplateId newTemplateId = LoadTemplateFromFile(filePath, progressedFilePathsSet);
+
+            // Doms of files that weren't reached, for instance because their parent failed to load, are no longer needed.
+            m_prefetchedPrefabDoms.clear();
             return newTemplateId;
         }
 
+        void PrefabLoader::PrefetchPrefabFiles(AZ::IO::PathView filePath)
+        {
+            struct PrefetchedFile
+            {
+                AZ::IO::Path m_relativePath;
+                AZ::IO::Path m_fullPath;
+                AZStd::optional<PrefabDom> m_dom;
+            };
+
+            if (!IsValidPrefabPath(filePath))
+            {
+                return;
+            }
+
+            AZStd::unordered_set<AZ::IO::Path> visitedFilePaths;
+            AZStd::vector<AZ::IO::Path> currentLevel;
+            currentLevel.emplace_back(filePath);
+            AZStd::vector<PrefetchedFile> files;
+            while (!currentLevel.empty())
+            {
+                // Resolving the paths goes through the asset system buses, so that's done here instead of on the tasks.
+                files.clear();
+                for (const AZ::IO::Path& path : currentLevel)
+                {
+                    AZ::IO::Path relativePath = GenerateRelativePath(path);
+                    if (visitedFilePaths.insert(relativePath).second &&
+                        m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(relativePath) == InvalidTemplateId)
+                    {
+                        files.push_back({ AZStd::move(relativePath), GetFullPath(path), AZStd::nullopt });
+                    }
+                }
+
+                auto readAndParse = [](PrefetchedFile& file)
+                {
+                    auto readResult = AZ::Utils::ReadFile(file.m_fullPath.Native(), AZStd::numeric_limits<size_t>::max());
+                    if (readResult.IsSuccess())
+                    {
+                        AZ::Outcome<PrefabDom, AZStd::string> parseResult =
+                            AZ::JsonSerializationUtils::ReadJsonString(readResult.GetValue());
+                        if (parseResult.IsSuccess())
+                        {
+                            file.m_dom = parseResult.TakeValue();
+                        }
+                    }
+                };
+
+                auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+                if (files.size() > 1 && taskGraphActive && taskGraphActive->IsTaskGraphActive())
+                {
+                    static const AZ::TaskDescriptor prefetchTaskDescriptor{ "Prefetch prefab file", "Prefabs" };
+
+                    AZ::TaskGraph taskGraph{ "PrefabFilesPrefetching" };
+                    for (PrefetchedFile& file : files)
+                    {
+                        taskGraph.AddTask(
+                            prefetchTaskDescriptor,
+                            [&readAndParse, &file]()
+                            {
+                                readAndParse(file);
+                            });
+                    }
+
+                    AZ::TaskGraphEvent finished{ "PrefabFilesPrefetching wait" };
+                    taskGraph.Submit(&finished);
+                    finished.Wait();
+                }
+                else
+                {
+                    for (PrefetchedFile& file : files)
+                    {
+                        readAndParse(file);
+                    }
+                }
+
+                // The sources of the nested instances make up the next level.
+                currentLevel.clear();
+                for (PrefetchedFile& file : files)
+                {
+                    if (!file.m_dom.has_value())
+                    {
+                        continue;
+                    }
+
+                    const PrefabDom& dom = file.m_dom.value();
+                    PrefabDomValueConstReference instancesReference = PrefabDomUtils::GetInstancesValue(dom);
+                    if (instancesReference.has_value() && instancesReference->get().IsObject())
+                    {
+                        for (auto instanceIterator = instancesReference->get().MemberBegin();
+                             instanceIterator != instancesReference->get().MemberEnd();
+                             ++instanceIterator)
+                        {
+                            PrefabDomValueConstReference sourceReference =
+                                PrefabDomUtils::FindPrefabDomValue(instanceIterator->value, PrefabDomUtils::SourceName);
+                            if (sourceReference.has_value() && sourceReference->get().IsString())
+                            {
+                                AZ::IO::PathView sourcePath(
+                                    AZStd::string_view(sourceReference->get().GetString(), sourceReference->get().GetStringLength()));
+                                if (IsValidPrefabPath(sourcePath))
+                                {
+                                    currentLevel.emplace_back(sourcePath);
+                                }
+                            }
+                        }
+                    }
+
+                    m_prefetchedPrefabDoms.emplace(AZStd::move(file.m_relativePath), AZStd::move(file.m_dom.value()));
+                }
+            }
+        }
+
         void PrefabLoader::ReloadTemplateFromFile(AZ::IO::PathView relativePath)
         {
             AZStd::unordered_set<AZ::IO::Path> progressedFilePathsSet;
@@ -365,6 +481,12 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
+            // Prefetched files have already been read and parsed.
+            if (m_prefetchedPrefabDoms.contains(GenerateRelativePath(filePath)))
+            {
+                return LoadTemplateFromString({}, filePath, progressedFilePathsSet);
+            }
+
             auto readResult = AZ::Utils::ReadFile(GetFullPath(filePath).Native(), AZStd::numeric_limits<size_t>::max());
             if (!readResult.IsSuccess())
             {
@@ -428,8 +550,17 @@ namespace AzToolsFramework
                 return loadedTemplateId;
             }
 
-            // Read Template's prefab file from disk and parse Prefab DOM from file.
-            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+            // Parse Prefab DOM from the file content, unless it was already parsed while prefetching.
+            AZ::Outcome<PrefabDom, AZStd::string> readPrefabFileResult = AZ::Failure(AZStd::string());
+            if (auto prefetchedDom = m_prefetchedPrefabDoms.find(relativePath); prefetchedDom != m_prefetchedPrefabDoms.end())
+            {
+                readPrefabFileResult = AZ::Success(AZStd::move(prefetchedDom->second));
+                m_prefetchedPrefabDoms.erase(prefetchedDom);
+            }
+            else
+            {
+                readPrefabFileResult = AZ::JsonSerializationUtils::ReadJsonString(fileContent);
+            }
             if (!readPrefabFileResult.IsSuccess())
             {
                 AZ_Error(
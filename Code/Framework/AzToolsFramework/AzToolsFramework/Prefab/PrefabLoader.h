@@ -12,6 +12,7 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
@@ -163,8 +164,18 @@ namespace AzToolsFramework
                 AZ::IO::PathView filePath,
                 AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
 
+            /**
+             * Reads and parses the prefab file and all the prefab files it directly or indirectly nests, so loading the templates
+             * afterwards doesn't have to wait for the file system or the json parser. Files on the same nesting level are read and
+             * parsed in parallel on the task graph. The parsed doms are stored in m_prefetchedPrefabDoms. Files that fail to be read
+             * or parsed are skipped, so loading them reports the error as usual.
+             * @param filePath A path to a Prefab Template file.
+             */
+            void PrefetchPrefabFiles(AZ::IO::PathView filePath);
+
             /**
              * Load Prefab Template from given string to memory and return the id of loaded Template.
+             * If the file was prefetched, the prefetched dom is used instead of parsing the given content.
              * @param fileContent Json content of the template
              * @param filePath Path that will be used for the template if saved to file.
              * @param progressedFilePathsSet An unordered_set to track if there's any cyclical dependency between Templates.
@@ -208,6 +219,8 @@ namespace AzToolsFramework
             ScriptingPrefabLoader m_scriptingPrefabLoader;
             AZ::IO::Path m_projectPathWithOsSeparator;
             AZ::IO::Path m_projectPathWithSlashSeparator;
+            //! Doms parsed by PrefetchPrefabFiles by the relative path of their file. Only used while loading a template.
+            AZStd::unordered_map<AZ::IO::Path, PrefabDom> m_prefetchedPrefabDoms;
         };
     } // namespace Prefab
 } // namespace AzToolsFramework
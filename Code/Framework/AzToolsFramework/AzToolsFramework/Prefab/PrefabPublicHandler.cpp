@@ -881,11 +881,9 @@ namespace AzToolsFramework
                 return AZ::Success();
             }
 
-            PrefabDom patch;
-            m_instanceToTemplateInterface->GeneratePatch(patch, beforeState, afterState);
-            m_instanceToTemplateInterface->PrependEntityAliasPathToPatchPaths(patch, entityId);
-
-            if (patch.IsArray() && !patch.Empty())
+            // The undo nodes below generate their own patches, so only check whether anything changed here
+            // instead of generating a patch that would be discarded.
+            if (beforeState != afterState)
             {
                 bool isNewParentOwnedByDifferentInstance = false;
 
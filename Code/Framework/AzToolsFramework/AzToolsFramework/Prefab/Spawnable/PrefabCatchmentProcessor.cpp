@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzFramework/Spawnable/Spawnable.h>
+#include <AzFramework/Spawnable/SpawnableBinaryFormat.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
@@ -23,9 +24,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 {
     void PrefabCatchmentProcessor::Process(PrefabProcessorContext& context)
     {
-        AZ::DataStream::StreamType serializationFormat = m_serializationFormat == SerializationFormats::Binary ?
-            AZ::DataStream::StreamType::ST_BINARY : AZ::DataStream::StreamType::ST_XML;
-        context.ListPrefabs([&context, serializationFormat](PrefabDocument& prefab)
+        context.ListPrefabs([&context, serializationFormat = m_serializationFormat](PrefabDocument& prefab)
             {
                 ProcessPrefab(context, prefab, serializationFormat);
             });
@@ -37,7 +36,8 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         {
             serializeContext->Enum<SerializationFormats>()
                 ->Value("Binary", SerializationFormats::Binary)
-                ->Value("Text", SerializationFormats::Text);
+                ->Value("Text", SerializationFormats::Text)
+                ->Value("PackedBinary", SerializationFormats::PackedBinary);
 
             serializeContext->Class<PrefabCatchmentProcessor, PrefabProcessor>()
                 ->Version(3)
@@ -46,7 +46,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     }
 
     void PrefabCatchmentProcessor::ProcessPrefab(PrefabProcessorContext& context, PrefabDocument& prefab,
-        AZ::DataStream::StreamType serializationFormat)
+        SerializationFormats serializationFormat)
     {
         using namespace AzToolsFramework::Prefab::SpawnableUtils;
 
@@ -57,7 +57,16 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         {
             AZ::IO::ByteContainerStream stream(&output);
             auto& asset = object.GetAsset();
-            return AZ::Utils::SaveObjectToStream(stream, serializationFormat, &asset, asset.GetType());
+            switch (serializationFormat)
+            {
+            case SerializationFormats::PackedBinary:
+                return AzFramework::SpawnableBinaryFormat::Save(stream, static_cast<const AzFramework::Spawnable&>(asset));
+            case SerializationFormats::Text:
+                return AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::StreamType::ST_XML, &asset, asset.GetType());
+            case SerializationFormats::Binary:
+            default:
+                return AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::StreamType::ST_BINARY, &asset, asset.GetType());
+            }
         };
 
         auto&& [object, spawnable] = ProcessedObjectStore::Create<AzFramework::Spawnable>(
@@ -31,7 +31,10 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         enum class SerializationFormats
         {
             Binary, //!< Binary is generally preferable for performance.
-            Text //!< Store in text format which is usually slower but helps with debugging.
+            Text, //!< Store in text format which is usually slower but helps with debugging.
+            //! Store every entity as a separate binary blob so entities can be decoded in parallel when loading.
+            //! See AzFramework::SpawnableBinaryFormat.
+            PackedBinary
         };
 
         ~PrefabCatchmentProcessor() override = default;
@@ -41,7 +44,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         static void Reflect(AZ::ReflectContext* context);
 
     protected:
-        static void ProcessPrefab(PrefabProcessorContext& context, PrefabDocument& prefab, AZ::DataStream::StreamType serializationFormat);
+        static void ProcessPrefab(PrefabProcessorContext& context, PrefabDocument& prefab, SerializationFormats serializationFormat);
 
         SerializationFormats m_serializationFormat{ SerializationFormats::Binary };
     };
@@ -298,6 +298,11 @@ namespace AzToolsFramework
                     GetEntityId(), &TransformNotification::OnTransformChanged, localTM, worldTM);
                 m_transformChangedEvent.Signal(localTM, worldTM);
 
+                if (AZ::TransformBatchRequests* transformBatch = AZ::Interface<AZ::TransformBatchRequests>::Get())
+                {
+                    transformBatch->QueueTransformChanged(GetEntityId(), worldTM);
+                }
+
                 AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
                 if (boundsUnion != nullptr)
                 {
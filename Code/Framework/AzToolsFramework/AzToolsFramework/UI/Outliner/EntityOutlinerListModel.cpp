@@ -1074,12 +1074,22 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::QueueAncestorUpdate(AZ::EntityId entityId)
     {
+        if (m_layoutResetQueued || !m_ancestorUpdateQueued.insert(entityId).second)
+        {
+            return;
+        }
+
         //primarily needed for ancestors that reflect child state (selected, locked, hidden)
         AZ::EntityId parentId;
         EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
         for (AZ::EntityId currentId = parentId; currentId.IsValid(); currentId = parentId)
         {
             QueueEntityUpdate(currentId);
+            if (!m_ancestorUpdateQueued.insert(currentId).second)
+            {
+                // The rest of the chain was queued by a previous call
+                break;
+            }
             parentId.SetInvalid();
             EditorEntityInfoRequestBus::EventResult(parentId, currentId, &EditorEntityInfoRequestBus::Events::GetParent);
         }
@@ -1108,6 +1118,8 @@ namespace AzToolsFramework
             return;
         }
         m_entityChangeQueued = false;
+        m_ancestorUpdateQueued.clear();
+        m_ancestorExpandQueued.clear();
         if (m_layoutResetQueued)
         {
             return;
@@ -1176,6 +1188,8 @@ namespace AzToolsFramework
         m_layoutResetQueued = false;
         m_entityChangeQueued = false;
         m_entityChangeQueue.clear();
+        m_ancestorUpdateQueued.clear();
+        m_ancestorExpandQueued.clear();
         QueueEntityUpdate(AZ::EntityId());
         emit EnableSelectionUpdates(true);
     }
@@ -1266,7 +1280,10 @@ namespace AzToolsFramework
         endRemoveRows();
 
         //must refresh partial lock/visibility of parents
+        //the queued ancestor chains are no longer valid if this is a reparent
         m_isFilterDirty = true;
+        m_ancestorUpdateQueued.clear();
+        m_ancestorExpandQueued.clear();
         QueueAncestorUpdate(parentId);
         emit EnableSelectionUpdates(true);
 
@@ -1491,6 +1508,7 @@ namespace AzToolsFramework
     {
         m_isFilterDirty = true;
         m_entityExpansionState[entityId] = false;
+        m_ancestorExpandQueued.clear();
         QueueEntityUpdate(entityId);
     }
 
@@ -1517,7 +1535,7 @@ namespace AzToolsFramework
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
         //typically to reveal selected entities, expand all parent entities
-        if (entityId.IsValid())
+        if (entityId.IsValid() && m_ancestorExpandQueued.insert(entityId).second)
         {
             AZ::EntityId parentId;
             EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
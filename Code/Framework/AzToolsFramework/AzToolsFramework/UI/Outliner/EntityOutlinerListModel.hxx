@@ -196,6 +196,10 @@ namespace AzToolsFramework
         void ProcessEntityInfoResetEnd();
         AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
+        //! Entities whose ancestors were already queued for update or expansion since the last ProcessEntityUpdates.
+        //! Selecting many siblings would otherwise walk the same ancestor chain once per entity.
+        AZStd::unordered_set<AZ::EntityId> m_ancestorUpdateQueued;
+        AZStd::unordered_set<AZ::EntityId> m_ancestorExpandQueued;
         bool m_entityChangeQueued;
         bool m_entityLayoutQueued;
         bool m_dropOperationInProgress = false;
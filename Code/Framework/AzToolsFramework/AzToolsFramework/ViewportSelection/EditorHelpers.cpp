@@ -239,14 +239,12 @@ namespace AzToolsFramework
                 }
             }
 
+            // entities that can't be closer than the current closest one are skipped without querying their components
             float closestBoundDifference;
-            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
+            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId, closestDistance))
             {
-                if (closestBoundDifference < closestDistance)
-                {
-                    closestDistance = closestBoundDifference;
-                    entityIdUnderCursor = entityId;
-                }
+                closestDistance = closestBoundDifference;
+                entityIdUnderCursor = entityId;
             }
         }
 
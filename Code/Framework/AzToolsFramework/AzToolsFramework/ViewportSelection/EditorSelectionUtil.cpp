@@ -83,7 +83,12 @@ namespace AzToolsFramework
     }
 
     bool PickEntity(
-        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, const int viewportId)
+        AZ::EntityId entityId,
+        const AZ::Vector3& rayOrigin,
+        const AZ::Vector3& rayDirection,
+        float& closestDistance,
+        const int viewportId,
+        const float maxDistance)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -97,9 +102,9 @@ namespace AzToolsFramework
             return false;
         }
 
-        // coarse grain check
-        float unused;
-        if (!AabbIntersectRay(rayOrigin, rayDirection, aabb, unused))
+        // coarse grain check, any intersection with the components is inside the bounds so it can't be closer than where they start
+        float boundsDistance;
+        if (!AabbIntersectRay(rayOrigin, rayDirection, aabb, boundsDistance) || boundsDistance >= maxDistance)
         {
             return false;
         }
@@ -107,14 +112,14 @@ namespace AzToolsFramework
         bool entityPicked = false;
         EditorComponentSelectionRequestsBus::EnumerateHandlersId(
             entityId,
-            [rayOrigin, rayDirection, &entityPicked, &closestDistance, viewportInfo](EditorComponentSelectionRequests* handler) -> bool
+            [rayOrigin, rayDirection, maxDistance, &entityPicked, &closestDistance, viewportInfo](EditorComponentSelectionRequests* handler) -> bool
             {
                 if (handler->SupportsEditorRayIntersectViewport(viewportInfo))
                 {
                     float distance = AZStd::numeric_limits<float>::max();
                     if (const bool intersection =
                             handler->EditorSelectionIntersectRayViewport(viewportInfo, rayOrigin, rayDirection, distance);
-                        intersection && distance < closestDistance)
+                        intersection && distance < closestDistance && distance < maxDistance)
                     {
                         entityPicked = true;
                         closestDistance = distance;
@@ -131,10 +136,16 @@ namespace AzToolsFramework
         const AZ::EntityId entityId,
         const ViewportInteraction::MouseInteraction& mouseInteraction,
         float& closestDistance,
-        const int viewportId)
+        const int viewportId,
+        const float maxDistance)
     {
         return PickEntity(
-            entityId, mouseInteraction.m_mousePick.m_rayOrigin, mouseInteraction.m_mousePick.m_rayDirection, closestDistance, viewportId);
+            entityId,
+            mouseInteraction.m_mousePick.m_rayOrigin,
+            mouseInteraction.m_mousePick.m_rayDirection,
+            closestDistance,
+            viewportId,
+            maxDistance);
     }
 
     AzFramework::CameraState GetCameraState(const int viewportId)
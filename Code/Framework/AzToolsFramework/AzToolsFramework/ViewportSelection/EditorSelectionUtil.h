@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzToolsFramework/Viewport/ViewportTypes.h>
 #include <AzToolsFramework/ViewportSelection/EditorTransformComponentSelectionRequestBus.h>
@@ -51,12 +52,23 @@ namespace AzToolsFramework
     bool AabbIntersectRay(const AZ::Vector3& origin, const AZ::Vector3& direction, const AZ::Aabb& aabb, float& distance);
 
     //! Return if a mouse interaction (pick ray) did intersect the tested EntityId.
+    //! @param maxDistance Intersections further than this are ignored. The entity's components are not queried when its
+    //! selection bounds start further than this, which is the cost to avoid when picking among many entities.
     bool PickEntity(
-        AZ::EntityId entityId, const ViewportInteraction::MouseInteraction& mouseInteraction, float& closestDistance, int viewportId);
+        AZ::EntityId entityId,
+        const ViewportInteraction::MouseInteraction& mouseInteraction,
+        float& closestDistance,
+        int viewportId,
+        float maxDistance = AZStd::numeric_limits<float>::max());
 
     //! Return if a mouse interaction (pick ray) did intersect the tested EntityId.
     bool PickEntity(
-        AZ::EntityId entityId, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, float& closestDistance, int viewportId);
+        AZ::EntityId entityId,
+        const AZ::Vector3& rayOrigin,
+        const AZ::Vector3& rayDirection,
+        float& closestDistance,
+        int viewportId,
+        float maxDistance = AZStd::numeric_limits<float>::max());
 
     //! Wrapper for EBus call to return the CameraState for a given viewport.
     AzFramework::CameraState GetCameraState(int viewportId);
@@ -147,4 +147,54 @@ namespace UnitTest
         PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
     }
 
+    TEST_F(PrefabUpdateWithPatchesTest, IdentifyModifiedInstanceMembers_ComparedDoms_OnlyModifiedMembersAreIdentified)
+    {
+        PrefabDom cachedInstanceDom;
+        cachedInstanceDom.Parse(R"({
+            "ContainerEntity": { "Id": "Container" },
+            "Entities": {
+                "Unchanged": { "Id": "Unchanged", "Name": "A" },
+                "Changed": { "Id": "Changed", "Name": "B" },
+                "Removed": { "Id": "Removed", "Name": "C" }
+            },
+            "Instances": {
+                "UnchangedInstance": { "Source": "a.prefab" },
+                "ChangedInstance": { "Source": "b.prefab", "Entities": {} },
+                "RemovedInstance": { "Source": "c.prefab" }
+            }
+        })");
+        ASSERT_FALSE(cachedInstanceDom.HasParseError());
+
+        PrefabDom instanceDom;
+        instanceDom.Parse(R"({
+            "ContainerEntity": { "Id": "Container" },
+            "Entities": {
+                "Added": { "Id": "Added", "Name": "D" },
+                "Changed": { "Id": "Changed", "Name": "E" },
+                "Unchanged": { "Id": "Unchanged", "Name": "A" }
+            },
+            "Instances": {
+                "AddedInstance": { "Source": "d.prefab" },
+                "ChangedInstance": { "Source": "b.prefab", "Entities": { "New": {} } },
+                "UnchangedInstance": { "Source": "a.prefab" }
+            }
+        })");
+        ASSERT_FALSE(instanceDom.HasParseError());
+
+        PrefabDomUtils::PatchesMetadata patchesMetadata =
+            PrefabDomUtils::IdentifyModifiedInstanceMembers(cachedInstanceDom, instanceDom);
+
+        EXPECT_FALSE(patchesMetadata.IsEmpty());
+        EXPECT_FALSE(patchesMetadata.m_clearAndLoadAllEntities);
+        EXPECT_FALSE(patchesMetadata.m_clearAndLoadAllInstances);
+        EXPECT_FALSE(patchesMetadata.m_shouldReloadContainerEntity);
+        EXPECT_EQ(patchesMetadata.m_entitiesToReload, (AZStd::unordered_set<EntityAlias>{ "Added", "Changed" }));
+        EXPECT_EQ(patchesMetadata.m_entitiesToRemove, (AZStd::unordered_set<EntityAlias>{ "Removed" }));
+        EXPECT_EQ(patchesMetadata.m_instancesToAdd, (AZStd::unordered_set<InstanceAlias>{ "AddedInstance" }));
+        EXPECT_EQ(patchesMetadata.m_instancesToReload, (AZStd::unordered_set<InstanceAlias>{ "ChangedInstance" }));
+        EXPECT_EQ(patchesMetadata.m_instancesToRemove, (AZStd::unordered_set<InstanceAlias>{ "RemovedInstance" }));
+
+        // Comparing a DOM with itself finds nothing to load again.
+        EXPECT_TRUE(PrefabDomUtils::IdentifyModifiedInstanceMembers(instanceDom, instanceDom).IsEmpty());
+    }
 }
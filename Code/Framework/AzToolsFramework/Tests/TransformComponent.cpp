@@ -720,6 +720,29 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    TEST_F(TransformComponentHierarchy, SetWorldTM_SameValue_ChildrenNotUpdated)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(12.5f, 4.25f, 7.0f));
+
+        int childChangedCount = 0;
+        AZ::TransformChangedEvent::Handler childChangedHandler(
+            [&childChangedCount](const AZ::Transform&, const AZ::Transform&)
+            {
+                ++childChangedCount;
+            });
+        m_childEntity->GetTransform()->BindTransformChangedEventHandler(childChangedHandler);
+
+        AZ::Transform parentWorldTM = m_parentEntity->GetTransform()->GetWorldTM();
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentWorldTM);
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetLocalTM, m_parentEntity->GetTransform()->GetLocalTM());
+        EXPECT_EQ(childChangedCount, 0);
+
+        parentWorldTM.SetTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f));
+        TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTM, parentWorldTM);
+        EXPECT_EQ(childChangedCount, 1);
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
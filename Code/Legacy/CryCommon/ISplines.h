@@ -672,12 +672,30 @@ namespace spline
         inline int seek_key(float t)
         {
             assert(num_keys() < (1 << 15));
-            if ((m_curr >= num_keys()) || (time(m_curr) > t))
+            const int numKeys = num_keys();
+            if ((m_curr >= numKeys) || (time(m_curr) > t) || ((m_curr + 2 < numKeys) && (time(m_curr + 2) <= t)))
             {
-                // Search from begining.
-                m_curr = 0;
+                // Time jumped away from the current key (seek, scrub or loop), binary search for the last key not after t.
+                int first = 0;
+                int count = numKeys;
+                while (count > 0)
+                {
+                    const int step = count / 2;
+                    if (time(first + step) <= t)
+                    {
+                        first += step + 1;
+                        count -= step + 1;
+                    }
+                    else
+                    {
+                        count = step;
+                    }
+                }
+                m_curr = static_cast<int16>(first > 0 ? first - 1 : 0);
+                return m_curr;
             }
-            while ((m_curr < num_keys() - 1) && (time(m_curr + 1) <= t))
+            // Playback moves at most one key per evaluation.
+            while ((m_curr < numKeys - 1) && (time(m_curr + 1) <= t))
             {
                 ++m_curr;
             }
@@ -345,6 +345,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            LoadOrderFileArg,
             PlatformArg,
             PrintFlag,
             VerboseFlag,
@@ -1107,6 +1108,17 @@ namespace AssetBundler
             params.m_maxBundleSizeInMB = AZStd::stoi(parser->GetSwitchValue(MaxBundleSizeArg, 0));
         }
 
+        // Read in Load Order File arg
+        argOutcome = GetFilePathArg(parser, LoadOrderFileArg, BundleSettingsCommand);
+        if (!argOutcome.IsSuccess())
+        {
+            return AZ::Failure(argOutcome.GetError());
+        }
+        if (!argOutcome.GetValue().empty())
+        {
+            params.m_loadOrderFile = FilePath(argOutcome.GetValue());
+        }
+
         // Read in Print flag
         params.m_print = parser->HasSwitch(PrintFlag);
 
@@ -2103,6 +2115,22 @@ namespace AssetBundler
                 bundleSettings.m_maxBundleSizeInMB = params.m_maxBundleSizeInMB;
             }
 
+            // Load Order File
+            AZStd::string loadOrderFilePath = params.m_loadOrderFile.AbsolutePath();
+            if (!loadOrderFilePath.empty())
+            {
+                if (!AZ::IO::FileIOBase::GetInstance()->Exists(loadOrderFilePath.c_str()))
+                {
+                    AZ_Error(AppWindowName, false, "Cannot set Load Order file to ( %s ): file does not exist.", loadOrderFilePath.c_str());
+                    return false;
+                }
+
+                // Make the path relative to the engine root folder before saving
+                AZ::StringFunc::Replace(loadOrderFilePath, GetEngineRoot(), "");
+
+                bundleSettings.m_loadOrderFilePath = loadOrderFilePath;
+            }
+
             // Print
             if (params.m_print)
             {
@@ -2111,7 +2139,8 @@ namespace AssetBundler
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Asset List file: %s\n", bundleSettings.m_assetFileInfoListPath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Output Bundle path: %s\n", bundleSettings.m_bundleFilePath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Bundle Version: %i\n", bundleSettings.m_bundleVersion);
-                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Load Order file: %s\n\n", bundleSettings.m_loadOrderFilePath.c_str());
             }
 
             // Save
@@ -2847,6 +2876,8 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets a text file listing product paths, one per line, in the order they are first loaded.\n", LoadOrderFileArg);
+        AZ_Printf(AppWindowName, "%-31s---Listed products are written first in the Bundles, in that order, to keep reads sequential.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) referenced by all Bundle Settings operations.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---Defaults to all enabled platforms. Platforms can be changed by modifying AssetProcessorPlatformConfig.setreg.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Outputs the contents of the Bundle Settings file after modifying any specified values.\n", PrintFlag);
@@ -375,15 +375,17 @@ void FileWatcher::WatchFolderLoop()
             {
                 // note that the event->name coming in is relative to the thing being watched.  Since we watch folders,
                 // for the folder itself, this will be blank, for files in it, it will be the file name.
-                QDir watchedDir(m_platformImpl->m_handleToFolderMap[event->wd]);
+                // look the folder up once per event, value() also avoids inserting empty entries for handles that were already removed.
+                const QString watchedFolder = m_platformImpl->m_handleToFolderMap.value(event->wd);
+                QDir watchedDir(watchedFolder);
                 const QString pathStr = watchedDir.absoluteFilePath(event->name);
 
                 if (event->mask & (IN_CREATE | IN_MOVED_TO))
                 {
                     DEBUG_FILEWATCHER("notify event is IN_CREATE | IN_MOVED_TO (flags 0x%08x) %s (from '%s') cycle: %i \n", event->mask, pathStr.toUtf8().constData(), event->name, cycleCount);
-                    const auto found = AZStd::find_if(begin(m_folderWatchRoots), end(m_folderWatchRoots), [this, event](const WatchRoot& watchRoot)
+                    const auto found = AZStd::find_if(begin(m_folderWatchRoots), end(m_folderWatchRoots), [&watchedFolder](const WatchRoot& watchRoot)
                         {
-                            return watchRoot.m_directory == m_platformImpl->m_handleToFolderMap[event->wd];
+                            return watchRoot.m_directory == watchedFolder;
                         });
 
                     bool isChildOfRootFolder = found != end(m_folderWatchRoots);
@@ -78,6 +78,8 @@ set(FILES
     native/utilities/ApplicationServer.h
     native/utilities/AssetBuilderInfo.cpp
     native/utilities/AssetBuilderInfo.h
+    native/utilities/AssetCacheBackend.cpp
+    native/utilities/AssetCacheBackend.h
     native/utilities/AssetServerHandler.cpp
     native/utilities/AssetServerHandler.h
     native/utilities/AssetUtilEBusHelper.h
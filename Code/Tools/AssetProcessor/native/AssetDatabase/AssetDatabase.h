@@ -233,6 +233,9 @@ namespace AssetProcessor
         // updates the modtime and hash for a file if it exists.  Only returns true if the row existed and was successfully updated
         bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash);
         bool UpdateFileHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 hash);
+        // updates the modtime and hash of every entry, matched by its file name and scan folder, in a single transaction.
+        // Only returns true if every row existed and was successfully updated.  Rows that could be updated are, regardless.
+        bool UpdateFileModTimesAndHashes(const AzToolsFramework::AssetDatabase::FileDatabaseEntryContainer& entries);
         bool RemoveFile(AZ::s64 sourceID);
 
         //Stats
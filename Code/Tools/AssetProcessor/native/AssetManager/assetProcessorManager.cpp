@@ -8,6 +8,9 @@
 #include <QStringList>
 #include <QCoreApplication>
 #include <QElapsedTimer>
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <AzCore/Casting/lossy_cast.h>
 
@@ -156,6 +159,12 @@ namespace AssetProcessor
                 if (sourceAsset)
                 {
                     m_sourceFilesInDatabase[sourceAsset.AbsolutePath().c_str()] = { sourceAsset, entry.m_analysisFingerprint.c_str() };
+
+                    if (m_dependencyCacheEnabled)
+                    {
+                        // sources without any dependencies get an empty entry, so they don't need to be queried either
+                        m_dependencyCache.try_emplace(entry.m_sourceGuid);
+                    }
                 }
 
                 return true;
@@ -163,6 +172,17 @@ namespace AssetProcessor
 
             m_stateData->QuerySourceAndScanfolder(sourcesFunction);
 
+            if (m_dependencyCacheEnabled)
+            {
+                // Load the entire dependency graph from last time in one go.  Checking whether the unchanged files can be
+                // skipped needs the recursive dependencies of every one of them, which would otherwise be queried source by source.
+                m_stateData->QuerySourceDependencies([this](AzToolsFramework::AssetDatabase::SourceFileDependencyEntry& entry)
+                {
+                    m_dependencyCache[entry.m_sourceGuid].emplace_back(entry.m_dependsOnSource);
+                    return true;
+                });
+            }
+
             m_stateData->QueryFilesTable([this](AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry)
             {
                 if (entry.m_isFolder)
@@ -3452,6 +3472,10 @@ namespace AssetProcessor
             return;
         }
 
+        // files whose modtime changed since last time but whose hash is known will be hashed to find out if their
+        // contents actually changed.  Those are hashed here in parallel, instead of one at a time while assessing them.
+        QVector<const AssetFileInfo*> filesToHash;
+
         // the strategy here is to only warm up the file cache if absolutely everything
         // is okay - the mod time must match last time, the file must exist, the hash must be present
         // and non zero from last time.  If anything at all is not correct, we will not warm the
@@ -3488,6 +3512,14 @@ namespace AssetProcessor
                             }
                         }
                     }
+                    else
+                    {
+                        auto hashItr = m_fileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+                        if (hashItr != m_fileHashes.end() && hashItr->second != 0)
+                        {
+                            filesToHash.push_back(&fileInfo);
+                        }
+                    }
                 }
             }
             // Note that the 'continue' statement above, which happens if all conditions are met
@@ -3497,6 +3529,45 @@ namespace AssetProcessor
             // came from the bulk scan, so we can still warm up the file cache with this info.
             fileStateCache->WarmUpCache(fileInfo);
         }
+
+        if (filesToHash.isEmpty() || !AssetUtilities::ShouldUseFileHashing())
+        {
+            return;
+        }
+
+        // The files are split into one batch per thread.  The hashing goes directly to the builder SDK, as the stats
+        // capture that AssetUtilities::GetFileHash records into is not thread safe.
+        QThreadPool hashPool;
+        const int batchCount = AZStd::max(1, AZStd::min(hashPool.maxThreadCount(), filesToHash.size()));
+        const int batchSize = (filesToHash.size() + batchCount - 1) / batchCount;
+        QVector<AZ::u64> hashes(filesToHash.size());
+        QVector<QFuture<void>> batches;
+        batches.reserve(batchCount);
+        for (int begin = 0; begin < filesToHash.size(); begin += batchSize)
+        {
+            const int end = AZStd::min(begin + batchSize, filesToHash.size());
+            batches.push_back(QtConcurrent::run(&hashPool, [&filesToHash, &hashes, begin, end]()
+            {
+                for (int index = begin; index < end; ++index)
+                {
+                    hashes[index] = AssetBuilderSDK::GetFileHash(filesToHash[index]->m_filePath.toUtf8().constData());
+                }
+            }));
+        }
+
+        for (QFuture<void>& batch : batches)
+        {
+            batch.waitForFinished();
+        }
+
+        for (int index = 0; index < filesToHash.size(); ++index)
+        {
+            // a hash of 0 means the file couldn't be read, leave it to be hashed again on demand.
+            if (hashes[index] != 0)
+            {
+                fileStateCache->WarmUpCache(*filesToHash[index], hashes[index]);
+            }
+        }
     }
 
     // this means a file is definitely coming from the file scanner, and not the file monitor.
@@ -3529,6 +3600,7 @@ namespace AssetProcessor
 
         AssetProcessor::StatsCapture::BeginCaptureStat("InitialFileAssessment");
 
+        AzToolsFramework::AssetDatabase::FileDatabaseEntryContainer modTimeUpdates;
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -3544,12 +3616,12 @@ namespace AssetProcessor
                         m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
 
                         // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
-
-                        if(!updated)
-                        {
-                            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
-                        }
+                        // The updates are written in a single transaction once all files are assessed, instead of one transaction per file.
+                        AzToolsFramework::AssetDatabase::FileDatabaseEntry& modTimeUpdate = modTimeUpdates.emplace_back();
+                        modTimeUpdate.m_scanFolderPK = fileInfo.m_scanFolder->ScanFolderID();
+                        modTimeUpdate.m_fileName = databaseName.toUtf8().constData();
+                        modTimeUpdate.m_modTime = AssetUtilities::AdjustTimestamp(fileInfo.m_modTime);
+                        modTimeUpdate.m_hash = fileHash;
                     }
 
                     continue;
@@ -3560,6 +3632,11 @@ namespace AssetProcessor
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
 
+        if (!m_stateData->UpdateFileModTimesAndHashes(modTimeUpdates))
+        {
+            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for one or more files during file scan");
+        }
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
@@ -4757,6 +4834,17 @@ namespace AssetProcessor
 
         // set the new dependencies:
         m_stateData->SetSourceFileDependencies(newDependencies);
+
+        if (m_dependencyCacheEnabled)
+        {
+            // keep the startup cache in sync, the sources queued later on may depend on this one.
+            AZStd::vector<PathOrUuid>& cachedDependencies = m_dependencyCache[entry.m_sourceFileInfo.m_uuid];
+            cachedDependencies.clear();
+            for (const SourceFileDependencyEntry& newDependency : newDependencies)
+            {
+                cachedDependencies.emplace_back(newDependency.m_dependsOnSource);
+            }
+        }
     }
 
     AZStd::shared_ptr<AssetDatabaseConnection> AssetProcessorManager::GetDatabaseConnection() const
@@ -5658,6 +5746,13 @@ namespace AssetProcessor
                 };
 
                 m_stateData->QueryDependsOnSourceBySourceDependency(searchUuid, dependencyType, callbackFunction);
+
+                if (m_dependencyCacheEnabled &&
+                    dependencyType == AzToolsFramework::AssetDatabase::SourceFileDependencyEntry::TypeOfDependency::DEP_Any)
+                {
+                    // remember files without dependencies as well, so they're not queried again
+                    m_dependencyCache.try_emplace(searchUuid);
+                }
             }
         }
 
@@ -9,7 +9,10 @@
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
+#include <QFuture>
+#include <QThreadPool>
 #include <QtConcurrent/QtConcurrentFilter>
+#include <QtConcurrent/QtConcurrentRun>
 
 using namespace AssetProcessor;
 
@@ -35,11 +38,40 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // Scan folders don't depend on each other, so they're walked in parallel.  On large projects walking the directory
+    // tree is most of the time spent before the first job can start.
+    // A local pool is used, as the global one is sized for running jobs.
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    QVector<ScanResults> scanFolderResults(scanFolderCount);
     {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        QThreadPool scanPool;
+        QVector<QFuture<void>> scans;
+        scans.reserve(scanFolderCount);
+        for (int idx = 0; idx < scanFolderCount; idx++)
+        {
+            const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+            ScanResults& results = scanFolderResults[idx];
+            scans.push_back(QtConcurrent::run(&scanPool, [this, &scanFolderInfo, &results]()
+            {
+                ScanForSourceFiles(scanFolderInfo, scanFolderInfo, results);
+            }));
+        }
+
+        for (QFuture<void>& scan : scans)
+        {
+            scan.waitForFinished();
+        }
+    }
+
+    // merge in scan folder order, so a file found by several scan folders keeps the one that was found first, like a
+    // sequential scan would.
+    for (ScanResults& results : scanFolderResults)
+    {
+        m_fileList.unite(results.m_files);
+        m_folderList.unite(results.m_folders);
+        m_excludedList.unite(results.m_excluded);
     }
+    scanFolderResults.clear();
 
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -72,7 +104,7 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResults& results)
 {
     if (!m_doScan)
     {
@@ -135,13 +167,13 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
 
                 if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
+                    results.m_excluded.insert(AZStd::move(assetFileInfo));
                     continue;
                 }
 
                 // Entry is a directory
                 // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+                results.m_folders.insert(AZStd::move(assetFileInfo));
 
                 // recurse into this folder.
                 // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
@@ -173,11 +205,11 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
                 {
                     if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                     {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
+                        results.m_files.insert(AZStd::move(assetFileInfo));
                     }
                     else
                     {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
+                        results.m_excluded.insert(AZStd::move(assetFileInfo));
                     }
                 }
             }
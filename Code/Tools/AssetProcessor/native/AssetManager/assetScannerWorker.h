@@ -43,9 +43,18 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
+        //! What was found while scanning a single scan folder.
+        //! Every scan folder is scanned into its own results so they can be scanned in parallel.
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_files;
+            QSet<AssetFileInfo> m_folders;
+            QSet<AssetFileInfo> m_excluded;
+        };
+
         // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
         // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResults& results);
         void EmitFiles();
 
     private:
@@ -7,6 +7,8 @@
  */
 #include <native/resourcecompiler/RCQueueSortModel.h>
 #include <native/AssetDatabase/AssetDatabase.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include "rcjoblistmodel.h"
 
 namespace AssetProcessor
@@ -273,6 +275,18 @@ namespace AssetProcessor
             return priorityLeft > priorityRight;
         }
 
+        // start the jobs that took the longest the last time first, so they overlap with the shorter ones instead of
+        // running on their own at the end.  Jobs that never ran before count as the shortest.
+        auto leftDuration = m_expectedJobDurations.find(leftJob->GetElementID());
+        auto rightDuration = m_expectedJobDurations.find(rightJob->GetElementID());
+        AZ::s64 durationLeft = leftDuration != m_expectedJobDurations.end() ? leftDuration->second : 0;
+        AZ::s64 durationRight = rightDuration != m_expectedJobDurations.end() ? rightDuration->second : 0;
+
+        if (durationLeft != durationRight)
+        {
+            return durationLeft > durationRight;
+        }
+
         if (leftJob->GetJobEntry().m_sourceAssetReference == rightJob->GetJobEntry().m_sourceAssetReference)
         {
             // If there are two jobs for the same source, then sort by job run key.
@@ -318,6 +332,46 @@ namespace AssetProcessor
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
     }
 
+    void RCQueueSortModel::SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs)
+    {
+        // the job just finished so it isn't in the queue, there's no need to resort until it's queued again.
+        m_expectedJobDurations[elementId] = durationMs;
+    }
+
+    void RCQueueSortModel::PopulateExpectedJobDurationsFromDatabase()
+    {
+        AZStd::string databaseLocation;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(&AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
+        if (databaseLocation.empty())
+        {
+            return;
+        }
+
+        AssetProcessor::AssetDatabaseConnection assetDatabaseConnection;
+        assetDatabaseConnection.OpenDatabase();
+
+        // the stats are named ProcessJob,<scan folder>,<relative source path>,<job key>,<platform>,<builder guid>
+        auto statsFunction = [this](AzToolsFramework::AssetDatabase::StatDatabaseEntry entry)
+        {
+            static constexpr int numTokensExpected = 6;
+            AZStd::vector<AZStd::string> tokens;
+            AZ::StringFunc::Tokenize(entry.m_statName, tokens, ',');
+
+            // stats that can't be parsed are reported by the JobsModel already, just skip them here.
+            if (tokens.size() == numTokensExpected)
+            {
+                QueueElementID elementId;
+                elementId.SetSourceAssetReference(SourceAssetReference(tokens[1].c_str(), tokens[2].c_str()));
+                elementId.SetJobDescriptor(tokens[3].c_str());
+                elementId.SetPlatform(tokens[4].c_str());
+                m_expectedJobDurations[elementId] = entry.m_statValue;
+            }
+            return true;
+        };
+        assetDatabaseConnection.QueryStatLikeStatName("ProcessJob,%", statsFunction);
+        m_dirtyNeedsResort = true;
+    }
+
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
     {
         for (const auto& jobIdEscalationPair : jobIdEscalationList)
@@ -14,6 +14,7 @@
 #include <QString>
 
 
+#include "native/resourcecompiler/RCCommon.h"
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
 #include "native/assetprocessor.h"
@@ -35,6 +36,8 @@ namespace AssetProcessor
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
     //!  (The same, repeated, for unconnected platforms).
+    //! Jobs of equal priority start with the ones that took the longest the last time they were processed, so the
+    //! long running jobs don't end up being the only ones left in flight at the end of a large batch.
     class RCQueueSortModel
         : public QSortFilterProxyModel
         , protected AssetProcessorPlatformBus::Handler
@@ -50,6 +53,11 @@ namespace AssetProcessor
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
 
+        //! Records how long the job took to process, to order it by the next time it is queued.
+        void SetExpectedJobDuration(const QueueElementID& elementId, AZ::s64 durationMs);
+        //! Loads how long every job took to process the last time from the ProcessJob stats in the asset database.
+        void PopulateExpectedJobDurationsFromDatabase();
+
         // implement QSortFilteRProxyModel:
         bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
         bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
@@ -64,6 +72,9 @@ namespace AssetProcessor
 
         JobRunKeyToRCJobMap m_currentJobRunKeyToJobEntries;
 
+        //! How long jobs took to process the last time in milliseconds.  Jobs that never ran have no entry.
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_expectedJobDurations;
+
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
@@ -37,6 +37,7 @@ namespace AssetProcessor
         m_maxJobs = cfg_maxJobs ? qMax(cfg_minJobs, cfg_maxJobs) :  maxJobs;
 
         m_RCQueueSortModel.AttachToModel(&m_RCJobListModel);
+        m_RCQueueSortModel.PopulateExpectedJobDurationsFromDatabase();
 
         // make sure that the global thread pool has enough slots to accomidate your request though, since
         // by default, the global thread pool has idealThreadCount() slots only.
@@ -500,5 +501,11 @@ namespace AssetProcessor
         DispatchJobs();
     }
 
+    void RCController::OnJobProcessDurationChanged(JobEntry jobEntry, int durationMs)
+    {
+        AssetProcessor::QueueElementID elementId(jobEntry.m_sourceAssetReference, jobEntry.m_platformInfo.m_identifier.c_str(), jobEntry.m_jobKey);
+        m_RCQueueSortModel.SetExpectedJobDuration(elementId, durationMs);
+    }
+
 } // Namespace AssetProcessor
 
@@ -104,6 +104,8 @@ namespace AssetProcessor
         // its completely done.
         void OnJobComplete(JobEntry completeEntry, AzToolsFramework::AssetSystem::JobStatus status);
         void OnAddedToCatalog(JobEntry jobEntry);
+        //! Remembers how long the job took, so it's ordered by its duration the next time it's queued.
+        void OnJobProcessDurationChanged(JobEntry jobEntry, int durationMs);
 
     protected:
         AssetProcessor::RCQueueSortModel m_RCQueueSortModel;
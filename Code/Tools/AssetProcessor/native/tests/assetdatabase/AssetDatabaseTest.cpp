@@ -2220,6 +2220,42 @@ namespace UnitTests
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
 
+    TEST_F(AssetDatabaseTest, UpdateFileModTimesAndHashes_ExistingAndMissingFiles_UpdatesExistingFiles)
+    {
+        CreateCoverageTestData();
+
+        bool entryAlreadyExists;
+        FileDatabaseEntryContainer updates;
+        for (const char* fileName : { "testfile1.txt", "testfile2.txt" })
+        {
+            FileDatabaseEntry entry;
+            entry.m_fileName = fileName;
+            entry.m_scanFolderPK = m_data->m_scanFolder.m_scanFolderID;
+            ASSERT_TRUE(m_data->m_connection.InsertFile(entry, entryAlreadyExists));
+
+            entry.m_modTime = 1234;
+            entry.m_hash = 1111;
+            updates.push_back(entry);
+        }
+
+        FileDatabaseEntry missingEntry;
+        missingEntry.m_fileName = "nonexistent.txt";
+        missingEntry.m_scanFolderPK = m_data->m_scanFolder.m_scanFolderID;
+        updates.push_back(missingEntry);
+
+        EXPECT_FALSE(m_data->m_connection.UpdateFileModTimesAndHashes(updates));
+
+        for (const char* fileName : { "testfile1.txt", "testfile2.txt" })
+        {
+            FileDatabaseEntry result;
+            ASSERT_TRUE(m_data->m_connection.GetFileByFileNameAndScanFolderId(fileName, m_data->m_scanFolder.m_scanFolderID, result));
+            EXPECT_EQ(result.m_modTime, 1234);
+            EXPECT_EQ(result.m_hash, 1111);
+        }
+
+        EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
+    }
+
     TEST_F(AssetDatabaseTest, GetSourceBySourceName_InvalidInput_SourceNotFound)
     {
         CreateCoverageTestData();
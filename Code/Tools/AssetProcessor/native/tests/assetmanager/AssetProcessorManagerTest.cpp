@@ -1879,6 +1879,37 @@ TEST_F(AssetProcessorManagerTest, QueryAbsolutePathDependenciesRecursive_BasicTe
     EXPECT_NE(dependencies.find(m_assetRootDir.absoluteFilePath("subfolder1/d.txt").toUtf8().constData()), dependencies.end());
 }
 
+TEST_F(AssetProcessorManagerTest, QueryAbsolutePathDependenciesRecursive_ScanStarted_UsesDependenciesLoadedFromDatabase)
+{
+    using namespace AzToolsFramework::AssetDatabase;
+
+    UnitTestUtils::CreateDummyFile(m_assetRootDir.absoluteFilePath("subfolder1/a.txt"), QString("tempdata\n"));
+    UnitTestUtils::CreateDummyFile(m_assetRootDir.absoluteFilePath("subfolder1/c.txt"), QString("tempdata\n"));
+
+    SourceFileDependencyEntry newEntry;  // a depends on C
+    newEntry.m_sourceDependencyID = AzToolsFramework::AssetDatabase::InvalidEntryId;
+    newEntry.m_builderGuid = AZ::Uuid::CreateRandom();
+    newEntry.m_sourceGuid = m_aUuid;
+    newEntry.m_dependsOnSource = PathOrUuid(m_cUuid);
+    ASSERT_TRUE(m_assetProcessorManager->m_stateData->SetSourceFileDependency(newEntry));
+
+    // starting the scan loads all the dependencies into the cache at once.
+    m_assetProcessorManager->m_dependencyCache = {};
+    m_assetProcessorManager->OnAssetScannerStatusChange(AssetProcessor::AssetScanningStatus::Started);
+    EXPECT_NE(m_assetProcessorManager->m_dependencyCache.find(m_aUuid), m_assetProcessorManager->m_dependencyCache.end());
+
+    // remove the dependency from the database only, the query should still find it in the cache.
+    ASSERT_TRUE(m_assetProcessorManager->m_stateData->RemoveSourceFileDependency(newEntry.m_sourceDependencyID));
+
+    AssetProcessor::SourceFilesForFingerprintingContainer dependencies;
+    m_assetProcessorManager->QueryAbsolutePathDependenciesRecursive(m_aUuid, dependencies, SourceFileDependencyEntry::DEP_Any);
+    EXPECT_EQ(dependencies.size(), 2);
+    EXPECT_NE(dependencies.find(m_assetRootDir.absoluteFilePath("subfolder1/a.txt").toUtf8().constData()), dependencies.end());
+    EXPECT_NE(dependencies.find(m_assetRootDir.absoluteFilePath("subfolder1/c.txt").toUtf8().constData()), dependencies.end());
+
+    m_assetProcessorManager->OnAssetScannerStatusChange(AssetProcessor::AssetScanningStatus::Completed);
+}
+
 TEST_F(AssetProcessorManagerTest, QueryAbsolutePathDependenciesRecursive_WithDifferentTypes_BasicTest)
 {
     // test to make sure that different TYPES of dependencies work as expected.
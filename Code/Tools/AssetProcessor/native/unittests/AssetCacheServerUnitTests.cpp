@@ -231,4 +231,34 @@ namespace UnitTest
         EXPECT_EQ(mode, AssetServerMode::Client);
         EXPECT_TRUE(assetServerHandler.RetrieveJobResult(builderParams));
     }
+
+    TEST_F(AssetServerHandlerUnitTest, AssetCacheBackend_CreateForAddress_ValidatesAddress)
+    {
+        // http backends can't check the server without sending requests, so only the url itself is validated
+        EXPECT_TRUE(AssetProcessor::AssetCacheBackend::Create("https://cache.example.com/assets/")->IsValid());
+        EXPECT_FALSE(AssetProcessor::AssetCacheBackend::Create("http://")->IsValid());
+
+        EXPECT_TRUE(AssetProcessor::AssetCacheBackend::Create(m_tempFolder)->IsValid());
+        EXPECT_FALSE(AssetProcessor::AssetCacheBackend::Create(m_tempFolder + "/does_not_exist")->IsValid());
+        EXPECT_FALSE(AssetProcessor::AssetCacheBackend::Create("")->IsValid());
+    }
+
+    TEST_F(AssetServerHandlerUnitTest, AssetCacheBackend_FolderStoresArchive_ArchiveCanBeFetched)
+    {
+        RemoveMockAssetArchive();
+
+        auto backend = AssetProcessor::AssetCacheBackend::Create(m_tempFolder);
+        const QString key = QString(m_fakeFullname).mid(1) + ".zip";
+        EXPECT_FALSE(backend->Exists(key));
+        EXPECT_TRUE(backend->Fetch(key, {}).isEmpty());
+
+        // the folder backend creates the archive in place
+        QString storePath = backend->GetStorePath(key, {});
+        EXPECT_EQ(QFileInfo(storePath).absoluteFilePath(), QFileInfo(m_fakeSourceFile).absoluteFilePath());
+        CreateMockAssetArchive();
+        EXPECT_TRUE(backend->Store(key, storePath));
+
+        EXPECT_TRUE(backend->Exists(key));
+        EXPECT_EQ(backend->Fetch(key, {}), storePath);
+    }
 }
@@ -181,6 +181,7 @@ void RCcontrollerUnitTests::Reset()
     m_rcController->m_RCQueueSortModel.AttachToModel(&m_rcController->m_RCJobListModel);
     m_rcController->m_RCQueueSortModel.m_currentJobRunKeyToJobEntries.clear();
     m_rcController->m_RCQueueSortModel.m_currentlyConnectedPlatforms.clear();
+    m_rcController->m_RCQueueSortModel.m_expectedJobDurations.clear();
 }
 
 void RCcontrollerUnitTests::ConnectCompileGroupSignalsAndSlots(bool& gotCreated, bool& gotCompleted, NetworkRequestID& gotGroupID, AssetStatus& gotStatus)
@@ -850,3 +851,45 @@ TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithCyclicDependencies_Al
         EXPECT_EQ(m_rcJobListModel->itemCount(), prevJobCount);
     }
 }
+
+TEST_F(RCcontrollerUnitTests, TestRCQueueSortModel_JobsWithSamePriority_LongestExpectedDurationFirst)
+{
+    Reset();
+    m_rcController->SetDispatchPaused(true);
+
+    JobDetails jobDetails;
+    jobDetails.m_scanFolder = &TestScanFolderInfo;
+    jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+    jobDetails.m_jobEntry.m_jobKey = "Text files";
+    jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+
+    // without any durations the jobs are ordered by their path, so the slow job would be the last one to start.
+    jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), "fast.txt");
+    jobDetails.m_jobEntry.m_jobRunKey = 1;
+    m_rcController->OnJobProcessDurationChanged(jobDetails.m_jobEntry, 10);
+    MockRCJob* fastJob = new MockRCJob(m_rcJobListModel);
+    fastJob->Init(jobDetails);
+
+    jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), "neverRan.txt");
+    jobDetails.m_jobEntry.m_jobRunKey = 2;
+    MockRCJob* newJob = new MockRCJob(m_rcJobListModel);
+    newJob->Init(jobDetails);
+
+    jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), "slow.txt");
+    jobDetails.m_jobEntry.m_jobRunKey = 3;
+    m_rcController->OnJobProcessDurationChanged(jobDetails.m_jobEntry, 5000);
+    MockRCJob* slowJob = new MockRCJob(m_rcJobListModel);
+    slowJob->Init(jobDetails);
+
+    for (RCJob* job : { static_cast<RCJob*>(newJob), static_cast<RCJob*>(fastJob), static_cast<RCJob*>(slowJob) })
+    {
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+    }
+
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), slowJob);
+    m_rcJobListModel->markAsProcessing(slowJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), fastJob);
+    m_rcJobListModel->markAsProcessing(fastJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), newJob);
+}
@@ -393,6 +393,7 @@ void ApplicationManagerBase::InitRCController()
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::SourceDeleted, m_rcController, &AssetProcessor::RCController::RemoveJobsBySource);
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::JobComplete, m_rcController, &AssetProcessor::RCController::OnJobComplete);
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AddedToCatalog, m_rcController, &AssetProcessor::RCController::OnAddedToCatalog);
+    QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::JobProcessDurationChanged, m_rcController, &AssetProcessor::RCController::OnJobProcessDurationChanged);
 }
 
 void ApplicationManagerBase::DestroyRCController()
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/AssetCacheBackend.h>
+#include <native/assetprocessor.h>
+
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+namespace AssetProcessor
+{
+    AZStd::unique_ptr<AssetCacheBackend> AssetCacheBackend::Create(const QString& serverAddress)
+    {
+        if (serverAddress.startsWith("http://", Qt::CaseInsensitive) || serverAddress.startsWith("https://", Qt::CaseInsensitive))
+        {
+            return AZStd::make_unique<HttpAssetCacheBackend>(serverAddress);
+        }
+        return AZStd::make_unique<FolderAssetCacheBackend>(QDir::toNativeSeparators(serverAddress));
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    FolderAssetCacheBackend::FolderAssetCacheBackend(const QString& folder)
+        : m_folder(folder)
+    {
+    }
+
+    bool FolderAssetCacheBackend::IsValid() const
+    {
+        return !m_folder.isEmpty() && QDir(m_folder).exists();
+    }
+
+    bool FolderAssetCacheBackend::Exists(const QString& key) const
+    {
+        return QFile::exists(QDir(m_folder).filePath(key));
+    }
+
+    QString FolderAssetCacheBackend::Fetch(const QString& key, [[maybe_unused]] const QString& scratchFilePath) const
+    {
+        // the archive is extracted straight from the folder
+        QString archiveFilePath = QDir(m_folder).filePath(key);
+        return QFile::exists(archiveFilePath) ? archiveFilePath : QString();
+    }
+
+    QString FolderAssetCacheBackend::GetStorePath(const QString& key, [[maybe_unused]] const QString& scratchFilePath) const
+    {
+        // the archive is created straight in the folder
+        QString archiveFilePath = QDir(m_folder).filePath(key);
+        QDir archiveFolder = QFileInfo(archiveFilePath).absoluteDir();
+        if (!archiveFolder.exists() && !archiveFolder.mkpath("."))
+        {
+            AZ_Error(AssetProcessor::DebugChannel, false, "Could not make archive folder %s !", archiveFolder.absolutePath().toUtf8().data());
+            return QString();
+        }
+        return archiveFilePath;
+    }
+
+    bool FolderAssetCacheBackend::Store([[maybe_unused]] const QString& key, [[maybe_unused]] const QString& archiveFilePath) const
+    {
+        return true;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace HttpAssetCacheBackendInternal
+    {
+        static bool IsSuccess(int statusCode)
+        {
+            return statusCode >= 200 && statusCode < 300;
+        }
+
+        //! Sends the request and blocks until it's finished.  Returns the HTTP status code, or 0 if no response was received.
+        //! The access manager lives on the calling thread for the duration of the request, as the backend is used from
+        //! the job threads which don't run an event loop of their own.
+        static int SendRequest(const QUrl& url, const QByteArray& verb, QIODevice* body, QByteArray* responseBody)
+        {
+            QNetworkAccessManager accessManager;
+            QNetworkRequest request(url);
+            request.setTransferTimeout(HttpAssetCacheBackend::RequestTimeoutMs);
+            if (body)
+            {
+                request.setHeader(QNetworkRequest::ContentTypeHeader, "application/zip");
+                request.setHeader(QNetworkRequest::ContentLengthHeader, body->size());
+            }
+
+            QNetworkReply* reply = accessManager.sendCustomRequest(request, verb, body);
+            QEventLoop eventLoop;
+            QObject::connect(reply, &QNetworkReply::finished, &eventLoop, &QEventLoop::quit);
+            if (!reply->isFinished())
+            {
+                eventLoop.exec();
+            }
+
+            int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (reply->error() != QNetworkReply::NoError && statusCode == 0)
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Request %s %s failed: %s\n",
+                    verb.constData(), url.toDisplayString().toUtf8().constData(), reply->errorString().toUtf8().constData());
+            }
+            if (responseBody && IsSuccess(statusCode))
+            {
+                *responseBody = reply->readAll();
+            }
+            delete reply;
+            return statusCode;
+        }
+    } // namespace HttpAssetCacheBackendInternal
+
+    HttpAssetCacheBackend::HttpAssetCacheBackend(const QString& serverAddress)
+        : m_serverUrl(serverAddress.endsWith('/') ? serverAddress.chopped(1) : serverAddress)
+    {
+    }
+
+    bool HttpAssetCacheBackend::IsValid() const
+    {
+        return m_serverUrl.isValid() && !m_serverUrl.host().isEmpty();
+    }
+
+    bool HttpAssetCacheBackend::Exists(const QString& key) const
+    {
+        using namespace HttpAssetCacheBackendInternal;
+        return IsSuccess(SendRequest(GetUrl(key), "HEAD", nullptr, nullptr));
+    }
+
+    QString HttpAssetCacheBackend::Fetch(const QString& key, const QString& scratchFilePath) const
+    {
+        using namespace HttpAssetCacheBackendInternal;
+
+        QByteArray archive;
+        if (!IsSuccess(SendRequest(GetUrl(key), "GET", nullptr, &archive)))
+        {
+            return QString();
+        }
+
+        QFile scratchFile(scratchFilePath);
+        if (!scratchFile.open(QIODevice::WriteOnly | QIODevice::Truncate) || scratchFile.write(archive) != archive.size())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to write the fetched archive to %s", scratchFilePath.toUtf8().constData());
+            return QString();
+        }
+        return scratchFilePath;
+    }
+
+    QString HttpAssetCacheBackend::GetStorePath([[maybe_unused]] const QString& key, const QString& scratchFilePath) const
+    {
+        QDir scratchFolder = QFileInfo(scratchFilePath).absoluteDir();
+        if (!scratchFolder.exists() && !scratchFolder.mkpath("."))
+        {
+            return QString();
+        }
+        QFile::remove(scratchFilePath);
+        return scratchFilePath;
+    }
+
+    bool HttpAssetCacheBackend::Store(const QString& key, const QString& archiveFilePath) const
+    {
+        using namespace HttpAssetCacheBackendInternal;
+
+        QFile archiveFile(archiveFilePath);
+        if (!archiveFile.open(QIODevice::ReadOnly))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Failed to open archive %s to store it", archiveFilePath.toUtf8().constData());
+            return false;
+        }
+        return IsSuccess(SendRequest(GetUrl(key), "PUT", &archiveFile, nullptr));
+    }
+
+    QUrl HttpAssetCacheBackend::GetUrl(const QString& key) const
+    {
+        QString path = QDir::fromNativeSeparators(key);
+        if (!path.startsWith('/'))
+        {
+            path.prepend('/');
+        }
+
+        QUrl url = m_serverUrl;
+        url.setPath(m_serverUrl.path() + path);
+        return url;
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <QString>
+#include <QUrl>
+
+namespace AssetProcessor
+{
+    //! Storage of the archives of the asset cache server.
+    //! Archives are addressed by a key relative to the server address, which is derived from the job fingerprint,
+    //! so it changes whenever the builder, the source file or any of its dependencies change.
+    //! Backends are used from several job threads at once and must not keep per request state.
+    class AssetCacheBackend
+    {
+    public:
+        virtual ~AssetCacheBackend() = default;
+
+        //! Creates the backend for the server address.
+        //! http:// and https:// addresses are accessed through HTTP requests, anything else is treated as a folder,
+        //! for instance on a network share.
+        static AZStd::unique_ptr<AssetCacheBackend> Create(const QString& serverAddress);
+
+        //! Returns true if archives can be stored to and fetched from the server address.
+        virtual bool IsValid() const = 0;
+
+        //! Returns true if an archive is stored with the key.
+        virtual bool Exists(const QString& key) const = 0;
+
+        //! Makes the archive stored with the key available as a local file and returns its path.
+        //! Backends that can't access the archive directly download it to scratchFilePath, which the caller removes.
+        //! Returns an empty string if the archive couldn't be fetched.
+        virtual QString Fetch(const QString& key, const QString& scratchFilePath) const = 0;
+
+        //! Returns the local path to create an archive at, for it to be stored with the key by Store.
+        //! Backends that can't access the archive directly return scratchFilePath, which the caller removes.
+        //! Returns an empty string if no archive can be created for the key.
+        virtual QString GetStorePath(const QString& key, const QString& scratchFilePath) const = 0;
+
+        //! Stores the archive created at the path returned by GetStorePath with the key.
+        virtual bool Store(const QString& key, const QString& archiveFilePath) const = 0;
+    };
+
+    //! Stores the archives in a folder, usually a network share that's mounted on every machine.
+    class FolderAssetCacheBackend final
+        : public AssetCacheBackend
+    {
+    public:
+        explicit FolderAssetCacheBackend(const QString& folder);
+
+        bool IsValid() const override;
+        bool Exists(const QString& key) const override;
+        QString Fetch(const QString& key, const QString& scratchFilePath) const override;
+        QString GetStorePath(const QString& key, const QString& scratchFilePath) const override;
+        bool Store(const QString& key, const QString& archiveFilePath) const override;
+
+    private:
+        QString m_folder;
+    };
+
+    //! Stores the archives on an HTTP server, where the key is appended to the server address to form the url of the
+    //! archive.  Archives are checked with HEAD, fetched with GET and stored with PUT requests, which fits plain
+    //! file servers, caching proxies and object storage such as S3 buckets behind an authenticating gateway.
+    class HttpAssetCacheBackend final
+        : public AssetCacheBackend
+    {
+    public:
+        static constexpr int RequestTimeoutMs = 60 * 1000;
+
+        explicit HttpAssetCacheBackend(const QString& serverAddress);
+
+        bool IsValid() const override;
+        bool Exists(const QString& key) const override;
+        QString Fetch(const QString& key, const QString& scratchFilePath) const override;
+        QString GetStorePath(const QString& key, const QString& scratchFilePath) const override;
+        bool Store(const QString& key, const QString& archiveFilePath) const override;
+
+    private:
+        QUrl GetUrl(const QString& key) const;
+
+        QUrl m_serverUrl;
+    };
+} // namespace AssetProcessor
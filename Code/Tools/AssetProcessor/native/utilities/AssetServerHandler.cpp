@@ -85,23 +85,15 @@ namespace AssetProcessor
         return {};
     }
 
-    QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
+    QString AssetServerHandler::ComputeArchiveKey(const AssetProcessor::BuilderParams& builderParams)
     {
-        QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
-        QString assetServerAddress = QDir::toNativeSeparators(QString{m_serverAddress.c_str()});
-        if (!assetServerAddress.isEmpty())
+        if (!m_serverAddress.empty())
         {
+            // the server key contains the job fingerprint, which covers the builder, the source file and all its dependencies.
+            QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
             QString archiveFileName = builderParams.GetServerKey() + ".zip";
             CleanupFilename(archiveFileName);
-            QDir archiveFolder = QDir(assetServerAddress).filePath(fileInfo.path());
-            QString archiveFilePath = archiveFolder.filePath(archiveFileName);
-
-            // create directories if does not exists
-            if (!archiveFolder.exists())
-            {
-                archiveFolder.mkdir(".");
-            }
-            return archiveFilePath;
+            return QDir(fileInfo.path()).filePath(archiveFileName);
         }
         else
         {
@@ -117,6 +109,12 @@ namespace AssetProcessor
         return QString();
     }
 
+    const AssetCacheBackend& AssetServerHandler::GetBackend() const
+    {
+        static const FolderAssetCacheBackend s_absolutePathBackend{ QString() };
+        return m_backend ? *m_backend : s_absolutePathBackend;
+    }
+
     const char* AssetServerHandler::GetAssetServerModeText(AssetServerMode mode)
     {
         switch (mode)
@@ -145,9 +143,7 @@ namespace AssetProcessor
 
     bool AssetServerHandler::IsServerAddressValid()
     {
-        QString address{m_serverAddress.c_str()};
-        bool isValid = !address.isEmpty() && QDir(address).exists();
-        return isValid;
+        return !m_serverAddress.empty() && m_backend && m_backend->IsValid();
     }
 
     void AssetServerHandler::HandleRemoteConfiguration()
@@ -156,8 +152,8 @@ namespace AssetProcessor
         {
             return;
         }
-        AZ::IO::Path settingsFilePath{ m_serverAddress };
-        settingsFilePath /= "settings.json";
+        const QString settingsKey = "settings.json";
+        const QString scratchSettingsFilePath = QDir::temp().filePath("AssetCacheServer_settings.json");
 
         auto* recognizerConfiguration = AZ::Interface<AssetProcessor::RecognizerConfiguration>::Get();
         if (!recognizerConfiguration)
@@ -177,20 +173,36 @@ namespace AssetProcessor
             }
 
             // save the configuration
+            QString settingsFilePath = m_backend->GetStorePath(settingsKey, scratchSettingsFilePath);
+            if (settingsFilePath.isEmpty())
+            {
+                return;
+            }
             rapidjson::Document recognizerDoc;
             recognizerDoc.Parse(jsonBuffer.c_str());
-            AZ::JsonSerializationUtils::WriteJsonFile(recognizerDoc, settingsFilePath.LexicallyNormal().c_str());
+            auto saveResult = AZ::JsonSerializationUtils::WriteJsonFile(recognizerDoc, settingsFilePath.toUtf8().constData());
+            [[maybe_unused]] bool stored = saveResult.IsSuccess() && m_backend->Store(settingsKey, settingsFilePath);
+            AZ_Warning(AssetProcessor::DebugChannel, stored, "ACS failed to store settings file (%s)", settingsKey.toUtf8().constData());
+            QFile::remove(scratchSettingsFilePath);
         }
         else if (m_assetCachingMode == AssetServerMode::Client)
         {
             // load the configuration
-            if (!AZ::IO::SystemFile::Exists(settingsFilePath.c_str()))
+            if (!m_backend->Exists(settingsKey))
             {
                 // no log since it is okay to not have a settings file
                 return;
             }
 
-            auto result = AZ::JsonSerializationUtils::ReadJsonFile(settingsFilePath.LexicallyNormal().c_str());
+            QString settingsFilePath = m_backend->Fetch(settingsKey, scratchSettingsFilePath);
+            if (settingsFilePath.isEmpty())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "ACS failed to fetch settings file (%s)", settingsKey.toUtf8().constData());
+                return;
+            }
+
+            auto result = AZ::JsonSerializationUtils::ReadJsonFile(settingsFilePath.toUtf8().constData());
+            QFile::remove(scratchSettingsFilePath);
             if (!result.IsSuccess())
             {
                 AZ_Warning(AssetProcessor::DebugChannel, false, "ACS settings file failed with (%s)", result.GetError().c_str());
@@ -201,14 +213,14 @@ namespace AssetProcessor
             rapidjson::Writer<rapidjson::StringBuffer> writer(stringBuffer);
             if (result.GetValue().Accept(writer) == false)
             {
-                AZ_Warning(AssetProcessor::DebugChannel, false, "ACS failed to load settings file (%s)", settingsFilePath.c_str());
+                AZ_Warning(AssetProcessor::DebugChannel, false, "ACS failed to load settings file (%s)", settingsKey.toUtf8().constData());
                 return;
             }
 
             RecognizerContainer recognizerContainer;
             if (!AssetProcessor::PlatformConfiguration::ConvertFromJson(stringBuffer.GetString(), recognizerContainer))
             {
-                AZ_Warning(AssetProcessor::DebugChannel, false, "ACS failed to convert settings file (%s)", settingsFilePath.c_str());
+                AZ_Warning(AssetProcessor::DebugChannel, false, "ACS failed to convert settings file (%s)", settingsKey.toUtf8().constData());
                 return;
             }
 
@@ -235,10 +247,13 @@ namespace AssetProcessor
     bool AssetServerHandler::SetServerAddress(const AZStd::string& address)
     {
         AZStd::string previousServerAddress = m_serverAddress;
+        AZStd::unique_ptr<AssetCacheBackend> previousBackend = AZStd::move(m_backend);
         m_serverAddress = address;
+        m_backend = AssetCacheBackend::Create(QString::fromUtf8(address.c_str()));
         if (!IsServerAddressValid())
         {
             m_serverAddress = previousServerAddress;
+            m_backend = AZStd::move(previousBackend);
             AZ_Error(AssetProcessor::DebugChannel,
                 m_assetCachingMode == AssetServerMode::Inactive,
                 "Server address (%.*s) is invalid! Reverting back to (%.*s)",
@@ -255,14 +270,14 @@ namespace AssetProcessor
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
 
-        QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
-        if (archiveAbsFilePath.isEmpty())
+        QString archiveKey = ComputeArchiveKey(builderParams);
+        if (archiveKey.isEmpty())
         {
             AZ_Error(AssetProcessor::DebugChannel, false, "Extracting archive operation failed. Archive Absolute Path is empty.");
             return false;
         }
 
-        if (!QFile::exists(archiveAbsFilePath))
+        if (!GetBackend().Exists(archiveKey))
         {
             // file does not exist on the server
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. Archive does not exist on server. \n");
@@ -274,6 +289,17 @@ namespace AssetProcessor
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. \n");
             return false;
         }
+
+        // backends that can't extract straight from the server download the archive next to the temp folder, as everything in the
+        // temp folder is considered to be output of the job.
+        QString scratchArchiveFilePath = QString("%1.zip").arg(builderParams.GetTempJobDirectory().c_str());
+        QString archiveAbsFilePath = GetBackend().Fetch(archiveKey, scratchArchiveFilePath);
+        if (archiveAbsFilePath.isEmpty())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive operation canceled. Archive could not be fetched from server. \n");
+            return false;
+        }
+
         AZ_TracePrintf(AssetProcessor::DebugChannel, "Extracting archive for job (%s, %s, %s) with fingerprint (%u).\n",
             builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
             builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
@@ -283,6 +309,10 @@ namespace AssetProcessor
             archiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
         bool success = extractResult.valid() ? extractResult.get() : false;
         AZ_Error(AssetProcessor::DebugChannel, success, "Extracting archive operation failed.\n");
+        if (archiveAbsFilePath == scratchArchiveFilePath)
+        {
+            QFile::remove(scratchArchiveFilePath);
+        }
         return success;
     }
 
@@ -291,15 +321,15 @@ namespace AssetProcessor
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
-        QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
+        QString archiveKey = ComputeArchiveKey(builderParams);
 
-        if (archiveAbsFilePath.isEmpty())
+        if (archiveKey.isEmpty())
         {
             AZ_Error(AssetProcessor::DebugChannel, false, "Creating archive operation failed. Archive Absolute Path is empty. \n");
             return false;
         }
 
-        if (QFile::exists(archiveAbsFilePath))
+        if (GetBackend().Exists(archiveKey))
         {
             // file already exists on the server
             AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive operation canceled. An archive of this asset already exists on server. \n");
@@ -312,16 +342,13 @@ namespace AssetProcessor
             return false;
         }
 
-        // make sub-folders if needed
-        QFileInfo fileInfo(archiveAbsFilePath);
-        if (!fileInfo.absoluteDir().exists())
+        // backends that can't create the archive straight on the server create it next to the temp folder, so it doesn't
+        // end up in the archive itself.
+        QString scratchArchiveFilePath = QString("%1.zip").arg(builderParams.GetTempJobDirectory().c_str());
+        QString archiveAbsFilePath = GetBackend().GetStorePath(archiveKey, scratchArchiveFilePath);
+        if (archiveAbsFilePath.isEmpty())
         {
-            if (!fileInfo.absoluteDir().mkpath("."))
-            {
-                AZ_Error(AssetProcessor::DebugChannel, false, "Could not make archive folder %s !",
-                    fileInfo.absoluteDir().absolutePath().toUtf8().data());
-                return false;
-            }
+            return false;
         }
 
         AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive for job (%s, %s, %s) with fingerprint (%u).\n",
@@ -341,6 +368,16 @@ namespace AssetProcessor
             // If so add it to the archive
             AddSourceFilesToArchive(builderParams, archiveAbsFilePath, sourceFileList);
         }
+
+        if (success)
+        {
+            success = GetBackend().Store(archiveKey, archiveAbsFilePath);
+            AZ_Error(AssetProcessor::DebugChannel, success, "Storing archive operation failed. \n");
+        }
+        if (archiveAbsFilePath == scratchArchiveFilePath)
+        {
+            QFile::remove(scratchArchiveFilePath);
+        }
         return success;
     }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <native/utilities/AssetUtilEBusHelper.h>
+#include <native/utilities/AssetCacheBackend.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
 namespace AssetProcessor
@@ -16,7 +17,7 @@ namespace AssetProcessor
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
 
-    //! AssetServerHandler is implementing asset server using network share.
+    //! AssetServerHandler is implementing asset server using network share or an HTTP server, depending on the server address.
     class AssetServerHandler
         : public AssetServerBus::Handler
     {
@@ -48,10 +49,15 @@ namespace AssetProcessor
         //! Source files intended to be copied into the cache don't go through out temp folder so they need
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
-        QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
-        
+        //! Returns the key the archive of the job is stored with in the backend.
+        QString ComputeArchiveKey(const AssetProcessor::BuilderParams& builderParams);
+        //! Returns the backend for the server address.  When no server address is set, archive paths come from the
+        //! AssetServerInfoBus as absolute paths, which are accessed as files.
+        const AssetCacheBackend& GetBackend() const;
+
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        AZStd::unique_ptr<AssetCacheBackend> m_backend;
     };
 } //namespace AssetProcessor
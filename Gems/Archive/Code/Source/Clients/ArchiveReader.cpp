@@ -557,35 +557,6 @@ namespace Archive
         AZStd::vector<AZStd::byte> compressedBlocks;
         compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
         AZStd::span<AZStd::byte> compressedBlockRemainingSpan = compressedBlocks;
-
-        AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
-        for (AZ::u64 blockIndex = blockRange.first; blockIndex != blockRange.second; ++blockIndex)
-        {
-            const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-            // Get the next 2 MiB block (or less if in the final block) of memory to store the compressed block data
-            const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                ArchiveBlockSizeForCompression);
-            const AZStd::span<AZStd::byte> compressedBlockToReadInto = compressedBlockRemainingSpan.first(
-                availableBytesInCompressedBlock);
-            // Slide the compressed block remaining span view ahead by the 2 MiB that is being used for the read span
-            compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
-            const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
-            if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(blockCompressedSize,
-                compressedBlockToReadInto.data(), absoluteSeekOffset);
-                bytesRead != blockCompressedSize)
-            {
-                return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
-                    " block %llu. The compressed block size is %llu, but only %llu was able to be read",
-                    blockIndex, blockCompressedSize, bytesRead));
-            }
-
-            // As the read was successful add the aligned compressed size to the fileRelativeSeekOffset
-            // The value is the read offset where the next block data starts
-            fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
-        }
-
-        // Reset the compressed block remaining to the start of the compressedBlocks vector
-        compressedBlockRemainingSpan = compressedBlocks;
         // The span below is used to slide a 2 MiB window for storing decompressed file contents
         AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
 
@@ -600,32 +571,89 @@ namespace Archive
         const AZ::u32 maxDecompressTasks = AZStd::min(
             AZStd::max(1U, m_settings.m_maxDecompressTasks),
             static_cast<AZ::u32>(blockRange.second - blockRange.first));
-        AZStd::vector<Compression::DecompressionResultData> decompressedBlockResults(maxDecompressTasks);
+        // Every block has its own result, as the next batch of blocks is already decompressing
+        // while the results of the previous batch are validated
+        AZStd::vector<Compression::DecompressionResultData> decompressedBlockResults(blockRange.second - blockRange.first);
+
+        // The blocks are read and decompressed in batches of up to maxDecompressTasks blocks.
+        // The decompression of a batch runs on the task executor while the compressed data of the next batch is read,
+        // so that reading from the archive overlaps with decompression instead of waiting for it
+        AZStd::unique_ptr<AZ::TaskGraphEvent> pendingDecompressGraphEvent;
+        AZ::u64 pendingBatchBegin{};
+        AZ::u64 pendingBatchEnd{};
+        auto waitForPendingBatch = [&]() -> ResultOutcome
+        {
+            if (pendingDecompressGraphEvent == nullptr)
+            {
+                return {};
+            }
+
+            // Sync on the task completion
+            pendingDecompressGraphEvent->Wait();
+            pendingDecompressGraphEvent.reset();
 
-        for (AZ::u64 blockIndex = blockRange.first; blockIndex < blockRange.second;)
+            // Validate the decompression for all blocks
+            for (AZ::u64 blockIndex = pendingBatchBegin; blockIndex != pendingBatchEnd; ++blockIndex)
+            {
+                auto& decompressedBlockResult = decompressedBlockResults[blockIndex - blockRange.first];
+                if (!decompressedBlockResult)
+                {
+                    // If one of the decompression task fails, early return with the error message
+                    return AZStd::unexpected(AZStd::move(decompressedBlockResult.m_decompressionOutcome.m_resultString));
+                }
+            }
+            return {};
+        };
+
+        // Stores the compressed size of each block in the current batch
+        AZStd::vector<AZ::u64> batchCompressedSizes(maxDecompressTasks);
+
+        AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
+        for (AZ::u64 batchBegin = blockRange.first; batchBegin < blockRange.second;)
         {
             // Determine the number of decompression task that can be run in parallel
-            const AZ::u32 decompressTaskCount = AZStd::min(static_cast<AZ::u32>(blockRange.second - blockIndex),
-                maxDecompressTasks);
+            const AZ::u64 batchEnd = AZStd::min<AZ::u64>(blockRange.second, batchBegin + maxDecompressTasks);
+
+            // The compressed blocks of a batch are stored back to back in the archive, each starting on an
+            // ArchiveDefaultBlockAlignment boundary, so the entire batch is read with a single request.
+            // The padding after the final block isn't read, as that block could be at the end of the archive
+            AZ::IO::SizeType batchReadSize{};
+            for (AZ::u64 blockIndex = batchBegin; blockIndex != batchEnd; ++blockIndex)
+            {
+                const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
+                batchCompressedSizes[blockIndex - batchBegin] = blockCompressedSize;
+                batchReadSize = AZ_SIZE_ALIGN_UP(batchReadSize, ArchiveDefaultBlockAlignment) + blockCompressedSize;
+            }
+
+            // Every compressed block is at most 2 MiB, so the batch always fits in the remaining compressed block memory
+            const AZStd::span<AZStd::byte> batchReadSpan = compressedBlockRemainingSpan.first(batchReadSize);
+            compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(batchReadSize);
+            const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
+            if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(batchReadSize, batchReadSpan.data(), absoluteSeekOffset);
+                bytesRead != batchReadSize)
+            {
+                // The tasks of the previous batch refer to the buffers of this function, so they need to finish first
+                [[maybe_unused]] auto pendingBatchOutcome = waitForPendingBatch();
+                return AZStd::unexpected(ResultString::format("Cannot read all of compressed blocks %llu to %llu."
+                    " The compressed size of the blocks is %llu, but only %llu was able to be read",
+                    batchBegin, batchEnd - 1, batchReadSize, bytesRead));
+            }
+
+            // As the read was successful add the aligned compressed size to the fileRelativeSeekOffset
+            // The value is the read offset where the next block data starts
+            fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(batchReadSize, ArchiveDefaultBlockAlignment);
 
-            // Task graph event used to block decompressing blocks in parallel
-            auto taskDecompressGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Content File Decompress Sync");
             AZ::TaskGraph taskGraph{ "Archive Decompress Tasks" };
             AZ::TaskDescriptor decompressTaskDescriptor{ "Decompress Block", "Archive Content File Decompression" };
 
-            // Increment the block index as part of the inner loop that creates the decompression task
-            for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot,
-                ++blockIndex)
+            AZ::IO::SizeType blockOffsetInBatch{};
+            for (AZ::u64 blockIndex = batchBegin; blockIndex != batchEnd; ++blockIndex)
             {
-                const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-                // Downsize the 2 MiB span that was used to read the compressed data to the exact compressed size
-                const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                    ArchiveBlockSizeForCompression);
-                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockRemainingSpan
-                    .first(availableBytesInCompressedBlock)
-                    .first(blockCompressedSize);
-                // Slide the compressed block remaining span by 2 MiB
-                compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
+                // Get the view of the compressed data for the block within the batch read
+                const AZ::u64 blockCompressedSize = batchCompressedSizes[blockIndex - batchBegin];
+                AZStd::span<const AZStd::byte> compressedDataForBlock = AZStd::span<const AZStd::byte>(batchReadSpan)
+                    .subspan(blockOffsetInBatch, blockCompressedSize);
+                blockOffsetInBatch += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
 
                 // Get the block span for storing the decompressed block
                 // As the uncompressed size is 2 MiB for all blocks except the last
@@ -639,7 +667,7 @@ namespace Archive
 
                 //! Decompress Task to execute in task executor
                 auto decompressTask = [decompressionInterface, &decompressionOptions, decompressionBlockSpan, compressedDataForBlock,
-                    &decompressedBlockResult = decompressedBlockResults[decompressTaskSlot]]()
+                    &decompressedBlockResult = decompressedBlockResults[blockIndex - blockRange.first]]()
                 {
                     // Decompressed the compressed block
                     decompressedBlockResult = decompressionInterface->DecompressBlock(
@@ -649,20 +677,24 @@ namespace Archive
                 taskGraph.AddTask(decompressTaskDescriptor, AZStd::move(decompressTask));
             }
 
-            taskGraph.SubmitOnExecutor(m_taskExecutor, taskDecompressGraphEvent.get());
-            // Sync on the task completion
-            taskDecompressGraphEvent->Wait();
-
-            // Validate the decompression for all blocks
-            for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot)
+            // Only one batch is decompressed at a time, so that at most maxDecompressTasks task run in parallel
+            if (auto pendingBatchOutcome = waitForPendingBatch(); !pendingBatchOutcome)
             {
-                const auto& decompressedBlockResult = decompressedBlockResults[decompressTaskSlot];
-                if (!decompressedBlockResult)
-                {
-                    // If one of the decompression task fails, early return with the error message
-                    return AZStd::unexpected(AZStd::move(decompressedBlockResult.m_decompressionOutcome.m_resultString));
-                }
+                return AZStd::unexpected(AZStd::move(pendingBatchOutcome.error()));
             }
+
+            // Task graph event used to block on decompressing the blocks in parallel
+            pendingDecompressGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Content File Decompress Sync");
+            taskGraph.SubmitOnExecutor(m_taskExecutor, pendingDecompressGraphEvent.get());
+            pendingBatchBegin = batchBegin;
+            pendingBatchEnd = batchEnd;
+
+            batchBegin = batchEnd;
+        }
+
+        if (auto pendingBatchOutcome = waitForPendingBatch(); !pendingBatchOutcome)
+        {
+            return AZStd::unexpected(AZStd::move(pendingBatchOutcome.error()));
         }
 
         // Return a subspan that accounts for the start offset within the compressed file to start
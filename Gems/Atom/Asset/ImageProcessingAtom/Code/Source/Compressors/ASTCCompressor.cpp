@@ -224,8 +224,9 @@ namespace ImageProcessingAtom
                 {
                     completionJob = aznew AZ::JobCompletion();
                 }
-                // Create jobs for each compression thread
-                for (AZ::u32 threadIdx = 0; threadIdx < threadCount; threadIdx++)
+                // Create jobs for each compression thread, the thread index 0 is compressed by this thread.
+                // astcenc expects every thread index to be used by exactly one thread.
+                for (AZ::u32 threadIdx = 1; threadIdx < threadCount; threadIdx++)
                 {
                     const auto jobLambda = [&status, context, &image, &swizzle, dstMem, dataSize, threadIdx]()
                     {
@@ -249,12 +250,12 @@ namespace ImageProcessingAtom
                         simulationJob->SetDependent(completionJob);
                         simulationJob->Start();
                     }
+                }
 
-                    astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
-                    if (error != ASTCENC_SUCCESS)
-                    {
-                        status = error;
-                    }
+                astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, 0);
+                if (error != ASTCENC_SUCCESS)
+                {
+                    status = error;
                 }
                 
                 if (currentJob)
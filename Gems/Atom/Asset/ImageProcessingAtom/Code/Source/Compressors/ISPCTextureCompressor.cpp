@@ -7,6 +7,10 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
@@ -182,66 +186,132 @@ namespace ImageProcessingAtom
             }
         }
 
+        // Only the listed formats are compressed by ISPC, all of them use 16 bytes per 4x4 block
+        if (destinationFormat != ePixelFormat_BC3 && destinationFormat != ePixelFormat_BC6UH &&
+            destinationFormat != ePixelFormat_BC7 && destinationFormat != ePixelFormat_BC7t)
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+
+        // Get the profile settings, they are shared by all the tiles
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        if (destinationFormat == ePixelFormat_BC6UH)
+        {
+            compressionProfile->GetBC6()(&bc6Settings);
+        }
+        else if (destinationFormat != ePixelFormat_BC3)
+        {
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
+        }
+
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        // Split every mip in tiles of whole block rows. The blocks are compressed independently,
+        // so big images are compressed by several jobs instead of a single one.
+        struct CompressionTile
+        {
+            rgba_surface m_sourceSurface;
+            AZ::u8* m_destinationData;
+        };
+        constexpr uint32_t BlockSize = 4;
+        constexpr uint32_t BytesPerBlock = 16;
+        constexpr uint32_t BlockRowsPerTile = 64;
+        AZStd::vector<CompressionTile> tiles;
+
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
             uint32 sourcePitch = 0;
             AZ::u8* sourceImageData = nullptr;
             sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
+            const uint32_t width = sourceImage->GetWidth(mip);
+            const uint32_t height = sourceImage->GetHeight(mip);
 
-            // Get the mip image destination pointer
             uint32_t destinationPitch = 0;
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
+            // ISPC writes the blocks of a surface tightly packed, one row of width / 4 blocks after the other
+            const uint32_t blockRowBytes = (width / BlockSize) * BytesPerBlock;
+            const uint32_t blockRowCount = height / BlockSize;
+            for (uint32_t blockRow = 0; blockRow < AZStd::max(blockRowCount, 1u); blockRow += BlockRowsPerTile)
+            {
+                CompressionTile& tile = tiles.emplace_back();
+                tile.m_sourceSurface.ptr = sourceImageData + static_cast<size_t>(blockRow) * BlockSize * sourcePitch;
+                tile.m_sourceSurface.width = static_cast<int32_t>(width);
+                tile.m_sourceSurface.height = blockRowCount == 0 ? static_cast<int32_t>(height)
+                    : static_cast<int32_t>(AZStd::min(BlockRowsPerTile, blockRowCount - blockRow) * BlockSize);
+                tile.m_sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                tile.m_destinationData = destinationImageData + static_cast<size_t>(blockRow) * blockRowBytes;
+            }
+        }
+
+        auto compressTile = [destinationFormat, &bc6Settings, &bc7Settings](CompressionTile& tile)
+        {
             // Compress with the correct function, depending on the destination format
             switch (destinationFormat)
             {
             case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
+                CompressBlocksBC3(&tile.m_sourceSurface, tile.m_destinationData);
                 break;
             case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
                 // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
+                CompressBlocksBC6H(&tile.m_sourceSurface, tile.m_destinationData, &bc6Settings);
+                break;
+            default:
+                // Compress with BC7
+                CompressBlocksBC7(&tile.m_sourceSurface, tile.m_destinationData, &bc7Settings);
+                break;
             }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
+        };
 
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (tiles.size() == 1 || !jobContext)
+        {
+            for (CompressionTile& tile : tiles)
+            {
+                compressTile(tile);
             }
-            break;
-            default:
+        }
+        else
+        {
+            // Adds the jobs as children of the current job if there is one, like the ASTC compressor
+            AZ::Job* currentJob = jobContext->GetJobManager().GetCurrentJob();
+            AZ::JobCompletion* completionJob = currentJob ? nullptr : aznew AZ::JobCompletion();
+            for (size_t tileIndex = 1; tileIndex < tiles.size(); ++tileIndex)
             {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
+                CompressionTile* tile = &tiles[tileIndex];
+                AZ::Job* tileJob = AZ::CreateJobFunction([&compressTile, tile]()
+                {
+                    compressTile(*tile);
+                }, true, nullptr);  //auto-deletes
+
+                if (currentJob)
+                {
+                    currentJob->StartAsChild(tileJob);
+                }
+                else
+                {
+                    tileJob->SetDependent(completionJob);
+                    tileJob->Start();
+                }
             }
-            break;
+
+            // Compress the first tile on this thread while the jobs run
+            compressTile(tiles.front());
+
+            if (currentJob)
+            {
+                currentJob->WaitForChildren();
+            }
+            else
+            {
+                completionJob->StartAndWaitForCompletion();
+                delete completionJob;
             }
         }
 
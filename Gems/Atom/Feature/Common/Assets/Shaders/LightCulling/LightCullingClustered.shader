@@ -0,0 +1,17 @@
+{
+    "Source": "LightCulling.azsl",
+
+    "Definitions": ["LIGHT_CULLING_CLUSTERED=1"],
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name": "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
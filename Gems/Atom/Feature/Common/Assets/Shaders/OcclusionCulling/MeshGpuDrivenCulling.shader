@@ -0,0 +1,15 @@
+{
+    "Source": "MeshGpuDrivenCulling.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -0,0 +1,15 @@
+{
+    "Source": "MeshOcclusionCulling.azsl",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -135,6 +135,8 @@ set(FILES
     Passes/KawaseShadowBlur.pass
     Passes/LightAdaptationParent.pass
     Passes/LightCulling.pass
+    Passes/LightCullingClustered.pass
+    Passes/LightCullingClusteredParent.pass
     Passes/LightCullingHeatmap.pass
     Passes/LightCullingParent.pass
     Passes/LightCullingRemap.pass
@@ -365,6 +367,7 @@ set(FILES
     Shaders/ImGui/ImGui.shader
     Shaders/LightCulling/LightCulling.azsl
     Shaders/LightCulling/LightCulling.shader
+    Shaders/LightCulling/LightCullingClustered.shader
     Shaders/LightCulling/LightCullingHeatmap.azsl
     Shaders/LightCulling/LightCullingHeatmap.shader
     Shaders/LightCulling/LightCullingRemap.azsl
@@ -610,6 +613,8 @@ set(FILES
     Shaders/Shadow/FullscreenShadow.shader
     Shaders/Shadow/KawaseShadowBlur.azsl
     Shaders/Shadow/KawaseShadowBlur.shader
+    Shaders/Shadow/RestoreShadow.shader
+    Shaders/Shadow/RestoreShadowmap.azsl
     Shaders/Shadow/Shadowmap.azsl
     Shaders/Shadow/Shadowmap.shader
     Shaders/SkinnedMesh/LinearSkinningCS.azsl
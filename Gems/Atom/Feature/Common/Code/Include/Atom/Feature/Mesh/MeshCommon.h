@@ -24,6 +24,9 @@ namespace AZ::Render::MeshCommon
 
     inline static AZ::Name MeshMovedName = AZ::Name::FromStringLiteral("MeshMoved", AZ::Interface<AZ::NameDictionary>::Get());
 
+    // Set on the cullables of meshes that are always dynamic, so views can include or exclude them with RPI::View::SetCullableFlagFilter()
+    inline static AZ::Name MeshAlwaysDynamicName = AZ::Name::FromStringLiteral("MeshAlwaysDynamic", AZ::Interface<AZ::NameDictionary>::Get());
+
     // The DrawListTag name for drawing to MeshMotionVector pass
     inline static AZ::Name MotionDrawListTagName = AZ::Name::FromStringLiteral("motion", AZ::Interface<AZ::NameDictionary>::Get());
 
@@ -20,6 +20,9 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/Console.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
+#include <Mesh/BindlessMaterialDataBuffer.h>
+#include <Mesh/BindlessMaterialStreamingFeedback.h>
+#include <Mesh/MeshGpuDrivenInstancing.h>
 #include <Mesh/MeshInstanceManager.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
 
@@ -55,6 +58,10 @@ namespace AZ
                 InstanceGroupHandle m_instanceGroupHandle;
                 uint32_t m_instanceGroupPageIndex;
                 TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
+                //! The slot of the material in the BindlessMaterialDataBuffer, if the mesh uses the bindless material path
+                uint32_t m_bindlessMaterialSlot = BindlessMaterialDataBuffer::InvalidIndex;
+                //! The entry of the mesh in the persistent instance buffer of MeshGpuDrivenInstancing, if it is enabled
+                uint32_t m_gpuDrivenInstanceSlot = MeshGpuDrivenInstancing::InvalidSlot;
             };
 
             using PostCullingInstanceDataList = AZStd::vector<PostCullingInstanceData>;
@@ -119,7 +126,8 @@ namespace AZ
             RPI::Cullable::LodConfiguration GetMeshLodConfiguration() const;
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
-            void UpdateCullBounds(const MeshFeatureProcessor* meshFeatureProcessor);
+            void UpdateCullBounds(MeshFeatureProcessor* meshFeatureProcessor);
+            void UpdateGpuDrivenInstances(MeshFeatureProcessor* meshFeatureProcessor);
             void UpdateObjectSrg(MeshFeatureProcessor* meshFeatureProcessor);
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
@@ -272,6 +280,20 @@ namespace AZ
 
             MeshInstanceManager& GetMeshInstanceManager();
             bool IsMeshInstancingEnabled() const;
+
+            BindlessMaterialDataBuffer& GetBindlessMaterialData();
+            bool IsBindlessMaterialsEnabled() const;
+
+            //! The mip feedback of the textures of the bindless material path, copied by the BindlessMaterialStreamingFeedbackPass
+            BindlessMaterialStreamingFeedback& GetBindlessMaterialStreamingFeedback();
+
+            MeshGpuDrivenInstancing& GetGpuDrivenInstancing();
+            //! Returns true if the instanced meshes are added to the persistent instance buffer of MeshGpuDrivenInstancing
+            bool IsGpuDrivenInstancingEnabled() const;
+
+            //! Calls the provided function with the cullable of every mesh that has been registered with the culling scene.
+            //! Used by passes that compute visibility on the GPU and feed the results back into culling.
+            void ForEachCullable(const AZStd::function<void(RPI::Cullable&)>& callback);
         private:
             MeshFeatureProcessor(const MeshFeatureProcessor&) = delete;
 
@@ -300,6 +322,8 @@ namespace AZ
             void SortInstanceBufferBuckets(TaskGraph& sortInstanceBufferBucketsTG, size_t viewIndex);
             void BuildInstanceBufferAndDrawCalls(TaskGraph& taskGraph, size_t viewIndex, const RPI::ViewPtr& view);
             void UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view);
+            void AddGpuDrivenDrawPacketsToView(
+                size_t viewIndex, const RPI::ViewPtr& view, const RHI::IndirectBufferView& indirectBufferView, uint32_t cpuInstanceCount);
 
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
@@ -313,6 +337,7 @@ namespace AZ
                 ModelDataInstance::InstanceGroupHandle m_instanceGroupHandle;
                 float m_depth = 0.0f;
                 TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
+                uint32_t m_bindlessMaterialSlot = BindlessMaterialDataBuffer::InvalidIndex;
 
                 bool operator<(const SortInstanceData& rhs) const
                 {
@@ -347,6 +372,18 @@ namespace AZ
             AZStd::vector<AZStd::vector<InstanceGroupBucket>> m_perViewInstanceGroupBuckets;
             AZStd::vector<AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>> m_perViewInstanceData;
             AZStd::vector<GpuBufferHandler> m_perViewInstanceDataBufferHandlers;
+            // The bindless material slot of each instance, in the same order as m_perViewInstanceData
+            AZStd::vector<AZStd::vector<uint32_t>> m_perViewInstanceMaterialData;
+            AZStd::vector<GpuBufferHandler> m_perViewInstanceMaterialDataBufferHandlers;
+
+            BindlessMaterialDataBuffer m_bindlessMaterialData;
+            BindlessMaterialStreamingFeedback m_bindlessMaterialStreamingFeedback;
+            RPI::Scene::PrepareSceneSrgEvent::Handler m_updateSceneSrgHandler;
+
+            MeshGpuDrivenInstancing m_gpuDrivenInstancing;
+            // True for each view whose GPU driven instance groups are culled and drawn on the GPU this frame
+            AZStd::vector<bool> m_perViewGpuDriven;
+            RHI::ShaderInputNameIndex m_viewInstanceDataIndex = "m_instanceData";
             
             TransformServiceFeatureProcessor* m_transformService = nullptr;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
@@ -355,6 +392,7 @@ namespace AZ
             RPI::MeshDrawPacketLods m_emptyDrawPacketLods;
             RHI::Ptr<FlagRegistry> m_flagRegistry = nullptr;
             AZ::RHI::Handle<uint32_t> m_meshMovedFlag;
+            AZ::RHI::Handle<uint32_t> m_meshAlwaysDynamicFlag;
             RHI::DrawListTag m_meshMotionDrawListTag;
             RHI::DrawListTag m_transparentDrawListTag;
             bool m_forceRebuildDrawPackets = false;
@@ -362,6 +400,8 @@ namespace AZ
             bool m_enablePerMeshShaderOptionFlags = false;
             bool m_enableMeshInstancing = false;
             bool m_enableMeshInstancingForTransparentObjects = false;
+            bool m_enableBindlessMaterials = false;
+            bool m_enableGpuDrivenInstancing = false;
         };
     } // namespace Render
 } // namespace AZ
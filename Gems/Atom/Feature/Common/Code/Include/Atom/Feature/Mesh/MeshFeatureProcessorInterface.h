@@ -49,6 +49,24 @@ namespace AZ
             "Enable instanced draw calls for transparent objects in the MeshFeatureProcessor. Use this only if you have many instances of the same "
             "transparent object, but don't have multiple different transparent objects mixed together. See documentation for details.");
 
+        AZ_CVAR(
+            bool,
+            r_meshBindlessMaterials,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "When mesh instancing is enabled, read the material textures through bindless indices for materials whose shaders support "
+            "o_meshBindlessMaterial, so meshes with materials that only differ by their textures are merged into the same draw call.");
+
+        AZ_CVAR(
+            bool,
+            r_meshGpuDrivenInstancing,
+            false,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "When mesh instancing is enabled, cull the opaque instanced meshes on the GPU and draw each instance group with a single indirect "
+            "draw in the views of render pipelines that have a MeshGpuDrivenCullingPass. Not supported together with r_meshBindlessMaterials.");
+
         AZ_CVAR(
             size_t,
             r_meshInstancingBucketSortScatterBatchSize,
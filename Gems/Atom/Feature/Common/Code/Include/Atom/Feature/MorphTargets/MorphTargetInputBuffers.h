@@ -17,6 +17,7 @@
 
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -34,22 +35,28 @@ namespace AZ
     
     namespace Render
     {
-        //! The input to the morph target pass, including the delta values for a fully morphed pose
-        //! and the index of the target vertex that is going to be modified
+        //! The input to the morph target pass for all the morph targets of a skinned mesh lod, including the delta values for a
+        //! fully morphed pose and the index of the target vertex that is going to be modified
         //! The morph target pass will read these values, apply a weight, and write the accumulated deltas
         //! to an intermediate buffer that will be consumed by the skinning pass
+        //!
+        //! The deltas of each morph target are sorted by vertex and grouped into blocks of up to s_deltaBlockSize deltas that modify
+        //! vertices within s_deltaBlockVertexSpan of each other. Each delta is four 32-bit words, the compressed position, normal,
+        //! tangent and bitangent deltas of PackedCompressedMorphTargetDelta, with the vertex offset from the start of the block in
+        //! the 8 bits the bitangent doesn't use. Each block is two 32-bit words, the index of its first delta with the delta count
+        //! minus one in the upper bits, and the index of the vertex the block starts at.
         class MorphTargetInputBuffers
             : public AZStd::intrusive_base
         {
         public:
             AZ_CLASS_ALLOCATOR(MorphTargetInputBuffers, AZ::SystemAllocator);
-            MorphTargetInputBuffers(const RPI::BufferAssetView& bufferAssetView, const AZStd::string& bufferNamePrefix);
+            MorphTargetInputBuffers(AZStd::span<const uint32_t> deltas, AZStd::span<const uint32_t> blocks, const AZStd::string& bufferNamePrefix);
 
-            //! Set the buffer views and vertex count on the given SRG
+            //! Set the delta and block buffer views on the given SRG
             void SetBufferViewsOnShaderResourceGroup(const Data::Instance<RPI::ShaderResourceGroup>& perInstanceSRG);
         private:
-            RHI::Ptr<RHI::BufferView> m_vertexDeltaBufferView;
             Data::Instance<RPI::Buffer> m_vertexDeltaBuffer;
+            Data::Instance<RPI::Buffer> m_deltaBlockBuffer;
         };
 
         struct MorphTargetComputeMetaData
@@ -59,6 +66,9 @@ namespace AZ
             float m_minDelta;
             float m_maxDelta;
             uint32_t m_vertexCount;
+            // The blocks of deltas of the morph target in the MorphTargetInputBuffers of the lod
+            uint32_t m_blockOffset;
+            uint32_t m_blockCount;
             // Each morph target dispatch is associated with a single mesh. We need to keep track of which mesh
             // so that we can calculate the maximum range a given mesh might be morphed if all of the morph targets
             // associated with it were active at once.
@@ -72,6 +82,17 @@ namespace AZ
             // Position, normal, tangent, and bitangent is output for each morph
             static constexpr uint32_t s_morphTargetDeltaTypeCount = 4;
             static constexpr uint32_t s_invalidDeltaOffset = std::numeric_limits<uint32_t>::max();
+            // The maximum number of deltas in a block, which must match the thread group size of the morph target shader
+            static constexpr uint32_t s_deltaBlockSize = 64;
+            // The deltas in a block modify vertices within this many vertices of the first vertex of the block
+            static constexpr uint32_t s_deltaBlockVertexSpan = 256;
+            // Each delta is packed into four 32-bit words
+            static constexpr uint32_t s_packedDeltaSizeInWords = 4;
+            // Each block is packed into two 32-bit words
+            static constexpr uint32_t s_packedDeltaBlockSizeInWords = 2;
+            // The delta count is stored in the upper bits of the first word of a block, the index of the first delta in the rest
+            static constexpr uint32_t s_deltaBlockCountShift = 26;
+            static constexpr uint32_t s_deltaBlockFirstDeltaMask = (1u << s_deltaBlockCountShift) - 1;
         }
 
         //! Unlike MorphTargetMetaData which is the same for every instance of a given skinned mesh,
@@ -81,6 +81,8 @@ namespace AZ::Render
         //! See MeshCommon::MeshMovedName for the name of the flag used to track movement
         //! See RPI::Scene::GetViewTagBitRegistry() for where the flag bits are determined
         //! See RPI::View::GetOrFlags() for how the bits are retrieved
+        //! Casters that are always dynamic (see MeshCommon::MeshAlwaysDynamicName) aren't part of the cached shadow. They are drawn
+        //! every frame on top of a copy of the cached shadow, so they don't cause the rest of the casters to render again.
         virtual void SetUseCachedShadows(ShadowId id, bool useCachedShadows) = 0;
         //! Sets all of the shadow properties in one call
         virtual void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) = 0;
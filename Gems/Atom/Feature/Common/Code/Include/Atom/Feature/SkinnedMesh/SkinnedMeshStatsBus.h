@@ -21,6 +21,18 @@ namespace AZ
             size_t dispatchItemCount = 0;
             size_t boneCount = 0;
             size_t vertexCount = 0;
+
+            // The skinning work of the last frame, after the update rate throttling and the vertex budget
+            size_t skinnedRenderProxyCount = 0;
+            size_t skinnedVertexCount = 0;
+            //! Render proxies that were skipped because they are updated at a reduced rate
+            size_t throttledRenderProxyCount = 0;
+            //! Render proxies that were due for an update, but were deferred to stay within the vertex budget
+            size_t budgetDeferredRenderProxyCount = 0;
+            //! Render proxies whose morph targets were skipped because they are too small on screen
+            size_t skippedMorphTargetRenderProxyCount = 0;
+            //! The maximum number of vertices that are skinned per frame, or 0 if there's no budget
+            size_t vertexBudget = 0;
         };
 
         //! Ebus for getting stats about the usage of skinned meshes in the current scene
@@ -51,6 +51,9 @@ namespace AZ
             AZ::Transform GetTransformForId(ObjectId id) const override;
             AZ::Vector3 GetNonUniformScaleForId(ObjectId id) const override;
 
+            //! The number of bytes that were uploaded to the transform buffers in the last OnBeginPrepareRender
+            uint64_t GetUploadedByteCount() const;
+
         private:
 
             // Holds both regular 4x3 transforms and 3x3 normal transforms with padding at the end of each float3.
@@ -67,7 +70,13 @@ namespace AZ
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if any buffer was created or resized, in which case all of the buffers need a full upload
+            bool PrepareBuffers();
+
+            // Uploads the entries of the sorted, unique indices to the buffer, merging indices that are close to each other into a
+            // single upload. Does a full upload when there are too many ranges. Returns the number of bytes uploaded.
+            static uint64_t UploadIndices(
+                RPI::Buffer& buffer, const AZStd::vector<Float4x3>& values, size_t valueSize, const AZStd::vector<uint32_t>& indices, bool fullUpload);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -92,8 +101,17 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
 
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
+
+            // The indices that were set since the last upload, which may contain duplicates until they are uploaded
+            AZStd::vector<uint32_t> m_dirtyIndices;
+            // The indices that were uploaded to the transform buffers last frame, and still need to be uploaded to the history buffer
+            AZStd::vector<uint32_t> m_historyDirtyIndices;
             bool m_deviceBufferNeedsUpdate = false;
             bool m_historyBufferNeedsUpdate = false;
+            // Set when the transform buffers need to be uploaded in full, rather than only the dirty indices
+            bool m_deviceBufferNeedsFullUpdate = false;
+            bool m_historyBufferNeedsFullUpdate = false;
+            uint64_t m_uploadedByteCount = 0;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
@@ -228,6 +228,7 @@ namespace AZ
 
             AZStd::vector<AZ::Matrix4x4> m_viewProjOverrides;
             int32_t                      m_2DViewProjOverrideIndex = -1;
+            uint32_t                     m_fixedShapeCount = 0;                     //!< The number of shapes and boxes in the buffers above
         };
 
         //! The maximum index allowed for of dynamic vertex indices
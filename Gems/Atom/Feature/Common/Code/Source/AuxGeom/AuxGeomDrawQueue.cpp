@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Scene.h>
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Math/ShapeIntersection.h>
@@ -21,6 +22,9 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_auxGeomMaxShapesPerFrame, 32768, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of AuxGeom shapes and boxes drawn in a frame, the shapes that are added once it's reached are ignored.");
+
         namespace
         {
             AZ::u32 PackColor(AZ::Color color)
@@ -789,6 +793,7 @@ namespace AZ
 
             data.m_viewProjOverrides.clear();
             data.m_2DViewProjOverrideIndex = -1;
+            data.m_fixedShapeCount = 0;
         }
 
         bool AuxGeomDrawQueue::ShouldBatchDraw(
@@ -969,6 +974,13 @@ namespace AZ
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
             AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
 
+            if (buffer.m_fixedShapeCount >= r_auxGeomMaxShapesPerFrame)
+            {
+                AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed the maximum of %u shapes per frame set by r_auxGeomMaxShapesPerFrame", static_cast<uint32_t>(r_auxGeomMaxShapesPerFrame));
+                return;
+            }
+            ++buffer.m_fixedShapeCount;
+
             if (IsOpaque(shape.m_color))
             {
                 buffer.m_opaqueShapes[drawStyle].push_back(shape);
@@ -988,6 +1000,13 @@ namespace AZ
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
             AuxGeomBufferData& buffer = m_buffers[m_currentBufferIndex];
 
+            if (buffer.m_fixedShapeCount >= r_auxGeomMaxShapesPerFrame)
+            {
+                AZ_WarningOnce("AuxGeom", false, "Draw function ignored, would exceed the maximum of %u shapes per frame set by r_auxGeomMaxShapesPerFrame", static_cast<uint32_t>(r_auxGeomMaxShapesPerFrame));
+                return;
+            }
+            ++buffer.m_fixedShapeCount;
+
             if (IsOpaque(box.m_color))
             {
                 buffer.m_opaqueBoxes[drawStyle].push_back(box);
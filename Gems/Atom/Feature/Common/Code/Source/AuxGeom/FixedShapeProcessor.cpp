@@ -11,6 +11,8 @@
 
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/tuple.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
@@ -19,6 +21,7 @@
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 
+#include <Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
@@ -95,6 +98,8 @@ namespace AZ
 
             m_processSrgs.clear();
             m_drawPackets.clear();
+            m_instances = {};
+            m_shapeDraws = {};
 
             m_litShader = nullptr;
             m_unlitShader = nullptr;
@@ -132,167 +137,223 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(AzRender, "FixedShapeProcessor: ProcessObjects");
 
-            RHI::DrawPacketBuilder drawPacketBuilder;
-
-            // Draw opaque shapes with LODs. This requires a separate draw packet per shape per view that it is in (usually only one)
+            m_instances.clear();
+            m_shapeDraws.clear();
 
-            // We do each draw style together to reduce state changes
+            // Opaque draws of shapes with LODs need a separate draw per view that the shape is in (usually only one)
             for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
             {
-                auto drawListTag = GetShaderDataForDrawStyle(drawStyle).m_drawListTag;
-
                 // Skip this draw style if the owner scene doesn't have this drawListTag (which means this FP won't even create the RHI PipelineState for draw)
-                if (!m_scene->HasOutputForPipelineState(drawListTag))
+                if (!m_scene->HasOutputForPipelineState(GetShaderDataForDrawStyle(drawStyle).m_drawListTag))
                 {
-                    return;
+                    continue;
                 }
 
-                // Draw all of the opaque shapes of this draw style
-                // Possible TODO: Batch together shapes of the same type and LOD using instanced draw [ATOM-1032]
-                // Note that this optimization may not be worth it for shapes because of LODs
                 for (const auto& shape : bufferData->m_opaqueShapes[drawStyle])
                 {
-                    PipelineStateOptions pipelineStateOptions;
-                    pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(shape.m_viewProjOverrideIndex >= 0);
-                    pipelineStateOptions.m_blendMode = BlendMode_Off;
-                    pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
-                    pipelineStateOptions.m_depthReadType = shape.m_depthRead;
-                    pipelineStateOptions.m_depthWriteType = shape.m_depthWrite;
-                    pipelineStateOptions.m_faceCullMode = shape.m_faceCullMode;
-
-                    RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
+                    AddShapeDraw(shape, drawStyle, false, fpPacket);
+                }
+                for (const auto& box : bufferData->m_opaqueBoxes[drawStyle])
+                {
+                    AddBoxDraw(box, drawStyle, false, fpPacket);
+                }
+            }
+            const size_t opaqueDrawCount = m_shapeDraws.size();
 
-                    const AZ::Vector3 position = shape.m_position;
-                    const AZ::Vector3 scale = shape.m_scale;
+            // Translucent draws need a separate draw per view that the object is in (typically only one) because of distance sorting
+            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+            {
+                if (!m_scene->HasOutputForPipelineState(GetShaderDataForDrawStyle(drawStyle).m_drawListTag))
+                {
+                    continue;
+                }
 
-                    for (auto& view : fpPacket.m_views)
-                    {
-                        // If this view is ignoring packets with our draw list tag then skip this view
-                        if (!view->HasDrawListTag(drawListTag))
-                        {
-                            continue;
-                        }
-                        LodIndex lodIndex = GetLodIndexForShape(shape.m_shapeType, view.get(), position, scale);
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForShape(
-                            drawPacketBuilder, shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
-                    }
+                for (const auto& shape : bufferData->m_translucentShapes[drawStyle])
+                {
+                    AddShapeDraw(shape, drawStyle, true, fpPacket);
+                }
+                for (const auto& box : bufferData->m_translucentBoxes[drawStyle])
+                {
+                    AddBoxDraw(box, drawStyle, true, fpPacket);
                 }
+            }
 
-                for (const auto& box : bufferData->m_opaqueBoxes[drawStyle])
+            if (m_shapeDraws.empty())
+            {
+                return;
+            }
+
+            // Sort the opaque draws so the ones that can share an instanced draw are next to each other
+            const auto drawKey = [](const ShapeDraw& draw)
+            {
+                return AZStd::make_tuple(
+                    draw.m_pipelineState, draw.m_drawStyle, draw.m_geometry, draw.m_lodIndex, draw.m_viewProjOverrideIndex,
+                    draw.m_pointSize, draw.m_viewIndex);
+            };
+            AZStd::sort(
+                m_shapeDraws.begin(), m_shapeDraws.begin() + opaqueDrawCount,
+                [&drawKey](const ShapeDraw& lhs, const ShapeDraw& rhs)
                 {
-                    PipelineStateOptions pipelineStateOptions;
-                    pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(box.m_viewProjOverrideIndex >= 0);
-                    pipelineStateOptions.m_blendMode = BlendMode_Off;
-                    pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
-                    pipelineStateOptions.m_depthReadType = box.m_depthRead;
-                    pipelineStateOptions.m_depthWriteType = box.m_depthWrite;
-                    pipelineStateOptions.m_faceCullMode = box.m_faceCullMode;
-
-                    RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
-
-                    const RHI::DrawPacket* drawPacket =
-                        BuildDrawPacketForBox(drawPacketBuilder, box, drawStyle, bufferData->m_viewProjOverrides, pipelineState);
-                    if (drawPacket)
-                    {
-                        m_drawPackets.emplace_back(drawPacket);
+                    return drawKey(lhs) < drawKey(rhs);
+                });
 
-                        for (auto& view : fpPacket.m_views)
-                        {
-                            // If this view is ignoring packets with our draw list tag then skip this view
-                            if (!view->HasDrawListTag(drawListTag))
-                            {
-                                continue;
-                            }
-                            view->AddDrawPacket(drawPacket);
-                        }
+            // Every draw reads its instances from the ring buffer of the dynamic draw system, in the order of m_shapeDraws
+            const uint32_t instanceByteCount = aznumeric_cast<uint32_t>(m_shapeDraws.size() * sizeof(ShapeInstance));
+            RHI::Ptr<RPI::DynamicBuffer> instanceBuffer =
+                RPI::DynamicDrawInterface::Get()->GetDynamicBuffer(instanceByteCount, RHI::Alignment::InputAssembly);
+            if (!instanceBuffer)
+            {
+                AZ_WarningOnce("AuxGeom", false, "Failed to allocate dynamic buffer of size %u.", instanceByteCount);
+                return;
+            }
+            ShapeInstance* instances = static_cast<ShapeInstance*>(instanceBuffer->GetBufferAddress());
+            for (size_t drawIndex = 0; drawIndex < m_shapeDraws.size(); ++drawIndex)
+            {
+                instances[drawIndex] = m_instances[m_shapeDraws[drawIndex].m_instanceIndex];
+            }
+            const RHI::StreamBufferView instanceStreamBufferView = instanceBuffer->GetStreamBufferView(sizeof(ShapeInstance));
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            for (size_t drawIndex = 0; drawIndex < m_shapeDraws.size();)
+            {
+                const ShapeDraw& draw = m_shapeDraws[drawIndex];
+                size_t drawEnd = drawIndex + 1;
+                if (drawIndex < opaqueDrawCount)
+                {
+                    while (drawEnd < opaqueDrawCount && drawKey(m_shapeDraws[drawEnd]) == drawKey(draw))
+                    {
+                        ++drawEnd;
                     }
                 }
 
+                const RHI::DrawPacket* drawPacket = BuildDrawPacketForShapeDraw(
+                    drawPacketBuilder, draw, bufferData->m_viewProjOverrides, instanceStreamBufferView,
+                    aznumeric_cast<uint32_t>(drawEnd - drawIndex), aznumeric_cast<uint32_t>(drawIndex));
+                if (drawPacket)
+                {
+                    m_drawPackets.emplace_back(drawPacket);
+                    AddDrawPacketToViews(drawPacket, draw, fpPacket);
+                }
+                drawIndex = drawEnd;
             }
+        }
 
-            // Draw all of the translucent objects (shapes and boxes) with a distance sort key per view
-            // We have to create separate draw packets for each view that the AuxGeom is in (typically only one)
-            // because of distance sorting
-            for (int drawStyle = 0; drawStyle < DrawStyle_Count; ++drawStyle)
+        uint32_t FixedShapeProcessor::AddInstance(
+            const AZ::Color& color, const AZ::Vector3& position, const AZ::Vector3& scale, const AZ::Matrix3x3& rotationMatrix)
+        {
+            ShapeInstance& instance = m_instances.emplace_back();
+            color.StoreToFloat4(instance.m_color);
+
+            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(rotationMatrix, position) * AZ::Matrix3x4::CreateScale(scale);
+            drawMatrix.StoreToRowMajorFloat12(instance.m_modelToWorld);
+
+            Matrix3x3 rotation = rotationMatrix;
+            rotation.MultiplyByScale(scale.GetReciprocal());
+            AZ::Matrix3x4::CreateFromMatrix3x3(rotation).StoreToRowMajorFloat12(instance.m_normalMatrix);
+
+            return aznumeric_cast<uint32_t>(m_instances.size() - 1);
+        }
+
+        void FixedShapeProcessor::AddShapeDraw(
+            const ShapeBufferEntry& shape, int drawStyle, bool isTranslucent, const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            if (m_shapes[shape.m_shapeType].m_lodBuffers.empty())
             {
-                auto drawListTag = GetShaderDataForDrawStyle(drawStyle).m_drawListTag;
+                return;
+            }
 
-                // Skip this draw style if the owner scene doesn't have this drawListTag (which means this FP won't even create the RHI PipelineState for draw)
-                if (!m_scene->HasOutputForPipelineState(drawListTag))
+            PipelineStateOptions pipelineStateOptions;
+            pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(shape.m_viewProjOverrideIndex >= 0);
+            pipelineStateOptions.m_blendMode = isTranslucent ? BlendMode_Alpha : BlendMode_Off;
+            pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
+            pipelineStateOptions.m_depthReadType = shape.m_depthRead;
+            pipelineStateOptions.m_depthWriteType = shape.m_depthWrite;
+            pipelineStateOptions.m_faceCullMode = shape.m_faceCullMode;
+
+            ShapeDraw draw;
+            draw.m_pipelineState = &GetPipelineState(pipelineStateOptions);
+            draw.m_drawStyle = drawStyle;
+            draw.m_geometry = shape.m_shapeType;
+            draw.m_viewProjOverrideIndex = shape.m_viewProjOverrideIndex;
+            draw.m_pointSize = drawStyle == DrawStyle_Point ? shape.m_pointSize : 0.0f;
+            draw.m_instanceIndex = AddInstance(shape.m_color, shape.m_position, shape.m_scale, shape.m_rotationMatrix);
+
+            const RHI::DrawListTag drawListTag = GetShaderDataForDrawStyle(drawStyle).m_drawListTag;
+            for (uint32_t viewIndex = 0; viewIndex < fpPacket.m_views.size(); ++viewIndex)
+            {
+                const RPI::ViewPtr& view = fpPacket.m_views[viewIndex];
+
+                // If this view is ignoring packets with our draw list tag then skip this view
+                if (!view->HasDrawListTag(drawListTag))
                 {
-                    return;
+                    continue;
                 }
+                draw.m_viewIndex = viewIndex;
+                draw.m_lodIndex = GetLodIndexForShape(shape.m_shapeType, view.get(), shape.m_position, shape.m_scale);
+                draw.m_sortKey = isTranslucent ? view->GetSortKeyForPosition(shape.m_position) : 0;
+                m_shapeDraws.push_back(draw);
+            }
+        }
 
-                // Draw all the shapes of this draw style
-                for (const auto& shape : bufferData->m_translucentShapes[drawStyle])
-                {
-                    PipelineStateOptions pipelineStateOptions;
-                    pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(shape.m_viewProjOverrideIndex >= 0);
-                    pipelineStateOptions.m_blendMode = BlendMode_Alpha;
-                    pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
-                    pipelineStateOptions.m_depthReadType = shape.m_depthRead;
-                    pipelineStateOptions.m_depthWriteType = shape.m_depthWrite;
-                    pipelineStateOptions.m_faceCullMode = shape.m_faceCullMode;
-
-                    RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
-
-                    const AZ::Vector3 position = shape.m_position;
-                    const AZ::Vector3 scale = shape.m_scale;
-                    for (auto& view : fpPacket.m_views)
-                    {
-                        // If this view is ignoring packets with our draw list tag then skip this view
-                        if (!view->HasDrawListTag(drawListTag))
-                        {
-                            continue;
-                        }
-                        RHI::DrawItemSortKey sortKey = view->GetSortKeyForPosition(position);
-                        LodIndex lodIndex = GetLodIndexForShape(shape.m_shapeType, view.get(), position, scale);
+        void FixedShapeProcessor::AddBoxDraw(
+            const BoxBufferEntry& box, int drawStyle, bool isTranslucent, const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            PipelineStateOptions pipelineStateOptions;
+            pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(box.m_viewProjOverrideIndex >= 0);
+            pipelineStateOptions.m_blendMode = isTranslucent ? BlendMode_Alpha : BlendMode_Off;
+            pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
+            pipelineStateOptions.m_depthReadType = box.m_depthRead;
+            pipelineStateOptions.m_depthWriteType = box.m_depthWrite;
+            pipelineStateOptions.m_faceCullMode = box.m_faceCullMode;
+
+            ShapeDraw draw;
+            draw.m_pipelineState = &GetPipelineState(pipelineStateOptions);
+            draw.m_drawStyle = drawStyle;
+            draw.m_geometry = BoxGeometry;
+            draw.m_viewProjOverrideIndex = box.m_viewProjOverrideIndex;
+            draw.m_pointSize = drawStyle == DrawStyle_Point ? box.m_pointSize : 0.0f;
+            draw.m_instanceIndex = AddInstance(box.m_color, box.m_position, box.m_scale, box.m_rotationMatrix);
+
+            if (!isTranslucent)
+            {
+                // Boxes don't have LODs, so the same opaque draw is used for every view
+                draw.m_viewIndex = AllViews;
+                m_shapeDraws.push_back(draw);
+                return;
+            }
 
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForShape(
-                            drawPacketBuilder, shape, drawStyle, bufferData->m_viewProjOverrides, pipelineState, lodIndex, sortKey);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
-                    }
+            const RHI::DrawListTag drawListTag = GetShaderDataForDrawStyle(drawStyle).m_drawListTag;
+            for (uint32_t viewIndex = 0; viewIndex < fpPacket.m_views.size(); ++viewIndex)
+            {
+                const RPI::ViewPtr& view = fpPacket.m_views[viewIndex];
+
+                // If this view is ignoring packets with our draw list tag then skip this view
+                if (!view->HasDrawListTag(drawListTag))
+                {
+                    continue;
                 }
+                draw.m_viewIndex = viewIndex;
+                draw.m_sortKey = view->GetSortKeyForPosition(box.m_position);
+                m_shapeDraws.push_back(draw);
+            }
+        }
 
-                // Draw all the boxes of this draw style
-                for (const auto& box : bufferData->m_translucentBoxes[drawStyle])
+        void FixedShapeProcessor::AddDrawPacketToViews(
+            const RHI::DrawPacket* drawPacket, const ShapeDraw& draw, const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            if (draw.m_viewIndex != AllViews)
+            {
+                fpPacket.m_views[draw.m_viewIndex]->AddDrawPacket(drawPacket);
+                return;
+            }
+
+            const RHI::DrawListTag drawListTag = GetShaderDataForDrawStyle(draw.m_drawStyle).m_drawListTag;
+            for (auto& view : fpPacket.m_views)
+            {
+                // If this view is ignoring packets with our draw list tag then skip this view
+                if (view->HasDrawListTag(drawListTag))
                 {
-                    PipelineStateOptions pipelineStateOptions;
-                    pipelineStateOptions.m_perpectiveType = (AuxGeomShapePerpectiveType)(box.m_viewProjOverrideIndex >= 0);
-                    pipelineStateOptions.m_blendMode = BlendMode_Alpha;
-                    pipelineStateOptions.m_drawStyle = (AuxGeomDrawStyle)drawStyle;
-                    pipelineStateOptions.m_depthReadType = box.m_depthRead;
-                    pipelineStateOptions.m_depthWriteType = box.m_depthWrite;
-                    pipelineStateOptions.m_faceCullMode = box.m_faceCullMode;
-
-                    RPI::Ptr<RPI::PipelineStateForDraw> pipelineState = GetPipelineState(pipelineStateOptions);
-
-                    const AZ::Vector3 position = box.m_position;
-                    for (auto& view : fpPacket.m_views)
-                    {
-                        // If this view is ignoring packets with our draw list tag then skip this view
-                        if (!view->HasDrawListTag(drawListTag))
-                        {
-                            continue;
-                        }
-                        RHI::DrawItemSortKey sortKey = view->GetSortKeyForPosition(position);
-                        const RHI::DrawPacket* drawPacket = BuildDrawPacketForBox(
-                            drawPacketBuilder, box, drawStyle, bufferData->m_viewProjOverrides, pipelineState, sortKey);
-                        if (drawPacket)
-                        {
-                            m_drawPackets.emplace_back(drawPacket);
-                            view->AddDrawPacket(drawPacket);
-                        }
-                    }
+                    view->AddDrawPacket(drawPacket);
                 }
             }
         }
@@ -1359,11 +1420,7 @@ namespace AZ
             objectBuffers.m_streamBufferViews = { positionBufferView };
             objectBuffers.m_streamBufferViewsWithNormals = { positionBufferView, normalBufferView };
 
-            // Validate for each draw style
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Point], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Line], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Solid], objectBuffers.m_streamBufferViews);
-            AZ::RHI::ValidateStreamBufferViews(m_objectStreamLayout[DrawStyle_Shaded], objectBuffers.m_streamBufferViewsWithNormals);
+            // The stream buffer views are validated together with the instance stream, once it's appended for the first draw
 
             return true;
         }
@@ -1410,6 +1467,24 @@ namespace AZ
             {
                 layoutBuilder.AddBuffer()->Channel("NORMAL", RHI::Format::R32G32B32_FLOAT);
             }
+
+            // The per-instance data of ShapeInstance, the normal matrix is only read by the lit shader
+            RHI::InputStreamLayoutBuilder::BufferDescriptorBuilder* instanceBuffer = layoutBuilder.AddBuffer(RHI::StreamStepFunction::PerInstance)
+                ->Channel("INSTANCE_COLOR", RHI::Format::R32G32B32A32_FLOAT)
+                ->Channel("INSTANCE_MODEL_TO_WORLD0", RHI::Format::R32G32B32A32_FLOAT)
+                ->Channel("INSTANCE_MODEL_TO_WORLD1", RHI::Format::R32G32B32A32_FLOAT)
+                ->Channel("INSTANCE_MODEL_TO_WORLD2", RHI::Format::R32G32B32A32_FLOAT);
+            if (includeNormals)
+            {
+                instanceBuffer
+                    ->Channel("INSTANCE_NORMAL_MATRIX0", RHI::Format::R32G32B32A32_FLOAT)
+                    ->Channel("INSTANCE_NORMAL_MATRIX1", RHI::Format::R32G32B32A32_FLOAT)
+                    ->Channel("INSTANCE_NORMAL_MATRIX2", RHI::Format::R32G32B32A32_FLOAT);
+            }
+            else
+            {
+                instanceBuffer->Padding(sizeof(ShapeInstance::m_normalMatrix));
+            }
             layoutBuilder.SetTopology(topology);
             inputStreamLayout = layoutBuilder.End();
         }
@@ -1600,19 +1675,18 @@ namespace AZ
             }
         }
 
-        const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacketForShape(
+        const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacketForShapeDraw(
             RHI::DrawPacketBuilder& drawPacketBuilder,
-            const ShapeBufferEntry& shape,
-            int drawStyle,
+            const ShapeDraw& draw,
             const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
-            const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
-            LodIndex lodIndex,
-            RHI::DrawItemSortKey sortKey)
+            const RHI::StreamBufferView& instanceStreamBufferView,
+            uint32_t instanceCount,
+            uint32_t instanceOffset)
         {
-            ShaderData& shaderData = m_perObjectShaderData[drawStyle==DrawStyle_Shaded?1:0];
+            ShaderData& shaderData = GetShaderDataForDrawStyle(draw.m_drawStyle);
+            const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState = *draw.m_pipelineState;
 
-            // Create a SRG for the shape to specify its transform and color
-            // [GFX TODO] [ATOM-2333] Try to avoid doing SRG create/compile per draw. Possibly using instancing.
+            // Create a SRG for the draw, the transforms and colors of its instances are in the instance stream
             auto srg = RPI::ShaderResourceGroup::Create(shaderData.m_shaderAsset, shaderData.m_supervariantIndex, shaderData.m_perObjectSrgLayout->GetName());
             if (!srg)
             {
@@ -1620,45 +1694,51 @@ namespace AZ
                 return nullptr;
             }
 
-            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(shape.m_rotationMatrix, shape.m_position) * AZ::Matrix3x4::CreateScale(shape.m_scale);
-            if (drawStyle == DrawStyle_Shaded)
-            {
-                Matrix3x3 rotation = shape.m_rotationMatrix;
-                rotation.MultiplyByScale(shape.m_scale.GetReciprocal());
-                srg->SetConstant(shaderData.m_colorIndex, shape.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-                srg->SetConstant(shaderData.m_normalMatrixIndex, rotation);
-            }
-            else
+            if (draw.m_drawStyle == DrawStyle_Point)
             {
-                srg->SetConstant(shaderData.m_colorIndex, shape.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
+                srg->SetConstant(shaderData.m_pointSizeIndex, draw.m_pointSize);
             }
-            if (drawStyle == DrawStyle_Point)
+            if (draw.m_viewProjOverrideIndex >= 0)
             {
-                srg->SetConstant(shaderData.m_pointSizeIndex, shape.m_pointSize);
-            }
-            if (shape.m_viewProjOverrideIndex >= 0)
-            {
-                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[shape.m_viewProjOverrideIndex]);
+                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[draw.m_viewProjOverrideIndex]);
             }
 
             pipelineState->UpdateSrgVariantFallback(srg);
-            
+
             srg->Compile();
             m_processSrgs.push_back(srg);
-            if (m_shapes[shape.m_shapeType].m_lodBuffers.size() > 0)
+
+            uint32_t indexCount = 0;
+            const RHI::IndexBufferView* indexBufferView = nullptr;
+            StreamBufferViewsForAllStreams streamBufferViews;
+            if (draw.m_geometry == BoxGeometry)
             {
-                uint32_t indexCount = GetShapeIndexCount(shape.m_shapeType, drawStyle, lodIndex);
-                auto& indexBufferView = GetShapeIndexBufferView(shape.m_shapeType, drawStyle, lodIndex);
-                auto& streamBufferViews = GetShapeStreamBufferViews(shape.m_shapeType, lodIndex, drawStyle);
-                auto& drawListTag = shaderData.m_drawListTag;
+                indexCount = GetBoxIndexCount(draw.m_drawStyle);
+                indexBufferView = &GetBoxIndexBufferView(draw.m_drawStyle);
+                streamBufferViews = GetBoxStreamBufferViews(draw.m_drawStyle);
+            }
+            else
+            {
+                const AuxGeomShapeType shapeType = static_cast<AuxGeomShapeType>(draw.m_geometry);
+                indexCount = GetShapeIndexCount(shapeType, draw.m_drawStyle, draw.m_lodIndex);
+                indexBufferView = &GetShapeIndexBufferView(shapeType, draw.m_drawStyle, draw.m_lodIndex);
+                streamBufferViews = GetShapeStreamBufferViews(shapeType, draw.m_lodIndex, draw.m_drawStyle);
+            }
+            streamBufferViews.push_back(instanceStreamBufferView);
 
-                return BuildDrawPacket(
-                    drawPacketBuilder, srg, indexCount, indexBufferView, streamBufferViews, drawListTag,
-                    pipelineState->GetRHIPipelineState(), sortKey);
+            if (!m_streamBufferViewsValidatedForLayout[draw.m_drawStyle])
+            {
+                if (!RHI::ValidateStreamBufferViews(m_objectStreamLayout[draw.m_drawStyle], streamBufferViews))
+                {
+                    AZ_Error("FixedShapeProcessor", false, "Failed to validate the stream buffer views");
+                    return nullptr;
+                }
+                m_streamBufferViewsValidatedForLayout[draw.m_drawStyle] = true;
             }
-            return nullptr;
+
+            return BuildDrawPacket(
+                drawPacketBuilder, srg, indexCount, *indexBufferView, streamBufferViews, shaderData.m_drawListTag,
+                pipelineState->GetRHIPipelineState(), instanceCount, instanceOffset, draw.m_sortKey);
         }
 
         const AZ::RHI::IndexBufferView& FixedShapeProcessor::GetBoxIndexBufferView(int drawStyle) const
@@ -1702,58 +1782,6 @@ namespace AZ
             }
         }
 
-        const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacketForBox(
-            RHI::DrawPacketBuilder& drawPacketBuilder,
-            const BoxBufferEntry& box,
-            int drawStyle,
-            const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
-            const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
-            RHI::DrawItemSortKey sortKey)
-        {
-            ShaderData& shaderData = m_perObjectShaderData[drawStyle==DrawStyle_Shaded?1:0];
-            // Create a SRG for the box to specify its transform and color
-            auto srg = RPI::ShaderResourceGroup::Create(shaderData.m_shaderAsset, shaderData.m_supervariantIndex, shaderData.m_perObjectSrgLayout->GetName());
-            if (!srg)
-            {
-                AZ_Warning("AuxGeom", false, "Failed to create a shader resource group for an AuxGeom draw, Ignoring the draw");
-                return nullptr;
-            }
-            const AZ::Matrix3x4 drawMatrix = AZ::Matrix3x4::CreateFromMatrix3x3AndTranslation(box.m_rotationMatrix, box.m_position) * AZ::Matrix3x4::CreateScale(box.m_scale);
-            if (drawStyle == DrawStyle_Shaded)
-            {
-                Matrix3x3 rotation = box.m_rotationMatrix;
-                rotation.MultiplyByScale(box.m_scale.GetReciprocal());
-                srg->SetConstant(shaderData.m_colorIndex, box.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-                srg->SetConstant(shaderData.m_normalMatrixIndex, rotation);
-            }
-            else
-            {
-                srg->SetConstant(shaderData.m_colorIndex, box.m_color);
-                srg->SetConstant(shaderData.m_modelToWorldIndex, drawMatrix);
-            }
-            if (drawStyle == DrawStyle_Point)
-            {
-                srg->SetConstant(shaderData.m_pointSizeIndex, box.m_pointSize);
-            }
-            if (box.m_viewProjOverrideIndex >= 0)
-            {
-                srg->SetConstant(shaderData.m_viewProjectionOverrideIndex, viewProjOverrides[box.m_viewProjOverrideIndex]);
-            }
-            pipelineState->UpdateSrgVariantFallback(srg);
-            srg->Compile();
-            m_processSrgs.push_back(srg);
-
-            uint32_t indexCount = GetBoxIndexCount(drawStyle);
-            auto& indexBufferView = GetBoxIndexBufferView(drawStyle);
-            auto& streamBufferViews = GetBoxStreamBufferViews(drawStyle);
-            auto& drawListTag = shaderData.m_drawListTag;
-
-            return BuildDrawPacket(
-                drawPacketBuilder, srg, indexCount, indexBufferView, streamBufferViews, drawListTag, pipelineState->GetRHIPipelineState(),
-                sortKey);
-        }
-
         const RHI::DrawPacket* FixedShapeProcessor::BuildDrawPacket(
             RHI::DrawPacketBuilder& drawPacketBuilder,
             AZ::Data::Instance<RPI::ShaderResourceGroup>& srg,
@@ -1762,12 +1790,16 @@ namespace AZ
             const StreamBufferViewsForAllStreams& streamBufferViews,
             RHI::DrawListTag drawListTag,
             const AZ::RHI::PipelineState* pipelineState,
+            uint32_t instanceCount,
+            uint32_t instanceOffset,
             RHI::DrawItemSortKey sortKey)
         {
             RHI::DrawIndexed drawIndexed;
             drawIndexed.m_indexCount = indexCount;
             drawIndexed.m_indexOffset = 0;
             drawIndexed.m_vertexOffset = 0;
+            drawIndexed.m_instanceCount = instanceCount;
+            drawIndexed.m_instanceOffset = instanceOffset;
 
             drawPacketBuilder.Begin(nullptr);
             drawPacketBuilder.SetDrawArguments(drawIndexed);
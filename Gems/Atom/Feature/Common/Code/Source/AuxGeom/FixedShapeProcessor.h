@@ -22,6 +22,7 @@
 #include <Atom/RHI.Reflect/Limits.h>
 
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/limits.h>
 
 #include "AuxGeomBase.h"
 
@@ -122,6 +123,37 @@ namespace AZ
                 AZStd::vector<float> m_lodScreenPercentages;
             };
 
+            //! The per-instance data of every shape and box, in the instance stream of AuxGeomObject.azsl and AuxGeomObjectLit.azsl
+            struct ShapeInstance
+            {
+                float m_color[4];
+                float m_modelToWorld[12];
+                //! Only read by the lit shader, the unlit stream layout skips it as padding
+                float m_normalMatrix[12];
+            };
+
+            //! Used as the geometry of boxes in ShapeDraw, since they don't have a shape type
+            static constexpr uint32_t BoxGeometry = ShapeType_Count;
+
+            //! Passed as the view index of draws that are added to every view, since boxes don't have LODs
+            static constexpr uint32_t AllViews = AZStd::numeric_limits<uint32_t>::max();
+
+            //! A shape or box to draw in a view. Opaque draws that only differ in their instance are merged into a single
+            //! instanced draw, translucent draws are drawn one by one since they're sorted by depth.
+            struct ShapeDraw
+            {
+                const RPI::Ptr<RPI::PipelineStateForDraw>* m_pipelineState = nullptr;
+                int m_drawStyle = DrawStyle_Line;
+                uint32_t m_geometry = BoxGeometry;
+                LodIndex m_lodIndex = 0;
+                int32_t m_viewProjOverrideIndex = -1;
+                float m_pointSize = 0.0f;
+                uint32_t m_viewIndex = AllViews;
+                //! Index into m_instances
+                uint32_t m_instanceIndex = 0;
+                RHI::DrawItemSortKey m_sortKey = 0;
+            };
+
             struct PipelineStateOptions
             {
                 AuxGeomShapePerpectiveType m_perpectiveType = PerspectiveType_ViewProjection;
@@ -177,29 +209,34 @@ namespace AZ
             const StreamBufferViewsForAllStreams& GetShapeStreamBufferViews(AuxGeomShapeType shapeType, LodIndex lodIndex, int drawStyle) const;
             uint32_t GetShapeIndexCount(AuxGeomShapeType shapeType, int drawStyle, LodIndex lodIndex);
 
-            //! Uses the given drawPacketBuilder to build a draw packet for given shape and state and returns it
-            const RHI::DrawPacket* BuildDrawPacketForShape(
+            //! Stores the instance data of a shape or box in m_instances and returns its index
+            uint32_t AddInstance(
+                const AZ::Color& color, const AZ::Vector3& position, const AZ::Vector3& scale, const AZ::Matrix3x3& rotationMatrix);
+
+            //! Adds the draws of a shape or box to m_shapeDraws, one per view for shapes since their LOD depends on the view
+            void AddShapeDraw(
+                const ShapeBufferEntry& shape, int drawStyle, bool isTranslucent, const RPI::FeatureProcessor::RenderPacket& fpPacket);
+            void AddBoxDraw(
+                const BoxBufferEntry& box, int drawStyle, bool isTranslucent, const RPI::FeatureProcessor::RenderPacket& fpPacket);
+
+            //! Uses the given drawPacketBuilder to build an instanced draw packet for the geometry and state of the draw, which
+            //! reads instanceCount instances from the instance stream starting at instanceOffset
+            const RHI::DrawPacket* BuildDrawPacketForShapeDraw(
                 RHI::DrawPacketBuilder& drawPacketBuilder,
-                const ShapeBufferEntry& shape,
-                int drawStyle,
+                const ShapeDraw& draw,
                 const AZStd::vector<AZ::Matrix4x4>& viewProjOverrides,
-                const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
-                LodIndex lodIndex,
-                RHI::DrawItemSortKey sortKey = 0);
+                const RHI::StreamBufferView& instanceStreamBufferView,
+                uint32_t instanceCount,
+                uint32_t instanceOffset);
+
+            //! Adds the draw packet to the view of the draw, or to every view with the draw list tag when it's for all views
+            void AddDrawPacketToViews(
+                const RHI::DrawPacket* drawPacket, const ShapeDraw& draw, const RPI::FeatureProcessor::RenderPacket& fpPacket);
 
             const AZ::RHI::IndexBufferView& GetBoxIndexBufferView(int drawStyle) const;
             const StreamBufferViewsForAllStreams& GetBoxStreamBufferViews(int drawStyle) const;
             uint32_t GetBoxIndexCount(int drawStyle);
 
-            //! Uses the given drawPacketBuilder to build a draw packet for given box and state and returns it
-            const RHI::DrawPacket* BuildDrawPacketForBox(
-                RHI::DrawPacketBuilder& drawPacketBuilder,
-                const BoxBufferEntry& box,
-                int drawStyle,
-                const AZStd::vector<AZ::Matrix4x4>& overrideViewProjMatrices,
-                const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState,
-                RHI::DrawItemSortKey sortKey = 0);
-
             //! Uses the given drawPacketBuilder to build a draw packet with the given data
             const RHI::DrawPacket* BuildDrawPacket(
                 RHI::DrawPacketBuilder& drawPacketBuilder,
@@ -209,6 +246,8 @@ namespace AZ
                 const StreamBufferViewsForAllStreams& streamBufferViews,
                 RHI::DrawListTag drawListTag,
                 const AZ::RHI::PipelineState* pipelineState,
+                uint32_t instanceCount,
+                uint32_t instanceOffset,
                 RHI::DrawItemSortKey sortKey);
 
         private: // data
@@ -218,6 +257,7 @@ namespace AZ
 
             //! The descriptor for drawing an object of each draw style using predefined streams
             RHI::InputStreamLayout m_objectStreamLayout[DrawStyle_Count];
+            bool m_streamBufferViewsValidatedForLayout[DrawStyle_Count] = {};
             
             //! Array of shape buffers for all shapes
             AZStd::array<Shape, ShapeType_Count> m_shapes;
@@ -247,9 +287,6 @@ namespace AZ
                 AZ::RPI::SupervariantIndex m_supervariantIndex; // For @m_perObjectSrgLayout.
                 AZ::RHI::Ptr<AZ::RHI::ShaderResourceGroupLayout> m_perObjectSrgLayout; // Comes from @m_shaderAsset
                 AZ::RHI::DrawListTag m_drawListTag;
-                AZ::RHI::ShaderInputNameIndex m_colorIndex = "m_color";
-                AZ::RHI::ShaderInputNameIndex m_modelToWorldIndex = "m_modelToWorld";
-                AZ::RHI::ShaderInputNameIndex m_normalMatrixIndex = "m_normalMatrix";
                 AZ::RHI::ShaderInputNameIndex m_viewProjectionOverrideIndex = "m_viewProjectionOverride";
                 AZ::RHI::ShaderInputNameIndex m_pointSizeIndex = "m_pointSize";
             };
@@ -258,6 +295,10 @@ namespace AZ
 
             AZStd::vector<AZStd::unique_ptr<const RHI::DrawPacket>> m_drawPackets;
 
+            // The instances and draws of the frame, kept between frames to reuse their memory
+            AZStd::vector<ShapeInstance> m_instances;
+            AZStd::vector<ShapeDraw> m_shapeDraws;
+
             const AZ::RPI::Scene* m_scene = nullptr;
 
             bool m_needUpdatePipelineStates = false;
@@ -90,6 +90,7 @@
 
 #include <CoreLights/LightCullingTilePreparePass.h>
 #include <CoreLights/LightCullingPass.h>
+#include <CoreLights/LightCullingClusteredPass.h>
 #include <Shadows/FullscreenShadowPass.h>
 #include <CoreLights/LightCullingRemap.h>
 #include <Decals/DecalTextureArrayFeatureProcessor.h>
@@ -108,6 +109,9 @@
 #include <ReflectionScreenSpace/ReflectionScreenSpaceCompositePass.h>
 #include <ReflectionScreenSpace/ReflectionCopyFrameBufferPass.h>
 #include <OcclusionCullingPlane/OcclusionCullingPlaneFeatureProcessor.h>
+#include <Mesh/MeshOcclusionCullingPass.h>
+#include <Mesh/MeshGpuDrivenCullingPass.h>
+#include <Mesh/BindlessMaterialStreamingFeedbackPass.h>
 #include <Mesh/ModelReloaderSystem.h>
 
 namespace AZ
@@ -239,6 +243,7 @@ namespace AZ
             passSystem->AddPassCreator(Name("EyeAdaptationPass"), &EyeAdaptationPass::Create);
             passSystem->AddPassCreator(Name("ImGuiPass"), &ImGuiPass::Create);
             passSystem->AddPassCreator(Name("LightCullingPass"), &LightCullingPass::Create);
+            passSystem->AddPassCreator(Name("LightCullingClusteredPass"), &LightCullingClusteredPass::Create);
             passSystem->AddPassCreator(Name("LightCullingRemapPass"), &LightCullingRemap::Create);
             passSystem->AddPassCreator(Name("LightCullingTilePreparePass"), &LightCullingTilePreparePass::Create);
             passSystem->AddPassCreator(Name("BlendColorGradingLutsPass"), &BlendColorGradingLutsPass::Create);
@@ -322,6 +327,11 @@ namespace AZ
             passSystem->AddPassCreator(Name("ReflectionScreenSpaceCompositePass"), &Render::ReflectionScreenSpaceCompositePass::Create);
             passSystem->AddPassCreator(Name("ReflectionCopyFrameBufferPass"), &Render::ReflectionCopyFrameBufferPass::Create);
 
+            // Add mesh occlusion culling pass
+            passSystem->AddPassCreator(Name("MeshOcclusionCullingPass"), &Render::MeshOcclusionCullingPass::Create);
+            passSystem->AddPassCreator(Name("MeshGpuDrivenCullingPass"), &Render::MeshGpuDrivenCullingPass::Create);
+            passSystem->AddPassCreator(Name("BindlessMaterialStreamingFeedbackPass"), &Render::BindlessMaterialStreamingFeedbackPass::Create);
+
             // Add RayTracing passes
             passSystem->AddPassCreator(Name("RayTracingAccelerationStructurePass"), &Render::RayTracingAccelerationStructurePass::Create);
             passSystem->AddPassCreator(Name("RayTracingPass"), &Render::RayTracingPass::Create);
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/LightCullingClusteredPass.h>
+#include <CoreLights/LightCullingConstants.h>
+
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<LightCullingClusteredPass> LightCullingClusteredPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<LightCullingClusteredPass> pass = aznew LightCullingClusteredPass(descriptor);
+            return pass;
+        }
+
+        LightCullingClusteredPass::LightCullingClusteredPass(const RPI::PassDescriptor& descriptor)
+            : LightCullingPass(descriptor)
+        {
+        }
+
+        void LightCullingClusteredPass::ResetInternal()
+        {
+            LightCullingPass::ResetInternal();
+            m_lightListRemapped = nullptr;
+        }
+
+        void LightCullingClusteredPass::BuildInternal()
+        {
+            // The light lists are written directly to LightListRemapped, so there's no LightList
+            m_tileDataBinding = FindAttachmentBinding(AZ::Name("TileLightData"));
+            CreateClusteredLightList();
+            if (m_lightListRemapped)
+            {
+                AttachBufferToSlot(Name("LightListRemapped"), m_lightListRemapped);
+            }
+        }
+
+        void LightCullingClusteredPass::CreateClusteredLightList()
+        {
+            const RHI::Size tileBufferResolution = GetTileDataBufferResolution();
+
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+            desc.m_bufferName = "LightListRemapped";
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_byteCount =
+                tileBufferResolution.m_width * tileBufferResolution.m_height * LightCulling::ClusterLightListSizePerTile * sizeof(uint32_t);
+            m_lightListRemapped = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Assert(m_lightListRemapped != nullptr, "Unable to allocate buffer for clustered light list");
+        }
+    }   // namespace Render
+}   // namespace AZ
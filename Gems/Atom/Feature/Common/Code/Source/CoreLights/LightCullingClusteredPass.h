@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <CoreLights/LightCullingPass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Alternative to the LightCullingPass and LightCullingRemap passes that culls the lights against exponentially distributed
+        //! depth slices of each tile, and writes the light list of each slice directly into the LightListRemapped buffer the forward
+        //! shaders read. The lists only hold the lights that overlap their slice, which keeps the lists of tiles with a large depth
+        //! range, like the tiles along silhouettes or the tiles with transparent objects, short.
+        //!
+        //! LightListRemapped holds a region of LightCulling::ClusterLightListSizePerTile entries per tile, which starts with the offset of
+        //! the light list of each slice, so the tiles are independent of each other. The tile light data is overwritten with the depth
+        //! slice distribution and a flag the forward shaders use to tell it apart from the tiled light culling, see LightCullingTileIterator.
+        //! Use the LightCullingClusteredParentTemplate in place of the LightCullingParentTemplate to switch a render pipeline over.
+        class LightCullingClusteredPass final
+            : public LightCullingPass
+        {
+            AZ_RPI_PASS(LightCullingClusteredPass);
+
+        public:
+            AZ_RTTI(AZ::Render::LightCullingClusteredPass, "{984ED73C-4013-4FA1-A871-43F099B951C6}", LightCullingPass);
+            AZ_CLASS_ALLOCATOR(LightCullingClusteredPass, SystemAllocator);
+            virtual ~LightCullingClusteredPass() = default;
+
+            //! Creates a LightCullingClusteredPass
+            static RPI::Ptr<LightCullingClusteredPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            LightCullingClusteredPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void ResetInternal() override;
+            void BuildInternal() override;
+
+            void CreateClusteredLightList();
+
+            Data::Instance<RPI::Buffer> m_lightListRemapped;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -18,6 +18,13 @@ namespace AZ
             const uint32_t TileDimX = 16;
             const uint32_t TileDimY = 16;
             const uint32_t NumBinsPerTile = 32;
+
+            // Used by the LightCullingClusteredPass
+            const uint32_t ClusterSliceCount = 16;
+            const uint32_t ClusterLightListSizePerTile = 2048;
+            // Limits the depth the slices are distributed over when the far plane is very far away or at infinity, everything
+            // beyond falls in the last slice
+            const float ClusterFarDistanceMax = 1000.0f;
         }
     }
 }
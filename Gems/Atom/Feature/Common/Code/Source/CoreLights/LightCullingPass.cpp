@@ -104,6 +104,21 @@ namespace AZ
             return AZStd::array<float, 4>{rightX - leftX, bottomY - topY, leftX, topY};
         }
 
+        // Returns the view space distances between which the depth slices of the clustered light culling are distributed
+        static AZStd::array<float, 2> ComputeClusterDepthRange(const AZ::Matrix4x4& viewToClip)
+        {
+            // The third row of the view to clip matrix is [0 0 A B], see LightCullingTilePreparePass::ComputeUnprojectConstants,
+            // so a depth buffer value d is at a view space distance of B / (d + A)
+            const float a = viewToClip.GetElement(2, 2);
+            const float b = viewToClip.GetElement(2, 3);
+            const float depth0Distance = fabsf(a) > FLT_MIN ? fabsf(b / a) : LightCulling::ClusterFarDistanceMax;
+            const float depth1Distance = fabsf(b / (1.0f + a));
+
+            const float clusterFar = AZStd::min(AZStd::max(depth0Distance, depth1Distance), LightCulling::ClusterFarDistanceMax);
+            const float clusterNear = AZStd::min(AZStd::min(depth0Distance, depth1Distance), clusterFar * 0.5f);
+            return AZStd::array<float, 2>{ AZStd::max(clusterNear, FLT_MIN), clusterFar };
+        }
+
         RPI::Ptr<LightCullingPass> LightCullingPass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<LightCullingPass> pass = aznew LightCullingPass(descriptor);
@@ -159,7 +174,7 @@ namespace AZ
 
         void LightCullingPass::ResetInternal()
         {
-            m_tileDataIndex = std::numeric_limits<uint32_t>::max();
+            m_tileDataBinding = nullptr;
             m_constantDataIndex.Reset();
 
             for (auto& elem : m_lightdata)
@@ -192,7 +207,7 @@ namespace AZ
 
         AZ::RHI::Size LightCullingPass::GetDepthBufferResolution()
         {
-            const RPI::PassAttachment* tileBuffer = GetInputBinding(m_tileDataIndex).GetAttachment().get();
+            const RPI::PassAttachment* tileBuffer = m_tileDataBinding->GetAttachment().get();
             // TileData is a texture that is built from taking the depth buffer and dividing it into tiles
             // We will use this attachment to work our way backwards and grab the original depth buffer so we can read the resolution off of it
             // The sizeSource contains the original depth buffer
@@ -210,7 +225,9 @@ namespace AZ
                 AZStd::array<float, 2> m_gridPixel;
                 AZStd::array<float, 2> m_gridHalfPixel;
                 uint32_t             m_gridWidth;
-                uint32_t             m_padding[3];
+                uint32_t             m_padding;
+                // Only read by the clustered light culling
+                AZStd::array<float, 2> m_clusterDepthRange;
             } cullingConstants{};
 
             RPI::ViewPtr view = m_pipeline->GetFirstView(GetPipelineViewTag());
@@ -220,26 +237,14 @@ namespace AZ
             cullingConstants.m_gridHalfPixel[0] = cullingConstants.m_gridPixel[0] * 0.5f;
             cullingConstants.m_gridHalfPixel[1] = cullingConstants.m_gridPixel[1] * 0.5f;
             cullingConstants.m_gridWidth = GetTileDataBufferResolution().m_width;
+            cullingConstants.m_clusterDepthRange = ComputeClusterDepthRange(view->GetViewToClipMatrix());
 
             m_shaderResourceGroup->SetConstant(m_constantDataIndex, cullingConstants);
         }
 
-        uint32_t LightCullingPass::FindInputBinding(const AZ::Name& name)
-        {
-            for (uint32_t i = 0; i < GetInputCount(); ++i)
-            {
-                const auto& binding = GetInputBinding(i);
-                if (binding.m_name == name)
-                {
-                    return i;
-                }
-            }
-            return std::numeric_limits<uint32_t>::max();
-        }
-
         AZ::RHI::Size LightCullingPass::GetTileDataBufferResolution()
         {
-            auto binding = GetInputBinding(m_tileDataIndex).GetAttachment().get();
+            auto binding = m_tileDataBinding->GetAttachment().get();
             return binding->m_descriptor.m_image.m_size;
         }
 
@@ -257,7 +262,7 @@ namespace AZ
 
         void LightCullingPass::BuildInternal()
         {
-            m_tileDataIndex = FindInputBinding(AZ::Name("TileLightData"));
+            m_tileDataBinding = FindAttachmentBinding(AZ::Name("TileLightData"));
             CreateLightList();
             AttachLightList();
         }
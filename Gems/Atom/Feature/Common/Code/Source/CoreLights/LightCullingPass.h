@@ -22,7 +22,7 @@ namespace AZ
     namespace Render
     {
         //! Compute shader that performs light culling
-        class LightCullingPass final
+        class LightCullingPass
             : public RPI::ComputePass
         {
             AZ_RPI_PASS(LightCullingPass);
@@ -40,7 +40,7 @@ namespace AZ
                 return Name("LightCullingTemplate");
             }
 
-        private:
+        protected:
 
             LightCullingPass(const RPI::PassDescriptor& descriptor);
 
@@ -60,8 +60,6 @@ namespace AZ
             float CreateTraceValues(const AZ::Vector2& unprojection);
             void GetLightDataFromFeatureProcessor();
 
-            uint32_t FindInputBinding(const AZ::Name& name);
-
             // Used for conversion from z-buffer values to view space depth
             AZStd::array<float, 2> ComputeGridPixelSize();
             void CreateLightList();
@@ -94,7 +92,7 @@ namespace AZ
 
             Data::Instance<RPI::Buffer> m_lightList;
 
-            uint32_t m_tileDataIndex = std::numeric_limits<uint32_t>::max();
+            const RPI::PassAttachmentBinding* m_tileDataBinding = nullptr;
         };
     }   // namespace Render
 }   // namespace AZ
@@ -8,6 +8,7 @@
 
 #include <CoreLights/ShadowmapPass.h>
 #include <Atom/RPI.Public/Pass/PassUtils.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/View.h>
@@ -30,11 +31,12 @@ namespace AZ
             m_overrideScissorSate = true;
         }
 
-        RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::CreateWithPassRequest(const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData)
+        RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::CreateWithPassRequest(
+            const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData, const Name& templateName)
         {
             // Create a pass request for the descriptor so we can connect it to the parent class input connections
             RPI::PassRequest childRequest;
-            childRequest.m_templateName = Name{ "ShadowmapPassTemplate" };
+            childRequest.m_templateName = templateName;
             childRequest.m_passName = passName;
 
             // Add a connection to the skinned mesh input
@@ -56,29 +58,48 @@ namespace AZ
 
         void ShadowmapPass::CreatePassTemplate()
         {
-            AZStd::shared_ptr<RPI::PassTemplate> m_childTemplate = AZStd::make_shared<RPI::PassTemplate>();
-            m_childTemplate->m_name = Name{ "ShadowmapPassTemplate" };
-            m_childTemplate->m_passClass = "ShadowmapPass";
-
-            m_childTemplate->m_slots.resize(2);
-            RPI::PassSlot& slot = m_childTemplate->m_slots[0];
-            slot.m_name = Name{ "Shadowmap" };
-            slot.m_slotType = RPI::PassSlotType::Output;
-            slot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::DepthStencil;
+            auto createTemplate = [](const Name& templateName, bool connectToParent, bool readsStaticCache)
+            {
+                AZStd::shared_ptr<RPI::PassTemplate> childTemplate = AZStd::make_shared<RPI::PassTemplate>();
+                childTemplate->m_name = templateName;
+                childTemplate->m_passClass = "ShadowmapPass";
+
+                childTemplate->m_slots.resize(readsStaticCache ? 3 : 2);
+                RPI::PassSlot& slot = childTemplate->m_slots[0];
+                slot.m_name = Name{ "Shadowmap" };
+                slot.m_slotType = RPI::PassSlotType::Output;
+                slot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::DepthStencil;
+
+                // This slot it used to create a connection between the skinned mesh compute pass and the cascade shadow map pass
+                RPI::PassSlot& skinnedMeshSlot = childTemplate->m_slots[1];
+                skinnedMeshSlot.m_name = Name{ "SkinnedMeshes" };
+                skinnedMeshSlot.m_slotType = RPI::PassSlotType::Input;
+                skinnedMeshSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::InputAssembly;
+
+                if (readsStaticCache)
+                {
+                    // The static caster depth the clear draw copies into the shadowmap
+                    RPI::PassSlot& staticCacheSlot = childTemplate->m_slots[2];
+                    staticCacheSlot.m_name = Name{ "StaticShadowmap" };
+                    staticCacheSlot.m_slotType = RPI::PassSlotType::Input;
+                    staticCacheSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::Shader;
+                }
 
-            // This slot it used to create a connection between the skinned mesh compute pass and the cascade shadow map pass
-            RPI::PassSlot& skinnedMeshSlot = m_childTemplate->m_slots[1];
-            skinnedMeshSlot.m_name = Name{ "SkinnedMeshes" };
-            skinnedMeshSlot.m_slotType = RPI::PassSlotType::Input;
-            skinnedMeshSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::InputAssembly;
+                if (connectToParent)
+                {
+                    childTemplate->m_connections.resize(1);
+                    RPI::PassConnection& connection = childTemplate->m_connections[0];
+                    connection.m_localSlot = Name{ "Shadowmap" };
+                    connection.m_attachmentRef.m_pass = Name{ "Parent" };
+                    connection.m_attachmentRef.m_attachment = Name{ "Shadowmap" };
+                }
 
-            m_childTemplate->m_connections.resize(1);
-            RPI::PassConnection& connection = m_childTemplate->m_connections[0];
-            connection.m_localSlot = Name{ "Shadowmap" };
-            connection.m_attachmentRef.m_pass = Name{ "Parent" };
-            connection.m_attachmentRef.m_attachment = Name{ "Shadowmap" };
+                RPI::PassSystemInterface::Get()->AddPassTemplate(templateName, childTemplate);
+            };
 
-            RPI::PassSystemInterface::Get()->AddPassTemplate(Name{ "ShadowmapPassTemplate" }, m_childTemplate);
+            createTemplate(Name{ PassTemplateName }, true, false);
+            createTemplate(Name{ StaticCachePassTemplateName }, false, false);
+            createTemplate(Name{ DynamicCasterPassTemplateName }, true, true);
         }
 
         // --- Build Override ---
@@ -97,7 +118,29 @@ namespace AZ
 
             RPI::PassAttachmentBinding& binding = GetOutputBinding(0);
 
-            RPI::Ptr<RPI::PassAttachment> attachment = parentPass->GetOutputBinding(0).GetAttachment();
+            RPI::Ptr<RPI::PassAttachment> attachment;
+            if (m_template->m_name == Name(StaticCachePassTemplateName))
+            {
+                // The pass is disabled until it has an image to render into, but the slot still needs an attachment
+                AttachImageToSlot(
+                    Name("Shadowmap"),
+                    m_staticCacheImage ? m_staticCacheImage : RPI::ImageSystemInterface::Get()->GetSystemAttachmentImage(RHI::Format::D32_FLOAT));
+                attachment = binding.GetAttachment();
+                SetEnabled(m_staticCacheImage != nullptr);
+            }
+            else
+            {
+                attachment = parentPass->GetOutputBinding(0).GetAttachment();
+            }
+
+            if (m_template->m_name == Name(DynamicCasterPassTemplateName))
+            {
+                AttachImageToSlot(
+                    Name("StaticShadowmap"),
+                    m_staticCacheSourceImage ? m_staticCacheSourceImage
+                                             : RPI::ImageSystemInterface::Get()->GetSystemAttachmentImage(RHI::Format::D32_FLOAT));
+            }
+
             if (!attachment)
             {
                 AZ_Assert(false, "[ShadowmapPass %s] Cannot find shadowmap image attachment.", GetPathName().GetCStr());
@@ -107,7 +150,10 @@ namespace AZ
 
             RHI::AttachmentLoadStoreAction action;
             action.m_clearValue = RHI::ClearValue::CreateDepth(1.f);
-            action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear : RHI::AttachmentLoadAction::DontCare;
+            // Passes that draw their own clear can skip frames, in which case the content of the previous frame needs to be kept
+            action.m_loadAction = m_clearEnabled ? RHI::AttachmentLoadAction::Clear
+                : m_clearShadowDrawPacket        ? RHI::AttachmentLoadAction::Load
+                                                 : RHI::AttachmentLoadAction::DontCare;
             binding.m_unifiedScopeDesc = RHI::UnifiedScopeAttachmentDescriptor(attachmentId, imageViewDescriptor, action);
 
             Base::BuildInternal();
@@ -140,6 +186,21 @@ namespace AZ
             m_forceRenderNextFrame = true;
         }
 
+        void ShadowmapPass::SetStaticCacheImage(Data::Instance<RPI::AttachmentImage> image)
+        {
+            m_staticCacheImage = image;
+        }
+
+        void ShadowmapPass::SetStaticCacheSourceImage(Data::Instance<RPI::AttachmentImage> image)
+        {
+            m_staticCacheSourceImage = image;
+        }
+
+        void ShadowmapPass::SetDynamicCasterPass(ShadowmapPass* dynamicCasterPass)
+        {
+            m_dynamicCasterPass = dynamicCasterPass;
+        }
+
         void ShadowmapPass::SetViewportScissorFromImageSize(const RHI::Size& imageSize)
         {
             const RHI::Viewport viewport(
@@ -174,23 +235,38 @@ namespace AZ
             // Override the estimated item count set by the base class. Draw item count is compared against
             // the last frame to detect cases where a moving object leaves the shadow frustum. It wouldn't
             // set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
+            bool skipFrame = false;
             if (m_isStatic && !m_forceRenderNextFrame && m_lastFrameDrawCount == m_drawItemCount)
             {
                 const auto& views = m_pipeline->GetViews(GetPipelineViewTag());
                 if (!views.empty())
                 {
                     const RPI::ViewPtr& view = views.front();
-                    if (view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0)
-                    {
-                        // Shadow is static and no casters moved since last frame.
-                        frameGraph.SetEstimatedItemCount(0);
-                    }
+                    // Shadow is static and no casters moved since last frame.
+                    skipFrame = view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0;
                 }
             }
+            else if (m_staticCacheSourceImage && !m_forceRenderNextFrame && m_lastFrameDrawCount == 0 && m_drawItemCount == 0)
+            {
+                // No dynamic casters to draw and none to remove, so the shadowmap still holds the static casters.
+                skipFrame = true;
+            }
+
+            if (skipFrame)
+            {
+                frameGraph.SetEstimatedItemCount(0);
+            }
             else
             {
                 // Report + 1 to make room for the clear draw packet.
                 frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size() + 1));
+
+                if (m_dynamicCasterPass)
+                {
+                    // The dynamic casters are drawn on top of a copy of the static casters, which are about to change.
+                    // The dynamic caster pass runs after this one in the same frame.
+                    m_dynamicCasterPass->ForceRenderNextFrame();
+                }
             }
         }
 
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/Size.h>
 #include <Atom/RHI/DrawPacket.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 
@@ -34,12 +35,20 @@ namespace AZ
 
             static RPI::Ptr<ShadowmapPass> Create(const RPI::PassDescriptor& descriptor);
 
-            // Creates a common pass template for the child shadowmap passes.
+            //! Template for passes that render into the shadowmap of the parent pass
+            static constexpr const char* PassTemplateName = "ShadowmapPassTemplate";
+            //! Template for passes that render the static casters of a cached shadow into an image of their own, see SetStaticCacheImage()
+            static constexpr const char* StaticCachePassTemplateName = "ShadowmapStaticCachePassTemplate";
+            //! Template for passes that draw the dynamic casters of a cached shadow on top of its static casters, see SetStaticCacheSourceImage()
+            static constexpr const char* DynamicCasterPassTemplateName = "ShadowmapDynamicCasterPassTemplate";
+
+            // Creates the common pass templates for the child shadowmap passes.
             static void CreatePassTemplate();
 
-            //! Creates a pass descriptor from the input, using the ShadowmapPassTemplate, and adds a pass request to connect to the parent pass.
+            //! Creates a pass descriptor from the input, using the given template, and adds a pass request to connect to the parent pass.
             //! This function assumes the parent pass has a SkinnedMeshes input slot
-            static RPI::Ptr<ShadowmapPass> CreateWithPassRequest(const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData);
+            static RPI::Ptr<ShadowmapPass> CreateWithPassRequest(
+                const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData, const Name& templateName = Name(PassTemplateName));
 
             //! This updates array slice for this shadowmap.
             void SetArraySlice(uint16_t arraySlice);
@@ -56,6 +65,19 @@ namespace AZ
             //! When the shadow is static, this forces the shadow to still re-render next frame (due to the light moving for instance)
             void ForceRenderNextFrame();
 
+            //! Sets the image a pass created with StaticCachePassTemplateName renders into instead of the shadowmap of the parent pass.
+            //! The image has the same layout as the shadowmap of the parent pass.
+            void SetStaticCacheImage(Data::Instance<RPI::AttachmentImage> image);
+
+            //! Sets the image a pass created with DynamicCasterPassTemplateName reads the static casters from. The draw packet set with
+            //! SetClearShadowDrawPacket() is expected to copy them into the shadowmap, so the pass only needs to draw the dynamic casters.
+            //! The pass skips the frames in which it has no dynamic casters to draw or to remove, unless the static casters changed.
+            void SetStaticCacheSourceImage(Data::Instance<RPI::AttachmentImage> image);
+
+            //! Sets the pass that draws the dynamic casters on top of the static casters this pass renders, so it renders again
+            //! whenever this pass does.
+            void SetDynamicCasterPass(ShadowmapPass* dynamicCasterPass);
+
             //! This update viewport and scissor for this shadowmap from the given image size.
             void SetViewportScissorFromImageSize(const RHI::Size& imageSize);
 
@@ -86,6 +108,9 @@ namespace AZ
             RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
             RHI::DrawItemProperties m_clearShadowDrawItemProperties;
             RHI::Handle<uint32_t> m_casterMovedBit;
+            Data::Instance<RPI::AttachmentImage> m_staticCacheImage;
+            Data::Instance<RPI::AttachmentImage> m_staticCacheSourceImage;
+            ShadowmapPass* m_dynamicCasterPass = nullptr;
             uint16_t m_arraySlice = 0;
             bool m_clearEnabled = true;
             bool m_isStatic = false;
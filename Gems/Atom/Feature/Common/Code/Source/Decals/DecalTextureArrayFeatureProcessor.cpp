@@ -24,7 +24,7 @@
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/std/containers/span.h>
-#include <numeric>
+#include <AzCore/std/sort.h>
 
 //! If modified, ensure that r_maxVisibleDecals is equal to or lower than ENABLE_DECALS_CAP which is the limit set by the shader on GPU.
 AZ_CVAR(int, r_maxVisibleDecals, -1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of visible decals to use when culling is not available. -1 means no limit");
@@ -598,32 +598,12 @@ namespace AZ
             }
 
             const auto& dataVector = m_decalData.GetDataVector<0>();
-            size_t numVisibleDecals =
-                r_maxVisibleDecals < 0 ? dataVector.size() : AZStd::min(dataVector.size(), static_cast<size_t>(r_maxVisibleDecals));
-            AZStd::vector<uint32_t> sortedDecals(dataVector.size());
-            // Initialize with all the decals indices
-            std::iota(sortedDecals.begin(), sortedDecals.end(), 0);
-            // Only sort if we are going to limit the number of visible decals
-            if (numVisibleDecals < dataVector.size())
-            {
-                AZ::Vector3 viewPos = view->GetViewToWorldMatrix().GetTranslation();
-                AZStd::sort(
-                    sortedDecals.begin(),
-                    sortedDecals.end(),
-                    [&dataVector, &viewPos](uint32_t lhs, uint32_t rhs)
-                    {
-                        float d1 = (AZ::Vector3::CreateFromFloat3(dataVector[lhs].m_position.data()) - viewPos).GetLengthSq();
-                        float d2 = (AZ::Vector3::CreateFromFloat3(dataVector[rhs].m_position.data()) - viewPos).GetLengthSq();
-                        return d1 < d2;
-                    });
-            }
 
             const AZ::Frustum viewFrustum = AZ::Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
             AZStd::vector<uint32_t> visibilityBuffer;
-            visibilityBuffer.reserve(numVisibleDecals);
-            for (uint32_t i = 0; i < sortedDecals.size() && visibilityBuffer.size() < numVisibleDecals; ++i)
+            visibilityBuffer.reserve(dataVector.size());
+            for (uint32_t dataIndex = 0; dataIndex < dataVector.size(); ++dataIndex)
             {
-                uint32_t dataIndex = sortedDecals[i];
                 const auto& decalData = dataVector[dataIndex];
                 AZ::Obb obb = AZ::Obb::CreateFromPositionRotationAndHalfLengths(
                     AZ::Vector3::CreateFromFloat3(decalData.m_position.data()),
@@ -636,6 +616,26 @@ namespace AZ
                 }
             }
 
+            // When limiting the number of visible decals keep the closest ones, only the visible decals need to be ordered.
+            const size_t numVisibleDecals = r_maxVisibleDecals < 0
+                ? visibilityBuffer.size()
+                : AZStd::min(visibilityBuffer.size(), static_cast<size_t>(r_maxVisibleDecals));
+            if (numVisibleDecals < visibilityBuffer.size())
+            {
+                const AZ::Vector3 viewPos = view->GetViewToWorldMatrix().GetTranslation();
+                AZStd::partial_sort(
+                    visibilityBuffer.begin(),
+                    visibilityBuffer.begin() + numVisibleDecals,
+                    visibilityBuffer.end(),
+                    [&dataVector, &viewPos](uint32_t lhs, uint32_t rhs)
+                    {
+                        float d1 = (AZ::Vector3::CreateFromFloat3(dataVector[lhs].m_position.data()) - viewPos).GetLengthSq();
+                        float d2 = (AZ::Vector3::CreateFromFloat3(dataVector[rhs].m_position.data()) - viewPos).GetLengthSq();
+                        return d1 < d2;
+                    });
+                visibilityBuffer.resize(numVisibleDecals);
+            }
+
             // Create the appropriate buffer handlers for the visibility data
             Render::LightCommon::UpdateVisibleBuffers(
                 "DecalVisibilityBuffer",
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/BindlessMaterialDataBuffer.h>
+#include <Atom/RHI/ImageView.h>
+#include <Atom/RHI/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/RPISystemInterface.h>
+#include <Atom/RPI.Reflect/Image/Image.h>
+#include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        void BindlessMaterialDataBuffer::Init()
+        {
+            GpuBufferHandler::Descriptor desc;
+            desc.m_bufferName = "BindlessMaterialTextureIndices";
+            desc.m_bufferSrgName = "m_bindlessMaterialTextureIndices";
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetSceneSrgLayout().get();
+            m_bufferHandler = GpuBufferHandler(desc);
+        }
+
+        void BindlessMaterialDataBuffer::Shutdown()
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            m_bufferHandler.Release();
+            m_slots = {};
+            m_freeSlots = {};
+            m_slotsByMaterialId = {};
+            m_textureIndices = {};
+            m_streamingImages = {};
+            m_bufferNeedsUpdate = false;
+        }
+
+        uint32_t BindlessMaterialDataBuffer::AcquireSlot(const Data::Instance<RPI::Material>& material)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            auto slotIter = m_slotsByMaterialId.find(material->GetId());
+            if (slotIter != m_slotsByMaterialId.end())
+            {
+                ++m_slots[slotIter->second].m_refCount;
+                return slotIter->second;
+            }
+
+            uint32_t slotIndex;
+            if (!m_freeSlots.empty())
+            {
+                slotIndex = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                slotIndex = aznumeric_cast<uint32_t>(m_slots.size());
+                m_slots.emplace_back();
+                m_textureIndices.resize(m_slots.size() * MaxTexturesPerMaterial, InvalidIndex);
+                m_streamingImages.resize(m_slots.size() * MaxTexturesPerMaterial);
+            }
+
+            Slot& slot = m_slots[slotIndex];
+            slot.m_material = material;
+            slot.m_changeId = material->GetCurrentChangeId();
+            slot.m_mergedMaterialId = GetMergedMaterialId(*material);
+            slot.m_refCount = 1;
+            m_slotsByMaterialId.emplace(material->GetId(), slotIndex);
+
+            WriteTextureIndices(slotIndex);
+            return slotIndex;
+        }
+
+        void BindlessMaterialDataBuffer::ReleaseSlot(uint32_t slotIndex)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            AZ_Assert(slotIndex < m_slots.size() && m_slots[slotIndex].m_refCount > 0, "Releasing a bindless material slot that isn't in use.");
+            Slot& slot = m_slots[slotIndex];
+            if (--slot.m_refCount == 0)
+            {
+                m_slotsByMaterialId.erase(slot.m_material->GetId());
+                slot = {};
+
+                // Don't keep the images of the material alive
+                Data::Instance<RPI::StreamingImage>* streamingImages = m_streamingImages.data() + slotIndex * MaxTexturesPerMaterial;
+                AZStd::fill(streamingImages, streamingImages + MaxTexturesPerMaterial, Data::Instance<RPI::StreamingImage>());
+                m_freeSlots.push_back(slotIndex);
+            }
+        }
+
+        bool BindlessMaterialDataBuffer::UpdateChangedMaterials()
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            bool mergedMaterialChanged = false;
+            for (uint32_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+            {
+                Slot& slot = m_slots[slotIndex];
+                if (slot.m_refCount == 0 || slot.m_changeId == slot.m_material->GetCurrentChangeId())
+                {
+                    continue;
+                }
+
+                slot.m_changeId = slot.m_material->GetCurrentChangeId();
+                WriteTextureIndices(slotIndex);
+
+                Data::InstanceId mergedMaterialId = GetMergedMaterialId(*slot.m_material);
+                if (mergedMaterialId != slot.m_mergedMaterialId)
+                {
+                    slot.m_mergedMaterialId = mergedMaterialId;
+                    mergedMaterialChanged = true;
+                }
+            }
+            return mergedMaterialChanged;
+        }
+
+        void BindlessMaterialDataBuffer::UpdateBuffer()
+        {
+            AZStd::scoped_lock lock(m_mutex);
+
+            if (m_bufferNeedsUpdate && !m_textureIndices.empty())
+            {
+                m_bufferHandler.UpdateBuffer(m_textureIndices);
+                m_bufferNeedsUpdate = false;
+            }
+        }
+
+        void BindlessMaterialDataBuffer::UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg) const
+        {
+            if (m_bufferHandler.IsValid())
+            {
+                m_bufferHandler.UpdateSrg(sceneSrg);
+            }
+        }
+
+        uint32_t BindlessMaterialDataBuffer::GetTextureEntryCount() const
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            return aznumeric_cast<uint32_t>(m_textureIndices.size());
+        }
+
+        void BindlessMaterialDataBuffer::VisitStreamingImages(const StreamingImageVisitor& visitor) const
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            for (uint32_t entryIndex = 0; entryIndex < m_streamingImages.size(); ++entryIndex)
+            {
+                if (m_streamingImages[entryIndex])
+                {
+                    visitor(entryIndex, *m_streamingImages[entryIndex]);
+                }
+            }
+        }
+
+        Data::InstanceId BindlessMaterialDataBuffer::GetMergedMaterialId(const RPI::Material& material)
+        {
+            HashValue64 hash = HashValue64{ 0 };
+
+            // Materials that are merged into the same draw share the MaterialSrg of whichever material was added first, so all
+            // of the constants need to match. Only the textures are read through the bindless indices.
+            if (const RHI::ShaderResourceGroup* materialSrg = material.GetRHIShaderResourceGroup())
+            {
+                AZStd::span<const uint8_t> constantData = materialSrg->GetData().GetConstantData();
+                hash = TypeHash64(constantData.data(), constantData.size(), hash);
+            }
+
+            material.ForAllShaderItems(
+                [&hash](const Name& materialPipelineName, const RPI::ShaderCollection::Item& shaderItem)
+                {
+                    hash = TypeHash64(materialPipelineName.GetHash(), hash);
+                    hash = TypeHash64(shaderItem.IsEnabled(), hash);
+                    if (shaderItem.IsEnabled())
+                    {
+                        const RPI::ShaderVariantId& variantId = shaderItem.GetShaderVariantId();
+                        hash = TypeHash64(
+                            reinterpret_cast<const uint8_t*>(variantId.m_key.data()), variantId.m_key.num_words() * sizeof(*variantId.m_key.data()), hash);
+                        hash = TypeHash64(shaderItem.GetDrawListTagOverride(), hash);
+                        if (const RHI::RenderStates* renderStates = shaderItem.GetRenderStatesOverlay())
+                        {
+                            hash = renderStates->GetHash(hash);
+                        }
+                    }
+                    return true;
+                });
+
+            const uint64_t hashValue = static_cast<uint64_t>(hash);
+            return Data::InstanceId::CreateFromAssetId(
+                material.GetAsset()->GetMaterialTypeAsset().GetId(),
+                { static_cast<uint32_t>(hashValue), static_cast<uint32_t>(hashValue >> 32) });
+        }
+
+        void BindlessMaterialDataBuffer::WriteTextureIndices(uint32_t slotIndex)
+        {
+            const RPI::Material& material = *m_slots[slotIndex].m_material;
+            const RPI::MaterialPropertiesLayout* layout = material.GetMaterialPropertiesLayout().get();
+
+            uint32_t* textureIndices = m_textureIndices.data() + slotIndex * MaxTexturesPerMaterial;
+            AZStd::fill(textureIndices, textureIndices + MaxTexturesPerMaterial, InvalidIndex);
+            Data::Instance<RPI::StreamingImage>* streamingImages = m_streamingImages.data() + slotIndex * MaxTexturesPerMaterial;
+            AZStd::fill(streamingImages, streamingImages + MaxTexturesPerMaterial, Data::Instance<RPI::StreamingImage>());
+
+            uint32_t textureCount = 0;
+            const uint32_t propertyCount = aznumeric_cast<uint32_t>(layout->GetPropertyCount());
+            for (uint32_t propertyIndex = 0; propertyIndex < propertyCount; ++propertyIndex)
+            {
+                const RPI::MaterialPropertyIndex index{ propertyIndex };
+                if (layout->GetPropertyDescriptor(index)->GetDataType() != RPI::MaterialPropertyDataType::Image)
+                {
+                    continue;
+                }
+
+                if (textureCount == MaxTexturesPerMaterial)
+                {
+                    AZ_Warning(
+                        "BindlessMaterialDataBuffer", false, "Material '%s' has more than %u textures, the remaining textures can't be read bindlessly.",
+                        material.GetAsset().GetHint().c_str(), MaxTexturesPerMaterial);
+                    break;
+                }
+
+                const RPI::MaterialPropertyValue& value = material.GetPropertyValue(index);
+                if (value.Is<Data::Instance<RPI::Image>>())
+                {
+                    const Data::Instance<RPI::Image>& image = value.GetValue<Data::Instance<RPI::Image>>();
+                    if (image && image->GetImageView())
+                    {
+                        textureIndices[textureCount] = image->GetImageView()->GetBindlessReadIndex();
+                        streamingImages[textureCount] = azrtti_cast<RPI::StreamingImage*>(image.get());
+                    }
+                }
+                ++textureCount;
+            }
+
+            m_bufferNeedsUpdate = true;
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/Feature/Utils/GpuBufferHandler.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Material/Material.h>
+#include <AtomCore/Instance/InstanceId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Keeps the bindless read indices of the textures of the materials that are drawn through the bindless material path in
+        //! a single structured buffer on the SceneSrg. Each material gets a persistent slot for as long as any mesh uses it, so the
+        //! indices only have to be written again when the material changes, and an instanced draw only needs to carry the slot of
+        //! each instance. This allows meshes whose materials only differ by their textures to be merged into the same draw call.
+        class BindlessMaterialDataBuffer
+        {
+        public:
+            //! Must match BindlessMaterialMaxTextures in BindlessMaterial.azsli
+            static constexpr uint32_t MaxTexturesPerMaterial = 16;
+            static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+            void Init();
+            void Shutdown();
+
+            //! Returns the slot of the material, adding a reference to it. The first reference assigns a new slot.
+            uint32_t AcquireSlot(const Data::Instance<RPI::Material>& material);
+
+            //! Removes a reference to the slot. The slot is reused once the last reference has been removed.
+            void ReleaseSlot(uint32_t slot);
+
+            //! Writes the texture indices of the materials that changed since the last call.
+            //! Returns true if the non-texture data of a material changed, in which case the draws that merged it with other
+            //! materials need to be rebuilt.
+            bool UpdateChangedMaterials();
+
+            //! Uploads the texture indices if any of them changed.
+            void UpdateBuffer();
+
+            //! Binds the buffer to the SceneSrg.
+            void UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg) const;
+
+            //! Returns the number of entries in the texture indices, which is the slot count times MaxTexturesPerMaterial.
+            uint32_t GetTextureEntryCount() const;
+
+            //! Calls the visitor for each texture entry that's a streaming image, with the position of the entry in the
+            //! texture indices. The slots can't be changed from the visitor.
+            using StreamingImageVisitor = AZStd::function<void(uint32_t entryIndex, RPI::StreamingImage& image)>;
+            void VisitStreamingImages(const StreamingImageVisitor& visitor) const;
+
+            //! Returns an id that's the same for materials that can share a draw call in the bindless material path.
+            //! These materials have the same material type, shader variants, render states and MaterialSrg constants.
+            static Data::InstanceId GetMergedMaterialId(const RPI::Material& material);
+
+        private:
+            struct Slot
+            {
+                Data::Instance<RPI::Material> m_material;
+                RPI::Material::ChangeId m_changeId = RPI::Material::DEFAULT_CHANGE_ID;
+                Data::InstanceId m_mergedMaterialId;
+                uint32_t m_refCount = 0;
+            };
+
+            //! Writes the bindless read indices of the image properties of the slot's material, in property order.
+            void WriteTextureIndices(uint32_t slotIndex);
+
+            mutable AZStd::mutex m_mutex;
+            AZStd::vector<Slot> m_slots;
+            AZStd::vector<uint32_t> m_freeSlots;
+            AZStd::unordered_map<Data::InstanceId, uint32_t> m_slotsByMaterialId;
+
+            AZStd::vector<uint32_t> m_textureIndices;
+            //! The streaming images of the texture entries, in the same order as m_textureIndices
+            AZStd::vector<Data::Instance<RPI::StreamingImage>> m_streamingImages;
+            GpuBufferHandler m_bufferHandler;
+            bool m_bufferNeedsUpdate = false;
+        };
+    } // namespace Render
+} // namespace AZ
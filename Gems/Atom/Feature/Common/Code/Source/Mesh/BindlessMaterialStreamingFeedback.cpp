@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/BindlessMaterialDataBuffer.h>
+#include <Mesh/BindlessMaterialStreamingFeedback.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            // The shaders record the frame in the upper 24 bits of each entry
+            constexpr uint32_t FrameMax = 0x00FFFFFF;
+
+            // The feedback buffer grows in multiples of this many entries, so it isn't replaced every time a material is added
+            constexpr uint32_t EntryGrowthGranularity = 1024;
+
+            constexpr uint16_t UnsampledMip = 0xFFFF;
+
+            // Streaming images clamp the target mip to the least detailed mip of the image
+            constexpr uint16_t LeastDetailedMip = RHI::Limits::Image::MipCountMax - 1;
+        }
+
+        void BindlessMaterialStreamingFeedback::Init()
+        {
+            m_frame = 0;
+            m_framesSinceCopy = 0;
+        }
+
+        void BindlessMaterialStreamingFeedback::Shutdown()
+        {
+            AZStd::scoped_lock lock(m_readbackMutex);
+            ResetImages();
+            m_feedbackBuffer = nullptr;
+            m_entryCount = 0;
+            m_readbackBuffers = {};
+            m_readbackIndex = 0;
+            m_sampledMips = {};
+            m_hasNewFeedback = false;
+        }
+
+        void BindlessMaterialStreamingFeedback::Update(const BindlessMaterialDataBuffer& bindlessMaterialData)
+        {
+            AZ_PROFILE_SCOPE(RPI, "BindlessMaterialStreamingFeedback: Update");
+
+            AZStd::scoped_lock lock(m_readbackMutex);
+
+            // The images keep the mip levels the feedback requested last, so they need to be restored when the pass stops running
+            if (++m_framesSinceCopy > RHI::Limits::Device::FrameCountMax * 2 && !m_imageStates.empty())
+            {
+                ResetImages();
+            }
+
+            // The entries are never cleared, so the buffer is replaced when the frame wraps around, otherwise the entries of the
+            // frames before the wrap would always win
+            m_frame = m_frame == FrameMax ? 1 : m_frame + 1;
+            const uint32_t requiredEntryCount = bindlessMaterialData.GetTextureEntryCount();
+            if (requiredEntryCount > m_entryCount || (m_frame == 1 && m_feedbackBuffer))
+            {
+                m_entryCount = AZStd::max(RoundUpToMultiple(requiredEntryCount, EntryGrowthGranularity), m_entryCount);
+                AZStd::vector<uint32_t> initialData(m_entryCount, 0);
+
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+                desc.m_bufferName = "BindlessMaterialMipFeedback";
+                desc.m_elementSize = sizeof(uint32_t);
+                desc.m_byteCount = uint64_t(m_entryCount) * sizeof(uint32_t);
+                desc.m_bufferData = initialData.data();
+                m_feedbackBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            }
+
+            if (!m_hasNewFeedback)
+            {
+                return;
+            }
+            m_hasNewFeedback = false;
+
+            for (auto& [image, state] : m_imageStates)
+            {
+                state.m_isReferenced = false;
+                state.m_isSampled = false;
+            }
+
+            // Images can be used by more than one material, in which case the most detailed level any of them samples wins
+            bindlessMaterialData.VisitStreamingImages(
+                [this](uint32_t entryIndex, RPI::StreamingImage& image)
+                {
+                    ImageState& state = m_imageStates[&image];
+                    if (!state.m_image)
+                    {
+                        state.m_image = &image;
+                    }
+                    state.m_isReferenced = true;
+
+                    if (entryIndex < m_sampledMips.size() && m_sampledMips[entryIndex] != UnsampledMip)
+                    {
+                        // The shaders record the level relative to the most detailed resident mip
+                        const int32_t mipLevel = AZStd::max(
+                            int32_t(image.GetResidentMipLevel()) + int32_t(m_sampledMips[entryIndex]) - int32_t(MipOffsetBias), 0);
+                        const uint16_t sampledMip = aznumeric_cast<uint16_t>(AZStd::min(mipLevel, int32_t(LeastDetailedMip)));
+                        state.m_sampledMip = state.m_isSampled ? AZStd::min(state.m_sampledMip, sampledMip) : sampledMip;
+                        state.m_isSampled = true;
+                        state.m_hasFeedback = true;
+                    }
+                });
+
+            for (auto stateIter = m_imageStates.begin(); stateIter != m_imageStates.end();)
+            {
+                ImageState& state = stateIter->second;
+                if (!state.m_isReferenced)
+                {
+                    // The image isn't used by the bindless material path anymore
+                    RequestMip(state, 0);
+                    stateIter = m_imageStates.erase(stateIter);
+                    continue;
+                }
+
+                if (state.m_isSampled)
+                {
+                    state.m_unsampledCount = 0;
+                    if (state.m_sampledMip < state.m_targetMip)
+                    {
+                        state.m_coarserCount = 0;
+                        RequestMip(state, state.m_sampledMip);
+                    }
+                    else if (state.m_sampledMip > state.m_targetMip)
+                    {
+                        if (++state.m_coarserCount >= ReduceDetailDelay)
+                        {
+                            state.m_coarserCount = 0;
+                            RequestMip(state, state.m_sampledMip);
+                        }
+                    }
+                    else
+                    {
+                        state.m_coarserCount = 0;
+                    }
+                }
+                else if (state.m_hasFeedback)
+                {
+                    state.m_coarserCount = 0;
+                    if (++state.m_unsampledCount >= UnsampledDelay)
+                    {
+                        RequestMip(state, LeastDetailedMip);
+                    }
+                }
+                ++stateIter;
+            }
+        }
+
+        void BindlessMaterialStreamingFeedback::UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg)
+        {
+            if (m_feedbackBuffer)
+            {
+                sceneSrg->SetBufferView(m_feedbackBufferIndex, m_feedbackBuffer->GetBufferView());
+                sceneSrg->SetConstant(m_feedbackFrameIndex, m_frame);
+            }
+        }
+
+        bool BindlessMaterialStreamingFeedback::PrepareCopy(RHI::CopyBufferDescriptor& copyDescriptor)
+        {
+            AZStd::scoped_lock lock(m_readbackMutex);
+
+            m_framesSinceCopy = 0;
+            if (!m_feedbackBuffer)
+            {
+                return false;
+            }
+
+            // The next buffer in the ring was copied to FrameCountMax frames ago, so the GPU is done with it
+            ReadbackBuffer& readbackBuffer = m_readbackBuffers[m_readbackIndex];
+            m_readbackIndex = (m_readbackIndex + 1) % RHI::Limits::Device::FrameCountMax;
+            if (readbackBuffer.m_frame != 0)
+            {
+                ReadFeedback(readbackBuffer);
+            }
+
+            const uint64_t byteCount = uint64_t(m_entryCount) * sizeof(uint32_t);
+            if (!readbackBuffer.m_buffer || readbackBuffer.m_buffer->GetBufferSize() < byteCount)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadBack;
+                desc.m_bufferName = "BindlessMaterialMipFeedbackReadback";
+                desc.m_elementSize = sizeof(uint32_t);
+                desc.m_byteCount = byteCount;
+                readbackBuffer.m_buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!readbackBuffer.m_buffer)
+                {
+                    return false;
+                }
+            }
+            readbackBuffer.m_frame = m_frame;
+            readbackBuffer.m_entryCount = m_entryCount;
+
+            copyDescriptor.m_sourceBuffer = m_feedbackBuffer->GetRHIBuffer();
+            copyDescriptor.m_sourceOffset = 0;
+            copyDescriptor.m_destinationBuffer = readbackBuffer.m_buffer->GetRHIBuffer();
+            copyDescriptor.m_destinationOffset = 0;
+            copyDescriptor.m_size = aznumeric_cast<uint32_t>(byteCount);
+            return true;
+        }
+
+        const Data::Instance<RPI::Buffer>& BindlessMaterialStreamingFeedback::GetFeedbackBuffer() const
+        {
+            return m_feedbackBuffer;
+        }
+
+        void BindlessMaterialStreamingFeedback::ReadFeedback(ReadbackBuffer& readbackBuffer)
+        {
+            const uint32_t frame = readbackBuffer.m_frame;
+            readbackBuffer.m_frame = 0;
+
+            const uint64_t byteCount = uint64_t(readbackBuffer.m_entryCount) * sizeof(uint32_t);
+            const uint32_t* entries = static_cast<const uint32_t*>(readbackBuffer.m_buffer->Map(byteCount, 0));
+            if (!entries)
+            {
+                return;
+            }
+
+            m_sampledMips.assign(readbackBuffer.m_entryCount, UnsampledMip);
+            for (uint32_t entryIndex = 0; entryIndex < readbackBuffer.m_entryCount; ++entryIndex)
+            {
+                const uint32_t entryFrame = entries[entryIndex] >> 8;
+                if (entryFrame != 0 && entryFrame <= frame && frame - entryFrame < SampledFrameWindow)
+                {
+                    m_sampledMips[entryIndex] = aznumeric_cast<uint16_t>(255 - (entries[entryIndex] & 0xFF));
+                }
+            }
+            readbackBuffer.m_buffer->Unmap();
+
+            m_hasNewFeedback = true;
+        }
+
+        void BindlessMaterialStreamingFeedback::RequestMip(ImageState& state, uint16_t mipLevel)
+        {
+            if (state.m_targetMip != mipLevel)
+            {
+                state.m_targetMip = mipLevel;
+                state.m_image->SetTargetMip(mipLevel);
+            }
+        }
+
+        void BindlessMaterialStreamingFeedback::ResetImages()
+        {
+            for (auto& [image, state] : m_imageStates)
+            {
+                RequestMip(state, 0);
+            }
+            m_imageStates.clear();
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/CopyItem.h>
+#include <Atom/RHI.Reflect/Limits.h>
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class ShaderResourceGroup;
+    }
+
+    namespace Render
+    {
+        class BindlessMaterialDataBuffer;
+
+        //! Drives the mip levels of the streaming images of the bindless material path from the mip levels the shaders actually
+        //! sample them at, so the resident texture memory follows what's visible on screen.
+        //!
+        //! Shaders record the mip level of each texture they sample with RecordBindlessMaterialMipFeedback, see BindlessMaterial.azsli,
+        //! into a feedback buffer on the SceneSrg with an entry per texture entry of the BindlessMaterialDataBuffer. The
+        //! BindlessMaterialStreamingFeedbackPass copies the feedback buffer to a ring of read back buffers, which are read once
+        //! the GPU is done with them. More detail is requested as soon as it's sampled, while detail is only dropped once the
+        //! texture was sampled at a coarser level for a while, so the images don't stream in and out as the camera moves.
+        //!
+        //! Nothing is requested until the pass runs, so images keep their default target when the pass isn't in the pipeline.
+        class BindlessMaterialStreamingFeedback
+        {
+        public:
+            //! Must match BindlessMaterialFeedbackMipBias in BindlessMaterial.azsli. Lets the shaders record the levels that need
+            //! more detail than is resident.
+            static constexpr uint32_t MipOffsetBias = 16;
+
+            //! The number of read backs a texture needs to be sampled at a coarser level before its detail is reduced
+            static constexpr uint32_t ReduceDetailDelay = 30;
+
+            //! The number of read backs a texture needs to be unsampled before only its least detailed mip is kept
+            static constexpr uint32_t UnsampledDelay = 120;
+
+            //! Feedback that was recorded within this many frames of the read back counts as sampled, since each frame only
+            //! records one in 16 pixels
+            static constexpr uint32_t SampledFrameWindow = 16;
+
+            void Init();
+            void Shutdown();
+
+            //! Grows the feedback buffer to the texture entries of the bindless material data and applies the latest read back
+            //! to the streaming images. Called once per frame, before the frame is rendered.
+            void Update(const BindlessMaterialDataBuffer& bindlessMaterialData);
+
+            //! Binds the feedback buffer and the frame number to the SceneSrg.
+            void UpdateSceneSrg(RPI::ShaderResourceGroup* sceneSrg);
+
+            //! Called by the BindlessMaterialStreamingFeedbackPass every frame. Reads the oldest read back buffer, which the GPU is
+            //! done with, and fills the descriptor to copy the feedback buffer into it. Returns false if there's nothing to copy.
+            bool PrepareCopy(RHI::CopyBufferDescriptor& copyDescriptor);
+
+            //! The buffer the shaders write the feedback to
+            const Data::Instance<RPI::Buffer>& GetFeedbackBuffer() const;
+
+        private:
+            struct ReadbackBuffer
+            {
+                Data::Instance<RPI::Buffer> m_buffer;
+                //! The frame the feedback was copied in, or 0 if the buffer has no feedback to read
+                uint32_t m_frame = 0;
+                uint32_t m_entryCount = 0;
+            };
+
+            struct ImageState
+            {
+                Data::Instance<RPI::StreamingImage> m_image;
+                //! The most detailed mip level the image was sampled at in the latest read back
+                uint16_t m_sampledMip = 0;
+                //! The mip level that was last requested for the image
+                uint16_t m_targetMip = 0;
+                uint32_t m_coarserCount = 0;
+                uint32_t m_unsampledCount = 0;
+                bool m_isSampled = false;
+                bool m_isReferenced = false;
+                //! Set once any shader recorded feedback for the image. Images of shaders that don't record feedback are left alone.
+                bool m_hasFeedback = false;
+            };
+
+            //! Decodes the read back buffer into m_sampledMips
+            void ReadFeedback(ReadbackBuffer& readbackBuffer);
+
+            //! Requests the mip level for the image if it differs from the one that was last requested
+            static void RequestMip(ImageState& state, uint16_t mipLevel);
+
+            //! Restores the default target mip of every image the feedback requested a mip level for
+            void ResetImages();
+
+            Data::Instance<RPI::Buffer> m_feedbackBuffer;
+            uint32_t m_entryCount = 0;
+            RHI::ShaderInputNameIndex m_feedbackBufferIndex = "m_bindlessMaterialMipFeedback";
+            RHI::ShaderInputNameIndex m_feedbackFrameIndex = "m_bindlessMaterialFeedbackFrame";
+
+            //! Increments every frame and wraps to 1 before it overflows the 24 bits the shaders record it in
+            uint32_t m_frame = 0;
+
+            AZStd::mutex m_readbackMutex;
+            AZStd::array<ReadbackBuffer, RHI::Limits::Device::FrameCountMax> m_readbackBuffers;
+            uint32_t m_readbackIndex = 0;
+            //! The encoded mip level each texture entry was sampled at in the latest read back, or UnsampledMip
+            AZStd::vector<uint16_t> m_sampledMips;
+            bool m_hasNewFeedback = false;
+            //! The number of updates since the pass last copied the feedback
+            uint32_t m_framesSinceCopy = 0;
+
+            AZStd::unordered_map<RPI::StreamingImage*, ImageState> m_imageStates;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/FrameScheduler.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Mesh/BindlessMaterialStreamingFeedbackPass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<BindlessMaterialStreamingFeedbackPass> BindlessMaterialStreamingFeedbackPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<BindlessMaterialStreamingFeedbackPass> pass = aznew BindlessMaterialStreamingFeedbackPass(descriptor);
+            return pass;
+        }
+
+        BindlessMaterialStreamingFeedbackPass::BindlessMaterialStreamingFeedbackPass(const RPI::PassDescriptor& descriptor)
+            : Pass(descriptor)
+        {
+        }
+
+        void BindlessMaterialStreamingFeedbackPass::BuildInternal()
+        {
+            InitScope(RHI::ScopeId(GetPathName()));
+        }
+
+        void BindlessMaterialStreamingFeedbackPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            RPI::Scene* scene = GetScene();
+            MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            if (!meshFeatureProcessor || !meshFeatureProcessor->IsBindlessMaterialsEnabled())
+            {
+                return;
+            }
+
+            BindlessMaterialStreamingFeedback& streamingFeedback = meshFeatureProcessor->GetBindlessMaterialStreamingFeedback();
+            if (streamingFeedback.PrepareCopy(m_copyDescriptor))
+            {
+                m_feedbackBuffer = streamingFeedback.GetFeedbackBuffer();
+                params.m_frameGraphBuilder->ImportScopeProducer(*this);
+            }
+        }
+
+        void BindlessMaterialStreamingFeedbackPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            const RHI::AttachmentId& attachmentId = m_feedbackBuffer->GetAttachmentId();
+            if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+            {
+                [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportBuffer(attachmentId, m_feedbackBuffer->GetRHIBuffer());
+                AZ_Assert(result == RHI::ResultCode::Success, "Failed to import the bindless material mip feedback buffer with error %d", result);
+            }
+
+            RHI::BufferScopeAttachmentDescriptor desc;
+            desc.m_attachmentId = attachmentId;
+            desc.m_bufferViewDescriptor = m_feedbackBuffer->GetBufferViewDescriptor();
+            desc.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+            frameGraph.UseCopyAttachment(desc, RHI::ScopeAttachmentAccess::Read);
+        }
+
+        void BindlessMaterialStreamingFeedbackPass::CompileResources([[maybe_unused]] const RHI::FrameGraphCompileContext& context)
+        {
+        }
+
+        void BindlessMaterialStreamingFeedbackPass::BuildCommandList(const RHI::FrameGraphExecuteContext& context)
+        {
+            context.GetCommandList()->Submit(m_copyDescriptor);
+        }
+    }   // namespace Render
+}   // namespace AZ
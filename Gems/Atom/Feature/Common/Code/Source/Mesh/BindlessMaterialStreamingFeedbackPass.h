@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/CopyItem.h>
+#include <Atom/RHI/ScopeProducer.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/Pass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! This pass copies the mip feedback the shaders of the bindless material path wrote this frame to a read back buffer,
+        //! so the MeshFeatureProcessor can drive the streaming image mips from it, see BindlessMaterialStreamingFeedback.
+        //! It needs to run after the passes that draw the meshes.
+        class BindlessMaterialStreamingFeedbackPass final
+            : public RPI::Pass
+            , public RHI::ScopeProducer
+        {
+            AZ_RPI_PASS(BindlessMaterialStreamingFeedbackPass);
+
+        public:
+            AZ_RTTI(BindlessMaterialStreamingFeedbackPass, "{5B3C7E1A-92D4-4F08-8A6E-1C4D2F7B9E35}", RPI::Pass);
+            AZ_CLASS_ALLOCATOR(BindlessMaterialStreamingFeedbackPass, SystemAllocator);
+
+            //! Creates a BindlessMaterialStreamingFeedbackPass
+            static RPI::Ptr<BindlessMaterialStreamingFeedbackPass> Create(const RPI::PassDescriptor& descriptor);
+
+            ~BindlessMaterialStreamingFeedbackPass() = default;
+
+        private:
+            explicit BindlessMaterialStreamingFeedbackPass(const RPI::PassDescriptor& descriptor);
+
+            // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandList(const RHI::FrameGraphExecuteContext& context) override;
+
+            // Pass overrides...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            Data::Instance<RPI::Buffer> m_feedbackBuffer;
+            RHI::CopyBufferDescriptor m_copyDescriptor;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -92,6 +92,8 @@ namespace AZ
             AZ::Name::FromStringLiteral("m_rootConstantInstanceDataOffset", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_o_meshInstancingIsEnabled_Name =
             AZ::Name::FromStringLiteral("o_meshInstancingIsEnabled", AZ::Interface<AZ::NameDictionary>::Get());
+        static AZ::Name s_o_meshBindlessMaterial_Name =
+            AZ::Name::FromStringLiteral("o_meshBindlessMaterial", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_transparent_Name = AZ::Name::FromStringLiteral("transparent", AZ::Interface<AZ::NameDictionary>::Get());
         static AZ::Name s_block_silhouette_Name = AZ::Name::FromStringLiteral("silhouette.blockSilhouette", AZ::Interface<AZ::NameDictionary>::Get());
 
@@ -136,6 +138,17 @@ namespace AZ
             RPI::ShaderSystemInterface::Get()->Connect(m_handleGlobalShaderOptionUpdate);
             EnableSceneNotification();
 
+            m_bindlessMaterialData.Init();
+            m_bindlessMaterialStreamingFeedback.Init();
+            m_updateSceneSrgHandler = RPI::Scene::PrepareSceneSrgEvent::Handler(
+                [this](RPI::ShaderResourceGroup* sceneSrg)
+                {
+                    m_bindlessMaterialData.UpdateSceneSrg(sceneSrg);
+                    m_bindlessMaterialStreamingFeedback.UpdateSceneSrg(sceneSrg);
+                });
+            GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
+            m_gpuDrivenInstancing.Init();
+
             // Must read cvar from AZ::Console due to static variable in multiple libraries, see ghi-5537
             bool enablePerMeshShaderOptionFlagsCvar = false;
             if (auto* console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
@@ -147,6 +160,7 @@ namespace AZ
             }
 
             m_meshMovedFlag = GetParentScene()->GetViewTagBitRegistry().AcquireTag(MeshCommon::MeshMovedName);
+            m_meshAlwaysDynamicFlag = GetParentScene()->GetViewTagBitRegistry().AcquireTag(MeshCommon::MeshAlwaysDynamicName);
             m_meshMotionDrawListTag = AZ::RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->AcquireTag(MeshCommon::MotionDrawListTagName);
             m_transparentDrawListTag = AZ::RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->AcquireTag(s_transparent_Name);
             
@@ -167,6 +181,18 @@ namespace AZ
                         "r_meshInstancingEnabledForTransparentObjects %s", m_enableMeshInstancingForTransparentObjects ? "true" : "false")
                         .c_str());
 
+                console->GetCvarValue("r_meshBindlessMaterials", m_enableBindlessMaterials);
+
+                // push the cvars value so anything in this dll can access it directly.
+                console->PerformCommand(
+                    AZStd::string::format("r_meshBindlessMaterials %s", m_enableBindlessMaterials ? "true" : "false").c_str());
+
+                console->GetCvarValue("r_meshGpuDrivenInstancing", m_enableGpuDrivenInstancing);
+
+                // push the cvars value so anything in this dll can access it directly.
+                console->PerformCommand(
+                    AZStd::string::format("r_meshGpuDrivenInstancing %s", m_enableGpuDrivenInstancing ? "true" : "false").c_str());
+
                 size_t meshInstancingBucketSortScatterBatchSize;
                 console->GetCvarValue("r_meshInstancingBucketSortScatterBatchSize", meshInstancingBucketSortScatterBatchSize);
 
@@ -183,6 +209,7 @@ namespace AZ
             m_flagRegistry.reset();
 
             m_handleGlobalShaderOptionUpdate.Disconnect();
+            m_updateSceneSrgHandler.Disconnect();
 
             DisableSceneNotification();
             AZ_Warning("MeshFeatureProcessor", m_modelData.size() == 0,
@@ -193,7 +220,15 @@ namespace AZ
             m_reflectionProbeFeatureProcessor = nullptr;
             m_forceRebuildDrawPackets = false;
 
+            m_perViewInstanceMaterialData.clear();
+            m_perViewInstanceMaterialDataBufferHandlers.clear();
+            m_bindlessMaterialStreamingFeedback.Shutdown();
+            m_bindlessMaterialData.Shutdown();
+            m_gpuDrivenInstancing.Shutdown();
+            m_perViewGpuDriven.clear();
+
             GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshMovedFlag);
+            GetParentScene()->GetViewTagBitRegistry().ReleaseTag(m_meshAlwaysDynamicFlag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_meshMotionDrawListTag);
             RHI::RHISystemInterface::Get()->GetDrawListTagRegistry()->ReleaseTag(m_transparentDrawListTag);
         }
@@ -218,6 +253,16 @@ namespace AZ
             // If the instancing cvar has changed, we need to re-initalize the ModelDataInstances
             CheckForInstancingCVarChange();
 
+            // If a material that was merged with other materials in the bindless material path changed in a way that it can't share
+            // their draw calls anymore, the instance groups have to be rebuilt
+            if (m_enableBindlessMaterials && m_enableMeshInstancing && m_bindlessMaterialData.UpdateChangedMaterials())
+            {
+                for (auto& modelDataInstance : m_modelData)
+                {
+                    modelDataInstance.ReInit(this);
+                }
+            }
+
             AZStd::vector<Job*> initJobQueue = CreateInitJobQueue();
             AZStd::vector<Job*> updateCullingJobQueue = CreateUpdateCullingJobQueue();
 
@@ -240,14 +285,23 @@ namespace AZ
                 // Updating the culling scene must happen after the per-instance group work is done
                 // because the per-instance group work will update the draw packets.
                 ExecuteSimulateJobQueue(updateCullingJobQueue, parentJob);
+
+                // The init jobs are done, so upload the texture indices of any new materials in the bindless material path
+                m_bindlessMaterialData.UpdateBuffer();
             }
 
+            // Applies the mip feedback of the textures of the bindless material path to their streaming images
+            m_bindlessMaterialStreamingFeedback.Update(m_bindlessMaterialData);
+
             m_forceRebuildDrawPackets = false;
         }
 
         void MeshFeatureProcessor::CheckForInstancingCVarChange()
         {
-            if (m_enableMeshInstancing != r_meshInstancingEnabled || m_enableMeshInstancingForTransparentObjects != r_meshInstancingEnabledForTransparentObjects)
+            if (m_enableMeshInstancing != r_meshInstancingEnabled ||
+                m_enableMeshInstancingForTransparentObjects != r_meshInstancingEnabledForTransparentObjects ||
+                m_enableBindlessMaterials != r_meshBindlessMaterials ||
+                m_enableGpuDrivenInstancing != r_meshGpuDrivenInstancing)
             {
                 // DeInit and re-init every object
                 for (auto& modelDataInstance : m_modelData)
@@ -256,6 +310,8 @@ namespace AZ
                 }
                 m_enableMeshInstancing = r_meshInstancingEnabled;
                 m_enableMeshInstancingForTransparentObjects = r_meshInstancingEnabledForTransparentObjects;
+                m_enableBindlessMaterials = r_meshBindlessMaterials;
+                m_enableGpuDrivenInstancing = r_meshGpuDrivenInstancing;
             }
         }
 
@@ -473,6 +529,17 @@ namespace AZ
                 // If necessary, allocate memory up front for the work that needs to be done this frame
                 ResizePerViewInstanceVectors(packet.m_views.size());
 
+                // Decide which views cull and draw their GPU driven instance groups on the GPU this frame
+                m_perViewGpuDriven.assign(packet.m_views.size(), false);
+                if (IsGpuDrivenInstancingEnabled())
+                {
+                    m_gpuDrivenInstancing.UpdateGroups(m_meshInstanceManager);
+                    for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
+                    {
+                        m_perViewGpuDriven[viewIndex] = m_gpuDrivenInstancing.BeginView(packet.m_views[viewIndex].get());
+                    }
+                }
+
                 {
                     // Iterate over all of the visible objects for each view, and perform the first stage of the bucket sort
                     // where each visible object is sorted into its bucket
@@ -537,6 +604,11 @@ namespace AZ
                     viewCount, AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>());
             }
 
+            if (m_perViewInstanceMaterialData.size() <= viewCount)
+            {
+                m_perViewInstanceMaterialData.resize(viewCount, AZStd::vector<uint32_t>());
+            }
+
             if (m_perViewInstanceGroupBuckets.size() <= viewCount)
             {
                 m_perViewInstanceGroupBuckets.resize(viewCount, AZStd::vector<InstanceGroupBucket>());
@@ -561,6 +633,21 @@ namespace AZ
                 }
             }
 
+            if (m_perViewInstanceMaterialDataBufferHandlers.size() <= viewCount)
+            {
+                GpuBufferHandler::Descriptor desc;
+                desc.m_bufferName = "MeshInstanceMaterialDataBuffer";
+                desc.m_bufferSrgName = "m_instanceMaterialData";
+                desc.m_elementSize = sizeof(uint32_t);
+                desc.m_srgLayout = RPI::RPISystemInterface::Get()->GetViewSrgLayout().get();
+
+                m_perViewInstanceMaterialDataBufferHandlers.reserve(viewCount);
+                while (m_perViewInstanceMaterialDataBufferHandlers.size() < viewCount)
+                {
+                    m_perViewInstanceMaterialDataBufferHandlers.push_back(GpuBufferHandler(desc));
+                }
+            }
+
             AZStd::vector<uint32_t> perBucketInstanceCounts;
             const auto instanceManagerRanges = m_meshInstanceManager.GetParallelRanges();
             if (instanceManagerRanges.size() > 0)
@@ -654,6 +741,7 @@ namespace AZ
             if (visibleObjectCount > 0)
             {
                 perViewInstanceData.clear();
+                m_perViewInstanceMaterialData[viewIndex].clear();
 
                 static const AZ::TaskDescriptor addVisibleObjectsToBucketsTaskDescriptor{
                     "AZ::Render::MeshFeatureProcessor::OnEndCulling - AddVisibleObjectsToBuckets", "Graphics"
@@ -661,6 +749,7 @@ namespace AZ
 
                 size_t batchSize = r_meshInstancingBucketSortScatterBatchSize;
                 size_t batchCount = AZ::DivideAndRoundUp(visibleObjectCount, batchSize);
+                const bool isGpuDrivenView = m_perViewGpuDriven[viewIndex];
 
                 for (size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
                 {
@@ -670,7 +759,7 @@ namespace AZ
 
                     addVisibleObjectsToBucketsTG.AddTask(
                         addVisibleObjectsToBucketsTaskDescriptor,
-                        [this, view, viewIndex, batchStart, currentBatchCount]()
+                        [this, view, viewIndex, batchStart, currentBatchCount, isGpuDrivenView]()
                         {
                             RPI::VisibleObjectListView visibilityList = view->GetVisibleObjectList();
                             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
@@ -682,9 +771,16 @@ namespace AZ
 
                                 for (const ModelDataInstance::PostCullingInstanceData& postCullingData : *postCullingInstanceDataList)
                                 {
+                                    // The MeshGpuDrivenCullingPass culls and writes the instances of GPU driven groups for this view
+                                    if (isGpuDrivenView && postCullingData.m_instanceGroupHandle->m_isGpuDriven)
+                                    {
+                                        continue;
+                                    }
+
                                     SortInstanceData instanceData;
                                     instanceData.m_instanceGroupHandle = postCullingData.m_instanceGroupHandle;
                                     instanceData.m_objectId = postCullingData.m_objectId;
+                                    instanceData.m_bindlessMaterialSlot = postCullingData.m_bindlessMaterialSlot;
                                     instanceData.m_depth = visibleObject.m_depth;
 
                                     // Sort transparent objects in reverse by making their depths negative.
@@ -796,6 +892,7 @@ namespace AZ
             TaskGraph& buildInstanceBufferTG, size_t viewIndex, const RPI::ViewPtr& view)
         {
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
+            AZStd::vector<uint32_t>& perViewInstanceMaterialData = m_perViewInstanceMaterialData[viewIndex];
             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
 
             uint32_t currentBatchStart = 0;
@@ -812,7 +909,7 @@ namespace AZ
                         [currentBatchStart,
                         viewIndex,
                         &view,
-                        &perViewInstanceData, &instanceGroupBucket]()
+                        &perViewInstanceData, &perViewInstanceMaterialData, &instanceGroupBucket]()
                         {
                             ModelDataInstance::InstanceGroupHandle currentInstanceGroup =
                                 instanceGroupBucket.m_sortInstanceData.begin()->m_instanceGroupHandle;
@@ -833,6 +930,7 @@ namespace AZ
                                     currentInstanceGroup = sortInstanceData.m_instanceGroupHandle;
                                 }
                                 perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                                perViewInstanceMaterialData[instanceDataIndex] = sortInstanceData.m_bindlessMaterialSlot;
                                 accumulatedDepth += sortInstanceData.m_depth;
                                 instanceDataIndex++;
                             }
@@ -852,6 +950,7 @@ namespace AZ
             // currentBatchStart now represents the total count of visible instances in this view.
             // Re-size the instance data buffer so that we can fill it with the tasks created above
             perViewInstanceData.resize_no_construct(currentBatchStart);
+            perViewInstanceMaterialData.resize_no_construct(currentBatchStart);
         }
 
         void MeshFeatureProcessor::UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view)
@@ -867,6 +966,70 @@ namespace AZ
             // create output buffer descriptors
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             instanceDataBufferHandler.UpdateBuffer(perViewInstanceData.data(), static_cast<uint32_t>(perViewInstanceData.size()));
+
+            GpuBufferHandler& instanceMaterialDataBufferHandler = m_perViewInstanceMaterialDataBufferHandlers[viewIndex];
+            instanceMaterialDataBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
+            AZStd::vector<uint32_t>& perViewInstanceMaterialData = m_perViewInstanceMaterialData[viewIndex];
+            instanceMaterialDataBufferHandler.UpdateBuffer(
+                perViewInstanceMaterialData.data(), static_cast<uint32_t>(perViewInstanceMaterialData.size()));
+
+            if (m_perViewGpuDriven[viewIndex])
+            {
+                const uint32_t cpuInstanceCount = static_cast<uint32_t>(perViewInstanceData.size());
+                const RHI::IndirectBufferView* indirectBufferView =
+                    m_gpuDrivenInstancing.EndView(view.get(), instanceDataBufferHandler.GetBuffer(), cpuInstanceCount);
+                if (indirectBufferView)
+                {
+                    // The MeshGpuDrivenCullingPass copies the instance data written above to the front of its own instance data,
+                    // followed by the visible instances of the GPU driven groups. All draws of the view read from that instead.
+                    view->GetShaderResourceGroup()->SetBufferView(
+                        m_viewInstanceDataIndex, m_gpuDrivenInstancing.GetInstanceDataBuffer(view.get())->GetBufferView());
+                    AddGpuDrivenDrawPacketsToView(viewIndex, view, *indirectBufferView, cpuInstanceCount);
+                }
+            }
+        }
+
+        void MeshFeatureProcessor::AddGpuDrivenDrawPacketsToView(
+            size_t viewIndex, const RPI::ViewPtr& view, const RHI::IndirectBufferView& indirectBufferView, uint32_t cpuInstanceCount)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: AddGpuDrivenDrawPacketsToView");
+
+            const uint32_t drawArgumentsStride = m_gpuDrivenInstancing.GetDrawArgumentsStride();
+            for (const auto& iteratorRange : m_meshInstanceManager.GetParallelRanges())
+            {
+                for (auto instanceGroupIter = iteratorRange.m_begin; instanceGroupIter != iteratorRange.m_end; ++instanceGroupIter)
+                {
+                    MeshInstanceGroupData& instanceGroup = *instanceGroupIter;
+                    if (!instanceGroup.m_isGpuDriven || instanceGroup.m_count == 0)
+                    {
+                        continue;
+                    }
+
+                    if (instanceGroup.m_perViewIndirectDrawPackets.size() <= viewIndex)
+                    {
+                        instanceGroup.m_perViewIndirectDrawPackets.resize(viewIndex + 1);
+                    }
+
+                    RHI::Ptr<RHI::DrawPacket>& indirectDrawPacket = instanceGroup.m_perViewIndirectDrawPackets[viewIndex];
+                    if (!indirectDrawPacket)
+                    {
+                        RHI::DrawPacketBuilder drawPacketBuilder;
+                        indirectDrawPacket = drawPacketBuilder.Clone(instanceGroup.m_drawPacket.GetRHIDrawPacket());
+                    }
+
+                    // The culling pass writes the arguments of the group at its group index, including the visible instance count,
+                    // and its instances after the ones written by the CPU
+                    indirectDrawPacket->SetDrawArguments(
+                        RHI::DrawIndirect(1, indirectBufferView, uint64_t(instanceGroup.m_groupIndex) * drawArgumentsStride));
+
+                    uint32_t instanceOffset = cpuInstanceCount + m_gpuDrivenInstancing.GetGroupInstanceOffset(instanceGroup.m_groupIndex);
+                    AZStd::span<uint8_t> data{ reinterpret_cast<uint8_t*>(&instanceOffset), sizeof(uint32_t) };
+                    indirectDrawPacket->SetRootConstant(instanceGroup.m_drawRootConstantOffset, data);
+
+                    // The visible instances and their depths are only known on the GPU. Opaque draws are sorted by their sort key first.
+                    view->AddDrawPacket(indirectDrawPacket.get(), 0.0f);
+                }
+            }
         }
         
         void MeshFeatureProcessor::OnBeginPrepareRender()
@@ -986,7 +1149,8 @@ namespace AZ
             for (auto& model : m_modelData)
             {
                 model.m_cullable.m_prevShaderOptionFlags = model.m_cullable.m_shaderOptionFlags.exchange(0);
-                model.m_cullable.m_flags = model.m_flags.m_isAlwaysDynamic ? m_meshMovedFlag.GetIndex() : 0;
+                model.m_cullable.m_flags =
+                    model.m_flags.m_isAlwaysDynamic ? (m_meshMovedFlag.GetIndex() | m_meshAlwaysDynamicFlag.GetIndex()) : 0;
             }
         }
 
@@ -1523,6 +1687,44 @@ namespace AZ
             return m_enableMeshInstancing;
         }
 
+        BindlessMaterialDataBuffer& MeshFeatureProcessor::GetBindlessMaterialData()
+        {
+            return m_bindlessMaterialData;
+        }
+
+        bool MeshFeatureProcessor::IsBindlessMaterialsEnabled() const
+        {
+            return m_enableBindlessMaterials;
+        }
+
+        BindlessMaterialStreamingFeedback& MeshFeatureProcessor::GetBindlessMaterialStreamingFeedback()
+        {
+            return m_bindlessMaterialStreamingFeedback;
+        }
+
+        MeshGpuDrivenInstancing& MeshFeatureProcessor::GetGpuDrivenInstancing()
+        {
+            return m_gpuDrivenInstancing;
+        }
+
+        bool MeshFeatureProcessor::IsGpuDrivenInstancingEnabled() const
+        {
+            // The instance data written by the culling pass has no bindless material slots
+            return m_enableMeshInstancing && m_enableGpuDrivenInstancing && !m_enableBindlessMaterials;
+        }
+
+        void MeshFeatureProcessor::ForEachCullable(const AZStd::function<void(RPI::Cullable&)>& callback)
+        {
+            AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
+            for (ModelDataInstance& modelData : m_modelData)
+            {
+                if (modelData.m_model && !modelData.m_flags.m_needsInit)
+                {
+                    callback(modelData.m_cullable);
+                }
+            }
+        }
+
         void MeshFeatureProcessor::PrintShaderOptionFlags()
         {
             AZStd::map<FlagRegistry::TagType, AZ::Name> tags;
@@ -1785,6 +1987,16 @@ namespace AZ
                     for (PostCullingInstanceData& postCullingData : postCullingInstanceDataList)
                     {
                         postCullingData.m_instanceGroupHandle->RemoveAssociatedInstance(this);
+
+                        if (postCullingData.m_bindlessMaterialSlot != BindlessMaterialDataBuffer::InvalidIndex)
+                        {
+                            meshFeatureProcessor->GetBindlessMaterialData().ReleaseSlot(postCullingData.m_bindlessMaterialSlot);
+                        }
+
+                        if (postCullingData.m_gpuDrivenInstanceSlot != MeshGpuDrivenInstancing::InvalidSlot)
+                        {
+                            meshFeatureProcessor->GetGpuDrivenInstancing().ReleaseInstance(postCullingData.m_gpuDrivenInstanceSlot);
+                        }
                         
                         // Remove instance will decrement the use-count of the instance group, and only release the instance group
                         // if nothing else is referring to it.
@@ -1858,6 +2070,7 @@ namespace AZ
         {
             bool m_canSupportInstancing = false;
             bool m_isTransparent = false;
+            bool m_canSupportBindlessMaterial = false;
         };
 
         static MeshInstancingSupport CanSupportInstancing(
@@ -1879,6 +2092,7 @@ namespace AZ
             }
 
             bool shadersSupportInstancing = true;
+            bool shadersSupportBindlessMaterial = true;
             bool isTransparent = false;
             material->ForAllShaderItems(
                 [&](const Name&, const RPI::ShaderCollection::Item& shaderItem)
@@ -1895,6 +2109,13 @@ namespace AZ
                             return false; // break
                         }
 
+                        // Shaders that can read the material textures through bindless indices have the o_meshBindlessMaterial option.
+                        // All shader items need to support it for the material to be merged with other materials
+                        if (!shaderItem.GetShaderOptionGroup().GetShaderOptionLayout()->FindShaderOptionIndex(s_o_meshBindlessMaterial_Name).IsValid())
+                        {
+                            shadersSupportBindlessMaterial = false;
+                        }
+
                         // Get the DrawListTag. Use the explicit draw list override if exists.
                         AZ::RHI::DrawListTag drawListTag = shaderItem.GetDrawListTagOverride();
 
@@ -1922,6 +2143,7 @@ namespace AZ
                 });
 
             result.m_canSupportInstancing = shadersSupportInstancing;
+            result.m_canSupportBindlessMaterial = shadersSupportInstancing && shadersSupportBindlessMaterial;
             result.m_isTransparent = isTransparent;
             return result;
         }
@@ -1999,6 +2221,7 @@ namespace AZ
                 MeshInstanceManager::InsertResult instanceGroupInsertResult{ MeshInstanceManager::Handle{}, 0 };
 
                 MeshInstancingSupport instancingSupport;
+                bool useBindlessMaterial = false;
                 if (r_meshInstancingEnabled)
                 {
                     // Get the instance index for referencing the draw packet
@@ -2020,6 +2243,14 @@ namespace AZ
                     {
                         // If this object can be instanced, it gets a null uuid that will match other objects that can be instanced with it
                         key.m_forceInstancingOff = Uuid::CreateNull();
+
+                        // In the bindless material path, the shaders read the textures through the per-instance material slot,
+                        // so materials that only differ by their textures can share the same instance group
+                        if (r_meshBindlessMaterials && instancingSupport.m_canSupportBindlessMaterial)
+                        {
+                            key.m_materialId = BindlessMaterialDataBuffer::GetMergedMaterialId(*material);
+                            useBindlessMaterial = true;
+                        }
                     }
                     else
                     {
@@ -2039,6 +2270,15 @@ namespace AZ
                     postCullingData.m_instanceGroupHandle = instanceGroupInsertResult.m_handle;
                     postCullingData.m_instanceGroupPageIndex = instanceGroupInsertResult.m_pageIndex;
                     postCullingData.m_objectId = m_objectId;
+                    if (useBindlessMaterial)
+                    {
+                        postCullingData.m_bindlessMaterialSlot = meshFeatureProcessor->GetBindlessMaterialData().AcquireSlot(material);
+                    }
+                    if (meshFeatureProcessor->IsGpuDrivenInstancingEnabled())
+                    {
+                        // The entry is filled in once the cull bounds are known
+                        postCullingData.m_gpuDrivenInstanceSlot = meshFeatureProcessor->GetGpuDrivenInstancing().AcquireInstance();
+                    }
                     // Mark the group as transparent so that the depth can be sorted in reverse
                     postCullingData.m_instanceGroupHandle->m_isTransparent = instancingSupport.m_isTransparent;
                     m_postCullingInstanceDataByLod[modelLodIndex].push_back(postCullingData);
@@ -2066,6 +2306,11 @@ namespace AZ
                         drawPacket.SetShaderOption(s_o_meshInstancingIsEnabled_Name, AZ::RPI::ShaderOptionValue{ true });
                     }
 
+                    if (useBindlessMaterial)
+                    {
+                        drawPacket.SetShaderOption(s_o_meshBindlessMaterial_Name, AZ::RPI::ShaderOptionValue{ true });
+                    }
+
                     bool blockSilhouettes = false;
                     if (auto index = material->FindPropertyIndex(s_block_silhouette_Name); index.IsValid())
                     {
@@ -2818,7 +3063,7 @@ namespace AZ
             m_flags.m_cullBoundsNeedsUpdate = true;
         }
 
-        void ModelDataInstance::UpdateCullBounds(const MeshFeatureProcessor* meshFeatureProcessor)
+        void ModelDataInstance::UpdateCullBounds(MeshFeatureProcessor* meshFeatureProcessor)
         {
             AZ_Assert(m_flags.m_cullBoundsNeedsUpdate, "This function only needs to be called if the culling bounds need to be rebuilt");
             AZ_Assert(m_model, "The model has not finished loading yet");
@@ -2839,6 +3084,8 @@ namespace AZ
             m_cullable.m_cullData.m_boundingObb = localAabb.GetTransformedObb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
+            // Occlusion results were computed for the previous bounds
+            m_cullable.m_cullData.m_occludedInView = nullptr;
             if (!r_meshInstancingEnabled)
             {
                 m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
@@ -2849,9 +3096,52 @@ namespace AZ
             }
             m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
 
+            if (r_meshInstancingEnabled)
+            {
+                UpdateGpuDrivenInstances(meshFeatureProcessor);
+            }
+
             m_flags.m_cullBoundsNeedsUpdate = false;
         }
 
+        void ModelDataInstance::UpdateGpuDrivenInstances(MeshFeatureProcessor* meshFeatureProcessor)
+        {
+            MeshGpuDrivenInstancing& gpuDrivenInstancing = meshFeatureProcessor->GetGpuDrivenInstancing();
+            const RPI::Cullable::LodData& lodData = m_cullable.m_lodData;
+            const Aabb& worldAabb = m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume;
+
+            MeshGpuDrivenInstancing::Instance instance;
+            worldAabb.GetMin().StoreToFloat3(instance.m_aabbMin);
+            worldAabb.GetMax().StoreToFloat3(instance.m_aabbMax);
+            instance.m_objectId = m_objectId.GetIndex();
+            instance.m_lodSelectionRadius = lodData.m_lodSelectionRadius;
+            instance.m_hideFlags = m_cullable.m_isHidden ? MeshGpuDrivenInstancing::HiddenFlag : m_cullable.m_cullData.m_hideFlags;
+
+            // The lods of the cullable start at the lod bias, mirroring BuildCullable
+            for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size() && lodIndex + m_lodBias < m_postCullingInstanceDataByLod.size(); ++lodIndex)
+            {
+                const RPI::Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
+                instance.m_screenCoverageMin = lod.m_screenCoverageMin;
+                instance.m_screenCoverageMax = lod.m_screenCoverageMax;
+                if (lodData.m_lodConfiguration.m_lodType == RPI::Cullable::LodType::SpecificLod)
+                {
+                    // Only the overridden lod is drawn, independent of its screen coverage
+                    const bool isOverride = lodIndex == lodData.m_lodConfiguration.m_lodOverride;
+                    instance.m_screenCoverageMin = isOverride ? 0.0f : 1.0f;
+                    instance.m_screenCoverageMax = isOverride ? 1.0f : 0.0f;
+                }
+
+                for (const PostCullingInstanceData& postCullingData : m_postCullingInstanceDataByLod[lodIndex + m_lodBias])
+                {
+                    if (postCullingData.m_gpuDrivenInstanceSlot != MeshGpuDrivenInstancing::InvalidSlot)
+                    {
+                        instance.m_groupIndex = postCullingData.m_instanceGroupHandle->m_groupIndex;
+                        gpuDrivenInstancing.UpdateInstance(postCullingData.m_gpuDrivenInstanceSlot, instance);
+                    }
+                }
+            }
+        }
+
         void ModelDataInstance::UpdateObjectSrg(MeshFeatureProcessor* meshFeatureProcessor)
         {
             ReflectionProbeFeatureProcessor* reflectionProbeFeatureProcessor = meshFeatureProcessor->GetReflectionProbeFeatureProcessor();
@@ -2965,6 +3255,8 @@ namespace AZ
         {
             m_flags.m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+            // GPU driven instancing reads the visibility from the entries written with the cull bounds
+            m_flags.m_cullBoundsNeedsUpdate = true;
         }
 
         CustomMaterialInfo ModelDataInstance::GetCustomMaterialWithFallback(const CustomMaterialId& id) const
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Mesh/MeshGpuDrivenCullingPass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            // Buffers grow in multiples of this many instances or groups to avoid rebuilding the pass while meshes are streaming in
+            constexpr uint32_t BufferGrowthGranularity = 1024;
+        }
+
+        RPI::Ptr<MeshGpuDrivenCullingPass> MeshGpuDrivenCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshGpuDrivenCullingPass> pass = aznew MeshGpuDrivenCullingPass(descriptor);
+            return pass;
+        }
+
+        MeshGpuDrivenCullingPass::MeshGpuDrivenCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        MeshGpuDrivenCullingPass::~MeshGpuDrivenCullingPass()
+        {
+            UnregisterView();
+        }
+
+        void MeshGpuDrivenCullingPass::BuildInternal()
+        {
+            const uint32_t instanceCapacity =
+                AZStd::max(RoundUpToMultiple(m_requiredInstanceCapacity, BufferGrowthGranularity), BufferGrowthGranularity);
+            if (!m_buffers.m_instanceData || instanceCapacity > m_buffers.m_instanceCapacity)
+            {
+                m_buffers.m_instanceCapacity = instanceCapacity;
+
+                // Read by the draws as the ViewSrg's m_instanceData
+                RPI::CommonBufferDescriptor instanceDataDesc;
+                instanceDataDesc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+                instanceDataDesc.m_bufferName = AZStd::string::format("%s_InstanceData", GetPathName().GetCStr());
+                instanceDataDesc.m_elementSize = sizeof(uint32_t);
+                instanceDataDesc.m_byteCount = m_buffers.m_instanceCapacity * sizeof(uint32_t);
+                m_buffers.m_instanceData = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(instanceDataDesc);
+            }
+
+            const uint32_t groupCapacity =
+                AZStd::max(RoundUpToMultiple(m_requiredGroupCapacity, BufferGrowthGranularity), BufferGrowthGranularity);
+            MeshFeatureProcessor* meshFeatureProcessor = GetScene() ? GetScene()->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            if (meshFeatureProcessor && (!m_buffers.m_drawArguments || groupCapacity > m_buffers.m_groupCapacity))
+            {
+                m_buffers.m_groupCapacity = groupCapacity;
+
+                RPI::CommonBufferDescriptor drawArgumentsDesc;
+                drawArgumentsDesc.m_poolType = RPI::CommonBufferPoolType::Indirect;
+                drawArgumentsDesc.m_bufferName = AZStd::string::format("%s_DrawArguments", GetPathName().GetCStr());
+                drawArgumentsDesc.m_elementFormat = RHI::Format::R32_UINT;
+                drawArgumentsDesc.m_byteCount =
+                    uint64_t(m_buffers.m_groupCapacity) * meshFeatureProcessor->GetGpuDrivenInstancing().GetDrawArgumentsStride();
+                m_buffers.m_drawArguments = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(drawArgumentsDesc);
+            }
+
+            AttachBufferToSlot(Name("InstanceDataOutput"), m_buffers.m_instanceData);
+            if (m_buffers.m_drawArguments)
+            {
+                AttachBufferToSlot(Name("DrawArgumentsOutput"), m_buffers.m_drawArguments);
+            }
+        }
+
+        void MeshGpuDrivenCullingPass::ResetInternal()
+        {
+            UnregisterView();
+            ComputePass::ResetInternal();
+        }
+
+        void MeshGpuDrivenCullingPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            RPI::Scene* scene = GetScene();
+            MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            RPI::ViewPtr view = GetView();
+
+            m_hasFrameData = false;
+            if (meshFeatureProcessor && view && m_buffers.m_drawArguments && meshFeatureProcessor->IsGpuDrivenInstancingEnabled())
+            {
+                if (m_registeredView != view.get())
+                {
+                    UnregisterView();
+                    m_registeredView = view.get();
+                }
+
+                // Registering every frame lets the feature processor draw the view indirectly next frame
+                MeshGpuDrivenInstancing& gpuDrivenInstancing = meshFeatureProcessor->GetGpuDrivenInstancing();
+                m_hasFrameData = gpuDrivenInstancing.RegisterView(m_registeredView, m_buffers, m_frameData);
+
+                // The buffers are replaced when the pass is rebuilt, until then the feature processor draws the view on the CPU
+                const uint32_t requiredInstanceCapacity = gpuDrivenInstancing.GetRequiredInstanceCapacity();
+                const uint32_t requiredGroupCapacity = gpuDrivenInstancing.GetRequiredGroupCapacity();
+                if (requiredInstanceCapacity > m_buffers.m_instanceCapacity || requiredGroupCapacity > m_buffers.m_groupCapacity)
+                {
+                    m_requiredInstanceCapacity = requiredInstanceCapacity;
+                    m_requiredGroupCapacity = requiredGroupCapacity;
+                    QueueForBuildAndInitialization();
+                }
+
+                m_instanceBuffer = gpuDrivenInstancing.GetInstanceBuffer();
+                m_groupBuffer = gpuDrivenInstancing.GetGroupBuffer();
+                m_hasFrameData = m_hasFrameData && m_instanceBuffer && m_groupBuffer && m_frameData.m_cpuInstanceData;
+                if (m_hasFrameData)
+                {
+                    // Only the entries that were uploaded can be read
+                    m_instanceCount = AZStd::min(
+                        gpuDrivenInstancing.GetInstanceCount(),
+                        aznumeric_cast<uint32_t>(m_instanceBuffer->GetBufferSize() / sizeof(MeshGpuDrivenInstancing::Instance)));
+
+                    // Matches the LOD selection of RPI::Culling, which uses the view's current matrices
+                    const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
+                    m_worldToClip = view->GetWorldToClipMatrix();
+                    m_cameraPosition = view->GetViewToWorldMatrix().GetTranslation();
+                    m_yScale = viewToClip.GetElement(1, 1);
+                    m_isPerspective = viewToClip.GetElement(3, 3) == 0.0f;
+                    m_viewUsageFlags = static_cast<uint32_t>(view->GetUsageFlags());
+                }
+            }
+            else
+            {
+                UnregisterView();
+            }
+
+            if (!m_hasFrameData)
+            {
+                m_frameData = {};
+                m_instanceBuffer = nullptr;
+                m_groupBuffer = nullptr;
+                m_instanceCount = 0;
+            }
+
+            // The draw arguments are cleared by the attachment's load action, the shader only writes the visible groups
+            SetTargetThreadCounts(AZStd::max(m_frameData.m_cpuInstanceCount + m_instanceCount, 1u), 1, 1);
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void MeshGpuDrivenCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            AZ_Assert(m_shaderResourceGroup != nullptr, "%s has a null shader resource group when calling Compile.", GetPathName().GetCStr());
+
+            if (m_hasFrameData)
+            {
+                m_shaderResourceGroup->SetBufferView(m_cpuInstanceDataIndex, m_frameData.m_cpuInstanceData->GetBufferView());
+                m_shaderResourceGroup->SetBufferView(m_instancesIndex, m_instanceBuffer->GetBufferView());
+                m_shaderResourceGroup->SetBufferView(m_groupsIndex, m_groupBuffer->GetBufferView());
+            }
+
+            RPI::Scene* scene = GetScene();
+            MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            const uint32_t drawArgumentsStride =
+                meshFeatureProcessor ? meshFeatureProcessor->GetGpuDrivenInstancing().GetDrawArgumentsStride() / sizeof(uint32_t) : 0;
+
+            m_shaderResourceGroup->SetConstant(m_worldToClipIndex, m_worldToClip);
+            m_shaderResourceGroup->SetConstant(m_cameraPositionIndex, m_cameraPosition);
+            m_shaderResourceGroup->SetConstant(m_yScaleIndex, m_yScale);
+            m_shaderResourceGroup->SetConstant(m_isPerspectiveIndex, m_isPerspective ? 1u : 0u);
+            m_shaderResourceGroup->SetConstant(m_viewUsageFlagsIndex, m_viewUsageFlags);
+            m_shaderResourceGroup->SetConstant(m_cpuInstanceCountIndex, m_frameData.m_cpuInstanceCount);
+            m_shaderResourceGroup->SetConstant(m_instanceCountIndex, m_instanceCount);
+            m_shaderResourceGroup->SetConstant(m_drawArgumentsStrideIndex, drawArgumentsStride);
+
+            BindPassSrg(context, m_shaderResourceGroup);
+            m_shaderResourceGroup->Compile();
+        }
+
+        void MeshGpuDrivenCullingPass::UnregisterView()
+        {
+            if (!m_registeredView)
+            {
+                return;
+            }
+
+            RPI::Scene* scene = GetScene();
+            if (MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr)
+            {
+                meshFeatureProcessor->GetGpuDrivenInstancing().UnregisterView(m_registeredView);
+            }
+            m_registeredView = nullptr;
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+#include <Mesh/MeshGpuDrivenInstancing.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! This pass culls the instanced meshes of the GPU driven instance groups against the frustum of the pipeline's view,
+        //! selects their LODs, and writes the instance data and the indirect draw arguments the MeshFeatureProcessor draws the
+        //! groups with, see MeshGpuDrivenInstancing. The instance data the CPU wrote for the remaining groups is copied first.
+        //! Its outputs need to be connected to the passes that draw the meshes, so they are written before they are read.
+        class MeshGpuDrivenCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshGpuDrivenCullingPass);
+
+        public:
+            AZ_RTTI(MeshGpuDrivenCullingPass, "{8E0A6F2D-4C1B-4E57-9A63-2D7B5C0F1E84}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshGpuDrivenCullingPass, SystemAllocator);
+
+            ~MeshGpuDrivenCullingPass();
+
+            //! Creates a MeshGpuDrivenCullingPass
+            static RPI::Ptr<MeshGpuDrivenCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            MeshGpuDrivenCullingPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+            void ResetInternal() override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+
+            // Stops the GPU driven draws of the view this pass ran for
+            void UnregisterView();
+
+            // SRG binding indices...
+            RHI::ShaderInputNameIndex m_cpuInstanceDataIndex = "m_cpuInstanceData";
+            RHI::ShaderInputNameIndex m_instancesIndex = "m_instances";
+            RHI::ShaderInputNameIndex m_groupsIndex = "m_groups";
+            RHI::ShaderInputNameIndex m_worldToClipIndex = "m_worldToClip";
+            RHI::ShaderInputNameIndex m_cameraPositionIndex = "m_cameraPosition";
+            RHI::ShaderInputNameIndex m_yScaleIndex = "m_yScale";
+            RHI::ShaderInputNameIndex m_isPerspectiveIndex = "m_isPerspective";
+            RHI::ShaderInputNameIndex m_viewUsageFlagsIndex = "m_viewUsageFlags";
+            RHI::ShaderInputNameIndex m_cpuInstanceCountIndex = "m_cpuInstanceCount";
+            RHI::ShaderInputNameIndex m_instanceCountIndex = "m_instanceCount";
+            RHI::ShaderInputNameIndex m_drawArgumentsStrideIndex = "m_drawArgumentsStride";
+
+            MeshGpuDrivenInstancing::ViewBuffers m_buffers;
+            // The capacities the buffers need when the pass is next built
+            uint32_t m_requiredInstanceCapacity = 0;
+            uint32_t m_requiredGroupCapacity = 0;
+
+            // The data of the current frame, only valid when m_hasFrameData is true
+            MeshGpuDrivenInstancing::ViewFrameData m_frameData;
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+            Data::Instance<RPI::Buffer> m_groupBuffer;
+            uint32_t m_instanceCount = 0;
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateIdentity();
+            Vector3 m_cameraPosition = Vector3::CreateZero();
+            float m_yScale = 1.0f;
+            bool m_isPerspective = true;
+            uint32_t m_viewUsageFlags = 0;
+            bool m_hasFrameData = false;
+
+            // The view the buffers of this pass are registered for
+            const RPI::View* m_registeredView = nullptr;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshGpuDrivenInstancing.h>
+#include <Mesh/MeshInstanceManager.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            // The number of 32 bit values in a DrawIndexed indirect command: index count, instance count, first index, vertex offset
+            // and first instance, in that order on every platform
+            constexpr uint32_t DrawIndexedArgumentCount = 5;
+        }
+
+        void MeshGpuDrivenInstancing::Init()
+        {
+            RHI::IndirectBufferLayout layout;
+            layout.AddIndirectCommand(RHI::IndirectCommandDescriptor(RHI::IndirectCommandType::DrawIndexed));
+            if (!layout.Finalize())
+            {
+                AZ_Error("MeshGpuDrivenInstancing", false, "Failed to finalize the indirect buffer layout.");
+                return;
+            }
+
+            RHI::IndirectBufferSignatureDescriptor signatureDescriptor;
+            signatureDescriptor.m_layout = layout;
+            m_indirectBufferSignature = RHI::Factory::Get().CreateIndirectBufferSignature();
+            if (m_indirectBufferSignature->Init(*RHI::RHISystemInterface::Get()->GetDevice(), signatureDescriptor) != RHI::ResultCode::Success)
+            {
+                AZ_Error("MeshGpuDrivenInstancing", false, "Failed to initialize the indirect buffer signature.");
+                m_indirectBufferSignature = nullptr;
+                return;
+            }
+
+            AZ_Assert(
+                m_indirectBufferSignature->GetByteStride() >= DrawIndexedArgumentCount * sizeof(uint32_t),
+                "The indirect buffer signature is smaller than the DrawIndexed arguments written by MeshGpuDrivenCulling.azsl");
+        }
+
+        void MeshGpuDrivenInstancing::Shutdown()
+        {
+            {
+                AZStd::scoped_lock lock(m_viewMutex);
+                m_viewData.clear();
+            }
+
+            AZStd::scoped_lock lock(m_instanceMutex);
+            m_instances = {};
+            m_freeInstances = {};
+            m_dirtyInstanceBegin = 0;
+            m_dirtyInstanceEnd = 0;
+            m_instanceBuffer = nullptr;
+            m_groups = {};
+            m_groupBuffer = nullptr;
+            m_gpuDrivenInstanceCount = 0;
+            m_totalInstanceCount = 0;
+            m_indirectBufferSignature = nullptr;
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetDrawArgumentsStride() const
+        {
+            return m_indirectBufferSignature ? m_indirectBufferSignature->GetByteStride() : 0;
+        }
+
+        uint32_t MeshGpuDrivenInstancing::AcquireInstance()
+        {
+            AZStd::scoped_lock lock(m_instanceMutex);
+
+            uint32_t slot;
+            if (!m_freeInstances.empty())
+            {
+                slot = m_freeInstances.back();
+                m_freeInstances.pop_back();
+            }
+            else
+            {
+                slot = aznumeric_cast<uint32_t>(m_instances.size());
+                m_instances.emplace_back();
+            }
+
+            // New entries stay hidden until their bounds are set
+            m_instances[slot] = Instance{};
+            m_dirtyInstanceBegin = m_dirtyInstanceBegin == m_dirtyInstanceEnd ? slot : AZStd::min(m_dirtyInstanceBegin, slot);
+            m_dirtyInstanceEnd = AZStd::max(m_dirtyInstanceEnd, slot + 1);
+            return slot;
+        }
+
+        void MeshGpuDrivenInstancing::ReleaseInstance(uint32_t slot)
+        {
+            AZStd::scoped_lock lock(m_instanceMutex);
+
+            AZ_Assert(slot < m_instances.size(), "Releasing a GPU driven instance that doesn't exist.");
+            m_instances[slot] = Instance{};
+            m_freeInstances.push_back(slot);
+            m_dirtyInstanceBegin = m_dirtyInstanceBegin == m_dirtyInstanceEnd ? slot : AZStd::min(m_dirtyInstanceBegin, slot);
+            m_dirtyInstanceEnd = AZStd::max(m_dirtyInstanceEnd, slot + 1);
+        }
+
+        void MeshGpuDrivenInstancing::UpdateInstance(uint32_t slot, const Instance& instance)
+        {
+            AZStd::scoped_lock lock(m_instanceMutex);
+
+            AZ_Assert(slot < m_instances.size(), "Updating a GPU driven instance that doesn't exist.");
+            m_instances[slot] = instance;
+            m_dirtyInstanceBegin = m_dirtyInstanceBegin == m_dirtyInstanceEnd ? slot : AZStd::min(m_dirtyInstanceBegin, slot);
+            m_dirtyInstanceEnd = AZStd::max(m_dirtyInstanceEnd, slot + 1);
+        }
+
+        void MeshGpuDrivenInstancing::UpdateGroups(MeshInstanceManager& meshInstanceManager)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MeshGpuDrivenInstancing: UpdateGroups");
+
+            {
+                // The draws of the previous frame have been submitted, so the data of views that were unregistered can be removed
+                AZStd::scoped_lock lock(m_viewMutex);
+                for (auto viewDataIter = m_viewData.begin(); viewDataIter != m_viewData.end();)
+                {
+                    viewDataIter = viewDataIter->second->m_isRegistered ? AZStd::next(viewDataIter) : m_viewData.erase(viewDataIter);
+                }
+            }
+
+            // Groups without an entry in the table have an index count of 0, which the culling shader skips
+            m_groups.clear();
+            m_groups.resize(meshInstanceManager.GetGroupIndexCount());
+
+            uint32_t gpuDrivenInstanceCount = 0;
+            uint32_t totalInstanceCount = 0;
+            for (const auto& range : meshInstanceManager.GetParallelRanges())
+            {
+                for (auto instanceGroupIter = range.m_begin; instanceGroupIter != range.m_end; ++instanceGroupIter)
+                {
+                    MeshInstanceGroupData& instanceGroup = *instanceGroupIter;
+                    totalInstanceCount += instanceGroup.m_count;
+
+                    const RHI::DrawPacket* drawPacket = instanceGroup.m_drawPacket.GetRHIDrawPacket();
+                    instanceGroup.m_isGpuDriven = !instanceGroup.m_isTransparent && drawPacket && drawPacket->GetDrawItemCount() > 0 &&
+                        drawPacket->GetDrawItemProperties(0).m_item->m_arguments.m_type == RHI::DrawType::Indexed;
+                    if (!instanceGroup.m_isGpuDriven)
+                    {
+                        continue;
+                    }
+
+                    // Every draw item in the packet draws the same geometry
+                    const RHI::DrawIndexed& drawIndexed = drawPacket->GetDrawItemProperties(0).m_item->m_arguments.m_indexed;
+                    Group& group = m_groups[instanceGroup.m_groupIndex];
+                    group.m_indexCount = drawIndexed.m_indexCount;
+                    group.m_indexOffset = drawIndexed.m_indexOffset;
+                    group.m_vertexOffset = drawIndexed.m_vertexOffset;
+                    group.m_instanceOffset = gpuDrivenInstanceCount;
+
+                    // Reserve room for every instance in the group, since they could all be visible
+                    gpuDrivenInstanceCount += instanceGroup.m_count;
+                }
+            }
+            m_gpuDrivenInstanceCount = gpuDrivenInstanceCount;
+            m_totalInstanceCount = totalInstanceCount;
+
+            if (!m_groups.empty())
+            {
+                ReserveBuffer(m_groupBuffer, "MeshGpuDrivenGroups", sizeof(Group), aznumeric_cast<uint32_t>(m_groups.size() * sizeof(Group)));
+                m_groupBuffer->UpdateData(m_groups.data(), m_groups.size() * sizeof(Group), 0);
+            }
+
+            AZStd::scoped_lock lock(m_instanceMutex);
+            if (!m_instances.empty())
+            {
+                if (ReserveBuffer(
+                        m_instanceBuffer, "MeshGpuDrivenInstances", sizeof(Instance), aznumeric_cast<uint32_t>(m_instances.size() * sizeof(Instance))))
+                {
+                    // The contents of the buffer are lost when it grows
+                    m_dirtyInstanceBegin = 0;
+                    m_dirtyInstanceEnd = aznumeric_cast<uint32_t>(m_instances.size());
+                }
+
+                if (m_dirtyInstanceBegin < m_dirtyInstanceEnd)
+                {
+                    m_instanceBuffer->UpdateData(
+                        m_instances.data() + m_dirtyInstanceBegin,
+                        (m_dirtyInstanceEnd - m_dirtyInstanceBegin) * sizeof(Instance),
+                        m_dirtyInstanceBegin * sizeof(Instance));
+                }
+            }
+            m_dirtyInstanceBegin = 0;
+            m_dirtyInstanceEnd = 0;
+        }
+
+        bool MeshGpuDrivenInstancing::BeginView(const RPI::View* view)
+        {
+            AZStd::scoped_lock lock(m_viewMutex);
+
+            auto viewDataIter = m_viewData.find(view);
+            if (viewDataIter == m_viewData.end())
+            {
+                return false;
+            }
+
+            ViewData& viewData = *viewDataIter->second;
+            const ViewBuffers& buffers = viewData.m_buffers;
+
+            // The draws of this frame read the buffers that the pass registered last frame. The pass only replaces them when they
+            // are too small, so only use them when they are large enough for this frame, otherwise fall back to the CPU path until
+            // the pass has grown them
+            viewData.m_isGpuDriven = viewData.m_passRan && m_indirectBufferSignature && m_groupBuffer && m_instanceBuffer &&
+                buffers.m_instanceData && buffers.m_drawArguments && buffers.m_instanceCapacity >= m_totalInstanceCount &&
+                buffers.m_groupCapacity >= m_groups.size();
+            viewData.m_passRan = false;
+            viewData.m_hasFrameData = false;
+            return viewData.m_isGpuDriven;
+        }
+
+        const RHI::IndirectBufferView* MeshGpuDrivenInstancing::EndView(
+            const RPI::View* view, Data::Instance<RPI::Buffer> cpuInstanceData, uint32_t cpuInstanceCount)
+        {
+            AZStd::scoped_lock lock(m_viewMutex);
+
+            auto viewDataIter = m_viewData.find(view);
+            if (viewDataIter == m_viewData.end() || !viewDataIter->second->m_isGpuDriven)
+            {
+                return nullptr;
+            }
+
+            ViewData& viewData = *viewDataIter->second;
+            viewData.m_frameData.m_cpuInstanceData = cpuInstanceData;
+            viewData.m_frameData.m_cpuInstanceCount = cpuInstanceCount;
+            viewData.m_hasFrameData = true;
+
+            const RHI::Buffer* drawArguments = viewData.m_buffers.m_drawArguments->GetRHIBuffer();
+            const uint32_t stride = m_indirectBufferSignature->GetByteStride();
+            viewData.m_indirectBufferView = RHI::IndirectBufferView(
+                *drawArguments, *m_indirectBufferSignature, 0, aznumeric_cast<uint32_t>(m_groups.size() * stride), stride);
+            return &viewData.m_indirectBufferView;
+        }
+
+        Data::Instance<RPI::Buffer> MeshGpuDrivenInstancing::GetInstanceDataBuffer(const RPI::View* view) const
+        {
+            AZStd::scoped_lock lock(m_viewMutex);
+
+            auto viewDataIter = m_viewData.find(view);
+            return viewDataIter != m_viewData.end() ? viewDataIter->second->m_buffers.m_instanceData : nullptr;
+        }
+
+        bool MeshGpuDrivenInstancing::RegisterView(const RPI::View* view, const ViewBuffers& buffers, ViewFrameData& frameData)
+        {
+            AZStd::scoped_lock lock(m_viewMutex);
+
+            AZStd::unique_ptr<ViewData>& viewData = m_viewData[view];
+            if (!viewData)
+            {
+                viewData = AZStd::make_unique<ViewData>();
+            }
+
+            viewData->m_buffers = buffers;
+            viewData->m_passRan = true;
+            viewData->m_isRegistered = true;
+            if (!viewData->m_hasFrameData)
+            {
+                return false;
+            }
+
+            frameData = viewData->m_frameData;
+            viewData->m_hasFrameData = false;
+            return true;
+        }
+
+        void MeshGpuDrivenInstancing::UnregisterView(const RPI::View* view)
+        {
+            AZStd::scoped_lock lock(m_viewMutex);
+            auto viewDataIter = m_viewData.find(view);
+            if (viewDataIter != m_viewData.end())
+            {
+                viewDataIter->second->m_isRegistered = false;
+                viewDataIter->second->m_passRan = false;
+            }
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetRequiredInstanceCapacity() const
+        {
+            return m_totalInstanceCount;
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetRequiredGroupCapacity() const
+        {
+            return aznumeric_cast<uint32_t>(m_groups.size());
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetGroupInstanceOffset(uint32_t groupIndex) const
+        {
+            return m_groups[groupIndex].m_instanceOffset;
+        }
+
+        const Data::Instance<RPI::Buffer>& MeshGpuDrivenInstancing::GetInstanceBuffer() const
+        {
+            return m_instanceBuffer;
+        }
+
+        const Data::Instance<RPI::Buffer>& MeshGpuDrivenInstancing::GetGroupBuffer() const
+        {
+            return m_groupBuffer;
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetInstanceCount() const
+        {
+            AZStd::scoped_lock lock(m_instanceMutex);
+            return aznumeric_cast<uint32_t>(m_instances.size());
+        }
+
+        uint32_t MeshGpuDrivenInstancing::GetGroupCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_groups.size());
+        }
+
+        bool MeshGpuDrivenInstancing::ReserveBuffer(Data::Instance<RPI::Buffer>& buffer, const char* name, uint32_t elementSize, uint32_t byteCount)
+        {
+            // Grow in powers of two so the buffers aren't re-created every time a mesh is added
+            const uint32_t reservedByteCount = RHI::NextPowerOfTwo(AZStd::max(byteCount, elementSize * 64));
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = name;
+                desc.m_elementSize = elementSize;
+                desc.m_byteCount = reservedByteCount;
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                return true;
+            }
+
+            if (buffer->GetBufferSize() < byteCount)
+            {
+                buffer->Resize(reservedByteCount);
+                return true;
+            }
+            return false;
+        }
+    } // namespace Render
+} // namespace AZ
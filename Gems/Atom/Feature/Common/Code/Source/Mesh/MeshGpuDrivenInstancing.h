@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshInstanceManager;
+
+        //! Keeps the world bounds and LOD ranges of every instanced mesh in a persistent buffer, so the MeshGpuDrivenCullingPass can
+        //! cull the meshes, select their LODs and write the instance data and the indirect draw arguments of each instance group on
+        //! the GPU. The MeshFeatureProcessor then submits a single indirect draw per instance group for the views that the pass runs
+        //! for, so the CPU cost of those views depends on the number of instance groups rather than on the number of visible meshes.
+        //!
+        //! Only opaque instance groups are drawn this way. Transparent groups need to be sorted by depth and stay on the CPU path,
+        //! their instance data is copied to the front of the instance data the pass writes.
+        class MeshGpuDrivenInstancing
+        {
+        public:
+            static constexpr uint32_t InvalidSlot = 0xFFFFFFFF;
+
+            //! Set in Instance::m_hideFlags for meshes that are hidden in every view
+            static constexpr uint32_t HiddenFlag = 0x80000000;
+
+            //! Must match MeshGpuDrivenInstance in MeshGpuDrivenCulling.azsl
+            struct Instance
+            {
+                float m_aabbMin[3] = { 0.0f, 0.0f, 0.0f };
+                uint32_t m_groupIndex = 0;
+                float m_aabbMax[3] = { 0.0f, 0.0f, 0.0f };
+                uint32_t m_objectId = 0;
+                float m_lodSelectionRadius = 0.0f;
+                float m_screenCoverageMin = 1.0f;
+                float m_screenCoverageMax = 0.0f;
+                //! The RPI::View::UsageFlags of the views the mesh is hidden in, or HiddenFlag
+                uint32_t m_hideFlags = HiddenFlag;
+            };
+
+            //! Must match MeshGpuDrivenGroup in MeshGpuDrivenCulling.azsl
+            struct Group
+            {
+                uint32_t m_indexCount = 0;
+                uint32_t m_indexOffset = 0;
+                uint32_t m_vertexOffset = 0;
+                //! Where the instances of the group start, after the instances that were written by the CPU
+                uint32_t m_instanceOffset = 0;
+            };
+
+            //! The buffers the MeshGpuDrivenCullingPass writes for its view
+            struct ViewBuffers
+            {
+                Data::Instance<RPI::Buffer> m_instanceData;
+                Data::Instance<RPI::Buffer> m_drawArguments;
+                //! The number of instances m_instanceData can hold
+                uint32_t m_instanceCapacity = 0;
+                //! The number of instance groups m_drawArguments can hold
+                uint32_t m_groupCapacity = 0;
+            };
+
+            //! The data the MeshGpuDrivenCullingPass needs to write the instance data for its view
+            struct ViewFrameData
+            {
+                //! The instance data the CPU wrote for the instance groups that aren't GPU driven
+                Data::Instance<RPI::Buffer> m_cpuInstanceData;
+                uint32_t m_cpuInstanceCount = 0;
+            };
+
+            void Init();
+            void Shutdown();
+
+            //! Returns the byte stride of a single draw in the indirect draw arguments buffer
+            uint32_t GetDrawArgumentsStride() const;
+
+            //! Reserves an entry in the persistent instance buffer. Thread safe.
+            uint32_t AcquireInstance();
+
+            //! Frees an entry in the persistent instance buffer. Thread safe.
+            void ReleaseInstance(uint32_t slot);
+
+            //! Updates an entry in the persistent instance buffer. Only the modified range is uploaded. Thread safe.
+            void UpdateInstance(uint32_t slot, const Instance& instance);
+
+            //! Decides which instance groups are drawn with GPU driven instancing, assigns the range of the instance data each of
+            //! them writes to, and uploads the modified instance entries and the group table.
+            void UpdateGroups(MeshInstanceManager& meshInstanceManager);
+
+            //! Returns true when the view's GPU driven groups can be drawn indirectly this frame. This requires the
+            //! MeshGpuDrivenCullingPass to have run for the view in the previous frame with buffers large enough for this frame.
+            bool BeginView(const RPI::View* view);
+
+            //! Stores the CPU written instance data of a view that BeginView returned true for, and returns the indirect buffer view
+            //! the GPU driven draws of the view read their arguments from.
+            const RHI::IndirectBufferView* EndView(const RPI::View* view, Data::Instance<RPI::Buffer> cpuInstanceData, uint32_t cpuInstanceCount);
+
+            //! Returns the buffer the view's draws read their instance data from
+            Data::Instance<RPI::Buffer> GetInstanceDataBuffer(const RPI::View* view) const;
+
+            //! Called by the MeshGpuDrivenCullingPass every frame it runs for the view. Returns false if the view has no
+            //! frame data, in which case the pass has nothing to compute this frame.
+            bool RegisterView(const RPI::View* view, const ViewBuffers& buffers, ViewFrameData& frameData);
+
+            //! Called by the MeshGpuDrivenCullingPass when it stops running for the view
+            void UnregisterView(const RPI::View* view);
+
+            //! The number of instances and instance groups the buffers of the MeshGpuDrivenCullingPass need to hold
+            uint32_t GetRequiredInstanceCapacity() const;
+            uint32_t GetRequiredGroupCapacity() const;
+
+            //! Returns where the instances of a GPU driven group start, relative to the instances written by the CPU
+            uint32_t GetGroupInstanceOffset(uint32_t groupIndex) const;
+
+            //! The persistent instance buffer and the group table, and the number of entries in each
+            const Data::Instance<RPI::Buffer>& GetInstanceBuffer() const;
+            const Data::Instance<RPI::Buffer>& GetGroupBuffer() const;
+            uint32_t GetInstanceCount() const;
+            uint32_t GetGroupCount() const;
+
+        private:
+            struct ViewData
+            {
+                ViewBuffers m_buffers;
+                ViewFrameData m_frameData;
+                // The indirect draws of the view keep a pointer to this, so it lives as long as the ViewData
+                RHI::IndirectBufferView m_indirectBufferView;
+                // Set when the pass ran for the view since the last BeginView
+                bool m_passRan = false;
+                // Set between BeginView and EndView when the view's GPU driven groups are drawn indirectly
+                bool m_isGpuDriven = false;
+                bool m_hasFrameData = false;
+                // Cleared when the pass stops running for the view. The data is kept until the next frame, since the draws that
+                // were already submitted for the view still reference it.
+                bool m_isRegistered = true;
+            };
+
+            //! Creates the buffer or grows it to hold at least byteCount bytes. Returns true if the buffer was replaced.
+            bool ReserveBuffer(Data::Instance<RPI::Buffer>& buffer, const char* name, uint32_t elementSize, uint32_t byteCount);
+
+            RHI::Ptr<RHI::IndirectBufferSignature> m_indirectBufferSignature;
+
+            mutable AZStd::mutex m_instanceMutex;
+            AZStd::vector<Instance> m_instances;
+            AZStd::vector<uint32_t> m_freeInstances;
+            uint32_t m_dirtyInstanceBegin = 0;
+            uint32_t m_dirtyInstanceEnd = 0;
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+
+            AZStd::vector<Group> m_groups;
+            Data::Instance<RPI::Buffer> m_groupBuffer;
+            uint32_t m_gpuDrivenInstanceCount = 0;
+            uint32_t m_totalInstanceCount = 0;
+
+            mutable AZStd::mutex m_viewMutex;
+            AZStd::unordered_map<const RPI::View*, AZStd::unique_ptr<ViewData>> m_viewData;
+        };
+    } // namespace Render
+} // namespace AZ
@@ -19,6 +19,7 @@ namespace AZ::Render
         {
             // Clear any cached draw packets, since they need to be re-created
             m_perViewDrawPackets.clear();
+            m_perViewIndirectDrawPackets.clear();
             for (auto modelDataInstance : m_associatedInstances)
             {
                 modelDataInstance->HandleDrawPacketUpdate();
@@ -81,6 +82,15 @@ namespace AZ::Render
             IndexMapEntry entry;
             entry.m_handle = m_instanceGroupData.emplace();
             entry.m_count = 1;
+            if (!m_freeGroupIndices.empty())
+            {
+                entry.m_handle->m_groupIndex = m_freeGroupIndices.back();
+                m_freeGroupIndices.pop_back();
+            }
+            else
+            {
+                entry.m_handle->m_groupIndex = m_groupIndexCount++;
+            }
             it = m_dataMap.emplace(AZStd::make_pair(key, AZStd::move(entry))).first;
         }
         else
@@ -110,9 +120,12 @@ namespace AZ::Render
         }
 
         it->second.m_count--;
+        it->second.m_handle->m_count = it->second.m_count;
 
         if (it->second.m_count == 0)
         {
+            m_freeGroupIndices.push_back(it->second.m_handle->m_groupIndex);
+
             // Remove it from the data map
             // The owning handle will go out of scope, which will erase it from the underlying array as well
             m_dataMap.erase(it);
@@ -125,6 +138,11 @@ namespace AZ::Render
     {
         return static_cast<uint32_t>(m_instanceGroupData.size());
     }
+
+    uint32_t MeshInstanceGroupList::GetGroupIndexCount() const
+    {
+        return m_groupIndexCount;
+    }
         
     auto MeshInstanceGroupList::GetParallelRanges() -> ParallelRanges
     {
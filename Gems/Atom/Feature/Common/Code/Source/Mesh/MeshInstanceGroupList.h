@@ -40,6 +40,16 @@ namespace AZ::Render
         // The page that this instance group belongs to
         uint32_t m_pageIndex = 0;
 
+        // A dense index that stays the same for as long as the instance group exists, and is re-used once it is removed.
+        // GPU driven instancing uses it to address the per-group draw arguments.
+        uint32_t m_groupIndex = 0;
+
+        // True when the group is drawn with GPU driven instancing in views that support it. Updated each frame by the MeshFeatureProcessor.
+        bool m_isGpuDriven = false;
+
+        // Cloned draw packets that draw the group with the indirect arguments written by GPU driven instancing, one for each view
+        AZStd::vector<RHI::Ptr<RHI::DrawPacket>> m_perViewIndirectDrawPackets;
+
         // We store a key with the data to make it faster to remove the instance without needing to recreate the key
         // or store it with the data for each individual instance
         MeshInstanceGroupKey m_key;
@@ -112,6 +122,10 @@ namespace AZ::Render
         // Returns the number of instance groups
         uint32_t GetInstanceGroupCount() const;
 
+        // Returns one more than the highest group index in use. Group indices of removed groups are re-used,
+        // so this stays close to the instance group count.
+        uint32_t GetGroupIndexCount() const;
+
         // Returns parallel ranges for the underlying instance group data. Each range corresponds to a page of data.
         ParallelRanges GetParallelRanges();
 
@@ -141,6 +155,8 @@ namespace AZ::Render
     private:
         StableDynamicArrayType m_instanceGroupData;
         DataMap m_dataMap;
+        AZStd::vector<uint32_t> m_freeGroupIndices;
+        uint32_t m_groupIndexCount = 0;
         AZStd::concurrency_checker m_instanceDataConcurrencyChecker;
     };
 } // namespace AZ::Render
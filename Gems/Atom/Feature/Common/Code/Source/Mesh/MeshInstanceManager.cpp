@@ -44,6 +44,11 @@ namespace AZ
             return m_instanceData.GetInstanceGroupCount();
         }
 
+        uint32_t MeshInstanceManager::GetGroupIndexCount() const
+        {
+            return m_instanceData.GetGroupIndexCount();
+        }
+
         MeshInstanceGroupData& MeshInstanceManager::operator[](Handle handle)
         {
             return m_instanceData[handle];
@@ -39,6 +39,9 @@ namespace AZ::Render
         //! Get the total number of instance groups being managed by the MeshInstanceManager
         uint32_t GetInstanceGroupCount() const;
 
+        //! Get the number of group indices in use, which is the size needed for anything indexed by MeshInstanceGroupData::m_groupIndex
+        uint32_t GetGroupIndexCount() const;
+
         //! Constant O(1) access to a MeshInstanceGroup via its handle
         MeshInstanceGroupData& operator[](Handle handle);
 
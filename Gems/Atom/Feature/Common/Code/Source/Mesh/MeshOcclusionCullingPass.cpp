@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <AzCore/Console/IConsole.h>
+#include <Mesh/MeshOcclusionCullingPass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool, r_meshOcclusionCullingEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable hiding meshes that the MeshOcclusionCullingPass found to be occluded.");
+
+        namespace
+        {
+            // Buffers grow in multiples of this many instances to avoid rebuilding the pass while meshes are streaming in
+            constexpr uint32_t BufferGrowthGranularity = 1024;
+        }
+
+        RPI::Ptr<MeshOcclusionCullingPass> MeshOcclusionCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshOcclusionCullingPass> pass = aznew MeshOcclusionCullingPass(descriptor);
+            return pass;
+        }
+
+        MeshOcclusionCullingPass::MeshOcclusionCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+            , m_readbackData(AZStd::make_shared<ReadbackData>())
+        {
+        }
+
+        MeshOcclusionCullingPass::~MeshOcclusionCullingPass()
+        {
+            ClearResults();
+        }
+
+        void MeshOcclusionCullingPass::BuildInternal()
+        {
+            const uint32_t capacity = AZStd::max(RoundUpToMultiple(m_requiredCapacity, BufferGrowthGranularity), BufferGrowthGranularity);
+            if (!m_visibilityBuffer || capacity > m_bufferCapacity)
+            {
+                m_bufferCapacity = capacity;
+
+                // Each instance has a min and a max corner
+                RPI::CommonBufferDescriptor boundsDesc;
+                boundsDesc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                boundsDesc.m_bufferName = AZStd::string::format("%s_Bounds", GetPathName().GetCStr());
+                boundsDesc.m_elementFormat = RHI::Format::R32G32B32A32_FLOAT;
+                boundsDesc.m_byteCount = m_bufferCapacity * 2 * sizeof(Vector4);
+                m_boundsBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(boundsDesc);
+
+                RPI::CommonBufferDescriptor visibilityDesc;
+                visibilityDesc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+                visibilityDesc.m_bufferName = AZStd::string::format("%s_Visibility", GetPathName().GetCStr());
+                visibilityDesc.m_elementFormat = RHI::Format::R32_UINT;
+                visibilityDesc.m_byteCount = m_bufferCapacity * sizeof(uint32_t);
+                m_visibilityBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(visibilityDesc);
+            }
+
+            AttachBufferToSlot(Name("VisibilityOutput"), m_visibilityBuffer);
+        }
+
+        void MeshOcclusionCullingPass::ResetInternal()
+        {
+            ClearResults();
+            ComputePass::ResetInternal();
+        }
+
+        void MeshOcclusionCullingPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            RPI::Scene* scene = GetScene();
+            MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            RPI::ViewPtr view = GetView();
+            if (!meshFeatureProcessor || !view)
+            {
+                return;
+            }
+
+            if (m_occlusionView != view.get())
+            {
+                ClearResults();
+                m_occlusionView = view.get();
+            }
+
+            if (r_meshOcclusionCullingEnabled)
+            {
+                ApplyReadbackResults();
+            }
+            else
+            {
+                ClearResults();
+            }
+
+            // Gather the bounds of every mesh. Meshes hidden by occlusion are tested as well, which is what lets them reappear.
+            m_bounds.clear();
+            meshFeatureProcessor->ForEachCullable(
+                [this](RPI::Cullable& cullable)
+                {
+                    m_bounds.push_back(cullable.m_cullData.m_visibilityEntry.m_boundingVolume);
+                });
+
+            // The buffers are replaced when the pass is rebuilt, until then only test as many meshes as the current buffers can hold
+            if (m_bounds.size() > m_bufferCapacity)
+            {
+                m_requiredCapacity = aznumeric_cast<uint32_t>(m_bounds.size());
+                QueueForBuildAndInitialization();
+            }
+            m_instanceCount = AZStd::min(aznumeric_cast<uint32_t>(m_bounds.size()), m_bufferCapacity);
+            m_bounds.resize(m_instanceCount);
+
+            m_boundsData.resize_no_construct(m_instanceCount * 2);
+            for (uint32_t instanceIndex = 0; instanceIndex < m_instanceCount; ++instanceIndex)
+            {
+                m_boundsData[instanceIndex * 2] = Vector4(m_bounds[instanceIndex].GetMin(), 1.0f);
+                m_boundsData[instanceIndex * 2 + 1] = Vector4(m_bounds[instanceIndex].GetMax(), 1.0f);
+            }
+            if (m_instanceCount > 0)
+            {
+                m_boundsBuffer->UpdateData(m_boundsData.data(), m_boundsData.size() * sizeof(Vector4));
+            }
+
+            // The depth this pass reads is rendered with the view's current matrices
+            m_worldToClip = view->GetWorldToClipMatrix();
+            SetTargetThreadCounts(AZStd::max(m_instanceCount, 1u), 1, 1);
+
+            if (!m_readbackInFlight && m_instanceCount > 0 && r_meshOcclusionCullingEnabled)
+            {
+                if (!m_readback)
+                {
+                    m_readback = AZStd::make_shared<RPI::AttachmentReadback>(RHI::ScopeId{ AZStd::string::format("%s_Readback", GetPathName().GetCStr()) });
+
+                    // The callback is invoked from the thread that waits on the GPU, keep only the shared readback data alive in it
+                    AZStd::weak_ptr<ReadbackData> readbackData = m_readbackData;
+                    m_readback->SetCallback(
+                        [readbackData](const RPI::AttachmentReadback::ReadbackResult& result)
+                        {
+                            AZStd::shared_ptr<ReadbackData> data = readbackData.lock();
+                            if (!data)
+                            {
+                                return;
+                            }
+
+                            AZStd::scoped_lock lock(data->m_mutex);
+                            data->m_visibility.clear();
+                            if (result.m_state == RPI::AttachmentReadback::ReadbackState::Success && result.m_dataBuffer)
+                            {
+                                const uint32_t* flags = reinterpret_cast<const uint32_t*>(result.m_dataBuffer->data());
+                                data->m_visibility.assign(flags, flags + result.m_dataBuffer->size() / sizeof(uint32_t));
+                            }
+                            data->m_hasResult = true;
+                        });
+                }
+
+                if (ReadbackAttachment(m_readback, 0, Name("VisibilityOutput")))
+                {
+                    m_readbackBounds = m_bounds;
+                    m_readbackInFlight = true;
+                }
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void MeshOcclusionCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            AZ_Assert(m_shaderResourceGroup != nullptr, "%s has a null shader resource group when calling Compile.", GetPathName().GetCStr());
+
+            m_shaderResourceGroup->SetBufferView(m_boundsIndex, m_boundsBuffer->GetBufferView());
+            m_shaderResourceGroup->SetConstant(m_worldToClipIndex, m_worldToClip);
+            m_shaderResourceGroup->SetConstant(m_instanceCountIndex, m_instanceCount);
+
+            BindPassSrg(context, m_shaderResourceGroup);
+            m_shaderResourceGroup->Compile();
+        }
+
+        void MeshOcclusionCullingPass::ApplyReadbackResults()
+        {
+            AZStd::vector<uint32_t> visibility;
+            {
+                AZStd::scoped_lock lock(m_readbackData->m_mutex);
+                if (!m_readbackData->m_hasResult)
+                {
+                    return;
+                }
+                visibility.swap(m_readbackData->m_visibility);
+                m_readbackData->m_hasResult = false;
+            }
+            m_readbackInFlight = false;
+
+            MeshFeatureProcessor* meshFeatureProcessor = GetScene()->GetFeatureProcessor<MeshFeatureProcessor>();
+            const size_t resultCount = AZStd::min(visibility.size(), m_readbackBounds.size());
+            size_t instanceIndex = 0;
+            meshFeatureProcessor->ForEachCullable(
+                [&](RPI::Cullable& cullable)
+                {
+                    RPI::Cullable::CullData& cullData = cullable.m_cullData;
+
+                    // Meshes may have been added, removed or moved since the bounds were tested, only trust results for identical bounds
+                    const bool hasResult = instanceIndex < resultCount &&
+                        m_readbackBounds[instanceIndex] == cullData.m_visibilityEntry.m_boundingVolume;
+                    if (hasResult && visibility[instanceIndex] == 0)
+                    {
+                        cullData.m_occludedInView = m_occlusionView;
+                    }
+                    else if (cullData.m_occludedInView == m_occlusionView)
+                    {
+                        cullData.m_occludedInView = nullptr;
+                    }
+                    ++instanceIndex;
+                });
+        }
+
+        void MeshOcclusionCullingPass::ClearResults()
+        {
+            if (!m_occlusionView)
+            {
+                return;
+            }
+
+            RPI::Scene* scene = GetScene();
+            if (MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr)
+            {
+                meshFeatureProcessor->ForEachCullable(
+                    [this](RPI::Cullable& cullable)
+                    {
+                        if (cullable.m_cullData.m_occludedInView == m_occlusionView)
+                        {
+                            cullable.m_cullData.m_occludedInView = nullptr;
+                        }
+                    });
+            }
+
+            // A result that is still in flight was computed for the results being cleared, so it must not hide anything once it lands
+            m_readbackBounds.clear();
+            AZStd::scoped_lock lock(m_readbackData->m_mutex);
+            m_readbackData->m_hasResult = false;
+            m_readbackData->m_visibility.clear();
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! This pass tests the world bounds of every mesh in the scene against a hierarchical depth buffer (HiZ) built from the
+        //! depth of the pipeline's view, and feeds the results back into the culling scene.
+        //! The visibility flags are read back to the CPU asynchronously, so the results are applied a few frames after they were
+        //! computed. Meshes that were hidden are tested again every frame, so they reappear once the results catch up.
+        class MeshOcclusionCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshOcclusionCullingPass);
+
+        public:
+            AZ_RTTI(MeshOcclusionCullingPass, "{3B1B3C53-7A57-4F39-9B1C-4AEB6C3A9E11}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshOcclusionCullingPass, SystemAllocator);
+
+            ~MeshOcclusionCullingPass();
+
+            //! Creates a MeshOcclusionCullingPass
+            static RPI::Ptr<MeshOcclusionCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            MeshOcclusionCullingPass(const RPI::PassDescriptor& descriptor);
+
+            // Results of a readback, filled from the readback callback and consumed in FrameBeginInternal
+            struct ReadbackData
+            {
+                AZStd::mutex m_mutex;
+                AZStd::vector<uint32_t> m_visibility;
+                bool m_hasResult = false;
+            };
+
+            // Pass behavior overrides...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+            void ResetInternal() override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+
+            // Applies the latest readback results to the cullables of the mesh feature processor
+            void ApplyReadbackResults();
+
+            // Clears any occlusion results this pass has applied
+            void ClearResults();
+
+            // SRG binding indices...
+            RHI::ShaderInputNameIndex m_boundsIndex = "m_bounds";
+            RHI::ShaderInputNameIndex m_worldToClipIndex = "m_worldToClip";
+            RHI::ShaderInputNameIndex m_instanceCountIndex = "m_instanceCount";
+
+            Data::Instance<RPI::Buffer> m_boundsBuffer;
+            Data::Instance<RPI::Buffer> m_visibilityBuffer;
+            uint32_t m_bufferCapacity = 0;
+            // The number of instances the buffers need to hold when the pass is next built
+            uint32_t m_requiredCapacity = 0;
+
+            // World bounds of the meshes tested this frame, stored as min/max pairs to match the bounds buffer
+            AZStd::vector<Aabb> m_bounds;
+            AZStd::vector<Vector4> m_boundsData;
+            uint32_t m_instanceCount = 0;
+            Matrix4x4 m_worldToClip = Matrix4x4::CreateIdentity();
+
+            // The view that occlusion results are applied to
+            const RPI::View* m_occlusionView = nullptr;
+
+            AZStd::shared_ptr<RPI::AttachmentReadback> m_readback;
+            AZStd::shared_ptr<ReadbackData> m_readbackData;
+            // The bounds that were tested for the readback in flight, used to discard results for meshes that have changed
+            AZStd::vector<Aabb> m_readbackBounds;
+            bool m_readbackInFlight = false;
+        };
+    }   // namespace Render
+}   // namespace AZ
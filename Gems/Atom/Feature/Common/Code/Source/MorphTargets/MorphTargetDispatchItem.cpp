@@ -13,6 +13,7 @@
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
 #include <Atom/RHI/Factory.h>
@@ -26,17 +27,26 @@ namespace AZ
     {
         MorphTargetDispatchItem::MorphTargetDispatchItem(
             const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-            const MorphTargetComputeMetaData& morphTargetComputeMetaData,
+            const AZStd::vector<MorphTargetComputeMetaData>& morphTargetComputeMetaDatas,
             SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
-            MorphTargetInstanceMetaData morphInstanceMetaData,
-            float morphDeltaIntegerEncoding)
+            AZStd::vector<MorphTargetInstanceMetaData> morphInstanceMetaDatas,
+            AZStd::vector<float> morphDeltaIntegerEncodings)
             : m_inputBuffers(inputBuffers)
-            , m_morphTargetComputeMetaData(morphTargetComputeMetaData)
-            , m_morphInstanceMetaData(morphInstanceMetaData)
-            , m_accumulatedDeltaIntegerEncoding(morphDeltaIntegerEncoding)
+            , m_morphTargetComputeMetaDatas(morphTargetComputeMetaDatas)
+            , m_morphInstanceMetaDatas(AZStd::move(morphInstanceMetaDatas))
+            , m_accumulatedDeltaIntegerEncodings(AZStd::move(morphDeltaIntegerEncodings))
         {
             m_morphTargetShader = skinnedMeshFeatureProcessor->GetMorphTargetShader();
             RPI::ShaderReloadNotificationBus::Handler::BusConnect(m_morphTargetShader->GetAssetId());
+
+            m_activeTargets.resize(m_morphTargetComputeMetaDatas.size());
+
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+            desc.m_bufferName = "MorphTargetActiveTargets";
+            desc.m_elementSize = sizeof(ActiveTarget);
+            desc.m_byteCount = AZStd::max<size_t>(m_activeTargets.size(), 1) * sizeof(ActiveTarget);
+            m_activeTargetBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
         }
 
         MorphTargetDispatchItem::~MorphTargetDispatchItem()
@@ -52,6 +62,12 @@ namespace AZ
                 return false;
             }
 
+            if (!m_inputBuffers || !m_activeTargetBuffer)
+            {
+                AZ_Error("MorphTargetDispatchItem", false, "Cannot initialize a MorphTargetDispatchItem without morph target buffers");
+                return false;
+            }
+
             AZ::RPI::ShaderOptionGroup shaderOptionGroup = m_morphTargetShader->CreateShaderOptionGroup();
             // In case there are several options you don't care about, it's good practice to initialize them with default values.
             shaderOptionGroup.SetUnspecifiedToDefaultValues();
@@ -86,9 +102,10 @@ namespace AZ
                 AZ_Error("MorphTargetDispatchItem", false, outcome.GetError().c_str());
             }
 
-            arguments.m_totalNumberOfThreadsX = m_morphTargetComputeMetaData.m_vertexCount;
-            arguments.m_totalNumberOfThreadsY = 1;
-            arguments.m_totalNumberOfThreadsZ = 1;
+            AZ_Error(
+                "MorphTargetDispatchItem", arguments.m_threadsPerGroupX == MorphTargetConstants::s_deltaBlockSize,
+                "The morph target shader must have one thread per delta of a block.");
+            UpdateDispatchArguments();
 
             return true;
         }
@@ -111,6 +128,10 @@ namespace AZ
             
             m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_instanceSrg);
 
+            RHI::ShaderInputBufferIndex activeTargetsIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_activeTargets" });
+            AZ_Error("MorphTargetDispatchItem", activeTargetsIndex.IsValid(), "Failed to find shader input index for 'm_activeTargets' in the morph target compute shader per-instance SRG.");
+            m_instanceSrg->SetBufferView(activeTargetsIndex, m_activeTargetBuffer->GetBufferView());
+
             m_instanceSrg->Compile();
 
             m_dispatchItem.m_uniqueShaderResourceGroup = m_instanceSrg->GetRHIShaderResourceGroup();
@@ -119,51 +140,76 @@ namespace AZ
 
         void MorphTargetDispatchItem::InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout)
         {
-            auto vertexCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_vertexCount" });
-            AZ_Error("MorphTargetDispatchItem", vertexCountIndex.IsValid(), "Could not find root constant 's_vertexCount' in the shader");
-            auto positionOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetPositionOffset" });
-            AZ_Error("MorphTargetDispatchItem", positionOffsetIndex.IsValid(), "Could not find root constant 's_targetPositionOffset' in the shader");
-            auto normalOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetNormalOffset" });
-            AZ_Error("MorphTargetDispatchItem", normalOffsetIndex.IsValid(), "Could not find root constant 's_targetNormalOffset' in the shader");
-            auto tangentOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetTangentOffset" });
-            AZ_Error("MorphTargetDispatchItem", tangentOffsetIndex.IsValid(), "Could not find root constant 's_targetTangentOffset' in the shader");
-            auto bitangentOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetBitangentOffset" });
-            AZ_Error("MorphTargetDispatchItem", bitangentOffsetIndex.IsValid(), "Could not find root constant 's_targetBitangentOffset' in the shader");
-
-            auto minIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_min" });
-            AZ_Error("MorphTargetDispatchItem", minIndex.IsValid(), "Could not find root constant 's_min' in the shader");
-            auto maxIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_max" });
-            AZ_Error("MorphTargetDispatchItem", maxIndex.IsValid(), "Could not find root constant 's_max' in the shader");
-            auto morphDeltaIntegerEncodingIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_accumulatedDeltaIntegerEncoding" });
-            AZ_Error("MorphTargetDispatchItem", morphDeltaIntegerEncodingIndex.IsValid(), "Could not find root constant 's_accumulatedDeltaIntegerEncoding' in the shader");
-            m_weightIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_weight" });
-            AZ_Error("MorphTargetDispatchItem", m_weightIndex.IsValid(), "Could not find root constant 's_weight' in the shader");
+            m_activeTargetCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_activeTargetCount" });
+            AZ_Error("MorphTargetDispatchItem", m_activeTargetCountIndex.IsValid(), "Could not find root constant 's_activeTargetCount' in the shader");
 
             m_rootConstantData = AZ::RHI::ConstantsData(rootConstantsLayout);
-            m_rootConstantData.SetConstant(minIndex, m_morphTargetComputeMetaData.m_minDelta);
-            m_rootConstantData.SetConstant(maxIndex, m_morphTargetComputeMetaData.m_maxDelta);
-            m_rootConstantData.SetConstant(morphDeltaIntegerEncodingIndex, m_accumulatedDeltaIntegerEncoding);
-            m_rootConstantData.SetConstant(m_weightIndex, 0.0f);
-            m_rootConstantData.SetConstant(vertexCountIndex, m_morphTargetComputeMetaData.m_vertexCount);
-            // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
-            m_rootConstantData.SetConstant(positionOffsetIndex, m_morphInstanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(normalOffsetIndex, m_morphInstanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(tangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(bitangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4);
+            m_rootConstantData.SetConstant(m_activeTargetCountIndex, m_activeTargetCount);
 
             m_dispatchItem.m_rootConstantSize = static_cast<uint8_t>(m_rootConstantData.GetConstantData().size());
             m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
         }
 
-        void MorphTargetDispatchItem::SetWeight(float weight)
+        void MorphTargetDispatchItem::UpdateDispatchArguments()
         {
-            m_rootConstantData.SetConstant(m_weightIndex, weight);
-            m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            // One thread group per block of the active morph targets
+            auto& arguments = m_dispatchItem.m_arguments.m_direct;
+            arguments.m_totalNumberOfThreadsX = m_activeBlockCount * MorphTargetConstants::s_deltaBlockSize;
+            arguments.m_totalNumberOfThreadsY = 1;
+            arguments.m_totalNumberOfThreadsZ = 1;
+        }
+
+        void MorphTargetDispatchItem::SetWeights(const AZStd::vector<float>& weights)
+        {
+            AZ_Assert(
+                weights.size() == m_morphTargetComputeMetaDatas.size(),
+                "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with morph target dispatch items.");
+
+            m_activeTargetCount = 0;
+            m_activeBlockCount = 0;
+            const size_t morphTargetCount = AZStd::min(weights.size(), m_morphTargetComputeMetaDatas.size());
+            for (size_t morphIndex = 0; morphIndex < morphTargetCount; ++morphIndex)
+            {
+                const MorphTargetComputeMetaData& metaData = m_morphTargetComputeMetaDatas[morphIndex];
+                if (AZStd::abs(weights[morphIndex]) <= AZ::Constants::FloatEpsilon || metaData.m_blockCount == 0)
+                {
+                    continue;
+                }
+
+                const MorphTargetInstanceMetaData& instanceMetaData = m_morphInstanceMetaDatas[metaData.m_meshIndex];
+                ActiveTarget& activeTarget = m_activeTargets[m_activeTargetCount++];
+                activeTarget.m_firstBlock = m_activeBlockCount;
+                activeTarget.m_blockOffset = metaData.m_blockOffset;
+                activeTarget.m_weight = weights[morphIndex];
+                activeTarget.m_minDelta = metaData.m_minDelta;
+                activeTarget.m_maxDelta = metaData.m_maxDelta;
+                activeTarget.m_accumulatedDeltaIntegerEncoding = m_accumulatedDeltaIntegerEncodings[metaData.m_meshIndex];
+                // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
+                activeTarget.m_targetPositionOffset = instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4;
+                activeTarget.m_targetNormalOffset = instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4;
+                activeTarget.m_targetTangentOffset = instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4;
+                activeTarget.m_targetBitangentOffset = instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4;
+                activeTarget.m_pad[0] = 0;
+                activeTarget.m_pad[1] = 0;
+                m_activeBlockCount += metaData.m_blockCount;
+            }
+
+            if (m_activeTargetCount > 0)
+            {
+                m_activeTargetBuffer->UpdateData(m_activeTargets.data(), m_activeTargetCount * sizeof(ActiveTarget), 0);
+            }
+
+            if (m_activeTargetCountIndex.IsValid())
+            {
+                m_rootConstantData.SetConstant(m_activeTargetCountIndex, m_activeTargetCount);
+                m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            }
+            UpdateDispatchArguments();
         }
 
-        float MorphTargetDispatchItem::GetWeight() const
+        bool MorphTargetDispatchItem::HasActiveTargets() const
         {
-            return m_rootConstantData.GetConstant<float>(m_weightIndex);
+            return m_activeBlockCount > 0;
         }
 
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
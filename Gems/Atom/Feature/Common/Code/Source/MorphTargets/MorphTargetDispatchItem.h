@@ -35,7 +35,10 @@ namespace AZ
     {
         class SkinnedMeshFeatureProcessor;
 
-        //! Holds and manages an RHI DispatchItem for a specific morph target, and the resources that are needed to build and maintain it.
+        //! Holds and manages an RHI DispatchItem that applies all the morph targets of a skinned mesh instance lod, and the resources
+        //! that are needed to build and maintain it.
+        //! Only the morph targets with a non-zero weight are dispatched. Each thread group applies one block of deltas, and finds
+        //! the morph target the block belongs to in the table of active morph targets that is updated when the weights change.
         class MorphTargetDispatchItem
             : private RPI::ShaderReloadNotificationBus::Handler
         {
@@ -43,13 +46,16 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(MorphTargetDispatchItem, AZ::SystemAllocator);
 
             MorphTargetDispatchItem() = delete;
-            //! Create one dispatch item per morph target
+            //! Create one dispatch item per skinned mesh instance lod
+            //! @param morphTargetMetaDatas The metadata of every morph target of the lod, in the order the weights are set in
+            //! @param morphInstanceMetaDatas The per-instance accumulation buffer offsets of each mesh of the lod
+            //! @param accumulatedDeltaIntegerEncodings The integer encoding of each mesh of the lod
             explicit MorphTargetDispatchItem(
                 const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-                const MorphTargetComputeMetaData& morphTargetMetaData,
+                const AZStd::vector<MorphTargetComputeMetaData>& morphTargetMetaDatas,
                 SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
-                MorphTargetInstanceMetaData morphInstanceMetaData,
-                float accumulatedDeltaRange
+                AZStd::vector<MorphTargetInstanceMetaData> morphInstanceMetaDatas,
+                AZStd::vector<float> accumulatedDeltaIntegerEncodings
             );
             ~MorphTargetDispatchItem();
 
@@ -60,11 +66,33 @@ namespace AZ
 
             const RHI::DispatchItem& GetRHIDispatchItem() const;
 
-            void SetWeight(float weight);
-            float GetWeight() const;
+            //! Set the weight of each morph target, in the same order as the metadata the dispatch item was created with
+            void SetWeights(const AZStd::vector<float>& weights);
+
+            //! Returns true if any morph target has a non-zero weight, otherwise there is nothing to dispatch
+            bool HasActiveTargets() const;
         private:
+            //! Must match MorphTargetActiveTarget in MorphTargetSRG.azsli
+            struct ActiveTarget
+            {
+                //! The index of the first thread group of the morph target within the dispatch
+                uint32_t m_firstBlock;
+                //! The index of the first block of the morph target within the MorphTargetInputBuffers
+                uint32_t m_blockOffset;
+                float m_weight;
+                float m_minDelta;
+                float m_maxDelta;
+                float m_accumulatedDeltaIntegerEncoding;
+                uint32_t m_targetPositionOffset;
+                uint32_t m_targetNormalOffset;
+                uint32_t m_targetTangentOffset;
+                uint32_t m_targetBitangentOffset;
+                uint32_t m_pad[2];
+            };
+
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
+            void UpdateDispatchArguments();
 
             // ShaderInstanceNotificationBus::Handler overrides
             void OnShaderReinitialized(const RPI::Shader& shader) override;
@@ -82,18 +110,24 @@ namespace AZ
             // The per-object shader resource group
             Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
 
-            // Metadata used to set the root constants for the shader
-            MorphTargetComputeMetaData m_morphTargetComputeMetaData;
+            // Metadata of each morph target, used to fill the table of active morph targets
+            AZStd::vector<MorphTargetComputeMetaData> m_morphTargetComputeMetaDatas;
 
             AZ::RHI::ConstantsData m_rootConstantData;
 
-            // Per-SkinnedMeshInstance constants for morph targets
-            MorphTargetInstanceMetaData m_morphInstanceMetaData;
-            // A conservative value for encoding/decoding the accumulated deltas
-            float m_accumulatedDeltaIntegerEncoding;
+            // Per-SkinnedMeshInstance constants for morph targets, for each mesh
+            AZStd::vector<MorphTargetInstanceMetaData> m_morphInstanceMetaDatas;
+            // A conservative value for encoding/decoding the accumulated deltas, for each mesh
+            AZStd::vector<float> m_accumulatedDeltaIntegerEncodings;
+
+            // The table of active morph targets, which has room for every morph target
+            AZStd::vector<ActiveTarget> m_activeTargets;
+            Data::Instance<RPI::Buffer> m_activeTargetBuffer;
+            uint32_t m_activeTargetCount = 0;
+            uint32_t m_activeBlockCount = 0;
 
-            // Keep track of the constant index of m_weight since it is updated frequently
-            RHI::ShaderInputConstantIndex m_weightIndex;
+            // Keep track of the constant index of s_activeTargetCount since it is updated frequently
+            RHI::ShaderInputConstantIndex m_activeTargetCountIndex;
         };
     } // namespace Render
 } // namespace AZ
@@ -13,6 +13,7 @@
 #include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RHI/Factory.h>
@@ -24,30 +25,46 @@ namespace AZ
 {
     namespace Render
     {
-        MorphTargetInputBuffers::MorphTargetInputBuffers(const RPI::BufferAssetView& bufferAssetView, const AZStd::string& bufferNamePrefix)
-        {            
-            m_vertexDeltaBuffer = RPI::Buffer::FindOrCreate(bufferAssetView.GetBufferAsset());
-            if (m_vertexDeltaBuffer)
-            {
-                AZ::RHI::Ptr<AZ::RHI::BufferView> bufferView = RHI::Factory::Get().CreateBufferView();
-                {
-                    bufferView->SetName(Name(bufferNamePrefix + "MorphTargetVertexDeltaView"));
-                    [[maybe_unused]] RHI::ResultCode resultCode = bufferView->Init(*m_vertexDeltaBuffer->GetRHIBuffer(), bufferAssetView.GetBufferViewDescriptor());
-                    AZ_Error("MorphTargetInputBuffers", resultCode == RHI::ResultCode::Success, "Failed to initialize buffer view for morph target.");
-                }
-
-                m_vertexDeltaBufferView = bufferView;
-            }
+        MorphTargetInputBuffers::MorphTargetInputBuffers(
+            AZStd::span<const uint32_t> deltas, AZStd::span<const uint32_t> blocks, const AZStd::string& bufferNamePrefix)
+        {
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+            desc.m_bufferName = bufferNamePrefix + "MorphTargetVertexDeltas";
+            desc.m_elementSize = MorphTargetConstants::s_packedDeltaSizeInWords * sizeof(uint32_t);
+            desc.m_byteCount = deltas.size() * sizeof(uint32_t);
+            desc.m_bufferData = deltas.data();
+            m_vertexDeltaBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Error("MorphTargetInputBuffers", m_vertexDeltaBuffer, "Failed to create the vertex delta buffer for morph target '%s'.", bufferNamePrefix.c_str());
+
+            desc.m_bufferName = bufferNamePrefix + "MorphTargetDeltaBlocks";
+            desc.m_elementSize = MorphTargetConstants::s_packedDeltaBlockSizeInWords * sizeof(uint32_t);
+            desc.m_byteCount = blocks.size() * sizeof(uint32_t);
+            desc.m_bufferData = blocks.data();
+            m_deltaBlockBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Error("MorphTargetInputBuffers", m_deltaBlockBuffer, "Failed to create the delta block buffer for morph target '%s'.", bufferNamePrefix.c_str());
         }
 
         void MorphTargetInputBuffers::SetBufferViewsOnShaderResourceGroup(const Data::Instance<RPI::ShaderResourceGroup>& perInstanceSRG)
         {
+            if (!m_vertexDeltaBuffer || !m_deltaBlockBuffer)
+            {
+                return;
+            }
+
             // Set the delta buffer
             RHI::ShaderInputBufferIndex srgIndex = perInstanceSRG->FindShaderInputBufferIndex(Name{ "m_vertexDeltas" });
-            AZ_Error("MorphTargetInputBuffers", srgIndex.IsValid(), "Failed to find shader input index for 'm_positionDeltas' in the skinning compute shader per-instance SRG.");
+            AZ_Error("MorphTargetInputBuffers", srgIndex.IsValid(), "Failed to find shader input index for 'm_vertexDeltas' in the morph target compute shader per-instance SRG.");
 
-            [[maybe_unused]] bool success = perInstanceSRG->SetBufferView(srgIndex, m_vertexDeltaBufferView.get());
+            [[maybe_unused]] bool success = perInstanceSRG->SetBufferView(srgIndex, m_vertexDeltaBuffer->GetBufferView());
             AZ_Error("MorphTargetInputBuffers", success, "Failed to bind buffer view for vertex deltas");
+
+            // Set the block buffer
+            srgIndex = perInstanceSRG->FindShaderInputBufferIndex(Name{ "m_deltaBlocks" });
+            AZ_Error("MorphTargetInputBuffers", srgIndex.IsValid(), "Failed to find shader input index for 'm_deltaBlocks' in the morph target compute shader per-instance SRG.");
+
+            success = perInstanceSRG->SetBufferView(srgIndex, m_deltaBlockBuffer->GetBufferView());
+            AZ_Error("MorphTargetInputBuffers", success, "Failed to bind buffer view for delta blocks");
         }
     } // namespace Render
 }// namespace AZ
@@ -85,7 +85,10 @@ namespace AZ
                 static void Reflect(AZ::ReflectContext* context);
 
                 Name m_passName;
-                uint64_t m_timestampResultInNanoseconds;
+                uint64_t m_timestampResultInNanoseconds = 0;
+                //! Begin of the pass in the GPU clock domain of its queue, so the passes can be laid out on a timeline
+                uint64_t m_timestampBeginInNanoseconds = 0;
+                AZStd::string m_hardwareQueueClass;
             };
 
             AZ_TYPE_INFO(TimestampSerializer, "{FAAD85C2-5948-4D81-B54A-53502D69CBC0}");
@@ -203,7 +206,12 @@ namespace AZ
         {
             for (const RPI::Pass* pass : passes)
             {
-                m_timestampEntries.push_back({pass->GetName(), pass->GetLatestTimestampResult().GetDurationInNanoseconds()});
+                const RPI::TimestampResult& timestampResult = pass->GetLatestTimestampResult();
+                m_timestampEntries.push_back({
+                    pass->GetName(),
+                    timestampResult.GetDurationInNanoseconds(),
+                    timestampResult.GetTimestampBeginInNanoseconds(),
+                    RHI::GetHardwareQueueClassName(timestampResult.GetHardwareQueueClass()) });
             }
         }
 
@@ -230,6 +238,8 @@ namespace AZ
                     ->Version(1)
                     ->Field("passName", &TimestampSerializerEntry::m_passName)
                     ->Field("timestampResultInNanoseconds", &TimestampSerializerEntry::m_timestampResultInNanoseconds)
+                    ->Field("timestampBeginInNanoseconds", &TimestampSerializerEntry::m_timestampBeginInNanoseconds)
+                    ->Field("hardwareQueueClass", &TimestampSerializerEntry::m_hardwareQueueClass)
                     ;
             }
         }
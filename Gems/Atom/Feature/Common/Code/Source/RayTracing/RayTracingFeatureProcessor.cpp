@@ -423,7 +423,7 @@ namespace AZ
             m_revision++;
             m_subMeshCount += aznumeric_cast<uint32_t>(subMeshes.size());
 
-            m_meshInfoBufferNeedsUpdate = true;
+            MarkAllMeshInfosDirty();
             m_materialInfoBufferNeedsUpdate = true;
             m_indexListNeedsUpdate = true;
         }
@@ -529,7 +529,7 @@ namespace AZ
                 }
             }
 
-            m_meshInfoBufferNeedsUpdate = true;
+            MarkAllMeshInfosDirty();
             m_materialInfoBufferNeedsUpdate = true;
             m_indexListNeedsUpdate = true;
         }
@@ -558,14 +558,13 @@ namespace AZ
                 rotationMatrix = rotationMatrix.GetInverseFull().GetTranspose();
                 Matrix3x4 worldInvTranspose3x4 = Matrix3x4::CreateFromMatrix3x3(rotationMatrix);
 
-                // update all MeshInfos for this Mesh with the new transform
+                // update all MeshInfos for this Mesh with the new transform, only the modified range is uploaded
                 for (const auto& subMeshIndex : mesh.m_subMeshIndices)
                 {
                     MeshInfo& meshInfo = m_meshInfos[subMeshIndex];
                     worldInvTranspose3x4.StoreToRowMajorFloat12(meshInfo.m_worldInvTranspose.data());
+                    MarkMeshInfoDirty(subMeshIndex);
                 }
-
-                m_meshInfoBufferNeedsUpdate = true;
             }
         }
 
@@ -694,6 +693,12 @@ namespace AZ
                 Data::Instance<RPI::Buffer>& currentMeshInfoGpuBuffer = m_meshInfoGpuBuffer[m_currentMeshInfoFrameIndex];
                 size_t newMeshByteCount = m_subMeshCount * sizeof(MeshInfo);
 
+                // the range of MeshInfos that changed since this buffer was last written
+                DirtyRange& dirtyRange = m_meshInfoDirtyRanges[m_currentMeshInfoFrameIndex];
+                uint32_t dirtyBegin = dirtyRange.m_begin;
+                uint32_t dirtyEnd = AZStd::min(dirtyRange.m_end, m_subMeshCount);
+                dirtyRange = DirtyRange{};
+
                 if (currentMeshInfoGpuBuffer == nullptr)
                 {
                     // allocate the MeshInfo structured buffer
@@ -703,19 +708,48 @@ namespace AZ
                     desc.m_byteCount = AZStd::max(newMeshByteCount, sizeof(MeshInfo));
                     desc.m_elementSize = sizeof(MeshInfo);
                     currentMeshInfoGpuBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                    dirtyBegin = 0;
+                    dirtyEnd = m_subMeshCount;
                 }
                 else if (currentMeshInfoGpuBuffer->GetBufferSize() < newMeshByteCount)
                 {
                     // resize for the new sub-mesh count
                     currentMeshInfoGpuBuffer->Resize(newMeshByteCount);
+                    dirtyBegin = 0;
+                    dirtyEnd = m_subMeshCount;
                 }
 
-                currentMeshInfoGpuBuffer->UpdateData(m_meshInfos.data(), newMeshByteCount);
+                if (dirtyBegin < dirtyEnd)
+                {
+                    currentMeshInfoGpuBuffer->UpdateData(
+                        m_meshInfos.data() + dirtyBegin, (dirtyEnd - dirtyBegin) * sizeof(MeshInfo), dirtyBegin * sizeof(MeshInfo));
+                }
 
                 m_meshInfoBufferNeedsUpdate = false;
             }
         }
 
+        void RayTracingFeatureProcessor::MarkMeshInfoDirty(uint32_t subMeshIndex)
+        {
+            // each buffer in the frame list keeps the range that changed since it was last written
+            for (DirtyRange& dirtyRange : m_meshInfoDirtyRanges)
+            {
+                dirtyRange.m_begin = AZStd::min(dirtyRange.m_begin, subMeshIndex);
+                dirtyRange.m_end = AZStd::max(dirtyRange.m_end, subMeshIndex + 1);
+            }
+            m_meshInfoBufferNeedsUpdate = true;
+        }
+
+        void RayTracingFeatureProcessor::MarkAllMeshInfosDirty()
+        {
+            for (DirtyRange& dirtyRange : m_meshInfoDirtyRanges)
+            {
+                dirtyRange.m_begin = 0;
+                dirtyRange.m_end = AZStd::numeric_limits<uint32_t>::max();
+            }
+            m_meshInfoBufferNeedsUpdate = true;
+        }
+
         void RayTracingFeatureProcessor::UpdateProceduralGeometryInfoBuffer()
         {
             if (!m_proceduralGeometryInfoBufferNeedsUpdate)
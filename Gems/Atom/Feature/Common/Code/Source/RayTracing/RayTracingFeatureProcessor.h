@@ -20,6 +20,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/limits.h>
 
 // this define specifies that the mesh buffers and material textures are stored in the Bindless Srg
 // Note1: The previous implementation using separate unbounded arrays is preserved since it demonstrates a TDR caused by
@@ -389,6 +390,10 @@ namespace AZ
             AZ_DISABLE_COPY_MOVE(RayTracingFeatureProcessor);
 
             void UpdateMeshInfoBuffer();
+
+            // marks MeshInfos to be uploaded to each buffer in the MeshInfo frame list
+            void MarkMeshInfoDirty(uint32_t subMeshIndex);
+            void MarkAllMeshInfosDirty();
             void UpdateProceduralGeometryInfoBuffer();
             void UpdateMaterialInfoBuffer();
             void UpdateIndexLists();
@@ -458,6 +463,15 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_meshInfoGpuBuffer[BufferFrameCount];
             uint32_t m_currentMeshInfoFrameIndex = 0;
 
+            // range of MeshInfos that changed since a buffer in the frame list was last written, so transform changes only
+            // upload the MeshInfos of the moved meshes
+            struct DirtyRange
+            {
+                uint32_t m_begin = AZStd::numeric_limits<uint32_t>::max();
+                uint32_t m_end = 0;
+            };
+            DirtyRange m_meshInfoDirtyRanges[BufferFrameCount];
+
             Data::Instance<RPI::Buffer> m_proceduralGeometryInfoGpuBuffer[BufferFrameCount];
             uint32_t m_currentProceduralGeometryInfoFrameIndex = 0;
 
@@ -22,6 +22,7 @@
 #include <Atom/RPI.Public/Pass/PassSystem.h>
 #include <Atom/RPI.Public/Pass/PassFilter.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/Feature/Mesh/MeshCommon.h>
 #include <CoreLights/Shadow.h>
@@ -139,7 +140,7 @@ namespace AZ::Render
             auto& shadowProperty = GetShadowPropertyFromShadowId(id);
             if (m_primaryProjectedShadowmapsPass)
             {
-                m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_shadowmapPass);
+                RemoveShadowmapPasses(shadowProperty);
             }
             m_shadowProperties.RemoveData(&shadowProperty);
             m_shadowData.Release(id.GetIndex());
@@ -253,7 +254,26 @@ namespace AZ::Render
     {
         AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::SetUseCachedShadows().");
         ShadowProperty& shadowProperty = GetShadowPropertyFromShadowId(id);
+        if (shadowProperty.m_useCachedShadows == useCachedShadows)
+        {
+            return;
+        }
         shadowProperty.m_useCachedShadows = useCachedShadows;
+
+        if (m_primaryProjectedShadowmapsPass)
+        {
+            // Cached shadows use different passes. All of them are added again, because the passes that share a slice of the
+            // atlas rely on running in the order of m_shadowProperties.
+            auto& shadowProperties = m_shadowProperties.GetDataVector();
+            for (auto& property : shadowProperties)
+            {
+                RemoveShadowmapPasses(property);
+            }
+            for (auto& property : shadowProperties)
+            {
+                AddShadowmapPasses(property);
+            }
+        }
         m_shadowmapPassNeedsUpdate = true;
     }
 
@@ -299,6 +319,8 @@ namespace AZ::Render
         RPI::ViewPtr view = shadowProperty.m_shadowmapView;
         view->SetViewToClipMatrix(viewToClipMatrix);
         view->SetCameraTransform(Matrix3x4::CreateFromTransform(desc.m_transform));
+        shadowProperty.m_staticShadowmapView->SetViewToClipMatrix(viewToClipMatrix);
+        shadowProperty.m_staticShadowmapView->SetCameraTransform(Matrix3x4::CreateFromTransform(desc.m_transform));
 
         ShadowData& shadowData = m_shadowData.GetElement<ShadowDataIndex>(shadowProperty.m_shadowId.GetIndex());
 
@@ -323,9 +345,9 @@ namespace AZ::Render
         shadowData.m_unprojectConstants[0] = view->GetViewToClipMatrix().GetRow(2).GetElement(2);
         shadowData.m_unprojectConstants[1] = view->GetViewToClipMatrix().GetRow(2).GetElement(3);
 
-        if (shadowProperty.m_useCachedShadows && m_primaryProjectedShadowmapsPass)
+        if (shadowProperty.m_useCachedShadows && shadowProperty.m_staticShadowmapPass)
         {
-            shadowProperty.m_shadowmapPass->ForceRenderNextFrame();
+            shadowProperty.m_staticShadowmapPass->ForceRenderNextFrame();
         }
 
         m_deviceBufferNeedsUpdate = true;
@@ -345,13 +367,14 @@ namespace AZ::Render
 
         Name viewName(AZStd::string::format("ProjectedShadowView (shadowId:%d)", shadowId.GetIndex()));
         shadowProperty.m_shadowmapView = RPI::View::CreateView(viewName, RPI::View::UsageShadow);
+        Name staticViewName(AZStd::string::format("ProjectedShadowStaticView (shadowId:%d)", shadowId.GetIndex()));
+        shadowProperty.m_staticShadowmapView = RPI::View::CreateView(staticViewName, RPI::View::UsageShadow);
 
         UpdateShadowView(shadowProperty);
 
         if (m_primaryProjectedShadowmapsPass)
         {
-            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowId.GetIndex());
-            m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+            AddShadowmapPasses(shadowProperty);
         }
     }
         
@@ -501,9 +524,7 @@ namespace AZ::Render
 
                     for (auto& shadowProperty : m_shadowProperties.GetDataVector())
                     {
-                        size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
-                        shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex);
-                        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+                        AddShadowmapPasses(shadowProperty);
                     }
                 }
                 m_primaryShadowPipeline = pipeline.get();
@@ -694,15 +715,24 @@ namespace AZ::Render
                         continue;
                     }
 
-                    const RPI::PipelineViewTag& viewTag = shadowProperty.m_shadowmapPass->GetPipelineViewTag();
-                    const RHI::DrawListMask drawListMask = renderPipeline->GetDrawListMask(viewTag);
-                    if (shadowProperty.m_shadowmapView->GetDrawListMask() != drawListMask)
+                    auto addView = [&](const ShadowmapPass& pass, const RPI::ViewPtr& view)
                     {
-                        shadowProperty.m_shadowmapView->Reset();
-                        shadowProperty.m_shadowmapView->SetDrawListMask(drawListMask);
-                    }
+                        const RPI::PipelineViewTag& viewTag = pass.GetPipelineViewTag();
+                        const RHI::DrawListMask drawListMask = renderPipeline->GetDrawListMask(viewTag);
+                        if (view->GetDrawListMask() != drawListMask)
+                        {
+                            view->Reset();
+                            view->SetDrawListMask(drawListMask);
+                        }
+
+                        outViews.emplace_back(AZStd::make_pair(viewTag, view));
+                    };
 
-                    outViews.emplace_back(AZStd::make_pair(viewTag, shadowProperty.m_shadowmapView));
+                    if (shadowProperty.m_staticShadowmapPass)
+                    {
+                        addView(*shadowProperty.m_staticShadowmapPass, shadowProperty.m_staticShadowmapView);
+                    }
+                    addView(*shadowProperty.m_shadowmapPass, shadowProperty.m_shadowmapView);
                 }
             }
         }
@@ -786,6 +816,67 @@ namespace AZ::Render
         m_clearShadowDrawPacket = drawPacketBuilder.End();
     }
 
+    void ProjectedShadowFeatureProcessor::CreateRestoreShadowDrawPacket(ShadowProperty& shadowProperty, uint16_t arraySlice)
+    {
+        if (!m_restoreShadowShader)
+        {
+            // Force load of shader to copy the static casters of cached shadows into the atlas.
+            const AZStd::string restoreShadowShaderFilePath = "Shaders/Shadow/RestoreShadow.azshader";
+            Data::Asset<RPI::ShaderAsset> shaderAsset = RPI::AssetUtils::LoadCriticalAsset<RPI::ShaderAsset>
+                (restoreShadowShaderFilePath, RPI::AssetUtils::TraceLevel::Assert);
+
+            m_restoreShadowShader = RPI::Shader::FindOrCreate(shaderAsset);
+            const RPI::ShaderVariant& variant = m_restoreShadowShader->GetRootVariant();
+
+            RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
+            variant.ConfigurePipelineState(pipelineStateDescriptor);
+
+            [[maybe_unused]] bool foundPipelineState = GetParentScene()->ConfigurePipelineState(m_restoreShadowShader->GetDrawListTag(), pipelineStateDescriptor);
+            AZ_Assert(foundPipelineState, "Could not find pipeline state for RestoreShadow shader's draw list '%s'", shaderAsset->GetDrawListName().GetCStr())
+
+            RHI::InputStreamLayoutBuilder layoutBuilder;
+            pipelineStateDescriptor.m_inputStreamLayout = layoutBuilder.End();
+
+            m_restoreShadowPipelineState = m_restoreShadowShader->AcquirePipelineState(pipelineStateDescriptor);
+            AZ_Assert(m_restoreShadowPipelineState, "Shader '%s'. Failed to acquire default pipeline state", shaderAsset->GetName().GetCStr());
+        }
+
+        shadowProperty.m_restoreShadowDrawPacket = {};
+        if (!m_restoreShadowPipelineState || !m_staticAtlasImageView)
+        {
+            return;
+        }
+
+        if (!shadowProperty.m_restoreShadowSrg)
+        {
+            const RHI::Ptr<RHI::ShaderResourceGroupLayout> srgLayout =
+                m_restoreShadowShader->FindShaderResourceGroupLayout(RPI::SrgBindingSlot::Draw);
+            shadowProperty.m_restoreShadowSrg = RPI::ShaderResourceGroup::Create(
+                m_restoreShadowShader->GetAsset(), m_restoreShadowShader->GetSupervariantIndex(), srgLayout->GetName());
+            if (!shadowProperty.m_restoreShadowSrg)
+            {
+                AZ_Error("ProjectedShadowFeatureProcessor", false, "Failed to create the RestoreShadow shader resource group");
+                return;
+            }
+        }
+        shadowProperty.m_restoreShadowSrg->SetImageView(m_restoreStaticShadowmapIndex, m_staticAtlasImageView.get());
+        shadowProperty.m_restoreShadowSrg->SetConstant(m_restoreArraySliceIndex, aznumeric_cast<uint32_t>(arraySlice));
+        shadowProperty.m_restoreShadowSrg->Compile();
+
+        RHI::DrawPacketBuilder drawPacketBuilder;
+        drawPacketBuilder.Begin(nullptr);
+        drawPacketBuilder.SetDrawArguments(RHI::DrawLinear(1, 0, 3, 0));
+        drawPacketBuilder.AddShaderResourceGroup(shadowProperty.m_restoreShadowSrg->GetRHIShaderResourceGroup());
+
+        RHI::DrawPacketBuilder::DrawRequest drawRequest;
+        drawRequest.m_listTag = m_restoreShadowShader->GetDrawListTag();
+        drawRequest.m_pipelineState = m_restoreShadowPipelineState;
+        drawRequest.m_sortKey = AZStd::numeric_limits<RHI::DrawItemSortKey>::min();
+
+        drawPacketBuilder.AddDrawItem(drawRequest);
+        shadowProperty.m_restoreShadowDrawPacket = drawPacketBuilder.End();
+    }
+
     void ProjectedShadowFeatureProcessor::UpdateAtlas()
     {
         // Currently when something changes, the atlas is completely reset. This is ok when most shadows are dynamic,
@@ -828,6 +919,25 @@ namespace AZ::Render
 
         m_atlasImage = createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth, RHI::ImageAspectFlags::Depth, "ProjectedShadowAtlas");
 
+        const bool anyCachedShadows = AZStd::any_of(shadowProperties.begin(), shadowProperties.end(),
+            [](const ShadowProperty& shadowProperty) { return shadowProperty.m_useCachedShadows; });
+        if (anyCachedShadows)
+        {
+            m_staticAtlasImage =
+                createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth, RHI::ImageAspectFlags::Depth, "ProjectedShadowStaticAtlas");
+
+            // The restore draws read every slice of the static atlas.
+            RHI::ImageViewDescriptor viewDesc = RHI::ImageViewDescriptor::Create(RHI::Format::D32_FLOAT, 0, 0);
+            viewDesc.m_aspectFlags = RHI::ImageAspectFlags::Depth;
+            viewDesc.m_isArray = 1;
+            m_staticAtlasImageView = m_staticAtlasImage ? m_staticAtlasImage->GetRHIImage()->GetImageView(viewDesc) : nullptr;
+        }
+        else
+        {
+            m_staticAtlasImage = {};
+            m_staticAtlasImageView = nullptr;
+        }
+
         for (auto& [key, projectedShadowmapsPass] : m_projectedShadowmapsPasses)
         {
             projectedShadowmapsPass->SetAtlasAttachmentImage(m_atlasImage);
@@ -849,16 +959,49 @@ namespace AZ::Render
         }
     }
 
-    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(size_t childIndex)
+    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(size_t childIndex, const char* templateName, const char* nameSuffix)
     {
-        const Name passName{ AZStd::string::format("ProjectedShadowmapPass.%zu", childIndex) };
+        const Name passName{ AZStd::string::format("ProjectedShadowmapPass.%zu%s", childIndex, nameSuffix) };
 
         RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
         auto passData = AZStd::make_shared<RPI::RasterPassData>();
         passData->m_drawListTag = rhiSystem->GetDrawListTagRegistry()->GetName(m_primaryProjectedShadowmapsPass->GetDrawListTag());
-        passData->m_pipelineViewTag = AZStd::string::format("%s.%zu", m_primaryProjectedShadowmapsPass->GetPipelineViewTag().GetCStr(), childIndex);
+        passData->m_pipelineViewTag = AZStd::string::format(
+            "%s.%zu%s", m_primaryProjectedShadowmapsPass->GetPipelineViewTag().GetCStr(), childIndex, nameSuffix);
 
-        return ShadowmapPass::CreateWithPassRequest(passName, passData);
+        return ShadowmapPass::CreateWithPassRequest(passName, passData, Name(templateName));
+    }
+
+    void ProjectedShadowFeatureProcessor::AddShadowmapPasses(ShadowProperty& shadowProperty)
+    {
+        const size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
+        if (shadowProperty.m_useCachedShadows)
+        {
+            // The static casters need to be rendered before the pass that copies them into the atlas.
+            shadowProperty.m_staticShadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPass::StaticCachePassTemplateName, ".Static");
+            m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_staticShadowmapPass);
+            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPass::DynamicCasterPassTemplateName);
+        }
+        else
+        {
+            shadowProperty.m_staticShadowmapPass = nullptr;
+            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPass::PassTemplateName);
+        }
+        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+    }
+
+    void ProjectedShadowFeatureProcessor::RemoveShadowmapPasses(ShadowProperty& shadowProperty)
+    {
+        if (shadowProperty.m_staticShadowmapPass)
+        {
+            m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_staticShadowmapPass);
+            shadowProperty.m_staticShadowmapPass = nullptr;
+        }
+        if (shadowProperty.m_shadowmapPass)
+        {
+            m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_shadowmapPass);
+            shadowProperty.m_shadowmapPass = nullptr;
+        }
     }
 
     void ProjectedShadowFeatureProcessor::UpdateShadowPasses()
@@ -869,20 +1012,49 @@ namespace AZ::Render
             AZStd::vector<ShadowmapPass*> m_shadowPasses;
         };
 
+        RHI::TagBitRegistry<uint32_t>& viewTagBitRegistry = GetParentScene()->GetViewTagBitRegistry();
+        RHI::Handle<uint32_t> casterMovedBit = viewTagBitRegistry.FindTag(MeshCommon::MeshMovedName);
+        RHI::Handle<uint32_t> alwaysDynamicBit = viewTagBitRegistry.FindTag(MeshCommon::MeshAlwaysDynamicName);
+        const uint32_t alwaysDynamicFlag = alwaysDynamicBit.IsValid() ? alwaysDynamicBit.GetIndex() : 0;
+
         AZStd::vector<SliceInfo> sliceInfo(m_atlas.GetArraySliceCount());
-        for (const auto& it : m_shadowProperties.GetDataVector())
+        for (auto& it : m_shadowProperties.GetDataVector())
         {
 
             // This index indicates the execution order of the passes.
             // The first pass to render a slice should clear the slice.
             size_t shadowIndex = it.m_shadowId.GetIndex();
             auto* pass = it.m_shadowmapPass.get();
+            auto* staticPass = it.m_staticShadowmapPass.get();
 
             const ShadowmapAtlas::Origin origin = m_atlas.GetOrigin(shadowIndex);
             pass->SetArraySlice(origin.m_arraySlice);
-            pass->SetIsStatic(it.m_useCachedShadows);
+            pass->SetIsStatic(false);
             pass->ForceRenderNextFrame();
 
+            if (staticPass)
+            {
+                // The static casters are cached in the static atlas, the atlas itself only gets the always dynamic casters drawn
+                // on top of a copy of them.
+                it.m_staticShadowmapView->SetCullableFlagFilter(0, alwaysDynamicFlag);
+                it.m_shadowmapView->SetCullableFlagFilter(alwaysDynamicFlag, 0);
+
+                staticPass->SetArraySlice(origin.m_arraySlice);
+                staticPass->SetIsStatic(true);
+                staticPass->ForceRenderNextFrame();
+                staticPass->SetStaticCacheImage(m_staticAtlasImage);
+                staticPass->SetClearShadowDrawPacket(m_clearShadowDrawPacket);
+                staticPass->SetCasterMovedBit(casterMovedBit);
+                staticPass->SetDynamicCasterPass(pass);
+
+                CreateRestoreShadowDrawPacket(it, origin.m_arraySlice);
+                pass->SetStaticCacheSourceImage(m_staticAtlasImage);
+            }
+            else
+            {
+                it.m_shadowmapView->SetCullableFlagFilter(0, 0);
+            }
+
             const auto& filterData = m_shadowData.GetElement<FilterParamIndex>(shadowIndex);
             if (filterData.m_shadowmapSize != static_cast<uint32_t>(ShadowmapSize::None))
             {
@@ -900,13 +1072,31 @@ namespace AZ::Render
                 pass->SetClearEnabled(false);
 
                 SliceInfo& sliceInfoItem = sliceInfo.at(origin.m_arraySlice);
-                sliceInfoItem.m_shadowPasses.push_back(pass);
                 sliceInfoItem.m_hasStaticShadows = sliceInfoItem.m_hasStaticShadows || it.m_useCachedShadows;
+                if (staticPass)
+                {
+                    // The static atlas is only written by static passes, which always clear themselves with a draw.
+                    staticPass->SetViewportScissor(viewport, scissor);
+                    staticPass->SetClearEnabled(false);
+
+                    // Copying the static casters replaces the clear.
+                    if (it.m_restoreShadowDrawPacket)
+                    {
+                        pass->SetClearShadowDrawPacket(it.m_restoreShadowDrawPacket);
+                    }
+                    else
+                    {
+                        AZ_Error("ProjectedShadowFeatureProcessor", false, "Cached shadow %zu can't copy its static casters.", shadowIndex);
+                        sliceInfoItem.m_shadowPasses.push_back(pass);
+                    }
+                }
+                else
+                {
+                    sliceInfoItem.m_shadowPasses.push_back(pass);
+                }
             }
         }
 
-        RHI::Handle<uint32_t> casterMovedBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshMovedName);
-
         for (const auto& it : sliceInfo)
         {
             if (!it.m_hasStaticShadows)
@@ -13,6 +13,7 @@
 #include <Atom/Feature/Utils/IndexedDataVector.h>
 #include <Atom/Feature/Utils/MultiSparseVector.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <CoreLights/EsmShadowmapsPass.h>
 #include <CoreLights/ProjectedShadowmapsPass.h>
 #include <CoreLights/ShadowmapPass.h>
@@ -84,6 +85,14 @@ namespace AZ::Render
             ProjectedShadowDescriptor m_desc;
             RPI::ViewPtr m_shadowmapView;
             RPI::Ptr<ShadowmapPass> m_shadowmapPass;
+
+            // Cached shadows render the casters that aren't always dynamic into m_staticAtlasImage, and only when one of them
+            // changes. m_shadowmapPass then copies them into the atlas and draws the always dynamic casters on top.
+            RPI::ViewPtr m_staticShadowmapView;
+            RPI::Ptr<ShadowmapPass> m_staticShadowmapPass;
+            Data::Instance<RPI::ShaderResourceGroup> m_restoreShadowSrg;
+            RHI::ConstPtr<RHI::DrawPacket> m_restoreShadowDrawPacket;
+
             float m_bias = 0.1f;
             ShadowId m_shadowId;
             bool m_useCachedShadows = false;
@@ -112,9 +121,12 @@ namespace AZ::Render
         bool FilterMethodIsEsm(const ShadowData& shadowData) const;
 
         ShadowProperty& GetShadowPropertyFromShadowId(ShadowId id);
-        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(size_t childIndex);
+        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(size_t childIndex, const char* templateName, const char* nameSuffix = "");
+        void AddShadowmapPasses(ShadowProperty& shadowProperty);
+        void RemoveShadowmapPasses(ShadowProperty& shadowProperty);
 
         void CreateClearShadowDrawPacket();
+        void CreateRestoreShadowDrawPacket(ShadowProperty& shadowProperty, uint16_t arraySlice);
 
         void UpdateAtlas();
         void UpdateShadowPasses();
@@ -141,6 +153,9 @@ namespace AZ::Render
         ShadowmapAtlas m_atlas;
         Data::Instance<RPI::AttachmentImage> m_atlasImage;
         Data::Instance<RPI::AttachmentImage> m_esmAtlasImage;
+        // Same layout as m_atlasImage, only created while there are cached shadows.
+        Data::Instance<RPI::AttachmentImage> m_staticAtlasImage;
+        RHI::Ptr<RHI::ImageView> m_staticAtlasImageView;
 
         AZStd::unordered_map<RPI::RenderPipeline*, ProjectedShadowmapsPass*> m_projectedShadowmapsPasses;
         AZStd::unordered_map<RPI::RenderPipeline*, EsmShadowmapsPass*> m_esmShadowmapsPasses;
@@ -151,6 +166,11 @@ namespace AZ::Render
         Data::Instance<RPI::Shader> m_clearShadowShader;
         RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
 
+        Data::Instance<RPI::Shader> m_restoreShadowShader;
+        const RHI::PipelineState* m_restoreShadowPipelineState = nullptr;
+        RHI::ShaderInputNameIndex m_restoreStaticShadowmapIndex{ "m_staticShadowmap" };
+        RHI::ShaderInputNameIndex m_restoreArraySliceIndex{ "m_arraySlice" };
+
         RHI::ShaderInputNameIndex m_shadowmapAtlasSizeIndex{ "m_shadowmapAtlasSize" };
         RHI::ShaderInputNameIndex m_invShadowmapAtlasSizeIndex{ "m_invShadowmapAtlasSize" };
 
@@ -25,15 +25,32 @@
 
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_skinnedMeshFullRateScreenCoverage, 0.1f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skinned meshes that cover at least this fraction of the screen height in any view are skinned every frame. Smaller meshes "
+            "are skinned at a rate proportional to their screen coverage, down to r_skinnedMeshMaxUpdateInterval.");
+
+        AZ_CVAR(uint32_t, r_skinnedMeshMaxUpdateInterval, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of frames between the skinning updates of skinned meshes that are small on screen. 1 skins every mesh "
+            "every frame.");
+
+        AZ_CVAR(float, r_skinnedMeshMorphTargetScreenCoverageMin, 0.02f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skinned meshes that cover less than this fraction of the screen height in every view skip their morph targets.");
+
+        AZ_CVAR(int, r_skinnedMeshVertexBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The maximum number of vertices that are skinned per frame. Skinning updates of the meshes that are smallest on screen are "
+            "deferred to later frames when the budget is exceeded. 0 disables the budget.");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -158,13 +175,10 @@ namespace AZ
                                                 }
                                             }
                                             
-                                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                                            const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].get();
+                                            if (dispatchItem && dispatchItem->HasActiveTargets())
                                             {
-                                                const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                                {
-                                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                                }
+                                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                             }
                                         }
                                     }
@@ -180,6 +194,13 @@ namespace AZ
                 }
             }
 #else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+            static_assert(RPI::ModelLodAsset::LodCountMax <= 32, "The lods of a render proxy are stored in a 32 bit mask.");
+
+            const size_t vertexBudget = aznumeric_cast<size_t>(AZStd::max(static_cast<int>(r_skinnedMeshVertexBudget), 0));
+            m_statsCollector->BeginFrame(vertexBudget);
+            ++m_frameIndex;
+
+            m_skinningUpdates.clear();
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
@@ -195,6 +216,9 @@ namespace AZ
                 ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = modelDataInstance.GetCullable();
 
+                SkinningUpdate update;
+                update.m_renderProxy = &renderProxy;
+
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -214,26 +238,9 @@ namespace AZ
                     {
                     case RPI::Cullable::LodType::SpecificLod:
                     {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        
-                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                        {
-                            // Add one skinning dispatch item for each mesh in the lod
-                            if (skinnedMeshDispatchItem->IsEnabled())
-                            {
-                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                        
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
+                        // There's no screen coverage to throttle a specific lod by, so it's always updated at the full rate
+                        update.m_lodMask |= 1u << cullable.m_lodData.m_lodConfiguration.m_lodOverride;
+                        update.m_screenCoverage = AZStd::numeric_limits<float>::max();
                     }
                     break;
                     case RPI::Cullable::LodType::ScreenCoverage:
@@ -256,29 +263,119 @@ namespace AZ
                             //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                             if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                             {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                {
-                                    // Add one skinning dispatch item for each mesh in the lod
-                                    if (skinnedMeshDispatchItem->IsEnabled())
-                                    {
-                                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
+                                update.m_lodMask |= 1u << lodIndex;
+                                update.m_screenCoverage = AZStd::max(update.m_screenCoverage, approxScreenPercentage);
                             }
                         }
                         break;
                     }
                 }
+
+                if (update.m_lodMask != 0)
+                {
+                    // Meshes that are small on screen in every view are skinned every few frames. They keep their last skinned
+                    // pose in between. Proxies that were never skinned, or that need a lod that wasn't skinned in their last
+                    // update, don't have a valid pose to keep and are always updated.
+                    const uint32_t updateInterval = GetSkinningUpdateInterval(update.m_screenCoverage);
+                    update.m_isRequired = renderProxy.m_framesSinceSkinned == AZStd::numeric_limits<uint32_t>::max() ||
+                        (update.m_lodMask & ~renderProxy.m_skinnedLodMask) != 0 ||
+                        renderProxy.m_framesSinceSkinned >= updateInterval * 2;
+                    update.m_isDue = update.m_isRequired || renderProxy.m_framesSinceSkinned + 1 >= updateInterval ||
+                        (m_frameIndex + renderProxy.m_updatePhase) % updateInterval == 0;
+                    m_skinningUpdates.push_back(update);
+                }
+            }
+
+            // When there's a vertex budget, the proxies that are largest on screen get their updates first
+            if (vertexBudget > 0)
+            {
+                AZStd::sort(
+                    m_skinningUpdates.begin(), m_skinningUpdates.end(),
+                    [](const SkinningUpdate& lhs, const SkinningUpdate& rhs)
+                    {
+                        if (lhs.m_isRequired != rhs.m_isRequired)
+                        {
+                            return lhs.m_isRequired;
+                        }
+                        return lhs.m_screenCoverage > rhs.m_screenCoverage;
+                    });
+            }
+
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+            for (const SkinningUpdate& update : m_skinningUpdates)
+            {
+                SkinnedMeshRenderProxy& renderProxy = *update.m_renderProxy;
+                if (!update.m_isDue)
+                {
+                    m_statsCollector->AddThrottledRenderProxy();
+                    ++renderProxy.m_framesSinceSkinned;
+                    continue;
+                }
+
+                size_t vertexCount = 0;
+                for (uint32_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if (update.m_lodMask & (1u << lodIndex))
+                    {
+                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
+                        {
+                            if (skinnedMeshDispatchItem->IsEnabled())
+                            {
+                                vertexCount += skinnedMeshDispatchItem->GetVertexCount();
+                            }
+                        }
+                    }
+                }
+
+                if (!m_statsCollector->TryAddSkinnedVertices(vertexCount, update.m_isRequired))
+                {
+                    ++renderProxy.m_framesSinceSkinned;
+                    continue;
+                }
+
+                // The skinning shader consumes the accumulated morph target deltas, so they can only be dispatched together
+                // with the skinning. Meshes that are too small on screen for the morph targets to be noticed skip them.
+                const bool applyMorphTargets = update.m_screenCoverage >= r_skinnedMeshMorphTargetScreenCoverageMin;
+                bool skippedMorphTargets = false;
+
+                for (uint32_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if ((update.m_lodMask & (1u << lodIndex)) == 0)
+                    {
+                        continue;
+                    }
+
+                    for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
+                    {
+                        // Add one skinning dispatch item for each mesh in the lod
+                        if (skinnedMeshDispatchItem->IsEnabled())
+                        {
+                            m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
+                        }
+                    }
+
+                    // A single dispatch applies all the morph targets of the lod that have a non-zero weight
+                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].get();
+                    if (dispatchItem && dispatchItem->HasActiveTargets())
+                    {
+                        if (applyMorphTargets)
+                        {
+                            m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
+                        }
+                        else
+                        {
+                            skippedMorphTargets = true;
+                        }
+                    }
+                }
+
+                if (skippedMorphTargets)
+                {
+                    m_statsCollector->AddSkippedMorphTargets();
+                }
+
+                renderProxy.m_framesSinceSkinned = 0;
+                renderProxy.m_skinnedLodMask = update.m_lodMask;
             }
 #endif
         }
@@ -322,6 +419,10 @@ namespace AZ
             {
                 m_renderProxies.erase(handle);
             }
+            else
+            {
+                handle->m_updatePhase = m_nextUpdatePhase++;
+            }
             return handle;
         }
 
@@ -472,6 +573,21 @@ namespace AZ
             }
         }
 
+        uint32_t SkinnedMeshFeatureProcessor::GetSkinningUpdateInterval(float screenCoverage) const
+        {
+            const uint32_t maxUpdateInterval = AZStd::max(static_cast<uint32_t>(r_skinnedMeshMaxUpdateInterval), 1u);
+            const float fullRateScreenCoverage = r_skinnedMeshFullRateScreenCoverage;
+            if (maxUpdateInterval == 1 || screenCoverage >= fullRateScreenCoverage)
+            {
+                return 1;
+            }
+            if (screenCoverage * maxUpdateInterval <= fullRateScreenCoverage)
+            {
+                return maxUpdateInterval;
+            }
+            return aznumeric_cast<uint32_t>(ceilf(fullRateScreenCoverage / screenCoverage));
+        }
+
         Data::Instance<RPI::Shader> SkinnedMeshFeatureProcessor::GetSkinningShader() const
         {
             return m_skinningShader;
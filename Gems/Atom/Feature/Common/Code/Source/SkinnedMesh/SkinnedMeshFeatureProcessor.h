@@ -78,6 +78,23 @@ namespace AZ
 
             void InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline);
 
+            //! Returns the number of frames between the skinning updates of a render proxy with the screen coverage
+            uint32_t GetSkinningUpdateInterval(float screenCoverage) const;
+
+            //! The skinning a render proxy needs this frame
+            struct SkinningUpdate
+            {
+                SkinnedMeshRenderProxy* m_renderProxy = nullptr;
+                //! The largest screen coverage of the proxy in any view
+                float m_screenCoverage = 0.0f;
+                //! The lods that are visible in any view, one bit per lod
+                uint32_t m_lodMask = 0;
+                //! Set if the proxy's update interval has passed
+                bool m_isDue = false;
+                //! Set if the proxy has no valid pose for its lods and is updated regardless of the budget
+                bool m_isRequired = false;
+            };
+
             static const char* s_featureProcessorName;
 
             Data::Instance<RPI::Shader> m_skinningShader;
@@ -89,6 +106,10 @@ namespace AZ
             StableDynamicArray<SkinnedMeshRenderProxy> m_renderProxies;
             AZStd::unique_ptr<SkinnedMeshStatsCollector> m_statsCollector;
 
+            AZStd::vector<SkinningUpdate> m_skinningUpdates;
+            uint32_t m_frameIndex = 0;
+            uint32_t m_nextUpdatePhase = 0;
+
             AZStd::unordered_set<const RHI::DispatchItem*> m_skinningDispatches;
             bool m_alreadyCreatedSkinningScopeThisFrame = false;
 
@@ -266,18 +266,69 @@ namespace AZ
             float minWeight = 0.0f,
             float maxWeight = 1.0f)
         {
+            using namespace MorphTargetConstants;
+
+            const uint32_t blockOffset = aznumeric_cast<uint32_t>(m_packedMorphTargetDeltaBlocks.size() / s_packedDeltaBlockSizeInWords);
             m_morphTargetComputeMetaDatas.push_back(MorphTargetComputeMetaData{
-                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_meshIndex });
+                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices,
+                blockOffset, 0, morphTarget.m_meshIndex });
 
-            // Create a view into the larger per-lod morph buffer for this particular morph
             // The morphTarget itself refers to an offset from within the mesh, so combine that
-            // with the mesh offset to get the view within the lod buffer
-            RHI::BufferViewDescriptor morphView = morphBufferAssetView->GetBufferViewDescriptor();
-            morphView.m_elementOffset += morphTarget.m_startIndex;
-            morphView.m_elementCount = morphTarget.m_numVertices;
-            RPI::BufferAssetView morphTargetDeltaView{ morphBufferAssetView->GetBufferAsset(), morphView };
+            // with the mesh offset to get the deltas within the lod buffer.
+            // A morph target that can't be read is kept without any blocks, so the weights still line up with the morph targets
+            const RHI::BufferViewDescriptor& morphView = morphBufferAssetView->GetBufferViewDescriptor();
+            const AZStd::span<const uint8_t> morphBuffer = morphBufferAssetView->GetBufferAsset()->GetBuffer();
+            const uint64_t deltaOffset = uint64_t(morphView.m_elementOffset) + morphTarget.m_startIndex;
+            if (morphView.m_elementSize != sizeof(RPI::PackedCompressedMorphTargetDelta) ||
+                (deltaOffset + morphTarget.m_numVertices) * sizeof(RPI::PackedCompressedMorphTargetDelta) > morphBuffer.size())
+            {
+                AZ_Error("SkinnedMeshInputBuffers", false, "Failed to read the deltas of morph target '%s'.", bufferNamePrefix.c_str());
+                return;
+            }
+
+            // The deltas are applied with atomics, so they can be sorted by vertex to keep the vertices of each block close together
+            const RPI::PackedCompressedMorphTargetDelta* sourceDeltas =
+                reinterpret_cast<const RPI::PackedCompressedMorphTargetDelta*>(morphBuffer.data()) + deltaOffset;
+            AZStd::vector<RPI::PackedCompressedMorphTargetDelta> deltas(sourceDeltas, sourceDeltas + morphTarget.m_numVertices);
+            AZStd::sort(
+                deltas.begin(), deltas.end(),
+                [](const RPI::PackedCompressedMorphTargetDelta& lhs, const RPI::PackedCompressedMorphTargetDelta& rhs)
+                {
+                    return lhs.m_morphedVertexIndex < rhs.m_morphedVertexIndex;
+                });
 
-            m_morphTargetInputBuffers.push_back(aznew MorphTargetInputBuffers{ morphTargetDeltaView, bufferNamePrefix });
+            uint32_t blockCount = 0;
+            uint32_t blockStart = 0;
+            while (blockStart < deltas.size())
+            {
+                const uint32_t firstDelta = aznumeric_cast<uint32_t>(m_packedMorphTargetDeltas.size() / s_packedDeltaSizeInWords);
+                if (firstDelta > s_deltaBlockFirstDeltaMask)
+                {
+                    AZ_Error("SkinnedMeshInputBuffers", false, "Morph target '%s' exceeds the maximum number of deltas per lod.", bufferNamePrefix.c_str());
+                    break;
+                }
+
+                const uint32_t blockVertex = deltas[blockStart].m_morphedVertexIndex;
+                uint32_t blockEnd = blockStart;
+                while (blockEnd < deltas.size() && blockEnd - blockStart < s_deltaBlockSize &&
+                       deltas[blockEnd].m_morphedVertexIndex - blockVertex < s_deltaBlockVertexSpan)
+                {
+                    // The upper 8 bits of the bitangent word are padding, which is where the vertex offset is stored instead
+                    const RPI::PackedCompressedMorphTargetDelta& delta = deltas[blockEnd];
+                    m_packedMorphTargetDeltas.push_back(delta.m_positionXY);
+                    m_packedMorphTargetDeltas.push_back(delta.m_positionZNormalXY);
+                    m_packedMorphTargetDeltas.push_back(delta.m_normalZTangentXYZ);
+                    m_packedMorphTargetDeltas.push_back(((delta.m_morphedVertexIndex - blockVertex) << 24) | (delta.m_padBitangentXYZ & 0x00FFFFFF));
+                    ++blockEnd;
+                }
+
+                m_packedMorphTargetDeltaBlocks.push_back(firstDelta | ((blockEnd - blockStart - 1) << s_deltaBlockCountShift));
+                m_packedMorphTargetDeltaBlocks.push_back(blockVertex);
+                ++blockCount;
+                blockStart = blockEnd;
+            }
+
+            m_morphTargetComputeMetaDatas.back().m_blockCount = blockCount;
         }
 
         const AZStd::vector<MorphTargetComputeMetaData>& SkinnedMeshInputLod::GetMorphTargetComputeMetaDatas() const
@@ -285,11 +336,23 @@ namespace AZ
             return m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
         {
             return m_morphTargetInputBuffers;
         }
 
+        void SkinnedMeshInputLod::CreateMorphTargetInputBuffers(const AZStd::string& bufferNamePrefix)
+        {
+            if (!m_packedMorphTargetDeltas.empty())
+            {
+                m_morphTargetInputBuffers = aznew MorphTargetInputBuffers{ m_packedMorphTargetDeltas, m_packedMorphTargetDeltaBlocks, bufferNamePrefix };
+            }
+
+            // The data is only needed to create the buffers
+            m_packedMorphTargetDeltas = {};
+            m_packedMorphTargetDeltaBlocks = {};
+        }
+
         void SkinnedMeshInputLod::CalculateMorphTargetIntegerEncodings()
         {
             AZStd::vector<float> ranges(m_meshes.size(), 0.0f);
@@ -398,7 +461,7 @@ namespace AZ
             return m_lods[lodIndex].m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex) const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex) const
         {
             return m_lods[lodIndex].m_morphTargetInputBuffers;
         }
@@ -421,9 +484,11 @@ namespace AZ
 
         void SkinnedMeshInputBuffers::Finalize()
         {
-            for (SkinnedMeshInputLod& lod : m_lods)
+            for (uint32_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
             {
-                lod.CalculateMorphTargetIntegerEncodings();
+                m_lods[lodIndex].CalculateMorphTargetIntegerEncodings();
+                m_lods[lodIndex].CreateMorphTargetInputBuffers(
+                    AZStd::string::format("%s_Lod%" PRIu32 "_", m_modelAsset.GetHint().c_str(), lodIndex));
             }
         }
 
@@ -71,7 +71,7 @@ namespace AZ
 
             // Create a vector of dispatch items for each lod
             m_dispatchItemsByLod.emplace_back(AZStd::vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>>());
-            m_morphTargetDispatchItemsByLod.emplace_back(AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>());
+            m_morphTargetDispatchItemsByLod.emplace_back();
 
             size_t meshCount = m_inputBuffers->GetMeshCount(modelLodIndex);
             m_dispatchItemsByLod[modelLodIndex].reserve(meshCount);
@@ -101,36 +101,36 @@ namespace AZ
                 }
             }
 
-            size_t morphTargetCount = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex).size();
-            AZ_Assert(
-                m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex).size() == morphTargetCount,
-                "SkinnedMeshRenderProxy: Invalid SkinnedMeshInputBuffers have mis-matched morph target input buffers and compute metadata");
-            m_morphTargetDispatchItemsByLod[modelLodIndex].reserve(morphTargetCount);
-
-            // Create one dispatch item per morph target, in the order that they were originally added
-            // to the skinned mesh to stay in sync with the animation system
-            for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& morphTargetInputBuffers = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex);
+            if (morphTargetInputBuffers)
             {
-                const MorphTargetComputeMetaData& metaData =
-                    m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex)[morphTargetIndex];
-
-                m_morphTargetDispatchItemsByLod[modelLodIndex].emplace_back(
-                    aznew MorphTargetDispatchItem
-                    {
-                        m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex)[morphTargetIndex],
-                        metaData,
-                        m_featureProcessor,
-                        m_instance->m_morphTargetInstanceMetaData[modelLodIndex][metaData.m_meshIndex],
-                        m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, metaData.m_meshIndex)
-                    });
+                AZStd::vector<MorphTargetInstanceMetaData> morphInstanceMetaDatas;
+                AZStd::vector<float> morphTargetIntegerEncodings;
+                morphInstanceMetaDatas.reserve(meshCount);
+                morphTargetIntegerEncodings.reserve(meshCount);
+                for (uint32_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+                {
+                    morphInstanceMetaDatas.push_back(m_instance->m_morphTargetInstanceMetaData[modelLodIndex][meshIndex]);
+                    morphTargetIntegerEncodings.push_back(m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, meshIndex));
+                }
+
+                // Create one dispatch item for all the morph targets of the lod, which are kept in the order that they were originally added
+                // to the skinned mesh to stay in sync with the animation system
+                m_morphTargetDispatchItemsByLod[modelLodIndex] = AZStd::make_unique<MorphTargetDispatchItem>(
+                    morphTargetInputBuffers,
+                    m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex),
+                    m_featureProcessor,
+                    AZStd::move(morphInstanceMetaDatas),
+                    AZStd::move(morphTargetIntegerEncodings));
 
                 // Initialize the MorphTargetDispatchItem we just created
-                if (!m_morphTargetDispatchItemsByLod[modelLodIndex].back()->Init())
+                if (!m_morphTargetDispatchItemsByLod[modelLodIndex]->Init())
                 {
                     return false;
                 }
             }
-            
+
+
             return true;
         }
 
@@ -144,12 +144,13 @@ namespace AZ
 
         void SkinnedMeshRenderProxy::SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights)
         {
-            auto& morphTargetDispatchItems = m_morphTargetDispatchItemsByLod[lodIndex];
-
-            AZ_Assert(morphTargetDispatchItems.size() == weights.size(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with morph target dispatch items.");
-            for (size_t morphIndex = 0; morphIndex < weights.size(); ++morphIndex)
+            if (MorphTargetDispatchItem* morphTargetDispatchItem = m_morphTargetDispatchItemsByLod[lodIndex].get())
+            {
+                morphTargetDispatchItem->SetWeights(weights);
+            }
+            else
             {
-                morphTargetDispatchItems[morphIndex]->SetWeight(weights[morphIndex]);
+                AZ_Assert(weights.empty(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight for a lod without morph targets.");
             }
         }
 
@@ -54,7 +54,8 @@ namespace AZ
             bool BuildDispatchItem(const RPI::Scene& scene, uint32_t modelLodIndex, const SkinnedMeshShaderOptions& shaderOptions);
 
             AZStd::fixed_vector<AZStd::vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>>, RPI::ModelLodAsset::LodCountMax> m_dispatchItemsByLod;
-            AZStd::fixed_vector<AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod;
+            //! One dispatch item that applies all the morph targets of each lod, or null for lods without morph targets
+            AZStd::fixed_vector<AZStd::unique_ptr<MorphTargetDispatchItem>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod;
             Data::Instance<SkinnedMeshInputBuffers> m_inputBuffers;
             AZStd::intrusive_ptr<SkinnedMeshInstance> m_instance;
             AZStd::shared_ptr<MeshFeatureProcessorInterface::MeshHandle> m_meshHandle;
@@ -63,6 +64,14 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_boneTransforms;
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
+
+            // Skinning update rate throttling, see SkinnedMeshFeatureProcessor::Render
+            //! The number of frames since the proxy was last skinned, which is the maximum before its first update
+            uint32_t m_framesSinceSkinned = AZStd::numeric_limits<uint32_t>::max();
+            //! The lods that were skinned in the last update, one bit per lod
+            uint32_t m_skinnedLodMask = 0;
+            //! Offsets the frames the proxy is updated in, so proxies with the same update interval don't all update in the same frame
+            uint32_t m_updatePhase = 0;
         };
     } // namespace Render
 } // namespace AZ
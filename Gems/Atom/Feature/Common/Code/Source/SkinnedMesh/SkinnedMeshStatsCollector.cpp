@@ -27,6 +27,12 @@ namespace AZ
         SkinnedMeshSceneStats SkinnedMeshStatsCollector::GetSceneStats()
         {
             m_sceneStats.skinnedMeshRenderProxyCount = m_featureProcessor->m_renderProxies.size();
+            m_sceneStats.skinnedRenderProxyCount = m_lastFrameStats.skinnedRenderProxyCount;
+            m_sceneStats.skinnedVertexCount = m_lastFrameStats.skinnedVertexCount;
+            m_sceneStats.throttledRenderProxyCount = m_lastFrameStats.throttledRenderProxyCount;
+            m_sceneStats.budgetDeferredRenderProxyCount = m_lastFrameStats.budgetDeferredRenderProxyCount;
+            m_sceneStats.skippedMorphTargetRenderProxyCount = m_lastFrameStats.skippedMorphTargetRenderProxyCount;
+            m_sceneStats.vertexBudget = m_lastFrameStats.vertexBudget;
 
             for (const SkinnedMeshRenderProxy& renderProxy : m_featureProcessor->m_renderProxies)
             {
@@ -47,6 +53,36 @@ namespace AZ
             return results;
         }
 
+        void SkinnedMeshStatsCollector::BeginFrame(size_t vertexBudget)
+        {
+            m_lastFrameStats = m_frameStats;
+            m_frameStats = SkinnedMeshSceneStats();
+            m_frameStats.vertexBudget = vertexBudget;
+        }
+
+        bool SkinnedMeshStatsCollector::TryAddSkinnedVertices(size_t vertexCount, bool isRequired)
+        {
+            if (!isRequired && m_frameStats.vertexBudget > 0 && m_frameStats.skinnedVertexCount + vertexCount > m_frameStats.vertexBudget)
+            {
+                m_frameStats.budgetDeferredRenderProxyCount++;
+                return false;
+            }
+
+            m_frameStats.skinnedRenderProxyCount++;
+            m_frameStats.skinnedVertexCount += vertexCount;
+            return true;
+        }
+
+        void SkinnedMeshStatsCollector::AddThrottledRenderProxy()
+        {
+            m_frameStats.throttledRenderProxyCount++;
+        }
+
+        void SkinnedMeshStatsCollector::AddSkippedMorphTargets()
+        {
+            m_frameStats.skippedMorphTargetRenderProxyCount++;
+        }
+
         void SkinnedMeshStatsCollector::ResetAllStats()
         {
             m_sceneStats = SkinnedMeshSceneStats();
@@ -29,6 +29,19 @@ namespace AZ
             //! GetSceneStats re-calculates all the scene stats on demand. Requesting them every frame means re-calculating them every frame
             virtual SkinnedMeshSceneStats GetSceneStats() override;
 
+            //! Starts collecting the skinning work of a new frame, which is limited to vertexBudget skinned vertices if it's not 0
+            void BeginFrame(size_t vertexBudget);
+
+            //! Adds the vertices of a render proxy that's due for a skinning update to the frame. Returns false if the update
+            //! has to be deferred to stay within the budget, unless the update is required, in which case it's always added.
+            bool TryAddSkinnedVertices(size_t vertexCount, bool isRequired);
+
+            //! Counts a render proxy that was skipped because it's updated at a reduced rate
+            void AddThrottledRenderProxy();
+
+            //! Counts a render proxy whose morph targets were skipped because it's too small on screen
+            void AddSkippedMorphTargets();
+
         private:
             void ResetAllStats();
             void AddDispatchItemToSceneStats(const AZStd::unique_ptr<SkinnedMeshDispatchItem>& dispatchItem);
@@ -36,6 +49,9 @@ namespace AZ
             void AddVerticesToSceneStats(size_t vertexCount);
 
             SkinnedMeshSceneStats m_sceneStats;
+            // The skinning work of the frame that's being collected, and of the last complete frame
+            SkinnedMeshSceneStats m_frameStats;
+            SkinnedMeshSceneStats m_lastFrameStats;
             // Use sets to ensure we're not double-counting any resources that are shared
             AZStd::unordered_set<RPI::Buffer*> m_sceneBoneTransforms;
             SkinnedMeshFeatureProcessor* m_featureProcessor;
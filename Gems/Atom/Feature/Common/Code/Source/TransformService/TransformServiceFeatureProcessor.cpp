@@ -14,6 +14,8 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
 
+#include <AzCore/std/sort.h>
+
 #include <cinttypes>
 
 namespace AZ
@@ -22,6 +24,14 @@ namespace AZ
     {
         constexpr size_t BufferReserveCount = 1024;
 
+        // Dirty indices that are at most this many entries apart are uploaded together, since every upload has a fixed cost
+        constexpr uint32_t UploadRangeMergeDistance = 8;
+
+        // The buffers are uploaded in full when more entries than this fraction of them are dirty, or when the dirty entries are spread
+        // over more ranges than this
+        constexpr float FullUploadDirtyRatio = 0.5f;
+        constexpr uint32_t MaxUploadRangeCount = 64;
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -38,6 +48,7 @@ namespace AZ
             GetParentScene()->ConnectEvent(m_updateSceneSrgHandler);
 
             m_deviceBufferNeedsUpdate = true;
+            m_deviceBufferNeedsFullUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
             m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
 
@@ -50,6 +61,12 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+            m_dirtyIndices = {};
+            m_historyDirtyIndices = {};
+            m_deviceBufferNeedsUpdate = false;
+            m_historyBufferNeedsUpdate = false;
+            m_uploadedByteCount = 0;
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +84,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersChanged = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +112,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersChanged = true;
                 }
                 else
                 {
@@ -100,6 +120,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersChanged = true;
                     }
                 }
             }
@@ -120,15 +141,55 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersChanged = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersChanged = true;
                     }
                 }
             }
+
+            return buffersChanged;
+        }
+
+        uint64_t TransformServiceFeatureProcessor::UploadIndices(
+            RPI::Buffer& buffer, const AZStd::vector<Float4x3>& values, size_t valueSize, const AZStd::vector<uint32_t>& indices, bool fullUpload)
+        {
+            if (!fullUpload)
+            {
+                uint32_t rangeCount = 0;
+                for (size_t i = 0; i < indices.size() && rangeCount <= MaxUploadRangeCount; ++rangeCount)
+                {
+                    for (++i; i < indices.size() && indices[i] - indices[i - 1] <= UploadRangeMergeDistance; ++i)
+                    {
+                    }
+                }
+                fullUpload = rangeCount > MaxUploadRangeCount;
+            }
+
+            if (fullUpload)
+            {
+                buffer.UpdateData(values.data(), values.size() * valueSize);
+                return values.size() * valueSize;
+            }
+
+            uint64_t uploadedByteCount = 0;
+            for (size_t i = 0; i < indices.size();)
+            {
+                const uint32_t begin = indices[i];
+                for (++i; i < indices.size() && indices[i] - indices[i - 1] <= UploadRangeMergeDistance; ++i)
+                {
+                }
+                const uint32_t end = indices[i - 1] + 1;
+                const uint64_t byteCount = (end - begin) * valueSize;
+                buffer.UpdateData(values.data() + begin, byteCount, begin * valueSize);
+                uploadedByteCount += byteCount;
+            }
+            return uploadedByteCount;
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -140,26 +201,64 @@ namespace AZ
 
         void TransformServiceFeatureProcessor::OnBeginPrepareRender()
         {
+            AZ_PROFILE_SCOPE(AzRender, "TransformServiceFeatureProcessor: OnBeginPrepareRender");
+
             m_isWriteable = false;
+            m_uploadedByteCount = 0;
 
             if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
+                // Buffers that were created or resized don't keep their contents, so all of them are uploaded in full
+                if (PrepareBuffers())
+                {
+                    m_deviceBufferNeedsUpdate = true;
+                    m_deviceBufferNeedsFullUpdate = true;
+                    m_historyBufferNeedsFullUpdate = true;
+                }
+
+                // The history buffer receives the values that were uploaded to the transform buffers last frame, which are still in
+                // m_objectToWorldHistoryTransforms until the values of this frame are copied over below
+                if (m_historyBufferNeedsUpdate || m_historyBufferNeedsFullUpdate)
                 {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                    m_uploadedByteCount += UploadIndices(
+                        *m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms, TransformValueSize, m_historyDirtyIndices,
+                        m_historyBufferNeedsFullUpdate);
+                    m_historyDirtyIndices.clear();
                     m_historyBufferNeedsUpdate = false;
+                    m_historyBufferNeedsFullUpdate = false;
                 }
 
                 if (m_deviceBufferNeedsUpdate)
                 {
+                    AZStd::sort(m_dirtyIndices.begin(), m_dirtyIndices.end());
+                    m_dirtyIndices.erase(AZStd::unique(m_dirtyIndices.begin(), m_dirtyIndices.end()), m_dirtyIndices.end());
+                    const bool fullUpdate = m_deviceBufferNeedsFullUpdate ||
+                        m_dirtyIndices.size() > m_objectToWorldTransforms.size() * FullUploadDirtyRatio;
+
                     // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+                    m_uploadedByteCount += UploadIndices(
+                        *m_objectToWorldBuffer, m_objectToWorldTransforms, TransformValueSize, m_dirtyIndices, fullUpdate);
+                    m_uploadedByteCount += UploadIndices(
+                        *m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms, NormalValueSize, m_dirtyIndices,
+                        fullUpdate);
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                    if (fullUpdate)
+                    {
+                        m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+                        m_historyBufferNeedsFullUpdate = true;
+                    }
+                    else
+                    {
+                        for (uint32_t index : m_dirtyIndices)
+                        {
+                            m_objectToWorldHistoryTransforms[index] = m_objectToWorldTransforms[index];
+                        }
+                        AZStd::swap(m_historyDirtyIndices, m_dirtyIndices);
+                    }
+                    m_dirtyIndices.clear();
 
                     m_deviceBufferNeedsUpdate = false;
+                    m_deviceBufferNeedsFullUpdate = false;
                     m_historyBufferNeedsUpdate = true;
                 }
             }
@@ -213,6 +312,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
+                m_dirtyIndices.push_back(id.GetIndex());
                 m_deviceBufferNeedsUpdate = true;
             }
         }
@@ -232,5 +332,10 @@ namespace AZ
             AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromRowMajorFloat12(m_objectToWorldTransforms.at(id.GetIndex()).m_transform);
             return matrix3x4.RetrieveScale();
         }
+
+        uint64_t TransformServiceFeatureProcessor::GetUploadedByteCount() const
+        {
+            return m_uploadedByteCount;
+        }
     }
 }
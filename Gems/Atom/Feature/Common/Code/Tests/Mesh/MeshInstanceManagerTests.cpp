@@ -143,4 +143,30 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+    TEST_F(MeshInstanceManagerTestFixture, GroupIndex_GroupRemoved_IndexIsReused)
+    {
+        // Each group gets its own dense index
+        EXPECT_EQ(m_meshInstanceManager.GetGroupIndexCount(), keyCount);
+        AZStd::array<bool, keyCount> usedIndices{};
+        for (size_t i = 0; i < m_indices.size(); ++i)
+        {
+            const uint32_t groupIndex = m_meshInstanceManager[m_indices[i].m_handle].m_groupIndex;
+            ASSERT_LT(groupIndex, keyCount);
+            EXPECT_FALSE(usedIndices[groupIndex]);
+            usedIndices[groupIndex] = true;
+        }
+
+        // A group added after another was removed takes over the removed group's index
+        const uint32_t removedGroupIndex = m_meshInstanceManager[m_indices[1].m_handle].m_groupIndex;
+        m_meshInstanceManager.RemoveInstance(m_uniqueKeys[1]);
+        MeshInstanceManager::InsertResult result = m_meshInstanceManager.AddInstance(m_uniqueKeys[1]);
+        EXPECT_EQ(m_meshInstanceManager[result.m_handle].m_groupIndex, removedGroupIndex);
+        EXPECT_EQ(m_meshInstanceManager.GetGroupIndexCount(), keyCount);
+
+        for (size_t i = 0; i < m_uniqueKeys.size(); ++i)
+        {
+            m_meshInstanceManager.RemoveInstance(m_uniqueKeys[i]);
+        }
+    }
+
 } // namespace UnitTest
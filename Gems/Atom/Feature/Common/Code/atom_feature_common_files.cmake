@@ -89,6 +89,8 @@ set(FILES
     Source/CoreLights/EsmShadowmapsPass.cpp
     Source/CoreLights/LightCullingPass.cpp
     Source/CoreLights/LightCullingPass.h
+    Source/CoreLights/LightCullingClusteredPass.cpp
+    Source/CoreLights/LightCullingClusteredPass.h
     Source/CoreLights/LightCullingTilePreparePass.cpp
     Source/CoreLights/LightCullingTilePreparePass.h
     Source/CoreLights/LightCullingRemap.cpp
@@ -162,6 +164,12 @@ set(FILES
     Source/Math/MathFilter.h
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
+    Source/Mesh/BindlessMaterialDataBuffer.cpp
+    Source/Mesh/BindlessMaterialDataBuffer.h
+    Source/Mesh/BindlessMaterialStreamingFeedback.cpp
+    Source/Mesh/BindlessMaterialStreamingFeedback.h
+    Source/Mesh/BindlessMaterialStreamingFeedbackPass.cpp
+    Source/Mesh/BindlessMaterialStreamingFeedbackPass.h
     Source/Mesh/MeshInstanceGroupKey.cpp
     Source/Mesh/MeshInstanceGroupKey.h
     Source/Mesh/MeshInstanceGroupList.cpp
@@ -169,6 +177,12 @@ set(FILES
     Source/Mesh/MeshInstanceManager.cpp
     Source/Mesh/MeshInstanceManager.h
     Source/Mesh/MeshFeatureProcessor.cpp
+    Source/Mesh/MeshOcclusionCullingPass.cpp
+    Source/Mesh/MeshOcclusionCullingPass.h
+    Source/Mesh/MeshGpuDrivenCullingPass.cpp
+    Source/Mesh/MeshGpuDrivenCullingPass.h
+    Source/Mesh/MeshGpuDrivenInstancing.cpp
+    Source/Mesh/MeshGpuDrivenInstancing.h
     Source/Mesh/ModelReloader.cpp
     Source/Mesh/ModelReloader.h
     Source/Mesh/ModelReloaderSystem.cpp
@@ -89,6 +89,21 @@ namespace AZ::RHI
                                const AZStd::string& tempFolder,
                                const char* toolNameForLog);
 
+    //! Same as ExecuteShaderCompiler, but looks up the outputs in the shader compiler cache first.
+    //! The cache is a folder set with the "/O3DE/Atom/ShaderCompilerCacheFolder" registry key, which can be a network share
+    //! so that the build machines reuse each other's results. When the key isn't set, this only calls ExecuteShaderCompiler.
+    //! Entries are keyed by the content of @inputFile, the executable and the parameters, where the paths of @inputFile and
+    //! @outputFiles are replaced by placeholders since every job has its own temp folder.
+    //! @inputFile must be self-contained, files that it includes are not part of the key.
+    //! @outputFiles All the files written by the compiler, they are copied to the cache after a successful compilation.
+    bool ExecuteShaderCompilerCached(const AZStd::string& executablePath,
+                                     const AZStd::string& parameters,
+                                     const AZStd::string& inputFile,
+                                     const AZStd::vector<AZStd::string>& outputFiles,
+                                     const AZStd::string& shaderSourcePathForDebug,
+                                     const AZStd::string& tempFolder,
+                                     const char* toolNameForLog);
+
     //! Reports messages with AZ_Error or AZ_Warning (See @reportAsErrors).
     //! @param window  Debug window name used for AZ Trace functions.
     //! @param errorMessages  Message string.
@@ -50,6 +50,23 @@ namespace AZ::RHI
             size_t m_minimumSizeInBytes = 0;
         };
 
+        //! The shader resource group compilations of a shader resource group pool during the last frame.
+        struct ShaderResourceGroupCompiles
+        {
+            //! The number of groups that were compiled.
+            uint32_t m_compiledGroupCount = 0;
+
+            //! The number of groups that were queued for compilation but had nothing to update.
+            uint32_t m_skippedGroupCount = 0;
+
+            //! The number of constant bytes the compiled groups needed to update.
+            size_t m_compiledConstantBytes = 0;
+
+            //! The size of the constant data of the compiled groups. Compare with m_compiledConstantBytes to see
+            //! how much of the constant data upload is saved by only updating the modified bytes.
+            size_t m_totalConstantBytes = 0;
+        };
+
         //! This structure tracks the memory usage of a specific pool instance. Pools associate with, at most, one
         //! heap from a specific heap type (e.g. host / device).
         struct Pool
@@ -65,6 +82,9 @@ namespace AZ::RHI
 
             //! The memory usage of the pool.
             PoolMemoryUsage m_memoryUsage;
+
+            //! The compilations of the last frame. Only reported by shader resource group pools.
+            ShaderResourceGroupCompiles m_shaderResourceGroupCompiles;
         };
 
         //! This structure tracks an instance of a physical memory heap. For certain platforms, there
@@ -68,6 +68,14 @@ namespace AZ::RHI
             /// using the ObjectPooling policy, this will match the heap size.
             size_t m_watermarkSize = 0;
 
+            /// The maximum, across all scopes, of the total size of the attachments that are alive during the scope.
+            /// No placement of the attachments can use less memory than this.
+            size_t m_peakLiveSize = 0;
+
+            /// True when the attachments were placed using a placement computed from the attachments of previous frames,
+            /// instead of being allocated first-fit as they are activated.
+            bool m_usesPlacementPlan = false;
+
             /// Vector of attachments that were allocated on this heap for the previous frame.
             AZStd::vector<Attachment> m_attachments;
 
@@ -44,6 +44,10 @@ namespace AZ::RHI
     //! Aliased Heaps are used for allocating transient attachments (resources that are valid only during the duration of a frame).
     //! and they will reuse memory whenever possible, and will also track the necessary barriers that need to be inserted when aliasing happens.
     //! Aliased Heaps do not support aliased resources being used at the same time (even if the resources are compatible).
+    //!
+    //! Attachments are allocated first-fit as they are activated, which can fragment the heap. Once the attachments of the heap
+    //! have been the same for a few frames, the heap packs their lifetimes offline, largest attachments first, and places the
+    //! attachments of the following frames at the packed offsets as long as the packing uses less memory than first-fit did.
     class AliasedHeap
         : public ResourcePool
     {
@@ -122,6 +126,20 @@ namespace AZ::RHI
     private:
         void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
+        /// Allocates the heap range of an attachment. Uses the placement plan if there is one.
+        VirtualAddress AllocateRange(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes);
+
+        /// Frees the heap range of an attachment.
+        void DeAllocateRange(size_t heapOffset);
+
+        /// Adds the attachment that was just allocated to the heap statistics.
+        TransientAttachmentStatistics::Attachment& AddAttachmentStatistics(
+            const AttachmentId& attachmentId, Resource* resource, Scope& scope, size_t heapOffset, const ResourceMemoryRequirements& memRequirements);
+
+        /// Computes the peak live size of the frame, and creates or discards the placement plan depending on whether
+        /// the attachments of the heap have been stable.
+        void UpdatePlacementPlan();
+
         /// Descriptor of the heap.
         AliasedHeapDescriptor m_descriptor;
 
@@ -158,5 +176,36 @@ namespace AZ::RHI
         // This map is used to reverse look up resource hash so we can clear them out of m_cache
         // once they have been replaced with a new resource at a different place in the heap. 
         AZStd::unordered_map<AttachmentId, HashValue64> m_reverseLookupHash;
+
+        struct PlannedPlacement
+        {
+            size_t m_heapOffset = 0;
+            size_t m_sizeInBytes = 0;
+        };
+
+        struct HeapRange
+        {
+            size_t m_offsetMin = 0;
+            size_t m_offsetEnd = 0;
+        };
+
+        /// The heap offset of each attachment, packed from the attachments of a previous frame.
+        AZStd::unordered_map<AttachmentId, PlannedPlacement> m_placementPlan;
+
+        /// The hash of the attachments the placement plan was computed for. Also set when the attachments couldn't be packed
+        /// any better than first-fit, so the packing isn't computed again every frame.
+        HashValue64 m_placementPlanHash = HashValue64{ 0 };
+
+        /// The hash of the attachments of the previous frame and the number of frames in a row they have been the same.
+        HashValue64 m_lastFrameHash = HashValue64{ 0 };
+        uint32_t m_stableFrameCount = 0;
+
+        /// Set between Begin and End when the attachments are placed using the placement plan. The first-fit allocator
+        /// isn't used in that case, instead the ranges of the active attachments are kept sorted by offset.
+        bool m_usePlacementPlan = false;
+        AZStd::vector<HeapRange> m_activeRanges;
+
+        /// The alignment of each attachment in m_heapStats.m_attachments, in activation order.
+        AZStd::vector<size_t> m_attachmentAlignments;
     };
 }
@@ -92,6 +92,14 @@ namespace AZ::RHI
         //! other, these additional constants will be added to the end of the returned list.
         AZStd::vector<ShaderInputConstantIndex> GetIndicesOfDifferingConstants(const ConstantsData& other) const;
 
+        //! Returns the interval of bytes that were written since the last call to ResetDirtyInterval. The interval
+        //! is empty when nothing was written. Newly created constant data is treated as fully written.
+        Interval GetDirtyInterval() const;
+
+        //! Marks all the constant data as unmodified. Users that keep their constants data alive between compiles
+        //! call this after each compile, so only the modified bytes need to be uploaded.
+        void ResetDirtyInterval();
+
     private:
         enum class ValidateConstantAccessExpect : uint32_t
         {
@@ -114,8 +122,12 @@ namespace AZ::RHI
         template <typename T, uint32_t matrixSize>
         bool SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount);
 
+        //! Grows the dirty interval to include the bytes [byteOffset, byteOffset + byteCount).
+        void MarkDirty(size_t byteOffset, size_t byteCount);
+
         ConstPtr<ConstantsLayout> m_layout;
         AZStd::vector<uint8_t> m_constantData;
+        Interval m_dirtyInterval;
     };
 
     template <typename T>
@@ -192,6 +204,7 @@ namespace AZ::RHI
             {
                 value.GetRow(i).StoreToFloat4(row + i * 4);
             }
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -51,6 +51,14 @@ namespace AZ::RHI
         /// be called from a single thread as a sync point between the append / consume phases.
         void FinalizeLists();
 
+        /// Splits FinalizeLists so the draw lists can be coalesced in parallel. Clears the coalesced draw lists and
+        /// returns the tags that have draw items to coalesce. FinalizeList must then be called once for each of them.
+        DrawListMask BeginFinalizeLists();
+
+        /// Coalesces the draw items of the tag from all threads. This may be called from multiple threads for
+        /// different tags once BeginFinalizeLists has returned.
+        void FinalizeList(DrawListTag drawListTag);
+
         /// Returns the draw list associated with the provided tag.
         DrawListView GetList(DrawListTag drawListTag) const;
 
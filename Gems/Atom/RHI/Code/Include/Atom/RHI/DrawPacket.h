@@ -88,6 +88,9 @@ namespace AZ::RHI
         //! Set the instance count in all draw items.
         void SetInstanceCount(uint32_t instanceCount);
 
+        //! Replace the draw arguments in all draw items. Like SetInstanceCount, this should only be used on a cloned draw packet.
+        void SetDrawArguments(const DrawArguments& drawArguments);
+
     private:
         /// Use DrawPacketBuilder to construct an instance.
         DrawPacket() = default;
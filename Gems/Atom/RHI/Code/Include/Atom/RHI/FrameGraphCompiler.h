@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
@@ -158,6 +159,11 @@ namespace AZ::RHI
     //! Finally, because the resources themselves are effectively re-created each frame, a cache of views is
     //! kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
     //! bounded in order to release entries old views.
+    //!
+    //! The frame graph rarely changes between frames, so the results of this phase are cached (see r_frameGraphCompileCache).
+    //! The compiler hashes the scope graph and the transient attachments with their descriptors and lifetimes. While the hash
+    //! matches the previous frame, the async queue lifetime extension, the sorted activation commands and the memory hint of the
+    //! transient attachment pool are reused, and the attachments are only activated in the recorded order.
     //! 
     //!      == Platform-Specific Compilation ==
     //! 
@@ -219,6 +225,32 @@ namespace AZ::RHI
 
         void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+        //! Returns a hash of everything the transient attachment compilation depends on: the scopes and their edges, and the
+        //! transient attachments with their descriptors and scope lifetimes.
+        HashValue64 GetTransientAttachmentCompileHash(
+            const FrameGraph& frameGraph,
+            const TransientAttachmentPool& transientAttachmentPool,
+            FrameSchedulerCompileFlags compileFlags) const;
+
+        //! The transient attachment compilation results of the last frame, see GetTransientAttachmentCompileHash.
+        struct TransientAttachmentCompileCache
+        {
+            HashValue64 m_hash = HashValue64{ 0 };
+            bool m_isValid = false;
+
+            //! The first and last scope index of each transient buffer and image after their lifetimes were extended.
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_bufferScopeIntervals;
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_imageScopeIntervals;
+
+            //! The sorted activation and deactivation commands.
+            AZStd::vector<uint32_t> m_commands;
+
+            //! The memory the transient attachment pool needed, when it allocates using a memory hint.
+            bool m_hasMemoryUsage = false;
+            TransientAttachmentStatistics::MemoryUsage m_memoryUsage;
+        };
+        TransientAttachmentCompileCache m_transientAttachmentCompileCache;
+
         //! Remove the entry related to the provided ReverseLookupObjectType from the appropriate cache as it is probably stale now
         template<typename ReverseLookupObjectType, typename ObjectCacheType>
         void RemoveFromCache(ReverseLookupObjectType objectToRemove,
@@ -137,11 +137,29 @@ namespace AZ::RHI
         const PipelineState* AcquirePipelineState(
             PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name = AZ::Name());
 
+        //! Compiles the pipeline state ahead of time, so that a later call to AcquirePipelineState with the same descriptor hits
+        //! the cache. This behaves the same as AcquirePipelineState, but the compilation is counted as a precompile instead of
+        //! an on-demand compile. It's intended to be called from low priority jobs, for instance while a level is loading.
+        const PipelineState* PrecompilePipelineState(
+            PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name = AZ::Name());
+
         //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
         //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
         //! once per frame.
         void Compact();
 
+        //! The number of pipeline states that were compiled during a cycle, which ends with each call to Compact.
+        struct CompileStatistics
+        {
+            //! Pipeline states compiled by AcquirePipelineState. These stall the thread that needs the pipeline state.
+            uint32_t m_compiledOnDemandCount = 0;
+            //! Pipeline states compiled by PrecompilePipelineState.
+            uint32_t m_precompiledCount = 0;
+        };
+
+        //! Returns the number of pipeline states that were compiled during the last completed cycle, which is usually the last frame.
+        CompileStatistics GetLastCompileStatistics() const;
+
     private:
         PipelineStateCache(Device& device);
 
@@ -221,13 +239,18 @@ namespace AZ::RHI
         //! Helper function which inserts an entry into the set. Returns true if the entry was inserted, or false is a duplicate entry existed.
         static bool InsertPipelineState(PipelineStateSet& pipelineStateSet, PipelineStateEntry pipelineStateEntry);
 
+        //! Shared implementation of AcquirePipelineState and PrecompilePipelineState.
+        const PipelineState* AcquirePipelineStateInternal(
+            PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor, const AZ::Name& name, bool isPrecompile);
+
         //! Performs a pipeline state compilation on the global cache using the thread-local pipeline library.
         ConstPtr<PipelineState> CompilePipelineState(
             GlobalLibraryEntry& globalLibraryEntry,
             ThreadLibraryEntry& threadLibraryEntry,
             const PipelineStateDescriptor& pipelineStateDescriptor,
             PipelineStateHash pipelineStateHash,
-            const AZ::Name& name);
+            const AZ::Name& name,
+            bool isPrecompile);
 
         //! Resets the library without validating the handle or taking a lock.
         void ResetLibraryImpl(PipelineLibraryHandle handle);
@@ -251,6 +274,11 @@ namespace AZ::RHI
         /// to recycle slots in m_globalLibrarySet.
         AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
 
+        /// The number of compilations in the current cycle. These are moved to m_lastCompileStatistics in Compact.
+        AZStd::atomic_uint32_t m_compiledOnDemandCount = {0};
+        AZStd::atomic_uint32_t m_precompiledCount = {0};
+        CompileStatistics m_lastCompileStatistics;
+
         // Friends
         friend class UnitTest::PipelineStateTests;
     };
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/MemoryStatistics.h>
 #include <Atom/RHI.Reflect/ResourcePoolDescriptor.h>
 #include <Atom/RHI/DeviceObject.h>
 #include <Atom/RHI/FrameEventBus.h>
@@ -109,6 +110,10 @@ namespace AZ::RHI
         //! when memory statistics gathering is active.
         virtual void ComputeFragmentation() const = 0;
 
+        //! Adds the statistics that are specific to the type of pool. This method is invoked when memory statistics
+        //! gathering is active.
+        virtual void ReportPoolStatistics(MemoryStatistics::Pool& poolStatistics) const;
+
         //////////////////////////////////////////////////////////////////////////
 
         //////////////////////////////////////////////////////////////////////////
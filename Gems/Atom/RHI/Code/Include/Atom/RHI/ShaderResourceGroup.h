@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ::RHI
 {
@@ -72,6 +73,12 @@ namespace AZ::RHI
 
         //! Update the view hash within m_viewHash
         void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+        //! Returns the interval of constant bytes that need to be updated by the compile in progress. Platforms that
+        //! advance to the next of their RHI::Limits::Device::FrameCountMax copies of the constant data on every compile
+        //! can upload only this interval, as it covers every byte that was modified since that copy was last updated.
+        //! Only valid while the group is being compiled.
+        Interval GetConstantDataIntervalToCompile() const;
             
     protected:
         ShaderResourceGroup() = default;
@@ -79,6 +86,10 @@ namespace AZ::RHI
     private:
         void SetData(const ShaderResourceGroupData& data);
 
+        // Records the modified constant bytes of the compile that's about to start and computes the interval to compile.
+        // If compileAllConstants is true the interval covers all the constant data.
+        void UpdateConstantDataIntervalToCompile(bool compileAllConstants);
+
         ShaderResourceGroupData m_data;
 
         // The binding slot cached from the layout.
@@ -94,6 +105,14 @@ namespace AZ::RHI
         uint32_t m_resourceTypeIteration[static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count)] = { 0 };
         uint32_t m_updateMaskResetLatency = RHI::Limits::Device::FrameCountMax - 1; //we do -1 because we update after compile
 
+        // Interval of constant bytes that were modified since the last compile.
+        Interval m_pendingConstantInterval;
+
+        // Intervals of constant bytes that were modified for each of the last compiles, used as a ring buffer.
+        AZStd::array<Interval, RHI::Limits::Device::FrameCountMax> m_compiledConstantIntervals;
+        uint32_t m_compiledConstantIntervalIndex = 0;
+        Interval m_constantIntervalToCompile;
+
         // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
         AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
     };
@@ -221,7 +221,7 @@ namespace AZ::RHI
             AZStd::vector<ConstPtr<ResourceView>> m_bindlessResources;
         };
             
-        //! Reset the update mask
+        //! Reset the update mask and the interval of modified constant data
         void ResetUpdateMask();
 
         //! Enable compilation for a resourceType specified by resourceTypeMask
@@ -14,6 +14,7 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ::RHI
@@ -76,6 +77,9 @@ namespace AZ::RHI
         //! Returns whether groups in this pool have a sampler table.
         bool HasSamplerGroup() const;
 
+        //! Returns the compilations of the last frame. These are also reported with the memory statistics of the pool.
+        const MemoryStatistics::ShaderResourceGroupCompiles& GetLastFrameCompiles() const;
+
     protected:
         ShaderResourceGroupPool();
 
@@ -87,6 +91,12 @@ namespace AZ::RHI
         {
             // Fragmentation for SRG descriptors not currently measured
         }
+        void ReportPoolStatistics(MemoryStatistics::Pool& poolStatistics) const override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // FrameEventBus::Handler
+        void OnFrameEnd() override;
         //////////////////////////////////////////////////////////////////////////
 
     private:
@@ -154,5 +164,12 @@ namespace AZ::RHI
 
         AZStd::mutex m_invalidateRegistryMutex;
         ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+        // Compilations of the current frame. Groups are compiled from several jobs at once.
+        AZStd::atomic_uint32_t m_compiledGroupCount = { 0 };
+        AZStd::atomic_uint32_t m_skippedGroupCount = { 0 };
+        AZStd::atomic_size_t m_compiledConstantBytes = { 0 };
+        AZStd::atomic_size_t m_totalConstantBytes = { 0 };
+        MemoryStatistics::ShaderResourceGroupCompiles m_lastFrameCompiles;
     };
 }
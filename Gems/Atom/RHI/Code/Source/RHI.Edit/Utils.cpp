@@ -17,12 +17,15 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/Math/Sha1.h>
 #include <AzCore/Platform.h>
 #include <AzCore/std/time.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Utils/Utils.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -228,13 +231,9 @@ namespace AZ::RHI
         return combinedFile;
     }
 
-    bool ExecuteShaderCompiler(const AZStd::string& executablePath,
-                               const AZStd::string& parameters,
-                               const AZStd::string& shaderSourcePathForDebug,
-                               const AZStd::string& tempFolder,
-                               const char* toolNameForLog)
+    //! Resolves a path relative to the executable folder to an absolute path.
+    static bool GetExecutableAbsolutePath(const AZStd::string& executablePath, AZStd::string& executableAbsolutePath)
     {
-        AZStd::string executableAbsolutePath;
         if (AzFramework::StringFunc::Path::IsRelative(executablePath.c_str()))
         {
             static const char* executableFolder = nullptr;
@@ -254,6 +253,51 @@ namespace AZ::RHI
         {
             executableAbsolutePath = executablePath;
         }
+        return true;
+    }
+
+    //! Returns the hex encoded Sha1 of the executable's contents, or an empty string if it can't be read.
+    //! Each executable is only hashed once per process.
+    static AZStd::string GetExecutableDigest(const AZStd::string& executablePath)
+    {
+        static AZStd::mutex s_executableDigestsMutex;
+        static AZStd::unordered_map<AZStd::string, AZStd::string> s_executableDigests;
+
+        AZStd::lock_guard<AZStd::mutex> lock(s_executableDigestsMutex);
+        auto digestIt = s_executableDigests.find(executablePath);
+        if (digestIt != s_executableDigests.end())
+        {
+            return digestIt->second;
+        }
+
+        AZStd::string executableAbsolutePath;
+        AZStd::string executableDigest;
+        if (GetExecutableAbsolutePath(executablePath, executableAbsolutePath))
+        {
+            if (auto executableLoadResult = LoadFileBytes(executableAbsolutePath.c_str()))
+            {
+                AZ::Sha1 hasher;
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(executableLoadResult.GetValue().data()), executableLoadResult.GetValue().size());
+                ArrayOfCharForSha1 digest;
+                hasher.GetDigest(reinterpret_cast<AZ::Sha1::DigestType>(digest));
+                executableDigest = ByteToHexString(digest);
+            }
+        }
+        s_executableDigests.emplace(executablePath, executableDigest);
+        return executableDigest;
+    }
+
+    bool ExecuteShaderCompiler(const AZStd::string& executablePath,
+                               const AZStd::string& parameters,
+                               const AZStd::string& shaderSourcePathForDebug,
+                               const AZStd::string& tempFolder,
+                               const char* toolNameForLog)
+    {
+        AZStd::string executableAbsolutePath;
+        if (!GetExecutableAbsolutePath(executablePath, executableAbsolutePath))
+        {
+            return false;
+        }
 
         if (!AZ::IO::SystemFile::Exists(executableAbsolutePath.c_str()))
         {
@@ -383,6 +427,105 @@ namespace AZ::RHI
         return true;
     }
 
+    bool ExecuteShaderCompilerCached(const AZStd::string& executablePath,
+                                     const AZStd::string& parameters,
+                                     const AZStd::string& inputFile,
+                                     const AZStd::vector<AZStd::string>& outputFiles,
+                                     const AZStd::string& shaderSourcePathForDebug,
+                                     const AZStd::string& tempFolder,
+                                     const char* toolNameForLog)
+    {
+        static constexpr char ShaderCompilerCacheFolderKey[] = "/O3DE/Atom/ShaderCompilerCacheFolder";
+
+        AZStd::string cacheFolder;
+        if (auto setReg = AZ::Interface<SettingsRegistryInterface>::Get())
+        {
+            setReg->Get(cacheFolder, ShaderCompilerCacheFolderKey);
+        }
+
+        if (cacheFolder.empty())
+        {
+            return ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog);
+        }
+
+        // The compiler's own contents are part of the key so upgrading it invalidates outputs cached by the old version
+        const AZStd::string executableDigest = GetExecutableDigest(executablePath);
+        auto inputFileLoadResult = LoadFileBytes(inputFile.c_str());
+        if (executableDigest.empty() || !inputFileLoadResult)
+        {
+            return ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog);
+        }
+
+        // The same compilation in another job or on another machine only differs by the temp folder paths
+        AZStd::string cacheKeyParameters = parameters;
+        AzFramework::StringFunc::Replace(cacheKeyParameters, inputFile.c_str(), "<input>");
+        for (size_t outputIndex = 0; outputIndex < outputFiles.size(); ++outputIndex)
+        {
+            AzFramework::StringFunc::Replace(cacheKeyParameters, outputFiles[outputIndex].c_str(), AZStd::string::format("<output%zu>", outputIndex).c_str());
+        }
+
+        AZ::Sha1 hasher;
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(executableDigest.data()), executableDigest.size());
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(cacheKeyParameters.data()), cacheKeyParameters.size());
+        hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(inputFileLoadResult.GetValue().data()), inputFileLoadResult.GetValue().size());
+        ArrayOfCharForSha1 digest;
+        hasher.GetDigest(reinterpret_cast<AZ::Sha1::DigestType>(digest));
+        const AZStd::string cacheKey = ByteToHexString(digest);
+
+        auto GetCacheFilePath = [&cacheFolder, &cacheKey](size_t outputIndex)
+        {
+            AZStd::string cacheFilePath;
+            AzFramework::StringFunc::Path::ConstructFull(cacheFolder.c_str(), AZStd::string::format("%s.%zu", cacheKey.c_str(), outputIndex).c_str(), cacheFilePath, true);
+            return cacheFilePath;
+        };
+
+        // Copy the outputs from the cache when all of them are there
+        bool cacheHit = true;
+        for (size_t outputIndex = 0; outputIndex < outputFiles.size() && cacheHit; ++outputIndex)
+        {
+            auto cachedOutput = LoadFileBytes(GetCacheFilePath(outputIndex).c_str());
+            cacheHit = cachedOutput && AZ::Utils::WriteFile(
+                AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(cachedOutput.GetValue().data()), cachedOutput.GetValue().size()),
+                outputFiles[outputIndex]).IsSuccess();
+        }
+        if (cacheHit)
+        {
+            AZ_TracePrintf(ShaderPlatformInterfaceName, "%s outputs of '%s' found in the shader compiler cache (%s).", toolNameForLog, shaderSourcePathForDebug.c_str(), cacheKey.c_str());
+            return true;
+        }
+
+        if (!ExecuteShaderCompiler(executablePath, parameters, shaderSourcePathForDebug, tempFolder, toolNameForLog))
+        {
+            return false;
+        }
+
+        // Store the outputs, each file is written under a temporary name and renamed so other jobs never read a partial file.
+        // Failing to store the outputs isn't an error, the next build will compile the shader again.
+        AZ::IO::SystemFile::CreateDir(cacheFolder.c_str());
+        for (size_t outputIndex = 0; outputIndex < outputFiles.size(); ++outputIndex)
+        {
+            auto outputLoadResult = LoadFileBytes(outputFiles[outputIndex].c_str());
+            if (!outputLoadResult)
+            {
+                break;
+            }
+
+            const AZStd::string cacheFilePath = GetCacheFilePath(outputIndex);
+            const AZStd::string partialFilePath = AZStd::string::format("%s.%u.partial", cacheFilePath.c_str(), AZ::Platform::GetCurrentProcessId());
+            if (!AZ::Utils::WriteFile(
+                    AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(outputLoadResult.GetValue().data()), outputLoadResult.GetValue().size()),
+                    partialFilePath).IsSuccess() ||
+                !AZ::IO::SystemFile::Rename(partialFilePath.c_str(), cacheFilePath.c_str(), true))
+            {
+                AZ_Warning(ShaderPlatformInterfaceName, false, "Unable to store '%s' in the shader compiler cache.", outputFiles[outputIndex].c_str());
+                AZ::IO::SystemFile::Delete(partialFilePath.c_str());
+                break;
+            }
+        }
+
+        return true;
+    }
+
     bool ReportMessages([[maybe_unused]] AZStd::string_view window, AZStd::string_view errorMessages, bool reportAsErrors)
     {
         if (errorMessages.empty())
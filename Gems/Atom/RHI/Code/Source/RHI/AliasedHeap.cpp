@@ -13,24 +13,63 @@
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_transientAttachmentPlacementPlan, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Places the transient attachments of an aliased heap using a packing computed from previous frames once the attachments "
+        "are stable, instead of allocating them first-fit.");
+
+    namespace
+    {
+        // The number of frames in a row the attachments of a heap need to be the same before they are packed.
+        constexpr uint32_t PlacementPlanStableFrameCount = 3;
+
+        template<class Range>
+        size_t FindLowestFreeOffset(const AZStd::vector<Range>& rangesSortedByOffset, size_t sizeInBytes, size_t alignmentInBytes)
+        {
+            size_t offset = 0;
+            for (const Range& range : rangesSortedByOffset)
+            {
+                if (offset + sizeInBytes <= range.m_offsetMin)
+                {
+                    break;
+                }
+                offset = AZStd::max(offset, AlignUpNPOT(range.m_offsetEnd, alignmentInBytes));
+            }
+            return offset;
+        }
+
+        bool LifetimesOverlap(const TransientAttachmentStatistics::Attachment& lhs, const TransientAttachmentStatistics::Attachment& rhs)
+        {
+            // The attachments deactivated in a scope are released after the ones activated in the same scope have been
+            // allocated, so the lifetimes include both their first and last scope.
+            return lhs.m_scopeOffsetMin <= rhs.m_scopeOffsetMax && rhs.m_scopeOffsetMin <= lhs.m_scopeOffsetMax;
+        }
+    }
+
     void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
     {
         m_totalAllocations = 0;
         m_compileFlags = compileFlags;
         m_heapStats.m_watermarkSize = 0;
         m_heapStats.m_attachments.clear();
+        m_attachmentAlignments.clear();
+        m_usePlacementPlan = r_transientAttachmentPlacementPlan && !m_placementPlan.empty();
+        m_heapStats.m_usesPlacementPlan = m_usePlacementPlan;
         m_barrierTracker->Reset();
     }
 
     void AliasedHeap::End()
     {
-        AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0,
+        AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0 && m_activeRanges.empty(),
             "There are still active allocations.");
 
+        UpdatePlacementPlan();
+
         if (RHI::CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::GatherStatistics))
         {
             AZStd::sort(m_heapStats.m_attachments.begin(), m_heapStats.m_attachments.end(),
@@ -95,6 +134,11 @@ namespace AZ::RHI
         m_cache.Clear();
         m_reverseLookupHash.clear();
         m_firstFitAllocator.Shutdown();
+        m_placementPlan.clear();
+        m_placementPlanHash = HashValue64{ 0 };
+        m_lastFrameHash = HashValue64{ 0 };
+        m_stableFrameCount = 0;
+        m_activeRanges.clear();
     }
 
     void AliasedHeap::ComputeFragmentation() const
@@ -110,8 +154,7 @@ namespace AZ::RHI
     {
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
             
-        const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-        RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
+        RHI::VirtualAddress address = AllocateRange(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -169,16 +212,8 @@ namespace AZ::RHI
             }
         }
 
-        const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope });
-        m_heapStats.m_attachments.emplace_back();
-
-        RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
-        attachment.m_heapOffsetMin = heapOffsetInBytes;
-        attachment.m_heapOffsetMax = heapOffsetInBytes + memRequirements.m_sizeInBytes - 1;
-        attachment.m_sizeInBytes = memRequirements.m_sizeInBytes;
-        attachment.m_id = descriptor.m_attachmentId;
-        attachment.m_scopeOffsetMin = scope.GetIndex();
+        RHI::TransientAttachmentStatistics::Attachment& attachment =
+            AddAttachmentStatistics(descriptor.m_attachmentId, buffer, scope, heapOffsetInBytes, memRequirements);
         attachment.m_type = AliasedResourceType::Buffer;
 
         if (activatedBuffer)
@@ -222,9 +257,7 @@ namespace AZ::RHI
             m_barrierTracker->AddResource(aliasedResource);
         }
             
-        const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-        m_firstFitAllocator.DeAllocate(heapAddress);
-        m_firstFitAllocator.GarbageCollectForce();
+        DeAllocateRange(attachment.m_heapOffsetMin);
         m_activeAttachmentLookup.erase(findIter);
     }
 
@@ -232,7 +265,7 @@ namespace AZ::RHI
     {
         ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-        VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
+        VirtualAddress address = AllocateRange(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
         if (address.IsNull())
         {
             return ResultCode::OutOfMemory;
@@ -291,18 +324,8 @@ namespace AZ::RHI
             }
         }
 
-        const size_t sizeInBytes = memRequirements.m_sizeInBytes;
-
-        const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-        m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope });
-        m_heapStats.m_attachments.emplace_back();
-
-        RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
-        attachment.m_heapOffsetMin = heapOffsetInBytes;
-        attachment.m_heapOffsetMax = heapOffsetInBytes + sizeInBytes - 1;
-        attachment.m_sizeInBytes = sizeInBytes;
-        attachment.m_id = descriptor.m_attachmentId;
-        attachment.m_scopeOffsetMin = scope.GetIndex();
+        RHI::TransientAttachmentStatistics::Attachment& attachment =
+            AddAttachmentStatistics(descriptor.m_attachmentId, image, scope, heapOffsetInBytes, memRequirements);
         attachment.m_type = CheckBitsAny(descriptor.m_imageDescriptor.m_bindFlags, ImageBindFlags::Color | ImageBindFlags::DepthStencil) ?
             AliasedResourceType::RenderTarget : AliasedResourceType::Image;
 
@@ -330,6 +353,215 @@ namespace AZ::RHI
         }
     }
 
+    VirtualAddress AliasedHeap::AllocateRange(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes)
+    {
+        if (!m_usePlacementPlan)
+        {
+            return m_firstFitAllocator.Allocate(sizeInBytes, alignmentInBytes);
+        }
+
+        alignmentInBytes = AZStd::max(alignmentInBytes, m_descriptor.m_alignment);
+        const auto findRangeAfter = [this](size_t offset)
+        {
+            return AZStd::lower_bound(m_activeRanges.begin(), m_activeRanges.end(), offset,
+                [](const HeapRange& range, size_t rangeOffset) { return range.m_offsetMin < rangeOffset; });
+        };
+
+        // Use the planned offset, unless the attachment changed since the plan was made, or an attachment that wasn't
+        // part of the plan was placed where it overlaps.
+        size_t heapOffset = 0;
+        bool isPlaced = false;
+        auto planIter = m_placementPlan.find(attachmentId);
+        if (planIter != m_placementPlan.end() && planIter->second.m_sizeInBytes == sizeInBytes &&
+            planIter->second.m_heapOffset % alignmentInBytes == 0)
+        {
+            heapOffset = planIter->second.m_heapOffset;
+            const auto rangeIter = findRangeAfter(heapOffset);
+            const bool overlapsNext = rangeIter != m_activeRanges.end() && rangeIter->m_offsetMin < heapOffset + sizeInBytes;
+            const bool overlapsPrevious = rangeIter != m_activeRanges.begin() && (rangeIter - 1)->m_offsetEnd > heapOffset;
+            isPlaced = !overlapsNext && !overlapsPrevious;
+        }
+
+        if (!isPlaced)
+        {
+            heapOffset = FindLowestFreeOffset(m_activeRanges, sizeInBytes, alignmentInBytes);
+        }
+
+        if (heapOffset + sizeInBytes > m_descriptor.m_budgetInBytes)
+        {
+            return VirtualAddress::CreateNull();
+        }
+
+        m_activeRanges.insert(findRangeAfter(heapOffset), HeapRange{ heapOffset, heapOffset + sizeInBytes });
+        return VirtualAddress::CreateFromOffset(heapOffset);
+    }
+
+    void AliasedHeap::DeAllocateRange(size_t heapOffset)
+    {
+        if (!m_usePlacementPlan)
+        {
+            m_firstFitAllocator.DeAllocate(VirtualAddress{ heapOffset });
+            m_firstFitAllocator.GarbageCollectForce();
+            return;
+        }
+
+        auto rangeIter = AZStd::lower_bound(m_activeRanges.begin(), m_activeRanges.end(), heapOffset,
+            [](const HeapRange& range, size_t offset) { return range.m_offsetMin < offset; });
+        AZ_Assert(rangeIter != m_activeRanges.end() && rangeIter->m_offsetMin == heapOffset, "Failed to find the heap range at offset %zu", heapOffset);
+        if (rangeIter != m_activeRanges.end() && rangeIter->m_offsetMin == heapOffset)
+        {
+            m_activeRanges.erase(rangeIter);
+        }
+    }
+
+    TransientAttachmentStatistics::Attachment& AliasedHeap::AddAttachmentStatistics(
+        const AttachmentId& attachmentId, Resource* resource, Scope& scope, size_t heapOffset, const ResourceMemoryRequirements& memRequirements)
+    {
+        const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
+        m_activeAttachmentLookup.emplace(attachmentId, AttachmentData{ resource, attachmentIndex, &scope });
+        m_heapStats.m_attachments.emplace_back();
+        m_attachmentAlignments.push_back(AZStd::max(static_cast<size_t>(memRequirements.m_alignmentInBytes), m_descriptor.m_alignment));
+
+        TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
+        attachment.m_heapOffsetMin = heapOffset;
+        attachment.m_heapOffsetMax = heapOffset + memRequirements.m_sizeInBytes - 1;
+        attachment.m_sizeInBytes = memRequirements.m_sizeInBytes;
+        attachment.m_id = attachmentId;
+        attachment.m_scopeOffsetMin = scope.GetIndex();
+        return attachment;
+    }
+
+    void AliasedHeap::UpdatePlacementPlan()
+    {
+        const AZStd::vector<TransientAttachmentStatistics::Attachment>& attachments = m_heapStats.m_attachments;
+        const uint32_t attachmentCount = aznumeric_cast<uint32_t>(attachments.size());
+
+        // The peak live size is the lower bound of the memory any placement needs. Attachments released after a scope
+        // are removed before the ones activated in the next scope are added.
+        AZStd::vector<AZStd::pair<size_t, int64_t>> liveSizeChanges;
+        liveSizeChanges.reserve(attachmentCount * 2);
+        for (const TransientAttachmentStatistics::Attachment& attachment : attachments)
+        {
+            liveSizeChanges.emplace_back(attachment.m_scopeOffsetMin, static_cast<int64_t>(attachment.m_sizeInBytes));
+            liveSizeChanges.emplace_back(attachment.m_scopeOffsetMax + 1, -static_cast<int64_t>(attachment.m_sizeInBytes));
+        }
+        AZStd::sort(liveSizeChanges.begin(), liveSizeChanges.end());
+        int64_t liveSize = 0;
+        int64_t peakLiveSize = 0;
+        for (const auto& liveSizeChange : liveSizeChanges)
+        {
+            liveSize += liveSizeChange.second;
+            peakLiveSize = AZStd::max(peakLiveSize, liveSize);
+        }
+        m_heapStats.m_peakLiveSize = static_cast<size_t>(peakLiveSize);
+
+        HashValue64 frameHash = TypeHash64(m_descriptor.m_budgetInBytes, HashValue64{ 0 });
+        for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex)
+        {
+            const TransientAttachmentStatistics::Attachment& attachment = attachments[attachmentIndex];
+            frameHash = TypeHash64(attachment.m_id.GetHash(), frameHash);
+            frameHash = TypeHash64(attachment.m_sizeInBytes, frameHash);
+            frameHash = TypeHash64(m_attachmentAlignments[attachmentIndex], frameHash);
+            frameHash = TypeHash64(attachment.m_scopeOffsetMin, frameHash);
+            frameHash = TypeHash64(attachment.m_scopeOffsetMax, frameHash);
+        }
+
+        m_stableFrameCount = frameHash == m_lastFrameHash ? AZStd::min(m_stableFrameCount + 1, PlacementPlanStableFrameCount) : 0;
+        m_lastFrameHash = frameHash;
+
+        if (!r_transientAttachmentPlacementPlan)
+        {
+            m_placementPlan.clear();
+            m_placementPlanHash = HashValue64{ 0 };
+            return;
+        }
+
+        if (frameHash == m_placementPlanHash)
+        {
+            return;
+        }
+
+        // The attachments changed, so the plan no longer applies to them.
+        m_placementPlan.clear();
+        m_placementPlanHash = HashValue64{ 0 };
+        if (m_stableFrameCount < PlacementPlanStableFrameCount || attachmentCount == 0)
+        {
+            return;
+        }
+
+        m_placementPlanHash = frameHash;
+        if (m_heapStats.m_watermarkSize <= m_heapStats.m_peakLiveSize && !m_usePlacementPlan)
+        {
+            // First-fit is already optimal.
+            return;
+        }
+
+        // Pack the attachments largest first. Each attachment goes to the lowest offset that doesn't overlap any of the
+        // already placed attachments whose lifetime overlaps its own.
+        AZStd::vector<uint32_t> placementOrder(attachmentCount);
+        for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex)
+        {
+            placementOrder[attachmentIndex] = attachmentIndex;
+        }
+        AZStd::sort(placementOrder.begin(), placementOrder.end(), [&attachments](uint32_t lhs, uint32_t rhs)
+        {
+            const TransientAttachmentStatistics::Attachment& lhsAttachment = attachments[lhs];
+            const TransientAttachmentStatistics::Attachment& rhsAttachment = attachments[rhs];
+            if (lhsAttachment.m_sizeInBytes != rhsAttachment.m_sizeInBytes)
+            {
+                return lhsAttachment.m_sizeInBytes > rhsAttachment.m_sizeInBytes;
+            }
+            const size_t lhsLifetime = lhsAttachment.m_scopeOffsetMax - lhsAttachment.m_scopeOffsetMin;
+            const size_t rhsLifetime = rhsAttachment.m_scopeOffsetMax - rhsAttachment.m_scopeOffsetMin;
+            if (lhsLifetime != rhsLifetime)
+            {
+                return lhsLifetime > rhsLifetime;
+            }
+            return lhs < rhs;
+        });
+
+        AZStd::vector<size_t> plannedOffsets(attachmentCount, 0);
+        AZStd::vector<HeapRange> overlappingRanges;
+        size_t plannedSize = 0;
+        for (uint32_t placedCount = 0; placedCount < attachmentCount; ++placedCount)
+        {
+            const uint32_t attachmentIndex = placementOrder[placedCount];
+            const TransientAttachmentStatistics::Attachment& attachment = attachments[attachmentIndex];
+
+            overlappingRanges.clear();
+            for (uint32_t placedIndex = 0; placedIndex < placedCount; ++placedIndex)
+            {
+                const uint32_t otherIndex = placementOrder[placedIndex];
+                if (LifetimesOverlap(attachment, attachments[otherIndex]))
+                {
+                    overlappingRanges.push_back({ plannedOffsets[otherIndex], plannedOffsets[otherIndex] + attachments[otherIndex].m_sizeInBytes });
+                }
+            }
+            AZStd::sort(overlappingRanges.begin(), overlappingRanges.end(), [](const HeapRange& lhs, const HeapRange& rhs)
+            {
+                return lhs.m_offsetMin < rhs.m_offsetMin;
+            });
+
+            plannedOffsets[attachmentIndex] = FindLowestFreeOffset(overlappingRanges, attachment.m_sizeInBytes, m_attachmentAlignments[attachmentIndex]);
+            plannedSize = AZStd::max(plannedSize, plannedOffsets[attachmentIndex] + attachment.m_sizeInBytes);
+        }
+
+        // Only use the plan if it's better than how the attachments were placed this frame.
+        if (plannedSize >= m_heapStats.m_watermarkSize || plannedSize > m_descriptor.m_budgetInBytes)
+        {
+            return;
+        }
+
+        for (uint32_t attachmentIndex = 0; attachmentIndex < attachmentCount; ++attachmentIndex)
+        {
+            const TransientAttachmentStatistics::Attachment& attachment = attachments[attachmentIndex];
+            if (!attachment.m_id.IsEmpty())
+            {
+                m_placementPlan.emplace(attachment.m_id, PlannedPlacement{ plannedOffsets[attachmentIndex], attachment.m_sizeInBytes });
+            }
+        }
+    }
+
     const AliasedHeapDescriptor& AliasedHeap::GetDescriptor() const
     {
         return m_descriptor;
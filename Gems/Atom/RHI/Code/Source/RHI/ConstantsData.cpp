@@ -17,6 +17,7 @@ namespace AZ::RHI
         if (m_layout->GetDataSize() > 0)
         {
             m_constantData.resize(m_layout->GetDataSize());
+            m_dirtyInterval = Interval(0, m_layout->GetDataSize());
         }
     }
 
@@ -103,6 +104,7 @@ namespace AZ::RHI
         {
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             memcpy(&m_constantData[interval.m_min + byteOffset], bytes, byteCount);
+            MarkDirty(interval.m_min + byteOffset, byteCount);
             return true;
         }
         return false;
@@ -113,6 +115,7 @@ namespace AZ::RHI
         if (ValidateConstantBufferAccess(0, byteCount))
         {
             memcpy(m_constantData.data(), bytes, byteCount);
+            MarkDirty(0, byteCount);
             return true;
         }
         return false;
@@ -123,6 +126,7 @@ namespace AZ::RHI
         if (ValidateConstantBufferAccess(byteOffset, byteCount))
         {
             memcpy(&m_constantData[byteOffset], bytes, byteCount);
+            MarkDirty(byteOffset, byteCount);
             return true;
         }
         return false;
@@ -187,6 +191,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             transform.StoreToRowMajorFloat12(matrixValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -203,6 +208,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToRowMajorFloat12(matrixValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -219,6 +225,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToRowMajorFloat16(matrixValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
 
@@ -235,6 +242,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat2(vectorValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -251,6 +259,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat3(vectorValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -266,6 +275,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat4(vectorValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -281,6 +291,7 @@ namespace AZ::RHI
             const Interval interval = GetLayout()->GetInterval(inputIndex);
             float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
             value.StoreToFloat4(vectorValue);
+            MarkDirty(interval.m_min, interval.m_max - interval.m_min);
 
             return true;
         }
@@ -496,4 +507,34 @@ namespace AZ::RHI
 
         return differingIndices;
     }
+
+    Interval ConstantsData::GetDirtyInterval() const
+    {
+        return m_dirtyInterval;
+    }
+
+    void ConstantsData::ResetDirtyInterval()
+    {
+        m_dirtyInterval = Interval();
+    }
+
+    void ConstantsData::MarkDirty(size_t byteOffset, size_t byteCount)
+    {
+        if (byteCount == 0)
+        {
+            return;
+        }
+
+        const uint32_t byteMin = aznumeric_cast<uint32_t>(byteOffset);
+        const uint32_t byteMax = aznumeric_cast<uint32_t>(byteOffset + byteCount);
+        if (m_dirtyInterval.m_min == m_dirtyInterval.m_max)
+        {
+            m_dirtyInterval = Interval(byteMin, byteMax);
+        }
+        else
+        {
+            m_dirtyInterval.m_min = AZStd::min(m_dirtyInterval.m_min, byteMin);
+            m_dirtyInterval.m_max = AZStd::max(m_dirtyInterval.m_max, byteMax);
+        }
+    }
 }
@@ -7,6 +7,8 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
@@ -24,8 +26,119 @@ namespace AZ::RHI
         return DrawListView(&drawList[itemOffset], itemCount);
     }
 
+    namespace
+    {
+        // Lists shorter than this are sorted with a comparison sort, since the radix sort has a fixed cost per pass
+        constexpr size_t RadixSortMinItemCount = 256;
+
+        constexpr uint32_t RadixBits = 8;
+        constexpr uint32_t RadixBucketCount = 1u << RadixBits;
+        constexpr uint32_t RadixKeyWordCount = 3;
+        constexpr uint32_t RadixPassCount = RadixKeyWordCount * 64 / RadixBits;
+
+        struct RadixSortEntry
+        {
+            // Least significant word first, so the passes run from m_key[0] to m_key[RadixKeyWordCount - 1]
+            uint64_t m_key[RadixKeyWordCount];
+            uint32_t m_index;
+        };
+
+        //! Maps the sort key so that its unsigned order matches its signed order
+        uint64_t GetRadixKey(DrawItemSortKey sortKey)
+        {
+            return static_cast<uint64_t>(sortKey) ^ (uint64_t(1) << 63);
+        }
+
+        //! Maps the depth so that its unsigned order matches its floating point order
+        uint64_t GetRadixKey(float depth, bool reverse)
+        {
+            // Adding zero turns -0 into +0, the comparison sort treats them as equal
+            const float normalizedDepth = depth + 0.0f;
+            uint32_t bits;
+            memcpy(&bits, &normalizedDepth, sizeof(bits));
+            bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            return reverse ? ~bits : bits;
+        }
+
+        //! Sorts by the packed keys of the items with a least significant digit radix sort. Digits that are the same for all
+        //! items are skipped, which is common for the upper bits of the sort key and the depth.
+        void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            const uint32_t itemCount = aznumeric_cast<uint32_t>(drawList.size());
+            AZStd::vector<RadixSortEntry> entries(itemCount);
+            AZStd::vector<RadixSortEntry> scratch(itemCount);
+            AZStd::vector<uint32_t> histograms(RadixPassCount * RadixBucketCount, 0);
+
+            const bool depthFirst = sortType == DrawListSortType::DepthThenKey || sortType == DrawListSortType::ReverseDepthThenKey;
+            const bool reverseDepth = sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey;
+            for (uint32_t itemIndex = 0; itemIndex < itemCount; ++itemIndex)
+            {
+                const DrawItemProperties& item = drawList[itemIndex];
+                const uint64_t sortKey = GetRadixKey(item.m_sortKey);
+                const uint64_t depthKey = GetRadixKey(item.m_depth, reverseDepth);
+
+                // The draw item pointer is the final tie breaker, matching the comparison sort
+                RadixSortEntry& entry = entries[itemIndex];
+                entry.m_key[0] = reinterpret_cast<uintptr_t>(item.m_item);
+                entry.m_key[1] = depthFirst ? sortKey : depthKey;
+                entry.m_key[2] = depthFirst ? depthKey : sortKey;
+                entry.m_index = itemIndex;
+
+                for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+                {
+                    const uint32_t digit = (entry.m_key[pass * RadixBits / 64] >> (pass * RadixBits % 64)) & (RadixBucketCount - 1);
+                    ++histograms[pass * RadixBucketCount + digit];
+                }
+            }
+
+            for (uint32_t pass = 0; pass < RadixPassCount; ++pass)
+            {
+                uint32_t* histogram = &histograms[pass * RadixBucketCount];
+                const uint32_t word = pass * RadixBits / 64;
+                const uint32_t shift = pass * RadixBits % 64;
+
+                // Every item has the same digit, so this pass wouldn't change the order
+                const uint32_t firstDigit = (entries[0].m_key[word] >> shift) & (RadixBucketCount - 1);
+                if (histogram[firstDigit] == itemCount)
+                {
+                    continue;
+                }
+
+                uint32_t offset = 0;
+                for (uint32_t bucket = 0; bucket < RadixBucketCount; ++bucket)
+                {
+                    const uint32_t count = histogram[bucket];
+                    histogram[bucket] = offset;
+                    offset += count;
+                }
+
+                for (const RadixSortEntry& entry : entries)
+                {
+                    const uint32_t digit = (entry.m_key[word] >> shift) & (RadixBucketCount - 1);
+                    scratch[histogram[digit]++] = entry;
+                }
+                entries.swap(scratch);
+            }
+
+            DrawList sortedList;
+            sortedList.reserve(itemCount);
+            for (const RadixSortEntry& entry : entries)
+            {
+                sortedList.push_back(drawList[entry.m_index]);
+            }
+            // Copy back instead of swapping, so the draw list keeps its capacity for the next frame
+            drawList.assign(sortedList.begin(), sortedList.end());
+        }
+    }
+
     void SortDrawList(DrawList& drawList, DrawListSortType sortType)
     {
+        if (drawList.size() >= RadixSortMinItemCount)
+        {
+            RadixSortDrawList(drawList, sortType);
+            return;
+        }
+
         switch (sortType)
         {
         case DrawListSortType::KeyThenDepth:
@@ -95,6 +95,18 @@ namespace AZ::RHI
     void DrawListContext::FinalizeLists()
     {
         AZ_PROFILE_SCOPE(RHI, "DrawListContext: FinalizeLists");
+        const DrawListMask pendingMask = BeginFinalizeLists();
+        for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
+        {
+            if (pendingMask[i])
+            {
+                FinalizeList(DrawListTag(i));
+            }
+        }
+    }
+
+    DrawListMask DrawListContext::BeginFinalizeLists()
+    {
         for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
         {
             if (m_drawListMask[i])
@@ -103,20 +115,39 @@ namespace AZ::RHI
             }
         }
 
-        m_threadListsByTag.ForEach([this](DrawListsByTag& drawListsByTag)
+        DrawListMask pendingMask;
+        m_threadListsByTag.ForEach([this, &pendingMask](DrawListsByTag& drawListsByTag)
         {
             for (size_t i = 0; i < drawListsByTag.size(); ++i)
             {
-                if (m_drawListMask[i])
+                if (m_drawListMask[i] && !drawListsByTag[i].empty())
                 {
-                    auto& sourceList = drawListsByTag[i];
-                    auto& resultList = m_mergedListsByTag[i];
-
-                    resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
-                    sourceList.clear();
+                    pendingMask.set(i);
                 }
             }
         });
+        return pendingMask;
+    }
+
+    void DrawListContext::FinalizeList(DrawListTag drawListTag)
+    {
+        const size_t tagIndex = drawListTag.GetIndex();
+        auto& resultList = m_mergedListsByTag[tagIndex];
+
+        // Each thread only touches its own tag, the thread lists are only read under the shared lock of ForEach
+        size_t itemCount = 0;
+        m_threadListsByTag.ForEach([tagIndex, &itemCount](DrawListsByTag& drawListsByTag)
+        {
+            itemCount += drawListsByTag[tagIndex].size();
+        });
+        resultList.reserve(itemCount);
+
+        m_threadListsByTag.ForEach([tagIndex, &resultList](DrawListsByTag& drawListsByTag)
+        {
+            auto& sourceList = drawListsByTag[tagIndex];
+            resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
+            sourceList.clear();
+        });
     }
 
     DrawListView DrawListContext::GetList(DrawListTag drawListTag) const
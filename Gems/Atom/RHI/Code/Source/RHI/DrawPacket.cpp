@@ -100,4 +100,15 @@ namespace AZ::RHI
             drawItem->m_arguments.m_indexed.m_instanceCount = instanceCount;
         }
     }
+
+    void DrawPacket::SetDrawArguments(const DrawArguments& drawArguments)
+    {
+        for (size_t drawItemIndex = 0; drawItemIndex < m_drawItemCount; ++drawItemIndex)
+        {
+            const DrawItem* drawItemConst = m_drawItems + drawItemIndex;
+            // Need to mutate for GPU driven mesh instancing, which replaces the direct draw with an indirect one.
+            DrawItem* drawItem = const_cast<DrawItem*>(drawItemConst);
+            drawItem->m_arguments = drawArguments;
+        }
+    }
 }
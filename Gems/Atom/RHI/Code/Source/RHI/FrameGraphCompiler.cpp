@@ -17,12 +17,17 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_frameGraphCompileCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reuse the transient attachment lifetimes, activation order and memory hint of the previous frame while the frame graph is unchanged.");
+
     ResultCode FrameGraphCompiler::Init(Device& device)
     {
         if (Validation::IsEnabled())
@@ -60,6 +65,7 @@ namespace AZ::RHI
             m_bufferViewCache.Clear();
             m_imageReverseLookupHash.clear();
             m_bufferReverseLookupHash.clear();
+            m_transientAttachmentCompileCache = {};
                
             ShutdownInternal();
             DeviceObject::Shutdown();
@@ -465,7 +471,62 @@ namespace AZ::RHI
 
         AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-        ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+        const auto& scopes = frameGraph.GetScopes();
+        const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
+        const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
+
+        TransientAttachmentCompileCache& cache = m_transientAttachmentCompileCache;
+        const HashValue64 compileHash = r_frameGraphCompileCache
+            ? GetTransientAttachmentCompileHash(frameGraph, transientAttachmentPool, compileFlags)
+            : HashValue64{ 0 };
+        const bool isCached = r_frameGraphCompileCache && cache.m_isValid && cache.m_hash == compileHash;
+        const uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+
+        if (isCached)
+        {
+            // The graph is unchanged, so the lifetimes extend exactly like they did last frame
+            const auto applyScopeIntervals = [&scopes, InvalidScopeIndex](FrameAttachment& attachment, AZStd::pair<uint32_t, uint32_t> interval)
+            {
+                if (interval.first != InvalidScopeIndex)
+                {
+                    attachment.m_firstScope = scopes[interval.first];
+                    attachment.m_lastScope = scopes[interval.second];
+                }
+            };
+            for (size_t attachmentIndex = 0; attachmentIndex < transientBufferGraphAttachments.size(); ++attachmentIndex)
+            {
+                applyScopeIntervals(*transientBufferGraphAttachments[attachmentIndex], cache.m_bufferScopeIntervals[attachmentIndex]);
+            }
+            for (size_t attachmentIndex = 0; attachmentIndex < transientImageGraphAttachments.size(); ++attachmentIndex)
+            {
+                applyScopeIntervals(*transientImageGraphAttachments[attachmentIndex], cache.m_imageScopeIntervals[attachmentIndex]);
+            }
+        }
+        else
+        {
+            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+
+            cache = {};
+            if (r_frameGraphCompileCache)
+            {
+                const auto getScopeInterval = [InvalidScopeIndex](const FrameAttachment& attachment)
+                {
+                    return attachment.GetFirstScope() && attachment.GetLastScope()
+                        ? AZStd::make_pair(attachment.GetFirstScope()->GetIndex(), attachment.GetLastScope()->GetIndex())
+                        : AZStd::make_pair(InvalidScopeIndex, InvalidScopeIndex);
+                };
+                cache.m_bufferScopeIntervals.reserve(transientBufferGraphAttachments.size());
+                for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+                {
+                    cache.m_bufferScopeIntervals.push_back(getScopeInterval(*transientBuffer));
+                }
+                cache.m_imageScopeIntervals.reserve(transientImageGraphAttachments.size());
+                for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                {
+                    cache.m_imageScopeIntervals.push_back(getScopeInterval(*transientImage));
+                }
+            }
+        }
 
         // Builds a sortable key. It iterates each scope and performs deactivations
         // followed by activations on each attachment.
@@ -482,6 +543,11 @@ namespace AZ::RHI
 
         struct Command
         {
+            explicit Command(uint32_t command)
+                : m_command(command)
+            {
+            }
+
             Command(uint32_t scopeIndex, Action action, uint32_t attachmentIndex)
             {
                 m_bits.m_scopeIndex = scopeIndex;
@@ -514,10 +580,6 @@ namespace AZ::RHI
             };
         };
 
-        const auto& scopes = frameGraph.GetScopes();
-        const auto& transientBufferGraphAttachments = attachmentDatabase.GetTransientBufferAttachments();
-        const auto& transientImageGraphAttachments = attachmentDatabase.GetTransientImageAttachments();
-
         AZ_Assert(scopes.size() < AZ_BIT(SCOPE_BIT_COUNT),
             "Exceeded maximum number of allowed scopes");
 
@@ -529,7 +591,14 @@ namespace AZ::RHI
         AZStd::vector<Command> commands;
         commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-        if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+        if (isCached)
+        {
+            for (uint32_t command : cache.m_commands)
+            {
+                commands.emplace_back(command);
+            }
+        }
+        else if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
         {
             const uint32_t ScopeIndexFirst = 0;
             const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
@@ -589,7 +658,21 @@ namespace AZ::RHI
             }
         }
 
-        AZStd::sort(commands.begin(), commands.end());
+        if (!isCached)
+        {
+            AZStd::sort(commands.begin(), commands.end());
+
+            if (r_frameGraphCompileCache)
+            {
+                cache.m_commands.reserve(commands.size());
+                for (Command command : commands)
+                {
+                    cache.m_commands.push_back(command.m_command);
+                }
+                cache.m_hash = compileHash;
+                cache.m_isValid = true;
+            }
+        }
 
         auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
         {
@@ -698,9 +781,23 @@ namespace AZ::RHI
         // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
         if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
         {
-            // First pass to calculate size needed.
-            processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-            memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+            if (isCached && cache.m_hasMemoryUsage)
+            {
+                // The same attachments are activated in the same order, so they need the same amount of memory
+                memoryUsage = cache.m_memoryUsage;
+            }
+            else
+            {
+                // First pass to calculate size needed.
+                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+
+                if (cache.m_isValid)
+                {
+                    cache.m_memoryUsage = memoryUsage.value();
+                    cache.m_hasMemoryUsage = true;
+                }
+            }
         }
 
         // Second pass uses the information about memory usage
@@ -711,7 +808,56 @@ namespace AZ::RHI
         }
         processCommands(poolCompileFlags, memoryUsage ? &memoryUsage.value() : nullptr);
     }
-                    
+
+    HashValue64 FrameGraphCompiler::GetTransientAttachmentCompileHash(
+        const FrameGraph& frameGraph,
+        const TransientAttachmentPool& transientAttachmentPool,
+        FrameSchedulerCompileFlags compileFlags) const
+    {
+        AZ_PROFILE_FUNCTION(RHI);
+
+        HashValue64 hash = TypeHash64(compileFlags);
+        hash = TypeHash64(&transientAttachmentPool, hash);
+        hash = TypeHash64(transientAttachmentPool.GetDescriptor().m_heapParameters.m_type, hash);
+
+        // The queue-centric scope graph and the async intervals only depend on the scopes, their queues and their edges
+        for (const Scope* scope : frameGraph.GetScopes())
+        {
+            hash = TypeHash64(scope->GetId().GetHash(), hash);
+            hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+            hash = TypeHash64(static_cast<uint32_t>(scope->GetTransientAttachments().size()), hash);
+            for (const Scope* consumer : frameGraph.GetConsumers(*scope))
+            {
+                hash = TypeHash64(consumer->GetIndex(), hash);
+            }
+        }
+
+        const uint32_t InvalidScopeIndex = static_cast<uint32_t>(-1);
+        const auto hashAttachment = [&hash, InvalidScopeIndex](const FrameAttachment& attachment)
+        {
+            hash = TypeHash64(attachment.GetId().GetHash(), hash);
+            hash = TypeHash64(attachment.GetSupportedQueueMask(), hash);
+            hash = TypeHash64(attachment.GetFirstScope() ? attachment.GetFirstScope()->GetIndex() : InvalidScopeIndex, hash);
+            hash = TypeHash64(attachment.GetLastScope() ? attachment.GetLastScope()->GetIndex() : InvalidScopeIndex, hash);
+        };
+
+        const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+        hash = TypeHash64(static_cast<uint32_t>(attachmentDatabase.GetTransientBufferAttachments().size()), hash);
+        for (const BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+        {
+            hashAttachment(*transientBuffer);
+            hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+        }
+
+        hash = TypeHash64(static_cast<uint32_t>(attachmentDatabase.GetTransientImageAttachments().size()), hash);
+        for (const ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+        {
+            hashAttachment(*transientImage);
+            hash = transientImage->GetImageDescriptor().GetHash(hash);
+        }
+        return hash;
+    }
+
     ImageView* FrameGraphCompiler::GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor)
     {
         const size_t baseHash = AZStd::hash<Image*>()(image);
@@ -281,6 +281,13 @@ namespace AZ::RHI
                 {
                     srgPool->CompileGroupsBegin();
                     const uint32_t compilesInPool = srgPool->GetGroupsToCompileCount();
+                    if (compilesInPool == 0)
+                    {
+                        // Most pools have nothing queued, don't add tasks for them.
+                        srgPool->CompileGroupsEnd();
+                        return;
+                    }
+
                     const uint32_t jobCount = AZ::DivideAndRoundUp(compilesInPool, compilesPerJob);
                     AZ::TaskDescriptor srgCompileDesc{"SrgCompile", "Graphics"};
                     AZ::TaskDescriptor srgCompileEndDesc{"SrgCompileEnd", "Graphics"};
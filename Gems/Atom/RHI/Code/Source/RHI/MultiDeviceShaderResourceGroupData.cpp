@@ -433,6 +433,7 @@ namespace AZ::RHI
     void MultiDeviceShaderResourceGroupData::ResetUpdateMask()
     {
         m_updateMask = 0;
+        m_constantsData.ResetDirtyInterval();
 
         for (auto& [deviceIndex, deviceShaderResourceGroupData] : m_deviceShaderResourceGroupDatas)
         {
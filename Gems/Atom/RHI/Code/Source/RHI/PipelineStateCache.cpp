@@ -9,10 +9,20 @@
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/Factory.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
+AZ_CVAR(
+    bool,
+    r_pipelineStateReportOnDemandCompiles,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Prints the number of pipeline states that were compiled on demand each frame. These compilations can cause hitches and "
+    "are candidates for prewarming.");
+
 namespace AZ::RHI
 {
     Ptr<PipelineStateCache> PipelineStateCache::Create(Device& device)
@@ -260,9 +270,24 @@ namespace AZ::RHI
             });
         }
 
+        m_lastCompileStatistics.m_compiledOnDemandCount = m_compiledOnDemandCount.exchange(0);
+        m_lastCompileStatistics.m_precompiledCount = m_precompiledCount.exchange(0);
+        if (r_pipelineStateReportOnDemandCompiles && m_lastCompileStatistics.m_compiledOnDemandCount > 0)
+        {
+            AZ_TracePrintf(
+                "PipelineStateCache", "%u pipeline states were compiled on demand and %u were precompiled during the last frame.\n",
+                m_lastCompileStatistics.m_compiledOnDemandCount, m_lastCompileStatistics.m_precompiledCount);
+        }
+
         ValidateCacheIntegrity();
     }
 
+    PipelineStateCache::CompileStatistics PipelineStateCache::GetLastCompileStatistics() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_lastCompileStatistics;
+    }
+
     const PipelineState* PipelineStateCache::FindPipelineState(const PipelineStateSet& pipelineStateSet, const PipelineStateDescriptor& descriptor)
     {
         auto pipelineStateIt = pipelineStateSet.find(PipelineStateEntry(descriptor.GetHash(), nullptr, descriptor));
@@ -281,6 +306,18 @@ namespace AZ::RHI
 
     const PipelineState* PipelineStateCache::AcquirePipelineState(
         PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, const AZ::Name& name /*= AZ::Name()*/)
+    {
+        return AcquirePipelineStateInternal(handle, descriptor, name, false);
+    }
+
+    const PipelineState* PipelineStateCache::PrecompilePipelineState(
+        PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, const AZ::Name& name /*= AZ::Name()*/)
+    {
+        return AcquirePipelineStateInternal(handle, descriptor, name, true);
+    }
+
+    const PipelineState* PipelineStateCache::AcquirePipelineStateInternal(
+        PipelineLibraryHandle handle, const PipelineStateDescriptor& descriptor, const AZ::Name& name, bool isPrecompile)
     {
         if (handle.IsNull())
         {
@@ -327,7 +364,8 @@ namespace AZ::RHI
                     threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
                 }
 
-                ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, name);
+                ConstPtr<PipelineState> pipelineState = CompilePipelineState(
+                    globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash, name, isPrecompile);
 
                 [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                 AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
@@ -342,7 +380,8 @@ namespace AZ::RHI
         ThreadLibraryEntry& threadLibraryEntry,
         const PipelineStateDescriptor& descriptor,
         PipelineStateHash pipelineStateHash,
-        const AZ::Name& name)
+        const AZ::Name& name,
+        bool isPrecompile)
     {
         Ptr<PipelineState> pipelineState;
 
@@ -365,6 +404,15 @@ namespace AZ::RHI
             AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
         }
 
+        if (isPrecompile)
+        {
+            ++m_precompiledCount;
+        }
+        else
+        {
+            ++m_compiledOnDemandCount;
+        }
+
         [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
 
         // Increment the pending compile count on the global entry, which tracks how many pipeline states
@@ -253,6 +253,11 @@ namespace AZ::RHI
 
         poolStats->m_name = GetName();
         poolStats->m_memoryUsage = m_memoryUsage;
+        ReportPoolStatistics(*poolStats);
         builder.EndPool();
     }
+
+    void ResourcePool::ReportPoolStatistics([[maybe_unused]] MemoryStatistics::Pool& poolStatistics) const
+    {
+    }
 }
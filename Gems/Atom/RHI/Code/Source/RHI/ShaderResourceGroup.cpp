@@ -12,6 +12,22 @@
 
 namespace AZ::RHI
 {
+    namespace
+    {
+        Interval MergeIntervals(const Interval& lhs, const Interval& rhs)
+        {
+            if (lhs.m_min == lhs.m_max)
+            {
+                return rhs;
+            }
+            if (rhs.m_min == rhs.m_max)
+            {
+                return lhs;
+            }
+            return Interval(AZStd::min(lhs.m_min, rhs.m_min), AZStd::max(lhs.m_max, rhs.m_max));
+        }
+    }
+
     void ShaderResourceGroup::Compile(const ShaderResourceGroupData& groupData, CompileMode compileMode /*= CompileMode::Async*/)
     {
         switch (compileMode)
@@ -56,6 +72,7 @@ namespace AZ::RHI
     void ShaderResourceGroup::SetData(const ShaderResourceGroupData& data)
     {
         m_data = data;
+        m_pendingConstantInterval = MergeIntervals(m_pendingConstantInterval, data.GetConstantsData().GetDirtyInterval());
         uint32_t sourceUpdateMask = data.GetUpdateMask();
             
         //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
@@ -116,6 +133,32 @@ namespace AZ::RHI
         m_viewHash[viewName] = viewHash;
     }
     
+    void ShaderResourceGroup::UpdateConstantDataIntervalToCompile(bool compileAllConstants)
+    {
+        // Every compile moves the platform to its next copy of the constant data, which was last updated
+        // FrameCountMax compiles ago. So that copy is missing the bytes modified during the last FrameCountMax compiles.
+        m_compiledConstantIntervals[m_compiledConstantIntervalIndex] = m_pendingConstantInterval;
+        m_compiledConstantIntervalIndex = (m_compiledConstantIntervalIndex + 1) % RHI::Limits::Device::FrameCountMax;
+        m_pendingConstantInterval = Interval();
+
+        if (compileAllConstants)
+        {
+            m_constantIntervalToCompile = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+            return;
+        }
+
+        m_constantIntervalToCompile = Interval();
+        for (const Interval& interval : m_compiledConstantIntervals)
+        {
+            m_constantIntervalToCompile = MergeIntervals(m_constantIntervalToCompile, interval);
+        }
+    }
+
+    Interval ShaderResourceGroup::GetConstantDataIntervalToCompile() const
+    {
+        return m_constantIntervalToCompile;
+    }
+
     void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
     {
         AZ_UNUSED(builder);
@@ -390,6 +390,7 @@ namespace AZ::RHI
     void ShaderResourceGroupData::ResetUpdateMask()
     {
         m_updateMask = 0;
+        m_constantsData.ResetDirtyInterval();
     }
     
     void ShaderResourceGroupData::SetBindlessViews(
@@ -71,6 +71,11 @@ namespace AZ::RHI
             // Pre-initialize the data so that we can build view diffs later.
             group.m_data = ShaderResourceGroupData(layout);
 
+            // None of the copies of the constant data have been written yet.
+            group.m_pendingConstantInterval = group.m_data.GetConstantsData().GetDirtyInterval();
+            group.m_compiledConstantIntervals.fill(Interval());
+            group.m_compiledConstantIntervalIndex = 0;
+
             // Cache off the binding slot for one less indirection.
             group.m_bindingSlot = layout->GetBindingSlot();
         }
@@ -345,12 +350,24 @@ namespace AZ::RHI
         // Check if any part of the Srg was updated before trying to compile it
         if (shaderResourceGroup.IsAnyResourceTypeUpdated())
         {
+            shaderResourceGroup.UpdateConstantDataIntervalToCompile(r_DisablePartialSrgCompilation);
+
             ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
+
+            m_compiledGroupCount++;
+            if (shaderResourceGroup.IsResourceTypeEnabledForCompilation(
+                    static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask)))
+            {
+                const Interval constantInterval = shaderResourceGroup.GetConstantDataIntervalToCompile();
+                m_compiledConstantBytes += constantInterval.m_max - constantInterval.m_min;
+                m_totalConstantBytes += shaderResourceGroupData.GetConstantData().size();
+            }
                 
             //Reset update mask if the latency check has been fulfilled
             shaderResourceGroup.DisableCompilationForAllResourceTypes();
             return resultCode;
         }
+        m_skippedGroupCount++;
         return ResultCode::Success;
     }
     
@@ -372,6 +389,26 @@ namespace AZ::RHI
         }
     }
 
+    const MemoryStatistics::ShaderResourceGroupCompiles& ShaderResourceGroupPool::GetLastFrameCompiles() const
+    {
+        return m_lastFrameCompiles;
+    }
+
+    void ShaderResourceGroupPool::OnFrameEnd()
+    {
+        m_lastFrameCompiles.m_compiledGroupCount = m_compiledGroupCount.exchange(0);
+        m_lastFrameCompiles.m_skippedGroupCount = m_skippedGroupCount.exchange(0);
+        m_lastFrameCompiles.m_compiledConstantBytes = m_compiledConstantBytes.exchange(0);
+        m_lastFrameCompiles.m_totalConstantBytes = m_totalConstantBytes.exchange(0);
+
+        ResourcePool::OnFrameEnd();
+    }
+
+    void ShaderResourceGroupPool::ReportPoolStatistics(MemoryStatistics::Pool& poolStatistics) const
+    {
+        poolStatistics.m_shaderResourceGroupCompiles = m_lastFrameCompiles;
+    }
+
     ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
     {
         return ResultCode::Success;
@@ -16,6 +16,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/tuple.h>
 
 #include <Tests/Factory.h>
 
@@ -646,6 +647,112 @@ namespace UnitTest
             delete drawPacket;
             delete drawPacketClone;
         }
+
+        void DrawListSortLargeList()
+        {
+            AZ::SimpleLcgRandom random(s_randomSeed);
+
+            // Large enough for the radix sort, with repeated keys and depths so every tie breaker is exercised
+            constexpr size_t ItemCount = 2000;
+            AZStd::vector<RHI::DrawItem> drawItems(ItemCount);
+            RHI::DrawList drawList(ItemCount);
+            for (size_t i = 0; i < ItemCount; ++i)
+            {
+                RHI::DrawItemProperties& item = drawList[i];
+                item.m_item = &drawItems[random.GetRandom() % ItemCount];
+                item.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16) - 8;
+                item.m_depth = static_cast<float>(static_cast<int32_t>(random.GetRandom() % 64) - 32) * 0.5f;
+            }
+
+            const auto keyThenDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return AZStd::tie(a.m_sortKey, a.m_depth, a.m_item) < AZStd::tie(b.m_sortKey, b.m_depth, b.m_item);
+            };
+            const auto keyThenReverseDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                const float depthA = -a.m_depth;
+                const float depthB = -b.m_depth;
+                return AZStd::tie(a.m_sortKey, depthA, a.m_item) < AZStd::tie(b.m_sortKey, depthB, b.m_item);
+            };
+            const auto depthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return AZStd::tie(a.m_depth, a.m_sortKey, a.m_item) < AZStd::tie(b.m_depth, b.m_sortKey, b.m_item);
+            };
+            const auto reverseDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                const float depthA = -a.m_depth;
+                const float depthB = -b.m_depth;
+                return AZStd::tie(depthA, a.m_sortKey, a.m_item) < AZStd::tie(depthB, b.m_sortKey, b.m_item);
+            };
+
+            const auto testSortType = [&drawList](RHI::DrawListSortType sortType, const auto& compare)
+            {
+                RHI::DrawList sorted = drawList;
+                RHI::SortDrawList(sorted, sortType);
+
+                RHI::DrawList expected = drawList;
+                AZStd::sort(expected.begin(), expected.end(), compare);
+
+                ASSERT_EQ(sorted.size(), expected.size());
+                for (size_t i = 0; i < expected.size(); ++i)
+                {
+                    EXPECT_EQ(sorted[i], expected[i]);
+                }
+            };
+
+            testSortType(RHI::DrawListSortType::KeyThenDepth, keyThenDepth);
+            testSortType(RHI::DrawListSortType::KeyThenReverseDepth, keyThenReverseDepth);
+            testSortType(RHI::DrawListSortType::DepthThenKey, depthThenKey);
+            testSortType(RHI::DrawListSortType::ReverseDepthThenKey, reverseDepthThenKey);
+        }
+
+        void DrawListContextFinalizePerTag()
+        {
+            AZ::SimpleLcgRandom random(s_randomSeed);
+            DrawPacketData drawPacketData(random);
+
+            RHI::DrawPacketBuilder builder;
+            const RHI::DrawPacket* drawPacket = drawPacketData.Build(builder);
+
+            RHI::DrawListContext finalizedContext;
+            finalizedContext.Init(RHI::DrawListMask{}.set());
+            finalizedContext.AddDrawPacket(drawPacket);
+            finalizedContext.FinalizeLists();
+
+            RHI::DrawListContext perTagContext;
+            perTagContext.Init(RHI::DrawListMask{}.set());
+            perTagContext.AddDrawPacket(drawPacket);
+
+            const RHI::DrawListMask pendingMask = perTagContext.BeginFinalizeLists();
+            for (size_t i = 0; i < drawPacket->GetDrawItemCount(); ++i)
+            {
+                EXPECT_TRUE(pendingMask[drawPacket->GetDrawListTag(i).GetIndex()]);
+            }
+
+            for (size_t tagIndex = 0; tagIndex < pendingMask.size(); ++tagIndex)
+            {
+                if (pendingMask[tagIndex])
+                {
+                    perTagContext.FinalizeList(RHI::DrawListTag(tagIndex));
+                }
+            }
+
+            for (size_t tagIndex = 0; tagIndex < RHI::Limits::Pipeline::DrawListTagCountMax; ++tagIndex)
+            {
+                RHI::DrawListView expected = finalizedContext.GetList(RHI::DrawListTag(tagIndex));
+                RHI::DrawListView actual = perTagContext.GetList(RHI::DrawListTag(tagIndex));
+                ASSERT_EQ(actual.size(), expected.size());
+                for (size_t i = 0; i < expected.size(); ++i)
+                {
+                    EXPECT_EQ(actual[i], expected[i]);
+                }
+            }
+
+            finalizedContext.Shutdown();
+            perTagContext.Shutdown();
+
+            delete drawPacket;
+        }
     };
 
     TEST_F(DrawPacketTest, TestDrawListTagRegistryNullCase)
@@ -712,6 +819,16 @@ namespace UnitTest
     {
         TestSetRootConstants();
     }
+
+    TEST_F(DrawPacketTest, DrawListSortLargeList)
+    {
+        DrawListSortLargeList();
+    }
+
+    TEST_F(DrawPacketTest, DrawListContextFinalizePerTag)
+    {
+        DrawListContextFinalizePerTag();
+    }
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
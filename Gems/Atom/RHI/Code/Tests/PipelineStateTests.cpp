@@ -364,4 +364,39 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_PrecompilePipelineState_Test)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+        RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+        RHI::PipelineStateDescriptorForDraw precompiledDescriptor = CreatePipelineStateDescriptor(0);
+        RHI::PipelineStateDescriptorForDraw onDemandDescriptor = CreatePipelineStateDescriptor(1);
+
+        const RHI::PipelineState* precompiled = pipelineStateCache->PrecompilePipelineState(libraryHandle, precompiledDescriptor);
+        EXPECT_NE(precompiled, nullptr);
+        pipelineStateCache->Compact();
+
+        RHI::PipelineStateCache::CompileStatistics statistics = pipelineStateCache->GetLastCompileStatistics();
+        EXPECT_EQ(statistics.m_precompiledCount, 1);
+        EXPECT_EQ(statistics.m_compiledOnDemandCount, 0);
+
+        // Acquiring the precompiled pipeline state hits the cache, so only the new one is compiled on demand.
+        EXPECT_EQ(pipelineStateCache->AcquirePipelineState(libraryHandle, precompiledDescriptor), precompiled);
+        EXPECT_NE(pipelineStateCache->AcquirePipelineState(libraryHandle, onDemandDescriptor), nullptr);
+        pipelineStateCache->Compact();
+
+        statistics = pipelineStateCache->GetLastCompileStatistics();
+        EXPECT_EQ(statistics.m_precompiledCount, 0);
+        EXPECT_EQ(statistics.m_compiledOnDemandCount, 1);
+
+        // The counters only cover a single cycle.
+        pipelineStateCache->Compact();
+        statistics = pipelineStateCache->GetLastCompileStatistics();
+        EXPECT_EQ(statistics.m_compiledOnDemandCount, 0);
+
+        pipelineStateCache->ReleaseLibrary(libraryHandle);
+        ValidateCacheIntegrity(pipelineStateCache);
+    }
 }
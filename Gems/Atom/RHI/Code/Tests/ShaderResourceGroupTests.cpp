@@ -636,6 +636,68 @@ namespace UnitTest
         TestShaderResourceGroupPools();
     }
 
+    TEST_F(ShaderResourceGroupTests, ConstantsData_SetConstant_DirtyIntervalCoversWrittenBytes)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex floatIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+        EXPECT_EQ(RHI::Interval(0, constantsLayout->GetDataSize()), srgData.GetConstantsData().GetDirtyInterval());
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(RHI::Interval(), srgData.GetConstantsData().GetDirtyInterval());
+
+        srgData.SetConstant(vector4Index, Vector4(1.0f));
+        EXPECT_EQ(constantsLayout->GetInterval(vector4Index), srgData.GetConstantsData().GetDirtyInterval());
+
+        srgData.SetConstant(floatIndex, 1.0f);
+        EXPECT_EQ(
+            RHI::Interval(constantsLayout->GetInterval(floatIndex).m_min, constantsLayout->GetInterval(vector4Index).m_max),
+            srgData.GetConstantsData().GetDirtyInterval());
+    }
+
+    TEST_F(ShaderResourceGroupTests, CompileGroup_ModifiedConstants_CompilesBytesModifiedSinceBufferWasLastWritten)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        // The first compile of new data covers all the constants.
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+        srgData.SetConstant(vector4Index, Vector4(0.0f));
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(RHI::Interval(0, constantsLayout->GetDataSize()), srg->GetConstantDataIntervalToCompile());
+
+        // Every copy of the constant data needs to receive all the constants before only the modified ones are compiled.
+        for (uint32_t i = 0; i < RHI::Limits::Device::FrameCountMax; ++i)
+        {
+            srgData.SetConstant(vector4Index, Vector4(static_cast<float>(i)));
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+            srgData.ResetUpdateMask();
+
+            if (i + 1 < RHI::Limits::Device::FrameCountMax)
+            {
+                EXPECT_EQ(RHI::Interval(0, constantsLayout->GetDataSize()), srg->GetConstantDataIntervalToCompile());
+            }
+        }
+        EXPECT_EQ(constantsLayout->GetInterval(vector4Index), srg->GetConstantDataIntervalToCompile());
+
+        srg->Shutdown();
+        srgPool->Shutdown();
+    }
+
 
     TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_Vectors_ValidOutput)
     {
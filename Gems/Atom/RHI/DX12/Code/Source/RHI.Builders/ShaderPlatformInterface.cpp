@@ -258,6 +258,7 @@ namespace AZ
             // If we use the auto-name (hash), there is no way we can retrieve that name apart from listing the directory.
             // Instead, let's just generate that hash ourselves.
             AZStd::string symbolDatabaseFileCliArgument{" "};  // when not debug: still insert a space between 5.dxil and 7.hlsl-in
+            bool writesSymbolDatabase = false;
             if (graphicsDevMode || shaderBuildArguments.m_generateDebugInfo)
             {
                 // prepare .pdb filename:
@@ -274,6 +275,7 @@ namespace AZ
                 else
                 {
                     symbolDatabaseFileCliArgument = " -Fd \"" + symbolDatabaseFilePath + "\" ";  // 6.pdb  hereunder
+                    writesSymbolDatabase = true;
                     byProducts.m_intermediatePaths.emplace(AZStd::move(symbolDatabaseFilePath));
                 }
             }
@@ -292,8 +294,11 @@ namespace AZ
                                                                  dxcInputFile.c_str()                    // 7
                                                                  );
 
-            // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+            // Run Shader Compiler, the symbol database is a side output of dxc so those compilations can't come from the cache
+            const bool compiled = writesSymbolDatabase
+                ? RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC")
+                : RHI::ExecuteShaderCompilerCached(dxcRelativePath, dxcCommandOptions, dxcInputFile, { shaderOutputFile, objectCodeOutputFile }, shaderSourceFile, tempFolder, "DXC");
+            if (!compiled)
             {
                 return false;
             }
@@ -206,7 +206,16 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // The ring of constant buffers advances on every compile, so only the bytes modified since this buffer
+                // was last written need to be copied.
+                const RHI::Interval constantInterval = groupBase.GetConstantDataIntervalToCompile();
+                if (constantInterval.m_max > constantInterval.m_min)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + constantInterval.m_min,
+                        groupData.GetConstantData().data() + constantInterval.m_min,
+                        constantInterval.m_max - constantInterval.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
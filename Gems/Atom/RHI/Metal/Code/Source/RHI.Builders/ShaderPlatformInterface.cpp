@@ -300,7 +300,7 @@ namespace AZ
                                                                     dxcInputFile.c_str());         // 5
 
             // Run dxc Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+            if (!RHI::ExecuteShaderCompilerCached(dxcRelativePath, dxcCommandOptions, dxcInputFile, { shaderSpirvOutputFile }, shaderSourceFile, tempFolder, "DXC"))
             {
                 AZ_Error(MetalShaderPlatformName, false, "DXC failed to create the spirv file");
                 return false;
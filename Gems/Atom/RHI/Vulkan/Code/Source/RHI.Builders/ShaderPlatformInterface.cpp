@@ -274,7 +274,7 @@ namespace AZ
             //       therefore, the debug data is probably embedded in the spirv blob.
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, tempFolder, "DXC"))
+            if (!RHI::ExecuteShaderCompilerCached(dxcRelativePath, dxcCommandOptions, dxcInputFile, { shaderOutputFile, objectCodeOutputFile }, shaderSourceFile, tempFolder, "DXC"))
             {
                 return false;
             }
@@ -101,12 +101,8 @@ namespace AZ
                 FramePacket* framePacket = nullptr;
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
 
-                // Insert a barrier to wait for anybody using this buffer range.
-                // We need to create a command list to insert the barrier.
-                BeginFramePacket(vulkanQueue);
-                EmmitPrologueMemoryBarrier(*buffer, 0, pendingByteCount);
-                EndFramePacket(vulkanQueue);
-
+                // Each chunk inserts the barrier for the range it copies in the same packet as the copy,
+                // so we don't need to submit a separate packet with a barrier for the whole buffer first.
                 while (pendingByteCount > 0)
                 {
                     AZ_PROFILE_SCOPE(RHI, "Upload Buffer Chunk");
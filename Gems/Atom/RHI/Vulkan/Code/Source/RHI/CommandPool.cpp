@@ -42,7 +42,10 @@ namespace AZ
 
         void CommandPool::Shutdown()
         {
-            m_freeCommandLists.clear();
+            for (auto& freeCommandLists : m_freeCommandLists)
+            {
+                freeCommandLists.clear();
+            }
             m_commandLists.clear();
             if (m_nativeCommandPool != VK_NULL_HANDLE)
             {
@@ -78,17 +81,14 @@ namespace AZ
         RHI::Ptr<CommandList> CommandPool::AllocateCommandList(VkCommandBufferLevel level)
         {
             RHI::Ptr<CommandList> cmdList;
-            // Search the free list first
-            auto it = AZStd::find_if(m_freeCommandLists.begin(), m_freeCommandLists.end(), [&level](const RHI::Ptr<CommandList>& cmdList) 
-            { 
-                return cmdList->m_descriptor.m_level == level;
-            });
-
-            if (it != m_freeCommandLists.end())
+            // Recycle a free command list of the same level first
+            AZ_Assert(static_cast<size_t>(level) < m_freeCommandLists.size(), "Invalid command buffer level %d", static_cast<int>(level));
+            AZStd::vector<RHI::Ptr<CommandList>>& freeCommandLists = m_freeCommandLists[level];
+            if (!freeCommandLists.empty())
             {
-                cmdList = *it;
+                cmdList = AZStd::move(freeCommandLists.back());
+                freeCommandLists.pop_back();
                 m_commandLists.push_back(cmdList);
-                m_freeCommandLists.erase(it);
                 return cmdList;
             }
 
@@ -120,8 +120,8 @@ namespace AZ
             for (RHI::Ptr<CommandList>& cmdList : m_commandLists)
             {
                 cmdList->Reset();
+                m_freeCommandLists[cmdList->m_descriptor.m_level].push_back(AZStd::move(cmdList));
             }
-            m_freeCommandLists.insert(m_freeCommandLists.end(), AZStd::make_move_iterator(m_commandLists.begin()), AZStd::make_move_iterator(m_commandLists.end()));
             m_commandLists.clear();
             AssertSuccess(device.GetContext().ResetCommandPool(device.GetNativeDevice(), m_nativeCommandPool, 0));
         }        
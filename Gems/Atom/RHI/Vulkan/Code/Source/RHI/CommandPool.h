@@ -11,6 +11,7 @@
 #include <Atom/RHI.Reflect/AttachmentEnums.h>
 #include <Atom/RHI.Reflect/Limits.h>
 #include <Atom/RHI/ObjectPool.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <RHI/CommandList.h>
@@ -63,7 +64,9 @@ namespace AZ
             VkCommandPool m_nativeCommandPool = VK_NULL_HANDLE;
             Descriptor m_descriptor;
             AZStd::vector<RHI::Ptr<CommandList>> m_commandLists;
-            AZStd::vector<RHI::Ptr<CommandList>> m_freeCommandLists;
+            // Free command lists are kept per level, so recycling a command list doesn't have to search for one of the right level.
+            // Indexed by VkCommandBufferLevel.
+            AZStd::array<AZStd::vector<RHI::Ptr<CommandList>>, 2> m_freeCommandLists;
         };        
     }
 }
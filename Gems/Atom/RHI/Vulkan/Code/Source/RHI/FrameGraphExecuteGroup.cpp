@@ -38,5 +38,25 @@ namespace AZ
         {
             return m_device->AcquireCommandList(m_hardwareQueueClass, level);
         }
+
+        AZStd::span<const AZStd::sys_time_t> FrameGraphExecuteGroup::GetContextRecordingTimes() const
+        {
+            return m_contextRecordingTimes;
+        }
+
+        void FrameGraphExecuteGroup::InitContextTimers()
+        {
+            m_contextRecordingTimes.resize(GetContextCount(), 0);
+        }
+
+        void FrameGraphExecuteGroup::BeginContextTimer(uint32_t contextIndex)
+        {
+            m_contextRecordingTimes[contextIndex] = AZStd::GetTimeNowMicroSecond();
+        }
+
+        void FrameGraphExecuteGroup::EndContextTimer(uint32_t contextIndex)
+        {
+            m_contextRecordingTimes[contextIndex] = AZStd::GetTimeNowMicroSecond() - m_contextRecordingTimes[contextIndex];
+        }
     }
 }
@@ -12,6 +12,7 @@
 #include <RHI/Scope.h>
 #include <RHI/CommandQueue.h>
 #include <Atom/RHI/FrameGraphExecuteGroup.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -41,13 +42,26 @@ namespace AZ
 
             virtual AZStd::span<const RHI::Ptr<CommandList>> GetCommandLists() const = 0;
 
+            //! Returns the CPU time in microseconds that was spent recording each context of the group.
+            AZStd::span<const AZStd::sys_time_t> GetContextRecordingTimes() const;
+
         protected:
             RHI::Ptr<CommandList> AcquireCommandList(VkCommandBufferLevel level) const;
 
+            //! Measures the recording time of each context. InitContextTimers must be called once the contexts of the group
+            //! have been initialized.
+            void InitContextTimers();
+            void BeginContextTimer(uint32_t contextIndex);
+            void EndContextTimer(uint32_t contextIndex);
+
             Device* m_device = nullptr;
             RHI::HardwareQueueClass m_hardwareQueueClass = RHI::HardwareQueueClass::Graphics;
             ExecuteWorkRequest m_workRequest;
             RHI::GraphGroupId m_groupId;
+
+        private:
+            // Each context only writes its own entry, so contexts can be recorded in parallel.
+            AZStd::vector<AZStd::sys_time_t> m_contextRecordingTimes;
         };
     }
 }
@@ -54,6 +54,7 @@ namespace AZ::Vulkan
         request.m_scopeEntries = scopeEntries.data();
         request.m_scopeCount = static_cast<uint32_t>(scopeEntries.size());
         Base::Init(request);
+        InitContextTimers();
 
         m_workRequest.m_debugLabel = "FrameGraph Merged Group";
     }
@@ -85,6 +86,8 @@ namespace AZ::Vulkan
     {
         AZ_Assert(static_cast<uint32_t>(m_lastCompletedScope + 1) == contextIndex, "Contexts must be recorded in order!");
 
+        BeginContextTimer(contextIndex);
+
         const Scope* scope = m_scopes[contextIndex];
         m_commandList->SetName(m_name);
         m_commandList->BeginDebugLabel(scope->GetMarkerLabel().data());
@@ -125,6 +128,7 @@ namespace AZ::Vulkan
         scope->EmitScopeBarriers(*m_commandList, Scope::BarrierSlot::Epilogue);
 
         commandList->EndDebugLabel();
+        EndContextTimer(contextIndex);
     }
 
     AZStd::span<const Scope* const> FrameGraphExecuteGroupPrimary::GetScopes() const
@@ -44,6 +44,7 @@ namespace AZ::Vulkan
         request.m_commandListCount = commandListCount;
         request.m_jobPolicy = globalJobPolicy;
         Base::Init(request);
+        InitContextTimers();
 
         m_workRequest.m_debugLabel = AZStd::string::format("Framegraph %s Group", m_scope->GetId().GetCStr());
     }
@@ -56,7 +57,8 @@ namespace AZ::Vulkan
     void FrameGraphExecuteGroupSecondary::BeginContextInternal(RHI::FrameGraphExecuteContext& context, uint32_t contextIndex)
     {
         AZ_Assert(m_scope, "Scope is null.");
-        AZ_Assert(m_scope->GetFrameGraph(), "FrameGraph is null.");            
+        AZ_Assert(m_scope->GetFrameGraph(), "FrameGraph is null.");
+        BeginContextTimer(contextIndex);
 
         // Create secondary command list for this context
         RHI::Ptr<CommandList> commandList = AcquireCommandList(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
@@ -71,12 +73,13 @@ namespace AZ::Vulkan
         m_scope->Begin(*commandList);
     }
 
-    void FrameGraphExecuteGroupSecondary::EndContextInternal(RHI::FrameGraphExecuteContext& context, [[maybe_unused]] uint32_t contextIndex)
+    void FrameGraphExecuteGroupSecondary::EndContextInternal(RHI::FrameGraphExecuteContext& context, uint32_t contextIndex)
     {
         CommandList& commandList = static_cast<CommandList&>(*context.GetCommandList());
         m_scope->End(commandList);
         commandList.EndDebugLabel();
         commandList.EndCommandBuffer();
+        EndContextTimer(contextIndex);
     }
 
     void FrameGraphExecuteGroupSecondary::EndInternal()
@@ -6,6 +6,7 @@
  *
  */
 #include <Atom/RHI/FrameGraph.h>
+#include <AzCore/std/math.h>
 #include <AzCore/std/parallel/thread.h>
 #include <RHI/FrameGraphExecuteGroupSecondaryHandler.h>
 #include <RHI/FrameGraphExecuteGroupPrimaryHandler.h>
@@ -16,12 +17,28 @@
 #include <RHI/SwapChain.h>
 #include <RHI/Scope.h>
 #include <RHI/CommandQueueContext.h>
+#include <AzCore/Console/IConsole.h>
 
+AZ_CVAR(bool, r_vulkanTimedCommandListPartition, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Splits the recording of large scopes into secondary command lists based on how long the scopes took to record in previous frames, "
+    "instead of only on their number of items.");
+
+AZ_CVAR(uint32_t, r_vulkanCommandListRecordingBudgetUs, 500, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "The CPU time in microseconds a single secondary command list is expected to take to record.");
 
 namespace AZ
 {
     namespace Vulkan
     {
+        namespace
+        {
+            // How much a new recording time sample contributes to the smoothed time per item.
+            constexpr float RecordingTimeSmoothing = 0.25f;
+
+            // Recording times of scopes that haven't been recorded for this many frames are discarded.
+            constexpr uint64_t ScopeRecordingStatsFrameLatency = 16;
+        }
+
         RHI::Ptr<FrameGraphExecuter> FrameGraphExecuter::Create()
         {
             return aznew FrameGraphExecuter();
@@ -48,17 +65,19 @@ namespace AZ
             {
                 m_frameGraphExecuterData = vkPlatformLimitsDesc->m_frameGraphExecuterData;
             }
+            m_commandListsPerScopeMax = AZStd::max(m_frameGraphExecuterData.m_commandListsPerScopeMax, AZStd::thread::hardware_concurrency());
             return RHI::ResultCode::Success;
         }
 
         void FrameGraphExecuter::ShutdownInternal()
         {
-            // do nothing
+            m_scopeRecordingStats.clear();
         }
 
         void FrameGraphExecuter::BeginInternal(const RHI::FrameGraph& frameGraph)
         {
             Device& device = GetDevice();
+            ++m_frameIndex;
             AZStd::vector<const Scope*> mergedScopes;
             const Scope* scopePrev = nullptr;
             const Scope* scopeNext = nullptr;
@@ -119,10 +138,18 @@ namespace AZ
                     * Computes a cost heuristic based on the number of items and number of attachments in
                     * the scope. This cost is used to partition command list generation.
                     */
-                const uint32_t totalScopeCost =
+                uint32_t totalScopeCost =
                     estimatedItemCount * m_frameGraphExecuterData.m_itemCost +
                     static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost;
 
+                // Scopes that took longer than the recording budget of one command list in previous frames are recorded
+                // in parallel, split by how long their items took to record instead of by the item count heuristic.
+                const uint32_t timedCommandListCount = GetTimedCommandListCount(scope);
+                if (timedCommandListCount > 1)
+                {
+                    totalScopeCost = AZStd::max(totalScopeCost, CommandListCostThreshold);
+                }
+
                 // Check if we are in a middle of a framegraph group.
                 const bool subpassGroup =
                     (scopeNext && scopeNext->GetFrameGraphGroupId() == scope.GetFrameGraphGroupId()) ||
@@ -170,7 +197,9 @@ namespace AZ
                 else
                 {
                     // And then create a new group for the current scope with dedicated [1, N] secondary command lists
-                    const uint32_t commandListCount = AZStd::max(AZ::DivideAndRoundUp(totalScopeCost, CommandListCostThreshold), 1u);
+                    const uint32_t commandListCount = timedCommandListCount > 0
+                        ? timedCommandListCount
+                        : AZStd::max(AZ::DivideAndRoundUp(totalScopeCost, CommandListCostThreshold), 1u);
                     FrameGraphExecuteGroupSecondary* scopeContextGroup = AddGroup<FrameGraphExecuteGroupSecondary>();
                     scopeContextGroup->Init(device, scope, commandListCount, GetJobPolicy());
                 }
@@ -225,6 +254,7 @@ namespace AZ
             auto findIter = m_groupHandlers.find(group.GetGroupId());
             AZ_Assert(findIter != m_groupHandlers.end(), "Could not find group handler for groupId %d", group.GetGroupId().GetIndex());
             FrameGraphExecuteGroupHandler* handler = findIter->second.get();
+            UpdateScopeRecordingStats(group);
             // Wait until all execute groups of the handler has finished and also make sure that the handler itself hasn't executed already (which is possible for parallel encoding).
             if (!handler->IsExecuted() && handler->IsComplete())
             {
@@ -236,6 +266,75 @@ namespace AZ
         void FrameGraphExecuter::EndInternal()
         {
             m_groupHandlers.clear();
+
+            AZStd::erase_if(m_scopeRecordingStats, [this](const auto& scopeStats)
+            {
+                return scopeStats.second.m_lastFrameIndex + ScopeRecordingStatsFrameLatency < m_frameIndex;
+            });
+        }
+
+        uint32_t FrameGraphExecuter::GetTimedCommandListCount(const Scope& scope) const
+        {
+            const uint32_t estimatedItemCount = scope.GetEstimatedItemCount();
+            if (!r_vulkanTimedCommandListPartition || estimatedItemCount == 0)
+            {
+                return 0;
+            }
+
+            auto findIter = m_scopeRecordingStats.find(scope.GetId());
+            if (findIter == m_scopeRecordingStats.end())
+            {
+                return 0;
+            }
+
+            // The time per item is measured in the previous frames, while the item count is the one of this frame, so scopes
+            // whose number of draws changes are split accordingly.
+            const float budgetMicroseconds = static_cast<float>(AZStd::max(static_cast<uint32_t>(r_vulkanCommandListRecordingBudgetUs), 1u));
+            const float estimatedMicroseconds = findIter->second.m_microsecondsPerItem * estimatedItemCount;
+            const uint32_t commandListCount = static_cast<uint32_t>(AZStd::ceil(estimatedMicroseconds / budgetMicroseconds));
+            return AZStd::clamp(commandListCount, 1u, AZStd::min(m_commandListsPerScopeMax, estimatedItemCount));
+        }
+
+        void FrameGraphExecuter::UpdateScopeRecordingStats(const FrameGraphExecuteGroup& group)
+        {
+            const AZStd::span<const Scope* const> scopes = group.GetScopes();
+            const AZStd::span<const AZStd::sys_time_t> recordingTimes = group.GetContextRecordingTimes();
+
+            auto updateStats = [this](const Scope& scope, AZStd::sys_time_t recordingTime)
+            {
+                const uint32_t itemCount = scope.GetEstimatedItemCount();
+                if (itemCount == 0)
+                {
+                    return;
+                }
+
+                const float microsecondsPerItem = static_cast<float>(recordingTime) / itemCount;
+                auto insertResult = m_scopeRecordingStats.emplace(scope.GetId(), ScopeRecordingStats{ microsecondsPerItem, m_frameIndex });
+                if (!insertResult.second)
+                {
+                    ScopeRecordingStats& stats = insertResult.first->second;
+                    stats.m_microsecondsPerItem += (microsecondsPerItem - stats.m_microsecondsPerItem) * RecordingTimeSmoothing;
+                    stats.m_lastFrameIndex = m_frameIndex;
+                }
+            };
+
+            // Merged groups record one context per scope, while secondary groups record a single scope over all their contexts.
+            if (scopes.size() == recordingTimes.size())
+            {
+                for (size_t scopeIndex = 0; scopeIndex < scopes.size(); ++scopeIndex)
+                {
+                    updateStats(*scopes[scopeIndex], recordingTimes[scopeIndex]);
+                }
+            }
+            else if (scopes.size() == 1)
+            {
+                AZStd::sys_time_t recordingTime = 0;
+                for (AZStd::sys_time_t contextRecordingTime : recordingTimes)
+                {
+                    recordingTime += contextRecordingTime;
+                }
+                updateStats(*scopes.front(), recordingTime);
+            }
         }
 
         void FrameGraphExecuter::AddExecuteGroupHandler(const RHI::GraphGroupId& groupId, const AZStd::vector<RHI::FrameGraphExecuteGroup*>& groups)
@@ -13,13 +13,15 @@
 #include <RHI/FrameGraphExecuteGroupHandler.h>
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <Atom/RHI.Reflect/ScopeId.h>
 #include <Atom/RHI.Reflect/Vulkan/PlatformLimitsDescriptor.h>
 namespace AZ
 {
     namespace Vulkan
     {
         class Device;
-
+        class FrameGraphExecuteGroup;
+        class Scope;
 
         class FrameGraphExecuter final
             : public RHI::FrameGraphExecuter
@@ -46,12 +48,32 @@ namespace AZ
             void EndInternal() override;
             //////////////////////////////////////////////////////////////////////////
 
+            // The CPU cost of recording a scope, measured in previous frames.
+            struct ScopeRecordingStats
+            {
+                // Smoothed recording time per item, including the fixed cost of the scope spread over its items.
+                float m_microsecondsPerItem = 0.0f;
+                uint64_t m_lastFrameIndex = 0;
+            };
+
             // Adds a handler for a list of execute groups.
             void AddExecuteGroupHandler(const RHI::GraphGroupId& groupId, const AZStd::vector<RHI::FrameGraphExecuteGroup*>& groups);
 
+            // Returns the number of secondary command lists a scope is recorded with, based on its recording time in previous
+            // frames and the number of items it has this frame. Returns 0 if the scope has no recording history.
+            uint32_t GetTimedCommandListCount(const Scope& scope) const;
+
+            // Stores the recording times of the scopes of an execute group that finished recording.
+            void UpdateScopeRecordingStats(const FrameGraphExecuteGroup& group);
+
             // List of handlers for execute groups.
             AZStd::unordered_map<RHI::GraphGroupId, AZStd::unique_ptr<FrameGraphExecuteGroupHandler>> m_groupHandlers;
             FrameGraphExecuterData m_frameGraphExecuterData;
+
+            AZStd::unordered_map<RHI::ScopeId, ScopeRecordingStats> m_scopeRecordingStats;
+            uint64_t m_frameIndex = 0;
+            // The maximum number of secondary command lists a scope is split into, at least one per CPU core.
+            uint32_t m_commandListsPerScopeMax = 0;
         };
     }
 }
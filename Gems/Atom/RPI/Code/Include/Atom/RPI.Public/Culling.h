@@ -67,6 +67,10 @@ namespace AZ
                 //! Will hide this object if any of the hideFlags match the View's usage flags. Useful to hide objects from certain Views.
                 //! Set to all 0's if you don't want to hide the object from any Views.
                 RPI::View::UsageFlags m_hideFlags = RPI::View::UsageNone;
+                //! The view in which GPU occlusion culling last found this object to be fully hidden, or null if it isn't known to be hidden.
+                //! The object is skipped when culling that view. Set from results that are a few frames old, so it must be cleared
+                //! whenever the bounds of the object change.
+                const View* m_occludedInView = nullptr;
 
                 //! UUID and type of the component that owns this cullable (optional)
                 AZ::Uuid m_componentUuid = AZ::Uuid::CreateNull();
@@ -115,7 +119,7 @@ namespace AZ
             using FlagType = uint32_t;
             FlagType m_prevShaderOptionFlags = 0;
             AZStd::atomic<FlagType> m_shaderOptionFlags = 0;
-            FlagType m_flags;
+            FlagType m_flags = 0;
 
             //! Flag indicating if the object is visible in any view, meaning it passed the culling tests in the previous frame.
             //! This flag must be manually cleared by the Cullable object every frame.
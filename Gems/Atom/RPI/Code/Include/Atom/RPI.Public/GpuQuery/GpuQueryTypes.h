@@ -45,6 +45,11 @@ namespace AZ
             uint64_t GetDurationInNanoseconds() const;
             uint64_t GetDurationInTicks() const;
             uint64_t GetTimestampBeginInTicks() const;
+            //! The begin timestamp in the clock domain of the hardware queue, converted to nanoseconds.
+            //! Timestamps of passes that ran on the same queue can be compared to place them on a timeline.
+            uint64_t GetTimestampBeginInNanoseconds() const;
+            //! The hardware queue the timestamps were recorded on
+            RHI::HardwareQueueClass GetHardwareQueueClass() const;
 
             void Add(const TimestampResult& extent);
 
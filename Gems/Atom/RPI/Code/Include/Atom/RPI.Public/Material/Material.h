@@ -16,6 +16,8 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/std/containers/span.h>
+
 namespace AZ
 {
     namespace RHI
@@ -94,6 +96,14 @@ namespace AZ
             //! Does nothing if NeedsCompile() is false or CanCompile() is false.
             //! @return whether compilation occurred
             bool Compile();
+
+            //! Compiles a batch of materials like Compile() does, but only processes the property connections and material functors
+            //! once for each set of materials that share a material asset, property values and shader options. The other materials
+            //! of a set copy the compiled shader resource group data and the resolved shader options of the first one, so updating
+            //! the same properties on many materials doesn't resolve the same shader variants over and over.
+            //! Materials that don't need to compile, or can't compile yet, are skipped.
+            //! @return the number of materials that were compiled
+            static uint32_t CompileBatch(AZStd::span<const Data::Instance<Material>> materials);
             
             //! Returns an ID that can be used to track whether the material has changed since the last time client code read it.
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
@@ -191,6 +201,15 @@ namespace AZ
             void ProcessInternalDirectConnections();
             void ProcessInternalMaterialFunctors();
 
+            //! Returns a hash of everything HasSameCompileInputs() compares, used by CompileBatch() to group the materials
+            HashValue64 GetCompileInputsHash() const;
+
+            //! Returns whether compiling this material and the other one would produce the same result
+            bool HasSameCompileInputs(const Material& other) const;
+
+            //! Takes over the compiled state of a material that HasSameCompileInputs() matched, instead of compiling
+            void CopyCompiledState(const Material& other);
+
             // Note we can't overload the ForAllShaderItems name, because the compiler fails to resolve the public
             // version of the function when a private overload is present, just based on a lambda signature.
             void ForAllShaderItemsWriteable(AZStd::function<bool(ShaderCollection::Item& shaderItem)> callback);
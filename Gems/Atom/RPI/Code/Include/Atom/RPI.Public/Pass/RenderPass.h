@@ -107,12 +107,19 @@ namespace AZ
             // Add the ScopeQuery's QueryPool to the FrameGraph
             void AddScopeQueryToFrameGraph(RHI::FrameGraphInterface frameGraph);
 
+            // Selects the hardware queue the pass's scope runs on this frame. Passes that request an async queue run on the
+            // graphics queue instead when async queues are disabled, or when one of their attachments can't be used on that queue.
+            void DeclareHardwareQueueClassToFrameGraph(RHI::FrameGraphInterface frameGraph);
+
             // The shader resource group for this pass
             Data::Instance<ShaderResourceGroup> m_shaderResourceGroup = nullptr;
 
             // Determines which hardware queue the pass will run on
             RHI::HardwareQueueClass m_hardwareQueueClass = RHI::HardwareQueueClass::Graphics;
 
+            // The hardware queue the pass's scope was scheduled on this frame, see DeclareHardwareQueueClassToFrameGraph
+            RHI::HardwareQueueClass m_scopeHardwareQueueClass = RHI::HardwareQueueClass::Graphics;
+
         private:
             // Helper function that binds a single attachment to the pass shader resource group
             void BindAttachment(const RHI::FrameGraphCompileContext& context, PassAttachmentBinding& binding, int16_t& imageIndex, int16_t& bufferIndex);
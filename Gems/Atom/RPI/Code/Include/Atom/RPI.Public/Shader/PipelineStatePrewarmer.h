@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/Base.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateUsageLog.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/API/ApplicationAPI.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class PipelineStateDescriptor;
+    }
+
+    namespace RPI
+    {
+        class Shader;
+        class ShaderVariant;
+
+        //! Records the pipeline states that are used during a play through and compiles recorded pipeline states ahead of
+        //! time, so they don't have to be compiled on demand while rendering, which causes hitches.
+        //!
+        //! Recording is meant for QA play throughs. While recording, every pipeline state that's acquired from a shader is added
+        //! to the log once. The log is saved as an .azasset, which can be added to the project to be shipped as a product asset.
+        //!
+        //! When prewarming, the logged pipeline states are compiled on low priority jobs, a few at a time so rendering isn't
+        //! starved for worker threads. Entries wait until their shader and shader variant have loaded. The log configured in
+        //! the settings registry at /O3DE/Atom/RPI/PipelineStatePrewarmer/UsageLog is prewarmed whenever a level starts loading.
+        class PipelineStatePrewarmer final
+            : private TickBus::Handler
+            , private AzFramework::LevelSystemLifecycleNotificationBus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PipelineStatePrewarmer, SystemAllocator);
+
+            //! The default path the recording is saved to.
+            static constexpr const char* DefaultRecordingPath = "@user@/Atom/PipelineStateUsage.azasset";
+
+            void Init();
+            void Shutdown();
+
+            //! Starts recording the pipeline states that are acquired. Any previous recording is discarded.
+            void StartRecording();
+
+            //! Stops recording and returns the recorded pipeline states.
+            PipelineStateUsageLog StopRecording();
+
+            //! Stops recording and saves the recorded pipeline states to the file.
+            bool SaveRecording(const AZStd::string& filePath);
+
+            bool IsRecording() const;
+
+            //! Adds the pipeline state to the recording if it isn't recorded yet. Called by Shader while recording.
+            void RecordPipelineState(const Shader& shader, const ShaderVariant& variant, const RHI::PipelineStateDescriptor& descriptor);
+
+            //! Queues the pipeline states in the log to be compiled ahead of time.
+            void Prewarm(const PipelineStateUsageLog& log);
+
+            //! Loads the log from the product asset and queues its pipeline states to be compiled ahead of time.
+            bool Prewarm(const char* productPath);
+
+            //! Returns true while there are logged pipeline states left to compile.
+            bool IsPrewarming() const;
+
+        private:
+            struct PendingEntry
+            {
+                PipelineStateUsageEntry m_entry;
+                Data::Asset<ShaderAsset> m_shaderAsset;
+                //! The number of ticks the entry has been waiting for its shader variant to load.
+                uint32_t m_waitedTicks = 0;
+            };
+
+            //! Returns true when the entry has been processed and can be removed, either because its compilation was started or
+            //! because it can't be compiled.
+            bool ProcessEntry(PendingEntry& pendingEntry);
+            void CompileAsync(Data::Instance<Shader> shader, AZStd::shared_ptr<RHI::PipelineStateDescriptor> descriptor);
+            void WaitForCompilations();
+
+            // TickBus overrides...
+            void OnTick(float deltaTime, ScriptTimePoint time) override;
+            int GetTickOrder() override;
+
+            // LevelSystemLifecycleNotificationBus overrides...
+            void OnLoadingStart(const char* levelName) override;
+
+            AZStd::deque<PendingEntry> m_pendingEntries;
+            AZStd::atomic_uint32_t m_compilingCount = { 0 };
+
+            mutable AZStd::mutex m_recordingMutex;
+            PipelineStateUsageLog m_recording;
+            AZStd::unordered_set<HashValue64> m_recordedPipelineStates;
+            AZStd::atomic_bool m_isRecording = { false };
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -105,6 +105,10 @@ namespace AZ
             //! Returns the root variant.
             const ShaderVariant& GetRootVariant();
 
+            //! Returns how many times GetVariant() returned the root variant, of any shader, because the requested variant
+            //! wasn't loaded yet, and resets that count. Called once per frame to report the fallback draws.
+            static uint32_t ResetRootVariantFallbackCount();
+
             //! Returns the closest variant that uses the default shader option values.
             //! This could return the root variant or a fallback variant if there is no variant baked for that combination of option values.
             const ShaderVariant& GetDefaultVariant();
@@ -124,6 +128,10 @@ namespace AZ
             //! Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            //! Compiles the pipeline state ahead of time, so a later AcquirePipelineState with the same descriptor doesn't have to.
+            //! This is used by the PipelineStatePrewarmer, which calls it from low priority jobs.
+            const RHI::PipelineState* PrecompilePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
+
             //! Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const RHI::Ptr<RHI::ShaderResourceGroupLayout>& FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const;
 
@@ -173,6 +181,9 @@ namespace AZ
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
+            //! Returns the loaded variant the pipeline state descriptor was configured with, or null if none is found.
+            const ShaderVariant* FindVariantForPipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
+
             // AssetBus overrides...
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
 
@@ -197,7 +208,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
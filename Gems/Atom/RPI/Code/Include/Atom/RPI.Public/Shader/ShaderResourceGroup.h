@@ -72,6 +72,10 @@ namespace AZ
             /// Returns whether the group is currently queued for compilation.
             bool IsQueuedForCompile() const;
 
+            /// Replaces all the constants and resources of this group with the ones of another group that has the same layout.
+            /// Every resource type is flagged for the next Compile(), so nothing of the previous data remains on the GPU.
+            void CopyShaderResourceGroupData(const ShaderResourceGroup& other);
+
             /// Finds the shader input index from the shader input name for each type of resource.
             RHI::ShaderInputBufferIndex    FindShaderInputBufferIndex(const Name& name) const;
             RHI::ShaderInputImageIndex     FindShaderInputImageIndex(const Name& name) const;
@@ -10,6 +10,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
 
@@ -43,12 +44,14 @@ namespace AZ
             void Connect(GlobalShaderOptionUpdatedEvent::Handler& handler) override;
             void SetSupervariantName(const AZ::Name& supervariantName) override;
             const AZ::Name& GetSupervariantName() const override;
+            PipelineStatePrewarmer& GetPipelineStatePrewarmer() override;
             ///////////////////////////////////////////////////////////////////
 
         private:
             AZStd::unordered_map<Name, ShaderOptionValue> m_globalShaderOptionValues;
             GlobalShaderOptionUpdatedEvent m_globalShaderOptionUpdatedEvent;
             ShaderVariantAsyncLoader m_shaderVariantAsyncLoader;
+            PipelineStatePrewarmer m_pipelineStatePrewarmer;
 
             //! The ShaderSystem supervariantName is used by the ShaderAsset to search for an additional supervariant permutation.
             //! This is done by appending the supervariantName set here to the user-specified supervariant name.
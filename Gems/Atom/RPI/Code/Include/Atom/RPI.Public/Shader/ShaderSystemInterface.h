@@ -16,6 +16,8 @@ namespace AZ
 {
     namespace RPI
     {
+        class PipelineStatePrewarmer;
+
         class ShaderSystemInterface
         {
         public:
@@ -49,6 +51,9 @@ namespace AZ
             //! Currently this is used for NoMSAA supervariant support.
             virtual void SetSupervariantName(const AZ::Name& supervariantName) = 0;
             virtual const AZ::Name& GetSupervariantName() const = 0;
+
+            //! Returns the system that records the pipeline states that are used and compiles recorded pipeline states ahead of time.
+            virtual PipelineStatePrewarmer& GetPipelineStatePrewarmer() = 0;
         };
 
     }   // namespace RPI
@@ -108,6 +108,10 @@ namespace AZ
             AZStd::mutex m_mutex;
             AZStd::condition_variable m_workCondition;
 
+            //! Set when a ShaderVariantTreeAsset is ready, so the service thread stops waiting between iterations
+            //! and resolves the variant requests that were waiting on that tree right away.
+            bool m_hasNewShaderVariantTree = false;
+
             //! This is a list of AssetId of ShaderVariantAsset.
             AZStd::vector<TupleShaderAssetAndShaderVariantId> m_newShaderVariantPendingRequests;
 
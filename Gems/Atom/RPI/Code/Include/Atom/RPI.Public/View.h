@@ -104,6 +104,12 @@ namespace AZ
             //! Returns the boolean | combination of all flags provided with ApplyFlags() since the last frame.
             uint32_t GetOrFlags() const;
 
+            //! Restricts the cullables that are added to the view by their Cullable::m_flags. Only cullables that have all of the
+            //! required flags and none of the excluded flags are added. Both are 0 by default, which adds every cullable.
+            void SetCullableFlagFilter(uint32_t requiredFlags, uint32_t excludedFlags);
+            uint32_t GetCullableRequiredFlags() const;
+            uint32_t GetCullableExcludedFlags() const;
+
             //! Sets the worldToView matrix and recalculates the other matrices.
             void SetWorldToViewMatrix(const AZ::Matrix4x4& worldToView);
 
@@ -190,7 +196,7 @@ namespace AZ
             View() = delete;
             View(const AZ::Name& name, UsageFlags usage);
 
-            //! Sorts the finalized draw lists in this view
+            //! Coalesces the per-thread draw lists of each draw list tag in this view and sorts them, one task per tag
             void SortFinalizedDrawListsJob(AZ::Job* parentJob);
             void SortFinalizedDrawListsTG(AZ::TaskGraphEvent& finalizeDrawListsTGEvent);
 
@@ -269,6 +275,9 @@ namespace AZ
             AZStd::atomic_uint32_t m_andFlags{ 0xFFFFFFFF };
             AZStd::atomic_uint32_t m_orFlags { 0x00000000 };
 
+            uint32_t m_cullableRequiredFlags = 0;
+            uint32_t m_cullableExcludedFlags = 0;
+
             // Get the render pipeline id associated with this view if used as a shadow light view.
             RenderPipelineId m_shadowPassRenderpipelineId;
         };
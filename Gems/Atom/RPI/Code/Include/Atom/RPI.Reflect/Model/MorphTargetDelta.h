@@ -23,8 +23,8 @@ namespace AZ::RPI
         constexpr float s_tangentSpaceDeltaMax = 2.0f;
     }
 
-    //! This class represents the data that is passed to the morph target compute shader for an individual delta
-    //! See MorphTargetSRG.azsli for the corresponding shader struct
+    //! This class represents the data that is stored in the model for an individual delta
+    //! The skinned mesh repacks it into blocks of deltas for the morph target compute shader, see MorphTargetInputBuffers.h
     //! It is 16-byte aligned to work with structured buffers
     //! Because AZSL does not support 16 or 8 bit integer types, the data is packed into 32 bit unsigned ints
     struct PackedCompressedMorphTargetDelta
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RPI
+    {
+        //! A pipeline state that was used while a PipelineStateUsageLog was recorded. It holds the shader variant and the
+        //! runtime state that's needed to recreate the pipeline state descriptor.
+        struct PipelineStateUsageEntry final
+        {
+            AZ_TYPE_INFO(PipelineStateUsageEntry, "{8C0F3A52-6B1E-4D97-A2C4-7E5D19B3F860}");
+            AZ_CLASS_ALLOCATOR(PipelineStateUsageEntry, SystemAllocator);
+
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            AZ::Name m_supervariantName;
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            // The remaining state only applies to draw pipeline states.
+            RHI::RenderStates m_renderStates;
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+        };
+
+        //! The pipeline states that were used during a play through, in the order they were first used.
+        //! A log is recorded during QA play throughs and saved as an .azasset, which is processed into an AnyAsset so it can
+        //! be shipped with the other product assets. PipelineStatePrewarmer compiles the logged pipeline states ahead of time.
+        struct PipelineStateUsageLog final
+        {
+            AZ_TYPE_INFO(PipelineStateUsageLog, "{2E7B94D1-C35A-4F08-9B6E-D4A1708C5F23}");
+            AZ_CLASS_ALLOCATOR(PipelineStateUsageLog, SystemAllocator);
+
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<PipelineStateUsageEntry> m_entries;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -18,8 +18,10 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/BoundingVolumeBatch.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -53,6 +55,9 @@ namespace AZ
         // Node work lists using node count
         AZ_CVAR(uint32_t, r_numNodesPerCullingJob, 25, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of nodes to collect for jobs when not using the entry count");
 
+        // Number of entries gathered into each struct-of-arrays batch for frustum testing
+        static constexpr size_t CullingBatchSize = 64;
+
         // This value dictates the amount to extrude the octree node OBB when doing a frustum intersection test against the camera frustum to help cut draw calls for shadow cascade passes.
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
@@ -259,7 +264,8 @@ namespace AZ
             }
 
             u32 m_entryCount = 0;
-            AZStd::vector<AzFramework::IVisibilityScene::NodeData> m_nodes;
+            // Worklists are consumed by the culling jobs of the frame they were built in
+            FrameVector<AzFramework::IVisibilityScene::NodeData> m_nodes;
         };
 
         // Used to accumulate VisibilityEntry into lists to be handed off to jobs for processing
@@ -285,34 +291,74 @@ namespace AZ
 #endif
             endIdx = (endIdx == -1) ? s32(entries.size()) : endIdx;
 
-            for (s32 i = startIdx; i < endIdx; ++i)
-            {
-                AzFramework::VisibilityEntry* visibleEntry = entries[i];
+            const bool testFrustum = !parentNodeContainedInFrustum;
+            const bool testExcludeFrustum = worklistData->m_hasExcludeFrustum;
+            const uint32_t requiredFlags = worklistData->m_view->GetCullableRequiredFlags();
+            const uint32_t excludedFlags = worklistData->m_view->GetCullableExcludedFlags();
+
+            // Candidates are gathered into a struct-of-arrays batch so they can be tested against the frustum planes several at a time
+            BoundingVolumeBatch batchVolumes(CullingBatchSize);
+            AZStd::array<AzFramework::VisibilityEntry*, CullingBatchSize> batchEntries;
+            AZStd::array<IntersectResult, CullingBatchSize> batchFrustumResults;
+            AZStd::array<bool, CullingBatchSize> batchAabbResults;
+            AZStd::array<IntersectResult, CullingBatchSize> batchExcludeResults;
 
-                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
-                    visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
+            for (s32 i = startIdx; i < endIdx;)
+            {
+                batchVolumes.Clear();
+                for (; i < endIdx && batchVolumes.GetSize() < CullingBatchSize; ++i)
                 {
-                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                    AzFramework::VisibilityEntry* visibleEntry = entries[i];
 
-                    if ((c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
-                        c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
-                        c->m_isHidden)
+                    if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable ||
+                        visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList)
                     {
-                        continue;
+                        Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+
+                        if ((c->m_cullData.m_drawListMask & worklistData->m_view->GetDrawListMask()).none() ||
+                            c->m_cullData.m_hideFlags & worklistData->m_view->GetUsageFlags() ||
+                            c->m_cullData.m_occludedInView == worklistData->m_view ||
+                            (c->m_flags & requiredFlags) != requiredFlags ||
+                            (c->m_flags & excludedFlags) != 0 ||
+                            c->m_isHidden)
+                        {
+                            continue;
+                        }
+
+                        batchEntries[batchVolumes.GetSize()] = visibleEntry;
+                        batchVolumes.PushBack(c->m_cullData.m_boundingSphere, visibleEntry->m_boundingVolume);
                     }
+                }
+
+                if (testFrustum)
+                {
+                    batchVolumes.ClassifySpheres(worklistData->m_frustum, batchFrustumResults.data());
+                    batchVolumes.OverlapsAabbs(worklistData->m_frustum, batchAabbResults.data());
+                }
+
+                if (testExcludeFrustum)
+                {
+                    batchVolumes.ClassifySpheres(worklistData->m_excludeFrustum, batchExcludeResults.data());
+                }
+
+                for (size_t batchIndex = 0; batchIndex < batchVolumes.GetSize(); ++batchIndex)
+                {
+                    AzFramework::VisibilityEntry* visibleEntry = batchEntries[batchIndex];
+                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-                    if (!parentNodeContainedInFrustum)
+                    if (testFrustum)
                     {
-                        IntersectResult res = ShapeIntersection::Classify(worklistData->m_frustum, c->m_cullData.m_boundingSphere);
-                        bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior || ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb));
+                        // The entry's Aabb is what places it in the octree, if it is outside the frustum so is the Obb it encloses
+                        IntersectResult res = batchFrustumResults[batchIndex];
+                        bool entryInFrustum = (res != IntersectResult::Exterior) && (res == IntersectResult::Interior ||
+                            (batchAabbResults[batchIndex] && ShapeIntersection::Overlaps(worklistData->m_frustum, c->m_cullData.m_boundingObb)));
                         if (!entryInFrustum)
                         {
                             continue;
                         }
                     }
 
-                    if (worklistData->m_hasExcludeFrustum &&
-                        ShapeIntersection::Classify(worklistData->m_excludeFrustum, c->m_cullData.m_boundingSphere) == IntersectResult::Interior)
+                    if (testExcludeFrustum && batchExcludeResults[batchIndex] == IntersectResult::Interior)
                     {
                         // Skip item contained in exclude frustum.
                         continue;
@@ -604,7 +650,7 @@ namespace AZ
             {
                 // frustum cull occlusion planes
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
-                AZStd::vector<VisibleOcclusionPlane> visibleOccluders;
+                FrameVector<VisibleOcclusionPlane> visibleOccluders;
                 visibleOccluders.reserve(m_occlusionPlanes.size());
                 for (const auto& occlusionPlane : m_occlusionPlanes)
                 {
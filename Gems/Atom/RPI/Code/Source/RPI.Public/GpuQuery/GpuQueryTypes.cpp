@@ -44,6 +44,20 @@ namespace AZ
             return m_begin;
         }
 
+        uint64_t TimestampResult::GetTimestampBeginInNanoseconds() const
+        {
+            const RHI::Ptr<RHI::Device> device = RHI::GetRHIDevice();
+            const AZStd::chrono::microseconds timeInMicroseconds = device->GpuTimestampToMicroseconds(m_begin, m_hardwareQueueClass);
+            const auto timeInNanoseconds = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(timeInMicroseconds);
+
+            return static_cast<uint64_t>(timeInNanoseconds.count());
+        }
+
+        RHI::HardwareQueueClass TimestampResult::GetHardwareQueueClass() const
+        {
+            return m_hardwareQueueClass;
+        }
+
         void TimestampResult::Add(const TimestampResult& extent)
         {
             uint64_t end1 = m_begin + m_duration;
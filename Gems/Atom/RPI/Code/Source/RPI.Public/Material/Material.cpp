@@ -24,10 +24,101 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AtomCore/Utils/ScopedValue.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/containers/unordered_map.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            // Must be consistent with MaterialPropertyValue::operator==, values that compare equal have to produce the same hash
+            HashValue64 HashPropertyValue(const MaterialPropertyValue& value, HashValue64 seed)
+            {
+                if (value.Is<bool>())
+                {
+                    return TypeHash64(value.GetValue<bool>(), seed);
+                }
+                if (value.Is<int32_t>())
+                {
+                    return TypeHash64(value.GetValue<int32_t>(), seed);
+                }
+                if (value.Is<uint32_t>())
+                {
+                    return TypeHash64(value.GetValue<uint32_t>(), seed);
+                }
+                if (value.Is<float>())
+                {
+                    return TypeHash64(value.GetValue<float>(), seed);
+                }
+                if (value.Is<Vector2>())
+                {
+                    const Vector2& vector = value.GetValue<Vector2>();
+                    const float components[] = { vector.GetX(), vector.GetY() };
+                    return TypeHash64(components, seed);
+                }
+                if (value.Is<Vector3>())
+                {
+                    const Vector3& vector = value.GetValue<Vector3>();
+                    const float components[] = { vector.GetX(), vector.GetY(), vector.GetZ() };
+                    return TypeHash64(components, seed);
+                }
+                if (value.Is<Vector4>())
+                {
+                    const Vector4& vector = value.GetValue<Vector4>();
+                    const float components[] = { vector.GetX(), vector.GetY(), vector.GetZ(), vector.GetW() };
+                    return TypeHash64(components, seed);
+                }
+                if (value.Is<Color>())
+                {
+                    const Color& color = value.GetValue<Color>();
+                    const float components[] = { color.GetR(), color.GetG(), color.GetB(), color.GetA() };
+                    return TypeHash64(components, seed);
+                }
+                if (value.Is<Data::Instance<Image>>())
+                {
+                    return TypeHash64(value.GetValue<Data::Instance<Image>>().get(), seed);
+                }
+                if (value.Is<AZStd::string>())
+                {
+                    return TypeHash64(value.GetValue<AZStd::string>().c_str(), seed);
+                }
+                // Image assets and empty values only contribute their type, the exact comparison tells them apart
+                return TypeHash64(value.GetTypeId(), seed);
+            }
+
+            bool ShaderCollectionStatesMatch(const ShaderCollection& shaderCollection, const ShaderCollection& otherShaderCollection)
+            {
+                if (shaderCollection.size() != otherShaderCollection.size())
+                {
+                    return false;
+                }
+
+                for (size_t i = 0; i < shaderCollection.size(); ++i)
+                {
+                    const ShaderCollection::Item& item = shaderCollection[i];
+                    const ShaderCollection::Item& otherItem = otherShaderCollection[i];
+                    if (item.GetShaderAssetId() != otherItem.GetShaderAssetId() || item.IsEnabled() != otherItem.IsEnabled() ||
+                        !(item.GetShaderVariantId() == otherItem.GetShaderVariantId()) ||
+                        item.GetDrawListTagOverride() != otherItem.GetDrawListTagOverride())
+                    {
+                        return false;
+                    }
+
+                    const RHI::RenderStates* renderStates = item.GetRenderStatesOverlay();
+                    const RHI::RenderStates* otherRenderStates = otherItem.GetRenderStatesOverlay();
+                    if ((renderStates == nullptr) != (otherRenderStates == nullptr) ||
+                        (renderStates && renderStates->GetHash() != otherRenderStates->GetHash()))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        } // namespace
+
         const char* Material::s_debugTraceName = "Material";
 
         Data::Instance<Material> Material::FindOrCreate(const Data::Asset<MaterialAsset>& materialAsset)
@@ -660,6 +751,131 @@ namespace AZ
             return false;
         }
 
+        uint32_t Material::CompileBatch(AZStd::span<const Data::Instance<Material>> materials)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            // The materials are grouped before any of them is compiled, since compiling changes the shader options that are
+            // compared. Materials with the same hash are compared exactly, since different inputs can share a hash.
+            struct MaterialSet
+            {
+                Material* m_leader = nullptr;
+                AZStd::vector<Material*> m_followers;
+            };
+            AZStd::vector<MaterialSet> materialSets;
+            AZStd::unordered_map<HashValue64, AZStd::vector<size_t>> materialSetsByHash;
+            for (const Data::Instance<Material>& material : materials)
+            {
+                if (!material || !material->NeedsCompile() || !material->CanCompile())
+                {
+                    continue;
+                }
+
+                AZStd::vector<size_t>& setsWithSameHash = materialSetsByHash[material->GetCompileInputsHash()];
+                auto setIter = AZStd::find_if(
+                    setsWithSameHash.begin(), setsWithSameHash.end(),
+                    [&material, &materialSets](size_t setIndex)
+                    {
+                        const Material* leader = materialSets[setIndex].m_leader;
+                        return leader == material.get() || material->HasSameCompileInputs(*leader);
+                    });
+
+                if (setIter == setsWithSameHash.end())
+                {
+                    setsWithSameHash.push_back(materialSets.size());
+                    materialSets.push_back({ material.get(), {} });
+                }
+                else if (materialSets[*setIter].m_leader != material.get())
+                {
+                    MaterialSet& materialSet = materialSets[*setIter];
+                    if (AZStd::find(materialSet.m_followers.begin(), materialSet.m_followers.end(), material.get()) == materialSet.m_followers.end())
+                    {
+                        materialSet.m_followers.push_back(material.get());
+                    }
+                }
+            }
+
+            // The leader of each set is compiled normally and the rest of the set copies its result
+            uint32_t compiledCount = 0;
+            for (const MaterialSet& materialSet : materialSets)
+            {
+                if (!materialSet.m_leader->Compile())
+                {
+                    continue;
+                }
+
+                for (Material* follower : materialSet.m_followers)
+                {
+                    follower->CopyCompiledState(*materialSet.m_leader);
+                }
+                compiledCount += 1 + aznumeric_cast<uint32_t>(materialSet.m_followers.size());
+            }
+            return compiledCount;
+        }
+
+        HashValue64 Material::GetCompileInputsHash() const
+        {
+            HashValue64 hash = TypeHash64(m_materialAsset.GetId().m_guid, HashValue64{ 0 });
+            hash = TypeHash64(m_materialAsset.GetId().m_subId, hash);
+            for (const MaterialPropertyValue& value : m_materialProperties.GetPropertyValues())
+            {
+                hash = HashPropertyValue(value, hash);
+            }
+
+            // Materials usually differ by their properties, so the shader options only add the variant keys of the general shaders
+            for (const ShaderCollection::Item& shaderItem : m_generalShaderCollection)
+            {
+                const ShaderVariantId& variantId = shaderItem.GetShaderVariantId();
+                hash = TypeHash64(
+                    reinterpret_cast<const uint8_t*>(variantId.m_key.data()), variantId.m_key.num_words() * sizeof(*variantId.m_key.data()), hash);
+            }
+            return hash;
+        }
+
+        bool Material::HasSameCompileInputs(const Material& other) const
+        {
+            if (m_materialAsset.GetId() != other.m_materialAsset.GetId() || m_psoHandling != other.m_psoHandling ||
+                (m_shaderResourceGroup == nullptr) != (other.m_shaderResourceGroup == nullptr) ||
+                (m_shaderResourceGroup && m_shaderResourceGroup->GetLayout() != other.m_shaderResourceGroup->GetLayout()) ||
+                m_materialProperties.GetPropertyValues() != other.m_materialProperties.GetPropertyValues() ||
+                !ShaderCollectionStatesMatch(m_generalShaderCollection, other.m_generalShaderCollection) ||
+                m_materialPipelineData.size() != other.m_materialPipelineData.size())
+            {
+                return false;
+            }
+
+            for (const auto& [materialPipelineName, materialPipeline] : m_materialPipelineData)
+            {
+                auto otherPipelineIter = other.m_materialPipelineData.find(materialPipelineName);
+                if (otherPipelineIter == other.m_materialPipelineData.end() ||
+                    materialPipeline.m_materialProperties.GetPropertyValues() != otherPipelineIter->second.m_materialProperties.GetPropertyValues() ||
+                    !ShaderCollectionStatesMatch(materialPipeline.m_shaderCollection, otherPipelineIter->second.m_shaderCollection))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void Material::CopyCompiledState(const Material& other)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            // The shader collections hold the shader options the other material resolved, and the material pipeline data also
+            // holds the internal properties its functors wrote
+            m_generalShaderCollection = other.m_generalShaderCollection;
+            m_materialPipelineData = other.m_materialPipelineData;
+            m_materialProperties.ClearAllPropertyDirtyFlags();
+
+            if (m_shaderResourceGroup)
+            {
+                m_shaderResourceGroup->CopyShaderResourceGroupData(*other.m_shaderResourceGroup);
+                m_shaderResourceGroup->Compile();
+            }
+
+            m_compiledChangeId = m_currentChangeId;
+        }
+
         Material::ChangeId Material::GetCurrentChangeId() const
         {
             return m_currentChangeId;
@@ -27,10 +27,15 @@
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_asyncQueuePasses, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Allow passes that request the async compute or copy queue to run on it. When disabled they run on the graphics queue.");
+
         RenderPass::RenderPass(const PassDescriptor& descriptor)
             : Pass(descriptor)
         {
@@ -212,6 +217,7 @@ namespace AZ
 
         void RenderPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
+            DeclareHardwareQueueClassToFrameGraph(frameGraph);
             DeclareAttachmentsToFrameGraph(frameGraph);
             DeclarePassDependenciesToFrameGraph(frameGraph);
             AddScopeQueryToFrameGraph(frameGraph);
@@ -224,6 +230,41 @@ namespace AZ
             EndScopeQuery(context);
         }
 
+        void RenderPass::DeclareHardwareQueueClassToFrameGraph(RHI::FrameGraphInterface frameGraph)
+        {
+            m_scopeHardwareQueueClass = m_hardwareQueueClass;
+            if (m_hardwareQueueClass == RHI::HardwareQueueClass::Graphics)
+            {
+                return;
+            }
+
+            if (!r_asyncQueuePasses)
+            {
+                m_scopeHardwareQueueClass = RHI::HardwareQueueClass::Graphics;
+            }
+            else
+            {
+                // The attachments are declared after this, so every one of them has to support the requested queue
+                const RHI::HardwareQueueClassMask queueMask = RHI::GetHardwareQueueClassMask(m_hardwareQueueClass);
+                for (const PassAttachmentBinding& attachmentBinding : m_attachmentBindings)
+                {
+                    const PassAttachment* attachment = attachmentBinding.GetAttachment().get();
+                    const RHI::FrameAttachment* frameAttachment =
+                        attachment ? frameGraph.GetAttachmentDatabase().FindAttachment(attachment->GetAttachmentId()) : nullptr;
+                    if (frameAttachment && !RHI::CheckBitsAll(frameAttachment->GetSupportedQueueMask(), queueMask))
+                    {
+                        AZ_WarningOnce("RenderPass", false, "Pass '%s' runs on the graphics queue, attachment '%s' doesn't support the %s queue.",
+                            GetPathName().GetCStr(), attachment->GetAttachmentId().GetCStr(), RHI::GetHardwareQueueClassName(m_hardwareQueueClass));
+                        m_scopeHardwareQueueClass = RHI::HardwareQueueClass::Graphics;
+                        break;
+                    }
+                }
+            }
+
+            // The scope keeps the queue it was initialized with, so it's set again every frame in case it changed
+            frameGraph.SetHardwareQueueClass(m_scopeHardwareQueueClass);
+        }
+
         void RenderPass::DeclareAttachmentsToFrameGraph(RHI::FrameGraphInterface frameGraph) const
         {
             for (const PassAttachmentBinding& attachmentBinding : m_attachmentBindings)
@@ -567,7 +608,7 @@ namespace AZ
                 const uint32_t TimestampResultQueryCount = 2u;
                 uint64_t timestampResult[TimestampResultQueryCount] = {0};
                 query->GetLatestResult(&timestampResult, sizeof(uint64_t) * TimestampResultQueryCount);
-                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], RHI::HardwareQueueClass::Graphics);
+                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], m_scopeHardwareQueueClass);
             });
 
             ExecuteOnPipelineStatisticsQuery([this](RHI::Ptr<Query> query)
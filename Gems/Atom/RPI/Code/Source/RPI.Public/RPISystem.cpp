@@ -26,6 +26,7 @@
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/View.h>
 #include <Atom/RPI.Public/Pass/PassFactory.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/Device.h>
@@ -336,6 +337,9 @@ namespace AZ
                 scenePtr->PrepareRender(m_prepareRenderJobPolicy, m_currentSimulationTime);
             }
 
+            // The root variants used while the requested variants load are usually much slower on the GPU
+            AZ_PROFILE_DATAPOINT(RPI, Shader::ResetRootVariantFallbackCount(), L"RPI/Shader/RootVariantFallbacks");
+
             //Collect all the active pipelines running in this frame.
             uint16_t numActiveRenderPipelines = 0;
             for (auto& scenePtr : m_scenes)
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderVariant.h>
+
+#include <Atom/RHI/PipelineStateDescriptor.h>
+#include <Atom/RPI.Reflect/Asset/AssetUtils.h>
+#include <Atom/RPI.Reflect/System/AnyAsset.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(uint32_t, r_pipelineStatePrewarmMaxCompiles, 2, nullptr, ConsoleFunctorFlags::Null,
+            "The maximum number of pipeline states that are prewarmed at the same time.");
+
+        AZ_CVAR(uint32_t, r_pipelineStatePrewarmMaxWaitTicks, 600, nullptr, ConsoleFunctorFlags::Null,
+            "The maximum number of ticks a logged pipeline state waits for its shader variant to load before it's skipped.");
+
+        namespace
+        {
+            const char* PipelineStateUsageLogSetting = "/O3DE/Atom/RPI/PipelineStatePrewarmer/UsageLog";
+
+            PipelineStatePrewarmer* GetPipelineStatePrewarmer()
+            {
+                ShaderSystemInterface* shaderSystem = ShaderSystemInterface::Get();
+                return shaderSystem ? &shaderSystem->GetPipelineStatePrewarmer() : nullptr;
+            }
+
+            void r_pipelineStateUsageRecord([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+            {
+                if (PipelineStatePrewarmer* prewarmer = GetPipelineStatePrewarmer())
+                {
+                    prewarmer->StartRecording();
+                }
+            }
+
+            void r_pipelineStateUsageSave(const AZ::ConsoleCommandContainer& arguments)
+            {
+                if (PipelineStatePrewarmer* prewarmer = GetPipelineStatePrewarmer())
+                {
+                    AZStd::string filePath = arguments.empty() ? PipelineStatePrewarmer::DefaultRecordingPath : AZStd::string(arguments[0]);
+                    prewarmer->SaveRecording(filePath);
+                }
+            }
+
+            void r_pipelineStatePrewarm(const AZ::ConsoleCommandContainer& arguments)
+            {
+                if (arguments.empty())
+                {
+                    AZ_Warning("PipelineStatePrewarmer", false, "r_pipelineStatePrewarm requires the product path of a pipeline state usage log.");
+                    return;
+                }
+                if (PipelineStatePrewarmer* prewarmer = GetPipelineStatePrewarmer())
+                {
+                    prewarmer->Prewarm(AZStd::string(arguments[0]).c_str());
+                }
+            }
+        } // namespace
+
+        AZ_CONSOLEFREEFUNC(r_pipelineStateUsageRecord, ConsoleFunctorFlags::Null,
+            "Starts recording the pipeline states that are used, for instance during a QA play through.");
+        AZ_CONSOLEFREEFUNC(r_pipelineStateUsageSave, ConsoleFunctorFlags::Null,
+            "Stops recording the pipeline states and saves them to the given path, or to @user@/Atom/PipelineStateUsage.azasset.");
+        AZ_CONSOLEFREEFUNC(r_pipelineStatePrewarm, ConsoleFunctorFlags::Null,
+            "Compiles the pipeline states in the pipeline state usage log with the given product path ahead of time.");
+
+        void PipelineStatePrewarmer::Init()
+        {
+            AzFramework::LevelSystemLifecycleNotificationBus::Handler::BusConnect();
+        }
+
+        void PipelineStatePrewarmer::Shutdown()
+        {
+            AzFramework::LevelSystemLifecycleNotificationBus::Handler::BusDisconnect();
+            TickBus::Handler::BusDisconnect();
+            m_pendingEntries.clear();
+            WaitForCompilations();
+
+            AZStd::scoped_lock lock(m_recordingMutex);
+            m_isRecording = false;
+            m_recording.m_entries.clear();
+            m_recordedPipelineStates.clear();
+        }
+
+        void PipelineStatePrewarmer::StartRecording()
+        {
+            AZStd::scoped_lock lock(m_recordingMutex);
+            m_recording.m_entries.clear();
+            m_recordedPipelineStates.clear();
+            m_isRecording = true;
+        }
+
+        PipelineStateUsageLog PipelineStatePrewarmer::StopRecording()
+        {
+            AZStd::scoped_lock lock(m_recordingMutex);
+            m_isRecording = false;
+            m_recordedPipelineStates.clear();
+            return AZStd::move(m_recording);
+        }
+
+        bool PipelineStatePrewarmer::SaveRecording(const AZStd::string& filePath)
+        {
+            PipelineStateUsageLog log = StopRecording();
+            auto saveResult = JsonSerializationUtils::SaveObjectToFile(&log, filePath);
+            if (!saveResult.IsSuccess())
+            {
+                AZ_Error("PipelineStatePrewarmer", false, "Failed to save the pipeline state usage log to '%s': %s",
+                    filePath.c_str(), saveResult.GetError().c_str());
+                return false;
+            }
+
+            AZ_TracePrintf("PipelineStatePrewarmer", "Saved %zu pipeline states to '%s'.\n", log.m_entries.size(), filePath.c_str());
+            return true;
+        }
+
+        bool PipelineStatePrewarmer::IsRecording() const
+        {
+            return m_isRecording;
+        }
+
+        void PipelineStatePrewarmer::RecordPipelineState(
+            const Shader& shader, const ShaderVariant& variant, const RHI::PipelineStateDescriptor& descriptor)
+        {
+            AZStd::scoped_lock lock(m_recordingMutex);
+            if (!m_isRecording || !m_recordedPipelineStates.insert(descriptor.GetHash()).second)
+            {
+                return;
+            }
+
+            PipelineStateUsageEntry& entry = m_recording.m_entries.emplace_back();
+            entry.m_shaderAssetId = shader.GetAsset().GetId();
+            entry.m_supervariantName = shader.GetAsset()->GetSupervariantName(shader.GetSupervariantIndex());
+            entry.m_shaderVariantStableId = variant.GetStableId();
+            if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                entry.m_renderStates = descriptorForDraw.m_renderStates;
+                entry.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                entry.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+            }
+        }
+
+        void PipelineStatePrewarmer::Prewarm(const PipelineStateUsageLog& log)
+        {
+            for (const PipelineStateUsageEntry& entry : log.m_entries)
+            {
+                PendingEntry& pendingEntry = m_pendingEntries.emplace_back();
+                pendingEntry.m_entry = entry;
+                pendingEntry.m_shaderAsset =
+                    Data::AssetManager::Instance().GetAsset<ShaderAsset>(entry.m_shaderAssetId, Data::AssetLoadBehavior::PreLoad);
+            }
+
+            if (!m_pendingEntries.empty())
+            {
+                TickBus::Handler::BusConnect();
+            }
+        }
+
+        bool PipelineStatePrewarmer::Prewarm(const char* productPath)
+        {
+            Data::Asset<AnyAsset> logAsset = AssetUtils::LoadAssetByProductPath<AnyAsset>(productPath, AssetUtils::TraceLevel::Warning);
+            if (!logAsset.IsReady())
+            {
+                return false;
+            }
+
+            const PipelineStateUsageLog* log = GetDataFromAnyAsset<PipelineStateUsageLog>(logAsset);
+            if (!log)
+            {
+                return false;
+            }
+
+            Prewarm(*log);
+            return true;
+        }
+
+        bool PipelineStatePrewarmer::IsPrewarming() const
+        {
+            return !m_pendingEntries.empty() || m_compilingCount > 0;
+        }
+
+        bool PipelineStatePrewarmer::ProcessEntry(PendingEntry& pendingEntry)
+        {
+            if (pendingEntry.m_shaderAsset.IsError())
+            {
+                return true;
+            }
+            if (!pendingEntry.m_shaderAsset.IsReady())
+            {
+                return false;
+            }
+
+            Data::Instance<Shader> shader = Shader::FindOrCreate(pendingEntry.m_shaderAsset, pendingEntry.m_entry.m_supervariantName);
+            if (!shader)
+            {
+                return true;
+            }
+
+            // Requesting the variant queues it to be loaded if it isn't yet. Until then the root variant is returned.
+            const ShaderVariant& variant = shader->GetVariant(pendingEntry.m_entry.m_shaderVariantStableId);
+            if (variant.GetStableId() != pendingEntry.m_entry.m_shaderVariantStableId)
+            {
+                return ++pendingEntry.m_waitedTicks > r_pipelineStatePrewarmMaxWaitTicks;
+            }
+
+            AZStd::shared_ptr<RHI::PipelineStateDescriptor> descriptor;
+            switch (shader->GetPipelineStateType())
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                auto descriptorForDraw = AZStd::make_shared<RHI::PipelineStateDescriptorForDraw>();
+                variant.ConfigurePipelineState(*descriptorForDraw);
+                descriptorForDraw->m_renderStates = pendingEntry.m_entry.m_renderStates;
+                descriptorForDraw->m_inputStreamLayout = pendingEntry.m_entry.m_inputStreamLayout;
+                descriptorForDraw->m_renderAttachmentConfiguration = pendingEntry.m_entry.m_renderAttachmentConfiguration;
+                descriptor = AZStd::move(descriptorForDraw);
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+            {
+                auto descriptorForDispatch = AZStd::make_shared<RHI::PipelineStateDescriptorForDispatch>();
+                variant.ConfigurePipelineState(*descriptorForDispatch);
+                descriptor = AZStd::move(descriptorForDispatch);
+                break;
+            }
+            default:
+                // Ray tracing pipeline states aren't recorded.
+                return true;
+            }
+
+            CompileAsync(AZStd::move(shader), AZStd::move(descriptor));
+            return true;
+        }
+
+        void PipelineStatePrewarmer::CompileAsync(Data::Instance<Shader> shader, AZStd::shared_ptr<RHI::PipelineStateDescriptor> descriptor)
+        {
+            ++m_compilingCount;
+            auto compile = [this, shader, descriptor]() mutable
+            {
+                shader->PrecompilePipelineState(*descriptor);
+                // Release the shader before signaling completion, so Shutdown doesn't return while a shader is still referenced.
+                shader = nullptr;
+                --m_compilingCount;
+            };
+
+            auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+            {
+                static const AZ::TaskDescriptor prewarmTaskDescriptor{ "RPI::PipelineStatePrewarmer::Compile", "Graphics", AZ::TaskPriority::LOW };
+                AZ::TaskGraph prewarmTaskGraph{ "RPI::PipelineStatePrewarmer" };
+                prewarmTaskGraph.AddTask(prewarmTaskDescriptor, AZStd::move(compile));
+                prewarmTaskGraph.Detach();
+                prewarmTaskGraph.Submit();
+            }
+            else
+            {
+                AZ::Job* job = AZ::CreateJobFunction(AZStd::move(compile), true);
+                job->Start();
+            }
+        }
+
+        void PipelineStatePrewarmer::WaitForCompilations()
+        {
+            while (m_compilingCount > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
+        void PipelineStatePrewarmer::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] ScriptTimePoint time)
+        {
+            for (auto it = m_pendingEntries.begin(); it != m_pendingEntries.end() && m_compilingCount < r_pipelineStatePrewarmMaxCompiles;)
+            {
+                if (ProcessEntry(*it))
+                {
+                    it = m_pendingEntries.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+
+            if (m_pendingEntries.empty())
+            {
+                TickBus::Handler::BusDisconnect();
+            }
+        }
+
+        int PipelineStatePrewarmer::GetTickOrder()
+        {
+            return TICK_LAST;
+        }
+
+        void PipelineStatePrewarmer::OnLoadingStart([[maybe_unused]] const char* levelName)
+        {
+            AZStd::string productPath;
+            if (auto settingsRegistry = SettingsRegistry::Get();
+                settingsRegistry && settingsRegistry->Get(productPath, PipelineStateUsageLogSetting) && !productPath.empty())
+            {
+                Prewarm(productPath.c_str());
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -11,10 +11,12 @@
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <Atom/RPI.Public/Shader/PipelineStatePrewarmer.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/time.h>
 
 #include <AzCore/Component/TickBus.h>
@@ -25,6 +27,8 @@ namespace AZ
 {
     namespace RPI
     {
+        static AZStd::atomic<uint32_t> s_rootVariantFallbackCount{ 0 };
+
         Data::Instance<Shader> Shader::FindOrCreate(const Data::Asset<ShaderAsset>& shaderAsset, const Name& supervariantName)
         {
             auto anySupervariantName = AZStd::any(supervariantName);
@@ -337,7 +341,16 @@ namespace AZ
         const ShaderVariant& Shader::GetVariant(const ShaderVariantId& shaderVariantId)
         {
             Data::Asset<ShaderVariantAsset> shaderVariantAsset = m_asset->GetVariantAsset(shaderVariantId, m_supervariantIndex);
-            if (!shaderVariantAsset || shaderVariantAsset->IsRootVariant())
+            if (!shaderVariantAsset)
+            {
+                // The shader variant tree isn't loaded yet. A fully baked root variant is the final variant, not a fallback.
+                if (!m_rootVariant.IsFullyBaked())
+                {
+                    s_rootVariantFallbackCount.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+                return m_rootVariant;
+            }
+            if (shaderVariantAsset->IsRootVariant())
             {
                 return m_rootVariant;
             }
@@ -350,6 +363,11 @@ namespace AZ
             return m_rootVariant;
         }
 
+        uint32_t Shader::ResetRootVariantFallbackCount()
+        {
+            return s_rootVariantFallbackCount.exchange(0, AZStd::memory_order_relaxed);
+        }
+
         const ShaderVariant& Shader::GetDefaultVariant()
         {
             ShaderOptionGroup defaultOptions = GetDefaultShaderOptions();
@@ -405,6 +423,7 @@ namespace AZ
             if (!shaderVariantAsset || shaderVariantAsset == m_asset->GetRootVariantAsset())
             {
                 // Return the root variant when the requested variant is not ready.
+                s_rootVariantFallbackCount.fetch_add(1, AZStd::memory_order_relaxed);
                 return m_rootVariant;
             }
 
@@ -442,9 +461,68 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
+            if (ShaderSystemInterface* shaderSystem = ShaderSystemInterface::Get();
+                shaderSystem && shaderSystem->GetPipelineStatePrewarmer().IsRecording())
+            {
+                if (const ShaderVariant* variant = FindVariantForPipelineState(descriptor))
+                {
+                    shaderSystem->GetPipelineStatePrewarmer().RecordPipelineState(*this, *variant, descriptor);
+                }
+            }
+
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
         }
 
+        const RHI::PipelineState* Shader::PrecompilePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            return m_pipelineStateCache->PrecompilePipelineState(m_pipelineLibraryHandle, descriptor, m_asset->GetName());
+        }
+
+        const ShaderVariant* Shader::FindVariantForPipelineState(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            // Each variant has its own shader functions, so the variant can be identified by the function of its first stage.
+            RHI::ShaderStage stage;
+            const RHI::ShaderStageFunction* function = nullptr;
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                stage = RHI::ShaderStage::Vertex;
+                function = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+                break;
+            case RHI::PipelineStateType::Dispatch:
+                stage = RHI::ShaderStage::Compute;
+                function = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+                break;
+            default:
+                return nullptr;
+            }
+
+            if (!function)
+            {
+                return nullptr;
+            }
+
+            auto usesFunction = [stage, function](const ShaderVariant& variant)
+            {
+                return variant.GetShaderVariantAsset() && variant.GetShaderVariantAsset()->GetShaderStageFunction(stage) == function;
+            };
+
+            if (usesFunction(m_rootVariant))
+            {
+                return &m_rootVariant;
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& [stableId, variant] : m_shaderVariants)
+            {
+                if (usesFunction(variant))
+                {
+                    return &variant;
+                }
+            }
+            return nullptr;
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
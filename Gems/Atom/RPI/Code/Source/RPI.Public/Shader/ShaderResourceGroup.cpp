@@ -12,6 +12,8 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+
 namespace AZ
 {
     namespace RPI
@@ -140,6 +142,31 @@ namespace AZ
             return m_shaderResourceGroup->IsQueuedForCompile();
         }
 
+        void ShaderResourceGroup::CopyShaderResourceGroupData(const ShaderResourceGroup& other)
+        {
+            AZ_Assert(m_layout == other.m_layout, "Can only copy the data of a shader resource group with the same layout.");
+
+            m_data = other.m_data;
+            m_imageGroup = other.m_imageGroup;
+            m_bufferGroup = other.m_bufferGroup;
+
+            // The copied data only tracks the bytes that were modified in the other group, so all of the constants are rewritten
+            // to have them uploaded in full
+            const AZStd::span<const uint8_t> constantData = other.m_data.GetConstantData();
+            if (!constantData.empty())
+            {
+                m_data.SetConstantData(constantData.data(), aznumeric_cast<uint32_t>(constantData.size()));
+            }
+
+            using ResourceTypeMask = RHI::ShaderResourceGroupData::ResourceTypeMask;
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask);
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask);
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::BufferViewUnboundedArrayMask);
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::ImageViewUnboundedArrayMask);
+            m_data.EnableResourceTypeCompilation(ResourceTypeMask::SamplerMask);
+        }
+
         RHI::ShaderInputBufferIndex ShaderResourceGroup::FindShaderInputBufferIndex(const Name& name) const
         {
             return m_layout->FindShaderInputBufferIndex(name);
@@ -15,6 +15,7 @@
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateUsageLog.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
@@ -41,6 +42,7 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            PipelineStateUsageLog::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
@@ -89,10 +91,12 @@ namespace AZ
             }
 
             ShaderReloadDebugTracker::Init();
+            m_pipelineStatePrewarmer.Init();
         }
 
         void ShaderSystem::Shutdown()
         {
+            m_pipelineStatePrewarmer.Shutdown();
             ShaderReloadDebugTracker::Shutdown();
             Data::InstanceDatabase<Shader>::Destroy();
             Data::InstanceDatabase<ShaderResourceGroup>::Destroy();
@@ -156,6 +160,11 @@ namespace AZ
         {
             return m_supervariantName;
         }
+
+        PipelineStatePrewarmer& ShaderSystem::GetPipelineStatePrewarmer()
+        {
+            return m_pipelineStatePrewarmer;
+        }
         ///////////////////////////////////////////////////////////////////
 
     } // namespace RPI
@@ -200,7 +200,18 @@ namespace AZ
                 {
                     delay = AZStd::chrono::milliseconds{r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms};
                 }
-                AZStd::this_thread::sleep_for(delay);
+
+                // The delay throttles the retries of assets that aren't in the catalog yet, but a tree that just got ready
+                // unblocks the variant requests that were waiting on it, so those are resolved without waiting for the delay.
+                {
+                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                    m_workCondition.wait_for(lock, delay, [&]
+                        {
+                            return m_isServiceShutdown.load() || m_hasNewShaderVariantTree;
+                        }
+                    );
+                    m_hasNewShaderVariantTree = false;
+                }
             }
         }
 
@@ -226,6 +237,7 @@ namespace AZ
             m_shaderVariantData.clear();
             m_shaderAssetIdToShaderVariantTreeAssetId.clear();
             m_shaderVariantAssetIdToShaderVariantTreeAssetId.clear();
+            m_hasNewShaderVariantTree = false;
         }
 
 
@@ -449,6 +461,7 @@ namespace AZ
                     ShaderVariantCollection& shaderVariantCollection = findIt->second;
                     shaderAssetId = shaderVariantCollection.m_shaderAssetId;
                     shaderVariantCollection.m_shaderVariantTree = shaderVariantTreeAsset;
+                    m_hasNewShaderVariantTree = true;
                 }
                 else
                 {
@@ -457,6 +470,7 @@ namespace AZ
                     return;
                 }
             }
+            m_workCondition.notify_one();
 
             AZ::TickBus::QueueFunction([shaderAssetId, shaderVariantTreeAsset]()
                 {
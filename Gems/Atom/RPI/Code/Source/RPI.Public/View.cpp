@@ -166,6 +166,22 @@ namespace AZ
             return m_orFlags;
         }
 
+        void View::SetCullableFlagFilter(uint32_t requiredFlags, uint32_t excludedFlags)
+        {
+            m_cullableRequiredFlags = requiredFlags;
+            m_cullableExcludedFlags = excludedFlags;
+        }
+
+        uint32_t View::GetCullableRequiredFlags() const
+        {
+            return m_cullableRequiredFlags;
+        }
+
+        uint32_t View::GetCullableExcludedFlags() const
+        {
+            return m_cullableExcludedFlags;
+        }
+
         void View::UpdateViewToWorldMatrix(const AZ::Matrix4x4& viewToWorld)
         {
             m_viewToWorldMatrix = viewToWorld;
@@ -416,13 +432,11 @@ namespace AZ
         void View::FinalizeDrawListsTG(AZ::TaskGraphEvent& finalizeDrawListsTGEvent)
         {
             AZ_PROFILE_SCOPE(RPI, "View: FinalizeDrawLists");
-            m_drawListContext.FinalizeLists();
             SortFinalizedDrawListsTG(finalizeDrawListsTGEvent);
         }
         void View::FinalizeDrawListsJob(AZ::Job* parentJob)
         {
             AZ_PROFILE_SCOPE(RPI, "View: FinalizeDrawLists");
-            m_drawListContext.FinalizeLists();
             SortFinalizedDrawListsJob(parentJob);
         }
 
@@ -430,17 +444,22 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "View: SortFinalizedDrawLists");
             RHI::DrawListsByTag& drawListsByTag = m_drawListContext.GetMergedDrawListsByTag();
+            const RHI::DrawListMask pendingMask = m_drawListContext.BeginFinalizeLists();
 
             AZ::TaskGraph drawListSortTG{ "DrawList Sort" };
             AZ::TaskDescriptor drawListSortTGDescriptor{"RPI_View_SortFinalizedDrawLists", "Graphics"};
             for (size_t idx = 0; idx < drawListsByTag.size(); ++idx)
             {
-                if (drawListsByTag[idx].size() > 1)
+                if (pendingMask[idx])
                 {
                     drawListSortTG.AddTask(drawListSortTGDescriptor, [this, &drawListsByTag, idx]()
                     {
                         AZ_PROFILE_SCOPE(RPI, "View: SortDrawList Task");
-                        SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                        m_drawListContext.FinalizeList(RHI::DrawListTag(idx));
+                        if (drawListsByTag[idx].size() > 1)
+                        {
+                            SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                        }
                     });
                 }
             }
@@ -455,16 +474,21 @@ namespace AZ
         {
             AZ_PROFILE_SCOPE(RPI, "View: SortFinalizedDrawLists");
             RHI::DrawListsByTag& drawListsByTag = m_drawListContext.GetMergedDrawListsByTag();
+            const RHI::DrawListMask pendingMask = m_drawListContext.BeginFinalizeLists();
 
             AZ::JobCompletion jobCompletion;
             for (size_t idx = 0; idx < drawListsByTag.size(); ++idx)
             {
-                if (drawListsByTag[idx].size() > 1)
+                if (pendingMask[idx])
                 {
                     auto jobLambda = [this, &drawListsByTag, idx]()
                     {
                         AZ_PROFILE_SCOPE(RPI, "View: SortDrawList Job");
-                        SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                        m_drawListContext.FinalizeList(RHI::DrawListTag(idx));
+                        if (drawListsByTag[idx].size() > 1)
+                        {
+                            SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                        }
                     };
                     Job* jobSortDrawList = aznew JobFunction<decltype(jobLambda)>(jobLambda, true, nullptr); // Auto-deletes
                     if (parentJob)
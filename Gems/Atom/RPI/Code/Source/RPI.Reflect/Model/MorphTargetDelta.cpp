@@ -10,7 +10,7 @@
 
 namespace AZ::RPI
 {
-    static_assert(sizeof(PackedCompressedMorphTargetDelta) == 32, "The morph target compute shader expects a structured buffer that is exactly 32 bytes per element. If you change MorphTargetDelta, be sure to update MorphTargetSRG.azsli");
+    static_assert(sizeof(PackedCompressedMorphTargetDelta) == 32, "The skinned mesh expects morph target buffers that are exactly 32 bytes per element. If you change MorphTargetDelta, be sure to update SkinnedMeshInputLod::AddMorphTarget");
 
     PackedCompressedMorphTargetDelta PackMorphTargetDelta(const CompressedMorphTargetDelta& compressedDelta)
     {
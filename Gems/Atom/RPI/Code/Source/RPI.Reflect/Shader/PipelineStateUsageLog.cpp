@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Shader/PipelineStateUsageLog.h>
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void PipelineStateUsageEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateUsageEntry>()
+                    ->Version(0)
+                    ->Field("ShaderAssetId", &PipelineStateUsageEntry::m_shaderAssetId)
+                    ->Field("SupervariantName", &PipelineStateUsageEntry::m_supervariantName)
+                    ->Field("ShaderVariantStableId", &PipelineStateUsageEntry::m_shaderVariantStableId)
+                    ->Field("RenderStates", &PipelineStateUsageEntry::m_renderStates)
+                    ->Field("InputStreamLayout", &PipelineStateUsageEntry::m_inputStreamLayout)
+                    ->Field("RenderAttachmentConfiguration", &PipelineStateUsageEntry::m_renderAttachmentConfiguration)
+                    ;
+            }
+        }
+
+        void PipelineStateUsageLog::Reflect(ReflectContext* context)
+        {
+            PipelineStateUsageEntry::Reflect(context);
+
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateUsageLog>()
+                    ->Version(0)
+                    ->Field("Entries", &PipelineStateUsageLog::m_entries)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
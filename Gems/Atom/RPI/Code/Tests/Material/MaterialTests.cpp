@@ -442,6 +442,38 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.0f);
     }
 
+    TEST_F(MaterialTests, TestCompileBatch)
+    {
+        Data::Instance<Material> materials[] = {
+            Material::Create(m_testMaterialAsset), Material::Create(m_testMaterialAsset), Material::Create(m_testMaterialAsset) };
+
+        // The first two materials share their property values, so the second one copies the result of the first one
+        for (const Data::Instance<Material>& material : materials)
+        {
+            EXPECT_TRUE(material->SetPropertyValue<int32_t>(material->FindPropertyIndex(Name{ "MyInt" }), -5));
+        }
+        EXPECT_TRUE(materials[0]->SetPropertyValue<float>(materials[0]->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_TRUE(materials[1]->SetPropertyValue<float>(materials[1]->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_TRUE(materials[2]->SetPropertyValue<float>(materials[2]->FindPropertyIndex(Name{ "MyFloat" }), 4.0f));
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_EQ(Material::CompileBatch(materials), 3u);
+
+        const float expectedFloats[] = { 2.5f, 2.5f, 4.0f };
+        for (size_t i = 0; i < AZStd::size(materials); ++i)
+        {
+            EXPECT_FALSE(materials[i]->NeedsCompile());
+
+            const RHI::ShaderResourceGroupData& srgData = materials[i]->GetRHIShaderResourceGroup()->GetData();
+            EXPECT_EQ(srgData.GetConstant<int32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_int" })), -5);
+            EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), expectedFloats[i]);
+        }
+
+        // Materials that are already compiled are skipped
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        EXPECT_EQ(Material::CompileBatch(materials), 0u);
+    }
+
     TEST_F(MaterialTests, TestImageNotProvided)
     {
         Data::Asset<MaterialAsset> materialAssetWithEmptyImage;
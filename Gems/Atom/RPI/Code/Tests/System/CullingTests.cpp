@@ -255,4 +255,35 @@ namespace UnitTest
             m_cullingScene->UnregisterCullable(object);
         }
     }
+
+    TEST_F(CullingTests, CullableFlagFilterTest)
+    {
+        constexpr uint32_t TestFlag = 1 << 3;
+
+        // Flag one of the four objects visible by the first camera
+        m_testObjects[0].m_flags = TestFlag;
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->RegisterOrUpdateCullable(object);
+        }
+
+        TestCameraList views = { m_views[YPositive] };
+
+        views[0]->SetCullableFlagFilter(TestFlag, 0);
+        Cull(views);
+        EXPECT_EQ(views[0]->GetVisibleObjectList().size(), 1);
+
+        views[0]->SetCullableFlagFilter(0, TestFlag);
+        Cull(views);
+        EXPECT_EQ(views[0]->GetVisibleObjectList().size(), 3);
+
+        views[0]->SetCullableFlagFilter(0, 0);
+        Cull(views);
+        EXPECT_EQ(views[0]->GetVisibleObjectList().size(), 4);
+
+        for (Cullable& object : m_testObjects)
+        {
+            m_cullingScene->UnregisterCullable(object);
+        }
+    }
 }
@@ -93,6 +93,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Shader/ShaderVariantAsset.h
     Include/Atom/RPI.Reflect/Shader/IShaderVariantFinder.h
     Include/Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h
+    Include/Atom/RPI.Reflect/Shader/PipelineStateUsageLog.h
     Include/Atom/RPI.Reflect/System/AnyAsset.h
     Include/Atom/RPI.Reflect/System/AssetAliases.h
     Include/Atom/RPI.Reflect/System/PipelineRenderSettings.h
@@ -167,6 +168,7 @@ set(FILES
     Source/RPI.Reflect/Shader/ShaderVariantTreeAsset.cpp
     Source/RPI.Reflect/Shader/ShaderVariantAsset.cpp
     Source/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.cpp
+    Source/RPI.Reflect/Shader/PipelineStateUsageLog.cpp
     Source/RPI.Reflect/System/AnyAsset.cpp
     Source/RPI.Reflect/System/AssetAliases.cpp
     Source/RPI.Reflect/System/PipelineRenderSettings.cpp
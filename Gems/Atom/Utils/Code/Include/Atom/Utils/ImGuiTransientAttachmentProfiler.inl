@@ -203,6 +203,8 @@ namespace AZ
                             ImGui::Text("Size: %.1f MB", static_cast<double>(heapStats.m_heapSize * BytesToMB));
                             ImGui::Text("Watermark: %.1f MB", static_cast<double>(heapStats.m_watermarkSize * BytesToMB));
                             ImGui::Text("Waste: %.1f%%", (1.0 - static_cast<double>(heapStats.m_watermarkSize) / heapStats.m_heapSize) * 100.0);
+                            ImGui::Text("Peak live: %.1f MB", static_cast<double>(heapStats.m_peakLiveSize * BytesToMB));
+                            ImGui::Text("Placement: %s", heapStats.m_usesPlacementPlan ? "Packed" : "First-fit");
                             ImGui::EndTooltip();
                         }
                     }
@@ -636,6 +636,7 @@ namespace AZ
 
             // Add a pass to the pass grid which none of the pass's timestamp range won't overlap each other.
             // Search each row until the pass can be added to the end of row without overlap the previous one.
+            // Passes that ran on different hardware queues are kept in separate rows, since they can overlap in time.
             for (auto& passEntry : sortedPassEntries)
             {
                 auto row = sortedPassGrid.begin();
@@ -646,7 +647,8 @@ namespace AZ
                         break;
                     }
                     auto last = (*row).back();
-                    if (passEntry->m_timestampResult.GetTimestampBeginInTicks() >=
+                    if (last->m_timestampResult.GetHardwareQueueClass() == passEntry->m_timestampResult.GetHardwareQueueClass() &&
+                        passEntry->m_timestampResult.GetTimestampBeginInTicks() >=
                         last->m_timestampResult.GetTimestampBeginInTicks() + last->m_timestampResult.GetDurationInTicks())
                     {
                         row->push_back(passEntry);
@@ -765,14 +767,29 @@ namespace AZ
                                 ImGui::SetCursorPosX(buttonStartX);
                                 ImGui::SetCursorPosY(rowStartY);
 
-                                // Adds a button and the hover colors.
-                                ImGui::Button(passEntry->m_name.GetCStr(), ImVec2(buttonWidth, passBarHeight));
+                                // Adds a button and the hover colors. Passes that didn't run on the graphics queue are tinted.
+                                const RHI::HardwareQueueClass queueClass = passEntry->m_timestampResult.GetHardwareQueueClass();
+                                if (queueClass == RHI::HardwareQueueClass::Graphics)
+                                {
+                                    ImGui::Button(passEntry->m_name.GetCStr(), ImVec2(buttonWidth, passBarHeight));
+                                }
+                                else
+                                {
+                                    const ImVec4 queueColor = queueClass == RHI::HardwareQueueClass::Compute
+                                        ? ImVec4(0.8f, 0.45f, 0.1f, 0.8f)
+                                        : ImVec4(0.2f, 0.6f, 0.3f, 0.8f);
+                                    GpuProfilerImGuiHelper::PushStyleColor(ImGuiCol_Button, queueColor, [&]()
+                                    {
+                                        ImGui::Button(passEntry->m_name.GetCStr(), ImVec2(buttonWidth, passBarHeight));
+                                    });
+                                }
 
                                 if (ImGui::IsItemHovered())
                                 {
                                     ImGui::BeginTooltip();
                                     ImGui::Text("Name: %s", passEntry->m_name.GetCStr());
                                     ImGui::Text("Path: %s", passEntry->m_path.GetCStr());
+                                    ImGui::Text("Queue: %s", RHI::GetHardwareQueueClassName(queueClass));
                                     ImGui::Text("Duration in ticks: %llu", static_cast<AZ::u64>(passEntry->m_timestampResult.GetDurationInTicks()));
                                     ImGui::Text("Duration in microsecond: %.3f us", passEntry->m_timestampResult.GetDurationInNanoseconds()/1000.f);
                                     ImGui::EndTooltip();
@@ -100,6 +100,17 @@ namespace AZ
 
         FONT_TEXTURE_TYPE* GetBuffer() { return m_buffer; }
 
+        //! Gets the range of rows of the buffer written since the last ClearDirtyRows, so only those rows need uploading.
+        //! \return False if no rows were written.
+        bool GetDirtyRows(int& firstRow, int& endRow) const
+        {
+            firstRow = m_dirtyFirstRow;
+            endRow = m_dirtyEndRow;
+            return m_dirtyFirstRow < m_dirtyEndRow;
+        }
+        void MarkRowsDirty(int firstRow, int rowCount);
+        void ClearDirtyRows() { m_dirtyFirstRow = m_dirtyEndRow = 0; }
+
         uint32_t GetSlotChar(int slotIndex) const;
         TextureSlot* GetCharSlot(uint32_t character, const AtomFont::GlyphSize& glyphSize = AtomFont::defaultGlyphSize);
         TextureSlot* GetGradientSlot();
@@ -241,6 +252,9 @@ namespace AZ
 
         FONT_TEXTURE_TYPE*          m_buffer;                           // [y*width * x] x=0..width-1, y=0..height-1
 
+        int                         m_dirtyFirstRow = 0;                // first row of the buffer written since the last upload
+        int                         m_dirtyEndRow = 0;                  // one past the last row of the buffer written since the last upload
+
         uint16_t                    m_slotUsage;
     };
 }
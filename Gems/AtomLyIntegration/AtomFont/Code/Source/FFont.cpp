@@ -1446,6 +1446,10 @@ bool AZ::FFont::InitTexture()
     m_fontImage = m_fontAttachmentImage->GetRHIImage();
     m_fontImage->SetName(imageName);
 
+    // The new image has no contents yet, so the whole font texture gets uploaded on the next update
+    m_fontTexture->MarkRowsDirty(0, height);
+    m_fontTexDirty = true;
+
     m_fontImageVersion = 0;
     return true;
 }
@@ -1465,6 +1469,14 @@ bool AZ::FFont::UpdateTexture()
         return false;
     }
 
+    // Only upload the rows of the glyphs rendered since the last update, new glyphs usually only touch a row of slots
+    int firstRow = 0;
+    int endRow = 0;
+    if (!m_fontTexture->GetDirtyRows(firstRow, endRow))
+    {
+        return true;
+    }
+
     RHI::ImageSubresourceRange range;
     range.m_mipSliceMin = 0;
     range.m_mipSliceMax = 0;
@@ -1473,14 +1485,26 @@ bool AZ::FFont::UpdateTexture()
     RHI::ImageSubresourceLayout layout;
     m_fontImage->GetSubresourceLayouts(range, &layout, nullptr);
 
+    const uint32_t rowCount = static_cast<uint32_t>(endRow - firstRow);
+    layout.m_size.m_height = rowCount;
+    layout.m_rowCount = rowCount;
+    layout.m_bytesPerImage = rowCount * layout.m_bytesPerRow;
+
     RHI::ImageUpdateRequest imageUpdateReq;
     imageUpdateReq.m_image = m_fontImage.get();
     imageUpdateReq.m_imageSubresource = RHI::ImageSubresource{ 0, 0 };
-    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer();
+    imageUpdateReq.m_imageSubresourcePixelOffset = RHI::Origin(0, static_cast<uint32_t>(firstRow), 0);
+    imageUpdateReq.m_sourceData = m_fontTexture->GetBuffer() + firstRow * m_fontTexture->GetWidth();
     imageUpdateReq.m_sourceSubresourceLayout = layout;
 
     const RHI::ResultCode result = m_fontAttachmentImage->UpdateImageContents(imageUpdateReq);
-    return result == RHI::ResultCode::Success;
+    if (result != RHI::ResultCode::Success)
+    {
+        return false;
+    }
+
+    m_fontTexture->ClearDirtyRows();
+    return true;
 }
 
 bool AZ::FFont::InitCache()
@@ -89,6 +89,7 @@ int AZ::FontTexture::Create(int width, int height, AZ::FontSmoothMethod smoothMe
     }
 
     memset(m_buffer, 0, width * height * sizeof(FONT_TEXTURE_TYPE));
+    ClearDirtyRows();
 
     if (!(widthCellCount * heightCellCount))
     {
@@ -135,6 +136,7 @@ int AZ::FontTexture::Release()
 {
     delete[] m_buffer;
     m_buffer = 0;
+    ClearDirtyRows();
 
     ReleaseSlotList();
 
@@ -508,6 +510,7 @@ int AZ::FontTexture::UpdateSlot(int slotIndex, uint16_t slotUsage, uint32_t char
 
     glyphBitmap->BlitTo8(m_buffer, 0, 0,
         blitWidth, blitHeight, x * m_cellWidth, y * m_cellHeight, m_width);
+    MarkRowsDirty(y * m_cellHeight, blitHeight);
 
     return 1;
 }
@@ -536,6 +539,28 @@ void AZ::FontTexture::CreateGradientSlot()
             buffer[dwX + dwY * m_width] = static_cast<uint8_t>(dwY * 255 / (slot->m_characterHeight - 1));
         }
     }
+    MarkRowsDirty(y * m_cellHeight, slot->m_characterHeight);
+}
+
+//-------------------------------------------------------------------------------------------------
+void AZ::FontTexture::MarkRowsDirty(int firstRow, int rowCount)
+{
+    const int endRow = AZ::GetMin(firstRow + rowCount, m_height);
+    if (firstRow >= endRow)
+    {
+        return;
+    }
+
+    if (m_dirtyFirstRow < m_dirtyEndRow)
+    {
+        m_dirtyFirstRow = AZ::GetMin(m_dirtyFirstRow, firstRow);
+        m_dirtyEndRow = AZ::GetMax(m_dirtyEndRow, endRow);
+    }
+    else
+    {
+        m_dirtyFirstRow = firstRow;
+        m_dirtyEndRow = endRow;
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -87,8 +87,12 @@ namespace AZ
                     "  SkinnedMeshRenderProxy count: %zu\n"
                     "  DispatchItem count: %zu\n"
                     "  Bone count: %zu\n"
-                    "  Vertex count: %zu\n",
-                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.boneCount, stats.vertexCount
+                    "  Vertex count: %zu\n"
+                    "  Skinned last frame: %zu proxies, %zu vertices (budget %zu)\n"
+                    "  Throttled: %zu, deferred by budget: %zu, morph targets skipped: %zu\n",
+                    stats.skinnedMeshRenderProxyCount, stats.dispatchItemCount, stats.boneCount, stats.vertexCount,
+                    stats.skinnedRenderProxyCount, stats.skinnedVertexCount, stats.vertexBudget,
+                    stats.throttledRenderProxyCount, stats.budgetDeferredRenderProxyCount, stats.skippedMorphTargetRenderProxyCount
                 );
 
                 debugDisplay.Draw2dTextLabel(x, y, size, debugString.c_str(), center);
@@ -371,6 +371,7 @@ namespace Audio
 
 #if !defined(AUDIO_RELEASE)
         AZStd::chrono::steady_clock::time_point m_timeCached;
+        AZStd::chrono::steady_clock::time_point m_timeLoadStarted;
 #endif // !AUDIO_RELEASE
     };
 
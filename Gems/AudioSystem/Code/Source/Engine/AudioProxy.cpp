@@ -159,8 +159,11 @@ namespace Audio
 
         if (HasId())
         {
-            setParameter.m_audioObjectId = m_nAudioObjectID;
-            AZ::Interface<IAudioSystem>::Get()->PushRequest(AZStd::move(setParameter));
+            if (UpdateLastPushedValue(m_lastRtpcValues, nRtpcID, fValue))
+            {
+                setParameter.m_audioObjectId = m_nAudioObjectID;
+                AZ::Interface<IAudioSystem>::Get()->PushRequest(AZStd::move(setParameter));
+            }
         }
         else
         {
@@ -247,8 +250,11 @@ namespace Audio
 
         if (HasId())
         {
-            setEnvironment.m_audioObjectId = m_nAudioObjectID;
-            AZ::Interface<IAudioSystem>::Get()->PushRequest(AZStd::move(setEnvironment));
+            if (UpdateLastPushedValue(m_lastEnvironmentValues, nEnvironmentID, fValue))
+            {
+                setEnvironment.m_audioObjectId = m_nAudioObjectID;
+                AZ::Interface<IAudioSystem>::Get()->PushRequest(AZStd::move(setEnvironment));
+            }
         }
         else
         {
@@ -260,6 +266,7 @@ namespace Audio
     void CAudioProxy::ResetEnvironments()
     {
         Audio::ObjectRequest::ResetEnvironments resetEnvironments;
+        m_lastEnvironmentValues.clear();
 
         if (HasId())
         {
@@ -276,6 +283,7 @@ namespace Audio
     void CAudioProxy::ResetParameters()
     {
         Audio::ObjectRequest::ResetParameters resetParameters;
+        m_lastRtpcValues.clear();
 
         if (HasId())
         {
@@ -350,6 +358,33 @@ namespace Audio
         m_releaseAtEndOfQueue = false;
         m_waitingForId = false;
         m_queuedAudioRequests.clear();
+        m_lastRtpcValues.clear();
+        m_lastEnvironmentValues.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioProxy::UpdateLastPushedValue(LastPushedValues& lastPushedValues, TATLIDType controlId, float value)
+    {
+        // Objects only drive a handful of controls, a linear search beats hashing here.
+        auto lastPushedIter = AZStd::find_if(lastPushedValues.begin(), lastPushedValues.end(),
+            [controlId](const LastPushedValues::value_type& lastPushed)
+            {
+                return lastPushed.first == controlId;
+            });
+
+        if (lastPushedIter == lastPushedValues.end())
+        {
+            lastPushedValues.emplace_back(controlId, value);
+            return true;
+        }
+
+        if (lastPushedIter->second == value)
+        {
+            return false;
+        }
+
+        lastPushedIter->second = value;
+        return true;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
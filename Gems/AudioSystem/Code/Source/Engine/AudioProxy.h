@@ -13,6 +13,8 @@
 #include <IAudioSystem.h>
 
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
 
 namespace Audio
 {
@@ -52,8 +54,16 @@ namespace Audio
         bool HasId() const;
         void Reset();
 
+        //! Records the value last pushed for a control, returns false if it was already pushed with that same value.
+        using LastPushedValues = AZStd::vector<AZStd::pair<TATLIDType, float>, AudioSystemStdAllocator>;
+        static bool UpdateLastPushedValue(LastPushedValues& lastPushedValues, TATLIDType controlId, float value);
+
         AudioRequestsQueue m_queuedAudioRequests;
 
+        // Values last pushed to the audio object, so repeated sets of the same value every frame don't become requests.
+        LastPushedValues m_lastRtpcValues;
+        LastPushedValues m_lastEnvironmentValues;
+
         SATLWorldPosition m_oPosition;
         TAudioObjectID m_nAudioObjectID{ INVALID_AUDIO_OBJECT_ID };
         void* m_ownerOverride{ nullptr };
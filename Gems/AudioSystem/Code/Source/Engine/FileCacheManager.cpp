@@ -516,21 +516,16 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request)
+    void CFileCacheManager::FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request, TAudioFileEntryID fileEntryId)
     {
         auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
         AZ_Assert(streamer, "FileCacheManager - AZ::IO::Streamer is not available.")
 
-        // Find the file entry that matches the request handle...
-        auto fileEntryIter = AZStd::find_if(m_audioFileEntries.begin(), m_audioFileEntries.end(),
-            [&request] (const AZStd::pair<TAudioFileEntryID, CATLAudioFileEntry*>& data) -> bool
-            {
-                return (data.second->m_asyncStreamRequest == request);
-            }
-        );
+        // Look up the file entry that queued the request, it only still owns the request if it wasn't uncached or re-queued since...
+        auto fileEntryIter = m_audioFileEntries.find(fileEntryId);
 
         // If found, we finish processing the async file load request...
-        if (fileEntryIter != m_audioFileEntries.end())
+        if (fileEntryIter != m_audioFileEntries.end() && fileEntryIter->second->m_asyncStreamRequest == request)
         {
             void* buffer{};
             AZ::u64 numBytesRead{};
@@ -569,6 +564,9 @@ namespace Audio
 
 #if !defined(AUDIO_RELEASE)
                     audioFileEntry->m_timeCached = AZStd::chrono::steady_clock::now();
+                    using duration_ms = AZStd::chrono::duration<float, AZStd::milli>;
+                    [[maybe_unused]] const float loadTimeMs =
+                        AZStd::chrono::duration_cast<duration_ms>(audioFileEntry->m_timeCached - audioFileEntry->m_timeLoadStarted).count();
 #endif // !AUDIO_RELEASE
 
                     SATLAudioFileEntryInfo fileEntryInfo;
@@ -582,7 +580,12 @@ namespace Audio
                     AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::RegisterInMemoryFile, &fileEntryInfo);
                     success = true;
 
+#if !defined(AUDIO_RELEASE)
+                    AZLOG_DEBUG("FileCacheManager - File Cached: '%s' (%zu bytes in %.2f ms)", fileEntryInfo.sFileName,
+                        audioFileEntry->m_fileSize, loadTimeMs);
+#else
                     AZLOG_DEBUG("FileCacheManager - File Cached: '%s'", fileEntryInfo.sFileName);
+#endif // !AUDIO_RELEASE
                 }
                 break;
             }
@@ -792,8 +795,8 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////
     bool CFileCacheManager::TryCacheFileCacheEntryInternal(
         CATLAudioFileEntry* const audioFileEntry,
-        [[maybe_unused]] const TAudioFileEntryID fileEntryId,
-        [[maybe_unused]] const bool loadSynchronously,
+        const TAudioFileEntryID fileEntryId,
+        const bool loadSynchronously,
         const bool overrideUseCount /* = false */,
         const AZ::u32 useCount /* = 0 */)
     {
@@ -809,6 +812,9 @@ namespace Audio
                 AZ_Assert(streamer, "FileCacheManager - Streamer should be ready!");
 
                 audioFileEntry->m_flags.AddFlags(eAFF_LOADING);
+#if !defined(AUDIO_RELEASE)
+                audioFileEntry->m_timeLoadStarted = AZStd::chrono::steady_clock::now();
+#endif // !AUDIO_RELEASE
 
                 if (loadSynchronously)
                 {
@@ -856,12 +862,12 @@ namespace Audio
 
                     streamer->SetRequestCompleteCallback(
                         audioFileEntry->m_asyncStreamRequest,
-                        [](AZ::IO::FileRequestHandle request)
+                        [fileEntryId](AZ::IO::FileRequestHandle request)
                         {
                             AZ_PROFILE_FUNCTION(Audio);
                             AudioFileCacheManagerNotficationBus::QueueBroadcast(
                                 &AudioFileCacheManagerNotficationBus::Events::FinishAsyncStreamRequest,
-                                request);
+                                request, fileEntryId);
                         });
 
                     streamer->QueueRequest(audioFileEntry->m_asyncStreamRequest);
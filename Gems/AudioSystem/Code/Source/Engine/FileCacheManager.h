@@ -40,7 +40,7 @@ namespace Audio
         using MutexType = AZStd::recursive_mutex;
         ///////////////////////////////////////////////////////////////////////////////////////////
 
-        virtual void FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request) = 0;
+        virtual void FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request, TAudioFileEntryID fileEntryId) = 0;
     };
 
     using AudioFileCacheManagerNotficationBus = AZ::EBus<AudioFileCacheManagerNotifications>;
@@ -87,7 +87,7 @@ namespace Audio
 
         ///////////////////////////////////////////////////////////////////////////////////////////
         // AudioFileCacheManagerNotficationBus
-        void FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request) override;
+        void FinishAsyncStreamRequest(AZ::IO::FileRequestHandle request, TAudioFileEntryID fileEntryId) override;
         ///////////////////////////////////////////////////////////////////////////////////////////
 
         bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry);
@@ -1161,3 +1161,42 @@ TEST_F(ATLTestFixture, AudioProxy_SimulateQueuedCommands_NumCommandsExecutedMatc
     EXPECT_CALL(m_sys, PushRequest).WillOnce(::testing::Return());
     m_proxy.Release();
 }
+
+TEST_F(ATLTestFixture, AudioProxy_RepeatedParameterValues_OnlyChangesArePushed)
+{
+    constexpr TAudioObjectID objectId{ 2001 };
+
+    EXPECT_CALL(m_sys, PushRequest)
+        .WillOnce(
+            [this](AudioRequestVariant&& requestVariant)
+            {
+                AZStd::visit(
+                    [](auto&& request)
+                    {
+                        using T = AZStd::decay_t<decltype(request)>;
+                        if constexpr (AZStd::is_same_v<T, Audio::SystemRequest::ReserveObject>)
+                        {
+                            request.m_objectId = objectId;
+                        }
+                    },
+                    requestVariant);
+                m_requestHolder = AZStd::move(requestVariant);
+            });
+    EXPECT_CALL(m_sys, PushRequests).WillOnce(::testing::Return());
+
+    m_proxy.Initialize("test_proxy");
+    m_callbackCaller(AZStd::move(m_requestHolder));
+    EXPECT_EQ(m_proxy.GetAudioObjectID(), objectId);
+
+    // Repeated values aren't pushed again, until a reset makes the audio object forget them.
+    // Pushed: two parameter values, the environment amount, the reset, the environment amount again and the release.
+    EXPECT_CALL(m_sys, PushRequest).Times(6);
+    m_proxy.SetRtpcValue(TAudioControlID{ 123 }, 0.5f);
+    m_proxy.SetRtpcValue(TAudioControlID{ 123 }, 0.5f);
+    m_proxy.SetRtpcValue(TAudioControlID{ 123 }, 0.75f);
+    m_proxy.SetEnvironmentAmount(TAudioEnvironmentID{ 456 }, 1.0f);
+    m_proxy.SetEnvironmentAmount(TAudioEnvironmentID{ 456 }, 1.0f);
+    m_proxy.ResetEnvironments();
+    m_proxy.SetEnvironmentAmount(TAudioEnvironmentID{ 456 }, 1.0f);
+    m_proxy.Release();
+}
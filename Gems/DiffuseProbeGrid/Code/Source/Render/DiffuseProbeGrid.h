@@ -209,9 +209,15 @@ namespace AZ
             bool GetEdgeBlendIbl() const { return m_edgeBlendIbl; }
             void SetEdgeBlendIbl(bool edgeBlendIbl);
 
-            uint32_t GetFrameUpdateCount() const { return m_frameUpdateCount; }
+            // returns the number of frames the probe updates are spread across, which is the scheduled count when the feature
+            // processor schedules the probe updates for a ray budget
+            uint32_t GetFrameUpdateCount() const { return m_scheduledFrameUpdateCount ? m_scheduledFrameUpdateCount : m_frameUpdateCount; }
+            uint32_t GetConfiguredFrameUpdateCount() const { return m_frameUpdateCount; }
             void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; }
 
+            // overrides the frame update count with the count scheduled by the feature processor, 0 restores the configured count
+            void SetScheduledFrameUpdateCount(uint32_t frameUpdateCount) { m_scheduledFrameUpdateCount = frameUpdateCount; }
+
             uint32_t GetFrameUpdateIndex() const { return m_frameUpdateIndex; }
 
             DiffuseProbeGridTransparencyMode GetTransparencyMode() const { return m_transparencyMode; }
@@ -376,6 +382,7 @@ namespace AZ
             // frame count and current frame index for alternating probe updates across frames
             uint32_t m_frameUpdateCount = 1;
             uint32_t m_frameUpdateIndex = 0;
+            uint32_t m_scheduledFrameUpdateCount = 0;
 
             // rotation transform applied to probe rays
             AZ::Quaternion m_probeRayRotation;
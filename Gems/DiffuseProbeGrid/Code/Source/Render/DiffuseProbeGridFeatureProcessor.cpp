@@ -22,6 +22,8 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <AzCore/Console/IConsole.h>
+#include <RayTracing/RayTracingFeatureProcessor.h>
 
 // This component invokes shaders based on Nvidia's RTX-GI SDK.
 // Please refer to "Shaders/DiffuseGlobalIllumination/Nvidia RTX-GI License.txt" for license information.
@@ -30,6 +32,21 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridRayBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of probe rays all real-time diffuse probe grids trace per frame, 0 updates each grid at its own frame update count");
+
+        namespace
+        {
+            // the largest number of frames the scheduler spreads the probe updates of a grid across
+            constexpr uint32_t MaxScheduledFrameUpdateCount = 64;
+
+            // the number of frames the distant grids are updated more often after the ray traced geometry changed
+            constexpr uint32_t GeometryChangedFrameCount = 30;
+
+            // the lowest scheduling weight of any grid while the geometry changed, relative to a grid that contains the camera
+            constexpr float GeometryChangedMinWeight = 0.5f;
+        }
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -154,6 +171,8 @@ namespace AZ
             AZStd::string uuidString = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
             m_queryBufferAttachmentId = AZStd::string::format("DiffuseProbeGridQueryBuffer_%s", uuidString.c_str());
 
+            m_rayTracingFeatureProcessor = GetParentScene()->GetFeatureProcessor<RayTracingFeatureProcessor>();
+
             // cache the SpecularReflectionsFeatureProcessor and SSR RayTracing state
             m_specularReflectionsFeatureProcessor = GetParentScene()->GetFeatureProcessor<SpecularReflectionsFeatureProcessorInterface>();
             if (m_specularReflectionsFeatureProcessor)
@@ -246,6 +265,8 @@ namespace AZ
                 m_probeGridSortRequired = false;
             }
 
+            ScheduleProbeUpdates();
+
             // call Simulate on all diffuse probe grids
             for (uint32_t probeGridIndex = 0; probeGridIndex < m_diffuseProbeGrids.size(); ++probeGridIndex)
             {
@@ -273,6 +294,76 @@ namespace AZ
             }
         }
 
+        void DiffuseProbeGridFeatureProcessor::ScheduleProbeUpdates()
+        {
+            if (m_rayTracingFeatureProcessor)
+            {
+                uint32_t rayTracingRevision = m_rayTracingFeatureProcessor->GetRevision();
+                if (rayTracingRevision != m_rayTracingRevision)
+                {
+                    m_rayTracingRevision = rayTracingRevision;
+                    m_geometryChangedFrameCount = GeometryChangedFrameCount;
+                }
+                else if (m_geometryChangedFrameCount > 0)
+                {
+                    --m_geometryChangedFrameCount;
+                }
+            }
+
+            const uint32_t rayBudget = r_diffuseProbeGridRayBudget;
+            RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline();
+            RPI::ViewPtr view = renderPipeline ? renderPipeline->GetDefaultView() : nullptr;
+            if (rayBudget == 0 || !view)
+            {
+                for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+                {
+                    diffuseProbeGrid->SetScheduledFrameUpdateCount(0);
+                }
+                return;
+            }
+
+            // weight the grids by their distance to the camera relative to their size, so a grid that contains the camera gets
+            // the largest share of the budget
+            const Vector3 cameraPosition = view->GetCameraTransform().GetTranslation();
+            AZStd::vector<float> weights;
+            weights.reserve(m_realTimeDiffuseProbeGrids.size());
+            float totalWeight = 0.0f;
+            for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+            {
+                const Obb& obb = diffuseProbeGrid->GetObbWs();
+                const float halfLength = AZStd::max(obb.GetHalfLengths().GetMaxElement(), 1.0f);
+                const float relativeDistance = 1.0f + obb.GetDistance(cameraPosition) / halfLength;
+                float weight = 1.0f / (relativeDistance * relativeDistance);
+                if (m_geometryChangedFrameCount > 0)
+                {
+                    // the lighting of all grids may be stale, don't let the distant grids fall behind
+                    weight = AZStd::max(weight, GeometryChangedMinWeight);
+                }
+
+                weights.push_back(weight);
+                totalWeight += weight;
+            }
+
+            for (size_t gridIndex = 0; gridIndex < m_realTimeDiffuseProbeGrids.size(); ++gridIndex)
+            {
+                auto& diffuseProbeGrid = m_realTimeDiffuseProbeGrids[gridIndex];
+                const uint32_t probeCount = diffuseProbeGrid->GetTotalProbeCount();
+                if (probeCount == 0)
+                {
+                    diffuseProbeGrid->SetScheduledFrameUpdateCount(0);
+                    continue;
+                }
+
+                // the grid's own frame update count is the least the scheduler amortizes its probe updates across
+                const float gridRayBudget = AZStd::max(rayBudget * weights[gridIndex] / totalWeight, 1.0f);
+                const float gridRayCount = static_cast<float>(probeCount) * diffuseProbeGrid->GetNumRaysPerProbe().m_rayCount;
+                uint32_t frameUpdateCount = static_cast<uint32_t>(ceilf(gridRayCount / gridRayBudget));
+                frameUpdateCount = AZStd::clamp(
+                    frameUpdateCount, diffuseProbeGrid->GetConfiguredFrameUpdateCount(), AZStd::min(MaxScheduledFrameUpdateCount, probeCount));
+                diffuseProbeGrid->SetScheduledFrameUpdateCount(frameUpdateCount);
+            }
+        }
+
         void DiffuseProbeGridFeatureProcessor::OnBeginPrepareRender()
         {
             for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
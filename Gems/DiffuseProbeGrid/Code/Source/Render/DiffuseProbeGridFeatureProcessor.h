@@ -19,6 +19,7 @@ namespace AZ
     namespace Render
     {
         class SpecularReflectionsFeatureProcessorInterface;
+        class RayTracingFeatureProcessor;
 
         //! This class manages DiffuseProbeGrids which generate diffuse global illumination
         class DiffuseProbeGridFeatureProcessor final
@@ -147,6 +148,10 @@ namespace AZ
             void UpdatePipelineStates();
             void UpdatePasses();
 
+            // assigns the frame update count of each real-time grid from the r_diffuseProbeGridRayBudget, so the grids near the camera
+            // are updated more often than the distant ones
+            void ScheduleProbeUpdates();
+
             // loads the probe visualization model and creates the BLAS
             void OnVisualizationModelAssetReady(Data::Asset<Data::AssetData> asset);
 
@@ -229,6 +234,11 @@ namespace AZ
             // SSR state, for controlling the DiffuseProbeGridQueryPass in the SSR pipeline
             SpecularReflectionsFeatureProcessorInterface* m_specularReflectionsFeatureProcessor = nullptr;
             bool m_ssrRayTracingEnabled = false;
+
+            // probe update scheduling, the ray tracing revision changes whenever geometry is added, removed or moved
+            RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
+            uint32_t m_rayTracingRevision = 0;
+            uint32_t m_geometryChangedFrameCount = 0;
         };
     } // namespace Render
 } // namespace AZ
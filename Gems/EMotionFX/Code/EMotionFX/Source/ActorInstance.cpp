@@ -1705,6 +1705,16 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetProceduralNodesMaxLODLevel(size_t level)
+    {
+        m_proceduralNodesMaxLODLevel = level;
+    }
+
+    size_t ActorInstance::GetProceduralNodesMaxLODLevel() const
+    {
+        return m_proceduralNodesMaxLODLevel;
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
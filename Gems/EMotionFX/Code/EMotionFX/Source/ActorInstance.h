@@ -208,6 +208,20 @@ namespace EMotionFX
          */
         void SetLODLevel(size_t level);
 
+        /**
+         * Set the lowest detail LOD level at which the procedural nodes of the anim graph are still processed.
+         * The procedural nodes are the two link IK, look at and simulated object nodes. At lower detail LOD levels they pass their input pose through.
+         * @param level The LOD level, where 0 is the highest detail. InvalidIndex, the default, processes the procedural nodes at all LOD levels.
+         */
+        void SetProceduralNodesMaxLODLevel(size_t level);
+        size_t GetProceduralNodesMaxLODLevel() const;
+
+        /**
+         * Check if the procedural nodes of the anim graph should be processed at the current LOD level.
+         * @result True when the current LOD level isn't lower detail than the procedural nodes max LOD level.
+         */
+        bool GetProceduralNodesEnabled() const          { return m_lodLevel <= m_proceduralNodesMaxLODLevel; }
+
         //--------------------------------
 
         /**
@@ -904,6 +918,7 @@ namespace EMotionFX
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
+        size_t                  m_proceduralNodesMaxLODLevel = InvalidIndex; /**< The lowest detail LOD level at which the procedural anim graph nodes are processed. */
         uint32                  m_boundsUpdateItemFreq;  /**< The bounds update item counter step size. A value of 1 means every vertex/node, a value of 2 means every second vertex/node, etc. */
         uint32                  m_id;                    /**< The unique identification number for the actor instance. */
         uint32                  m_threadIndex;           /**< The thread index. This specifies the thread number this actor instance is being processed in. */
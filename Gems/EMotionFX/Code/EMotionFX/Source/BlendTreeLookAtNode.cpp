@@ -130,8 +130,8 @@ namespace EMotionFX
             weight = MCore::Clamp<float>(weight, 0.0f, 1.0f);
         }
 
-        // if the weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || m_disabled)
+        // if the weight is near zero, or the actor instance LOD is too low for procedural nodes, we can skip all calculations and act like a pass-trough node
+        if (weight < MCore::Math::epsilon || m_disabled || !animGraphInstance->GetActorInstance()->GetProceduralNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             RequestPoses(animGraphInstance);
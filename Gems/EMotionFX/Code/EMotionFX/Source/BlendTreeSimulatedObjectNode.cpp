@@ -229,8 +229,10 @@ namespace EMotionFX
             isActive = GetInputNumberAsBool(animGraphInstance, INPUTPORT_ACTIVE);
         }
 
-        // If we're not active or if this node is disabled or it is optimized for server, we can skip all calculations and just output the input pose.
-        if (!isActive || m_disabled || GetEMotionFX().GetEnableServerOptimization())
+        // If we're not active or if this node is disabled or it is optimized for server or the actor instance LOD is too low for procedural nodes,
+        // we can skip all calculations and just output the input pose.
+        if (!isActive || m_disabled || GetEMotionFX().GetEnableServerOptimization() ||
+            !animGraphInstance->GetActorInstance()->GetProceduralNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
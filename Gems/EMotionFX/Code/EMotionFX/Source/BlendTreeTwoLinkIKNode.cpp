@@ -228,8 +228,8 @@ namespace EMotionFX
             weight = MCore::Clamp<float>(weight, 0.0f, 1.0f);
         }
 
-        // if the IK weight is near zero, we can skip all calculations and act like a pass-trough node
-        if (weight < MCore::Math::epsilon || m_disabled)
+        // if the IK weight is near zero, or the actor instance LOD is too low for procedural nodes, we can skip all calculations and act like a pass-trough node
+        if (weight < MCore::Math::epsilon || m_disabled || !animGraphInstance->GetActorInstance()->GetProceduralNodesEnabled())
         {
             OutputIncomingNode(animGraphInstance, GetInputNode(INPUTPORT_POSE));
             const AnimGraphPose* inputPose = GetInputPose(animGraphInstance, INPUTPORT_POSE)->GetValue();
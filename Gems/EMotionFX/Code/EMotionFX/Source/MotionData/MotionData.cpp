@@ -11,6 +11,8 @@
 #include <EMotionFX/Source/Algorithms.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/EventManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphTarget.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Skeleton.h>
@@ -84,6 +86,19 @@ namespace EMotionFX
             const AZ::Outcome<size_t> findResult = FindJointIndexByNameId(skeleton->GetNode(i)->GetID());
             jointLinks[i] = findResult.IsSuccess() ? findResult.GetValue() : InvalidIndex;
         }
+
+        // Link the morph targets as well, so sampling a pose doesn't have to search the morph data by name for each of them.
+        if (const MorphSetup* morphSetup = actor->GetMorphSetup(0))
+        {
+            const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+            AZStd::vector<size_t>& morphLinks = data->GetMorphDataLinks();
+            morphLinks.resize(numMorphTargets);
+            for (size_t i = 0; i < numMorphTargets; ++i)
+            {
+                const AZ::Outcome<size_t> findResult = FindMorphIndexByNameId(morphSetup->GetMorphTarget(i)->GetID());
+                morphLinks[i] = findResult.IsSuccess() ? findResult.GetValue() : InvalidIndex;
+            }
+        }
         return AZStd::move(data);
     }
 
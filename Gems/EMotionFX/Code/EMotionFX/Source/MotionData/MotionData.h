@@ -53,8 +53,14 @@ namespace EMotionFX
         bool IsJointActive(size_t jointIndex) const { return (m_jointDataLinks[jointIndex] != InvalidIndex); }
         size_t GetJointDataLink(size_t jointIndex) const { return m_jointDataLinks[jointIndex]; }
 
+        // Morph data index for each morph target of the actor's LOD 0 morph setup, which is the order of the morph setup instances.
+        AZStd::vector<size_t>& GetMorphDataLinks() { return m_morphDataLinks; }
+        const AZStd::vector<size_t>& GetMorphDataLinks() const { return m_morphDataLinks; }
+        size_t GetMorphDataLink(size_t morphTargetIndex) const { return morphTargetIndex < m_morphDataLinks.size() ? m_morphDataLinks[morphTargetIndex] : InvalidIndex; }
+
     protected:
         AZStd::vector<size_t> m_jointDataLinks;
+        AZStd::vector<size_t> m_morphDataLinks;
     };
 
     class EMFX_API MotionLinkCache
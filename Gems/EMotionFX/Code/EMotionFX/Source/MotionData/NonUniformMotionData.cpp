@@ -197,11 +197,9 @@ namespace EMotionFX
         const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
         for (size_t i = 0; i < numMorphTargets; ++i)
         {
-            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
-            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
-            if (morphIndex.IsSuccess())
+            const size_t realIndex = motionLinkData->GetMorphDataLink(i);
+            if (realIndex != InvalidIndex)
             {
-                const size_t realIndex = morphIndex.GetValue();
                 const FloatData& data = m_morphData[realIndex];
                 const auto& track = data.m_track;
                 if (!track.m_times.empty())
@@ -110,8 +110,7 @@ namespace EMotionFX
     {
         MCore::LockGuardRecursive guard(m_mutex);
 
-        size_t numSteps = m_steps.size();
-        if (numSteps == 0)
+        if (m_steps.empty())
         {
             return;
         }
@@ -122,7 +121,6 @@ namespace EMotionFX
         {
             m_cleanTimer = 0.0f;
             RemoveEmptySteps();
-            numSteps = m_steps.size();
         }
 
         //-----------------------------------------------------------
@@ -146,62 +144,74 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
-        for (const ScheduleStep& currentStep : m_steps)
+        // Attachments read the transforms of the actor instance they are attached to, so each root actor instance is updated
+        // together with its attachments in a single job. The hierarchies don't depend on each other, so they run in parallel
+        // without waiting for each other at every attachment depth.
+        AZ::JobCompletion jobCompletion;
+        for (size_t i = 0; i < numRootActorInstances; ++i)
         {
-            if (currentStep.m_actorInstances.empty())
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, rootInstance]()
             {
-                continue;
+                AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+
+                const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                RecursiveExecuteActorInstance(rootInstance, timePassedInSeconds, threadIndex);
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    // update the actor instance and then its attachments
+    void MultiThreadScheduler::RecursiveExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, AZ::u32 threadIndex)
+    {
+        if (actorInstance->GetIsEnabled())
+        {
+            actorInstance->SetThreadIndex(threadIndex);
+
+            const bool isVisible = actorInstance->GetIsVisible();
+            if (isVisible)
+            {
+                m_numVisible.Increment();
             }
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;
-            for (ActorInstance* actorInstance : currentStep.m_actorInstances)
+            // check if we want to sample motions
+            bool sampleMotions = false;
+            actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+            if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
             {
-                if (actorInstance->GetIsEnabled() == false)
-                {
-                    continue;
-                }
+                sampleMotions = true;
+                actorInstance->SetMotionSamplingTimer(0.0f);
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                if (isVisible)
                 {
-                    AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
-
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
-
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        m_numVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
-                    }
-
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-                }, true, jobContext);
-
-                job->SetDependent(&jobCompletion);               
-                job->Start();
-
-                m_numUpdated.Increment();
+                    m_numSampled.Increment();
+                }
             }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+            // update the actor instance
+            actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+
+            m_numUpdated.Increment();
+        }
+
+        // the attachments of disabled actor instances are still updated, as long as they are enabled themselves
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveExecuteActorInstance(attachment, timePassedInSeconds, threadIndex);
+            }
+        }
     }
 
 
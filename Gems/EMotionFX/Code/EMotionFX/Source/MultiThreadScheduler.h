@@ -28,6 +28,7 @@ namespace EMotionFX
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
+     * Each root actor instance is updated together with its attachments in one job, and the jobs of all root actor instances run in parallel.
      */
     class EMFX_API MultiThreadScheduler
         : public ActorUpdateScheduler
@@ -44,14 +45,13 @@ namespace EMotionFX
 
         /**
          * A scheduler step.
-         * This contains an array of actor instances.
-         * Each actor instance will be executed in another thread.
-         * The step will never contain more actor instances than the number of CPUs it is setup to use.
+         * This contains an array of actor instances at the same attachment depth.
+         * An actor instance is always updated after the actor instance it is attached to.
          */
         struct EMFX_API ScheduleStep
         {
             AZStd::vector<Actor::Dependency>     m_dependencies;      /**< The dependencies of this scheduler step. No actor instances with the same dependencies are allowed to be added to this step. */
-            AZStd::vector<ActorInstance*>       m_actorInstances;    /**< The actor instances used inside this step. Each array entry will execute in another thread. */
+            AZStd::vector<ActorInstance*>       m_actorInstances;    /**< The actor instances used inside this step. */
         };
 
         /**
@@ -166,5 +166,13 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Update a given actor instance, and after that recursively all its attachments.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         * @param threadIndex The index of the job worker thread running the update.
+         */
+        void RecursiveExecuteActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, AZ::u32 threadIndex);
     };
 }   // namespace EMotionFX
@@ -276,14 +276,6 @@ namespace EMotionFX
     }
 
 
-    // get the local transform
-    const Transform& Pose::GetLocalSpaceTransform(size_t nodeIndex) const
-    {
-        UpdateLocalSpaceTransform(nodeIndex);
-        return m_localSpaceTransforms[nodeIndex];
-    }
-
-
     const Transform& Pose::GetModelSpaceTransform(size_t nodeIndex) const
     {
         UpdateModelSpaceTransform(nodeIndex);
@@ -59,7 +59,20 @@ namespace EMotionFX
         void ForceUpdateFullLocalSpacePose();
         void ForceUpdateFullModelSpacePose();
 
-        const Transform& GetLocalSpaceTransform(size_t nodeIndex) const;
+        /**
+         * Get the local space transform of a node, calculating it from the model space transforms when it isn't up to date.
+         * Inlined, as the blend and sum loops call this for every enabled node and the transform is up to date in most cases.
+         * @param nodeIndex The index of the node.
+         * @result The local space transform of the node.
+         */
+        MCORE_INLINE const Transform& GetLocalSpaceTransform(size_t nodeIndex) const
+        {
+            if (!(m_flags[nodeIndex] & FLAG_LOCALTRANSFORMREADY))
+            {
+                UpdateLocalSpaceTransform(nodeIndex);
+            }
+            return m_localSpaceTransforms[nodeIndex];
+        }
         const Transform& GetModelSpaceTransform(size_t nodeIndex) const;
         Transform GetWorldSpaceTransform(size_t nodeIndex) const;
 
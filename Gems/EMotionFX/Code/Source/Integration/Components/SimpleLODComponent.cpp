@@ -35,10 +35,12 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(2)
+                    ->Version(3)
                     ->Field("LODDistances", &Configuration::m_lodDistances)
                     ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
                     ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
+                    ->Field("EnableLODProceduralNodes", &Configuration::m_enableLodProceduralNodes)
+                    ->Field("ProceduralNodesMaxLOD", &Configuration::m_proceduralNodesMaxLod)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -64,7 +66,13 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                             ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
-                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f);
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_enableLodProceduralNodes,
+                            "Enable LOD procedural nodes", "The IK, look at and simulated object nodes of the anim graph are skipped at lower detail LODs.")
+                            ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_proceduralNodesMaxLod,
+                            "Procedural nodes max LOD", "The lowest detail LOD at which the IK, look at and simulated object nodes are still processed.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodProceduralNodes);
                 }
             }
         }
@@ -103,6 +111,11 @@ namespace EMotionFX
             return m_enableLodSampling;
         }
 
+        bool SimpleLODComponent::Configuration::GetEnableLodProceduralNodes()
+        {
+            return m_enableLodProceduralNodes;
+        }
+
         void SimpleLODComponent::Reflect(AZ::ReflectContext* context)
         {
             Configuration::Reflect(context);
@@ -186,6 +199,7 @@ namespace EMotionFX
             if (m_actorInstance)
             {
                 m_actorInstance->SetLODLevel(m_previousLodLevel);
+                m_actorInstance->SetProceduralNodesMaxLODLevel(InvalidIndex);
             }
         }
 
@@ -259,6 +273,9 @@ namespace EMotionFX
                     actorInstance->SetMotionSamplingRate(0);
                 }
 
+                actorInstance->SetProceduralNodesMaxLODLevel(
+                    configuration.m_enableLodProceduralNodes ? configuration.m_proceduralNodesMaxLod : InvalidIndex);
+
                 // Disable the automatic mesh LOD level adjustment based on screen space in case a simple LOD component is present.
                 // The simple LOD component overrides the mesh LOD level and syncs the skeleton with the mesh LOD level.
                 AZ::Render::MeshComponentRequestBus::Event(entityId,
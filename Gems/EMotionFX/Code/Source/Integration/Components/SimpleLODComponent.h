@@ -46,12 +46,15 @@ namespace EMotionFX
                 // Generate the default value based on LOD level.
                 void GenerateDefaultValue(size_t numLODs);
                 bool GetEnableLodSampling();
+                bool GetEnableLodProceduralNodes();
 
                 static void Reflect(AZ::ReflectContext* context);
 
                 AZStd::vector<float> m_lodDistances;         // LOD distances that decide which lod the actor should choose.
                 AZStd::vector<float> m_lodSampleRates;       // Per LOD sample rate.
                 bool m_enableLodSampling = false;            // Enable per LOD sampling rate. This will allow animation to sample at a lower rate for performance improvement.
+                bool m_enableLodProceduralNodes = false;     // Enable skipping the IK, look at and simulated object nodes of the anim graph at lower detail LODs.
+                AZ::u32 m_proceduralNodesMaxLod = 0;         // The lowest detail LOD at which the procedural nodes are still processed.
             };
 
             SimpleLODComponent(const Configuration* config = nullptr);
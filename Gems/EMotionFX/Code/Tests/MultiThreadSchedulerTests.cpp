@@ -9,6 +9,7 @@
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AttachmentNode.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
 #include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/MultiThreadScheduler.h>
@@ -44,4 +45,34 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, UpdatesAllActorInstancesOfTheAttachmentHierarchies)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+
+        // Two hierarchies, one of them with an attachment that has an attachment itself.
+        ActorInstance* rootInstance = ActorInstance::Create(actor.get());
+        ActorInstance* otherRootInstance = ActorInstance::Create(actor.get());
+        ActorInstance* attachmentInstance = ActorInstance::Create(actor.get());
+        ActorInstance* nestedAttachmentInstance = ActorInstance::Create(actor.get());
+        rootInstance->AddAttachment(AttachmentNode::Create(rootInstance, 0, attachmentInstance));
+        attachmentInstance->AddAttachment(AttachmentNode::Create(attachmentInstance, 0, nestedAttachmentInstance));
+
+        GetEMotionFX().GetActorManager()->UpdateActorInstances(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 4);
+
+        // The attachments of a disabled actor instance still get updated.
+        rootInstance->SetIsEnabled(false);
+        GetEMotionFX().GetActorManager()->UpdateActorInstances(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 3);
+
+        nestedAttachmentInstance->Destroy();
+        attachmentInstance->Destroy();
+        otherRootInstance->Destroy();
+        rootInstance->Destroy();
+    }
 } // namespace EMotionFX
@@ -99,4 +99,21 @@ namespace EMotionFX
         m_actorInstance->UpdateTransformations(0.0f);
         VerifySkeletalLODFlags(m_actorInstance, {}, 0);
     }
+
+    TEST_F(SkeletalLODFixture, ProceduralNodesDisabledBelowMaxLOD)
+    {
+        m_actorInstance->UpdateTransformations(0.0f);
+        EXPECT_TRUE(m_actorInstance->GetProceduralNodesEnabled()) << "Procedural nodes are processed at all LOD levels by default.";
+
+        m_actorInstance->SetLODLevel(1);
+        m_actorInstance->UpdateTransformations(0.0f);
+        EXPECT_TRUE(m_actorInstance->GetProceduralNodesEnabled()) << "Procedural nodes are processed at all LOD levels by default.";
+
+        m_actorInstance->SetProceduralNodesMaxLODLevel(0);
+        EXPECT_FALSE(m_actorInstance->GetProceduralNodesEnabled()) << "LOD 1 is lower detail than the procedural nodes max LOD.";
+
+        m_actorInstance->SetLODLevel(0);
+        m_actorInstance->UpdateTransformations(0.0f);
+        EXPECT_TRUE(m_actorInstance->GetProceduralNodesEnabled());
+    }
 } // namespace EMotionFX
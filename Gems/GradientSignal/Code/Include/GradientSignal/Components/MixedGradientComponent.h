@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/MixedGradientRequestBus.h>
@@ -102,6 +103,7 @@ namespace GradientSignal
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
+        bool CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -112,6 +114,12 @@ namespace GradientSignal
         MixedGradientLayer* GetLayer(int layerIndex) override;
 
     private:
+        //! Blends the values of a layer into the accumulated values
+        static void BlendLayerValues(
+            MixedGradientLayer::MixingOperation operation, float layerOpacity, AZStd::span<const float> layerValues, AZStd::span<float> inOutValues);
+
+        static void ClampValues(AZStd::span<float> inOutValues);
+
         static float PerformMixingOperation(MixedGradientLayer::MixingOperation operation, float prevValue, float currentUnpremultiplied)
         {
             switch (operation)
@@ -142,6 +150,46 @@ namespace GradientSignal
             }
         }
 
+        //! Matches the scalar PerformMixingOperation() for each lane
+        static AZ::Simd::Vec4::FloatType PerformMixingOperation(
+            MixedGradientLayer::MixingOperation operation,
+            AZ::Simd::Vec4::FloatArgType prevValue,
+            AZ::Simd::Vec4::FloatArgType currentUnpremultiplied)
+        {
+            using AZ::Simd::Vec4;
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Initialize:
+                return currentUnpremultiplied;
+            case MixedGradientLayer::MixingOperation::Multiply:
+                return Vec4::Mul(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Screen:
+                return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prevValue), Vec4::Sub(one, currentUnpremultiplied)));
+            case MixedGradientLayer::MixingOperation::Add:
+                return Vec4::Add(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Subtract:
+                return Vec4::Sub(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Min:
+                return Vec4::Min(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Max:
+                return Vec4::Max(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Average:
+                return Vec4::Div(Vec4::Add(prevValue, currentUnpremultiplied), two);
+            case MixedGradientLayer::MixingOperation::Normal:
+                return currentUnpremultiplied;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                return Vec4::Select(
+                    Vec4::Sub(one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, prevValue)), Vec4::Sub(one, currentUnpremultiplied))),
+                    Vec4::Mul(Vec4::Mul(two, prevValue), currentUnpremultiplied),
+                    Vec4::CmpGtEq(prevValue, Vec4::Splat(0.5f)));
+            default:
+                return currentUnpremultiplied;
+            }
+        }
+
         MixedGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
         mutable AZStd::shared_mutex m_queryMutex;
@@ -15,6 +15,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator);
@@ -79,6 +81,19 @@ namespace GradientSignal
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
         virtual bool IsEntityInHierarchy([[maybe_unused]] const AZ::EntityId& entityId) const { return false; }
+
+        /**
+         * Adds the steps that compute the values of this gradient to a GradientProgram, so the program can evaluate the gradient
+         * together with the gradients it samples without querying each of them through this bus.
+         * \param builder The builder of the program. The gradients this gradient samples are added through builder.AddSampler().
+         * \param outRegister The register of the program the steps need to write the values of this gradient to.
+         * \return false if the gradient can't be compiled, in which case the program queries it through GetValues().
+         */
+        virtual bool CompileGradient(
+            [[maybe_unused]] GradientProgramBuilder& builder, [[maybe_unused]] uint32_t outRegister) const
+        {
+            return false;
+        }
     };
 
     using GradientRequestBus = AZ::EBus<GradientRequests>;
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <GradientSignal/GradientSampler.h>
+
+namespace GradientSignal
+{
+    //! The values of the registers of a GradientProgram, for the positions the program is evaluated for
+    class GradientProgramRegisters final
+    {
+    public:
+        GradientProgramRegisters(AZStd::span<float> outValues, AZStd::span<float> intermediateValues);
+
+        //! Returns the values of the register. Register 0 holds the output of the program.
+        AZStd::span<float> operator[](uint32_t registerIndex) const;
+
+    private:
+        AZStd::span<float> m_outValues;
+        AZStd::span<float> m_intermediateValues;
+    };
+
+    //! Collects the steps of a GradientProgram. Gradients add their steps in GradientRequests::CompileGradient().
+    class GradientProgramBuilder final
+    {
+    public:
+        //! Writes the values of the positions to one or more registers
+        using Step = AZStd::function<void(AZStd::span<const AZ::Vector3> positions, const GradientProgramRegisters& registers)>;
+
+        //! Modifies the values of a register in place
+        using Modifier = AZStd::function<void(AZStd::span<float> inOutValues)>;
+
+        //! Adds the steps that write the values of the sampler to the register, including the invert, levels and opacity settings
+        //! of the sampler. Gradients that can't be compiled, and gradients the sampler transforms the positions for, are queried
+        //! through the sampler when the program runs.
+        void AddSampler(const GradientSampler& sampler, uint32_t outRegister);
+
+        //! Returns a new register for intermediate values
+        uint32_t AddRegister();
+
+        void AddStep(Step step);
+        void AddModifier(uint32_t inOutRegister, Modifier modifier);
+
+    private:
+        friend class GradientProgram;
+
+        AZStd::vector<Step> m_steps;
+        uint32_t m_registerCount = 1;
+        //! The gradients that are being compiled, used to detect cyclic references
+        AZStd::vector<AZ::EntityId> m_compilingGradients;
+        size_t m_compiledGradientCount = 0;
+    };
+
+    //! Evaluates a graph of gradient entities as a flat list of steps.
+    //!
+    //! Querying a gradient through a GradientSampler dispatches a GradientRequestBus call for every gradient of the graph, and each
+    //! modifier makes its own pass over the values. The program is compiled from the graph once, by asking each gradient to add
+    //! the steps that compute its values. The gradients that can't be compiled, which are usually the gradients at the leaves of the
+    //! graph, are still queried through the bus, once per query.
+    //!
+    //! The program reads the sampler it's compiled from, which needs to outlive the program, and copies the settings of the gradients
+    //! of the graph, so it needs to be invalidated whenever the sampler or any gradient of the graph changes. Owners of a sampler are
+    //! already notified of those changes through the OnCompositionChanged calls of their DependencyMonitor, so they can invalidate the
+    //! program there. The program compiles itself again on the next query.
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator);
+
+        GradientProgram() = default;
+        explicit GradientProgram(const GradientSampler& sampler);
+
+        //! Sets the sampler the program evaluates, which needs to outlive the program. The program is compiled on the next query.
+        void SetSampler(const GradientSampler& sampler);
+
+        //! Compiles the program again on the next query. Thread safe, and can be called while queries are running.
+        void Invalidate();
+
+        //! Returns the same values as GradientSampler::GetValue() for the sampler. Thread safe.
+        float GetValue(const GradientSampleParams& sampleParams) const;
+
+        //! Returns the same values as GradientSampler::GetValues() for the sampler. Thread safe.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        //! The number of gradients the program evaluates without querying them through the GradientRequestBus
+        size_t GetCompiledGradientCount() const;
+
+    private:
+        //! Compiles the program if it was invalidated. Requires a unique lock on m_mutex.
+        void CompileIfNeeded() const;
+
+        //! Runs the steps of the program. Requires a lock on m_mutex.
+        void Evaluate(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        const GradientSampler* m_sampler = nullptr;
+
+        mutable AZStd::shared_mutex m_mutex;
+        mutable AZStd::atomic_bool m_needsCompile{ true };
+        mutable AZStd::vector<GradientProgramBuilder::Step> m_steps;
+        mutable uint32_t m_registerCount = 1;
+        mutable size_t m_compiledGradientCount = 0;
+    };
+} // namespace GradientSignal
@@ -35,6 +35,9 @@ namespace GradientSignal
         inline float GetValue(const GradientSampleParams& sampleParams) const;
         inline void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
 
+        //! Applies the invert, levels and opacity settings of the sampler to values of the sampled gradient
+        inline void ApplyValueAdjustments(AZStd::span<float> inOutValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         //! Given a dirty region for a gradient, transform the dirty region in world space based on the gradient transform settings.
@@ -200,20 +203,51 @@ namespace GradientSignal
         }
 
         // Perform any post-fetch transformations on the gradient values (invert, levels, opacity).
-        for (auto& outValue : outValues)
+        ApplyValueAdjustments(outValues);
+    }
+
+    inline void GradientSampler::ApplyValueAdjustments(AZStd::span<float> inOutValues) const
+    {
+        // The adjustments are applied in a single pass over the values.
+        const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        if (!m_invertInput && !applyLevels && m_opacity == 1.0f)
+        {
+            return;
+        }
+
+        using AZ::Simd::Vec4;
+
+        const LevelsKernel levels(m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType opacity = Vec4::Splat(m_opacity);
+
+        const size_t vectorizedCount = inOutValues.size() - (inOutValues.size() % LevelsKernel::LaneCount);
+        for (size_t index = 0; index < vectorizedCount; index += LevelsKernel::LaneCount)
         {
+            Vec4::FloatType values = Vec4::LoadUnaligned(&inOutValues[index]);
             if (m_invertInput)
             {
-                outValue = 1.0f - outValue;
+                values = Vec4::Sub(one, values);
             }
-
-            // apply levels if set
-            if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+            if (applyLevels)
             {
-                outValue = GetLevels(outValue, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                values = levels.Apply(values);
             }
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Mul(values, opacity));
+        }
 
-            outValue = outValue * m_opacity;
+        for (size_t index = vectorizedCount; index < inOutValues.size(); ++index)
+        {
+            float value = inOutValues[index];
+            if (m_invertInput)
+            {
+                value = 1.0f - value;
+            }
+            if (applyLevels)
+            {
+                value = levels.Apply(value);
+            }
+            inOutValues[index] = value * m_opacity;
         }
     }
 
@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
@@ -37,6 +39,17 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Batch version of GenerateOctaveNoise(), which evaluates several positions at a time with SIMD instructions.
+        * The results match GenerateOctaveNoise() for each position.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<float> outValues,
+            int octaves,
+            float persistence,
+            float initialFrequency = 1.0f);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
@@ -35,6 +36,8 @@ namespace GradientSignal
 
     private:
         inline float CalculateSmoothedValue(float min, float max, float valueFalloffStrength, float inputValue) const;
+        inline AZ::Simd::Vec4::FloatType CalculateSmoothedValues(
+            float min, float max, float valueFalloffStrength, AZ::Simd::Vec4::FloatArgType inputValues) const;
     };
 
     inline float SmoothStep::CalculateSmoothedValue(float min, float max, float valueFalloffStrength, float inputValue) const
@@ -49,6 +52,20 @@ namespace GradientSignal
         return result1 * (1.0f - result2);
     }
 
+    inline AZ::Simd::Vec4::FloatType SmoothStep::CalculateSmoothedValues(
+        float min, float max, float valueFalloffStrength, AZ::Simd::Vec4::FloatArgType inputValues) const
+    {
+        using AZ::Simd::Vec4;
+
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType values = Vec4::Clamp(inputValues, Vec4::ZeroFloat(), one);
+
+        const Vec4::FloatType result1 = GetSmoothStep(GetRatio(min, min + valueFalloffStrength, values));
+        const Vec4::FloatType result2 = GetSmoothStep(GetRatio(max - valueFalloffStrength, max, values));
+
+        return Vec4::Mul(result1, Vec4::Sub(one, result2));
+    }
+
     inline float SmoothStep::GetSmoothedValue(float inputValue) const
     {
         const float min = m_falloffMidpoint - m_falloffRange / 2.0f;
@@ -64,9 +81,19 @@ namespace GradientSignal
         const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
         const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
 
-        for (auto& inOutValue : inOutValues)
+        // Process the values a SIMD register at a time, and the remainder one at a time
+        constexpr size_t LaneCount = 4;
+        const size_t vectorizedCount = inOutValues.size() - (inOutValues.size() % LaneCount);
+        for (size_t index = 0; index < vectorizedCount; index += LaneCount)
+        {
+            AZ::Simd::Vec4::StoreUnaligned(
+                &inOutValues[index],
+                CalculateSmoothedValues(min, max, valueFalloffStrength, AZ::Simd::Vec4::LoadUnaligned(&inOutValues[index])));
+        }
+
+        for (size_t index = vectorizedCount; index < inOutValues.size(); ++index)
         {
-            inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
+            inOutValues[index] = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValues[index]);
         }
     }
 } // namespace GradientSignal
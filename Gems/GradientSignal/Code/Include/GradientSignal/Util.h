@@ -11,6 +11,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/span.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
@@ -52,6 +53,29 @@ namespace GradientSignal
         return t * t * (3.0f - 2.0f * t);
     }
 
+    //! Matches GetRatio() for each lane of t
+    inline AZ::Simd::Vec4::FloatType GetRatio(float a, float b, AZ::Simd::Vec4::FloatArgType t)
+    {
+        using AZ::Simd::Vec4;
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        if (a == b)
+        {
+            return Vec4::Select(zero, one, Vec4::CmpLtEq(t, Vec4::Splat(a)));
+        }
+
+        return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, Vec4::Splat(a)), Vec4::Splat(b - a)), zero, one);
+    }
+
+    //! Matches GetSmoothStep() for each lane of t
+    inline AZ::Simd::Vec4::FloatType GetSmoothStep(AZ::Simd::Vec4::FloatArgType t)
+    {
+        using AZ::Simd::Vec4;
+
+        return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+    }
+
     inline float GetLevels(float input, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
@@ -79,36 +103,87 @@ namespace GradientSignal
         return AZ::Lerp(outputMin, outputMax, inputCorrected);
     }
 
-    inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    //! The levels adjustment of GetLevels(), prepared to be applied to several values at a time with SIMD instructions.
+    //! Lets the batch paths fuse the levels adjustment with the other adjustments they make to the same values.
+    class LevelsKernel
     {
-        inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
-        inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
-        inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
-        outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
-        outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
+    public:
+        static constexpr size_t LaneCount = 4;
+
+        LevelsKernel(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+            : m_inputMid(AZ::GetClamp(inputMid, 0.01f, 10.0f))
+            , m_inputMin(AZ::GetClamp(inputMin, 0.0f, 1.0f))
+            , m_inputMax(AZ::GetClamp(inputMax, 0.0f, 1.0f))
+            , m_outputMin(AZ::GetClamp(outputMin, 0.0f, 1.0f))
+            , m_outputMax(AZ::GetClamp(outputMax, 0.0f, 1.0f))
+        {
+        }
 
-        if (inputMin == inputMax)
+        float Apply(float input) const
         {
-            for (auto& inOutValue : inOutValues)
+            return GetLevels(input, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
+
+        //! Matches Apply() for each lane
+        AZ::Simd::Vec4::FloatType Apply(AZ::Simd::Vec4::FloatArgType inputs) const
+        {
+            using AZ::Simd::Vec4;
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType clampedInputs = Vec4::Clamp(inputs, zero, one);
+            const Vec4::FloatType outputMin = Vec4::Splat(m_outputMin);
+            const Vec4::FloatType outputMax = Vec4::Splat(m_outputMax);
+
+            if (m_inputMin == m_inputMax)
+            {
+                return Vec4::Select(outputMin, outputMax, Vec4::CmpLtEq(clampedInputs, Vec4::Splat(m_inputMin)));
+            }
+
+            const float inputMidReciprocal = 1.0f / m_inputMid;
+            const Vec4::FloatType inputExtentsReciprocal = Vec4::Splat(1.0f / (m_inputMax - m_inputMin));
+
+            Vec4::FloatType inputCorrected =
+                Vec4::Min(Vec4::Mul(Vec4::Max(Vec4::Sub(clampedInputs, Vec4::Splat(m_inputMin)), zero), inputExtentsReciprocal), one);
+
+            // There's no SIMD pow, but the midpoint is rarely moved from its default of 1, which leaves the values as they are
+            if (inputMidReciprocal != 1.0f)
             {
-                inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
+                alignas(16) float lanes[LaneCount];
+                Vec4::StoreAligned(lanes, inputCorrected);
+                for (float& lane : lanes)
+                {
+                    lane = powf(lane, inputMidReciprocal);
+                }
+                inputCorrected = Vec4::LoadAligned(lanes);
             }
+
+            return Vec4::Add(outputMin, Vec4::Mul(Vec4::Sub(outputMax, outputMin), inputCorrected));
         }
 
-        const float inputMidReciprocal = 1.0f / inputMid;
-        const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
+    private:
+        float m_inputMid;
+        float m_inputMin;
+        float m_inputMax;
+        float m_outputMin;
+        float m_outputMax;
+    };
 
-        for (auto& inOutValue : inOutValues)
-        {
-            const float inputRemapped =
-                AZ::GetMin(AZ::GetMax(AZ::GetClamp(inOutValue, 0.0f, 1.0f) - inputMin, 0.0f) * inputExtentsReciprocal, 1.0f);
+    inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        using AZ::Simd::Vec4;
 
-            // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
-            // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
-            // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
+        const LevelsKernel levels(inputMid, inputMin, inputMax, outputMin, outputMax);
+        const size_t vectorizedCount = inOutValues.size() - (inOutValues.size() % LevelsKernel::LaneCount);
 
-            inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
+        for (size_t index = 0; index < vectorizedCount; index += LevelsKernel::LaneCount)
+        {
+            Vec4::StoreUnaligned(&inOutValues[index], levels.Apply(Vec4::LoadUnaligned(&inOutValues[index])));
+        }
+
+        for (size_t index = vectorizedCount; index < inOutValues.size(); ++index)
+        {
+            inOutValues[index] = levels.Apply(inOutValues[index]);
         }
     }
 } // namespace GradientSignal
@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/InvertGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -161,6 +162,21 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool InvertGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        builder.AddModifier(
+            outRegister,
+            [](AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value = 1.0f - AZ::GetClamp(value, 0.0f, 1.0f);
+                }
+            });
+        return true;
+    }
+
     GradientSampler& InvertGradientComponent::GetGradientSampler()
     {
         return m_configuration.m_gradientSampler;
@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/LevelsGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -213,6 +214,21 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool LevelsGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        builder.AddModifier(
+            outRegister,
+            [inputMid = m_configuration.m_inputMid, inputMin = m_configuration.m_inputMin, inputMax = m_configuration.m_inputMax,
+             outputMin = m_configuration.m_outputMin, outputMax = m_configuration.m_outputMax](AZStd::span<float> inOutValues)
+            {
+                GetLevels(inOutValues, inputMid, inputMin, inputMax, outputMin, outputMax);
+            });
+        return true;
+    }
+
     float LevelsGradientComponent::GetInputMin() const
     {
         return m_configuration.m_inputMin;
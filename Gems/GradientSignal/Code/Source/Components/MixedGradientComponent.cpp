@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -344,33 +345,65 @@ namespace GradientSignal
             // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
             if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
             {
-                // Precalculate the inverse opacity that we'll use for blending the current accumulated value with.
-                // In the one case of "Initialize" blending, force this value to 0 so that we erase any accumulated values.
-                const float inverseOpacity = (layer.m_operation == MixedGradientLayer::MixingOperation::Initialize)
-                    ? 0.0f
-                    : (1.0f - layer.m_gradientSampler.m_opacity);
-
                 // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
                 layer.m_gradientSampler.GetValues(positions, layerValues);
-
-                for (size_t index = 0; index < outValues.size(); index++)
-                {
-                    // unpremultiplied alpha (we clamp the end result)
-                    const float currentUnpremultiplied = layerValues[index] / layer.m_gradientSampler.m_opacity;
-                    const float operationResult = PerformMixingOperation(layer.m_operation, outValues[index], currentUnpremultiplied);
-                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
-                    outValues[index] = (outValues[index] * inverseOpacity) + (operationResult * layer.m_gradientSampler.m_opacity);
-                }
+                BlendLayerValues(layer.m_operation, layer.m_gradientSampler.m_opacity, layerValues, outValues);
             }
         }
 
-        for (auto& outValue : outValues)
+        ClampValues(outValues);
+    }
+
+    void MixedGradientComponent::BlendLayerValues(
+        MixedGradientLayer::MixingOperation operation, float layerOpacity, AZStd::span<const float> layerValues, AZStd::span<float> inOutValues)
+    {
+        // The layers are blended a SIMD register of values at a time, and the remainder one value at a time
+        using AZ::Simd::Vec4;
+        constexpr size_t LaneCount = 4;
+        const size_t vectorizedCount = inOutValues.size() - (inOutValues.size() % LaneCount);
+
+        // Precalculate the inverse opacity that we'll use for blending the current accumulated value with.
+        // In the one case of "Initialize" blending, force this value to 0 so that we erase any accumulated values.
+        const float inverseOpacity = (operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - layerOpacity);
+
+        const Vec4::FloatType opacity = Vec4::Splat(layerOpacity);
+        const Vec4::FloatType inverseOpacities = Vec4::Splat(inverseOpacity);
+        for (size_t index = 0; index < vectorizedCount; index += LaneCount)
+        {
+            // unpremultiplied alpha (we clamp the end result)
+            const Vec4::FloatType previous = Vec4::LoadUnaligned(&inOutValues[index]);
+            const Vec4::FloatType currentUnpremultiplied = Vec4::Div(Vec4::LoadUnaligned(&layerValues[index]), opacity);
+            const Vec4::FloatType operationResult = PerformMixingOperation(operation, previous, currentUnpremultiplied);
+            // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Add(Vec4::Mul(previous, inverseOpacities), Vec4::Mul(operationResult, opacity)));
+        }
+
+        for (size_t index = vectorizedCount; index < inOutValues.size(); index++)
         {
-            outValue = AZ::GetClamp(outValue, 0.0f, 1.0f);
+            const float currentUnpremultiplied = layerValues[index] / layerOpacity;
+            const float operationResult = PerformMixingOperation(operation, inOutValues[index], currentUnpremultiplied);
+            inOutValues[index] = (inOutValues[index] * inverseOpacity) + (operationResult * layerOpacity);
         }
     }
 
+    void MixedGradientComponent::ClampValues(AZStd::span<float> inOutValues)
+    {
+        using AZ::Simd::Vec4;
+        constexpr size_t LaneCount = 4;
+        const size_t vectorizedCount = inOutValues.size() - (inOutValues.size() % LaneCount);
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        for (size_t index = 0; index < vectorizedCount; index += LaneCount)
+        {
+            Vec4::StoreUnaligned(&inOutValues[index], Vec4::Clamp(Vec4::LoadUnaligned(&inOutValues[index]), zero, one));
+        }
 
+        for (size_t index = vectorizedCount; index < inOutValues.size(); index++)
+        {
+            inOutValues[index] = AZ::GetClamp(inOutValues[index], 0.0f, 1.0f);
+        }
+    }
 
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
@@ -385,6 +418,37 @@ namespace GradientSignal
         return false;
     }
 
+    bool MixedGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        // Layer blends combine with the output, so it needs to start at 0
+        builder.AddStep(
+            [outRegister](AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+            {
+                AZStd::span<float> outValues = registers[outRegister];
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            });
+
+        const uint32_t layerRegister = builder.AddRegister();
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                builder.AddSampler(layer.m_gradientSampler, layerRegister);
+                builder.AddStep(
+                    [outRegister, layerRegister, operation = layer.m_operation, opacity = layer.m_gradientSampler.m_opacity](
+                        AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+                    {
+                        BlendLayerValues(operation, opacity, registers[layerRegister], registers[outRegister]);
+                    });
+            }
+        }
+
+        builder.AddModifier(outRegister, &MixedGradientComponent::ClampValues);
+        return true;
+    }
+
     size_t MixedGradientComponent::GetNumLayers() const
     {
         return m_configuration.GetNumLayers();
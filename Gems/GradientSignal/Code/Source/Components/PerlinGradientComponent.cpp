@@ -215,26 +215,36 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
-
         AZStd::shared_lock lock(m_queryMutex);
 
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // Transform all the positions first, so the noise can be generated for several positions at a time
+        AZStd::vector<AZ::Vector3> uvws(positions.size());
+        AZStd::vector<size_t> rejectedIndices;
         for (size_t index = 0; index < positions.size(); index++)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            bool wasPointRejected = false;
+            m_gradientTransform.TransformPositionToUVW(positions[index], uvws[index], wasPointRejected);
 
-            if (!wasPointRejected)
+            if (wasPointRejected)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
-            }
-            else
-            {
-                outValues[index] = 0.0f;
+                uvws[index] = AZ::Vector3::CreateZero();
+                rejectedIndices.push_back(index);
             }
         }
+
+        m_perlinImprovedNoise->GenerateOctaveNoise(
+            uvws, outValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+
+        for (size_t index : rejectedIndices)
+        {
+            outValues[index] = 0.0f;
+        }
     }
 
     int PerlinGradientComponent::GetRandomSeed() const
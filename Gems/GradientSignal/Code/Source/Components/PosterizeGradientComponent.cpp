@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -188,6 +189,24 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool PosterizeGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        builder.AddModifier(
+            outRegister,
+            [bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f), mode = m_configuration.m_mode](
+                AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value = PosterizeValue(value, bands, mode);
+                }
+            });
+        return true;
+    }
+
     AZ::s32 PosterizeGradientComponent::GetBands() const
     {
         return m_configuration.m_bands;
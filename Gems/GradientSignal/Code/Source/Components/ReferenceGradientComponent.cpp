@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/ReferenceGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -154,6 +155,12 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool ReferenceGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        return true;
+    }
+
     GradientSampler& ReferenceGradientComponent::GetGradientSampler()
     {
         return m_configuration.m_gradientSampler;
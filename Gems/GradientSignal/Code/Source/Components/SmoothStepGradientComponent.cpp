@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/SmoothStepGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -197,6 +198,20 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        builder.AddModifier(
+            outRegister,
+            [smoothStep = m_configuration.m_smoothStep](AZStd::span<float> inOutValues)
+            {
+                smoothStep.GetSmoothedValues(inOutValues);
+            });
+        return true;
+    }
+
     float SmoothStepGradientComponent::GetFallOffRange() const
     {
         return m_configuration.m_smoothStep.m_falloffRange;
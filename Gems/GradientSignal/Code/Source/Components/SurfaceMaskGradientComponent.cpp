@@ -197,7 +197,8 @@ namespace GradientSignal
 
         if (!m_configuration.m_surfaceTagList.empty())
         {
-            SurfaceData::SurfacePointList points;
+            SurfaceData::ScopedSurfacePointList scopedPoints;
+            SurfaceData::SurfacePointList& points = *scopedPoints;
             AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
                 positions, m_configuration.m_surfaceTagList, points);
 
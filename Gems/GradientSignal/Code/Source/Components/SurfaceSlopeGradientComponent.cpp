@@ -231,7 +231,8 @@ namespace GradientSignal
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        SurfaceData::SurfacePointList points;
+        SurfaceData::ScopedSurfacePointList scopedPoints;
+        SurfaceData::SurfacePointList& points = *scopedPoints;
         AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
             positions, m_configuration.m_surfaceTagsToSample, points);
 
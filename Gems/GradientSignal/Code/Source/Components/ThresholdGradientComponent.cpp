@@ -7,6 +7,7 @@
  */
 
 #include <GradientSignal/Components/ThresholdGradientComponent.h>
+#include <GradientSignal/GradientProgram.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -169,6 +170,23 @@ namespace GradientSignal
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
     }
 
+    bool ThresholdGradientComponent::CompileGradient(GradientProgramBuilder& builder, uint32_t outRegister) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler, outRegister);
+        builder.AddModifier(
+            outRegister,
+            [threshold = m_configuration.m_threshold](AZStd::span<float> inOutValues)
+            {
+                for (auto& value : inOutValues)
+                {
+                    value = (value <= threshold) ? 0.0f : 1.0f;
+                }
+            });
+        return true;
+    }
+
     float ThresholdGradientComponent::GetThreshold() const
     {
         return m_configuration.m_threshold;
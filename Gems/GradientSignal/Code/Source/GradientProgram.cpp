@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+namespace GradientSignal
+{
+    GradientProgramRegisters::GradientProgramRegisters(AZStd::span<float> outValues, AZStd::span<float> intermediateValues)
+        : m_outValues(outValues)
+        , m_intermediateValues(intermediateValues)
+    {
+    }
+
+    AZStd::span<float> GradientProgramRegisters::operator[](uint32_t registerIndex) const
+    {
+        if (registerIndex == 0)
+        {
+            return m_outValues;
+        }
+
+        const size_t valueCount = m_outValues.size();
+        AZ_Assert(registerIndex * valueCount <= m_intermediateValues.size(), "Gradient program register %u is out of range.", registerIndex);
+        return m_intermediateValues.subspan((registerIndex - 1) * valueCount, valueCount);
+    }
+
+    void GradientProgramBuilder::AddSampler(const GradientSampler& sampler, uint32_t outRegister)
+    {
+        const AZ::EntityId gradientId = sampler.m_gradientId;
+        if (sampler.m_opacity <= 0.0f || !gradientId.IsValid())
+        {
+            AddStep(
+                [outRegister](AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+                {
+                    AZStd::span<float> outValues = registers[outRegister];
+                    AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                });
+            return;
+        }
+
+        if (AZStd::find(m_compilingGradients.begin(), m_compilingGradients.end(), gradientId) != m_compilingGradients.end())
+        {
+            // Same as the sampler, a gradient that references itself produces zeros.
+            AZ_ErrorOnce(
+                "GradientSignal", false, "Detected cyclic dependencies with gradient entity references on entity id %s",
+                gradientId.ToString().c_str());
+            AddStep(
+                [outRegister](AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+                {
+                    AZStd::span<float> outValues = registers[outRegister];
+                    AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                });
+            return;
+        }
+
+        // The sampler transforms the positions for the whole subgraph, so only the gradients that sample the positions as they are
+        // get compiled.
+        if (!sampler.m_enableTransform || !GradientSamplerUtil::AreTransformParamsSet(sampler))
+        {
+            const size_t firstStep = m_steps.size();
+            const uint32_t registerCount = m_registerCount;
+            const size_t compiledGradientCount = m_compiledGradientCount;
+
+            bool compiled = false;
+            m_compilingGradients.push_back(gradientId);
+            GradientRequestBus::EventResult(compiled, gradientId, &GradientRequestBus::Events::CompileGradient, *this, outRegister);
+            m_compilingGradients.pop_back();
+
+            if (compiled)
+            {
+                ++m_compiledGradientCount;
+                AddModifier(
+                    outRegister,
+                    [sampler](AZStd::span<float> inOutValues)
+                    {
+                        sampler.ApplyValueAdjustments(inOutValues);
+                    });
+                return;
+            }
+
+            // Drop anything the gradient added before it gave up
+            m_steps.erase(m_steps.begin() + firstStep, m_steps.end());
+            m_registerCount = registerCount;
+            m_compiledGradientCount = compiledGradientCount;
+        }
+
+        AddStep(
+            [sampler, outRegister](AZStd::span<const AZ::Vector3> positions, const GradientProgramRegisters& registers)
+            {
+                sampler.GetValues(positions, registers[outRegister]);
+            });
+    }
+
+    uint32_t GradientProgramBuilder::AddRegister()
+    {
+        return m_registerCount++;
+    }
+
+    void GradientProgramBuilder::AddStep(Step step)
+    {
+        m_steps.push_back(AZStd::move(step));
+    }
+
+    void GradientProgramBuilder::AddModifier(uint32_t inOutRegister, Modifier modifier)
+    {
+        AddStep(
+            [inOutRegister, modifier = AZStd::move(modifier)](AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+            {
+                modifier(registers[inOutRegister]);
+            });
+    }
+
+    GradientProgram::GradientProgram(const GradientSampler& sampler)
+        : m_sampler(&sampler)
+    {
+    }
+
+    void GradientProgram::SetSampler(const GradientSampler& sampler)
+    {
+        AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+        m_sampler = &sampler;
+        m_needsCompile = true;
+    }
+
+    void GradientProgram::Invalidate()
+    {
+        m_needsCompile = true;
+    }
+
+    float GradientProgram::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        float value = 0.0f;
+        GetValues(AZStd::span<const AZ::Vector3>(&sampleParams.m_position, 1), AZStd::span<float>(&value, 1));
+        return value;
+    }
+
+    void GradientProgram::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).",
+            positions.size(), outValues.size());
+
+        if (m_needsCompile)
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            CompileIfNeeded();
+        }
+
+        AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
+        Evaluate(positions, outValues);
+    }
+
+    size_t GradientProgram::GetCompiledGradientCount() const
+    {
+        if (m_needsCompile)
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            CompileIfNeeded();
+        }
+
+        AZStd::shared_lock<decltype(m_mutex)> lock(m_mutex);
+        return m_compiledGradientCount;
+    }
+
+    void GradientProgram::CompileIfNeeded() const
+    {
+        // Another thread may have compiled the program while this one was waiting for the lock. The flag is cleared before
+        // compiling, so an invalidation that comes in while compiling compiles the program again on the next query.
+        if (!m_needsCompile.exchange(false))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientProgramBuilder builder;
+        if (m_sampler)
+        {
+            builder.AddSampler(*m_sampler, 0);
+        }
+        else
+        {
+            builder.AddStep(
+                [](AZStd::span<const AZ::Vector3>, const GradientProgramRegisters& registers)
+                {
+                    AZStd::span<float> outValues = registers[0];
+                    AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                });
+        }
+
+        m_steps = AZStd::move(builder.m_steps);
+        m_registerCount = builder.m_registerCount;
+        m_compiledGradientCount = builder.m_compiledGradientCount;
+    }
+
+    void GradientProgram::Evaluate(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        // Single queries are common enough that their intermediate values are kept on the stack
+        constexpr size_t InlineValueCount = 64;
+        AZStd::array<float, InlineValueCount> inlineValues;
+        AZStd::vector<float> allocatedValues;
+
+        const size_t intermediateValueCount = (m_registerCount - 1) * outValues.size();
+        AZStd::span<float> intermediateValues;
+        if (intermediateValueCount <= InlineValueCount)
+        {
+            intermediateValues = AZStd::span<float>(inlineValues.data(), intermediateValueCount);
+        }
+        else
+        {
+            allocatedValues.resize(intermediateValueCount);
+            intermediateValues = allocatedValues;
+        }
+
+        const GradientProgramRegisters registers(outValues, intermediateValues);
+        for (const auto& step : m_steps)
+        {
+            step(positions, registers);
+        }
+    }
+} // namespace GradientSignal
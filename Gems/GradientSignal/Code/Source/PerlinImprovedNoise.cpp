@@ -8,6 +8,7 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/SimdMath.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +61,87 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // The x, y and z factors of each case of Gradient(), so the SIMD path can compute the gradients without branching
+        constexpr float GradientFactors[16][3] = {
+            {  1.0f,  1.0f,  0.0f }, { -1.0f,  1.0f,  0.0f }, {  1.0f, -1.0f,  0.0f }, { -1.0f, -1.0f,  0.0f },
+            {  1.0f,  0.0f,  1.0f }, { -1.0f,  0.0f,  1.0f }, {  1.0f,  0.0f, -1.0f }, { -1.0f,  0.0f, -1.0f },
+            {  0.0f,  1.0f,  1.0f }, {  0.0f, -1.0f,  1.0f }, {  0.0f,  1.0f, -1.0f }, {  0.0f, -1.0f, -1.0f },
+            {  1.0f,  1.0f,  0.0f }, {  0.0f, -1.0f,  1.0f }, { -1.0f,  1.0f,  0.0f }, {  0.0f, -1.0f, -1.0f },
+        };
+
+        constexpr size_t LaneCount = 4;
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType Fade(AZ::Simd::Vec4::FloatArgType t)
+        {
+            using AZ::Simd::Vec4;
+            const Vec4::FloatType t3 = Vec4::Mul(Vec4::Mul(t, t), t);
+            return Vec4::Mul(t3, Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType Lerp(AZ::Simd::Vec4::FloatArgType a, AZ::Simd::Vec4::FloatArgType b, AZ::Simd::Vec4::FloatArgType x)
+        {
+            using AZ::Simd::Vec4;
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        // Matches PerlinImprovedNoise::GenerateNoise() for each lane
+        AZ::Simd::Vec4::FloatType GenerateNoise(
+            const AZStd::array<int, 512>& p, AZ::Simd::Vec4::FloatArgType x, AZ::Simd::Vec4::FloatArgType y, AZ::Simd::Vec4::FloatArgType z)
+        {
+            using AZ::Simd::Vec4;
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType fx = Vec4::Floor(x);
+            const Vec4::FloatType fy = Vec4::Floor(y);
+            const Vec4::FloatType fz = Vec4::Floor(z);
+            const Vec4::FloatType xf[2] = { Vec4::Sub(x, fx), Vec4::Sub(Vec4::Sub(x, fx), one) };
+            const Vec4::FloatType yf[2] = { Vec4::Sub(y, fy), Vec4::Sub(Vec4::Sub(y, fy), one) };
+            const Vec4::FloatType zf[2] = { Vec4::Sub(z, fz), Vec4::Sub(Vec4::Sub(z, fz), one) };
+
+            const Vec4::Int32Type cellMask = Vec4::Splat(255);
+            alignas(16) int32_t xi0[LaneCount];
+            alignas(16) int32_t yi0[LaneCount];
+            alignas(16) int32_t zi0[LaneCount];
+            Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(fx), cellMask));
+            Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(fy), cellMask));
+            Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(fz), cellMask));
+
+            // The permutation table lookups have no SIMD equivalent, so the hash of each corner of the unit cube is looked up per
+            // lane, and only the gradients and the interpolation are computed for all the lanes at once.
+            // Corners are indexed by their x offset in bit 0, y offset in bit 1 and z offset in bit 2.
+            Vec4::FloatType gradients[8];
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                const int xOffset = corner & 1;
+                const int yOffset = (corner >> 1) & 1;
+                const int zOffset = (corner >> 2) & 1;
+
+                alignas(16) float factorX[LaneCount];
+                alignas(16) float factorY[LaneCount];
+                alignas(16) float factorZ[LaneCount];
+                for (size_t lane = 0; lane < LaneCount; ++lane)
+                {
+                    const int hash = p[p[p[xi0[lane] + xOffset] + yi0[lane] + yOffset] + zi0[lane] + zOffset] & 0xF;
+                    factorX[lane] = GradientFactors[hash][0];
+                    factorY[lane] = GradientFactors[hash][1];
+                    factorZ[lane] = GradientFactors[hash][2];
+                }
+
+                gradients[corner] = Vec4::Add(
+                    Vec4::Add(Vec4::Mul(Vec4::LoadAligned(factorX), xf[xOffset]), Vec4::Mul(Vec4::LoadAligned(factorY), yf[yOffset])),
+                    Vec4::Mul(Vec4::LoadAligned(factorZ), zf[zOffset]));
+            }
+
+            const Vec4::FloatType u = Fade(xf[0]);
+            const Vec4::FloatType v = Fade(yf[0]);
+            const Vec4::FloatType w = Fade(zf[0]);
+
+            const Vec4::FloatType y1 = Lerp(Lerp(gradients[0], gradients[1], u), Lerp(gradients[2], gradients[3], u), v);
+            const Vec4::FloatType y2 = Lerp(Lerp(gradients[4], gradients[5], u), Lerp(gradients[6], gradients[7], u), v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +174,50 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency)
+    {
+        using AZ::Simd::Vec4;
+        using PerlinImprovedNoiseDetails::LaneCount;
+
+        AZ_Assert(positions.size() == outValues.size(), "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+
+        const size_t vectorizedCount = positions.size() - (positions.size() % LaneCount);
+        for (size_t index = 0; index < vectorizedCount; index += LaneCount)
+        {
+            const AZ::Vector3* lanePositions = &positions[index];
+            const Vec4::FloatType x = Vec4::LoadImmediate(
+                lanePositions[0].GetX(), lanePositions[1].GetX(), lanePositions[2].GetX(), lanePositions[3].GetX());
+            const Vec4::FloatType y = Vec4::LoadImmediate(
+                lanePositions[0].GetY(), lanePositions[1].GetY(), lanePositions[2].GetY(), lanePositions[3].GetY());
+            const Vec4::FloatType z = Vec4::LoadImmediate(
+                lanePositions[0].GetZ(), lanePositions[1].GetZ(), lanePositions[2].GetZ(), lanePositions[3].GetZ());
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            float maxValue = 0.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType octaveFrequency = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(x, octaveFrequency), Vec4::Mul(y, octaveFrequency), Vec4::Mul(z, octaveFrequency));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                maxValue += amplitude;
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(&outValues[index], (maxValue <= 0.0f) ? Vec4::ZeroFloat() : Vec4::Div(total, Vec4::Splat(maxValue)));
+        }
+
+        for (size_t index = vectorizedCount; index < positions.size(); ++index)
+        {
+            outValues[index] = GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
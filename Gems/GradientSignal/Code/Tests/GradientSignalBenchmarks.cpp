@@ -143,6 +143,33 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SmoothStepGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ThresholdGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Gradient Graphs
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_ModifierChain)(benchmark::State& state)
+    {
+        // A base gradient shaped by a chain of modifiers, the way gradients are typically set up for vegetation placement.
+        auto baseEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto entity = BuildTestThresholdGradient(TestShapeHalfBounds, smoothStepEntity->GetId());
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_MixedModifierChains)(benchmark::State& state)
+    {
+        // Two modifier chains over different base gradients, mixed together.
+        auto perlinEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, perlinEntity->GetId());
+        auto randomEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, randomEntity->GetId());
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, levelsEntity->GetId(), smoothStepEntity->GetId());
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
+    }
+
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ModifierChain);
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_MixedModifierChains);
+
     // --------------------------------------------------------------------------------------
     // Surface Gradients
 
@@ -10,6 +10,8 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/Ebuses/LevelsGradientRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace UnitTest
 {
@@ -111,6 +113,70 @@ namespace UnitTest
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientGraph_VerifyGetValueAndGetValuesMatch)
+    {
+        // Chain a few modifiers and mix the result with the chain's input. The query range isn't a multiple of the SIMD width,
+        // so both the vectorized and the remaining values of the batch paths get compared against GetValue.
+        auto perlinEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, perlinEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, perlinEntity->GetId(), smoothStepEntity->GetId());
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f - 1.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_VerifyProgramAndSamplerMatch)
+    {
+        auto perlinEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+        auto levelsEntity = BuildTestLevelsGradient(TestShapeHalfBounds, perlinEntity->GetId());
+        auto smoothStepEntity = BuildTestSmoothStepGradient(TestShapeHalfBounds, levelsEntity->GetId());
+        auto entity = BuildTestMixedGradient(TestShapeHalfBounds, perlinEntity->GetId(), smoothStepEntity->GetId());
+
+        GradientSignal::GradientSampler gradientSampler;
+        gradientSampler.m_gradientId = entity->GetId();
+        gradientSampler.m_invertInput = true;
+        gradientSampler.m_enableLevels = true;
+        gradientSampler.m_inputMid = 0.8f;
+        gradientSampler.m_opacity = 0.9f;
+
+        GradientSignal::GradientProgram program(gradientSampler);
+
+        // The query size isn't a multiple of the SIMD width, so the remaining values of the batch paths get compared as well.
+        AZStd::vector<AZ::Vector3> positions;
+        for (float y = 0.0f; y < 64.0f; y += 1.0f)
+        {
+            for (float x = 0.0f; x < 63.0f; x += 1.0f)
+            {
+                positions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        auto CompareProgramAndSampler = [&]()
+        {
+            AZStd::vector<float> samplerValues(positions.size());
+            AZStd::vector<float> programValues(positions.size());
+            gradientSampler.GetValues(positions, samplerValues);
+            program.GetValues(positions, programValues);
+
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                ASSERT_NEAR(samplerValues[index], programValues[index], 0.000001f);
+                ASSERT_NEAR(gradientSampler.GetValue(GradientSignal::GradientSampleParams(positions[index])),
+                    program.GetValue(GradientSignal::GradientSampleParams(positions[index])), 0.000001f);
+            }
+        };
+
+        CompareProgramAndSampler();
+
+        // The mixed, smooth step and levels gradients are compiled, the perlin gradients are queried.
+        EXPECT_EQ(program.GetCompiledGradientCount(), 3u);
+
+        // Changes to the gradients are picked up once the program is invalidated.
+        GradientSignal::LevelsGradientRequestBus::Event(
+            levelsEntity->GetId(), &GradientSignal::LevelsGradientRequestBus::Events::SetInputMax, 0.5f);
+        program.Invalidate();
+        CompareProgramAndSampler();
+    }
+
     TEST_F(GradientSignalGetValuesTestsFixture, SurfaceAltitudeGradientComponent_VerifyGetValueAndGetValuesMatch)
     {
         auto entity = BuildTestSurfaceAltitudeGradient(TestShapeHalfBounds);
@@ -178,6 +178,32 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = m_intersectionDataCache.m_axisAligned ? m_intersectionDataCache.m_aabb.Contains(points[index])
+                                                                   : m_intersectionDataCache.m_obb.Contains(points[index]);
+        }
+    }
+
+    void BoxShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, &m_mutex, m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = m_intersectionDataCache.m_axisAligned ? m_intersectionDataCache.m_aabb.GetDistanceSq(points[index])
+                                                                   : m_intersectionDataCache.m_obb.GetDistanceSq(points[index]);
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
@@ -131,6 +131,34 @@ namespace LmbrCentral
         return clampedDistance * clampedDistance;
     }
 
+    void SphereShape::ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        const float radiusSquared = m_intersectionDataCache.m_radius * m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            results[index] = AZ::Intersect::PointSphere(m_intersectionDataCache.m_position, radiusSquared, points[index]);
+        }
+    }
+
+    void SphereShape::DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+    {
+        AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+        AZStd::shared_lock lock(m_mutex);
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig, &m_mutex);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3 pointToSphereCenter = m_intersectionDataCache.m_position - points[index];
+            const float distance = pointToSphereCenter.GetLength() - m_intersectionDataCache.m_radius;
+            const float clampedDistance = AZStd::max(distance, 0.0f);
+            results[index] = clampedDistance * clampedDistance;
+        }
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) const
     {
         AZStd::shared_lock lock(m_mutex);
@@ -618,6 +618,38 @@ namespace UnitTest
         EXPECT_FALSE(IsPointInside(entity, AZ::Vector3(9.0f, -18.0f, 4.0f)));
     }
 
+    TEST_F(BoxShapeTest, ArePointsInsideAndDistanceSquaredFromPointsMatchSinglePointQueries)
+    {
+        AZ::Entity entity;
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion(0.26f, 0.74f, 0.22f, 0.58f), AZ::Vector3(12.0f, -16.0f, 3.0f));
+        const AZ::Vector3 nonUniformScale(0.5f, 2.0f, 3.0f);
+        const AZ::Vector3 boxDimensions(4.0f, 3.0f, 7.0f);
+        CreateBoxWithNonUniformScale(entity, transform, nonUniformScale, boxDimensions);
+
+        const AZStd::array<AZ::Vector3, 6> points = { AZ::Vector3(2.0f, -16.0f, 6.0f),  AZ::Vector3(1.0f, -16.0f, 6.0f),
+                                                      AZ::Vector3(13.0f, -14.0f, 5.0f), AZ::Vector3(13.0f, -13.0f, 5.0f),
+                                                      AZ::Vector3(9.0f, -18.0f, 3.0f),  AZ::Vector3(9.0f, -18.0f, 4.0f) };
+        AZStd::array<bool, 6> insideResults;
+        AZStd::array<float, 6> distanceSquaredResults;
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::ArePointsInside, AZStd::span<const AZ::Vector3>(points),
+            AZStd::span<bool>(insideResults));
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoints, AZStd::span<const AZ::Vector3>(points),
+            AZStd::span<float>(distanceSquaredResults));
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            float distanceSquared = AZ::Constants::FloatMax;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distanceSquared, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[index]);
+
+            EXPECT_EQ(insideResults[index], IsPointInside(entity, points[index]));
+            EXPECT_FLOAT_EQ(distanceSquaredResults[index], distanceSquared);
+        }
+    }
+
     // distance scaled
     TEST_F(BoxShapeTest, DistanceFromPoint1)
     {
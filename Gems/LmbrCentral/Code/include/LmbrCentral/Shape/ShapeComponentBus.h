@@ -14,6 +14,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -159,6 +160,30 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) const = 0;
 
+        /// @brief Checks if each of the given points is inside the shape, with a single bus call for the whole set
+        /// @param points Vector3 points to be tested
+        /// @param results Output span the same size as points, set to whether each point is inside or out
+        virtual void ArePointsInside(AZStd::span<const AZ::Vector3> points, AZStd::span<bool> results) const
+        {
+            AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each of the given points is from the shape, with a single bus call for the whole set
+        /// @param points Vector3 points to calculate square distance from
+        /// @param results Output span the same size as points, set to the square distance of each point from the shape
+        virtual void DistanceSquaredFromPoints(AZStd::span<const AZ::Vector3> points, AZStd::span<float> results) const
+        {
+            AZ_Assert(points.size() == results.size(), "The results span must be the same size as the points span");
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                results[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/) const
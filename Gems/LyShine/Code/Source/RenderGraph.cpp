@@ -149,15 +149,26 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add the indexed primitives to the dynamic draw context for drawing. All the primitives of the node share the
+        // render state and textures, so they are combined into a single DrawIndexed call.
+        if (m_primitives.size() == 1)
         {
+            const LyShine::UiPrimitive& primitive = m_primitives.front();
             dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
+        else if (!m_primitives.empty())
+        {
+            if (!m_isMerged)
+            {
+                MergePrimitives();
+            }
+
+            if (!m_mergedIndices.empty())
+            {
+                dynamicDraw->DrawIndexed(m_mergedVertices.data(), static_cast<uint32_t>(m_mergedVertices.size()),
+                    m_mergedIndices.data(), static_cast<uint32_t>(m_mergedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
+            }
+        }
 
         uiRenderer->SetBaseState(prevBaseState);
     }
@@ -171,6 +182,8 @@ namespace LyShine
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
+
+        m_isMerged = false;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +216,28 @@ namespace LyShine
         return primitive->m_numVertices + m_totalNumVertices < std::numeric_limits<uint16>::max();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::MergePrimitives()
+    {
+        m_mergedVertices.clear();
+        m_mergedIndices.clear();
+        m_mergedVertices.reserve(m_totalNumVertices);
+        m_mergedIndices.reserve(m_totalNumIndices);
+
+        // HasSpaceToAddPrimitive keeps the total number of vertices of the node in the range of 16 bit indices
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            const uint16 indexOffset = static_cast<uint16>(m_mergedVertices.size());
+            m_mergedVertices.insert(m_mergedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_mergedIndices.push_back(static_cast<uint16>(primitive.m_indices[i] + indexOffset));
+            }
+        }
+
+        m_isMerged = true;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     int PrimitiveListRenderNode::FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const
     {
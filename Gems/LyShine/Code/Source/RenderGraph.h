@@ -13,6 +13,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -111,6 +112,10 @@ namespace LyShine
         void ValidateNode() override;
 #endif
 
+    private: // functions
+        // Concatenate the vertices and indices of all the primitives so that the node renders with a single draw call
+        void MergePrimitives();
+
     public: // data
         static const int MaxTextures = 16;
 
@@ -132,6 +137,12 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        // The vertices and indices of all the primitives, built on the first render. The primitives never change once the
+        // graph is built (any change to an element rebuilds the graph) so these are reused until the node is destroyed.
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_mergedVertices;
+        AZStd::vector<uint16> m_mergedIndices;
+        bool m_isMerged = false;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -134,28 +134,12 @@ void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
             }
         }
 
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        UiElementBus::Event(
-            entityId,
-            &UiElementBus::Events::FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity)
-            {
-                return true;
-            },
-            descendants);
-
+        // Remove element's children from the list. Walking up from the few marked elements is much cheaper than
+        // gathering all the descendants of the element, which for an element near the root is the whole canvas
         m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
+            [this, entityId](const AZ::EntityId& e)
             {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
+                return IsParentOfElement(entityId, e);
             }
             );
 
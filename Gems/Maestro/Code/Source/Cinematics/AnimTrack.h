@@ -641,24 +641,24 @@ inline int TAnimTrack<KeyType>::GetActiveKey(float time, KeyType* key)
         }
     }
 
-    // Start from begining.
-    for (i = 0; i < nkeys; i++)
+    // Time went back, binary search for the last key not after time, the first key is known not to be.
+    int first = 1;
+    int count = nkeys - 1;
+    while (count > 0)
     {
-        if (time >= m_keys[i].time)
+        const int step = count / 2;
+        if (m_keys[first + step].time <= time)
         {
-            if ((i >= nkeys - 1) || (time < m_keys[i + 1].time))
-            {
-                m_currKey = i;
-                *key = m_keys[m_currKey];
-                return m_currKey;
-            }
+            first += step + 1;
+            count -= step + 1;
         }
         else
         {
-            break;
+            count = step;
         }
     }
-    m_currKey = -1;
+    m_currKey = first - 1;
+    *key = m_keys[m_currKey];
     return m_currKey;
 }
 
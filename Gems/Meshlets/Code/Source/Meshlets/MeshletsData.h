@@ -28,6 +28,7 @@ namespace AZ
             MeshletsData = 0,
             MehsletsTriangles,
             MeshletsIndicesIndirection,
+            MeshletsCullingData,
 
             // for debug coloring purposes
             UVs,
@@ -75,6 +76,20 @@ namespace AZ
             uint32_t triangleCount;
         };
 
+        //! The bounds of a meshlet in object space, used by the compute to cull the meshlets outside the view
+        //! frustum or facing away from the camera. Must match MeshletCullingData in MeshletsCompute.azsl
+        struct MeshletCullingData
+        {
+            float center[3];
+            float radius;
+            float coneApex[3];
+            //! The cosine of half of the normal cone angle, the meshlet is back facing when the view direction
+            //! is within the cone.
+            float coneCutoff;
+            float coneAxis[3];
+            float padding;
+        };
+
         struct GeneratorVertex
         {
             float px, py, pz;
@@ -94,6 +109,7 @@ namespace AZ
             std::vector<meshopt_Meshlet> Descriptors;
             std::vector<uint32_t> EncodedTriangles;     // Meshlet triangles local indices [0..256]
             std::vector<uint32_t> IndicesIndirection;   // Vertex Index indirection map - local to global
+            std::vector<MeshletCullingData> CullingData; // Bounding sphere and normal cone per meshlet
 
             bool ValidateData(uint32_t vtxCount)
             {
@@ -16,6 +16,7 @@
 
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/View.h>
 #include <Atom/RPI.Public/Pass/PassFilter.h>
 #include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
@@ -378,6 +379,9 @@ namespace AZ
             // Remove any dangling leftovers 
             DeletePendingMeshletsRenderObjects();
 
+            // The meshlets are culled for the default view of the pipeline the meshlets passes were added to
+            RPI::ViewPtr cullingView = m_renderPipeline ? m_renderPipeline->GetDefaultView() : nullptr;
+
             AZStd::list<RHI::DispatchItem*> dispatchItems;
             AZStd::list<const RHI::DrawPacket*> drawPackets;
             for (auto renderObject : m_meshletsRenderObjects)
@@ -393,10 +397,11 @@ namespace AZ
                     {
                         // the following is for testing only
                         Render::TransformServiceFeatureProcessorInterface::ObjectId objectId = renderData->ObjectId;
-                        [[maybe_unused]] Transform transform = m_transformServiceFeatureProcessor->GetTransformForId(objectId);
+                        Transform transform = m_transformServiceFeatureProcessor->GetTransformForId(objectId);
 
                         if (MeshletsRenderObject::CreateAndBindComputeSrgAndDispatch(m_computeShader, *renderData))
                         {
+                            MeshletsRenderObject::UpdateClusterCulling(*renderData, transform, cullingView.get());
                             dispatchItems.push_back(renderData->MeshDispatchItem.GetDispatchItem());
                         }
                         drawPackets.push_back(renderData->MeshDrawPacket);
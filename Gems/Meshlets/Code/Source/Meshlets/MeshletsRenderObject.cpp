@@ -7,6 +7,8 @@
 */
 
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
 
 #include <Atom/RHI/Factory.h>
 
@@ -15,6 +17,7 @@
 
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/View.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
@@ -64,7 +67,7 @@ namespace AZ
         {
             const size_t max_vertices = Meshlets::maxVerticesPerMeshlet;    // matching wave/warp groups size multiplier
             const size_t max_triangles = Meshlets::maxTrianglesPerMeshlet;  // NVidia-recommended 126, rounded down to a multiple of 4
-            const float cone_weight = 0.5f;   // note: should be set to 0 unless cone culling is used at runtime!
+            const float cone_weight = 0.5f;   // the meshlets are cone culled by the compute
 
             //----------------------------------------------------------------
             size_t max_meshlets = meshopt_buildMeshletsBound(mesh.indices.size(), max_vertices, max_triangles);
@@ -107,6 +110,24 @@ namespace AZ
             meshlet_triangles.resize(last.triangle_offset + ((last.triangle_count * 3 + 3) & ~3));
             uint32_t meshletsCount = (uint32_t) meshlets.size();
 
+            // The culling bounds are calculated before the triangles are encoded since they need the per byte offsets
+            m_meshletsData.CullingData.resize(meshletsCount);
+            for (uint32_t meshletId = 0; meshletId < meshletsCount; ++meshletId)
+            {
+                const meshopt_Meshlet& meshlet = meshlets[meshletId];
+                meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+                    &meshlet_vertices[meshlet.vertex_offset], &meshlet_triangles[meshlet.triangle_offset], meshlet.triangle_count,
+                    &mesh.vertices[0].px, mesh.vertices.size(), sizeof(GeneratorVertex));
+
+                MeshletCullingData& cullingData = m_meshletsData.CullingData[meshletId];
+                memcpy(cullingData.center, bounds.center, sizeof(cullingData.center));
+                cullingData.radius = bounds.radius;
+                memcpy(cullingData.coneApex, bounds.cone_apex, sizeof(cullingData.coneApex));
+                cullingData.coneCutoff = bounds.cone_cutoff;
+                memcpy(cullingData.coneAxis, bounds.cone_axis, sizeof(cullingData.coneAxis));
+                cullingData.padding = 0.0f;
+            }
+
             m_meshletsData.Descriptors = meshlets;
             m_meshletsData.IndicesIndirection = meshlet_vertices;
             m_meshletsData.EncodeTrianglesData(meshlet_triangles);
@@ -239,6 +260,16 @@ namespace AZ
                     (uint8_t*)m_meshletsData.IndicesIndirection.data()
                 );
 
+            meshRenderData.ComputeBuffersDescriptors[uint8_t(ComputeStreamsSemantics::MeshletsCullingData)] =
+                SrgBufferDescriptor(
+                    RPI::CommonBufferPoolType::ReadOnly,
+                    RHI::Format::Unknown,   // Mark is as Unknown since it represents StructuredBuffer
+                    RHI::BufferBindFlags::ShaderRead,
+                    sizeof(MeshletCullingData), (uint32_t)m_meshletsData.CullingData.size(),
+                    Name{ "MESHLETS_CULLING" }, Name{ "m_meshletsCullingData" }, 3, 0,
+                    (uint8_t*)m_meshletsData.CullingData.data()
+                );
+
             // Allocated using view into shared buffer to allow for a barrier before the render pass
             // [To Do] - including the InputAssembly flag will fail the validation.
             // This requires change in Atom since the pool flags and the buffer flags are not
@@ -250,7 +281,7 @@ namespace AZ
 //                    RHI::BufferBindFlags::Indirect |  [To Do] - add this when moving to GPU driven render pipeline
                     RHI::BufferBindFlags::ShaderReadWrite, // | RHI::BufferBindFlags::InputAssembly,
                     sizeof(float) * 2, vertexCount,
-                    Name{ "UV" }, Name{ "m_uvs" }, 3, 0
+                    Name{ "UV" }, Name{ "m_uvs" }, 4, 0
                 );
 
             meshRenderData.ComputeBuffersDescriptors[uint8_t(ComputeStreamsSemantics::Indices)] =
@@ -260,7 +291,7 @@ namespace AZ
 //                    RHI::BufferBindFlags::Indirect |  [To Do] - add this when moving to GPU driven render pipeline
                     RHI::BufferBindFlags::ShaderReadWrite, // | RHI::BufferBindFlags::InputAssembly,
                     sizeof(uint32_t), indexCount,
-                    Name{ "INDICES" }, Name{ "m_indices" }, 4, 0
+                    Name{ "INDICES" }, Name{ "m_indices" }, 5, 0
                 );
         }
 
@@ -536,6 +567,45 @@ namespace AZ
             return success;
         }
 
+        void MeshletsRenderObject::UpdateClusterCulling(
+            MeshRenderData& meshRenderData, const Transform& objectToWorld, const RPI::View* view)
+        {
+            if (!meshRenderData.ComputeSrg)
+            {
+                return;
+            }
+
+            Data::Instance<RPI::ShaderResourceGroup>& computeSrg = meshRenderData.ComputeSrg;
+            const uint32_t cullingEnabled = view ? 1 : 0;
+            computeSrg->SetConstant(meshRenderData.CullingEnabledIndex, cullingEnabled);
+
+            if (view)
+            {
+                // The frustum planes have inward facing normals. The far plane is skipped, the meshes are culled against it
+                // by the rasterizer anyway.
+                const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+                const Frustum::PlaneId planeIds[] = {
+                    Frustum::PlaneId::Near, Frustum::PlaneId::Left, Frustum::PlaneId::Right, Frustum::PlaneId::Top, Frustum::PlaneId::Bottom
+                };
+                AZStd::array<Vector4, AZ_ARRAY_SIZE(planeIds)> planes;
+                for (size_t planeIndex = 0; planeIndex < planes.size(); ++planeIndex)
+                {
+                    planes[planeIndex] = frustum.GetPlane(planeIds[planeIndex]).GetPlaneEquationCoefficients();
+                }
+                computeSrg->SetConstantArray(meshRenderData.FrustumPlanesIndex, AZStd::span<const Vector4>(planes));
+                computeSrg->SetConstant(meshRenderData.ViewPositionIndex, view->GetCameraTransform().GetTranslation());
+
+                // The cone test is exact for uniform scale only, so the bounds are scaled by the largest axis scale
+                computeSrg->SetConstant(meshRenderData.ObjectToWorldIndex, Matrix3x4::CreateFromTransform(objectToWorld));
+                computeSrg->SetConstant(meshRenderData.BoundsScaleIndex, objectToWorld.GetUniformScale());
+            }
+
+            if (!computeSrg->IsQueuedForCompile())
+            {
+                computeSrg->Compile();
+            }
+        }
+
         bool MeshletsRenderObject::CreateComputeBuffers(MeshRenderData &meshRenderData)
         {
             bool success = true;
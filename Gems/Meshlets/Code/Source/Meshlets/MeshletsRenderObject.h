@@ -18,6 +18,7 @@
 #include <AtomCore/Instance/InstanceData.h>
 
 #include <Atom/RHI/StreamBufferView.h>
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
 
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Model/Model.h>
@@ -36,6 +37,7 @@ namespace AZ
     namespace RPI
     {
         class MeshDrawPacket;
+        class View;
     }
 
     namespace Meshlets
@@ -69,6 +71,13 @@ namespace AZ
             AZStd::vector <Data::Instance<RPI::Buffer>> ComputeBuffers;   // stand alone non shared buffers
             MeshletsDispatchItem MeshDispatchItem;
 
+            //! Per frame cluster culling constants of the Compute Srg
+            RHI::ShaderInputNameIndex CullingEnabledIndex = "m_cullingEnabled";
+            RHI::ShaderInputNameIndex FrustumPlanesIndex = "m_frustumPlanes";
+            RHI::ShaderInputNameIndex ViewPositionIndex = "m_viewPosition";
+            RHI::ShaderInputNameIndex ObjectToWorldIndex = "m_objectToWorld";
+            RHI::ShaderInputNameIndex BoundsScaleIndex = "m_boundsScale";
+
             //! Render pass data
             Data::Instance<RPI::ShaderResourceGroup> RenderObjectSrg;     // Per object render data - includes instanceId and vertex buffers
             AZStd::vector<SrgBufferDescriptor> RenderBuffersDescriptors;
@@ -119,6 +128,10 @@ namespace AZ
             // the creation method to allow frame sync when the data is compiled
             static bool CreateAndBindComputeSrgAndDispatch(Data::Instance<RPI::Shader> computeShader, MeshRenderData& meshRenderData);
 
+            // Sets the per frame constants the Compute uses to cull the meshlets that are outside the view frustum or
+            // facing away from the camera, and compiles the Srg. Culling is disabled when there is no view.
+            static void UpdateClusterCulling(MeshRenderData& meshRenderData, const Transform& objectToWorld, const RPI::View* view);
+
             uint32_t GetMeshletsCount() { return m_meshletsCount; }
 
             // The prep of this data should be used to create the shared buffer alignment 
@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/EMotionFXManager.h>
@@ -39,6 +40,7 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_staggerSearches);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator)
 
@@ -125,6 +127,16 @@ namespace EMotionFX::MotionMatching
                 m_cachedTrajectoryFeature->GetFacingAxisDir(),
                 m_trajectorySecsToTrack);
         }
+
+        // Start each instance at a different point of the search interval. The offsets follow the golden ratio sequence,
+        // which keeps them evenly distributed for any number of instances.
+        if (mm_staggerSearches)
+        {
+            static AZStd::atomic<AZ::u32> s_instanceCounter = 0;
+            const AZ::u32 goldenRatioSequence = s_instanceCounter++ * 2654435769u; // 2^32 / golden ratio, wraps around to [0, 2^32).
+            const float phase = static_cast<float>(goldenRatioSequence) / 4294967296.0f;
+            m_timeSinceLastFrameSwitch = phase / m_lowestCostSearchFrequency;
+        }
     }
 
     void MotionMatchingInstance::DebugDraw(AzFramework::DebugDisplayRequests& debugDisplay)
@@ -536,6 +548,16 @@ namespace EMotionFX::MotionMatching
         float minTrajectoryPastCost = 0.0f;
         float minTrajectoryFutureCost = 0.0f;
 
+        // Gather the features once rather than checking their type for every frame, the trajectory cost is added separately.
+        m_frameCostFeatureIndices.clear();
+        for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+        {
+            if (featureSchema.GetFeature(featureIndex)->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
+            {
+                m_frameCostFeatureIndices.push_back(featureIndex);
+            }
+        }
+
         // Iterate through the frames filtered by the broad-phase search.
         const size_t numFrames = mm_useKdTree ? m_nearestFrames.size() : frameDatabase.GetNumFrames();
         for (size_t i = 0; i < numFrames; ++i)
@@ -552,28 +574,41 @@ namespace EMotionFX::MotionMatching
             float frameCost = 0.0f;
 
             // Calculate the frame cost by accumulating the weighted feature costs.
-            for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+            // The costs are never negative, so the frame gets rejected as soon as the partial cost reaches the lowest cost found so far.
+            for (const size_t featureIndex : m_frameCostFeatureIndices)
             {
-                Feature* feature = featureSchema.GetFeature(featureIndex);
-                if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                {
-                    const float featureCost = feature->CalculateFrameCost(frameIndex, frameCostContext);
-                    const float featureCostFactor = feature->GetCostFactor();
-                    const float featureFinalCost = featureCost * featureCostFactor;
+                const Feature* feature = featureSchema.GetFeature(featureIndex);
+                const float featureCost = feature->CalculateFrameCost(frameIndex, frameCostContext);
+                const float featureCostFactor = feature->GetCostFactor();
+                const float featureFinalCost = featureCost * featureCostFactor;
+
+                frameCost += featureFinalCost;
+                m_tempCosts[featureIndex] = featureFinalCost;
 
-                    frameCost += featureFinalCost;
-                    m_tempCosts[featureIndex] = featureFinalCost;
+                if (frameCost >= minCost)
+                {
+                    break;
                 }
             }
 
+            if (frameCost >= minCost)
+            {
+                continue;
+            }
+
             // Manually add the trajectory cost.
             float trajectoryPastCost = 0.0f;
             float trajectoryFutureCost = 0.0f;
             if (trajectoryFeature)
             {
                 trajectoryPastCost = trajectoryFeature->CalculatePastFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetPastCostFactor();
-                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
                 frameCost += trajectoryPastCost;
+                if (frameCost >= minCost)
+                {
+                    continue;
+                }
+
+                trajectoryFutureCost = trajectoryFeature->CalculateFutureFrameCost(frameIndex, frameCostContext) * trajectoryFeature->GetFutureCostFactor();
                 frameCost += trajectoryFutureCost;
             }
 
@@ -583,13 +618,9 @@ namespace EMotionFX::MotionMatching
                 minCost = frameCost;
                 minCostFrameIndex = frameIndex;
 
-                for (size_t featureIndex = 0; featureIndex < featureSchema.GetNumFeatures(); ++featureIndex)
+                for (const size_t featureIndex : m_frameCostFeatureIndices)
                 {
-                    Feature* feature = featureSchema.GetFeature(featureIndex);
-                    if (feature->RTTI_GetType() != azrtti_typeid<FeatureTrajectory>())
-                    {
-                        m_minCosts[featureIndex] = m_tempCosts[featureIndex];
-                    }
+                    m_minCosts[featureIndex] = m_tempCosts[featureIndex];
                 }
 
                 minTrajectoryPastCost = trajectoryPastCost;
@@ -123,5 +123,6 @@ namespace EMotionFX::MotionMatching
         /// Buffers used for FindLowestCostFrameIndex().
         AZStd::vector<float> m_tempCosts;
         AZStd::vector<float> m_minCosts;
+        AZStd::vector<size_t> m_frameCostFeatureIndices; //!< Indices of the features contributing to the frame cost, all but the trajectory feature.
     };
 } // namespace EMotionFX::MotionMatching
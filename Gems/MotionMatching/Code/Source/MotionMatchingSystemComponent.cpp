@@ -45,6 +45,10 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(bool, mm_staggerSearches, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Offset the lowest cost frame search of each motion matching instance within the search interval, so crowds of characters "
+        "started at the same time spread their searches across frames instead of all searching in the same frame.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
@@ -18,6 +18,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedRecordCache.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkInput/IMultiplayerComponentInput.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
@@ -177,6 +178,10 @@ namespace Multiplayer
 
         const ReplicationRecord& GetPredictableRecord() const;
 
+        //! Returns the cache of serialized property data shared by every connection replicating this entity.
+        //! @return the cache of serialized property data shared by every connection replicating this entity
+        SerializedRecordCache& GetSerializedRecordCache();
+
         void MarkDirty();
         void NotifyLocalChanges();
         void NotifySyncRewindState();
@@ -236,6 +241,7 @@ namespace Multiplayer
         AZStd::map<NetComponentId, MultiplayerComponent*> m_multiplayerComponentMap;
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
         AZStd::vector<MultiplayerComponent*> m_multiplayerInputComponentVector;
+        SerializedRecordCache m_serializedRecordCache;
 
         RpcSendEvent m_sendAuthorityToClientRpcEvent;
         RpcSendEvent m_sendAuthorityToAutonomousRpcEvent;
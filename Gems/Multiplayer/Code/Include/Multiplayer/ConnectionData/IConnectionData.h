@@ -42,6 +42,18 @@ namespace Multiplayer
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
+        //! Runs the main thread portion of Update that gathers the entity updates to send.
+        //! When this returns true GenerateUpdateMessages and SendPreparedUpdates must be called to complete the update.
+        //! @return true if updates were prepared for the remote endpoint
+        virtual bool PrepareUpdate() = 0;
+
+        //! Serializes the prepared entity updates. This only touches state owned by this connection, so it may be called
+        //! concurrently for different connections.
+        virtual void GenerateUpdateMessages() = 0;
+
+        //! Sends the serialized entity updates along with any pending rpcs and entity resets, must be called on the main thread.
+        virtual void SendPreparedUpdates() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
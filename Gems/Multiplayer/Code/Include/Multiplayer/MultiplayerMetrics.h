@@ -40,5 +40,17 @@ namespace Multiplayer
 
         // Other systems
         MultiplayerStat_PhysicsFrameTimeUs,
+
+        // Parallel connection updates
+        MultiplayerStat_ConnectionUpdatePrepareTimeUs,
+        MultiplayerStat_ConnectionUpdateGenerateTimeUs,
+        MultiplayerStat_ConnectionUpdateTaskTimeUs,
+        MultiplayerStat_ConnectionUpdateSendTimeUs,
+        MultiplayerStat_ConnectionUpdateTaskCount,
+        MultiplayerStat_ConnectionUpdateRecordContention,
+
+        // Shared serialized record caches
+        MultiplayerStat_SerializedRecordCacheHits,
+        MultiplayerStat_SerializedRecordCacheMisses,
     };
 }
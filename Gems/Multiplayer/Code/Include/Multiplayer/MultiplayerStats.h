@@ -10,6 +10,8 @@
 
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Time/ITime.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -49,6 +51,23 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Timings of the most recent parallel connection update, see sv_parallelEntityReplication.
+        struct ConnectionUpdateStats
+        {
+            AZ::TimeUs m_prepareTimeUs = AZ::Time::ZeroTimeUs;  // Main thread time spent gathering entity updates for all connections
+            AZ::TimeUs m_generateTimeUs = AZ::Time::ZeroTimeUs; // Wall time spent serializing entity updates across all tasks
+            AZ::TimeUs m_taskTimeUs = AZ::Time::ZeroTimeUs;     // Sum of the time spent inside each connection task
+            AZ::TimeUs m_sendTimeUs = AZ::Time::ZeroTimeUs;     // Main thread time spent sending the serialized updates
+            uint64_t m_taskCount = 0;                           // Number of connections that were serialized on the task graph
+            uint64_t m_recordContentionCount = 0;               // Number of times a task had to wait to record sent metrics
+        };
+        ConnectionUpdateStats m_connectionUpdateStats;
+
+        //! Lookups into the per entity serialized record caches, see net_SerializedRecordCacheMaxEntries.
+        //! These may be updated from several connection update threads at once.
+        AZStd::atomic<uint64_t> m_serializedRecordCacheHits{ 0 };
+        AZStd::atomic<uint64_t> m_serializedRecordCacheMisses{ 0 };
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -58,6 +77,8 @@ namespace Multiplayer
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordFrameTime(AZ::TimeUs networkFrameTime);
+        void RecordConnectionUpdate(const ConnectionUpdateStats& connectionUpdateStats);
+        void RecordSerializedRecordCacheLookup(bool hit);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -94,5 +115,34 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! Returns true if any handlers are bound to the serialize events.
+        //! These handlers expect the start and stop events of each entity to arrive in order, so serialization can't be spread across threads.
+        //! @return boolean true if any handlers are bound to the serialize events
+        bool HasSerializeHandlers() const;
+
+        //! While concurrent recording is enabled the sent property metrics are guarded by a mutex, so that several connections can
+        //! serialize entity updates at once. Every time a thread has to wait on the mutex the record contention count is incremented.
+        void BeginConcurrentRecording();
+
+        //! Disables concurrent recording.
+        //! @return the number of times a thread had to wait to record metrics since BeginConcurrentRecording was called
+        uint64_t EndConcurrentRecording();
+
+    private:
+        //! Locks the record mutex if concurrent recording is enabled, counting contention.
+        class ConcurrentRecordGuard
+        {
+        public:
+            explicit ConcurrentRecordGuard(MultiplayerStats& stats);
+            ~ConcurrentRecordGuard();
+        private:
+            MultiplayerStats& m_stats;
+            bool m_locked = false;
+        };
+
+        AZStd::mutex m_recordMutex;
+        AZStd::atomic<uint64_t> m_recordContentionCount{ 0 };
+        bool m_concurrentRecording = false;
     };
 }
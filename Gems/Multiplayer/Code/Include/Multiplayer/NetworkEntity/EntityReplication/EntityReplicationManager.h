@@ -22,6 +22,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -61,6 +62,13 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! SendUpdates split into its three phases, so the serialization of several connections can be spread across threads.
+        //! PrepareUpdates and SendPreparedUpdates must run on the main thread, GenerateUpdateMessages only touches state owned by
+        //! this connection and can run concurrently with the GenerateUpdateMessages of other connections.
+        void PrepareUpdates();
+        void GenerateUpdateMessages();
+        void SendPreparedUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -121,8 +129,9 @@ namespace Multiplayer
 
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
+        void SelectProxyReplicatorsToSend(EntityReplicatorList& toSendList);
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void SendEntityUpdateMessages(size_t& messageIndex);
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -191,10 +200,19 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! Proxy replicators with changes to publish gathered by GenerateEntityUpdateList, and the number of consecutive
+        //! updates each proxy with changes was held back by the max proxy send count
+        AZStd::vector<EntityReplicator*> m_proxySendCandidates;
+        AZStd::unordered_map<NetEntityId, uint32_t> m_proxySendSkipCounts;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Replicators gathered by PrepareUpdates and the update messages GenerateUpdateMessages serialized for them, index matched
+        EntityReplicatorList m_pendingUpdateReplicators;
+        AZStd::vector<NetworkEntityUpdateMessage> m_pendingUpdateMessages;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
         SendMigrateEntityEvent m_sendMigrateEntityEvent;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+
+namespace Multiplayer
+{
+    //! @class SerializedRecordCache
+    //! @brief Caches the serialized property data of a single entity, keyed by the replication record that produced it.
+    //! Connections that replicate the same entity usually share the same pending record, since they all last acknowledged the
+    //! same update. Rather than walking every dirty network property once per connection, the first connection to serialize a
+    //! given record stores the result and everyone else copies the bytes. The cache is invalidated whenever the entity is
+    //! dirtied, so a cached entry always reflects the current property values.
+    //! Lookups and stores are thread safe, so connections can be serialized in parallel.
+    class SerializedRecordCache
+    {
+    public:
+        SerializedRecordCache() = default;
+        ~SerializedRecordCache() = default;
+
+        //! Looks up the serialized data for a replication record.
+        //! @param record          the replication record to look up, only the remote role and record bits are compared
+        //! @param outputBuffer    on success, the serialized data is copied into this buffer
+        //! @param outputSize      on success, the number of bytes copied into outputBuffer
+        //! @param outputCapacity  the capacity of outputBuffer in bytes
+        //! @return boolean true if the record was found and copied into outputBuffer
+        bool Find(const ReplicationRecord& record, uint8_t* outputBuffer, uint32_t& outputSize, uint32_t outputCapacity);
+
+        //! Stores the serialized data for a replication record, replacing the oldest entry if the cache is full.
+        //! @param record the replication record the data was serialized with
+        //! @param data   the serialized data
+        //! @param size   the number of bytes of serialized data
+        void Store(const ReplicationRecord& record, const uint8_t* data, uint32_t size);
+
+        //! Discards all cached entries, called whenever any network property of the entity changes.
+        void Invalidate();
+
+        //! Returns true if serialized record caching is enabled, see net_SerializedRecordCacheMaxEntries.
+        //! @return boolean true if serialized record caching is enabled
+        static bool IsEnabled();
+
+    private:
+        struct CacheEntry
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+            uint32_t m_generation = 0;
+        };
+
+        static bool HasSameBits(const ReplicationRecord& lhs, const ReplicationRecord& rhs);
+
+        AZ_DISABLE_COPY_MOVE(SerializedRecordCache);
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<CacheEntry> m_entries;
+        AZStd::atomic<uint32_t> m_generation{ 0 };
+        uint32_t m_nextEntryIndex = 0;
+    };
+}
@@ -552,8 +552,15 @@ namespace Multiplayer
         return m_predictableRecord;
     }
 
+    SerializedRecordCache& NetBindComponent::GetSerializedRecordCache()
+    {
+        return m_serializedRecordCache;
+    }
+
     void NetBindComponent::MarkDirty()
     {
+        // Any property change makes previously serialized records stale
+        m_serializedRecordCache.Invalidate();
         if (!m_handleMarkedDirty.IsConnected())
         {
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
@@ -228,9 +228,21 @@ namespace Multiplayer
     void NetworkTransformComponentController::OnTransformChangedEvent(const AZ::Transform& localTm, const AZ::Transform& worldTm)
     {
         const AZ::Transform& localOrWorld = GetParentEntityId() == InvalidNetEntityId ? worldTm : localTm;
-        SetRotation(localOrWorld.GetRotation());
-        SetTranslation(localOrWorld.GetTranslation());
-        SetScale(localOrWorld.GetUniformScale());
+
+        // Changes smaller than the tolerance clients use to decide whether to apply a transform aren't replicated,
+        // so jitter from physics or animation doesn't dirty the properties and resend them every tick.
+        if (!GetRotation().IsClose(localOrWorld.GetRotation()))
+        {
+            SetRotation(localOrWorld.GetRotation());
+        }
+        if (!GetTranslation().IsClose(localOrWorld.GetTranslation()))
+        {
+            SetTranslation(localOrWorld.GetTranslation());
+        }
+        if (!AZ::IsClose(GetScale(), localOrWorld.GetUniformScale()))
+        {
+            SetScale(localOrWorld.GetUniformScale());
+        }
     }
 
     void NetworkTransformComponentController::OnParentIdChangedEvent([[maybe_unused]] AZ::EntityId oldParent, AZ::EntityId newParent)
@@ -51,8 +51,28 @@ namespace Multiplayer
     }
 
     void ClientToServerConnectionData::Update()
+    {
+        if (PrepareUpdate())
+        {
+            GenerateUpdateMessages();
+            SendPreparedUpdates();
+        }
+    }
+
+    bool ClientToServerConnectionData::PrepareUpdate()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        m_entityReplicationManager.PrepareUpdates();
+        return true;
+    }
+
+    void ClientToServerConnectionData::GenerateUpdateMessages()
+    {
+        m_entityReplicationManager.GenerateUpdateMessages();
+    }
+
+    void ClientToServerConnectionData::SendPreparedUpdates()
+    {
+        m_entityReplicationManager.SendPreparedUpdates();
     }
 }
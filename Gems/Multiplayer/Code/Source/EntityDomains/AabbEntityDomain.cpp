@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/AabbEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Math/Color.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer 
+{
+    void AabbEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+    }
+
+    const AZ::Aabb& AabbEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool AabbEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        if (entity == nullptr || !m_aabb.IsValid())
+        {
+            return false;
+        }
+
+        const AZ::TransformInterface* transform = entity->GetTransform();
+        return transform != nullptr && m_aabb.Contains(transform->GetWorldTranslation());
+    }
+
+    void AabbEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        // Taking over authority requires the migration flow between hosts, until then treat the entity as lost
+        AZLOG_ERROR("Timed out entity id %llu during migration (%s domain), marking for removal",
+            aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()), IsInDomain(entityHandle) ? "inside" : "outside");
+        GetNetworkEntityManager()->MarkForRemoval(entityHandle);
+    }
+
+    void AabbEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        if (AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus))
+        {
+            debugDisplay->SetColor(AZ::Colors::Yellow);
+            debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        }
+    }
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer 
+{
+    //! An entity domain that owns the entities whose world translation lies inside an aabb.
+    //! This is the building block for splitting a world across several hosts, each host being responsible for a region of space.
+    class AabbEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        AabbEntityDomain() = default;
+        AabbEntityDomain(const AabbEntityDomain& rhs) = default;
+
+        //! IEntityDomain overrides.
+        //! @{
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+    };
+}
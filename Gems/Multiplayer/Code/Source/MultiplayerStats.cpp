@@ -31,39 +31,56 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_rpcsRecv.resize(rpcCount);
     }
 
+    // Signalling an event writes to it even when nothing is bound, so the serialize events are only signalled when they have handlers.
+    // Entity updates are never serialized concurrently while handlers are bound, see HasSerializeHandlers.
     void MultiplayerStats::RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
-        m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
+        if (m_events.m_entitySerializeStart.HasHandlerConnected())
+        {
+            m_events.m_entitySerializeStart.Signal(mode, entityId, entityName);
+        }
     }
 
     void MultiplayerStats::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
     {
-        m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
+        if (m_events.m_componentSerializeEnd.HasHandlerConnected())
+        {
+            m_events.m_componentSerializeEnd.Signal(mode, netComponentId);
+        }
     }
 
     void MultiplayerStats::RecordEntitySerializeStop(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName)
     {
-        m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
+        if (m_events.m_entitySerializeStop.HasHandlerConnected())
+        {
+            m_events.m_entitySerializeStop.Signal(mode, entityId, entityName);
+        }
     }
 
     void MultiplayerStats::RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
     {
         const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
         const uint16_t propertyIndex = aznumeric_cast<uint16_t>(propertyId);
-        if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
         {
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalBytes += totalBytes;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_callHistory[m_recordMetricIndex]++;
-            m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            ConcurrentRecordGuard recordGuard(*this);
+            if (m_componentStats[netComponentIndex].m_propertyUpdatesSent.size() > propertyIndex)
+            {
+                m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalCalls++;
+                m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalBytes += totalBytes;
+                m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_callHistory[m_recordMetricIndex]++;
+                m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+            }
+            else
+            {
+                AZ_Warning("MultiplayerStats", false,
+                    "Component ID %u has fewer than %u sent propertyIndex. Mismatch by caller suspected.", netComponentIndex, propertyIndex);
+            }
         }
-        else
+
+        if (m_events.m_propertySent.HasHandlerConnected())
         {
-            AZ_Warning("MultiplayerStats", false,
-                "Component ID %u has fewer than %u sent propertyIndex. Mismatch by caller suspected.", netComponentIndex, propertyIndex);
+            m_events.m_propertySent.Signal(netComponentId, propertyId, totalBytes);
         }
-
-        m_events.m_propertySent.Signal(netComponentId, propertyId, totalBytes);
     }
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
@@ -131,6 +148,8 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_EntityCount, m_entityCount);
         SET_PERFORMANCE_STAT(MultiplayerStat_ClientConnectionCount, m_clientConnectionCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_SerializedRecordCacheHits, m_serializedRecordCacheHits.load(AZStd::memory_order_relaxed));
+        SET_PERFORMANCE_STAT(MultiplayerStat_SerializedRecordCacheMisses, m_serializedRecordCacheMisses.load(AZStd::memory_order_relaxed));
 
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
@@ -263,4 +282,60 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    void MultiplayerStats::RecordConnectionUpdate(const ConnectionUpdateStats& connectionUpdateStats)
+    {
+        m_connectionUpdateStats = connectionUpdateStats;
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdatePrepareTimeUs, connectionUpdateStats.m_prepareTimeUs);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdateGenerateTimeUs, connectionUpdateStats.m_generateTimeUs);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdateTaskTimeUs, connectionUpdateStats.m_taskTimeUs);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdateSendTimeUs, connectionUpdateStats.m_sendTimeUs);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdateTaskCount, connectionUpdateStats.m_taskCount);
+        SET_PERFORMANCE_STAT(MultiplayerStat_ConnectionUpdateRecordContention, connectionUpdateStats.m_recordContentionCount);
+    }
+
+    void MultiplayerStats::RecordSerializedRecordCacheLookup(bool hit)
+    {
+        AZStd::atomic<uint64_t>& counter = hit ? m_serializedRecordCacheHits : m_serializedRecordCacheMisses;
+        counter.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    bool MultiplayerStats::HasSerializeHandlers() const
+    {
+        return m_events.m_entitySerializeStart.HasHandlerConnected()
+            || m_events.m_componentSerializeEnd.HasHandlerConnected()
+            || m_events.m_entitySerializeStop.HasHandlerConnected()
+            || m_events.m_propertySent.HasHandlerConnected();
+    }
+
+    void MultiplayerStats::BeginConcurrentRecording()
+    {
+        m_recordContentionCount = 0;
+        m_concurrentRecording = true;
+    }
+
+    uint64_t MultiplayerStats::EndConcurrentRecording()
+    {
+        m_concurrentRecording = false;
+        return m_recordContentionCount.exchange(0);
+    }
+
+    MultiplayerStats::ConcurrentRecordGuard::ConcurrentRecordGuard(MultiplayerStats& stats)
+        : m_stats(stats)
+        , m_locked(stats.m_concurrentRecording)
+    {
+        if (m_locked && !m_stats.m_recordMutex.try_lock())
+        {
+            m_stats.m_recordContentionCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_stats.m_recordMutex.lock();
+        }
+    }
+
+    MultiplayerStats::ConcurrentRecordGuard::~ConcurrentRecordGuard()
+    {
+        if (m_locked)
+        {
+            m_stats.m_recordMutex.unlock();
+        }
+    }
 } // namespace Multiplayer
@@ -34,6 +34,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 
@@ -43,6 +44,7 @@
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -130,8 +132,15 @@ namespace Multiplayer
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+    AZ_CVAR(bool, sv_parallelEntityReplication, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server gathers entity updates for every client on the main thread, serializes them in parallel on the task graph "
+        "and then sends them from the main thread. Takes priority over sv_multithreadedConnectionUpdates");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
+    AZ_CVAR(bool, sv_useInterestGrid, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server buckets network entities into a shared grid and updates client replication windows from grid deltas instead of querying the visibility system");
+    AZ_CVAR(float, sv_interestGridCellSize, 64.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The width and depth of a single interest grid cell in world units, takes effect the next time hosting starts");
     
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -359,6 +368,15 @@ namespace Multiplayer
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_TotalPacketsDiscardedDueToLoad, "TotalPacketsDiscardedDueToLoad");
 
         DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_PhysicsFrameTimeUs, "PhysicsFrameTimeUs");        
+
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdatePrepareTimeUs, "ConnectionUpdatePrepareTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdateGenerateTimeUs, "ConnectionUpdateGenerateTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdateTaskTimeUs, "ConnectionUpdateTaskTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdateSendTimeUs, "ConnectionUpdateSendTimeUs");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdateTaskCount, "ConnectionUpdateTaskCount");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_ConnectionUpdateRecordContention, "ConnectionUpdateRecordContention");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_SerializedRecordCacheHits, "SerializedRecordCacheHits");
+        DECLARE_PERFORMANCE_STAT(MultiplayerGroup_Networking, MultiplayerStat_SerializedRecordCacheMisses, "SerializedRecordCacheMisses");
     }
 
     void MultiplayerSystemComponent::Deactivate()
@@ -372,6 +390,7 @@ namespace Multiplayer
         m_consoleCommandHandler.Disconnect();
         const AZ::Name interfaceName = AZ::Name(MpNetworkInterfaceName);
         AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(interfaceName);
+        m_interestGrid.Reset();
         AzFramework::LevelLoadBlockerBus::Handler::BusDisconnect();
         SessionNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
@@ -651,8 +670,12 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
-        if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
-                                                  GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        const bool isServer = (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer);
+        if (sv_parallelEntityReplication && isServer)
+        {
+            UpdateConnectionsParallel();
+        }
+        else if (sv_multithreadedConnectionUpdates && isServer)
         {
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
@@ -694,6 +717,95 @@ namespace Multiplayer
         }
     }
 
+    void MultiplayerSystemComponent::UpdateConnectionsParallel()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnectionsParallel");
+
+        MultiplayerStats& stats = GetStats();
+        MultiplayerStats::ConnectionUpdateStats connectionUpdateStats;
+
+        // Entity activation and the per entity dirty state gathered by NotifyEntitiesDirtied are shared by every connection,
+        // so each connection picks its entity deltas up on the main thread
+        const AZStd::chrono::steady_clock::time_point prepareStartTime = AZStd::chrono::steady_clock::now();
+        AZ::FrameVector<ConnectionId> preparedConnectionIds;
+        AZ::FrameVector<IConnectionData*> preparedConnections;
+        auto prepareUpdates = [&preparedConnectionIds, &preparedConnections](IConnection& connection)
+        {
+            if (connection.GetUserData() != nullptr)
+            {
+                IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
+                if (connectionData->PrepareUpdate())
+                {
+                    preparedConnectionIds.push_back(connection.GetConnectionId());
+                    preparedConnections.push_back(connectionData);
+                }
+            }
+        };
+        m_networkInterface->GetConnectionSet().VisitConnections(prepareUpdates);
+
+        // Serialization only touches per connection state, so every connection writes its update messages on its own task
+        const AZStd::chrono::steady_clock::time_point generateStartTime = AZStd::chrono::steady_clock::now();
+        if (preparedConnections.size() > 1 && !stats.HasSerializeHandlers())
+        {
+            static const AZ::TaskDescriptor generateUpdateMessagesDescriptor{
+                "Multiplayer::MultiplayerSystemComponent::UpdateConnections - GenerateUpdateMessages", "Multiplayer"
+            };
+
+            AZStd::atomic<int64_t> totalTaskTimeUs{ 0 };
+            AZ::TaskGraphEvent generateUpdateMessagesTGEvent{ "GenerateUpdateMessages Wait" };
+            AZ::TaskGraph generateUpdateMessagesTG{ "GenerateUpdateMessages" };
+            for (IConnectionData* connectionData : preparedConnections)
+            {
+                generateUpdateMessagesTG.AddTask(
+                    generateUpdateMessagesDescriptor,
+                    [connectionData, &totalTaskTimeUs]()
+                    {
+                        const AZStd::chrono::steady_clock::time_point taskStartTime = AZStd::chrono::steady_clock::now();
+                        connectionData->GenerateUpdateMessages();
+                        const auto taskDuration = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                            AZStd::chrono::steady_clock::now() - taskStartTime);
+                        totalTaskTimeUs.fetch_add(taskDuration.count(), AZStd::memory_order_relaxed);
+                    });
+            }
+
+            stats.BeginConcurrentRecording();
+            generateUpdateMessagesTG.Submit(&generateUpdateMessagesTGEvent);
+            generateUpdateMessagesTGEvent.Wait();
+            connectionUpdateStats.m_recordContentionCount = stats.EndConcurrentRecording();
+            connectionUpdateStats.m_taskTimeUs = AZ::TimeUs{ totalTaskTimeUs.load() };
+            connectionUpdateStats.m_taskCount = preparedConnections.size();
+        }
+        else
+        {
+            // Handlers bound to the serialize events expect them in order, so serialize on the main thread
+            for (IConnectionData* connectionData : preparedConnections)
+            {
+                connectionData->GenerateUpdateMessages();
+            }
+        }
+
+        // Sending goes through the shared network interface, so packets are sent from the main thread
+        const AZStd::chrono::steady_clock::time_point sendStartTime = AZStd::chrono::steady_clock::now();
+        for (ConnectionId connectionId : preparedConnectionIds)
+        {
+            // Look the connection up again, a disconnect triggered by an earlier send releases the bound connection data
+            IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(connectionId);
+            if (connection != nullptr && connection->GetUserData() != nullptr)
+            {
+                reinterpret_cast<IConnectionData*>(connection->GetUserData())->SendPreparedUpdates();
+            }
+        }
+        const AZStd::chrono::steady_clock::time_point sendEndTime = AZStd::chrono::steady_clock::now();
+
+        connectionUpdateStats.m_prepareTimeUs = AZ::TimeUs{
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(generateStartTime - prepareStartTime).count() };
+        connectionUpdateStats.m_generateTimeUs = AZ::TimeUs{
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(sendStartTime - generateStartTime).count() };
+        connectionUpdateStats.m_sendTimeUs = AZ::TimeUs{
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(sendEndTime - sendStartTime).count() };
+        stats.RecordConnectionUpdate(connectionUpdateStats);
+    }
+
     int MultiplayerSystemComponent::GetTickOrder()
     {
         // Tick immediately after the network system component
@@ -1342,12 +1454,21 @@ namespace Multiplayer
                     // Set up a full ownership domain if we didn't construct a domain during the initialize event
                     m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
                 }
+
+                if (sv_useInterestGrid)
+                {
+                    m_interestGrid.Initialize(sv_interestGridCellSize);
+                }
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
             {
                 m_networkEntityManager.Initialize(AzNetworking::IpAddress(), AZStd::make_unique<NullEntityDomain>());
             }
         }
+        if (multiplayerType == MultiplayerAgentType::Uninitialized)
+        {
+            m_interestGrid.Reset();
+        }
         m_agentType = multiplayerType;
 
         // Spawn the default player for this host since the host is also a player (not a dedicated server)
@@ -1539,6 +1660,19 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+        AZLOG_INFO("Total serialized record cache hits: %llu", aznumeric_cast<AZ::u64>(stats.m_serializedRecordCacheHits.load()));
+        AZLOG_INFO("Total serialized record cache misses: %llu", aznumeric_cast<AZ::u64>(stats.m_serializedRecordCacheMisses.load()));
+
+        if (sv_parallelEntityReplication)
+        {
+            const MultiplayerStats::ConnectionUpdateStats& connectionUpdateStats = stats.m_connectionUpdateStats;
+            AZLOG_INFO("Connection update prepare time us: %lld", aznumeric_cast<AZ::s64>(connectionUpdateStats.m_prepareTimeUs));
+            AZLOG_INFO("Connection update generate time us: %lld", aznumeric_cast<AZ::s64>(connectionUpdateStats.m_generateTimeUs));
+            AZLOG_INFO("Connection update task time us: %lld", aznumeric_cast<AZ::s64>(connectionUpdateStats.m_taskTimeUs));
+            AZLOG_INFO("Connection update send time us: %lld", aznumeric_cast<AZ::s64>(connectionUpdateStats.m_sendTimeUs));
+            AZLOG_INFO("Connection update task count: %llu", aznumeric_cast<AZ::u64>(connectionUpdateStats.m_taskCount));
+            AZLOG_INFO("Connection update record contention: %llu", aznumeric_cast<AZ::u64>(connectionUpdateStats.m_recordContentionCount));
+        }
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
@@ -1816,7 +1950,7 @@ namespace Multiplayer
     {
         if (auto connectionData = reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData()))
         {
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection, &m_interestGrid);
             connectionData->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
             connectionData->SetControlledEntity(controlledEntity);
 
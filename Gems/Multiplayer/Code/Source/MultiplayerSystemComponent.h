@@ -14,6 +14,7 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <ReplicationWindows/NetworkEntityInterestGrid.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -197,6 +198,7 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        NetworkEntityInterestGrid m_interestGrid;
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
@@ -258,6 +260,7 @@ namespace Multiplayer
         void UpdatedMetricsConnectionCount();
 
         void UpdateConnections();
+        void UpdateConnectionsParallel();
 
         void OnPhysicsPreSimulate(float dt);
         AzPhysics::SystemEvents::OnPresimulateEvent::Handler m_preSimulateHandler{[this](float dt)
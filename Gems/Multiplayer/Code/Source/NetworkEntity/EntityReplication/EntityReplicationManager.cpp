@@ -23,6 +23,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -118,40 +119,66 @@ namespace Multiplayer
 
     // Get the list of entities to update/delete, create and send update/delete messages, send RPCs, and send entity resets.
     void EntityReplicationManager::SendUpdates()
+    {
+        PrepareUpdates();
+        GenerateUpdateMessages();
+        SendPreparedUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates()
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
-        {
-            EntityReplicatorList toSendList = GenerateEntityUpdateList();
+        m_pendingUpdateReplicators = GenerateEntityUpdateList();
 
-            AZLOG
-            (
-                NET_ReplicationInfo,
-                "Sending %zd updates from %s to %s",
-                toSendList.size(),
-                GetNetworkEntityManager()->GetHostId().GetString().c_str(),
-                GetRemoteHostId().GetString().c_str()
-            );
+        AZLOG
+        (
+            NET_ReplicationInfo,
+            "Sending %zd updates from %s to %s",
+            m_pendingUpdateReplicators.size(),
+            GetNetworkEntityManager()->GetHostId().GetString().c_str(),
+            GetRemoteHostId().GetString().c_str()
+        );
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareToGenerateUpdatePacket");
+            // Prep a replication record for send, at this point, everything needs to be sent
+            for (EntityReplicator* replicator : m_pendingUpdateReplicators)
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareToGenerateUpdatePacket");
-                // Prep a replication record for send, at this point, everything needs to be sent
-                for (EntityReplicator* replicator : toSendList)
-                {
-                    replicator->PrepareToGenerateUpdatePacket();
-                }
+                replicator->PrepareToGenerateUpdatePacket();
             }
+        }
+    }
+
+    void EntityReplicationManager::GenerateUpdateMessages()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - GenerateUpdateMessages");
+        // Serialize every prepared replicator exactly once, the messages are packed into packets by SendPreparedUpdates
+        m_pendingUpdateMessages.clear();
+        m_pendingUpdateMessages.reserve(m_pendingUpdateReplicators.size());
+        for (EntityReplicator* replicator : m_pendingUpdateReplicators)
+        {
+            m_pendingUpdateMessages.emplace_back(replicator->GenerateUpdatePacket());
+        }
+    }
+
+    void EntityReplicationManager::SendPreparedUpdates()
+    {
+        AZ_Assert(m_pendingUpdateMessages.size() == m_pendingUpdateReplicators.size(), "GenerateUpdateMessages must be called before SendPreparedUpdates");
 
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            // While we have messages left, build up another packet to send
+            size_t messageIndex = 0;
+            do
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
-                // While our to send list is not empty, build up another packet to send
-                do
-                {
-                    SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
-            }
+                SendEntityUpdateMessages(messageIndex);
+            } while (messageIndex < m_pendingUpdateMessages.size());
         }
 
+        m_pendingUpdateReplicators.clear();
+        m_pendingUpdateMessages.clear();
+
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
         SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
 
@@ -184,7 +211,7 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
-        uint32_t proxySendCount = 0;
+        m_proxySendCandidates.clear();
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -222,10 +249,9 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
+                        else
                         {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
+                            m_proxySendCandidates.push_back(replicator);
                         }
                     }
                 }
@@ -234,6 +260,7 @@ namespace Multiplayer
             if (clearPendingSend)
             {
                 m_remoteEntitiesPendingCreation.erase(*iter);
+                m_proxySendSkipCounts.erase(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
             else
@@ -242,26 +269,82 @@ namespace Multiplayer
             }
         }
 
+        SelectProxyReplicatorsToSend(toSendList);
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::SelectProxyReplicatorsToSend(EntityReplicatorList& toSendList)
+    {
+        const size_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        if (m_proxySendCandidates.size() > maxProxySendCount)
+        {
+            // More proxies have changes than can be sent this update. The pending sends are ordered by entity id, so rather than
+            // always taking the first ones, rank the proxies by their replication priority scaled by the number of updates they
+            // have been held back. Entities that were skipped accumulate priority until they get sent, so low priority entities
+            // update at a steady, lower rate instead of starving.
+            const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+            auto getSendPriority = [this, &replicationSet](const EntityReplicator* replicator)
+            {
+                const auto setIter = replicationSet.find(replicator->GetEntityHandle());
+                const float priority = (setIter != replicationSet.end()) ? setIter->second.m_priority : 0.0f;
+                const auto skipIter = m_proxySendSkipCounts.find(replicator->GetEntityHandle().GetNetEntityId());
+                const uint32_t skipCount = (skipIter != m_proxySendSkipCounts.end()) ? skipIter->second : 0;
+                return AZStd::make_pair(priority * static_cast<float>(skipCount + 1), skipCount);
+            };
+
+            AZStd::vector<AZStd::pair<AZStd::pair<float, uint32_t>, EntityReplicator*>> rankedCandidates;
+            rankedCandidates.reserve(m_proxySendCandidates.size());
+            for (EntityReplicator* replicator : m_proxySendCandidates)
+            {
+                rankedCandidates.emplace_back(getSendPriority(replicator), replicator);
+            }
+            AZStd::nth_element(rankedCandidates.begin(), rankedCandidates.begin() + maxProxySendCount, rankedCandidates.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first > rhs.first;
+                });
+
+            for (size_t index = 0; index < rankedCandidates.size(); ++index)
+            {
+                EntityReplicator* replicator = rankedCandidates[index].second;
+                if (index < maxProxySendCount)
+                {
+                    toSendList.push_back(replicator);
+                    m_proxySendSkipCounts.erase(replicator->GetEntityHandle().GetNetEntityId());
+                }
+                else
+                {
+                    ++m_proxySendSkipCounts[replicator->GetEntityHandle().GetNetEntityId()];
+                }
+            }
+        }
+        else
+        {
+            for (EntityReplicator* replicator : m_proxySendCandidates)
+            {
+                toSendList.push_back(replicator);
+                m_proxySendSkipCounts.erase(replicator->GetEntityHandle().GetNetEntityId());
+            }
+        }
+        m_proxySendCandidates.clear();
+    }
+
+    void EntityReplicationManager::SendEntityUpdateMessages(size_t& messageIndex)
     {
+        const size_t firstMessageIndex = messageIndex;
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
         NetworkEntityUpdateVector entityUpdates;
-        // Serialize everything
-        while (!replicatorList.empty())
+        // Pack as many of the serialized messages as fit
+        while (messageIndex < m_pendingUpdateMessages.size())
         {
-            EntityReplicator* replicator = replicatorList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            const NetworkEntityUpdateMessage& updateMessage = m_pendingUpdateMessages[messageIndex];
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
             // Check if we are over our limits
             const bool payloadFull = (pendingPacketSize + nextMessageSize > m_maxPayloadSize);
             const bool capacityReached = (entityUpdates.size() >= entityUpdates.capacity());
-            const bool largeEntityDetected = (payloadFull && replicatorUpdatedList.empty());
+            const bool largeEntityDetected = (payloadFull && entityUpdates.empty());
             if (capacityReached || (payloadFull && !largeEntityDetected))
             {
                 break;
@@ -269,15 +352,14 @@ namespace Multiplayer
 
             pendingPacketSize += nextMessageSize;
             entityUpdates.push_back(updateMessage);
-            replicatorUpdatedList.push_back(replicator);
-            replicatorList.pop_front();
+            ++messageIndex;
 
             if (largeEntityDetected)
             {
                 AZLOG_WARN
                 (
                     "Serializing extremely large entity (%llu) - MaxPayload: %d NeededSize %d",
-                    aznumeric_cast<AZ::u64>(replicator->GetEntityHandle().GetNetEntityId()),
+                    aznumeric_cast<AZ::u64>(m_pendingUpdateReplicators[messageIndex - 1]->GetEntityHandle().GetNetEntityId()),
                     m_maxPayloadSize,
                     nextMessageSize
                 );
@@ -290,9 +372,9 @@ namespace Multiplayer
             const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
 
             // Update the sent things with the packet id
-            for (EntityReplicator* replicator : replicatorUpdatedList)
+            for (size_t index = firstMessageIndex; index < messageIndex; ++index)
             {
-                replicator->RecordSentPacketId(sentId);
+                m_pendingUpdateReplicators[index]->RecordSentPacketId(sentId);
             }
         }
         else
@@ -374,6 +456,7 @@ namespace Multiplayer
             m_replicatorsPendingRemoval.clear();
             m_replicatorsPendingSend.clear();
             m_replicatorsPendingReset.clear();
+            m_proxySendSkipCounts.clear();
         }
 
         m_entityReplicatorMap.clear();
@@ -1425,6 +1508,7 @@ namespace Multiplayer
     void EntityReplicationManager::RemoveReplicatorFromPendingSend(const EntityReplicator& replicator)
     {
         m_replicatorsPendingSend.erase(replicator.GetEntityHandle().GetNetEntityId());
+        m_proxySendSkipCounts.erase(replicator.GetEntityHandle().GetNetEntityId());
     }
 
     bool EntityReplicationManager::IsUpdateModeToServerClient()
@@ -372,10 +372,34 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
-        InputSerializer inputSerializer(
-            updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
-        updateMessage.ModifyData().Resize(inputSerializer.GetSize());
+        AzNetworking::PacketEncodingBuffer& updateData = updateMessage.ModifyData();
+        const uint32_t updateCapacity = static_cast<uint32_t>(updateData.GetCapacity());
+
+        // Other connections replicating this entity are likely to have serialized the exact same record this tick.
+        // The per entity stats and debug handlers expect to observe every serialization, so skip the cache while they're bound.
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        const bool useRecordCache = SerializedRecordCache::IsEnabled() && !stats.HasSerializeHandlers();
+        SerializedRecordCache& recordCache = netBindComponent->GetSerializedRecordCache();
+        if (useRecordCache)
+        {
+            uint32_t cachedSize = 0;
+            if (recordCache.Find(m_pendingRecord, updateData.GetBuffer(), cachedSize, updateCapacity))
+            {
+                updateData.Resize(cachedSize);
+                stats.RecordSerializedRecordCacheLookup(true);
+                return updateMessage;
+            }
+            stats.RecordSerializedRecordCacheLookup(false);
+        }
+
+        InputSerializer inputSerializer(updateData.GetBuffer(), updateCapacity);
+        const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
+        updateData.Resize(inputSerializer.GetSize());
+
+        if (useRecordCache && serialized)
+        {
+            recordCache.Store(m_pendingRecord, updateData.GetBuffer(), inputSerializer.GetSize());
+        }
 
         return updateMessage;
     }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedRecordCache.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, net_SerializedRecordCacheMaxEntries, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of serialized replication records cached per entity and shared across connections, 0 disables the cache");
+
+    bool SerializedRecordCache::Find(const ReplicationRecord& record, uint8_t* outputBuffer, uint32_t& outputSize, uint32_t outputCapacity)
+    {
+        const uint32_t generation = m_generation.load(AZStd::memory_order_acquire);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (const CacheEntry& entry : m_entries)
+        {
+            if ((entry.m_generation == generation) && HasSameBits(entry.m_record, record))
+            {
+                const uint32_t size = aznumeric_cast<uint32_t>(entry.m_data.size());
+                if (size > outputCapacity)
+                {
+                    return false;
+                }
+                memcpy(outputBuffer, entry.m_data.data(), size);
+                outputSize = size;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SerializedRecordCache::Store(const ReplicationRecord& record, const uint8_t* data, uint32_t size)
+    {
+        const uint32_t maxEntries = net_SerializedRecordCacheMaxEntries;
+        if (maxEntries == 0)
+        {
+            return;
+        }
+
+        const uint32_t generation = m_generation.load(AZStd::memory_order_acquire);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        // Prefer reusing a stale entry, its data vector has already been allocated
+        CacheEntry* targetEntry = nullptr;
+        for (CacheEntry& entry : m_entries)
+        {
+            if (entry.m_generation != generation)
+            {
+                targetEntry = &entry;
+                break;
+            }
+            if (HasSameBits(entry.m_record, record))
+            {
+                // Another connection beat us to it
+                return;
+            }
+        }
+
+        if (targetEntry == nullptr)
+        {
+            if (m_entries.size() < maxEntries)
+            {
+                targetEntry = &m_entries.emplace_back();
+            }
+            else
+            {
+                m_nextEntryIndex = m_nextEntryIndex % aznumeric_cast<uint32_t>(m_entries.size());
+                targetEntry = &m_entries[m_nextEntryIndex++];
+            }
+        }
+
+        targetEntry->m_record = record;
+        targetEntry->m_data.assign(data, data + size);
+        targetEntry->m_generation = generation;
+    }
+
+    void SerializedRecordCache::Invalidate()
+    {
+        m_generation.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    bool SerializedRecordCache::IsEnabled()
+    {
+        return net_SerializedRecordCacheMaxEntries > 0;
+    }
+
+    bool SerializedRecordCache::HasSameBits(const ReplicationRecord& lhs, const ReplicationRecord& rhs)
+    {
+        return (lhs.GetRemoteNetworkRole() == rhs.GetRemoteNetworkRole())
+            && (lhs.m_authorityToClient == rhs.m_authorityToClient)
+            && (lhs.m_authorityToServer == rhs.m_authorityToServer)
+            && (lhs.m_authorityToAutonomous == rhs.m_authorityToAutonomous)
+            && (lhs.m_autonomousToAuthority == rhs.m_autonomousToAuthority);
+    }
+}
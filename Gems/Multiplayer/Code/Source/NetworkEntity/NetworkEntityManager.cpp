@@ -130,6 +130,11 @@ namespace Multiplayer
             {
                 AZ_Assert(entityHandle.GetNetBindComponent(), "No NetBindComponent found on networked entity");
             }
+            if (!m_removeSet.insert(entityHandle.GetNetEntityId()).second)
+            {
+                // Already queued for removal
+                return;
+            }
             m_removeList.push_back(entityHandle.GetNetEntityId());
             if (!m_removeEntitiesEvent.IsScheduled())
             {
@@ -140,18 +145,16 @@ namespace Multiplayer
 
     bool NetworkEntityManager::IsMarkedForRemoval(const ConstNetworkEntityHandle& entityHandle) const
     {
-        for (auto removeEntId : m_removeList)
-        {
-            if (entityHandle.GetNetEntityId() == removeEntId)
-            {
-                return true;
-            }
-        }
-        return false;
+        return m_removeSet.contains(entityHandle.GetNetEntityId());
     }
 
     void NetworkEntityManager::ClearEntityFromRemovalList(const ConstNetworkEntityHandle& entityHandle)
     {
+        if (m_removeSet.erase(entityHandle.GetNetEntityId()) == 0)
+        {
+            return;
+        }
+
         for (auto iter = m_removeList.begin(); iter != m_removeList.end(); ++iter)
         {
             if (*iter == entityHandle.GetNetEntityId())
@@ -167,7 +170,10 @@ namespace Multiplayer
         // Note is looping through a hash map not a vector.  Could cause performance issues even on shutdown.
         for (NetworkEntityTracker::iterator it = m_networkEntityTracker.begin(); it != m_networkEntityTracker.end(); ++it)
         {
-            m_removeList.push_back(it->first);
+            if (m_removeSet.insert(it->first).second)
+            {
+                m_removeList.push_back(it->first);
+            }
         }
         RemoveEntities();
 
@@ -248,15 +254,9 @@ namespace Multiplayer
             bool safeToExit = IsHierarchySafeToExit(entityHandle, entitiesNotInDomain);;
 
             // Validate that we aren't already planning to remove this entity
-            if (safeToExit)
+            if (safeToExit && m_removeSet.contains(exitingId))
             {
-                for (auto remoteEntityId : m_removeList)
-                {
-                    if (remoteEntityId == remoteEntityId)
-                    {
-                        safeToExit = false;
-                    }
-                }
+                safeToExit = false;
             }
 
             if (safeToExit)
@@ -392,6 +392,7 @@ namespace Multiplayer
     {
         m_multiplayerComponentRegistry.Reset();
         m_removeList.clear();
+        m_removeSet.clear();
         m_entityDomain = nullptr;
         m_entityExitDomainEvent.DisconnectAllHandlers();
         m_onEntityMarkedDirty.DisconnectAllHandlers();
@@ -405,6 +406,7 @@ namespace Multiplayer
     {
         AZStd::vector<NetEntityId> removeList;
         removeList.swap(m_removeList);
+        m_removeSet.clear();
         for (NetEntityId entityId : removeList)
         {
             NetworkEntityHandle removeEntity = m_networkEntityTracker.Get(entityId);
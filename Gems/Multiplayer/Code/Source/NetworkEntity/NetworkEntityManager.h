@@ -133,6 +133,7 @@ namespace Multiplayer
 
         AZ::ScheduledEvent m_removeEntitiesEvent;
         AZStd::vector<NetEntityId> m_removeList;
+        AZStd::unordered_set<NetEntityId> m_removeSet; //!< The entities in m_removeList, for constant time lookups and so an entity is only queued once
         AZStd::unique_ptr<IEntityDomain> m_entityDomain;
 
         EntityExitDomainEvent m_entityExitDomainEvent;
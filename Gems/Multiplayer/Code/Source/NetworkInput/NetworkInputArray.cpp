@@ -13,7 +13,7 @@
 
 namespace Multiplayer
 {
-    AZ_CVAR(bool, net_useInputDeltaSerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, inputs will use delta-serialization to reduce RPC bandwidth");
+    AZ_CVAR(bool, net_useInputDeltaSerialization, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, inputs will use delta-serialization to reduce RPC bandwidth");
 
     NetworkInputArray::NetworkInputArray()
         : m_owner()
@@ -96,6 +96,11 @@ namespace Multiplayer
 
     void NetworkTime::AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId)
     {
+        if ((frameId != m_hostFrameId) || (blendFactor != m_hostBlendFactor))
+        {
+            // Entities synced to the previous rewound time are out of date
+            ++m_rewindGeneration;
+        }
         m_hostFrameId = frameId;
         m_hostTimeMs = timeMs;
         m_hostBlendFactor = blendFactor;
@@ -130,8 +135,9 @@ namespace Multiplayer
 
         NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         AzFramework::IEntityBoundsUnion* entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
+        const float blendFactor = GetHostBlendFactor();
         AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(expandedVolume,
-            [this, debugDisplay, networkEntityTracker, entityBoundsUnion, rewindVolume](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            [this, debugDisplay, networkEntityTracker, entityBoundsUnion, rewindVolume, blendFactor](const AzFramework::IVisibilityScene::NodeData& nodeData)
         {
             m_rewoundEntities.reserve(m_rewoundEntities.size() + nodeData.m_entries.size());
             for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
@@ -142,6 +148,13 @@ namespace Multiplayer
                     NetworkEntityHandle entityHandle(entity, networkEntityTracker);
                     if (entityHandle.GetNetBindComponent() != nullptr)
                     {
+                        const auto rewoundIter = m_rewoundEntityGenerations.find(entityHandle.GetNetEntityId());
+                        if (rewoundIter != m_rewoundEntityGenerations.end() && rewoundIter->second == m_rewindGeneration)
+                        {
+                            // Already synced to the current rewound time by an earlier query
+                            continue;
+                        }
+
                         const AZ::Aabb currentBounds = entityBoundsUnion->GetEntityWorldBoundsUnion(entity->GetId());
                         const AZ::Vector3 currentCenter = currentBounds.GetCenter();
                         NetworkTransformComponent* networkTransform = entity->template FindComponent<NetworkTransformComponent>();
@@ -156,7 +169,6 @@ namespace Multiplayer
                             // Get the rewound position for target host frame ID plus the one preceding it for potential lerp
                             AZ::Vector3 rewindCenter = networkTransform->GetTranslation();
                             const AZ::Vector3 rewindCenterPrevious = networkTransform->GetTranslationPrevious();
-                            const float blendFactor = GetNetworkTime()->GetHostBlendFactor();
                             if (!AZ::IsClose(blendFactor, 1.0f) && !rewindCenter.IsClose(rewindCenterPrevious))
                             {
                                 // If we have a blend factor, lerp the translation for accuracy
@@ -172,7 +184,15 @@ namespace Multiplayer
 
                             if (AZ::ShapeIntersection::Overlaps(rewoundAabb, rewindVolume)) // Validate the rewound aabb intersects our rewind volume
                             {
-                                m_rewoundEntities.push_back(entityHandle);
+                                if (rewoundIter == m_rewoundEntityGenerations.end())
+                                {
+                                    m_rewoundEntityGenerations.emplace(entityHandle.GetNetEntityId(), m_rewindGeneration);
+                                    m_rewoundEntities.push_back(entityHandle);
+                                }
+                                else
+                                {
+                                    rewoundIter->second = m_rewindGeneration;
+                                }
                                 entityHandle.GetNetBindComponent()->NotifySyncRewindState();
                             }
                         }
@@ -194,5 +214,6 @@ namespace Multiplayer
             }
         }
         m_rewoundEntities.clear();
+        m_rewoundEntityGenerations.clear();
     }
 }
@@ -12,6 +12,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 namespace Multiplayer
 {
@@ -44,6 +45,11 @@ namespace Multiplayer
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
 
+        //! The rewind generation each rewound entity was last synced to, so repeated rewind queries within the same
+        //! rewound time (like multiple shots validated in a tick) don't sync the same entities again.
+        AZStd::unordered_map<NetEntityId, uint32_t> m_rewoundEntityGenerations;
+        uint32_t m_rewindGeneration = 0;
+
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
         AZ::TimeMs m_hostTimeMs = AZ::Time::ZeroTimeMs;
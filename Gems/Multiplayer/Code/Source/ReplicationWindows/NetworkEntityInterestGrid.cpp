@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, sv_InterestGridMaxMoveLogSize, 65536, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of cell moves the interest grid retains, replication windows that fall further behind rebuild from the grid cells");
+
+    bool NetworkEntityInterestGrid::CellCoord::operator==(const CellCoord& rhs) const
+    {
+        return (m_x == rhs.m_x) && (m_y == rhs.m_y);
+    }
+
+    bool NetworkEntityInterestGrid::CellCoord::operator!=(const CellCoord& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    NetworkEntityInterestGrid::NetworkEntityInterestGrid()
+        : m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+    {
+        ;
+    }
+
+    NetworkEntityInterestGrid::~NetworkEntityInterestGrid()
+    {
+        Reset();
+    }
+
+    void NetworkEntityInterestGrid::Initialize(float cellSize)
+    {
+        AZ_Assert(cellSize > 0.0f, "Interest grid cell size must be positive");
+        Reset();
+
+        m_cellSize = AZ::GetMax(cellSize, AZ::Constants::FloatEpsilon);
+        m_inverseCellSize = 1.0f / m_cellSize;
+
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+
+        // Pick up anything that was activated before the grid started tracking
+        if (NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker())
+        {
+            for (const auto& trackedEntity : *networkEntityTracker)
+            {
+                AZ::Entity* entity = trackedEntity.second;
+                if (entity != nullptr && entity->GetState() == AZ::Entity::State::Active)
+                {
+                    OnEntityActivated(entity);
+                }
+            }
+        }
+    }
+
+    void NetworkEntityInterestGrid::Reset()
+    {
+        m_entityActivatedEventHandler.Disconnect();
+        m_entityDeactivatedEventHandler.Disconnect();
+        m_trackedEntities.clear();
+        m_cells.clear();
+
+        // Keep the sequence monotonic so consumers holding an old sequence rebuild rather than misreading the log
+        m_moveLogBaseSequence += m_moveLog.size();
+        m_moveLog.clear();
+
+        m_cellSize = 0.0f;
+        m_inverseCellSize = 0.0f;
+    }
+
+    bool NetworkEntityInterestGrid::IsInitialized() const
+    {
+        return m_cellSize > 0.0f;
+    }
+
+    float NetworkEntityInterestGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    NetworkEntityInterestGrid::CellCoord NetworkEntityInterestGrid::GetCellCoord(const AZ::Vector3& position) const
+    {
+        return CellCoord
+        {
+            aznumeric_cast<int32_t>(AZStd::floor(position.GetX() * m_inverseCellSize)),
+            aznumeric_cast<int32_t>(AZStd::floor(position.GetY() * m_inverseCellSize))
+        };
+    }
+
+    const NetworkEntityInterestGrid::CellEntities* NetworkEntityInterestGrid::GetCellEntities(CellKey cellKey) const
+    {
+        auto cellIter = m_cells.find(cellKey);
+        return (cellIter != m_cells.end()) ? &cellIter->second : nullptr;
+    }
+
+    bool NetworkEntityInterestGrid::GetEntityPosition(const ConstNetworkEntityHandle& entityHandle, AZ::Vector3& outPosition) const
+    {
+        auto entityIter = m_trackedEntities.find(entityHandle.GetNetEntityId());
+        if (entityIter == m_trackedEntities.end())
+        {
+            return false;
+        }
+        outPosition = entityIter->second->m_position;
+        return true;
+    }
+
+    uint64_t NetworkEntityInterestGrid::GetNextMoveSequence() const
+    {
+        return m_moveLogBaseSequence + m_moveLog.size();
+    }
+
+    uint64_t NetworkEntityInterestGrid::GetOldestMoveSequence() const
+    {
+        return m_moveLogBaseSequence;
+    }
+
+    const NetworkEntityInterestGrid::CellMove& NetworkEntityInterestGrid::GetMove(uint64_t sequence) const
+    {
+        AZ_Assert(sequence >= GetOldestMoveSequence() && sequence < GetNextMoveSequence(), "Requested move is outside the move log");
+        return m_moveLog[aznumeric_cast<size_t>(sequence - m_moveLogBaseSequence)];
+    }
+
+    NetworkEntityInterestGrid::CellKey NetworkEntityInterestGrid::GetCellKey(const CellCoord& cellCoord)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(cellCoord.m_x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(cellCoord.m_y));
+    }
+
+    NetworkEntityInterestGrid::CellCoord NetworkEntityInterestGrid::GetCellCoord(CellKey cellKey)
+    {
+        return CellCoord{ static_cast<int32_t>(static_cast<uint32_t>(cellKey >> 32)), static_cast<int32_t>(static_cast<uint32_t>(cellKey)) };
+    }
+
+    bool NetworkEntityInterestGrid::IsCellInRadius(const CellCoord& cellCoord, const CellCoord& centerCoord, float cellSize, float radius)
+    {
+        // Closest distance between the two cells, adjacent cells touch so they are always in range
+        const float deltaX = aznumeric_cast<float>(AZ::GetMax(AZStd::abs(cellCoord.m_x - centerCoord.m_x) - 1, 0)) * cellSize;
+        const float deltaY = aznumeric_cast<float>(AZ::GetMax(AZStd::abs(cellCoord.m_y - centerCoord.m_y) - 1, 0)) * cellSize;
+        return (deltaX * deltaX + deltaY * deltaY) <= (radius * radius);
+    }
+
+    int32_t NetworkEntityInterestGrid::GetCellRadius(float cellSize, float radius)
+    {
+        return aznumeric_cast<int32_t>(AZStd::ceil(radius / cellSize)) + 1;
+    }
+
+    void NetworkEntityInterestGrid::OnEntityActivated(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity);
+        NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if (netBindComponent == nullptr || !netBindComponent->HasController())
+        {
+            // Only entities we have control over are replicated to clients
+            return;
+        }
+
+        if (m_trackedEntities.find(entityHandle.GetNetEntityId()) != m_trackedEntities.end())
+        {
+            return;
+        }
+
+        TrackEntity(entity);
+    }
+
+    void NetworkEntityInterestGrid::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        ConstNetworkEntityHandle entityHandle(entity);
+        auto entityIter = m_trackedEntities.find(entityHandle.GetNetEntityId());
+        if (entityIter == m_trackedEntities.end())
+        {
+            return;
+        }
+
+        TrackedEntity& trackedEntity = *entityIter->second;
+        auto cellIter = m_cells.find(trackedEntity.m_cellKey);
+        if (cellIter != m_cells.end())
+        {
+            cellIter->second.erase(trackedEntity.m_entityHandle);
+            if (cellIter->second.empty())
+            {
+                m_cells.erase(cellIter);
+            }
+        }
+        AppendMove(trackedEntity.m_entityHandle, trackedEntity.m_cellKey, InvalidCellKey);
+        m_trackedEntities.erase(entityIter);
+    }
+
+    void NetworkEntityInterestGrid::TrackEntity(AZ::Entity* entity)
+    {
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if (transformInterface == nullptr)
+        {
+            return;
+        }
+
+        AZStd::unique_ptr<TrackedEntity> trackedEntity = AZStd::make_unique<TrackedEntity>();
+        trackedEntity->m_entityHandle = ConstNetworkEntityHandle(entity);
+
+        TrackedEntity* trackedEntityPtr = trackedEntity.get();
+        trackedEntity->m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, trackedEntityPtr](const AZ::Transform&, const AZ::Transform& worldTm)
+            {
+                UpdateEntityPosition(*trackedEntityPtr, worldTm.GetTranslation());
+            });
+        transformInterface->BindTransformChangedEventHandler(trackedEntity->m_transformChangedHandler);
+
+        const NetEntityId netEntityId = trackedEntity->m_entityHandle.GetNetEntityId();
+        m_trackedEntities.emplace(netEntityId, AZStd::move(trackedEntity));
+        UpdateEntityPosition(*trackedEntityPtr, transformInterface->GetWorldTranslation());
+    }
+
+    void NetworkEntityInterestGrid::UpdateEntityPosition(TrackedEntity& trackedEntity, const AZ::Vector3& position)
+    {
+        trackedEntity.m_position = position;
+
+        const CellKey cellKey = GetCellKey(GetCellCoord(position));
+        if (cellKey == trackedEntity.m_cellKey)
+        {
+            // Movement within a cell doesn't change anyone's interest
+            return;
+        }
+
+        const CellKey previousCellKey = trackedEntity.m_cellKey;
+        if (previousCellKey != InvalidCellKey)
+        {
+            auto cellIter = m_cells.find(previousCellKey);
+            if (cellIter != m_cells.end())
+            {
+                cellIter->second.erase(trackedEntity.m_entityHandle);
+                if (cellIter->second.empty())
+                {
+                    m_cells.erase(cellIter);
+                }
+            }
+        }
+
+        m_cells[cellKey].insert(trackedEntity.m_entityHandle);
+        trackedEntity.m_cellKey = cellKey;
+        AppendMove(trackedEntity.m_entityHandle, previousCellKey, cellKey);
+    }
+
+    void NetworkEntityInterestGrid::AppendMove(const ConstNetworkEntityHandle& entityHandle, CellKey fromCell, CellKey toCell)
+    {
+        m_moveLog.push_back(CellMove{ entityHandle, fromCell, toCell });
+
+        const uint32_t maxMoveLogSize = AZ::GetMax(static_cast<uint32_t>(sv_InterestGridMaxMoveLogSize), 1u);
+        while (m_moveLog.size() > maxMoveLogSize)
+        {
+            m_moveLog.pop_front();
+            ++m_moveLogBaseSequence;
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Multiplayer
+{
+    //! @class NetworkEntityInterestGrid
+    //! @brief A uniform grid over the horizontal plane that buckets all controlled network entities on a server.
+    //! The grid is shared by every ServerToClientReplicationWindow. Entities are rebucketed when their transform changes,
+    //! and every change of cell is appended to a move log. Replication windows consume the move log to apply add and
+    //! remove deltas to their replication sets, so their update cost follows entity movement rather than world population.
+    class NetworkEntityInterestGrid
+    {
+    public:
+
+        using CellKey = uint64_t;
+        using CellEntities = AZStd::unordered_set<ConstNetworkEntityHandle>;
+
+        static constexpr CellKey InvalidCellKey = AZStd::numeric_limits<CellKey>::max();
+
+        struct CellCoord
+        {
+            int32_t m_x = 0;
+            int32_t m_y = 0;
+            bool operator==(const CellCoord& rhs) const;
+            bool operator!=(const CellCoord& rhs) const;
+        };
+
+        //! A single change of cell, entities being added to or removed from the grid use InvalidCellKey for their source or destination.
+        struct CellMove
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            CellKey m_fromCell = InvalidCellKey;
+            CellKey m_toCell = InvalidCellKey;
+        };
+
+        NetworkEntityInterestGrid();
+        ~NetworkEntityInterestGrid();
+
+        //! Starts tracking controlled network entities, any entities that are already active are added immediately.
+        //! @param cellSize the width and depth of a single grid cell in world units
+        void Initialize(float cellSize);
+
+        //! Stops tracking entities and releases all memory.
+        void Reset();
+
+        //! Returns true if the grid is currently tracking entities.
+        //! @return boolean true if the grid is currently tracking entities
+        bool IsInitialized() const;
+
+        //! Returns the width and depth of a single grid cell in world units.
+        //! @return the width and depth of a single grid cell in world units
+        float GetCellSize() const;
+
+        //! Returns the coordinate of the cell containing the provided position.
+        //! @param position the world position to look up
+        //! @return the coordinate of the cell containing the provided position
+        CellCoord GetCellCoord(const AZ::Vector3& position) const;
+
+        //! Returns the set of entities contained in the provided cell.
+        //! @param cellKey the key of the cell to look up
+        //! @return pointer to the set of contained entities, nullptr if the cell is empty
+        const CellEntities* GetCellEntities(CellKey cellKey) const;
+
+        //! Retrieves the last known position of a tracked entity.
+        //! @param entityHandle the entity to look up
+        //! @param outPosition on success, the last known position of the entity
+        //! @return boolean true if the entity is tracked by the grid
+        bool GetEntityPosition(const ConstNetworkEntityHandle& entityHandle, AZ::Vector3& outPosition) const;
+
+        //! Returns the sequence number that will be assigned to the next move appended to the move log.
+        //! @return the sequence number that will be assigned to the next move appended to the move log
+        uint64_t GetNextMoveSequence() const;
+
+        //! Returns the sequence number of the oldest move still held in the move log.
+        //! Consumers that have fallen behind this sequence have missed moves and must rebuild their state from the cells.
+        //! @return the sequence number of the oldest move still held in the move log
+        uint64_t GetOldestMoveSequence() const;
+
+        //! Returns the move with the provided sequence number.
+        //! @param sequence the sequence number to look up, must be in the range [GetOldestMoveSequence(), GetNextMoveSequence())
+        //! @return the move with the provided sequence number
+        const CellMove& GetMove(uint64_t sequence) const;
+
+        //! Packs a cell coordinate into a cell key.
+        static CellKey GetCellKey(const CellCoord& cellCoord);
+
+        //! Unpacks a cell key into a cell coordinate.
+        static CellCoord GetCellCoord(CellKey cellKey);
+
+        //! Returns true if any point of the cell can be within radius of any point of the center cell.
+        //! Measuring from the whole center cell means interest only has to be re-evaluated when an observer changes cells.
+        //! @param cellCoord   the cell to test
+        //! @param centerCoord the cell containing the observer
+        //! @param cellSize    the width and depth of a single grid cell in world units
+        //! @param radius      the interest radius in world units
+        //! @return boolean true if the cell is within the interest radius of the center cell
+        static bool IsCellInRadius(const CellCoord& cellCoord, const CellCoord& centerCoord, float cellSize, float radius);
+
+        //! Returns the number of cells between the center cell and the edge of the interest area along either axis.
+        //! @param cellSize the width and depth of a single grid cell in world units
+        //! @param radius   the interest radius in world units
+        //! @return the number of cells between the center cell and the edge of the interest area along either axis
+        static int32_t GetCellRadius(float cellSize, float radius);
+
+    private:
+
+        struct TrackedEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            CellKey m_cellKey = InvalidCellKey;
+        };
+
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+        void TrackEntity(AZ::Entity* entity);
+        void UpdateEntityPosition(TrackedEntity& trackedEntity, const AZ::Vector3& position);
+        void AppendMove(const ConstNetworkEntityHandle& entityHandle, CellKey fromCell, CellKey toCell);
+
+        AZ_DISABLE_COPY_MOVE(NetworkEntityInterestGrid);
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+
+        // Tracked entities are heap allocated so the transform handlers can safely reference them across rehashes
+        AZStd::unordered_map<NetEntityId, AZStd::unique_ptr<TrackedEntity>> m_trackedEntities;
+        AZStd::unordered_map<CellKey, CellEntities> m_cells;
+
+        AZStd::deque<CellMove> m_moveLog;
+        uint64_t m_moveLogBaseSequence = 0;
+
+        float m_cellSize = 0.0f;
+        float m_inverseCellSize = 0.0f;
+    };
+}
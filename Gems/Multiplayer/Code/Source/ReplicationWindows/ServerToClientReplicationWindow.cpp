@@ -51,8 +51,9 @@ namespace Multiplayer
         return m_priority < rhs.m_priority;
     }
 
-    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection)
-        : m_controlledEntity(controlledEntity)
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, NetworkEntityInterestGrid* interestGrid)
+        : m_interestGrid(interestGrid)
+        , m_controlledEntity(controlledEntity)
         , m_connection(connection)
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
@@ -69,6 +70,7 @@ namespace Multiplayer
         if (!m_controlledEntity.Exists())
         {
             m_replicationSet.clear();
+            m_interestValid = false;
         }
         return true;
     }
@@ -92,6 +94,20 @@ namespace Multiplayer
 
     void ServerToClientReplicationWindow::UpdateWindow()
     {
+        if ((m_interestGrid != nullptr) && m_interestGrid->IsInitialized())
+        {
+            UpdateWindowFromInterestGrid();
+        }
+        else
+        {
+            UpdateWindowFromVisibilitySystem();
+        }
+    }
+
+    void ServerToClientReplicationWindow::UpdateWindowFromVisibilitySystem()
+    {
+        m_interestValid = false;
+
         // Clear the candidate queue, we're going to rebuild it
         ReplicationCandidateQueue::container_type clearQueueContainer;
         clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
@@ -182,6 +198,66 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::UpdateWindowFromInterestGrid()
+    {
+        NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+        if (!netBindComponent || !netBindComponent->HasController())
+        {
+            // If we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            ResetInterest();
+            return;
+        }
+
+        EvaluateConnection();
+
+        m_interestPosition = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTranslation();
+        const NetworkEntityInterestGrid::CellCoord centerCoord = m_interestGrid->GetCellCoord(m_interestPosition);
+
+        const bool canApplyDeltas = m_interestValid
+            && (m_interestCellSize == m_interestGrid->GetCellSize())
+            && (m_interestRadius == static_cast<float>(sv_ClientAwarenessRadius))
+            && (m_interestSequence >= m_interestGrid->GetOldestMoveSequence());
+        if (canApplyDeltas)
+        {
+            // Bring the interest set up to date against the previous center first, then move the center
+            const uint64_t nextSequence = m_interestGrid->GetNextMoveSequence();
+            for (uint64_t sequence = m_interestSequence; sequence < nextSequence; ++sequence)
+            {
+                const NetworkEntityInterestGrid::CellMove& move = m_interestGrid->GetMove(sequence);
+                if (IsCellInInterest(move.m_toCell, m_interestCenter))
+                {
+                    AddInterest(move.m_entityHandle);
+                }
+                else if (IsCellInInterest(move.m_fromCell, m_interestCenter))
+                {
+                    RemoveInterest(move.m_entityHandle);
+                }
+            }
+
+            if (centerCoord != m_interestCenter)
+            {
+                ShiftInterest(centerCoord);
+            }
+        }
+        else
+        {
+            RebuildInterest(centerCoord);
+        }
+        m_interestSequence = m_interestGrid->GetNextMoveSequence();
+
+        // Filtering can change at any time and over budget sets need to be prioritized, both require a pass over the interest set.
+        // Otherwise the deltas above have already been applied to the replication set.
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        const bool isOverBudget = m_interestEntities.size() > sv_MaxEntitiesToTrackReplication;
+        if (!m_interestIncremental || isOverBudget || (filterEntityManager != nullptr))
+        {
+            RebuildInterestReplicationSet(filterEntityManager);
+        }
+        m_interestIncremental = !isOverBudget && (filterEntityManager == nullptr);
+
+        UpdateForcedReplicationSet();
+    }
+
     AzNetworking::PacketId ServerToClientReplicationWindow::SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector)
     {
         MultiplayerPackets::EntityUpdates entityUpdatePacket;
@@ -268,6 +344,12 @@ namespace Multiplayer
             // Make sure we would be in the awareness radius
             if (distSq < awarenessSq)
             {
+                if (m_interestValid)
+                {
+                    // Bypass the candidate queue, it is only valid directly after a full rebuild of the interest replication set
+                    m_interestEntities.insert(entityHandle);
+                    return AddInterestToReplicationSet(entityHandle);
+                }
                 AddEntityToReplicationSet(entityHandle, 1.0f, distSq);
                 return true;
             }
@@ -282,6 +364,8 @@ namespace Multiplayer
         if (entityHandle.GetNetBindComponent() != nullptr)
         {
             m_replicationSet.erase(entityHandle);
+            m_interestEntities.erase(entityHandle);
+            m_forcedEntities.erase(entityHandle);
         }
     }
 
@@ -342,6 +426,221 @@ namespace Multiplayer
         }
     }
 
+    void ServerToClientReplicationWindow::ResetInterest()
+    {
+        m_replicationSet.clear();
+        m_interestEntities.clear();
+        m_forcedEntities.clear();
+        m_interestValid = false;
+        m_interestIncremental = false;
+    }
+
+    void ServerToClientReplicationWindow::RebuildInterest(const NetworkEntityInterestGrid::CellCoord& centerCoord)
+    {
+        ResetInterest();
+
+        m_interestCenter = centerCoord;
+        m_interestCellSize = m_interestGrid->GetCellSize();
+        m_interestRadius = sv_ClientAwarenessRadius;
+        m_interestValid = true;
+
+        const int32_t cellRadius = NetworkEntityInterestGrid::GetCellRadius(m_interestCellSize, m_interestRadius);
+        for (int32_t y = centerCoord.m_y - cellRadius; y <= centerCoord.m_y + cellRadius; ++y)
+        {
+            for (int32_t x = centerCoord.m_x - cellRadius; x <= centerCoord.m_x + cellRadius; ++x)
+            {
+                const NetworkEntityInterestGrid::CellKey cellKey = NetworkEntityInterestGrid::GetCellKey({ x, y });
+                if (!IsCellInInterest(cellKey, centerCoord))
+                {
+                    continue;
+                }
+
+                if (const NetworkEntityInterestGrid::CellEntities* cellEntities = m_interestGrid->GetCellEntities(cellKey))
+                {
+                    m_interestEntities.insert(cellEntities->begin(), cellEntities->end());
+                }
+            }
+        }
+    }
+
+    void ServerToClientReplicationWindow::ShiftInterest(const NetworkEntityInterestGrid::CellCoord& centerCoord)
+    {
+        const NetworkEntityInterestGrid::CellCoord previousCoord = m_interestCenter;
+        const int32_t cellRadius = NetworkEntityInterestGrid::GetCellRadius(m_interestCellSize, m_interestRadius);
+
+        // Only the cells along the leading and trailing edges change, everything else stays in the interest set
+        for (int32_t y = previousCoord.m_y - cellRadius; y <= previousCoord.m_y + cellRadius; ++y)
+        {
+            for (int32_t x = previousCoord.m_x - cellRadius; x <= previousCoord.m_x + cellRadius; ++x)
+            {
+                const NetworkEntityInterestGrid::CellKey cellKey = NetworkEntityInterestGrid::GetCellKey({ x, y });
+                if (!IsCellInInterest(cellKey, previousCoord) || IsCellInInterest(cellKey, centerCoord))
+                {
+                    continue;
+                }
+
+                if (const NetworkEntityInterestGrid::CellEntities* cellEntities = m_interestGrid->GetCellEntities(cellKey))
+                {
+                    for (const ConstNetworkEntityHandle& entityHandle : *cellEntities)
+                    {
+                        RemoveInterest(entityHandle);
+                    }
+                }
+            }
+        }
+
+        for (int32_t y = centerCoord.m_y - cellRadius; y <= centerCoord.m_y + cellRadius; ++y)
+        {
+            for (int32_t x = centerCoord.m_x - cellRadius; x <= centerCoord.m_x + cellRadius; ++x)
+            {
+                const NetworkEntityInterestGrid::CellKey cellKey = NetworkEntityInterestGrid::GetCellKey({ x, y });
+                if (!IsCellInInterest(cellKey, centerCoord) || IsCellInInterest(cellKey, previousCoord))
+                {
+                    continue;
+                }
+
+                if (const NetworkEntityInterestGrid::CellEntities* cellEntities = m_interestGrid->GetCellEntities(cellKey))
+                {
+                    for (const ConstNetworkEntityHandle& entityHandle : *cellEntities)
+                    {
+                        AddInterest(entityHandle);
+                    }
+                }
+            }
+        }
+
+        m_interestCenter = centerCoord;
+    }
+
+    bool ServerToClientReplicationWindow::IsCellInInterest(NetworkEntityInterestGrid::CellKey cellKey, const NetworkEntityInterestGrid::CellCoord& centerCoord) const
+    {
+        if (cellKey == NetworkEntityInterestGrid::InvalidCellKey)
+        {
+            return false;
+        }
+        return NetworkEntityInterestGrid::IsCellInRadius(NetworkEntityInterestGrid::GetCellCoord(cellKey), centerCoord, m_interestCellSize, m_interestRadius);
+    }
+
+    void ServerToClientReplicationWindow::AddInterest(const ConstNetworkEntityHandle& entityHandle)
+    {
+        if (m_interestEntities.insert(entityHandle).second && m_interestIncremental)
+        {
+            AddInterestToReplicationSet(entityHandle);
+        }
+    }
+
+    void ServerToClientReplicationWindow::RemoveInterest(const ConstNetworkEntityHandle& entityHandle)
+    {
+        if ((m_interestEntities.erase(entityHandle) > 0) && m_interestIncremental && !m_forcedEntities.contains(entityHandle))
+        {
+            m_replicationSet.erase(entityHandle);
+        }
+    }
+
+    bool ServerToClientReplicationWindow::AddInterestToReplicationSet(const ConstNetworkEntityHandle& entityHandle)
+    {
+        NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if (netBindComponent == nullptr)
+        {
+            return false;
+        }
+
+        if (!sv_ReplicateServerProxies && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+        {
+            // Proxy replication disabled
+            return false;
+        }
+
+        float distanceSquared = 0.0f;
+        const float priority = GetInterestPriority(entityHandle, distanceSquared);
+        m_replicationSet.emplace(entityHandle, EntityReplicationData{ NetEntityRole::Client, priority });
+        return true;
+    }
+
+    void ServerToClientReplicationWindow::RebuildInterestReplicationSet(IFilterEntityManager* filterEntityManager)
+    {
+        // Clear the candidate queue, we're going to rebuild it
+        ReplicationCandidateQueue::container_type clearQueueContainer;
+        clearQueueContainer.reserve(sv_MaxEntitiesToTrackReplication);
+        ReplicationCandidateQueue clearQueue(ReplicationCandidateQueue::value_compare{}, AZStd::move(clearQueueContainer));
+        m_candidateQueue.swap(clearQueue);
+        m_replicationSet.clear();
+        m_forcedEntities.clear();
+
+        for (ConstNetworkEntityHandle entityHandle : m_interestEntities)
+        {
+            if (entityHandle.GetNetBindComponent() == nullptr)
+            {
+                // Entity does not have netbinding, skip this entity
+                continue;
+            }
+
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
+
+            float distanceSquared = 0.0f;
+            const float priority = GetInterestPriority(entityHandle, distanceSquared);
+            AddEntityToReplicationSet(entityHandle, priority, distanceSquared);
+        }
+    }
+
+    void ServerToClientReplicationWindow::UpdateForcedReplicationSet()
+    {
+        AZStd::unordered_set<ConstNetworkEntityHandle> forcedEntities;
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+                forcedEntities.insert(entityHandle);
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+        forcedEntities.insert(m_controlledEntity);
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+            for (const AZ::Entity* hierarchyEntity : hierarchyComponent->GetHierarchicalEntities())
+            {
+                forcedEntities.insert(networkEntityManager->GetEntity(networkEntityManager->GetNetEntityIdById(hierarchyEntity->GetId())));
+            }
+        }
+
+        // Anything that lost its forced relevancy falls back to whatever the interest set says about it
+        for (const ConstNetworkEntityHandle& entityHandle : m_forcedEntities)
+        {
+            if (!forcedEntities.contains(entityHandle))
+            {
+                m_replicationSet.erase(entityHandle);
+                if (m_interestEntities.contains(entityHandle))
+                {
+                    AddInterestToReplicationSet(entityHandle);
+                }
+            }
+        }
+        m_forcedEntities = AZStd::move(forcedEntities);
+    }
+
+    float ServerToClientReplicationWindow::GetInterestPriority(const ConstNetworkEntityHandle& entityHandle, float& outDistanceSquared) const
+    {
+        AZ::Vector3 entityPosition = m_interestPosition;
+        m_interestGrid->GetEntityPosition(entityHandle, entityPosition);
+        outDistanceSquared = m_interestPosition.GetDistanceSq(entityPosition);
+        return (outDistanceSquared > 0.0f) ? 1.0f / outDistanceSquared : 0.0f;
+    }
+
     void ServerToClientReplicationWindow::UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent)
     {
         INetworkEntityManager* networkEntityManager = AZ::Interface<INetworkEntityManager>::Get();
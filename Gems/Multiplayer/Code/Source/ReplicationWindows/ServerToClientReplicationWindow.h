@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -39,7 +40,12 @@ namespace Multiplayer
         // we sort lowest priority first, so that we can easily keep the biggest N priorities
         using ReplicationCandidateQueue = AZStd::priority_queue<PrioritizedReplicationCandidate>;
 
-        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection);
+        //! Constructs a replication window for a client connection.
+        //! @param controlledEntity the entity controlled by the remote client, relevancy is measured from this entity
+        //! @param connection       the connection to the remote client
+        //! @param interestGrid     optional shared interest grid, if provided and initialized the window is updated incrementally
+        //!                         from grid deltas instead of querying the visibility system on every update
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity, AzNetworking::IConnection* connection, NetworkEntityInterestGrid* interestGrid = nullptr);
 
         //! IReplicationWindow interface
         //! @{
@@ -60,15 +66,44 @@ namespace Multiplayer
 
         void UpdateHierarchyReplicationSet(ReplicationSet& replicationSet, NetworkHierarchyRootComponent& hierarchyComponent);
 
+        void UpdateWindowFromVisibilitySystem();
+        void UpdateWindowFromInterestGrid();
+
         void EvaluateConnection();
         void AddEntityToReplicationSet(ConstNetworkEntityHandle& entityHandle, float priority, float distanceSquared);
 
+        //! Interest grid helpers, the interest set holds every entity in a grid cell within the awareness radius.
+        //! @{
+        void ResetInterest();
+        void RebuildInterest(const NetworkEntityInterestGrid::CellCoord& centerCoord);
+        void ShiftInterest(const NetworkEntityInterestGrid::CellCoord& centerCoord);
+        bool IsCellInInterest(NetworkEntityInterestGrid::CellKey cellKey, const NetworkEntityInterestGrid::CellCoord& centerCoord) const;
+        void AddInterest(const ConstNetworkEntityHandle& entityHandle);
+        void RemoveInterest(const ConstNetworkEntityHandle& entityHandle);
+        bool AddInterestToReplicationSet(const ConstNetworkEntityHandle& entityHandle);
+        void RebuildInterestReplicationSet(IFilterEntityManager* filterEntityManager);
+        void UpdateForcedReplicationSet();
+        float GetInterestPriority(const ConstNetworkEntityHandle& entityHandle, float& outDistanceSquared) const;
+        //! @}
+
         ServerToClientReplicationWindow& operator=(const ServerToClientReplicationWindow&) = delete;
 
         // sorted in reverse, lowest priority is the top()
         ReplicationCandidateQueue m_candidateQueue;
         ReplicationSet m_replicationSet;
 
+        // Incremental interest management state, only used when a shared interest grid is available
+        NetworkEntityInterestGrid* m_interestGrid = nullptr;
+        AZStd::unordered_set<ConstNetworkEntityHandle> m_interestEntities;
+        AZStd::unordered_set<ConstNetworkEntityHandle> m_forcedEntities; // Always relevant, autonomous, and hierarchy entities
+        NetworkEntityInterestGrid::CellCoord m_interestCenter;
+        AZ::Vector3 m_interestPosition = AZ::Vector3::CreateZero();
+        uint64_t m_interestSequence = 0;
+        float m_interestCellSize = 0.0f;
+        float m_interestRadius = 0.0f;
+        bool m_interestValid = false;
+        bool m_interestIncremental = false; // If false the replication set must be rebuilt from the interest set on the next update
+
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
 
@@ -11,6 +11,7 @@
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzTest/AzTest.h>
+#include <AzCore/std/parallel/thread.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
 
 namespace Multiplayer
@@ -71,4 +72,55 @@ namespace Multiplayer
         EXPECT_EQ(valueMap.size(), NumTestEntriesPlusSize);
     }
 
+    TEST_F(MultiplayerComponentTests, ConcurrentRecordingAccumulatesPropertySentFromAllThreads)
+    {
+        constexpr uint32_t NumThreads = 4;
+        constexpr uint32_t NumRecordsPerThread = 1000;
+        constexpr uint32_t BytesPerRecord = 3;
+
+        const NetComponentId componentId = aznumeric_cast<NetComponentId>(0);
+        const PropertyIndex propertyIndex = aznumeric_cast<PropertyIndex>(0);
+        MultiplayerStats stats;
+        stats.ReserveComponentStats(componentId, 1, 0);
+        EXPECT_FALSE(stats.HasSerializeHandlers());
+
+        stats.BeginConcurrentRecording();
+        AZStd::vector<AZStd::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads.emplace_back([&stats, componentId, propertyIndex]()
+            {
+                for (uint32_t recordIndex = 0; recordIndex < NumRecordsPerThread; ++recordIndex)
+                {
+                    stats.RecordPropertySent(componentId, propertyIndex, BytesPerRecord);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        const uint64_t contentionCount = stats.EndConcurrentRecording();
+        EXPECT_LE(contentionCount, NumThreads * NumRecordsPerThread);
+
+        const MultiplayerStats::Metric metric = stats.CalculateTotalPropertyUpdateSentMetrics();
+        EXPECT_EQ(metric.m_totalCalls, NumThreads * NumRecordsPerThread);
+        EXPECT_EQ(metric.m_totalBytes, NumThreads * NumRecordsPerThread * BytesPerRecord);
+
+        // Contention is reset once concurrent recording ends
+        EXPECT_EQ(stats.EndConcurrentRecording(), 0);
+    }
+
+    TEST_F(MultiplayerComponentTests, SerializeHandlersAreDetected)
+    {
+        MultiplayerStats stats;
+        AZ::Event<AzNetworking::SerializerMode, AZ::EntityId, const char*>::Handler entitySerializeStartHandler(
+            [](AzNetworking::SerializerMode, AZ::EntityId, const char*) {});
+        EXPECT_FALSE(stats.HasSerializeHandlers());
+        entitySerializeStartHandler.Connect(stats.m_events.m_entitySerializeStart);
+        EXPECT_TRUE(stats.HasSerializeHandlers());
+        entitySerializeStartHandler.Disconnect();
+        EXPECT_FALSE(stats.HasSerializeHandlers());
+    }
+
 } // namespace Multiplayer
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class NetworkEntityInterestGridTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(NetworkEntityInterestGridTests, CellKeyRoundTrip)
+    {
+        const NetworkEntityInterestGrid::CellCoord coords[] = { { 0, 0 }, { 1, -1 }, { -1, 1 }, { -12345, 67890 }, { INT32_MAX, INT32_MIN } };
+        for (const NetworkEntityInterestGrid::CellCoord& coord : coords)
+        {
+            const NetworkEntityInterestGrid::CellKey cellKey = NetworkEntityInterestGrid::GetCellKey(coord);
+            EXPECT_NE(cellKey, NetworkEntityInterestGrid::InvalidCellKey);
+            EXPECT_EQ(NetworkEntityInterestGrid::GetCellCoord(cellKey), coord);
+        }
+    }
+
+    TEST_F(NetworkEntityInterestGridTests, PositionToCell)
+    {
+        NetworkEntityInterestGrid interestGrid;
+        EXPECT_FALSE(interestGrid.IsInitialized());
+
+        interestGrid.Initialize(10.0f);
+        EXPECT_TRUE(interestGrid.IsInitialized());
+        EXPECT_EQ(interestGrid.GetNextMoveSequence(), interestGrid.GetOldestMoveSequence());
+
+        const NetworkEntityInterestGrid::CellCoord positive = interestGrid.GetCellCoord(AZ::Vector3(15.0f, 9.9f, 1000.0f));
+        EXPECT_EQ(positive, NetworkEntityInterestGrid::CellCoord({ 1, 0 }));
+
+        // Negative positions round down so cell 0 isn't twice as wide as the others
+        const NetworkEntityInterestGrid::CellCoord negative = interestGrid.GetCellCoord(AZ::Vector3(-0.1f, -10.1f, -1000.0f));
+        EXPECT_EQ(negative, NetworkEntityInterestGrid::CellCoord({ -1, -2 }));
+
+        interestGrid.Reset();
+        EXPECT_FALSE(interestGrid.IsInitialized());
+    }
+
+    TEST_F(NetworkEntityInterestGridTests, CellRadius)
+    {
+        constexpr float CellSize = 10.0f;
+        constexpr float Radius = 25.0f;
+        const NetworkEntityInterestGrid::CellCoord center = { 3, -7 };
+
+        // Adjacent cells touch the center cell and are always in range
+        EXPECT_TRUE(NetworkEntityInterestGrid::IsCellInRadius({ 4, -6 }, center, CellSize, 0.0f));
+        EXPECT_FALSE(NetworkEntityInterestGrid::IsCellInRadius({ 5, -7 }, center, CellSize, 0.0f));
+
+        EXPECT_TRUE(NetworkEntityInterestGrid::IsCellInRadius({ 6, -7 }, center, CellSize, Radius));
+        EXPECT_FALSE(NetworkEntityInterestGrid::IsCellInRadius({ 7, -7 }, center, CellSize, Radius));
+        EXPECT_FALSE(NetworkEntityInterestGrid::IsCellInRadius({ 6, -4 }, center, CellSize, Radius));
+
+        // Every cell in range must be inside the square that replication windows iterate
+        const int32_t cellRadius = NetworkEntityInterestGrid::GetCellRadius(CellSize, Radius);
+        for (int32_t y = center.m_y - cellRadius - 2; y <= center.m_y + cellRadius + 2; ++y)
+        {
+            for (int32_t x = center.m_x - cellRadius - 2; x <= center.m_x + cellRadius + 2; ++x)
+            {
+                if (NetworkEntityInterestGrid::IsCellInRadius({ x, y }, center, CellSize, Radius))
+                {
+                    EXPECT_LE(AZStd::abs(x - center.m_x), cellRadius);
+                    EXPECT_LE(AZStd::abs(y - center.m_y), cellRadius);
+                }
+            }
+        }
+    }
+}
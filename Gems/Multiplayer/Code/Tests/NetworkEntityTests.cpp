@@ -10,6 +10,7 @@
 #include <TestMultiplayerComponent.h>
 #include <Source/NetworkEntity/NetworkEntityManager.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/EntityDomains/AabbEntityDomain.h>
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
@@ -162,6 +163,31 @@ namespace Multiplayer
         domain->DebugDraw();
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestAabbDomain)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const HostId localhost = HostId("127.0.0.1", 6777, ProtocolType::Udp);
+
+        m_networkEntityManager->Initialize(localhost, AZStd::make_unique<AabbEntityDomain>());
+        EXPECT_TRUE(m_networkEntityManager->IsInitialized());
+        IEntityDomain* domain = m_networkEntityManager->GetEntityDomain();
+        EXPECT_NE(domain, nullptr);
+        EXPECT_EQ(domain->GetAabb(), AZ::Aabb::CreateNull());
+        EXPECT_FALSE(domain->IsInDomain(handle));
+
+        // The root entity sits at the origin
+        const AZ::Aabb outsideAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(1, 1, 1), AZ::Vector3(2, 2, 2));
+        domain->SetAabb(outsideAabb);
+        EXPECT_EQ(domain->GetAabb(), outsideAabb);
+        EXPECT_FALSE(domain->IsInDomain(handle));
+        domain->SetAabb(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1, -1, -1), AZ::Vector3(1, 1, 1)));
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        domain->HandleLossOfAuthoritativeReplicator(handle);
+        EXPECT_TRUE(m_networkEntityManager->IsMarkedForRemoval(handle));
+        domain->DebugDraw();
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityTracker)
     {
         const NetworkEntityTracker* constNetEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
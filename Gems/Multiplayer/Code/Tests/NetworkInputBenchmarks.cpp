@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+
+namespace Multiplayer
+{
+    /*
+     * Measures the cost of the client input RPC payload, the first replication path a simulated client exercises.
+     * The benchmark argument toggles net_useInputDeltaSerialization.
+     */
+    class NetworkInputArrayBenchmark : public HierarchyBenchmarkBase
+    {
+    public:
+        const NetEntityId RootNetEntityId = NetEntityId{ 1 };
+
+        void internalSetUp() override
+        {
+            HierarchyBenchmarkBase::internalSetUp();
+
+            m_root = AZStd::make_unique<EntityInfo>(1, "root", RootNetEntityId, EntityInfo::Role::None);
+            CreateParent(*m_root);
+
+            const NetworkEntityHandle handle(m_root->m_entity.get(), m_NetworkEntityManager->GetNetworkEntityTracker());
+            m_inputArray = AZStd::make_unique<NetworkInputArray>(handle);
+            for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+            {
+                (*m_inputArray)[i].SetClientInputId(ClientInputId(NetworkInputArray::MaxElements - i));
+                (*m_inputArray)[i].SetHostFrameId(HostFrameId(NetworkInputArray::MaxElements - i));
+                (*m_inputArray)[i].SetHostTimeMs(AZ::TimeMs((NetworkInputArray::MaxElements - i) * 33));
+            }
+        }
+
+        void internalTearDown() override
+        {
+            m_inputArray.reset();
+            m_root.reset();
+            SetDeltaSerialization(true);
+
+            HierarchyBenchmarkBase::internalTearDown();
+        }
+
+        void SetDeltaSerialization(bool enabled)
+        {
+            m_console->PerformCommand(enabled ? "net_useInputDeltaSerialization true" : "net_useInputDeltaSerialization false");
+        }
+
+        AZStd::unique_ptr<EntityInfo> m_root;
+        AZStd::unique_ptr<NetworkInputArray> m_inputArray;
+        AZStd::array<uint8_t, 1024> m_buffer;
+    };
+
+    BENCHMARK_DEFINE_F(NetworkInputArrayBenchmark, SerializeInputArray)(benchmark::State& state)
+    {
+        SetDeltaSerialization(state.range(0) != 0);
+
+        uint32_t serializedSize = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            AzNetworking::NetworkInputSerializer serializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+            m_inputArray->Serialize(serializer);
+            serializedSize = serializer.GetSize();
+        }
+        state.counters["Bytes"] = static_cast<double>(serializedSize);
+    }
+
+    BENCHMARK_REGISTER_F(NetworkInputArrayBenchmark, SerializeInputArray)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_DEFINE_F(NetworkInputArrayBenchmark, DeserializeInputArray)(benchmark::State& state)
+    {
+        SetDeltaSerialization(state.range(0) != 0);
+
+        AzNetworking::NetworkInputSerializer inSerializer(m_buffer.data(), static_cast<uint32_t>(m_buffer.size()));
+        m_inputArray->Serialize(inSerializer);
+        const uint32_t serializedSize = inSerializer.GetSize();
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            NetworkInputArray outArray;
+            AzNetworking::NetworkOutputSerializer outSerializer(m_buffer.data(), serializedSize);
+            outArray.Serialize(outSerializer);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(NetworkInputArrayBenchmark, DeserializeInputArray)
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
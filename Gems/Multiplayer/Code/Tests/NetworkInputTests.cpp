@@ -126,7 +126,7 @@ namespace Multiplayer
 
         EXPECT_TRUE(outArray.Serialize(outSerializer));
 
-        for (uint32_t i = 0; i > NetworkInputArray::MaxElements; ++i)
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
         {
             EXPECT_EQ(inArray[i].GetClientInputId(), outArray[i].GetClientInputId());
             EXPECT_EQ(inArray[i].GetHostFrameId(), outArray[i].GetHostFrameId());
@@ -133,6 +133,28 @@ namespace Multiplayer
         );
     }
 
+    TEST_F(ServerNetTransformTests, NetTransformIgnoresChangesWithinTolerance)
+    {
+        AZ::Transform rootTransform = AZ::Transform::CreateIdentity();
+        rootTransform.SetTranslation(AZ::Vector3::CreateOne() + AZ::Vector3(AZ::Constants::Tolerance * 0.5f));
+        m_root->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(rootTransform);
+        MultiplayerTick();
+
+        EXPECT_EQ(
+            m_root->m_entity->FindComponent<NetworkTransformComponent>()->GetTranslation(),
+            AZ::Vector3::CreateOne()
+        );
+
+        rootTransform.SetTranslation(AZ::Vector3::CreateOne() * 2.f);
+        m_root->m_entity->FindComponent<AzFramework::TransformComponent>()->SetWorldTM(rootTransform);
+        MultiplayerTick();
+
+        EXPECT_EQ(
+            m_root->m_entity->FindComponent<NetworkTransformComponent>()->GetTranslation(),
+            AZ::Vector3::CreateOne() * 2.f
+        );
+    }
+
     TEST_F(ServerNetTransformTests, ParentMovesChildNetTransformDoesntChange)
     {
         EXPECT_EQ(
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/SerializedRecordCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class SerializedRecordCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static Multiplayer::ReplicationRecord MakeRecord(uint32_t dirtyBit)
+        {
+            Multiplayer::ReplicationRecord record(Multiplayer::NetEntityRole::Client);
+            record.m_authorityToClient.Resize(16);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        static constexpr uint32_t BufferCapacity = 64;
+    };
+
+    TEST_F(SerializedRecordCacheTests, FindReturnsStoredData)
+    {
+        Multiplayer::SerializedRecordCache cache;
+        const Multiplayer::ReplicationRecord record = MakeRecord(3);
+        const uint8_t data[] = { 1, 2, 3, 4, 5 };
+
+        uint8_t output[BufferCapacity] = {};
+        uint32_t outputSize = 0;
+        EXPECT_FALSE(cache.Find(record, output, outputSize, BufferCapacity));
+
+        cache.Store(record, data, sizeof(data));
+        EXPECT_TRUE(cache.Find(record, output, outputSize, BufferCapacity));
+        EXPECT_EQ(outputSize, sizeof(data));
+        EXPECT_EQ(memcmp(output, data, sizeof(data)), 0);
+    }
+
+    TEST_F(SerializedRecordCacheTests, FindIgnoresDifferentRecords)
+    {
+        Multiplayer::SerializedRecordCache cache;
+        const uint8_t data[] = { 1, 2, 3 };
+        cache.Store(MakeRecord(3), data, sizeof(data));
+
+        uint8_t output[BufferCapacity] = {};
+        uint32_t outputSize = 0;
+        EXPECT_FALSE(cache.Find(MakeRecord(4), output, outputSize, BufferCapacity));
+
+        Multiplayer::ReplicationRecord autonomousRecord = MakeRecord(3);
+        autonomousRecord.SetRemoteNetworkRole(Multiplayer::NetEntityRole::Autonomous);
+        EXPECT_FALSE(cache.Find(autonomousRecord, output, outputSize, BufferCapacity));
+    }
+
+    TEST_F(SerializedRecordCacheTests, InvalidateDiscardsEntries)
+    {
+        Multiplayer::SerializedRecordCache cache;
+        const Multiplayer::ReplicationRecord record = MakeRecord(3);
+        const uint8_t data[] = { 1, 2, 3 };
+        cache.Store(record, data, sizeof(data));
+        cache.Invalidate();
+
+        uint8_t output[BufferCapacity] = {};
+        uint32_t outputSize = 0;
+        EXPECT_FALSE(cache.Find(record, output, outputSize, BufferCapacity));
+
+        const uint8_t newData[] = { 7, 8 };
+        cache.Store(record, newData, sizeof(newData));
+        EXPECT_TRUE(cache.Find(record, output, outputSize, BufferCapacity));
+        EXPECT_EQ(outputSize, sizeof(newData));
+        EXPECT_EQ(output[0], 7);
+    }
+
+    TEST_F(SerializedRecordCacheTests, FindFailsWhenOutputIsTooSmall)
+    {
+        Multiplayer::SerializedRecordCache cache;
+        const Multiplayer::ReplicationRecord record = MakeRecord(3);
+        const uint8_t data[] = { 1, 2, 3, 4, 5 };
+        cache.Store(record, data, sizeof(data));
+
+        uint8_t output[BufferCapacity] = {};
+        uint32_t outputSize = 0;
+        EXPECT_FALSE(cache.Find(record, output, outputSize, 2));
+        EXPECT_EQ(outputSize, 0);
+    }
+}
@@ -47,6 +47,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/SerializedRecordCache.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
@@ -69,6 +70,8 @@ set(FILES
     Source/Components/MultiplayerComponentRegistry.cpp
     Source/Components/MultiplayerController.cpp
     Source/Components/NetBindComponent.cpp
+    Source/EntityDomains/AabbEntityDomain.cpp
+    Source/EntityDomains/AabbEntityDomain.h
     Source/EntityDomains/FullOwnershipEntityDomain.cpp
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
@@ -83,6 +86,7 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
+    Source/NetworkEntity/EntityReplication/SerializedRecordCache.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
     Source/NetworkInput/NetworkInputChild.cpp
@@ -64,6 +64,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/ReplicationWindows/NetworkEntityInterestGrid.cpp
+    Source/ReplicationWindows/NetworkEntityInterestGrid.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
@@ -15,6 +15,7 @@ set(FILES
     Tests/AutoGen/TestMultiplayerComponent.AutoComponent.xml
     Tests/ClientHierarchyTests.cpp
     Tests/ServerHierarchyBenchmarks.cpp
+    Tests/NetworkInputBenchmarks.cpp
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
@@ -26,12 +27,14 @@ set(FILES
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
+    Tests/NetworkEntityInterestGridTests.cpp
     Tests/NetworkEntityTests.cpp
     Tests/NetworkInputTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/SerializedRecordCacheTests.cpp
     Tests/ServerHierarchyTests.cpp
     Tests/SimplePlayerSpawnerTests.cpp
     Tests/TestMultiplayerComponent.h
@@ -8,11 +8,43 @@
 
 #include "LZ4Compressor.h"
 
+#define LZ4_STATIC_LINKING_ONLY // LZ4_attach_dictionary
 #include <lz4.h>
 #include <lz4hc.h>
 
 namespace MultiplayerCompression
 {
+    namespace
+    {
+        //! Stream that packets are compressed with, fully initializing it is expensive so it is only done once per thread
+        struct WorkingStream
+        {
+            WorkingStream()
+            {
+                LZ4_initStream(&m_stream, sizeof(m_stream));
+            }
+
+            LZ4_stream_t m_stream;
+        };
+    }
+
+    LZ4Compressor::LZ4Compressor() = default;
+
+    LZ4Compressor::~LZ4Compressor() = default;
+
+    void LZ4Compressor::SetDictionary(AZStd::shared_ptr<const Dictionary> dictionary)
+    {
+        m_dictionary = AZStd::move(dictionary);
+        m_dictionaryStream.reset();
+        if (HasDictionary())
+        {
+            // LZ4 only keeps the last 64 KB of the dictionary.
+            m_dictionaryStream = AZStd::make_unique<LZ4_stream_t>();
+            LZ4_initStream(m_dictionaryStream.get(), sizeof(LZ4_stream_t));
+            LZ4_loadDict(m_dictionaryStream.get(), reinterpret_cast<const char*>(m_dictionary->data()), static_cast<int>(m_dictionary->size()));
+        }
+    }
+
     size_t LZ4Compressor::GetMaxChunkSize(size_t maxCompSize) const
     {
         return maxCompSize;
@@ -55,13 +87,33 @@ namespace MultiplayerCompression
 
         AZ_Warning("Multiplayer Compressor", compDataSize >= compWorstCaseSize, "Outbuffer size (%lu B) passed to Compress() is less than estimated worst case (%lu B)", compDataSize, compWorstCaseSize);
 
-        // Note that this returns a non-negative int so we are narrowing into a size_t here
-        compSize = LZ4_compress_HC(
-            reinterpret_cast<const char*>(uncompData), 
-            reinterpret_cast<char*>(compData), 
-            static_cast<int>(uncompSize),
-            static_cast<int>(compDataSize),
-            0);
+        if (HasDictionary())
+        {
+            // Each thread has its own working stream so compressors shared between threads don't need a lock.
+            // Resetting it and attaching the preloaded dictionary stream is cheap, unlike loading the dictionary per packet.
+            static thread_local WorkingStream t_workingStream;
+            LZ4_resetStream_fast(&t_workingStream.m_stream);
+            LZ4_attach_dictionary(&t_workingStream.m_stream, m_dictionaryStream.get());
+
+            // Note that this returns a non-negative int so we are narrowing into a size_t here
+            compSize = LZ4_compress_fast_continue(
+                &t_workingStream.m_stream,
+                reinterpret_cast<const char*>(uncompData),
+                reinterpret_cast<char*>(compData),
+                static_cast<int>(uncompSize),
+                static_cast<int>(compDataSize),
+                1);
+        }
+        else
+        {
+            // Note that this returns a non-negative int so we are narrowing into a size_t here
+            compSize = LZ4_compress_HC(
+                reinterpret_cast<const char*>(uncompData), 
+                reinterpret_cast<char*>(compData), 
+                static_cast<int>(uncompSize),
+                static_cast<int>(compDataSize),
+                0);
+        }
 
         if (compSize == 0)
         {
@@ -89,7 +141,10 @@ namespace MultiplayerCompression
             return AzNetworking::CompressorError::Uninitialized;
         }
 
-        const int uncompSize = LZ4_decompress_safe(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), static_cast<int>(compDataSize), static_cast<int>(uncompDataSize));
+        const int uncompSize = HasDictionary()
+            ? LZ4_decompress_safe_usingDict(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), static_cast<int>(compDataSize), static_cast<int>(uncompDataSize),
+                reinterpret_cast<const char*>(m_dictionary->data()), static_cast<int>(m_dictionary->size()))
+            : LZ4_decompress_safe(reinterpret_cast<const char*>(compData), reinterpret_cast<char*>(uncompData), static_cast<int>(compDataSize), static_cast<int>(uncompDataSize));
         consumedSizeOut = compDataSize;
 
         if (uncompSize < 0)
@@ -12,6 +12,11 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzNetworking/Framework/ICompressor.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+union LZ4_stream_u;
 
 namespace MultiplayerCompression
 {
@@ -29,7 +34,16 @@ namespace MultiplayerCompression
     public:
         AZ_CLASS_ALLOCATOR(LZ4Compressor, AZ::SystemAllocator);
 
-        LZ4Compressor() = default;
+        using Dictionary = AZStd::vector<uint8_t>;
+
+        LZ4Compressor();
+        ~LZ4Compressor() override;
+
+        //! Sets a dictionary of typical packet contents to compress against.
+        //! Small packets, like updates of a few entities, have too little data of their own to compress well, with a dictionary
+        //! they can reference the matching sequences in it instead. Both ends of a connection must use the same dictionary.
+        //! @param dictionary The dictionary to use, nullptr or an empty dictionary compresses packets on their own
+        void SetDictionary(AZStd::shared_ptr<const Dictionary> dictionary);
 
         const char* GetName() const { return CompressorName; }
         AzNetworking::CompressorType GetType() const override { return CompressorType;  };
@@ -40,5 +54,12 @@ namespace MultiplayerCompression
 
         AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
         AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        bool HasDictionary() const { return m_dictionary && !m_dictionary->empty(); }
+
+        AZStd::shared_ptr<const Dictionary> m_dictionary;
+        //! The dictionary loaded into an LZ4 stream once, each packet attaches to it instead of loading the dictionary again
+        AZStd::unique_ptr<LZ4_stream_u> m_dictionaryStream;
     };
 }
@@ -9,13 +9,55 @@
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Utils/Utils.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_lz4DictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path of a dictionary of typical packet contents that the LZ4 compressor compresses packets against, empty to compress "
+        "packets on their own. Servers and clients must use the same dictionary.");
+
+    // LZ4 only references the last 64 KB of a dictionary
+    static constexpr size_t MaxDictionarySize = 64 * 1024;
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
-        return AZStd::make_unique<LZ4Compressor>();
+        AZStd::unique_ptr<LZ4Compressor> compressor = AZStd::make_unique<LZ4Compressor>();
+        compressor->SetDictionary(GetDictionary());
+        return compressor;
+    }
+
+    AZStd::shared_ptr<const AZStd::vector<uint8_t>> MultiplayerCompressionFactory::GetDictionary()
+    {
+        const AZ::CVarFixedString dictionaryPath = net_lz4DictionaryPath;
+
+        AZStd::scoped_lock lock(m_dictionaryMutex);
+        if (m_dictionaryPath != dictionaryPath.c_str())
+        {
+            m_dictionaryPath = dictionaryPath.c_str();
+            m_dictionary.reset();
+            if (!m_dictionaryPath.empty())
+            {
+                auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(m_dictionaryPath);
+                AZ_Warning("Multiplayer Compressor", readResult.IsSuccess(), "Failed to load the compression dictionary: %s",
+                    readResult.IsSuccess() ? "" : readResult.GetError().c_str());
+                if (readResult.IsSuccess())
+                {
+                    // Trained dictionaries are often larger than LZ4 can reference, keep the end of the file like LZ4_loadDict does
+                    // so that both the compressing and the decompressing side use exactly the same bytes.
+                    AZStd::vector<uint8_t> dictionary = readResult.TakeValue();
+                    if (dictionary.size() > MaxDictionarySize)
+                    {
+                        dictionary.erase(dictionary.begin(), dictionary.end() - MaxDictionarySize);
+                    }
+                    m_dictionary = AZStd::make_shared<AZStd::vector<uint8_t>>(AZStd::move(dictionary));
+                }
+            }
+        }
+        return m_dictionary;
     }
 
     const AZStd::string_view MultiplayerCompressionFactory::GetFactoryName() const
@@ -9,7 +9,11 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
 namespace MultiplayerCompression
@@ -27,6 +31,13 @@ namespace MultiplayerCompression
         const AZStd::string_view GetFactoryName() const override;
 
     private:
+        //! Returns the dictionary set by net_lz4DictionaryPath, loading it the first time it's used
+        AZStd::shared_ptr<const AZStd::vector<uint8_t>> GetDictionary();
+
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
+
+        AZStd::mutex m_dictionaryMutex;
+        AZStd::string m_dictionaryPath;
+        AZStd::shared_ptr<const AZStd::vector<uint8_t>> m_dictionary;
     };
 }
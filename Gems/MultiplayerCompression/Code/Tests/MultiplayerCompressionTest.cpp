@@ -13,6 +13,7 @@
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
@@ -115,4 +116,48 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryTest)
+{
+    // A small packet that is mostly made of sequences found in the dictionary
+    auto dictionary = AZStd::make_shared<MultiplayerCompression::LZ4Compressor::Dictionary>();
+    for (uint8_t i = 0; i < 128; ++i)
+    {
+        dictionary->push_back(static_cast<uint8_t>(i * 7 + 3));
+    }
+    AZStd::vector<uint8_t> packet(dictionary->begin() + 16, dictionary->begin() + 80);
+
+    constexpr size_t maxCompressedSize = 256;
+    char compressedBuffer[maxCompressedSize];
+    char decompressedBuffer[maxCompressedSize];
+    size_t compressedSize = 0;
+    size_t dictionaryCompressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::LZ4Compressor lz4Compressor;
+    ASSERT_TRUE(lz4Compressor.Compress(packet.data(), packet.size(), compressedBuffer, maxCompressedSize, compressedSize) == AzNetworking::CompressorError::Ok);
+
+    lz4Compressor.SetDictionary(dictionary);
+    ASSERT_TRUE(lz4Compressor.Compress(packet.data(), packet.size(), compressedBuffer, maxCompressedSize, dictionaryCompressedSize) == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(dictionaryCompressedSize, compressedSize);
+
+    // A compressor using the same dictionary on the other end restores the packet
+    MultiplayerCompression::LZ4Compressor remoteLz4Compressor;
+    remoteLz4Compressor.SetDictionary(dictionary);
+    AzNetworking::CompressorError decompressStatus = remoteLz4Compressor.Decompress(
+        compressedBuffer, dictionaryCompressedSize, decompressedBuffer, maxCompressedSize, consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_TRUE(memcmp(decompressedBuffer, packet.data(), packet.size()) == 0);
+
+    // Every packet is compressed against the dictionary alone, not against the packets compressed before it
+    AZStd::vector<uint8_t> nextPacket(dictionary->begin() + 40, dictionary->begin() + 120);
+    ASSERT_TRUE(lz4Compressor.Compress(nextPacket.data(), nextPacket.size(), compressedBuffer, maxCompressedSize, dictionaryCompressedSize) == AzNetworking::CompressorError::Ok);
+    decompressStatus = remoteLz4Compressor.Decompress(
+        compressedBuffer, dictionaryCompressedSize, decompressedBuffer, maxCompressedSize, consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(uncompressedSize, nextPacket.size());
+    EXPECT_TRUE(memcmp(decompressedBuffer, nextPacket.data(), nextPacket.size()) == 0);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
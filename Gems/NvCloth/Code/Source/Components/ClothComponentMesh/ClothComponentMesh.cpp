@@ -13,6 +13,8 @@
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
 #include <AtomLyIntegration/CommonFeatures/SkinnedMesh/SkinnedMeshOverrideBus.h>
 #include <Atom/RHI/RHIUtils.h>
+#include <Atom/RPI.Public/RPIUtils.h>
+#include <Atom/RPI.Public/ViewportContext.h>
 
 #include <NvCloth/IClothSystem.h>
 #include <NvCloth/IFabricCooker.h>
@@ -40,6 +42,10 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(float, cloth_SimulationLodDistance, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Distance in meters from the camera beyond which cloth is not simulated. Cloth on actors follows the skinning instead. "
+        "0 simulates cloth at any distance.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -244,6 +250,7 @@ namespace NvCloth
             EnableSkinning();
         }
         m_entityId.SetInvalid();
+        m_simulationLodCulled = false;
         m_renderDataBuffer = {};
         m_meshRemappedVertices.clear();
         m_meshNodeInfo = {};
@@ -303,6 +310,24 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        UpdateSimulationLod();
+
+        if (m_simulationLodCulled && m_actorClothSkinning)
+        {
+            // Without simulation the cloth follows the skinning of the actor.
+            // Once simulated again, the skinning overrides the simulation for a short time as when the actor spawns.
+            m_actorClothSkinning->UpdateSkinning();
+            m_actorClothSkinning->UpdateActorVisibility();
+            m_timeClothSkinningUpdates = 0.0f;
+
+            AZStd::vector<SimParticleFormat> particles = m_cloth->GetParticles();
+            m_actorClothSkinning->ApplySkinning(m_cloth->GetInitialParticles(), particles);
+            m_cloth->SetParticles(particles);
+
+            m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+            UpdateRenderData(particles);
+        }
+
         CopyRenderDataToModel();
     }
 
@@ -332,6 +357,40 @@ namespace NvCloth
         return m_renderDataBuffer[m_renderDataBufferIndex];
     }
 
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        const float lodDistance = cloth_SimulationLodDistance;
+        bool culled = false;
+        if (lodDistance > 0.0f)
+        {
+            if (AZ::RPI::ViewportContextPtr viewportContext = AZ::RPI::GetDefaultViewportContext())
+            {
+                // Culled cloth comes back a bit closer than the lod distance, so it doesn't switch every frame at the boundary.
+                const float switchDistance = m_simulationLodCulled ? lodDistance * 0.9f : lodDistance;
+                const AZ::Vector3 cameraPosition = viewportContext->GetCameraTransform().GetTranslation();
+                culled = cameraPosition.GetDistanceSq(m_worldPosition) > switchDistance * switchDistance;
+            }
+        }
+
+        if (culled == m_simulationLodCulled)
+        {
+            return;
+        }
+        m_simulationLodCulled = culled;
+
+        if (m_simulationLodCulled)
+        {
+            AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
+        }
+        else
+        {
+            // The cloth kept following the entity while it wasn't simulated, resume as if it was teleported.
+            m_cloth->GetClothConfigurator()->ClearInertia();
+            m_cloth->DiscardParticleDelta();
+            AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth);
+        }
+    }
+
     void ClothComponentMesh::UpdateSimulationCollisions()
     {
         if (m_actorClothColliders)
@@ -80,6 +80,8 @@ namespace NvCloth
         void OnWindChanged(const AZ::Aabb& aabb) override;
 
     private:
+        // Stops simulating the cloth when it's further from the camera than the cloth_SimulationLodDistance cvar.
+        void UpdateSimulationLod();
         void UpdateSimulationCollisions();
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
@@ -107,6 +109,9 @@ namespace NvCloth
         // Instance of cloth simulation
         ICloth* m_cloth = nullptr;
 
+        // Whether the cloth is too far from the camera to be simulated, it's not in any solver while culled.
+        bool m_simulationLodCulled = false;
+
         // Cloth event handlers
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
@@ -10,6 +10,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/MultipleDependentJob.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/utility/as_const.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
@@ -33,11 +34,10 @@ namespace PhysX
         "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
 
     // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
-    // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
-    // to complete, and then start a new update job.
+    // On any heightfield change that keeps the size of the heightfield, the changed region gets queued while an update job is
+    // running, and the queued regions get updated by another chain of jobs once the running one completes. All other changes
+    // cancel any update job that's currently running, wait for it to complete, and then start a new update job.
     // Also, on HeightfieldCollider destruction, any running jobs will get canceled and block on completion.
-    // Eventually, this could get migrated to a more complex system that allows for overlapping jobs, or potentially using a queue
-    // of regions to update in a currently-running job.
     void HeightfieldCollider::HeightfieldUpdateJobContext::Cancel()
     {
         m_isCanceled = true;
@@ -115,6 +115,19 @@ namespace PhysX
         m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
     }
 
+    void HeightfieldCollider::DirtyHeightfieldRegion::AddRegion(const DirtyHeightfieldRegion& dirtyRegion)
+    {
+        m_minRowVertex = AZStd::min(m_minRowVertex, dirtyRegion.m_minRowVertex);
+        m_minColumnVertex = AZStd::min(m_minColumnVertex, dirtyRegion.m_minColumnVertex);
+        m_maxRowVertex = AZStd::max(m_maxRowVertex, dirtyRegion.m_maxRowVertex);
+        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, dirtyRegion.m_maxColumnVertex);
+    }
+
+    bool HeightfieldCollider::DirtyHeightfieldRegion::IsNull() const
+    {
+        return (m_minRowVertex > m_maxRowVertex) || (m_minColumnVertex > m_maxColumnVertex);
+    }
+
 
 
     HeightfieldCollider::HeightfieldCollider(
@@ -304,7 +317,7 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::RefreshComplete()
+    void HeightfieldCollider::RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape)
     {
         // This method is called by an update job to signal that the chain of update jobs have completed.
 
@@ -315,6 +328,31 @@ namespace PhysX
             Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
         }
 
+        AZStd::unique_lock<AZStd::mutex> lock(m_queuedDirtyRegionMutex);
+
+        // Update the regions that changed while this chain of jobs was running with another chain of jobs. The heightfield keeps
+        // its size while regions are queued, so the scene and shape that this chain updated are still the ones to update.
+        while (!m_jobContext->IsCanceled() && !m_queuedDirtyRegion.IsNull())
+        {
+            m_dirtyRegion = m_queuedDirtyRegion;
+            m_queuedDirtyRegion.SetNull();
+            lock.unlock();
+
+            constexpr bool continueRefresh = true;
+            if (StartRefreshJobs(scene, shape, continueRefresh))
+            {
+                return;
+            }
+
+            lock.lock();
+        }
+
+        // If the job was canceled, keep the queued regions dirty so that the next refresh updates them.
+        m_dirtyRegion.AddRegion(m_queuedDirtyRegion);
+        m_queuedDirtyRegion.SetNull();
+        m_refreshJobsRunning = false;
+        lock.unlock();
+
         // Notify the job context that the job is completed, so that anything blocking on job completion knows it can proceed.
         m_jobContext->OnRefreshComplete();
     }
@@ -394,6 +432,18 @@ namespace PhysX
             shouldRecreateHeightfield = shouldRecreateHeightfield || (baseConfiguration.GetMaxHeightBounds() != m_shapeConfig->GetMaxHeightBounds());
         }
 
+        // If the update job is running and the heightfield keeps its size, queue the region instead of stopping the job and waiting
+        // for it to complete, so that frequent small edits don't block on the running job.
+        if (!shouldRecreateHeightfield)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_queuedDirtyRegionMutex);
+            if (m_refreshJobsRunning)
+            {
+                m_queuedDirtyRegion.AddAabb(requestRegion, m_entityId);
+                return;
+            }
+        }
+
         // If the update job is running, stop it and wait for it to complete.
         m_jobContext->Cancel();
         m_jobContext->BlockUntilComplete();
@@ -431,6 +481,15 @@ namespace PhysX
         // Add the new request region to our dirty heightfield region
         m_dirtyRegion.AddAabb(requestRegion, m_entityId);
 
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
+
+        constexpr bool continueRefresh = false;
+        StartRefreshJobs(scene, GetHeightfieldShape(), continueRefresh);
+    }
+
+    bool HeightfieldCollider::StartRefreshJobs(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape, bool continueRefresh)
+    {
         AZ_Assert(m_dirtyRegion.m_maxRowVertex >= m_dirtyRegion.m_minRowVertex,
             "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_minRowVertex, m_dirtyRegion.m_maxRowVertex);
 
@@ -449,14 +508,9 @@ namespace PhysX
         // If our dirty region is too small to affect any vertices, early-out.
         if ((numRows == 0) || (numColumns == 0))
         {
-            return;
+            return false;
         }
 
-        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
-        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
-
-        auto shape = GetHeightfieldShape();
-
         // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
         // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
         // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
@@ -535,11 +589,18 @@ namespace PhysX
             // Set up the final completion job and dependency:
             // UpdatePhysXHeightfieldJob -> RefreshCompleteJob
             auto* refreshCompleteJob =
-                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this), autoDelete, m_jobContext.get());
+                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this, scene, shape), autoDelete, m_jobContext.get());
             updatePhysXHeightfieldJobs.back()->SetDependent(refreshCompleteJob);
 
-            // Track that we're starting our refresh job chain.
-            m_jobContext->OnRefreshStart();
+            // Track that we're starting our refresh job chain. A chain that continues a completed refresh keeps the running state,
+            // so that a cancel request that came in while the chain was being set up isn't lost.
+            if (!continueRefresh)
+            {
+                m_jobContext->OnRefreshStart();
+
+                AZStd::scoped_lock<AZStd::mutex> lock(m_queuedDirtyRegionMutex);
+                m_refreshJobsRunning = true;
+            }
 
             // Start all the jobs except the UpdateShapeConfigCompletion jobs.
             // None of the jobs will actually start until all their dependencies are met, this just "primes" them so that they'll start
@@ -555,7 +616,10 @@ namespace PhysX
             }
 
             refreshCompleteJob->Start();
+            return true;
         }
+
+        return false;
     }
 
     void HeightfieldCollider::UpdateHeightfieldMaterialSlots(const Physics::MaterialSlots& updatedMaterialSlots)
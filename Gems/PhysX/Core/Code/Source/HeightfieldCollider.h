@@ -115,8 +115,14 @@ namespace PhysX
             AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
             size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
+        //! Starts the chain of update jobs for the current dirty region.
+        //! @param continueRefresh True if the chain continues a refresh whose jobs just completed.
+        //! @return True if any jobs were started.
+        bool StartRefreshJobs(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape, bool continueRefresh);
+
         //! Called once all of the asynchronous update jobs have completed.
-        void RefreshComplete();
+        //! Starts another chain of update jobs if any regions were queued while the jobs were running.
+        void RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape);
 
         //! Helper class to manage the spawned physics update jobs.
         class HeightfieldUpdateJobContext : public AZ::JobContext
@@ -184,6 +190,8 @@ namespace PhysX
             DirtyHeightfieldRegion();
             void SetNull();
             void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
+            void AddRegion(const DirtyHeightfieldRegion& dirtyRegion);
+            bool IsNull() const;
 
             size_t m_minRowVertex;      //! the first dirty row vertex
             size_t m_minColumnVertex;   //! the first dirty column vertex
@@ -192,6 +200,15 @@ namespace PhysX
         };
 
         DirtyHeightfieldRegion m_dirtyRegion;
+
+        //! The regions that changed while a chain of update jobs was running, updated once the chain completes.
+        DirtyHeightfieldRegion m_queuedDirtyRegion;
+
+        //! Track whether or not a chain of update jobs is running, so that changed regions can be queued.
+        bool m_refreshJobsRunning = false;
+
+        //! Mutex to protect the queued region and the running state of the update jobs.
+        AZStd::mutex m_queuedDirtyRegionMutex;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
@@ -476,15 +476,6 @@ namespace PhysX
         }
     }
 
-    void CharacterControllerComponent::OnSceneSimulationStart(float physicsTimestep)
-    {
-        if (auto* controller = GetController())
-        {
-            controller->ApplyRequestedVelocity(physicsTimestep);
-            controller->ResetRequestedVelocityForPhysicsTimestep();
-        }
-    }
-
     const PhysX::CharacterController* CharacterControllerComponent::GetControllerConst() const
     {
         if (m_controllerBodyHandle == AzPhysics::InvalidSimulatedBodyHandle || m_attachedSceneHandle == AzPhysics::InvalidSceneHandle)
@@ -564,13 +555,12 @@ namespace PhysX
 
         if (m_characterConfig->m_applyMoveOnPhysicsTick)
         {
-            m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
-                [this](
-                    [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
-                    float fixedDeltaTime)
-                {
-                    OnSceneSimulationStart(fixedDeltaTime);
-                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+            // The scene moves all the controllers in one pass at the start of each physics sub-step
+            auto* physXSystem = GetPhysXSystem();
+            if (auto* physXScene = physXSystem ? azdynamic_cast<PhysXScene*>(physXSystem->GetScene(m_attachedSceneHandle)) : nullptr)
+            {
+                physXScene->AddPhysicsTickCharacterController(m_controllerBodyHandle);
+            }
 
             m_postSimulateHandler = AzPhysics::SystemEvents::OnPostsimulateEvent::Handler(
                 [this](float deltaTime)
@@ -579,15 +569,10 @@ namespace PhysX
                 }
             );
 
-            if (auto* physXSystem = GetPhysXSystem())
+            if (physXSystem)
             {
                 physXSystem->RegisterPostSimulateEvent(m_postSimulateHandler);
             }
-
-            if (sceneInterface != nullptr)
-            {
-                sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
-            }
         }
 
         AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
@@ -612,6 +597,7 @@ namespace PhysX
             // it will end up re-entring into this same function.
             m_onSimulatedBodyRemovedHandler.Disconnect(); 
 
+            // Removing the body also removes it from the controllers the scene moves on every physics sub-step
             if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
             {
                 sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, controller->m_bodyHandle);
@@ -619,7 +605,6 @@ namespace PhysX
 
             m_controllerBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
             m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
-            m_sceneSimulationStartHandler.Disconnect();
             m_postSimulateHandler.Disconnect();
             CharacterControllerRequestBus::Handler::BusDisconnect();
         }
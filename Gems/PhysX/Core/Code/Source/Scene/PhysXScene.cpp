@@ -23,6 +23,7 @@
 #include <PhysX/MathConversion.h>
 #include <Joint/PhysXJoint.h>
 
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/algorithm.h>
@@ -30,6 +31,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -48,6 +50,11 @@ namespace PhysX
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(bool, physx_parallelSceneQueryBatch, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Multithreaded scene queries for batched scene query requests.");
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene query requests should be processed per task");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -331,6 +338,22 @@ namespace PhysX
             return status;
         }
 
+        // helper to copy a scene query request, so async queries don't depend on the lifetime of the caller's request
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            switch (request->m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*static_cast<const AzPhysics::RayCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*static_cast<const AzPhysics::ShapeCastRequest*>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*static_cast<const AzPhysics::OverlapRequest*>(request));
+            default:
+                return nullptr;
+            }
+        }
+
         // helper to preform a shape cast
         bool ShapeCast(const AzPhysics::ShapeCastRequest* shapecastRequest,
             AZStd::vector<physx::PxSweepHit>& shapecastBuffer,
@@ -486,6 +509,12 @@ namespace PhysX
                 m_shapecastBufferSize = config->m_shapecastBufferSize;
                 m_overlapBufferSize = config->m_overlapBufferSize;
             })
+        , m_physicsTickCharacterControllersHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                MovePhysicsTickCharacterControllers(fixedDeltaTime);
+            },
+            aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics))
     {
         //setup the scene query buffer sizes
         if (auto* physXSystem = GetPhysXSystem())
@@ -516,6 +545,12 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Async queries read from the scene, so they need to finish before anything gets released
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_asyncQueryMutex);
+            m_asyncQueryFinished.wait(lock, [this]() { return m_runningAsyncQueryCount == 0; });
+        }
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
@@ -566,15 +601,20 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
+        // Handlers connected while the simulation runs only receive the collisions of the next simulation
+        m_simulationEventCallback.SetReportAllCollisions(m_sceneCollisionEvent.HasHandlerConnected());
+
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
+        m_simulationInProgress = true;
     }
 
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
-        if (!IsEnabled())
+        // Also checks if the scene got disabled after the simulation started, since the started simulation still needs to complete.
+        if (!m_simulationInProgress)
         {
             return;
         }
@@ -589,6 +629,7 @@ namespace PhysX
             // https://devtalk.nvidia.com/default/topic/1024408/pxcontactmodifycallback-and-pxscene-locking/
             m_pxScene->checkResults(true);
         }
+        m_simulationInProgress = false;
 
         bool activeActorsEnabled = false;
         {
@@ -814,6 +855,7 @@ namespace PhysX
 
             m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, bodyHandle);
 
+            RemovePhysicsTickCharacterController(bodyHandle);
             m_deferredDeletions.push_back(m_simulatedBodies[index].second);
             m_simulatedBodies[index] = AZStd::make_pair(AZ::Crc32(), nullptr);
             m_freeSceneSlots.push(index);
@@ -1014,27 +1056,138 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        // Each request writes to its own entry, so the results stay in the order of the requests
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1);
+        const size_t fullSize = requests.size();
+        if (!physx_parallelSceneQueryBatch || fullSize <= batchSize)
+        {
+            QuerySceneRange(requests, 0, fullSize, results);
+            return results;
+        }
+
+        AZ::TaskGraph taskGraph("Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Scene query batch event");
+
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZ_PROFILE_SCOPE(Physics, "Scene Query Setup");
+
+            for (size_t i = 0; i < fullSize; i += batchSize)
+            {
+                AZ::TaskDescriptor taskDescriptor{"SceneQueryTask", "Physics"};
+                taskGraph.AddTask(
+                    taskDescriptor,
+                    [start = i, end = AZStd::min(i + batchSize, fullSize), &requests, &results, this]()
+                    {
+                        AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+
+                        // Same as the parallel transform sync, the scene stays locked for read for the entire task
+                        // to avoid the context switches of locking it for every query.
+                        PHYSX_SCENE_READ_LOCK(m_pxScene);
+                        QuerySceneRange(requests, start, end, results);
+                    });
+            }
+
+            taskGraph.Submit(&finishEvent);
         }
+
+        finishEvent.Wait();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (!requestCopy)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        StartAsyncQuery(
+            [this, requestId, requestCopy = AZStd::move(requestCopy), callback = AZStd::move(callback)]()
+            {
+                AzPhysics::SceneQueryHits hits = QueryScene(requestCopy.get());
+                AZ::TickBus::QueueFunction(
+                    [requestId, callback, hits = AZStd::move(hits)]() mutable
+                    {
+                        callback(requestId, AZStd::move(hits));
+                    });
+            });
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        AzPhysics::SceneQueryRequests requestsCopy;
+        requestsCopy.reserve(requests.size());
+        for (const auto& request : requests)
+        {
+            // Null entries are kept so the results line up with the requests, same as QuerySceneBatch
+            requestsCopy.emplace_back(request ? Internal::CloneSceneQueryRequest(request.get()) : nullptr);
+        }
+
+        StartAsyncQuery(
+            [this, requestId, requestsCopy = AZStd::move(requestsCopy), callback = AZStd::move(callback)]()
+            {
+                // The batch already runs on a worker thread, so its queries run serially instead of waiting on more tasks
+                AzPhysics::SceneQueryHitsList results(requestsCopy.size());
+                {
+                    PHYSX_SCENE_READ_LOCK(m_pxScene);
+                    QuerySceneRange(requestsCopy, 0, requestsCopy.size(), results);
+                }
+                AZ::TickBus::QueueFunction(
+                    [requestId, callback, results = AZStd::move(results)]() mutable
+                    {
+                        callback(requestId, AZStd::move(results));
+                    });
+            });
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(
+        const AzPhysics::SceneQueryRequests& requests, size_t start, size_t end, AzPhysics::SceneQueryHitsList& results)
+    {
+        for (size_t requestIndex = start; requestIndex < end; ++requestIndex)
+        {
+            QueryScene(requests[requestIndex].get(), results[requestIndex]);
+        }
+    }
+
+    void PhysXScene::StartAsyncQuery(AZStd::function<void()> query)
+    {
+        {
+            AZStd::scoped_lock lock(m_asyncQueryMutex);
+            ++m_runningAsyncQueryCount;
+        }
+
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, query = AZStd::move(query)]()
+            {
+                AZ_PROFILE_SCOPE(Physics, "PhysXScene::AsyncSceneQuery");
+                query();
+
+                AZStd::scoped_lock lock(m_asyncQueryMutex);
+                --m_runningAsyncQueryCount;
+                m_asyncQueryFinished.notify_all();
+            },
+            true);
+        job->Start();
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1125,6 +1278,53 @@ namespace PhysX
         body.m_simulating = false;
     }
 
+    void PhysXScene::AddPhysicsTickCharacterController(AzPhysics::SimulatedBodyHandle controllerHandle)
+    {
+        if (AZStd::find(m_physicsTickCharacterControllers.begin(), m_physicsTickCharacterControllers.end(), controllerHandle) !=
+            m_physicsTickCharacterControllers.end())
+        {
+            return;
+        }
+
+        m_physicsTickCharacterControllers.push_back(controllerHandle);
+        if (!m_physicsTickCharacterControllersHandler.IsConnected())
+        {
+            RegisterSceneSimulationStartHandler(m_physicsTickCharacterControllersHandler);
+        }
+    }
+
+    void PhysXScene::RemovePhysicsTickCharacterController(AzPhysics::SimulatedBodyHandle controllerHandle)
+    {
+        auto controllerIt =
+            AZStd::find(m_physicsTickCharacterControllers.begin(), m_physicsTickCharacterControllers.end(), controllerHandle);
+        if (controllerIt == m_physicsTickCharacterControllers.end())
+        {
+            return;
+        }
+
+        m_physicsTickCharacterControllers.erase(controllerIt);
+        if (m_physicsTickCharacterControllers.empty())
+        {
+            m_physicsTickCharacterControllersHandler.Disconnect();
+        }
+    }
+
+    void PhysXScene::MovePhysicsTickCharacterControllers(float deltaTime)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::MovePhysicsTickCharacterControllers");
+
+        // The moves lock the scene for write as well, holding the lock for the whole pass makes those locks uncontended.
+        PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+        for (const AzPhysics::SimulatedBodyHandle& controllerHandle : m_physicsTickCharacterControllers)
+        {
+            if (auto* controller = azdynamic_cast<CharacterController*>(GetSimulatedBodyFromHandle(controllerHandle)))
+            {
+                controller->ApplyRequestedVelocity(deltaTime);
+                controller->ResetRequestedVelocityForPhysicsTimestep();
+            }
+        }
+    }
+
     physx::PxControllerManager* PhysXScene::GetOrCreateControllerManager()
     {
         if (m_controllerManager)
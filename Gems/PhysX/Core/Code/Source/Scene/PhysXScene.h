@@ -13,6 +13,9 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -60,7 +63,10 @@ namespace PhysX
         AzPhysics::SceneQueryHits QueryScene(const AzPhysics::SceneQueryRequest* request) override;
         bool QueryScene(const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQueryHits& result) override;
 
+        //! Large batches are split into tasks that run in parallel, see the physx_parallelSceneQueryBatch cvars.
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        //! Async queries run on the job system, and their callbacks are queued on the AZ::TickBus so they're called on the main thread.
+        //! The requests are copied, but the filter callbacks of the requests get called from the job thread.
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -81,6 +87,11 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Registers a character controller that applies its requested velocity on every physics sub-step.
+        //! All the registered controllers are moved in one pass at the start of each simulation, under a single scene lock.
+        void AddPhysicsTickCharacterController(AzPhysics::SimulatedBodyHandle controllerHandle);
+        void RemovePhysicsTickCharacterController(AzPhysics::SimulatedBodyHandle controllerHandle);
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
@@ -115,7 +126,17 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        void MovePhysicsTickCharacterControllers(float deltaTime);
+
+        //! Runs the requests in [start, end) and writes their hits to the same indices of the results.
+        void QuerySceneRange(
+            const AzPhysics::SceneQueryRequests& requests, size_t start, size_t end, AzPhysics::SceneQueryHitsList& results);
+
+        //! Runs the query on the job system, tracking it so the scene can wait for it before it gets destroyed.
+        void StartAsyncQuery(AZStd::function<void()> query);
+
         bool m_isEnabled = true;
+        bool m_simulationInProgress = false; //!< StartSimulation was called and FinishSimulation wasn't yet.
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
         // After the full simulation pass (possibly made of multiple simulation sub-steps) is complete,
@@ -154,7 +175,13 @@ namespace PhysX
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_physicsTickCharacterControllers; //!< Controllers moved at the start of each simulation.
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_physicsTickCharacterControllersHandler;
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        AZStd::mutex m_asyncQueryMutex;
+        AZStd::condition_variable m_asyncQueryFinished;
+        size_t m_runningAsyncQueryCount = 0; //!< Number of async queries that are still running on the job system.
     };
 }
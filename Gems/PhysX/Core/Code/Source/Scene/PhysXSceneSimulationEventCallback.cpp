@@ -25,9 +25,19 @@ namespace PhysX
 
     void SceneSimulationEventCallback::FlushQueuedCollisionEvents()
     {
+        for (AzPhysics::CollisionEvent& collision : m_queuedCollisionEvents)
+        {
+            collision.m_contacts.clear();
+            m_contactListPool.emplace_back(AZStd::move(collision.m_contacts));
+        }
         m_queuedCollisionEvents.clear();
     }
 
+    void SceneSimulationEventCallback::SetReportAllCollisions(bool reportAllCollisions)
+    {
+        m_reportAllCollisions = reportAllCollisions;
+    }
+
     void SceneSimulationEventCallback::FlushQueuedTriggerEvents()
     {
         m_queuedTriggerEvents.clear();
@@ -88,6 +98,12 @@ namespace PhysX
                     continue;
                 }
 
+                // Skip extracting the contacts of pairs nobody listens to
+                if (!m_reportAllCollisions && !body1->HasCollisionEventHandlers() && !body2->HasCollisionEventHandlers())
+                {
+                    continue;
+                }
+
                 Physics::Shape* shape1 = Utils::GetUserData(contactPair.shapes[0]);
                 Physics::Shape* shape2 = Utils::GetUserData(contactPair.shapes[1]);
 
@@ -109,6 +125,11 @@ namespace PhysX
                 // Extract contacts for collision event
                 physx::PxContactPairPoint extractedPoints[MaxPointsToReport];
                 physx::PxU32 contactPointCount = contactPair.extractContacts(extractedPoints, MaxPointsToReport);
+                if (!m_contactListPool.empty())
+                {
+                    collision.m_contacts = AZStd::move(m_contactListPool.back());
+                    m_contactListPool.pop_back();
+                }
                 collision.m_contacts.resize(contactPointCount);
                 for (physx::PxU8 j = 0; j < contactPointCount; ++j)
                 {
@@ -27,9 +27,14 @@ namespace PhysX
         AzPhysics::TriggerEventList& GetQueuedTriggerEvents();
 
         //! Clear all queued collision / trigger events.
+        //! The contact lists of the collision events are kept for the events of the next simulation.
         void FlushQueuedCollisionEvents();
         void FlushQueuedTriggerEvents();
 
+        //! Sets if all collision events are needed, because there are handlers for the collisions of the whole scene.
+        //! Otherwise only the collisions of bodies that have collision event handlers are queued.
+        void SetReportAllCollisions(bool reportAllCollisions);
+
         // physx::PxSimulationEventCallback Interface
         void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override;
         void onWake(physx::PxActor** actors, physx::PxU32 count) override;
@@ -41,5 +46,7 @@ namespace PhysX
     private:
         AzPhysics::CollisionEventList m_queuedCollisionEvents; //!< Holds all the collision events the happened until the next call to FlushCollisionEvents;
         AzPhysics::TriggerEventList m_queuedTriggerEvents; //!< Holds all the trigger events the happened until the next call to FlushTriggerEvents;
+        AZStd::vector<AZStd::vector<AzPhysics::Contact>> m_contactListPool; //!< Contact lists of flushed collision events, reused to avoid allocations.
+        bool m_reportAllCollisions = true;
     };
 }
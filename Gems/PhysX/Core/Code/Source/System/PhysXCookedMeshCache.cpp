@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXCookedMeshCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace PhysX
+{
+    AZ_CVAR(size_t, physx_cookedMeshCacheSize, 16 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum size in bytes of the cooked data of the meshes cooked at runtime that is kept for reuse. 0 disables the cache.");
+
+    bool CookedMeshCache::GetOrCook(
+        MeshType meshType,
+        AZStd::span<const AZ::Vector3> vertices,
+        AZStd::span<const AZ::u32> indices,
+        const CookFunction& cookFunction,
+        AZStd::vector<AZ::u8>& result)
+    {
+        const size_t maxSize = physx_cookedMeshCacheSize;
+        const size_t hash = HashGeometry(meshType, vertices, indices);
+
+        if (maxSize > 0)
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            if (auto entryIt = Find(hash, meshType, vertices, indices); entryIt != m_entries.end())
+            {
+                m_entries.splice(m_entries.begin(), m_entries, entryIt);
+                result.insert(result.end(), entryIt->m_cookedData.begin(), entryIt->m_cookedData.end());
+                return true;
+            }
+        }
+
+        AZStd::vector<AZ::u8> cookedData;
+        if (!cookFunction(cookedData))
+        {
+            return false;
+        }
+        result.insert(result.end(), cookedData.begin(), cookedData.end());
+
+        if (maxSize == 0 || cookedData.size() > maxSize)
+        {
+            return true;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        // Another thread may have cooked the same geometry in the meantime
+        if (Find(hash, meshType, vertices, indices) == m_entries.end())
+        {
+            Entry entry;
+            entry.m_hash = hash;
+            entry.m_meshType = meshType;
+            entry.m_vertices.assign(vertices.begin(), vertices.end());
+            entry.m_indices.assign(indices.begin(), indices.end());
+            entry.m_cookedData = AZStd::move(cookedData);
+
+            m_cookedDataSize += entry.m_cookedData.size();
+            m_entries.push_front(AZStd::move(entry));
+            m_entriesByHash.emplace(hash, m_entries.begin());
+            EvictToSize(maxSize);
+        }
+        return true;
+    }
+
+    void CookedMeshCache::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_entriesByHash.clear();
+        m_entries.clear();
+        m_cookedDataSize = 0;
+    }
+
+    size_t CookedMeshCache::GetCookedDataSize() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return m_cookedDataSize;
+    }
+
+    size_t CookedMeshCache::HashGeometry(
+        MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices)
+    {
+        size_t hash = 0;
+        AZStd::hash_combine(hash, static_cast<AZ::u8>(meshType), vertices.size(), indices.size());
+        for (const AZ::Vector3& vertex : vertices)
+        {
+            // Only the components are hashed, the padding of the vector isn't initialized
+            AZStd::hash_combine(hash, vertex.GetX(), vertex.GetY(), vertex.GetZ());
+        }
+        AZStd::hash_range(hash, indices.begin(), indices.end());
+        return hash;
+    }
+
+    bool CookedMeshCache::IsSameGeometry(
+        const Entry& entry, MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices)
+    {
+        return entry.m_meshType == meshType &&
+            AZStd::equal(entry.m_vertices.begin(), entry.m_vertices.end(), vertices.begin(), vertices.end()) &&
+            AZStd::equal(entry.m_indices.begin(), entry.m_indices.end(), indices.begin(), indices.end());
+    }
+
+    CookedMeshCache::EntryList::iterator CookedMeshCache::Find(
+        size_t hash, MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices)
+    {
+        auto [first, last] = m_entriesByHash.equal_range(hash);
+        for (auto it = first; it != last; ++it)
+        {
+            if (IsSameGeometry(*it->second, meshType, vertices, indices))
+            {
+                return it->second;
+            }
+        }
+        return m_entries.end();
+    }
+
+    void CookedMeshCache::EvictToSize(size_t maxSize)
+    {
+        while (m_cookedDataSize > maxSize && !m_entries.empty())
+        {
+            auto entryIt = AZStd::prev(m_entries.end());
+            auto [first, last] = m_entriesByHash.equal_range(entryIt->m_hash);
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->second == entryIt)
+                {
+                    m_entriesByHash.erase(it);
+                    break;
+                }
+            }
+            m_cookedDataSize -= entryIt->m_cookedData.size();
+            m_entries.erase(entryIt);
+        }
+    }
+} // namespace PhysX
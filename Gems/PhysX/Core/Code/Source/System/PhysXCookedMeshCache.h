@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+namespace PhysX
+{
+    //! Keeps the cooked data of the meshes cooked at runtime, so cooking the same geometry again returns the cached data.
+    //! Colliders created from shapes (cylinders, polygon prisms and primitives converted to convex) cook their geometry when they're
+    //! created, so identical colliders, and editor changes that come back to a previous geometry, only cook once.
+    //! The least recently used meshes are evicted once the cooked data exceeds the physx_cookedMeshCacheSize cvar.
+    //! Thread safe. The cooking itself runs outside of the lock, so meshes can be cooked in parallel.
+    class CookedMeshCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CookedMeshCache, AZ::SystemAllocator);
+
+        using MeshType = Physics::CookedMeshShapeConfiguration::MeshType;
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>& cookedData)>;
+
+        //! Appends the cooked data of the geometry to the result, calling the cook function if the geometry isn't in the cache.
+        //! @return Returns false if the cooking failed.
+        bool GetOrCook(
+            MeshType meshType,
+            AZStd::span<const AZ::Vector3> vertices,
+            AZStd::span<const AZ::u32> indices,
+            const CookFunction& cookFunction,
+            AZStd::vector<AZ::u8>& result);
+
+        void Clear();
+
+        //! Total size in bytes of the cooked data in the cache.
+        size_t GetCookedDataSize() const;
+
+    private:
+        struct Entry
+        {
+            size_t m_hash = 0;
+            MeshType m_meshType = MeshType::TriangleMesh;
+            AZStd::vector<AZ::Vector3> m_vertices;
+            AZStd::vector<AZ::u32> m_indices;
+            AZStd::vector<AZ::u8> m_cookedData;
+        };
+        using EntryList = AZStd::list<Entry>;
+
+        static size_t HashGeometry(MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices);
+        static bool IsSameGeometry(
+            const Entry& entry, MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices);
+
+        //! Finds the entry of the geometry, or m_entries.end(). Requires the lock on m_mutex.
+        EntryList::iterator Find(
+            size_t hash, MeshType meshType, AZStd::span<const AZ::Vector3> vertices, AZStd::span<const AZ::u32> indices);
+
+        //! Evicts the least recently used entries until the cooked data fits in the max size. Requires the lock on m_mutex.
+        void EvictToSize(size_t maxSize);
+
+        mutable AZStd::mutex m_mutex;
+        EntryList m_entries; //!< Ordered from the most to the least recently used.
+        AZStd::unordered_multimap<size_t, EntryList::iterator> m_entriesByHash;
+        size_t m_cookedDataSize = 0;
+    };
+} // namespace PhysX
@@ -36,6 +36,12 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_pipelinedSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Overlap the last simulation sub-step of each tick with the rest of the frame. "
+        "True: The last sub-step keeps running on the PhysX worker threads after Simulate returns, and its results are applied "
+        "at the start of the next Simulate call, so the rest of the frame reads the results of the previous step. "
+        "False: Simulate waits for all sub-steps to complete.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -172,6 +178,7 @@ namespace PhysX
         RemoveAllScenes();
 
         m_accumulatedTime = 0.0f;
+        m_pipelinedTickTime = 0.0f;
         m_state = State::Shutdown;
     }
 
@@ -185,6 +192,21 @@ namespace PhysX
             return;
         }
 
+        // The step that was left running by the previous call completes before the inputs of this tick get applied
+        FinishPipelinedSimulation();
+
+        auto startScenes = [this](float timeStep)
+        {
+            for (auto& scenePtr : m_sceneList)
+            {
+                if (scenePtr != nullptr && scenePtr->IsEnabled())
+                {
+                    scenePtr->StartSimulation(timeStep);
+                }
+            }
+            m_pipelinedSimulationRunning = true;
+        };
+
         auto simulateScenes = [this](float timeStep)
         {
             for (auto& scenePtr : m_sceneList)
@@ -231,17 +253,67 @@ namespace PhysX
 
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                if (physx_pipelinedSimulation && m_accumulatedTime < m_systemConfig.m_fixedTimestep)
+                {
+                    startScenes(m_systemConfig.m_fixedTimestep);
+                }
+                else
+                {
+                    simulateScenes(m_systemConfig.m_fixedTimestep);
+                }
             }
         }
         else
         {
             m_preSimulateEvent.Signal(tickTime);
 
-            simulateScenes(tickTime);
+            if (physx_pipelinedSimulation)
+            {
+                startScenes(tickTime);
+            }
+            else
+            {
+                simulateScenes(tickTime);
+            }
         }
-        
+
+        if (m_pipelinedSimulationRunning)
+        {
+            m_pipelinedTickTime = tickTime;
+            return;
+        }
+
+        FinishTick(tickTime);
+    }
+
+    void PhysXSystem::FinishPipelinedSimulation()
+    {
+        if (!m_pipelinedSimulationRunning)
+        {
+            return;
+        }
+        m_pipelinedSimulationRunning = false;
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXSystem::FinishPipelinedSimulation");
+
+        {
+            // Only measures how long the main thread waits for the step, the rest of it overlapped with the frame
+            AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+            for (auto& scenePtr : m_sceneList)
+            {
+                if (scenePtr != nullptr)
+                {
+                    scenePtr->FinishSimulation();
+                }
+            }
+        }
+
+        FinishTick(m_pipelinedTickTime);
+    }
+
+    void PhysXSystem::FinishTick(float tickTime)
+    {
         // Flush performance data for this tick
         m_performanceCollector->FrameTick();
         
@@ -366,6 +438,8 @@ namespace PhysX
             return;
         }
 
+        FinishPipelinedSimulation();
+
         AZ::u64 index = AZStd::get<AzPhysics::HandleTypeIndex::Index>(handle);
         if (index < m_sceneList.size() )
         {
@@ -392,6 +466,8 @@ namespace PhysX
 
     void PhysXSystem::RemoveAllScenes()
     {
+        FinishPipelinedSimulation();
+
         m_sceneList.clear();
 
         //clear the free slots queue
@@ -96,6 +96,12 @@ namespace PhysX
 
         void InitializePerformanceCollector();
 
+        //! Completes the sub-step that was left running by the last Simulate call when physx_pipelinedSimulation is enabled.
+        void FinishPipelinedSimulation();
+
+        //! Flushes the batched transform syncs and the performance data of the tick, and signals the post simulate event.
+        void FinishTick(float tickTime);
+
         PhysXSystemConfiguration m_systemConfig;
         AzPhysics::SceneConfiguration m_defaultSceneConfiguration;
         AzPhysics::SceneList m_sceneList;
@@ -103,6 +109,9 @@ namespace PhysX
 
         float m_accumulatedTime = 0.0f;
 
+        bool m_pipelinedSimulationRunning = false; //!< The last sub-step of the previous tick is still running.
+        float m_pipelinedTickTime = 0.0f; //!< Tick time of the previous tick, for the post simulate event when its last sub-step completes.
+
         struct PhysXSdk
         {
             physx::PxFoundation* m_foundation = nullptr;
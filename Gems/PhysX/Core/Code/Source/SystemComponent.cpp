@@ -228,6 +228,7 @@ namespace PhysX
         }
 
         m_assetHandlers.clear(); //this need to be after m_physXSystem->Shutdown();
+        m_cookedMeshCache.Clear();
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMesh(const void* vertices, AZ::u32 vertexNum, AZ::u32 vertexStride)
@@ -294,30 +295,46 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
-        
-        if(cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
-        
-        return cookingResult;
+        return m_cookedMeshCache.GetOrCook(
+            Physics::CookedMeshShapeConfiguration::MeshType::Convex,
+            AZStd::span<const AZ::Vector3>(vertices, vertexCount),
+            {},
+            [vertices, vertexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+
+                bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
+
+                if (cookingResult)
+                {
+                    cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                }
+
+                return cookingResult;
+            },
+            result);
     }
 
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        return m_cookedMeshCache.GetOrCook(
+            Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh,
+            AZStd::span<const AZ::Vector3>(vertices, vertexCount),
+            AZStd::span<const AZ::u32>(indices, indexCount),
+            [vertices, vertexCount, indices, indexCount](AZStd::vector<AZ::u8>& cookedData)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
 
-        if (cookingResult)
-        {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
-        }
+                if (cookingResult)
+                {
+                    cookedData.insert(cookedData.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                }
 
-        return cookingResult;
+                return cookingResult;
+            },
+            result);
     }
 
     physx::PxConvexMesh* SystemComponent::CreateConvexMeshFromCooked(const void* cookedMeshData, AZ::u32 bufferSize)
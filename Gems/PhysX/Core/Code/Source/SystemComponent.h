@@ -29,6 +29,7 @@
 #include <PhysX/Configuration/PhysXConfiguration.h>
 #include <Configuration/PhysXSettingsRegistryManager.h>
 #include <DefaultWorldComponent.h>
+#include <System/PhysXCookedMeshCache.h>
 
 namespace AzPhysics
 {
@@ -132,6 +133,7 @@ namespace PhysX
         AZ::Interface<Physics::System> m_physicsSystem;
 
         PhysXSystem* m_physXSystem = nullptr;
+        CookedMeshCache m_cookedMeshCache; //!< Cooked data of the meshes cooked at runtime, reused when cooking the same geometry again.
         bool m_isTickingPhysics = false;
         AzPhysics::SystemEvents::OnInitializedEvent::Handler m_onSystemInitializedHandler;
         AzPhysics::SystemEvents::OnConfigurationChangedEvent::Handler m_onSystemConfigChangedHandler;
@@ -489,5 +489,70 @@ namespace PhysXEditorTests
         }
     }
 
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentHeightfieldColliderRepeatedHeightChangesCorrectRuntimeGeometry)
+    {
+        AZ::EntityId gameEntityId = m_gameEntity->GetId();
+
+        // Send several height changes without waiting for the updates in between, so that the later changes get queued while
+        // the earlier ones are still updating the heightfield.
+        constexpr int numHeightChanges = 5;
+        for (int change = 0; change < numHeightChanges; ++change)
+        {
+            Physics::HeightfieldProviderNotificationBus::Event(
+                gameEntityId,
+                &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+                AZ::Aabb::CreateFromMinMaxValues(0.0f, 1.0f, -3.0f, 1.0f, 2.0f, 3.0f),
+                Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+        }
+
+        auto runtimeHeightfieldComponent = m_gameEntity->FindComponent<PhysX::HeightfieldColliderComponent>();
+        runtimeHeightfieldComponent->BlockOnPendingJobs();
+
+        AzPhysics::SimulatedBody* staticBody = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            staticBody, gameEntityId, &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        ASSERT_NE(staticBody, nullptr);
+        const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+
+        PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+        physx::PxShape* shape = nullptr;
+        pxRigidStatic->getShapes(&shape, 1, 0);
+        EXPECT_EQ(shape->getGeometryType(), physx::PxGeometryType::eHEIGHTFIELD);
+
+        physx::PxHeightFieldGeometry heightfieldGeometry;
+        shape->getHeightFieldGeometry(heightfieldGeometry);
+        physx::PxHeightField* heightfield = heightfieldGeometry.heightField;
+
+        size_t numRows{ 0 };
+        size_t numColumns{ 0 };
+        Physics::HeightfieldProviderRequestsBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, numColumns, numRows);
+        EXPECT_EQ(numColumns, heightfield->getNbColumns());
+        EXPECT_EQ(numRows, heightfield->getNbRows());
+
+        AZStd::vector<Physics::HeightMaterialPoint> samples;
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            samples, gameEntityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterials);
+
+        float minHeightBounds{ 0.0f };
+        float maxHeightBounds{ 0.0f };
+        Physics::HeightfieldProviderRequestsBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldHeightBounds, minHeightBounds, maxHeightBounds);
+
+        const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
+        const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+
+        for (int sampleRow = 0; sampleRow < numRows; ++sampleRow)
+        {
+            for (int sampleColumn = 0; sampleColumn < numColumns; ++sampleColumn)
+            {
+                physx::PxHeightFieldSample samplePhysX = heightfield->getSample(sampleRow, sampleColumn);
+                Physics::HeightMaterialPoint samplePhysics = samples[sampleRow * numColumns + sampleColumn];
+                EXPECT_EQ(samplePhysX.height, azlossy_cast<physx::PxI16>(samplePhysics.m_height * scaleFactor));
+            }
+        }
+    }
+
 } // namespace PhysXEditorTests
 
@@ -6,7 +6,9 @@
  *
  */
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1009,135 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //create enough raycast requests for the batch to be split into several tasks
+        constexpr size_t RequestCount = 1000;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < RequestCount; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result is the hit of its own request
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackReceivesExpectedHits)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle =
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX();
+        request.m_distance = 200.0f;
+
+        const AzPhysics::SceneQuery::AsyncRequestId expectedRequestId = 42;
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHits results;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, expectedRequestId, &request,
+            [&callbackCalled, &results, expectedRequestId](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, expectedRequestId);
+                results = AZStd::move(hits);
+                callbackCalled = true;
+            });
+        ASSERT_TRUE(queued);
+
+        //the callback is queued on the tick bus once the query finishes
+        const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+        while (!callbackCalled && AZStd::chrono::steady_clock::now() < timeout)
+        {
+            AZ::TickBus::ExecuteQueuedEvents();
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(results.m_hits.size(), 1);
+        EXPECT_TRUE(results.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackReceivesHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        bool callbackCalled = false;
+        AzPhysics::SceneQueryHitsList results;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+            [&callbackCalled, &results](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                results = AZStd::move(hits);
+                callbackCalled = true;
+            });
+        ASSERT_TRUE(queued);
+
+        // the requests are copied, so changing them doesn't affect the running query
+        requests.clear();
+
+        const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+        while (!callbackCalled && AZStd::chrono::steady_clock::now() < timeout)
+        {
+            AZ::TickBus::ExecuteQueuedEvents();
+        }
+
+        ASSERT_TRUE(callbackCalled);
+        ASSERT_EQ(results.size(), simBodies.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
 }
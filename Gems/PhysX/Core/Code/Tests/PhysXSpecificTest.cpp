@@ -35,6 +35,7 @@
 #include <PhysX/SystemComponentBus.h>
 #include <PhysX/Material/PhysXMaterialConfiguration.h>
 #include <Scene/PhysXScene.h>
+#include <System/PhysXCookedMeshCache.h>
 #include <Tests/PhysXTestCommon.h>
 
 namespace PhysX
@@ -889,6 +890,73 @@ namespace PhysX
         rigidBody = nullptr;
     }
 
+    TEST_F(PhysXSpecificTest, CookedMeshCache_SameGeometry_CooksOnce)
+    {
+        CookedMeshCache cache;
+        int cookCount = 0;
+        auto cookFunction = [&cookCount](AZStd::vector<AZ::u8>& cookedData)
+        {
+            cookCount++;
+            cookedData = { 1, 2, 3 };
+            return true;
+        };
+
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> firstResult;
+        AZStd::vector<AZ::u8> secondResult;
+        EXPECT_TRUE(cache.GetOrCook(CookedMeshCache::MeshType::Convex, testPoints, {}, cookFunction, firstResult));
+        EXPECT_TRUE(cache.GetOrCook(CookedMeshCache::MeshType::Convex, testPoints, {}, cookFunction, secondResult));
+
+        EXPECT_EQ(cookCount, 1);
+        EXPECT_EQ(firstResult, secondResult);
+        EXPECT_EQ(cache.GetCookedDataSize(), 3);
+
+        // Different geometry, or the same vertices cooked as a different mesh type, cook again
+        const PointList otherPoints = TestUtils::GeneratePyramidPoints(2.0f);
+        AZStd::vector<AZ::u8> otherResult;
+        EXPECT_TRUE(cache.GetOrCook(CookedMeshCache::MeshType::Convex, otherPoints, {}, cookFunction, otherResult));
+        EXPECT_TRUE(cache.GetOrCook(CookedMeshCache::MeshType::TriangleMesh, testPoints, {}, cookFunction, otherResult));
+        EXPECT_EQ(cookCount, 3);
+
+        cache.Clear();
+        EXPECT_EQ(cache.GetCookedDataSize(), 0);
+    }
+
+    TEST_F(PhysXSpecificTest, CookedMeshCache_FailedCooking_IsNotCached)
+    {
+        CookedMeshCache cache;
+        int cookCount = 0;
+        auto cookFunction = [&cookCount]([[maybe_unused]] AZStd::vector<AZ::u8>& cookedData)
+        {
+            cookCount++;
+            return false;
+        };
+
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> result;
+        EXPECT_FALSE(cache.GetOrCook(CookedMeshCache::MeshType::Convex, testPoints, {}, cookFunction, result));
+        EXPECT_FALSE(cache.GetOrCook(CookedMeshCache::MeshType::Convex, testPoints, {}, cookFunction, result));
+        EXPECT_EQ(cookCount, 2);
+        EXPECT_TRUE(result.empty());
+    }
+
+    TEST_F(PhysXSpecificTest, CookConvexMeshToMemory_SameGeometry_ReturnsSameCookedData)
+    {
+        const PointList testPoints = TestUtils::GeneratePyramidPoints(1.0f);
+        AZStd::vector<AZ::u8> firstCookedData;
+        AZStd::vector<AZ::u8> secondCookedData;
+        bool cookingResult = false;
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), firstCookedData);
+        EXPECT_TRUE(cookingResult);
+        Physics::SystemRequestBus::BroadcastResult(cookingResult, &Physics::SystemRequests::CookConvexMeshToMemory,
+            testPoints.data(), static_cast<AZ::u32>(testPoints.size()), secondCookedData);
+        EXPECT_TRUE(cookingResult);
+
+        EXPECT_FALSE(firstCookedData.empty());
+        EXPECT_EQ(firstCookedData, secondCookedData);
+    }
+
     TEST_F(PhysXSpecificTest, Shape_ConstructorDestructor_PxShapeReferenceCounterIsCorrect)
     {
         // Create physx::PxShape object
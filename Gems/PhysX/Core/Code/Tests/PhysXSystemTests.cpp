@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Console/IConsole.h>
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
 
@@ -16,6 +17,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_pipelinedSimulation);
+
     namespace Internal
     {
         static constexpr const char* DefaultSceneNameFormat = "scene-%u";
@@ -253,6 +256,61 @@ namespace PhysX
         EXPECT_TRUE(postSimEventCount == numFrames);
     }
 
+    TEST_F(PhysXSystemFixture, PipelinedSimulation_FinishesLastSubStepOnNextSimulate)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const AzPhysics::SystemConfiguration* config = physicsSystem->GetConfiguration();
+
+        AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        AzPhysics::Scene* scene = physicsSystem->GetScene(sceneHandle);
+        ASSERT_NE(scene, nullptr);
+
+        int startCount = 0;
+        int finishCount = 0;
+        int postSimEventCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler startHandler(
+            [&startCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                startCount++;
+            });
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler finishHandler(
+            [&finishCount]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                finishCount++;
+            });
+        AzPhysics::SystemEvents::OnPostsimulateEvent::Handler postSimEvent(
+            [&postSimEventCount]([[maybe_unused]] float deltaTime)
+            {
+                postSimEventCount++;
+            });
+        scene->RegisterSceneSimulationStartHandler(startHandler);
+        scene->RegisterSceneSimulationFinishHandler(finishHandler);
+        physicsSystem->RegisterPostSimulateEvent(postSimEvent);
+
+        const bool pipelinedSimulation = physx_pipelinedSimulation;
+        physx_pipelinedSimulation = true;
+
+        //run a few sub-steps, the last one should still be running when Simulate returns
+        physicsSystem->Simulate(config->m_fixedTimestep * 2.5f);
+        EXPECT_GE(startCount, 2);
+        EXPECT_EQ(finishCount, startCount - 1);
+        EXPECT_EQ(postSimEventCount, 0);
+
+        //the next Simulate call completes the running sub-step before starting its own
+        const int firstTickStartCount = startCount;
+        physicsSystem->Simulate(config->m_fixedTimestep * 2.5f);
+        EXPECT_GT(startCount, firstTickStartCount);
+        EXPECT_EQ(finishCount, startCount - 1);
+        EXPECT_EQ(postSimEventCount, 1);
+
+        //removing the scene completes the running sub-step
+        physicsSystem->RemoveScene(sceneHandle);
+        EXPECT_EQ(finishCount, startCount);
+        EXPECT_EQ(postSimEventCount, 2);
+
+        physx_pipelinedSimulation = pipelinedSimulation;
+    }
+
     TEST_F(PhysXSystemFixture, PreSimulateEvent_WithDeltaTime_GreaterThanMaxTimeStep_ShouldSendMaxTimeStep)
     {
         auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
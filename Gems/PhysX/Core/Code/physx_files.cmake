@@ -144,6 +144,8 @@ set(FILES
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
+    Source/System/PhysXCookedMeshCache.h
+    Source/System/PhysXCookedMeshCache.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
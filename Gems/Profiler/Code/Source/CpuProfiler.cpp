@@ -234,7 +234,7 @@ namespace Profiler
         }
 
         // Clear all TLS that flagged themselves to be deleted, meaning that the thread is already terminated
-        AZStd::remove_if(m_registeredThreads.begin(), m_registeredThreads.end(), [](const AZStd::intrusive_ptr<CpuTimingLocalStorage>& thread)
+        AZStd::erase_if(m_registeredThreads, [](const AZStd::intrusive_ptr<CpuTimingLocalStorage>& thread)
         {
             return thread->m_deleteFlag.load();
         });
@@ -245,12 +245,16 @@ namespace Profiler
 
     void CpuProfiler::RegisterThreadStorage()
     {
-        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
-        if (!ms_threadLocalStorage)
+        // The storage is thread local, so only the registration needs the lock. Locking on every region would make all the profiled
+        // threads contend with each other and with the flush in OnSystemTick().
+        if (ms_threadLocalStorage)
         {
-            ms_threadLocalStorage = aznew CpuTimingLocalStorage();
-            m_registeredThreads.emplace_back(ms_threadLocalStorage);
+            return;
         }
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+        ms_threadLocalStorage = aznew CpuTimingLocalStorage();
+        m_registeredThreads.emplace_back(ms_threadLocalStorage);
     }
 
     // --- CpuTimingLocalStorage ---
@@ -318,8 +322,7 @@ namespace Profiler
     // Gets called when region ends and all data is set
     void CpuTimingLocalStorage::AddCachedRegion(const CachedTimeRegion& timeRegionCached)
     {
-        if (auto iter = m_hitSizeLimitMap.find(timeRegionCached.m_groupRegionName.m_regionName.GetStringView());
-            iter != m_hitSizeLimitMap.end() && iter->second)
+        if (m_hitSizeLimitSet.contains(timeRegionCached.m_groupRegionName.m_regionName.GetStringView()))
         {
             return;
         }
@@ -351,12 +354,18 @@ namespace Profiler
             // Add the cached regions to the map
             for (auto& cachedTimeRegion : m_cachedTimeRegions)
             {
-                const AZStd::string regionName = cachedTimeRegion.m_groupRegionName.m_regionName.GetStringView();
-                AZStd::vector<CachedTimeRegion>& regionVec = m_cachedTimeRegionMap[regionName];
+                // Only allocate the name the first time the region is seen since the last flush
+                const AZStd::string_view regionName = cachedTimeRegion.m_groupRegionName.m_regionName.GetStringView();
+                auto regionIt = m_cachedTimeRegionMap.find(regionName);
+                if (regionIt == m_cachedTimeRegionMap.end())
+                {
+                    regionIt = m_cachedTimeRegionMap.emplace(regionName, AZStd::vector<CachedTimeRegion>()).first;
+                }
+                AZStd::vector<CachedTimeRegion>& regionVec = regionIt->second;
                 regionVec.push_back(cachedTimeRegion);
                 if (regionVec.size() >= TimeRegionStackSize)
                 {
-                    m_hitSizeLimitMap.insert_or_assign(AZStd::move(regionName), true);
+                    m_hitSizeLimitSet.emplace(regionName);
                 }
             }
 
@@ -376,7 +385,7 @@ namespace Profiler
             {
                 cachedTimeRegionMap = AZStd::move(m_cachedTimeRegionMap);
                 m_cachedTimeRegionMap.clear();
-                m_hitSizeLimitMap.clear();
+                m_hitSizeLimitSet.clear();
             }
 
             m_cachedTimeRegionMutex.unlock();
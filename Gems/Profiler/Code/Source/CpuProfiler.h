@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
@@ -54,7 +55,9 @@ namespace Profiler
         AZStd::sys_time_t m_endTick = 0;
     };
 
-    using ThreadTimeRegionMap = AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>>;
+    // Transparent so the regions can be looked up by the string view of their name without allocating
+    using ThreadTimeRegionMap =
+        AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>, AZStd::hash<AZStd::string>, AZStd::equal_to<>>;
     using TimeRegionMap = AZStd::unordered_map<AZStd::thread_id, ThreadTimeRegionMap>;
 
     //! Thread local class to keep track of the thread's cached time regions.
@@ -114,7 +117,7 @@ namespace Profiler
         AZStd::atomic_bool m_deleteFlag = false;
 
         // Keep track of the regions that have hit the size limit so we don't have to lock to check
-        AZStd::map<AZStd::string, bool> m_hitSizeLimitMap;
+        AZStd::unordered_set<AZStd::string, AZStd::hash<AZStd::string>, AZStd::equal_to<>> m_hitSizeLimitSet;
 
         // Keeps track of the first time cached data limit was reached.
         bool m_cachedDataLimitReached = false;
@@ -168,7 +171,7 @@ namespace Profiler
         static constexpr AZStd::size_t MaxFramesToSave = 2 * 60 * 120; // 2 minutes of 120fps
         static constexpr AZStd::size_t MaxRegionStringPoolSize = 16384; // Max amount of unique strings to save in the pool before throwing warnings.
 
-        // Lazily create and register the local thread data
+        // Lazily create and register the local thread data. Only locks the first time a thread begins a region.
         void RegisterThreadStorage();
 
         // ThreadId -> ThreadTimeRegionMap
@@ -8,17 +8,26 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/time.h>
 
 namespace Profiler
 {
     static constexpr AZ::Crc32 profilerServiceCrc = AZ_CRC_CE("ProfilerService");
 
+    AZ_CVAR(bool, profiler_saveTraceEvents, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, cpu captures are also saved in the trace event format (.trace.json), which can be opened in Perfetto or chrome://tracing.");
+
     struct DelayedFunction
     {
         using func_type = AZStd::function<void()>;
@@ -51,6 +60,79 @@ namespace Profiler
         int m_framesLeft{ 0 };
     };
 
+    // When allocation sampling is enabled, the sampled allocation callsites are saved as trace events next to the cpu capture
+    void SaveAllocationCallsites(const AZStd::string& cpuCaptureFilePath)
+    {
+        AZ::AllocatorManager& allocatorManager = AZ::AllocatorManager::Instance();
+        if (allocatorManager.GetAllocationSamplingInterval() == 0)
+        {
+            return;
+        }
+
+        AZ::IO::Path filePath(cpuCaptureFilePath);
+        filePath.ReplaceExtension("allocations.json");
+        constexpr auto openMode = AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeWrite;
+        auto fileStream = AZStd::make_unique<AZ::IO::SystemFileStream>(filePath.c_str(), openMode);
+        if (!fileStream->IsOpen())
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Failed to open '%s' to save the allocation callsites", filePath.c_str());
+            return;
+        }
+
+        AZ::Metrics::JsonTraceEventLogger eventLogger(AZStd::move(fileStream));
+        allocatorManager.RecordAllocationCallsites(eventLogger);
+        eventLogger.Flush();
+        AZ_Printf("ProfilerSystemComponent", "Allocation callsites were saved to file [%s]\n", filePath.c_str());
+    }
+
+    // Saves the captured regions as complete trace events next to the cpu capture, so the capture can be opened in external trace viewers
+    void SaveCpuTraceEvents(const AZStd::ring_buffer<TimeRegionMap>& data, const AZStd::string& cpuCaptureFilePath)
+    {
+        if (!profiler_saveTraceEvents)
+        {
+            return;
+        }
+
+        AZ::IO::Path filePath(cpuCaptureFilePath);
+        filePath.ReplaceExtension("trace.json");
+        constexpr auto openMode = AZ::IO::OpenMode::ModeCreatePath | AZ::IO::OpenMode::ModeWrite;
+        auto fileStream = AZStd::make_unique<AZ::IO::SystemFileStream>(filePath.c_str(), openMode);
+        if (!fileStream->IsOpen())
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Failed to open '%s' to save the trace events", filePath.c_str());
+            return;
+        }
+
+        const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+        auto ticksToMicroseconds = [microsecondsPerTick](AZStd::sys_time_t ticks)
+        {
+            return AZStd::chrono::microseconds(static_cast<AZStd::chrono::microseconds::rep>(static_cast<double>(ticks) * microsecondsPerTick));
+        };
+
+        AZ::Metrics::JsonTraceEventLogger eventLogger(AZStd::move(fileStream));
+        for (const TimeRegionMap& timeRegionMap : data)
+        {
+            for (const auto& [threadId, regionMap] : timeRegionMap)
+            {
+                for (const auto& [regionName, regionVec] : regionMap)
+                {
+                    for (const CachedTimeRegion& region : regionVec)
+                    {
+                        AZ::Metrics::CompleteArgs completeArgs;
+                        completeArgs.m_name = region.m_groupRegionName.m_regionName.GetStringView();
+                        completeArgs.m_cat = region.m_groupRegionName.m_groupName;
+                        completeArgs.m_ts = ticksToMicroseconds(region.m_startTick);
+                        completeArgs.m_dur = ticksToMicroseconds(region.m_endTick - region.m_startTick);
+                        completeArgs.m_tid = threadId;
+                        eventLogger.RecordCompleteEvent(completeArgs);
+                    }
+                }
+            }
+        }
+        eventLogger.Flush();
+        AZ_Printf("ProfilerSystemComponent", "Trace events were saved to file [%s]\n", filePath.c_str());
+    }
+
     bool SerializeCpuProfilingData(const AZStd::ring_buffer<TimeRegionMap>& data, AZStd::string outputFilePath, bool wasEnabled)
     {
         AZ_TracePrintf("ProfilerSystemComponent", "Beginning serialization of %zu frames of profiling data\n", data.size());
@@ -73,6 +155,8 @@ namespace Profiler
         else
         {
             AZ_Printf("ProfilerSystemComponent", "Cpu profiling statistics was saved to file [%s]\n", outputFilePath.c_str());
+            SaveCpuTraceEvents(data, outputFilePath);
+            SaveAllocationCallsites(outputFilePath);
         }
 
         // Disable the profiler again
@@ -38,8 +38,56 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Queues finding a walkable path between two entities. Requests from all the entities are processed over the next ticks
+        //! within a per tick budget, and the result is sent with @DetourNavigationNotificationBus.
+        //! The positions of the entities are taken when the request is processed.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @return The id of the request, passed to @DetourNavigationNotifications::OnPathFound along with the path.
+        virtual AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) = 0;
+
+        //! Queues finding a walkable path between two world positions. Requests from all the entities are processed over the next ticks
+        //! within a per tick budget, and the result is sent with @DetourNavigationNotificationBus.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @return The id of the request, passed to @DetourNavigationNotifications::OnPathFound along with the path.
+        virtual AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
     };
 
     //! Request EBus for a path finding component.
     using DetourNavigationRequestBus = AZ::EBus<DetourNavigationRequests>;
+
+    //! The interface for notification API of @DetourNavigationNotificationBus.
+    class DetourNavigationNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Notifies when a path requested with one of the async requests of @DetourNavigationRequestBus was processed.
+        //! @param requestId the id returned by the request.
+        //! @param path the waypoints of the path. An empty vector if a path was not found.
+        virtual void OnPathFound(AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) = 0;
+    };
+
+    //! Notification EBus for a path finding component.
+    using DetourNavigationNotificationBus = AZ::EBus<DetourNavigationNotifications>;
+
+    //! Scripting reflection helper for @DetourNavigationNotificationBus.
+    class DetourNavigationNotificationHandler
+        : public DetourNavigationNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(DetourNavigationNotificationHandler,
+            "{4C1F0F3E-7B0A-4E8A-9D54-2A6C3E5B8F17}",
+            AZ::SystemAllocator, OnPathFound);
+
+        //! Notifies when a requested path was processed.
+        //! @param requestId the id returned by the request.
+        //! @param path the waypoints of the path. An empty vector if a path was not found.
+        void OnPathFound(AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) override
+        {
+            Call(FN_OnPathFound, requestId, path);
+        }
+    };
 } // namespace RecastNavigation
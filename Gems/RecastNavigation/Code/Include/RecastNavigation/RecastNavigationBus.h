@@ -10,6 +10,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/functional.h>
 
 namespace RecastNavigation
 {
@@ -18,6 +19,12 @@ namespace RecastNavigation
     public:
         AZ_RTTI(RecastNavigationRequests, "{d1c2f552-287d-4aa1-a5b8-5b234c9106f3}");
         virtual ~RecastNavigationRequests() = default;
+
+        //! Queues a path request to be processed on the main thread. A limited number of requests is processed each tick,
+        //! set by the navmesh_maxPathRequestsPerTick cvar, so many agents requesting paths at once don't cause a spike.
+        //! Requests are processed in the order they were queued.
+        //! @param pathRequest the function finding the path and notifying the result
+        virtual void QueuePathRequest(AZStd::function<void()> pathRequest) = 0;
     };
 
     class RecastNavigationBusTraits
@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,12 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the navigation tiles affected by a change within the given world area, for example a destroyed
+        //! or newly placed static object. Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! @param region the world space volume that changed
+        //! @returns false if another update operation is already in progress
+        virtual bool UpdateNavigationMeshWithinRegionAsync(const AZ::Aabb& region) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
@@ -34,6 +34,20 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Same as @CollectGeometryAsync but only collects the tiles affected by a change within @region,
+        //! that is the tiles whose area, including the border, overlaps the region.
+        //! Providers that can't limit the collection to a region collect all the tiles instead.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile.
+        //! @param region The world space volume that changed.
+        //! @param tileCallback will be called once for each tile with geometry data and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, [[maybe_unused]] const AZ::Aabb& region,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+        {
+            return CollectGeometryAsync(tileSize, borderSize, AZStd::move(tileCallback));
+        }
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
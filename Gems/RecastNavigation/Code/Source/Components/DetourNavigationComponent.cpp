@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
@@ -40,11 +41,19 @@ namespace RecastNavigation
                 ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
                 ->Event("FindPathBetweenEntities", &DetourNavigationRequests::FindPathBetweenEntities)
                 ->Event("FindPathBetweenPositions", &DetourNavigationRequests::FindPathBetweenPositions)
+                ->Event("FindPathBetweenEntitiesAsync", &DetourNavigationRequests::FindPathBetweenEntitiesAsync)
+                ->Event("FindPathBetweenPositionsAsync", &DetourNavigationRequests::FindPathBetweenPositionsAsync)
                 ->Event("SetNavigationMeshEntity", &DetourNavigationRequests::SetNavigationMeshEntity)
                 ->Event("GetNavigationMeshEntity", &DetourNavigationRequests::GetNavigationMeshEntity)
                 ;
 
             behaviorContext->Class<DetourNavigationComponent>()->RequestBus("DetourNavigationRequestBus");
+
+            behaviorContext->EBus<DetourNavigationNotificationBus>("DetourNavigationNotificationBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "navigation")
+                ->Attribute(AZ::Script::Attributes::Category, "Recast Navigation")
+                ->Handler<DetourNavigationNotificationHandler>();
         }
     }
 
@@ -142,6 +151,54 @@ namespace RecastNavigation
         return pathPoints;
     }
 
+    AZ::u64 DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity)
+    {
+        return QueuePathRequest([entityId = GetEntityId(), fromEntity, toEntity]()
+            {
+                AZStd::vector<AZ::Vector3> path;
+                DetourNavigationRequestBus::EventResult(path, entityId, &DetourNavigationRequests::FindPathBetweenEntities, fromEntity, toEntity);
+                return path;
+            });
+    }
+
+    AZ::u64 DetourNavigationComponent::FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
+    {
+        return QueuePathRequest([entityId = GetEntityId(), fromWorldPosition, toWorldPosition]()
+            {
+                AZStd::vector<AZ::Vector3> path;
+                DetourNavigationRequestBus::EventResult(path, entityId, &DetourNavigationRequests::FindPathBetweenPositions, fromWorldPosition, toWorldPosition);
+                return path;
+            });
+    }
+
+    AZ::u64 DetourNavigationComponent::QueuePathRequest(AZStd::function<AZStd::vector<AZ::Vector3>()> findPath)
+    {
+        const AZ::u64 requestId = ++m_lastPathRequestId;
+        const AZ::EntityId entityId = GetEntityId();
+
+        // The component might get deactivated before the request is processed, so it's only accessed through the request bus.
+        auto pathRequest = [entityId, requestId, findPath = AZStd::move(findPath)]()
+        {
+            if (!DetourNavigationRequestBus::HasHandlers(entityId))
+            {
+                return;
+            }
+
+            const AZStd::vector<AZ::Vector3> path = findPath();
+            DetourNavigationNotificationBus::Event(entityId, &DetourNavigationNotifications::OnPathFound, requestId, path);
+        };
+
+        if (RecastNavigationRequests* recastNavigation = RecastNavigationInterface::Get())
+        {
+            recastNavigation->QueuePathRequest(AZStd::move(pathRequest));
+        }
+        else
+        {
+            pathRequest();
+        }
+        return requestId;
+    }
+
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
     {
         m_navQueryEntityId = navMeshEntity;
@@ -34,6 +34,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        AZ::u64 FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
+        AZ::u64 FindPathBetweenPositionsAsync(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
         //! @}
@@ -45,6 +47,13 @@ namespace RecastNavigation
         //! @}
 
     private:
+        //! Queues a path request with the Recast navigation system, or processes it right away if the system isn't available.
+        //! @param findPath finds the path when the request is processed
+        //! @return the id of the request
+        AZ::u64 QueuePathRequest(AZStd::function<AZStd::vector<AZ::Vector3>()> findPath);
+
+        //! Id of the last queued path request.
+        AZ::u64 m_lastPathRequestId = 0;
         //! Entity id of the entity with a navigation mesh component.
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
@@ -115,16 +115,25 @@ namespace RecastNavigation
     }
 
     bool RecastNavigationMeshComponentController::UpdateNavigationMeshAsync()
+    {
+        AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
+        RecastNavigationProviderRequestBus::EventResult(worldBounds, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::GetWorldBounds);
+        return UpdateNavigationMeshWithinRegionAsync(worldBounds);
+    }
+
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshWithinRegionAsync(const AZ::Aabb& region)
     {
         bool notInProgress = false;
         if (m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            // Only the tiles affected by the region get collected, the other tiles of the navigation mesh are kept as they are.
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
-                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
+                &RecastNavigationProviderRequests::CollectGeometryWithinRegionAsync,
+                m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, region,
                 [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
                     OnTileProcessedEvent(tile);
@@ -72,6 +72,7 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshWithinRegionAsync(const AZ::Aabb& region) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
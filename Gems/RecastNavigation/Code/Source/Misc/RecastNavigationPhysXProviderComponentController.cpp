@@ -121,7 +121,17 @@ namespace RecastNavigation
         float borderSize,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
-        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+        const AZ::Aabb worldBounds = GetWorldBounds();
+        return CollectGeometryAsyncImpl(tileSize, borderSize, worldBounds, worldBounds, AZStd::move(tileCallback));
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinRegionAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& region,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), region, AZStd::move(tileCallback));
     }
 
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
@@ -358,6 +368,7 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
+        const AZ::Aabb& region,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
         bool notInProgress = false;
@@ -408,6 +419,13 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+
+                    // A change within the border of a tile affects its geometry as well.
+                    if (!scanVolume.Overlaps(region))
+                    {
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -47,6 +47,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        bool CollectGeometryWithinRegionAsync(float tileSize, float borderSize, const AZ::Aabb& region,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -77,12 +79,14 @@ namespace RecastNavigation
         //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
         //! @param borderSize an additional extend in all direction around the tile volume, this additional geometry will allow Recast to connect tiles together
         //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
+        //! @param region only the tiles whose scan volume overlaps this volume are collected
         //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
         //! @returns true if an async operation was scheduled, false otherwise
         bool CollectGeometryAsyncImpl(
             float tileSize,
             float borderSize,
             const AZ::Aabb& worldVolume,
+            const AZ::Aabb& region,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
 
         //! Finds all the static PhysX colliders within a given volume.
@@ -7,9 +7,14 @@
  */
 
 #include <RecastNavigationSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
+AZ_CVAR(
+    AZ::u32, navmesh_maxPathRequestsPerTick, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of queued path requests processed each tick. The remaining requests are processed over the next ticks");
+
 namespace RecastNavigation
 {
     void RecastNavigationSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -78,10 +83,36 @@ namespace RecastNavigation
     {
         AZ::TickBus::Handler::BusDisconnect();
         RecastNavigationRequestBus::Handler::BusDisconnect();
+
+        AZStd::lock_guard lock(m_pathRequestsMutex);
+        m_pathRequests.clear();
     }
 
     void RecastNavigationSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        const AZ::u32 maxPathRequests = navmesh_maxPathRequestsPerTick;
+        for (AZ::u32 i = 0; i < maxPathRequests; ++i)
+        {
+            AZStd::function<void()> pathRequest;
+            {
+                AZStd::lock_guard lock(m_pathRequestsMutex);
+                if (m_pathRequests.empty())
+                {
+                    break;
+                }
+                pathRequest = AZStd::move(m_pathRequests.front());
+                m_pathRequests.pop_front();
+            }
+
+            // Called outside of the lock, so the request can queue further requests.
+            pathRequest();
+        }
+    }
+
+    void RecastNavigationSystemComponent::QueuePathRequest(AZStd::function<void()> pathRequest)
+    {
+        AZStd::lock_guard lock(m_pathRequestsMutex);
+        m_pathRequests.push_back(AZStd::move(pathRequest));
     }
 
 } // namespace RecastNavigation
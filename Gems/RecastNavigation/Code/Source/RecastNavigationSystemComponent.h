@@ -10,6 +10,8 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <RecastNavigation/RecastNavigationBus.h>
 
 namespace RecastNavigation
@@ -40,6 +42,14 @@ namespace RecastNavigation
 
         //! AZTickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        //! RecastNavigationRequestBus overrides ...
+        void QueuePathRequest(AZStd::function<void()> pathRequest) override;
+
+    private:
+        //! Path requests waiting to be processed, in the order they were queued.
+        AZStd::deque<AZStd::function<void()>> m_pathRequests;
+        AZStd::mutex m_pathRequestsMutex;
     };
 
 } // namespace RecastNavigation
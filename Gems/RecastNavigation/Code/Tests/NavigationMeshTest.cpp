@@ -13,6 +13,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
@@ -531,6 +532,55 @@ namespace RecastNavigationTests
         EXPECT_GT(waypoints.size(), 0);
     }
 
+    /*
+     * Async find path test, the path is found once the queued requests are processed on tick.
+     */
+    TEST_F(NavigationTest, FindPathAsyncTest)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        class PathHandler : public RecastNavigation::DetourNavigationNotificationBus::Handler
+        {
+        public:
+            void OnPathFound(AZ::u64 requestId, const AZStd::vector<AZ::Vector3>& path) override
+            {
+                m_paths[requestId] = path;
+            }
+
+            AZStd::unordered_map<AZ::u64, AZStd::vector<AZ::Vector3>> m_paths;
+        };
+        PathHandler handler;
+        handler.BusConnect(AZ::EntityId(1));
+
+        AZ::u64 firstRequestId = 0;
+        AZ::u64 secondRequestId = 0;
+        DetourNavigationRequestBus::EventResult(firstRequestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0));
+        DetourNavigationRequestBus::EventResult(secondRequestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0));
+        EXPECT_NE(firstRequestId, secondRequestId);
+        EXPECT_TRUE(handler.m_paths.empty());
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+
+        ASSERT_EQ(handler.m_paths.size(), 2);
+        EXPECT_GT(handler.m_paths[firstRequestId].size(), 0);
+        EXPECT_GT(handler.m_paths[secondRequestId].size(), 0);
+        handler.BusDisconnect();
+    }
+
     /*
      * Test with one of the point being way outside of the range of the navigation mesh.
      */
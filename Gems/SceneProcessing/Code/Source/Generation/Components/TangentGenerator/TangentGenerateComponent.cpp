@@ -27,8 +27,13 @@
 #include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
 #include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 
@@ -132,14 +137,50 @@ namespace AZ::SceneGenerationComponents
         }
 
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        // This only adds the missing tangent layers, the MikkT generation itself is done afterwards when the graph doesn't change anymore.
+        AZStd::vector<MeshTangentGeneration> generations(meshes.size());
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod))
+            if (!GenerateTangentsForMesh(context.GetScene(), meshes[meshIndex].second, meshes[meshIndex].first, generationMethod, generations[meshIndex]))
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
+        }
+
+        // Generate the tangents of each mesh in its own job, dense characters have many meshes with hundreds of thousands of vertices.
+        AZStd::atomic_bool allGenerated{ true };
+        if (generations.size() > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (const MeshTangentGeneration& generation : generations)
+            {
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([&generation, &allGenerated]()
+                {
+                    AZ_PROFILE_SCOPE(Editor, "TangentGenerateComponent::GenerateTangentData::MeshJob");
+                    if (!RunMikkTGeneration(generation))
+                    {
+                        allGenerated = false;
+                    }
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else if (!generations.empty())
+        {
+            allGenerated = RunMikkTGeneration(generations.front());
+        }
+
+        if (!allGenerated)
+        {
+            return AZ::SceneAPI::Events::ProcessingResult::Failure;
+        }
 
+        for (auto& [mesh, nodeIndex] : meshes)
+        {
             // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
             // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
             if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
@@ -254,7 +295,8 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Containers::Scene& scene,
         const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
         AZ::SceneAPI::DataTypes::IMeshData* meshData,
-        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod)
+        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod,
+        MeshTangentGeneration& outGeneration)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
 
@@ -269,8 +311,8 @@ namespace AZ::SceneGenerationComponents
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        outGeneration.m_meshData = meshData;
+        FindBlendShapes(graph, nodeIndex, outGeneration.m_blendShapes);
 
         // Generate tangents/bitangents for all uv sets.
         bool allSuccess = true;
@@ -340,12 +382,8 @@ namespace AZ::SceneGenerationComponents
             {
                 const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
 
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                // The blend shapes store one set of tangents for all the uv sets, so the uv sets are generated in order
+                outGeneration.m_uvSets.push_back({ uvData, tangentData, bitangentData, uvSetIndex, tSpaceMethod });
             }
             break;
 
@@ -360,6 +398,22 @@ namespace AZ::SceneGenerationComponents
         return allSuccess;
     }
 
+    bool TangentGenerateComponent::RunMikkTGeneration(const MeshTangentGeneration& generation)
+    {
+        bool allSuccess = true;
+        for (const MikkTGeneration& uvSet : generation.m_uvSets)
+        {
+            allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                generation.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, uvSet.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : generation.m_blendShapes)
+            {
+                allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, uvSet.m_tSpaceMethod);
+            }
+        }
+        return allSuccess;
+    }
+
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
     {
         const auto nameContentView = AZ::SceneAPI::Containers::Views::MakePairView(graph.GetNameStorage(), graph.GetContentStorage());
@@ -55,6 +55,24 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        // MikkT generation of one uv set, the tangent and bitangent layers already exist in the graph
+        struct MikkTGeneration
+        {
+            const AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+        };
+        // All the MikkT generations of a mesh. They only touch the data of that mesh,
+        // so the generations of different meshes can run in parallel once the graph isn't modified anymore.
+        struct MeshTangentGeneration
+        {
+            const AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+            AZStd::vector<MikkTGeneration> m_uvSets;
+        };
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
@@ -62,7 +80,9 @@ namespace AZ::SceneGenerationComponents
             AZ::SceneAPI::Containers::Scene& scene,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZ::SceneAPI::DataTypes::IMeshData* meshData,
-            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod);
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod,
+            MeshTangentGeneration& outGeneration);
+        static bool RunMikkTGeneration(const MeshTangentGeneration& generation);
         bool UpdateFbxTangentWValues(
             AZ::SceneAPI::Containers::SceneGraph& graph,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
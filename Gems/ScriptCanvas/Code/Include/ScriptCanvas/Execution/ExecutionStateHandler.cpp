@@ -44,7 +44,7 @@ namespace ScriptCanvas
         AZ_Assert(m_executionState, "ExecutionStateHandler::Execute called without an execution state");
 #endif // defined(SC_RUNTIME_CHECKS_ENABLED)
         AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Execute (%s)"
-            , m_executionState->GetRuntimeDataOverrides().m_runtimeAsset.GetId().ToString<AZStd::string>().c_str());
+            , m_executionState->GetRuntimeDataOverrides().m_runtimeAsset.GetId().ToFixedString().c_str());
         SC_EXECUTION_TRACE_GRAPH_ACTIVATED(CreateActivationInfo());
         SCRIPT_CANVAS_PERFORMANCE_SCOPE_EXECUTION(m_executionState);
         m_executionState->Execute();
@@ -88,7 +88,7 @@ namespace ScriptCanvas
             , overrides.m_runtimeAsset.GetHint().c_str());
 #endif // defined(SC_RUNTIME_CHECKS_ENABLED)
 
-        AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Initialize (%s)", overrides.m_runtimeAsset.GetId().ToString<AZStd::string>().c_str());
+        AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Initialize (%s)", overrides.m_runtimeAsset.GetId().ToFixedString().c_str());
 
         ExecutionStateConfig config(overrides, AZStd::move(userData));
         m_executionState = overrides.m_runtimeAsset.Get()->m_runtimeData.m_createExecution(m_executionStateStorage, config);
@@ -69,14 +69,18 @@ namespace ScriptCanvas
 
         void OutInterpreted::operator()(AZ::BehaviorArgument* /*resultBVP*/, AZ::BehaviorArgument* argsBVPs, int numArguments)
         {
-            auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
             // Lua:
             lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_lambdaRegistryIndex);
             // Lua: lambda
 
-            for (int i = 0; i < numArguments; ++i)
+            // Most execution outs don't pass arguments, only look up the behavior context when there are arguments to push.
+            if (numArguments > 0)
             {
-                Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                auto behaviorContext = AZ::ScriptContext::FromNativeContext(m_lua)->GetBoundContext();
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    Execution::StackPush(m_lua, behaviorContext, argsBVPs[i]);
+                }
             }
             // Lua: lambda, args...
             const int result = InterpretedSafeCall(m_lua, numArguments, 0);
@@ -14,6 +14,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceTag.h>
@@ -161,6 +162,8 @@ namespace SurfaceData
         }
 
     protected:
+        friend class ScopedSurfacePointList;
+
         // Remove any output surface points that don't contain any of the provided surface tags.
         void FilterPoints(AZStd::span<const SurfaceTag> desiredTags);
 
@@ -222,4 +225,25 @@ namespace SurfaceData
         AZStd::vector<SurfaceTagWeights> m_surfaceWeightsList;
         AZStd::vector<AZ::EntityId> m_surfaceCreatorIdList;
     };
+
+    //! ScopedSurfacePointList lends out a SurfacePointList from a pool that's kept per thread, for queries that only need the list
+    //! for the duration of a call, such as gradients that sample surfaces. The pooled lists keep their storage between uses, so once
+    //! they've grown to the size of the queries, building a list no longer allocates.
+    //! Each ScopedSurfacePointList gets its own list, so they can be nested, for instance when a surface provider queries surfaces
+    //! while another list is being built.
+    class ScopedSurfacePointList
+    {
+    public:
+        ScopedSurfacePointList();
+        ~ScopedSurfacePointList();
+
+        ScopedSurfacePointList(const ScopedSurfacePointList&) = delete;
+        ScopedSurfacePointList& operator=(const ScopedSurfacePointList&) = delete;
+
+        SurfacePointList& operator*() { return *m_list; }
+        SurfacePointList* operator->() { return m_list.get(); }
+
+    private:
+        AZStd::unique_ptr<SurfacePointList> m_list;
+    };
 }
@@ -24,6 +24,12 @@ AZ_DEFINE_BUDGET(SurfaceData);
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // The input positions of the last region query on each thread, kept so that region queries don't allocate them every time
+        thread_local AZStd::vector<AZ::Vector3> s_regionPositions;
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -309,7 +315,10 @@ namespace SurfaceData
         const size_t totalQueryPositions = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) *
             aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
 
-        AZStd::vector<AZ::Vector3> inPositions;
+        // Reuse the storage of the previous region query on this thread. The storage is taken out of s_regionPositions for the query,
+        // so a query that runs while this one is being built gets its own storage.
+        AZStd::vector<AZ::Vector3> inPositions = AZStd::move(s_regionPositions);
+        inPositions.clear();
         inPositions.reserve(totalQueryPositions);
 
         // Initialize our list-per-position list with every input position to query from the region.
@@ -323,6 +332,8 @@ namespace SurfaceData
         }
 
         GetSurfacePointsFromListInternal(inPositions, inRegion, desiredTags, surfacePointLists);
+
+        s_regionPositions = AZStd::move(inPositions);
     }
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromList(
@@ -12,6 +12,40 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // The number of pooled lists kept per thread, which only needs to cover the nesting depth of the queries
+        constexpr size_t MaxPooledSurfacePointLists = 4;
+
+        // Lists that needed more storage than this aren't pooled, so that a single large query doesn't keep its memory around
+        constexpr size_t MaxPooledSurfacePointCapacity = 16 * 1024;
+
+        thread_local AZStd::vector<AZStd::unique_ptr<SurfacePointList>> s_pooledSurfacePointLists;
+    }
+
+    ScopedSurfacePointList::ScopedSurfacePointList()
+    {
+        if (!s_pooledSurfacePointLists.empty())
+        {
+            m_list = AZStd::move(s_pooledSurfacePointLists.back());
+            s_pooledSurfacePointLists.pop_back();
+        }
+        else
+        {
+            m_list = AZStd::make_unique<SurfacePointList>();
+        }
+    }
+
+    ScopedSurfacePointList::~ScopedSurfacePointList()
+    {
+        if (m_list->m_surfacePositionList.capacity() <= MaxPooledSurfacePointCapacity &&
+            s_pooledSurfacePointLists.size() < MaxPooledSurfacePointLists)
+        {
+            m_list->Clear();
+            s_pooledSurfacePointLists.emplace_back(AZStd::move(m_list));
+        }
+    }
+
     size_t SurfacePointList::GetInPositionIndexFromPosition(const AZ::Vector3& inPosition) const
     {
         // Given an input position, find the input position index that's associated with it.
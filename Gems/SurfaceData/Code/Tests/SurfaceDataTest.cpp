@@ -1042,5 +1042,36 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_ScopedSurfacePointListsAreEmptyAndIndependent)
+{
+    // This test verifies that pooled surface point lists come back empty after they've been used, and that nested scopes
+    // get separate lists.
+
+    const AZ::Vector3 inPosition(1.0f, 2.0f, 3.0f);
+    const AzFramework::SurfaceData::SurfacePoint testPoint{ inPosition, AZ::Vector3::CreateAxisZ(), {} };
+
+    SurfaceData::SurfacePointList* firstList = nullptr;
+    {
+        SurfaceData::ScopedSurfacePointList scopedPoints;
+        firstList = &(*scopedPoints);
+        scopedPoints->StartListConstruction(AZStd::span<const AzFramework::SurfaceData::SurfacePoint>(&testPoint, 1));
+        scopedPoints->EndListConstruction();
+        EXPECT_EQ(scopedPoints->GetSize(), 1);
+
+        // TEST: Verify that a nested scope gets its own list.
+        SurfaceData::ScopedSurfacePointList nestedPoints;
+        EXPECT_NE(&(*nestedPoints), firstList);
+        EXPECT_EQ(scopedPoints->GetSize(), 1);
+    }
+
+    {
+        // TEST: Verify that the list gets reused, and that it was cleared when it went back to the pool.
+        SurfaceData::ScopedSurfacePointList scopedPoints;
+        EXPECT_EQ(&(*scopedPoints), firstList);
+        EXPECT_TRUE(scopedPoints->IsEmpty());
+        EXPECT_EQ(scopedPoints->GetInputPositionSize(), 0);
+    }
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
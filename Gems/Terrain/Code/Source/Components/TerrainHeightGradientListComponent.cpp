@@ -116,6 +116,24 @@ namespace Terrain
             }
         }
 
+        // The programs reference the samplers, so all of the samplers are added before the programs are created.
+        m_gradientSamplers.clear();
+        for (auto& entityId : m_configuration.m_gradientEntities)
+        {
+            if (entityId.IsValid())
+            {
+                GradientSignal::GradientSampler& sampler = m_gradientSamplers.emplace_back();
+                sampler.m_gradientId = entityId;
+                sampler.m_ownerEntityId = GetEntityId();
+            }
+        }
+
+        m_gradientPrograms.clear();
+        for (const auto& sampler : m_gradientSamplers)
+        {
+            m_gradientPrograms.emplace_back(AZStd::make_unique<GradientSignal::GradientProgram>(sampler));
+        }
+
         Terrain::TerrainAreaHeightRequestBus::Handler::BusConnect(GetEntityId());
 
         // Cache any height data needed and notify that the area has changed.
@@ -128,6 +146,8 @@ namespace Terrain
         Terrain::TerrainAreaHeightRequestBus::Handler::BusDisconnect();
 
         m_dependencyMonitor.Reset();
+        m_gradientPrograms.clear();
+        m_gradientSamplers.clear();
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
 
@@ -182,19 +202,13 @@ namespace Terrain
             // of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the gradient
             // API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which point we
             // could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            for (const auto& gradientProgram : m_gradientPrograms)
             {
-                if (gradientId.IsValid())
-                {
-                    // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for terrain
-                    // to *not* exist at a specific point.
-                    terrainExists = true;
-
-                    float sample = 0.0f;
-                    GradientSignal::GradientRequestBus::EventResult(
-                        sample, gradientId, &GradientSignal::GradientRequestBus::Events::GetValue, params);
-                    maxSample = AZ::GetMax(maxSample, sample);
-                }
+                // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for terrain
+                // to *not* exist at a specific point.
+                terrainExists = true;
+
+                maxSample = AZ::GetMax(maxSample, gradientProgram->GetValue(params));
             }
         }
 
@@ -234,21 +248,17 @@ namespace Terrain
             // value of 0 outside their data bounds if they're using bounded data.  We should examine the possibility of extending the
             // gradient API to provide actual bounds so that it's possible to detect if the gradient even 'exists' in an area, at which
             // point we could just make this list a prioritized list from top to bottom for any points that overlap.
-            for (auto& gradientId : m_configuration.m_gradientEntities)
+            for (const auto& gradientProgram : m_gradientPrograms)
             {
-                if (gradientId.IsValid())
-                {
-                    GradientSignal::GradientRequestBus::Event(
-                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, inOutPositionList, curGradientSamples);
+                gradientProgram->GetValues(inOutPositionList, curGradientSamples);
 
-                    for (size_t index = 0; index < maxValueSamples.size(); index++)
-                    {
-                        maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
+                for (size_t index = 0; index < maxValueSamples.size(); index++)
+                {
+                    maxValueSamples[index] = AZ::GetMax(maxValueSamples[index], curGradientSamples[index]);
 
-                        // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
-                        // terrain to *not* exist at a specific point.
-                        terrainExistsList[index] = true;
-                    }
+                    // If gradients ever provide bounds, or if we add a value threshold in this component, it would be possible for
+                    // terrain to *not* exist at a specific point.
+                    terrainExistsList[index] = true;
                 }
             }
 
@@ -271,6 +281,12 @@ namespace Terrain
 
     void TerrainHeightGradientListComponent::OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion)
     {
+        // Any gradient in the graphs may have changed, so the programs compiled from them are out of date.
+        for (const auto& gradientProgram : m_gradientPrograms)
+        {
+            gradientProgram->Invalidate();
+        }
+
         // We query the shape and world bounds prior to locking the queryMutex to help reduce the chances of deadlocks between
         // threads due to the EBus call mutexes.
 
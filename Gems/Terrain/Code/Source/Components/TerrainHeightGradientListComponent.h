@@ -17,12 +17,14 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 
@@ -95,6 +97,11 @@ namespace Terrain
 
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
 
+        //! The gradients of m_gradientEntities compiled into programs, so that each query doesn't dispatch through every gradient
+        //! of the graphs. They are invalidated by the dependency monitor notifications.
+        AZStd::vector<GradientSignal::GradientSampler> m_gradientSamplers;
+        AZStd::vector<AZStd::unique_ptr<GradientSignal::GradientProgram>> m_gradientPrograms;
+
         // The TerrainAreaHeightRequestBus allows parallel dispatches, so make sure that queries don't happen at the same
         // time as cached data updates.
         AZStd::shared_mutex m_queryMutex;
@@ -10,18 +10,46 @@
 #include <TerrainSystem/TerrainSystem.h>
 
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 using namespace Terrain;
 
 namespace
 {
+    // The terrain points at the corners of the last grid square that was checked.
+    struct SquareCorners
+    {
+        AZStd::array<AZ::Vector3, 4> m_points;
+        bool m_valid = false;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Get the terrain height at a grid square corner, reusing the height from the previous square when it shares the corner.
+    static float GetCornerHeight(const TerrainSystem& terrainSystem, const AZ::Vector3& corner, const SquareCorners& previousCorners)
+    {
+        if (previousCorners.m_valid)
+        {
+            for (const AZ::Vector3& previousCorner : previousCorners.m_points)
+            {
+                if (previousCorner.GetX() == corner.GetX() && previousCorner.GetY() == corner.GetY())
+                {
+                    return previousCorner.GetZ();
+                }
+            }
+        }
+
+        return terrainSystem.GetHeight(corner, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     // Convenience function to get the terrain height values at each corner of an AABB, triangulate them,
     // and then find the nearest intersection (if any) between the resulting triangles and the given ray.
+    // Consecutive squares along the ray share an edge, so the corners are kept in squareCorners for the next call.
     static void TriangulateAndFindNearestIntersection(const TerrainSystem& terrainSystem,
                                                       const AZ::Aabb& aabb,
                                                       const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                                      SquareCorners& squareCorners,
                                                       AzFramework::RenderGeometry::RayResult& result)
     {
         // Obtain the height values at each corner of the AABB.
@@ -31,10 +59,12 @@ namespace
         AZ::Vector3 point2 = aabbMax;
         AZ::Vector3 point1(point0.GetX(), point2.GetY(), 0.0f);
         AZ::Vector3 point3(point2.GetX(), point0.GetY(), 0.0f);
-        point0.SetZ(terrainSystem.GetHeight(point0, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point1.SetZ(terrainSystem.GetHeight(point1, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
+        point0.SetZ(GetCornerHeight(terrainSystem, point0, squareCorners));
+        point1.SetZ(GetCornerHeight(terrainSystem, point1, squareCorners));
+        point2.SetZ(GetCornerHeight(terrainSystem, point2, squareCorners));
+        point3.SetZ(GetCornerHeight(terrainSystem, point3, squareCorners));
+        squareCorners.m_points = { point0, point1, point2, point3 };
+        squareCorners.m_valid = true;
 
         // Finally, triangulate the four terrain points and check for a hit,
         // splitting using the top-left -> bottom-right diagonal so to match
@@ -200,6 +230,8 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
     const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
 
+    SquareCorners squareCorners;
+
     // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
     // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
     for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
@@ -210,9 +242,8 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
             AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
 
         // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
-        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
+        // Corners shared with the previous square reuse its terrain heights, so usually only 2 new heights are queried.
+        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, squareCorners, rayIntersectionResult);
         if (rayIntersectionResult)
         {
             // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
@@ -164,6 +164,22 @@ namespace Terrain
         return boundsUpdate;
     }
 
+    uint32_t ClipmapBounds::GetUpdateTexelCount(const AZ::Vector2& newCenter) const
+    {
+        // Matches the vertical and horizontal boxes calculated in UpdateCenter(), where the corner is only counted in the vertical box.
+        Vector2i updatedCenter = GetSnappedCenter(GetClipSpaceVector(newCenter));
+
+        uint32_t updateWidth = AZStd::GetMin<uint32_t>(abs(updatedCenter.m_x - m_center.m_x), m_size);
+        uint32_t updateHeight = AZStd::GetMin<uint32_t>(abs(updatedCenter.m_y - m_center.m_y), m_size);
+
+        uint32_t texelCount = updateWidth * m_size;
+        if (updateWidth < aznumeric_cast<uint32_t>(m_size))
+        {
+            texelCount += updateHeight * (m_size - updateWidth);
+        }
+        return texelCount;
+    }
+
     auto ClipmapBounds::TransformRegion(AZ::Aabb worldSpaceRegion) -> ClipmapBoundsRegionList
     {
         AZ::Vector2 worldMin = AZ::Vector2(worldSpaceRegion.GetMin());
@@ -237,7 +253,7 @@ namespace Terrain
         return (m_halfSize - m_clipmapUpdateMultiple) * m_clipmapToWorldScale;
     }
 
-    Vector2i ClipmapBounds::GetSnappedCenter(const Vector2i& center)
+    Vector2i ClipmapBounds::GetSnappedCenter(const Vector2i& center) const
     {
         Vector2i updatedCenter = m_center;
 
@@ -118,6 +118,10 @@ namespace Terrain
         //! The biggest possible number of regions can return when calling UpdateCenter();
         static constexpr uint32_t MaxUpdateRegions = 6;
 
+        //! Returns the number of texels that calling UpdateCenter() with the world coordinate center position
+        //! would update, without updating the clipmap bounds. Used to budget the updates of several clipmaps.
+        uint32_t GetUpdateTexelCount(const AZ::Vector2& newCenter) const;
+
         //! Takes in a single world space aabb and transforms it into 0-4 regions in the clipmap clamped
         //! to the bounds of the clipmap.
         ClipmapBoundsRegionList TransformRegion(AZ::Aabb worldSpaceRegion);
@@ -156,7 +160,7 @@ namespace Terrain
         //! Returns the center point snapped to a multiple of m_clipmapUpdateMultiple. This isn't
         //! a simple rounding operation. The value returned will only be different from the current
         //! center if the value passed in is greater than m_clipmapUpdateMultiple away from the center.
-        Vector2i GetSnappedCenter(const Vector2i& center);
+        Vector2i GetSnappedCenter(const Vector2i& center) const;
 
         //! Returns the bounds covered by the clipmap in local space
         Aabb2i GetLocalBounds() const;
@@ -7,6 +7,7 @@
  */
 
 #include <TerrainRenderer/TerrainClipmapManager.h>
+#include <TerrainProfiler.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
@@ -14,6 +15,8 @@
 #include <Atom/RPI.Public/ViewportContext.h>
 #include <Atom/RPI.Public/ViewportContextBus.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/sort.h>
 
 namespace Terrain
 {
@@ -69,6 +72,16 @@ namespace Terrain
         AZ::ConsoleFunctorFlags::Null,
         "A multiplier to the final output of the clipmap texture's debug display.");
 
+    AZ_CVAR(
+        uint32_t,
+        r_terrainClipmapUpdateTexelBudget,
+        1024 * 256,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The max number of texels updated per frame in each of the macro and detail clipmap stacks when the camera moves.\n"
+        "The levels the camera moved the furthest from in relation to their size are updated first, the other levels keep their\n"
+        "current center and are updated in a later frame. The most urgent level is always updated. 0: no limit");
+
     namespace
     {
         [[maybe_unused]] static const char* TerrainClipmapManagerName = "TerrainClipmapManager";
@@ -644,11 +657,11 @@ namespace Terrain
         }
 
         // macro clipmap data:
+        UpdateClipmapBounds(m_macroClipmapBounds, currentViewPosition, m_macroClipmapUpdateRegions);
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_macroClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -658,15 +671,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_macroClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         uint32_t updateRegionCount = aznumeric_cast<uint32_t>(m_macroClipmapUpdateRegions.size());
@@ -690,11 +694,11 @@ namespace Terrain
         }
 
         // detail clipmap data:
+        UpdateClipmapBounds(m_detailClipmapBounds, currentViewPosition, m_detailClipmapUpdateRegions);
+
         for (uint32_t clipmapIndex = 0; clipmapIndex < m_detailClipmapStackSize; ++clipmapIndex)
         {
-            ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
-
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            const ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -704,15 +708,6 @@ namespace Terrain
             AZ::Vector2 centerWorld = clipmapBounds.GetCenterInWorldSpace();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[1] = centerWorld.GetY();
-
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
-            {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_detailClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
-            }
         }
 
         updateRegionCount = aznumeric_cast<uint32_t>(m_detailClipmapUpdateRegions.size());
@@ -736,6 +731,67 @@ namespace Terrain
         }
     }
 
+    void TerrainClipmapManager::UpdateClipmapBounds(
+        AZStd::vector<ClipmapBounds>& clipmapBounds,
+        const AZ::Vector2& viewPosition,
+        AZStd::vector<ClipmapUpdateRegion>& outUpdateRegions)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        struct PendingLevel
+        {
+            uint32_t m_clipmapIndex;
+            uint32_t m_texelCount;
+            //! How far the view moved from the center of the level, in relation to the distance that the level covers.
+            float m_urgency;
+        };
+
+        AZStd::fixed_vector<PendingLevel, ClipmapConfiguration::SharedClipmapStackSizeMax> pendingLevels;
+        for (uint32_t clipmapIndex = 0; clipmapIndex < clipmapBounds.size(); ++clipmapIndex)
+        {
+            const ClipmapBounds& bounds = clipmapBounds[clipmapIndex];
+            const uint32_t texelCount = bounds.GetUpdateTexelCount(viewPosition);
+            if (texelCount > 0)
+            {
+                const AZ::Vector2 offset = (viewPosition - bounds.GetCenterInWorldSpace()).GetAbs();
+                const float safeDistance = AZStd::max(bounds.GetWorldSpaceSafeDistance(), AZ::Constants::FloatEpsilon);
+                pendingLevels.push_back({ clipmapIndex, texelCount, AZStd::max(offset.GetX(), offset.GetY()) / safeDistance });
+            }
+        }
+
+        AZStd::sort(
+            pendingLevels.begin(), pendingLevels.end(),
+            [](const PendingLevel& lhs, const PendingLevel& rhs)
+            {
+                return lhs.m_urgency > rhs.m_urgency;
+            });
+
+        // All the update regions of the levels go into the same buffer, so that they're updated by a single dispatch.
+        const uint32_t texelBudget = r_terrainClipmapUpdateTexelBudget;
+        uint32_t texelsUpdated = 0;
+        for (const PendingLevel& pendingLevel : pendingLevels)
+        {
+            // The levels that don't fit in the budget keep their center, and are updated in a later frame. The data within their
+            // current bounds stays valid, and the shaders pick the level to sample from based on the center of each level.
+            const bool isFirstLevel = (texelsUpdated == 0);
+            if (texelBudget > 0 && !isFirstLevel && texelsUpdated + pendingLevel.m_texelCount > texelBudget)
+            {
+                continue;
+            }
+            texelsUpdated += pendingLevel.m_texelCount;
+
+            ClipmapBoundsRegionList updateRegionList = clipmapBounds[pendingLevel.m_clipmapIndex].UpdateCenter(viewPosition);
+            for (const ClipmapBoundsRegion& region : updateRegionList)
+            {
+                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_y),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_x),
+                                                   aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_y) };
+                outUpdateRegions.push_back(ClipmapUpdateRegion(pendingLevel.m_clipmapIndex, aabb));
+            }
+        }
+    }
+
     AZ::Data::Instance<AZ::RPI::AttachmentImage> TerrainClipmapManager::GetClipmapImage(ClipmapName clipmapName) const
     {
         AZ_Assert(clipmapName < ClipmapName::Count, "Must be a valid ClipmapName enum.");
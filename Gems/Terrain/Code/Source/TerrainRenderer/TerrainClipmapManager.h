@@ -337,6 +337,13 @@ namespace Terrain
         AZStd::vector<ClipmapUpdateRegion> m_macroClipmapUpdateRegions;
         AZStd::vector<ClipmapUpdateRegion> m_detailClipmapUpdateRegions;
 
+        //! Updates the centers of the clipmap levels the view moved away from, in order of urgency and within the update budget,
+        //! and adds the regions of the levels that need to be updated.
+        void UpdateClipmapBounds(
+            AZStd::vector<ClipmapBounds>& clipmapBounds,
+            const AZ::Vector2& viewPosition,
+            AZStd::vector<ClipmapUpdateRegion>& outUpdateRegions);
+
         //! Terrain SRG input.
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapDataIndex = ClipmapDataShaderInput;
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapImageIndex[ClipmapName::Count];
@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Terrain
+{
+    //! A cache of terrain data at the points of a query grid, so that systems querying the same area (physics, vegetation, AI,
+    //! rendering) don't evaluate the terrain providers for the same points over and over.
+    //! The grid points are stored in square tiles that are filled as points get queried. Only the most recently used tiles are
+    //! kept, and the tiles that overlap a modified region are dropped.
+    //! Positions that aren't on the query grid are never cached. All the methods are thread safe.
+    template<typename ValueType>
+    class TerrainQueryCache
+    {
+    public:
+        //! The number of grid points along each side of a tile
+        static constexpr int32_t TileSize = 16;
+
+        //! Calls foundCallback with the cached value of every position that has one, and adds the index of every other position to
+        //! outMissingIndices. Returns the generation of the cache, which needs to be passed to Store() along with the values that
+        //! get queried for the missing positions.
+        uint64_t FindCached(
+            AZStd::span<const AZ::Vector3> positions,
+            float gridResolution,
+            uint32_t maxTileCount,
+            AZStd::vector<size_t>& outMissingIndices,
+            const AZStd::function<void(size_t index, const ValueType& value)>& foundCallback);
+
+        //! Stores the value for each position that's on the query grid. getValueCallback is called with the index of the position.
+        //! Nothing is stored if the cache was invalidated since the generation was returned by FindCached(), since the values may
+        //! have been queried from the previous terrain data.
+        void Store(
+            uint64_t generation,
+            AZStd::span<const AZ::Vector3> positions,
+            float gridResolution,
+            uint32_t maxTileCount,
+            const AZStd::function<ValueType(size_t index)>& getValueCallback);
+
+        //! Drops the tiles that overlap the region in XY
+        void Invalidate(const AZ::Aabb& region);
+
+        //! Drops all the tiles
+        void Clear();
+
+    private:
+        static constexpr size_t TilePointCount = TileSize * TileSize;
+
+        struct Tile
+        {
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            AZStd::bitset<TilePointCount> m_isCached;
+            AZStd::array<ValueType, TilePointCount> m_values;
+        };
+        using TileList = AZStd::list<Tile>;
+
+        //! Returns the indices of the grid point at the position, or false if the position isn't on the query grid
+        static bool GetGridPoint(const AZ::Vector3& position, float gridResolution, int32_t& outX, int32_t& outY);
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY);
+
+        //! Clears the cache when the query grid changed and returns false if the cache is disabled. Requires m_mutex.
+        bool PrepareForGrid(float gridResolution, uint32_t maxTileCount);
+
+        void ClearInternal();
+
+        AZStd::mutex m_mutex;
+        float m_gridResolution = 0.0f;
+        //! Incremented every time the cache is invalidated
+        uint64_t m_generation = 0;
+        //! The tiles in most recently used order
+        TileList m_tiles;
+        AZStd::unordered_map<uint64_t, typename TileList::iterator> m_tilesByKey;
+    };
+
+    template<typename ValueType>
+    uint64_t TerrainQueryCache<ValueType>::FindCached(
+        AZStd::span<const AZ::Vector3> positions,
+        float gridResolution,
+        uint32_t maxTileCount,
+        AZStd::vector<size_t>& outMissingIndices,
+        const AZStd::function<void(size_t index, const ValueType& value)>& foundCallback)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (!PrepareForGrid(gridResolution, maxTileCount))
+        {
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                outMissingIndices.push_back(index);
+            }
+            return m_generation;
+        }
+
+        // Queries usually come in runs of nearby positions, so the last tile is checked before looking it up
+        auto lastTile = m_tiles.end();
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            int32_t x, y;
+            if (!GetGridPoint(positions[index], gridResolution, x, y))
+            {
+                outMissingIndices.push_back(index);
+                continue;
+            }
+
+            const int32_t tileX = x >= 0 ? x / TileSize : (x + 1) / TileSize - 1;
+            const int32_t tileY = y >= 0 ? y / TileSize : (y + 1) / TileSize - 1;
+            if (lastTile == m_tiles.end() || lastTile->m_tileX != tileX || lastTile->m_tileY != tileY)
+            {
+                auto tileIter = m_tilesByKey.find(GetTileKey(tileX, tileY));
+                if (tileIter == m_tilesByKey.end())
+                {
+                    lastTile = m_tiles.end();
+                    outMissingIndices.push_back(index);
+                    continue;
+                }
+
+                lastTile = tileIter->second;
+                m_tiles.splice(m_tiles.begin(), m_tiles, lastTile);
+            }
+
+            const size_t pointIndex = (y - tileY * TileSize) * TileSize + (x - tileX * TileSize);
+            if (lastTile->m_isCached[pointIndex])
+            {
+                foundCallback(index, lastTile->m_values[pointIndex]);
+            }
+            else
+            {
+                outMissingIndices.push_back(index);
+            }
+        }
+        return m_generation;
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Store(
+        uint64_t generation,
+        AZStd::span<const AZ::Vector3> positions,
+        float gridResolution,
+        uint32_t maxTileCount,
+        const AZStd::function<ValueType(size_t index)>& getValueCallback)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+
+        if (generation != m_generation || !PrepareForGrid(gridResolution, maxTileCount))
+        {
+            return;
+        }
+
+        auto lastTile = m_tiles.end();
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            int32_t x, y;
+            if (!GetGridPoint(positions[index], gridResolution, x, y))
+            {
+                continue;
+            }
+
+            const int32_t tileX = x >= 0 ? x / TileSize : (x + 1) / TileSize - 1;
+            const int32_t tileY = y >= 0 ? y / TileSize : (y + 1) / TileSize - 1;
+            if (lastTile == m_tiles.end() || lastTile->m_tileX != tileX || lastTile->m_tileY != tileY)
+            {
+                const uint64_t tileKey = GetTileKey(tileX, tileY);
+                auto tileIter = m_tilesByKey.find(tileKey);
+                if (tileIter != m_tilesByKey.end())
+                {
+                    lastTile = tileIter->second;
+                    m_tiles.splice(m_tiles.begin(), m_tiles, lastTile);
+                }
+                else
+                {
+                    // Reuse the least recently used tile once the cache is full
+                    if (m_tilesByKey.size() >= maxTileCount)
+                    {
+                        auto leastRecentTile = AZStd::prev(m_tiles.end());
+                        m_tilesByKey.erase(GetTileKey(leastRecentTile->m_tileX, leastRecentTile->m_tileY));
+                        m_tiles.splice(m_tiles.begin(), m_tiles, leastRecentTile);
+                        m_tiles.front().m_isCached.reset();
+                    }
+                    else
+                    {
+                        m_tiles.emplace_front();
+                    }
+
+                    lastTile = m_tiles.begin();
+                    lastTile->m_tileX = tileX;
+                    lastTile->m_tileY = tileY;
+                    m_tilesByKey.emplace(tileKey, lastTile);
+                }
+            }
+
+            const size_t pointIndex = (y - tileY * TileSize) * TileSize + (x - tileX * TileSize);
+            lastTile->m_values[pointIndex] = getValueCallback(index);
+            lastTile->m_isCached.set(pointIndex);
+        }
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Invalidate(const AZ::Aabb& region)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+
+        // Values that are being queried while the region is invalidated can't be stored anymore, even if they aren't in a tile yet
+        ++m_generation;
+
+        // The number of tiles is bounded, so it's cheaper to check all of them than to enumerate the tiles in a large region
+        const float tileExtent = m_gridResolution * TileSize;
+        for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end();)
+        {
+            // The tile covers its grid points, and the area up to the first points of the next tiles that bilinear queries read
+            const float tileMinX = tileIter->m_tileX * tileExtent;
+            const float tileMinY = tileIter->m_tileY * tileExtent;
+            if (region.GetMax().GetX() >= tileMinX && region.GetMin().GetX() <= tileMinX + tileExtent &&
+                region.GetMax().GetY() >= tileMinY && region.GetMin().GetY() <= tileMinY + tileExtent)
+            {
+                m_tilesByKey.erase(GetTileKey(tileIter->m_tileX, tileIter->m_tileY));
+                tileIter = m_tiles.erase(tileIter);
+            }
+            else
+            {
+                ++tileIter;
+            }
+        }
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::Clear()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        ClearInternal();
+    }
+
+    template<typename ValueType>
+    bool TerrainQueryCache<ValueType>::GetGridPoint(const AZ::Vector3& position, float gridResolution, int32_t& outX, int32_t& outY)
+    {
+        const float normalizedX = position.GetX() / gridResolution;
+        const float normalizedY = position.GetY() / gridResolution;
+
+        // Stay well within the range of the tile keys
+        constexpr float MaxGridIndex = 1 << 30;
+        if (AZStd::abs(normalizedX) > MaxGridIndex || AZStd::abs(normalizedY) > MaxGridIndex)
+        {
+            return false;
+        }
+
+        outX = aznumeric_cast<int32_t>(AZStd::floor(normalizedX + 0.5f));
+        outY = aznumeric_cast<int32_t>(AZStd::floor(normalizedY + 0.5f));
+
+        // The query positions are computed from the grid in a few different ways, so allow for the rounding of those computations
+        constexpr float Tolerance = 1.0e-4f;
+        return AZStd::abs(normalizedX - outX) <= Tolerance && AZStd::abs(normalizedY - outY) <= Tolerance;
+    }
+
+    template<typename ValueType>
+    uint64_t TerrainQueryCache<ValueType>::GetTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+    }
+
+    template<typename ValueType>
+    bool TerrainQueryCache<ValueType>::PrepareForGrid(float gridResolution, uint32_t maxTileCount)
+    {
+        if (gridResolution != m_gridResolution)
+        {
+            ClearInternal();
+            m_gridResolution = gridResolution;
+        }
+
+        // Shrink the cache right away when the limit is lowered
+        while (m_tilesByKey.size() > maxTileCount)
+        {
+            m_tilesByKey.erase(GetTileKey(m_tiles.back().m_tileX, m_tiles.back().m_tileY));
+            m_tiles.pop_back();
+        }
+
+        return maxTileCount > 0 && gridResolution > 0.0f;
+    }
+
+    template<typename ValueType>
+    void TerrainQueryCache<ValueType>::ClearInternal()
+    {
+        m_tiles.clear();
+        m_tilesByKey.clear();
+        ++m_generation;
+    }
+} // namespace Terrain
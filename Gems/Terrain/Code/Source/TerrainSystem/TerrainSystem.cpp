@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +27,15 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+AZ_CVAR(
+    uint32_t,
+    terrain_queryCacheMaxTiles,
+    256,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The number of tiles of query grid points the terrain system keeps the height and surface weight query results of, for each of "
+    "them. Each tile holds 16x16 grid points. 0 disables the cache.");
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +99,8 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_heightCache.Clear();
+    m_surfaceWeightCache.Clear();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +151,8 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_heightCache.Clear();
+    m_surfaceWeightCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -295,6 +310,21 @@ AZ::Aabb TerrainSystem::ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const
     return AZ::Aabb::CreateFromMinMax(min, max);
 }
 
+void TerrainSystem::InvalidateQueryCaches(
+    const AZ::Aabb& region, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
+{
+    using ChangedMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask;
+
+    if ((changeMask & ChangedMask::HeightData) == ChangedMask::HeightData)
+    {
+        m_heightCache.Invalidate(region);
+    }
+    if ((changeMask & ChangedMask::SurfaceData) == ChangedMask::SurfaceData)
+    {
+        m_surfaceWeightCache.Invalidate(region);
+    }
+}
+
 // Generate positions to be queried based on the sampler type.
 void TerrainSystem::GenerateQueryPositions(const AZStd::span<const AZ::Vector3>& inPositions,
     AZStd::vector<AZ::Vector3>& outPositions, float queryResolution,
@@ -479,9 +509,89 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
                             }
                         };
 
+    // Only the positions that aren't cached need to be queried from the terrain areas.
+    const uint32_t maxCacheTiles = terrain_queryCacheMaxTiles;
+    AZStd::vector<size_t> uncachedIndices;
+    const uint64_t cacheGeneration = m_heightCache.FindCached(
+        outPositions, queryResolution, maxCacheTiles, uncachedIndices,
+        [&outPositions, &outTerrainExists](size_t index, const CachedHeight& cachedHeight)
+        {
+            outPositions[index].SetZ(cachedHeight.m_height);
+            outTerrainExists[index] = cachedHeight.m_terrainExists;
+        });
+
+    // The bilinear and clamp samplers only query grid points, and neighboring input positions share most of them. A dense region
+    // query with the bilinear sampler would query every grid point four times, so each grid point is only queried once.
+    AZStd::vector<size_t> duplicateIndices;
+    AZStd::vector<size_t> duplicateSources;
+    if (sampler != AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT && queryResolution > 0.0f)
+    {
+        AZStd::unordered_map<uint64_t, size_t> uniqueGridPoints;
+        uniqueGridPoints.reserve(uncachedIndices.size());
+
+        size_t uniqueCount = 0;
+        for (size_t index : uncachedIndices)
+        {
+            const int32_t gridX = aznumeric_cast<int32_t>(AZStd::floor(outPositions[index].GetX() / queryResolution + 0.5f));
+            const int32_t gridY = aznumeric_cast<int32_t>(AZStd::floor(outPositions[index].GetY() / queryResolution + 0.5f));
+            const uint64_t gridKey = (static_cast<uint64_t>(static_cast<uint32_t>(gridX)) << 32) | static_cast<uint32_t>(gridY);
+
+            auto [gridPoint, inserted] = uniqueGridPoints.emplace(gridKey, index);
+            if (inserted)
+            {
+                uncachedIndices[uniqueCount++] = index;
+            }
+            else
+            {
+                duplicateIndices.push_back(index);
+                duplicateSources.push_back(gridPoint->second);
+            }
+        }
+        uncachedIndices.resize(uniqueCount);
+    }
+
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    if (uncachedIndices.size() == outPositions.size())
+    {
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+        m_heightCache.Store(
+            cacheGeneration, outPositions, queryResolution, maxCacheTiles,
+            [&outPositions, &outTerrainExists](size_t index)
+            {
+                return CachedHeight{ outPositions[index].GetZ(), outTerrainExists[index] };
+            });
+    }
+    else if (!uncachedIndices.empty())
+    {
+        AZStd::vector<AZ::Vector3> uncachedPositions;
+        uncachedPositions.reserve(uncachedIndices.size());
+        for (size_t index : uncachedIndices)
+        {
+            uncachedPositions.emplace_back(outPositions[index]);
+        }
+        AZStd::vector<bool> uncachedTerrainExists(uncachedIndices.size());
+
+        MakeBulkQueries(uncachedPositions, uncachedPositions, uncachedTerrainExists, outSurfaceWeights, callback);
+        m_heightCache.Store(
+            cacheGeneration, uncachedPositions, queryResolution, maxCacheTiles,
+            [&uncachedPositions, &uncachedTerrainExists](size_t index)
+            {
+                return CachedHeight{ uncachedPositions[index].GetZ(), uncachedTerrainExists[index] };
+            });
+
+        for (size_t i = 0; i < uncachedIndices.size(); i++)
+        {
+            outPositions[uncachedIndices[i]] = uncachedPositions[i];
+            outTerrainExists[uncachedIndices[i]] = uncachedTerrainExists[i];
+        }
+    }
+
+    for (size_t i = 0; i < duplicateIndices.size(); i++)
+    {
+        outPositions[duplicateIndices[i]].SetZ(outPositions[duplicateSources[i]].GetZ());
+        outTerrainExists[duplicateIndices[i]] = outTerrainExists[duplicateSources[i]];
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -1303,9 +1413,52 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                             }
                         };
     
+    // Only the positions that aren't cached need to be queried from the terrain areas.
+    const uint32_t maxCacheTiles = terrain_queryCacheMaxTiles;
+    AZStd::vector<size_t> uncachedIndices;
+    const uint64_t cacheGeneration = m_surfaceWeightCache.FindCached(
+        queryPositions, queryResolution, maxCacheTiles, uncachedIndices,
+        [&outSurfaceWeightsList](size_t index, const AzFramework::SurfaceData::SurfaceTagWeightList& cachedSurfaceWeights)
+        {
+            outSurfaceWeightsList[index] = cachedSurfaceWeights;
+        });
+
     // This will be unused for surface weights. It's fine if it's empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    if (uncachedIndices.size() == queryPositions.size())
+    {
+        MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        m_surfaceWeightCache.Store(
+            cacheGeneration, queryPositions, queryResolution, maxCacheTiles,
+            [&outSurfaceWeightsList](size_t index)
+            {
+                return outSurfaceWeightsList[index];
+            });
+    }
+    else if (!uncachedIndices.empty())
+    {
+        AZStd::vector<AZ::Vector3> uncachedPositions;
+        uncachedPositions.reserve(uncachedIndices.size());
+        for (size_t index : uncachedIndices)
+        {
+            uncachedPositions.emplace_back(queryPositions[index]);
+        }
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> uncachedSurfaceWeights(uncachedIndices.size());
+
+        // The terrain exists flags are unused for surface weights as well.
+        MakeBulkQueries(uncachedPositions, outPositions, {}, uncachedSurfaceWeights, callback);
+        m_surfaceWeightCache.Store(
+            cacheGeneration, uncachedPositions, queryResolution, maxCacheTiles,
+            [&uncachedSurfaceWeights](size_t index)
+            {
+                return uncachedSurfaceWeights[index];
+            });
+
+        for (size_t i = 0; i < uncachedIndices.size(); i++)
+        {
+            outSurfaceWeightsList[uncachedIndices[i]] = AZStd::move(uncachedSurfaceWeights[i]);
+        }
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1686,6 +1839,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    InvalidateQueryCaches(aabb, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1860,8 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                InvalidateQueryCaches(
+                    areaData.m_areaBounds, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1736,6 +1892,12 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
 
     RefreshRegion(expandedAabb, changeMask);
 
+    // The positions that moved to or from another area need to be queried again, whatever data the area changed
+    if (oldAabb != newAabb)
+    {
+        InvalidateQueryCaches(expandedAabb, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All);
+    }
+
     // Check to see which axis the aabbs changed in
     bool xDiff = oldAabb.GetMin().GetX() != newAabb.GetMin().GetX() || oldAabb.GetMax().GetX() != newAabb.GetMax().GetX();
     bool yDiff = oldAabb.GetMin().GetY() != newAabb.GetMin().GetY() || oldAabb.GetMax().GetY() != newAabb.GetMax().GetY();
@@ -1760,6 +1922,7 @@ void TerrainSystem::RefreshRegion(
     const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
 {
     m_dirtyRegion.AddAabb(dirtyRegion);
+    InvalidateQueryCaches(dirtyRegion, changeMask);
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
@@ -1789,6 +1952,9 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
                 AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
             m_currentSettings.m_heightRange = m_requestedSettings.m_heightRange;
 
+            // The cached heights are filled with and clamped to the height range
+            m_heightCache.Clear();
+
             // Add the cached area bounds clamped to the new range, so both the old and new range are included.
             m_dirtyRegion.AddAabb(ClampZBoundsToHeightBounds(m_cachedAreaBounds));
         }
@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainQueryCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -286,6 +287,10 @@ namespace Terrain
         void RecalculateCachedBounds();
         AZ::Aabb ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const;
 
+        //! Drops the cached query results in the region for the types of data in the mask.
+        void InvalidateQueryCaches(
+            const AZ::Aabb& region, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask);
+
         struct TerrainSystemSettings
         {
             AzFramework::Terrain::FloatRange m_heightRange;
@@ -314,6 +319,16 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        struct CachedHeight
+        {
+            float m_height = 0.0f;
+            bool m_terrainExists = false;
+        };
+
+        // The results of the bulk queries at the points of the height and surface data query grids.
+        mutable TerrainQueryCache<CachedHeight> m_heightCache;
+        mutable TerrainQueryCache<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeightCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
@@ -334,6 +334,39 @@ namespace UnitTest
 
     }
 
+    TEST_F(ClipmapBoundsTests, UpdateTexelCountMatchesUpdateRegions)
+    {
+        // The texel count of an update should match the total size of the regions that the update produces, and getting it
+        // shouldn't move the clipmap.
+        for (int32_t i = -5; i <= 5; ++i)
+        {
+            for (int32_t j = -5; j <= 5; ++j)
+            {
+                Terrain::ClipmapBoundsDescriptor desc;
+                desc.m_worldSpaceCenter = AZ::Vector2(0.0f, 0.0f);
+                desc.m_clipmapUpdateMultiple = 4;
+                desc.m_clipmapToWorldScale = 1.0f;
+                desc.m_size = 1024;
+                Terrain::ClipmapBounds bounds(desc);
+
+                const AZ::Vector2 newCenter(100.0f * i + 3.0f, 300.0f * j - 7.0f);
+                const uint32_t texelCount = bounds.GetUpdateTexelCount(newCenter);
+                EXPECT_EQ(bounds.GetCenterInClipmapSpace(), Terrain::Vector2i(0, 0));
+
+                uint32_t regionTexelCount = 0;
+                for (const auto& region : bounds.UpdateCenter(newCenter))
+                {
+                    const Terrain::Vector2i regionSize = region.m_localAabb.m_max - region.m_localAabb.m_min;
+                    regionTexelCount += aznumeric_cast<uint32_t>(regionSize.m_x * regionSize.m_y);
+                }
+                EXPECT_EQ(texelCount, regionTexelCount);
+
+                // Once the clipmap is centered at the position, there's nothing left to update.
+                EXPECT_EQ(bounds.GetUpdateTexelCount(newCenter), 0);
+            }
+        }
+    }
+
     // This test is to ensure clipmap update compute shader receives 6 regions at most.
     TEST_F(ClipmapBoundsTests, MaxUpdateRegionTest)
     {
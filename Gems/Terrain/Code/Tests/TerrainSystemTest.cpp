@@ -1480,6 +1480,95 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainQueryResultsAreCachedUntilTheRegionIsRefreshed)
+    {
+        // Verify that bulk queries reuse the heights of the query grid points that were already queried,
+        // until the region that contains them gets refreshed.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        float mockHeight = 1.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&mockHeight](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(mockHeight);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        const AZStd::vector<AZ::Vector3> inPositions = { AZ::Vector3(2.0f, 3.0f, 0.0f), AZ::Vector3(-4.0f, 5.0f, 0.0f) };
+        auto testHeights = [&terrainSystem, &inPositions](float expectedHeight0, float expectedHeight1)
+        {
+            size_t positionIndex = 0;
+            terrainSystem->QueryList(
+                inPositions, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                [&positionIndex, expectedHeight0, expectedHeight1](
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    constexpr float epsilon = 0.0001f;
+                    EXPECT_NEAR(surfacePoint.m_position.GetZ(), (positionIndex == 0) ? expectedHeight0 : expectedHeight1, epsilon);
+                    positionIndex++;
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+            EXPECT_EQ(positionIndex, inPositions.size());
+        };
+
+        testHeights(1.0f, 1.0f);
+
+        // The height data changes without the region getting refreshed, so the cached heights are still returned.
+        mockHeight = 2.0f;
+        testHeights(1.0f, 1.0f);
+
+        // Refreshing a region only drops the cached heights around that region.
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(1.0f, 2.0f, -5.0f, 3.0f, 4.0f, 15.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        testHeights(2.0f, 1.0f);
+
+        // Surface data changes don't drop the cached heights.
+        terrainSystem->RefreshRegion(
+            spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
+        testHeights(2.0f, 1.0f);
+    }
+
+    TEST_F(TerrainSystemTest, TerrainBilinearRegionQueriesQueryEachGridPointOnce)
+    {
+        // Verify that the grid points shared by neighboring positions of a bilinear query are only queried once.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        size_t queriedPositionCount = 0;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&queriedPositionCount](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY());
+                terrainExists = true;
+                queriedPositionCount++;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem(1.0f);
+
+        // Each position is halfway between the grid points, so each of them interpolates between four grid points, which
+        // are shared with the neighboring positions.
+        constexpr size_t NumPoints = 4;
+        const AzFramework::Terrain::TerrainQueryRegion queryRegion(
+            AZ::Vector3(0.5f, 0.5f, 0.0f), NumPoints, NumPoints, AZ::Vector2(1.0f));
+
+        // Nothing is cached yet, so every grid point gets queried from the terrain area.
+        queriedPositionCount = 0;
+        terrainSystem->QueryRegion(
+            queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+            [](size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                EXPECT_TRUE(terrainExists);
+                EXPECT_NEAR(surfacePoint.m_position.GetZ(), (xIndex + 0.5f) + (yIndex + 0.5f), 0.0001f);
+            },
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        EXPECT_EQ(queriedPositionCount, (NumPoints + 1) * (NumPoints + 1));
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
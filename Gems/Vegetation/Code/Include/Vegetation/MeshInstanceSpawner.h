@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Vegetation/InstanceSpawner.h>
+#include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_set.h>
+
+namespace Vegetation
+{
+    /**
+    * Instance spawner that renders a model directly through the mesh feature processor.
+    * Unlike the PrefabInstanceSpawner, no entities or components get created for the instances, so each instance only costs
+    * a mesh handle. Instances of the same model share their draw packets through the mesh instancing of the feature processor.
+    */
+    class MeshInstanceSpawner
+        : public InstanceSpawner
+        , private AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        AZ_RTTI(MeshInstanceSpawner, "{5B3C9C67-0F7C-4D0B-9E0A-2E7B3F1C8D41}", InstanceSpawner);
+        AZ_CLASS_ALLOCATOR(MeshInstanceSpawner, AZ::SystemAllocator);
+        static void Reflect(AZ::ReflectContext* context);
+
+        MeshInstanceSpawner();
+        virtual ~MeshInstanceSpawner();
+
+        //! Start loading any assets that the spawner will need.
+        void LoadAssets() override;
+
+        //! Unload any assets that the spawner loaded.
+        void UnloadAssets() override;
+
+        //! Perform any extra initialization needed at the point of registering with the vegetation system.
+        void OnRegisterUniqueDescriptor() override;
+
+        //! Perform any extra cleanup needed at the point of unregistering with the vegetation system.
+        void OnReleaseUniqueDescriptor() override;
+
+        //! Does this exist but have empty asset references?
+        bool HasEmptyAssetReferences() const override;
+
+        //! Has this finished loading any assets that are needed?
+        bool IsLoaded() const override;
+
+        //! Are the assets loaded, initialized, and spawnable?
+        bool IsSpawnable() const override;
+
+        //! Does this spawner have the capability to provide radius data?
+        bool HasRadiusData() const override { return true; }
+
+        //! Radius of the instances that will be spawned, used by the Distance Between filter.
+        float GetRadius() const override;
+
+        //! Display name of the instances that will be spawned.
+        AZStd::string GetName() const override;
+
+        //! Create a single instance.
+        InstancePtr CreateInstance(const InstanceData& instanceData) override;
+
+        //! Destroy a single instance.
+        void DestroyInstance(InstanceId id, InstancePtr instance) override;
+
+        AZStd::string GetModelAssetPath() const;
+        void SetModelAssetPath(const AZStd::string& assetPath);
+
+        AZ::Data::AssetId GetModelAssetId() const;
+        void SetModelAssetId(const AZ::Data::AssetId& assetId);
+
+    private:
+        //! The opaque instance data handed to the vegetation system
+        struct MeshInstance
+        {
+            AZ_CLASS_ALLOCATOR(MeshInstance, AZ::SystemAllocator);
+
+            AZ::Render::MeshFeatureProcessorInterface* m_meshFeatureProcessor = nullptr;
+            AZ::Render::MeshFeatureProcessorInterface::MeshHandle m_meshHandle;
+        };
+
+        bool DataIsEquivalent(const InstanceSpawner& rhs) const override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::Data::AssetBus::Handler
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        AZ::u32 ModelAssetChanged();
+        void ResetModelAsset();
+
+        void UpdateCachedValues();
+
+        //! Releases the mesh of an instance
+        static void ReleaseMesh(MeshInstance& instance);
+
+        //! Cached values so that asset isn't accessed on other threads
+        bool m_assetLoadedAndSpawnable = false;
+        float m_radius = 0.0f;
+
+        //! Collection of spawned instances, needed for releasing their meshes when the assets get unloaded.
+        AZStd::unordered_set<MeshInstance*> m_instances;
+
+        //! asset data
+        AZ::Data::Asset<AZ::RPI::ModelAsset> m_modelAsset;
+    };
+
+} // namespace Vegetation
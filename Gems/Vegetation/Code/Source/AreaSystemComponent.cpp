@@ -1102,7 +1102,8 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointList availablePointsPerPosition;
+        SurfaceData::ScopedSurfacePointList scopedPoints;
+        SurfaceData::SurfacePointList& availablePointsPerPosition = *scopedPoints;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1187,18 +1188,23 @@ namespace Vegetation
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
-        AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        auto itSector = m_sectorRollingWindow.find(sectorId);
-        if (itSector != m_sectorRollingWindow.end())
+        SectorInfo sectorInfo;
         {
-            SectorInfo& sectorInfo(itSector->second);
-            EmptySector(sectorInfo);
+            AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+            auto itSector = m_sectorRollingWindow.find(sectorId);
+            if (itSector == m_sectorRollingWindow.end())
+            {
+                AZ_Assert(false, "Sector marked for deletion but doesn't exist");
+                return;
+            }
+
+            sectorInfo = AZStd::move(itSector->second);
             m_sectorRollingWindow.erase(itSector);
         }
-        else
-        {
-            AZ_Assert(false, "Sector marked for deletion but doesn't exist");
-        }
+
+        // The claims are released once the sector is out of the rolling window, so enumerating the instances isn't blocked
+        // while the areas destroy them.
+        EmptySector(sectorInfo);
     }
 
     template<class Fn>
@@ -1251,6 +1257,7 @@ namespace Vegetation
             auto unregisteredAreasForSector = m_unregisteredVegetationAreaSet.find(sectorInfo.m_id);
             if (unregisteredAreasForSector != m_unregisteredVegetationAreaSet.end())
             {
+                AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
                 for (auto claimItr = sectorInfo.m_claimedWorldPoints.begin(); claimItr != sectorInfo.m_claimedWorldPoints.end(); )
                 {
                     if (unregisteredAreasForSector->second.find(claimItr->second.m_id) != unregisteredAreasForSector->second.end())
@@ -1313,9 +1320,10 @@ namespace Vegetation
         //m_availablePoints is a free list initialized with the complete set of points in the sector.
         ClaimContext activeContext = sectorInfo.m_baseContext;
 
-        // Clear out the list of claimed world points before we begin
+        // The new claims are collected separately, so the instances of the previous fill can still be enumerated while the areas
+        // claim points. The vegetation thread is the only one that modifies the sectors, so they can be read here without the lock.
         sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        sectorInfo.m_claimedWorldPointsDuringFill.clear();
 
         //for all active areas attempt to spawn vegetation on sector grid positions
         for (const auto& area : activeAreas)
@@ -1340,6 +1348,12 @@ namespace Vegetation
             }
         }
 
+        {
+            AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+            sectorInfo.m_claimedWorldPoints.swap(sectorInfo.m_claimedWorldPointsDuringFill);
+        }
+        sectorInfo.m_claimedWorldPointsDuringFill.clear();
+
         ReleaseUnusedClaims(sectorInfo);
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
@@ -1395,7 +1409,7 @@ namespace Vegetation
     void AreaSystemComponent::VegetationThreadTasks::CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
-        sectorInfo.m_claimedWorldPoints[handle] = instanceData;
+        sectorInfo.m_claimedWorldPointsDuringFill[handle] = instanceData;
     }
 
     ClaimHandle AreaSystemComponent::VegetationThreadTasks::CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const
@@ -1763,12 +1777,20 @@ namespace Vegetation
         // 2) Create/update if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
+        // The rolling window mutex is only held while the sectors are added, removed or get their new claims. The main thread
+        // enumerates the instances under the same mutex, so it would otherwise stall for as long as a sector takes to fill.
+
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
         if (!m_deleteWorkList.empty())
         {
-            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            bool deleteSector = m_updateWorkList.empty();
+            if (!deleteSector)
+            {
+                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+                deleteSector = vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount;
+            }
 
-            if ((vegTasks->m_sectorRollingWindow.size() > m_viewRectSectorCount) || m_updateWorkList.empty())
+            if (deleteSector)
             {
                 vegTasks->DeleteSector(m_deleteWorkList.back());
                 m_deleteWorkList.pop_back();
@@ -1785,8 +1807,6 @@ namespace Vegetation
             m_updateWorkList.pop_back();
 
             {
-                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
-
                 auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
                 auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
                 auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
@@ -175,6 +175,8 @@ namespace Vegetation
             ClaimContainer m_claimedWorldPoints;
             //! Keeps track of previous state of sector while filling to avoid redundant instance destroy/create calls
             ClaimContainer m_claimedWorldPointsBeforeFill;
+            //! The points claimed by the fill in progress, which replace m_claimedWorldPoints once the fill is done
+            ClaimContainer m_claimedWorldPointsDuringFill;
             ClaimContext m_baseContext;
 
             int GetSectorX() const { return m_id.first; }
@@ -154,17 +154,22 @@ namespace Vegetation
         if (m_configuration.m_gradientSampler.m_gradientId.IsValid())
         {
             m_dependencyMonitor.ConnectDependencies({ m_configuration.m_gradientSampler.m_gradientId });
+            m_gradientProgram = AZStd::make_unique<GradientSignal::GradientProgram>(m_configuration.m_gradientSampler);
             FilterRequestBus::Handler::BusConnect(GetEntityId());
         }
 
+        // The dependency monitor notifies the owner whenever any gradient of the graph changes, which invalidates the program
+        LmbrCentral::DependencyNotificationBus::Handler::BusConnect(GetEntityId());
         DistributionFilterRequestBus::Handler::BusConnect(GetEntityId());
     }
 
     void DistributionFilterComponent::Deactivate()
     {
         m_dependencyMonitor.Reset();
+        LmbrCentral::DependencyNotificationBus::Handler::BusDisconnect();
         FilterRequestBus::Handler::BusDisconnect();
         DistributionFilterRequestBus::Handler::BusDisconnect();
+        m_gradientProgram.reset();
     }
 
     bool DistributionFilterComponent::ReadInConfig(const AZ::ComponentConfig* baseConfig)
@@ -192,7 +197,7 @@ namespace Vegetation
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         const GradientSignal::GradientSampleParams sampleParams(instanceData.m_position);
-        const float noise = m_configuration.m_gradientSampler.GetValue(sampleParams);
+        const float noise = m_gradientProgram->GetValue(sampleParams);
         const bool result = (noise >= m_configuration.m_thresholdMin) && (noise <= m_configuration.m_thresholdMax);
         if (!result)
         {
@@ -236,6 +241,19 @@ namespace Vegetation
 
     GradientSignal::GradientSampler& DistributionFilterComponent::GetGradientSampler()
     {
+        // The caller may modify the sampler, so compile the program from it again on the next query
+        if (m_gradientProgram)
+        {
+            m_gradientProgram->Invalidate();
+        }
         return m_configuration.m_gradientSampler;
     }
+
+    void DistributionFilterComponent::OnCompositionChanged()
+    {
+        if (m_gradientProgram)
+        {
+            m_gradientProgram->Invalidate();
+        }
+    }
 }
@@ -11,8 +11,11 @@
 #include <AzCore/Component/Component.h>
 #include <Vegetation/Ebuses/FilterRequestBus.h>
 #include <Vegetation/Ebuses/DistributionFilterRequestBus.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/GradientSampler.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 
 namespace LmbrCentral
 {
@@ -49,6 +52,7 @@ namespace Vegetation
         : public AZ::Component
         , public FilterRequestBus::Handler
         , private DistributionFilterRequestBus::Handler
+        , private LmbrCentral::DependencyNotificationBus::Handler
     {
     public:
         template<typename, typename> friend class LmbrCentral::EditorWrappedComponentBase;
@@ -84,9 +88,15 @@ namespace Vegetation
         void SetThresholdMax(float thresholdMax) override;
         GradientSignal::GradientSampler& GetGradientSampler() override;
 
+        //////////////////////////////////////////////////////////////////////////
+        // LmbrCentral::DependencyNotificationBus
+        void OnCompositionChanged() override;
 
     private:
         DistributionFilterConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
+
+        //! The gradient of the sampler compiled into a program, so each instance doesn't dispatch through every gradient of the graph
+        AZStd::unique_ptr<GradientSignal::GradientProgram> m_gradientProgram;
     };
 }
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Vegetation/MeshInstanceSpawner.h>
+
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <Vegetation/InstanceData.h>
+#include <Vegetation/Ebuses/DescriptorNotificationBus.h>
+
+namespace Vegetation
+{
+    namespace
+    {
+        AZ::Render::MeshFeatureProcessorInterface* GetMeshFeatureProcessor()
+        {
+            // Vegetation instances don't belong to an entity, so they go to the scene of the default viewport, which is the main
+            // scene in the game and the editor scene in the editor.
+            if (auto viewportContextRequests = AZ::RPI::ViewportContextRequests::Get(); viewportContextRequests)
+            {
+                if (AZ::RPI::ViewportContextPtr viewportContext = viewportContextRequests->GetDefaultViewportContext(); viewportContext)
+                {
+                    if (AZ::RPI::ScenePtr scene = viewportContext->GetRenderScene(); scene)
+                    {
+                        return scene->GetFeatureProcessor<AZ::Render::MeshFeatureProcessorInterface>();
+                    }
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    MeshInstanceSpawner::MeshInstanceSpawner()
+    {
+        UnloadAssets();
+    }
+
+    MeshInstanceSpawner::~MeshInstanceSpawner()
+    {
+        UnloadAssets();
+        AZ_Assert(m_instances.empty(), "Destroying spawner while %zu mesh instances still exist!", m_instances.size());
+    }
+
+    void MeshInstanceSpawner::Reflect(AZ::ReflectContext* context)
+    {
+        AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serialize)
+        {
+            serialize->Class<MeshInstanceSpawner, InstanceSpawner>()
+                ->Version(0)->Field(
+                "ModelAsset", &MeshInstanceSpawner::m_modelAsset)
+                ;
+
+            AZ::EditContext* edit = serialize->GetEditContext();
+            if (edit)
+            {
+                edit->Class<MeshInstanceSpawner>(
+                    "Mesh", "Mesh Instance")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly)
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &MeshInstanceSpawner::m_modelAsset, "Mesh Asset", "Mesh asset")
+                    ->Attribute(AZ::Edit::Attributes::ShowProductAssetFileName, false)
+                    ->Attribute(AZ::Edit::Attributes::AssetPickerTitle, "a Mesh")
+                    ->Attribute(AZ::Edit::Attributes::ChangeNotify, &MeshInstanceSpawner::ModelAssetChanged)
+                    ;
+            }
+        }
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            behaviorContext->Class<MeshInstanceSpawner>()
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Category, "Vegetation")
+                ->Attribute(AZ::Script::Attributes::Module, "vegetation")
+                ->Constructor()
+                ->Method("GetModelAssetPath", &MeshInstanceSpawner::GetModelAssetPath)
+                ->Method("SetModelAssetPath", &MeshInstanceSpawner::SetModelAssetPath)
+                ->Method("GetModelAssetId", &MeshInstanceSpawner::GetModelAssetId)
+                ->Method("SetModelAssetId", &MeshInstanceSpawner::SetModelAssetId);
+        }
+    }
+
+    bool MeshInstanceSpawner::DataIsEquivalent(const InstanceSpawner& baseRhs) const
+    {
+        if (const auto* rhs = azrtti_cast<const MeshInstanceSpawner*>(&baseRhs))
+        {
+            return m_modelAsset == rhs->m_modelAsset;
+        }
+
+        // Not the same subtypes, so definitely not a data match.
+        return false;
+    }
+
+    void MeshInstanceSpawner::LoadAssets()
+    {
+        UnloadAssets();
+
+        // Load the model before marking the spawner as ready, so that the first instances don't wait on the asset, and so the
+        // model isn't unloaded every time all of its instances are destroyed.
+        m_modelAsset.QueueLoad();
+        AZ::Data::AssetBus::MultiHandler::BusConnect(m_modelAsset.GetId());
+    }
+
+    void MeshInstanceSpawner::UnloadAssets()
+    {
+        // As with the PrefabInstanceSpawner, the assets can get unloaded before the vegetation system destroys all the instances.
+        // If so, release the meshes here but keep tracking the instances, which get deleted once the vegetation system requests
+        // the instance destroy.
+        for (MeshInstance* instance : m_instances)
+        {
+            ReleaseMesh(*instance);
+        }
+        ResetModelAsset();
+        NotifyOnAssetsUnloaded();
+    }
+
+    void MeshInstanceSpawner::ResetModelAsset()
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+        m_modelAsset.Release();
+        UpdateCachedValues();
+        m_modelAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::QueueLoad);
+    }
+
+    void MeshInstanceSpawner::UpdateCachedValues()
+    {
+        // Once our assets are loaded and at the point that they're getting registered,
+        // cache off the spawnable state and the radius for use from multiple threads.
+
+        m_assetLoadedAndSpawnable = m_modelAsset.IsReady();
+        m_radius = 0.0f;
+        if (m_assetLoadedAndSpawnable && m_modelAsset->GetAabb().IsValid())
+        {
+            AZ::Vector3 center;
+            m_modelAsset->GetAabb().GetAsSphere(center, m_radius);
+        }
+    }
+
+    void MeshInstanceSpawner::OnRegisterUniqueDescriptor()
+    {
+        UpdateCachedValues();
+    }
+
+    void MeshInstanceSpawner::OnReleaseUniqueDescriptor()
+    {
+    }
+
+    bool MeshInstanceSpawner::HasEmptyAssetReferences() const
+    {
+        // If we don't have a valid Model Asset, then that means we're expecting to spawn empty instances.
+        return !m_modelAsset.GetId().IsValid();
+    }
+
+    bool MeshInstanceSpawner::IsLoaded() const
+    {
+        return m_assetLoadedAndSpawnable;
+    }
+
+    bool MeshInstanceSpawner::IsSpawnable() const
+    {
+        return m_assetLoadedAndSpawnable;
+    }
+
+    float MeshInstanceSpawner::GetRadius() const
+    {
+        return m_radius;
+    }
+
+    AZStd::string MeshInstanceSpawner::GetName() const
+    {
+        AZStd::string assetName;
+        if (!HasEmptyAssetReferences())
+        {
+            // Get the asset file name
+            assetName = m_modelAsset.GetHint();
+            if (!m_modelAsset.GetHint().empty())
+            {
+                AzFramework::StringFunc::Path::GetFileName(m_modelAsset.GetHint().c_str(), assetName);
+            }
+        }
+        else
+        {
+            assetName = "<asset name>";
+        }
+
+        return assetName;
+    }
+
+    void MeshInstanceSpawner::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        if (m_modelAsset.GetId() == asset.GetId())
+        {
+            ResetModelAsset();
+            m_modelAsset = asset;
+            UpdateCachedValues();
+            NotifyOnAssetsLoaded();
+        }
+    }
+
+    void MeshInstanceSpawner::OnAssetReloaded(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        OnAssetReady(asset);
+    }
+
+    AZStd::string MeshInstanceSpawner::GetModelAssetPath() const
+    {
+        AZStd::string assetPathString;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+            assetPathString, &AZ::Data::AssetCatalogRequests::GetAssetPathById, m_modelAsset.GetId());
+        return assetPathString;
+    }
+
+    void MeshInstanceSpawner::SetModelAssetPath(const AZStd::string& assetPath)
+    {
+        if (!assetPath.empty())
+        {
+            AZ::Data::AssetId assetId;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetId, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetIdByPath, assetPath.c_str(),
+                AZ::Data::s_invalidAssetType, false);
+            if (assetId.IsValid())
+            {
+                SetModelAssetId(assetId);
+            }
+            else
+            {
+                AZ_Error("Vegetation", false, "Asset '%s' is invalid.", assetPath.c_str());
+            }
+        }
+        else
+        {
+            SetModelAssetId(AZ::Data::AssetId());
+        }
+    }
+
+    AZ::Data::AssetId MeshInstanceSpawner::GetModelAssetId() const
+    {
+        return m_modelAsset.GetId();
+    }
+
+    void MeshInstanceSpawner::SetModelAssetId(const AZ::Data::AssetId& assetId)
+    {
+        if (assetId.IsValid())
+        {
+            AZ::Data::AssetInfo assetInfo;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(
+                assetInfo, &AZ::Data::AssetCatalogRequestBus::Events::GetAssetInfoById, assetId);
+            if (assetInfo.m_assetType == m_modelAsset.GetType())
+            {
+                m_modelAsset.Create(assetId, false);
+                LoadAssets();
+            }
+            else
+            {
+                AZ_Error(
+                    "Vegetation", false, "Asset '%s' is of type %s, but expected a Model type.",
+                    assetId.ToString<AZStd::string>().c_str(), assetInfo.m_assetType.ToString<AZStd::string>().c_str());
+            }
+        }
+        else
+        {
+            // An invalid asset ID is treated as a valid way to spawn "empty" instances, so don't print an error, just clear out
+            // the asset to that it has an invalid asset reference.  (See also HasEmptyAssetReferences() above)
+            m_modelAsset = AZ::Data::Asset<AZ::RPI::ModelAsset>();
+            LoadAssets();
+        }
+    }
+
+    AZ::u32 MeshInstanceSpawner::ModelAssetChanged()
+    {
+        // Whenever we change the model asset, force a refresh of the Entity Inspector
+        // since we want the Descriptor List to refresh the name of the entry.
+        NotifyOnAssetsUnloaded();
+        return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+    }
+
+    InstancePtr MeshInstanceSpawner::CreateInstance(const InstanceData& instanceData)
+    {
+        AZ::Render::MeshFeatureProcessorInterface* meshFeatureProcessor = GetMeshFeatureProcessor();
+        if (!meshFeatureProcessor || !m_modelAsset.IsReady())
+        {
+            return nullptr;
+        }
+
+        // Create a Transform that represents our instance.
+        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
+            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
+        world.MultiplyByUniformScale(instanceData.m_scale);
+
+        // The instance pointer is handed off to the vegetation system as opaque instance data, and is passed back in to
+        // DestroyInstance at the end of the lifetime of the instance, which is the one place where it gets deleted.
+        MeshInstance* instance = aznew MeshInstance;
+        instance->m_meshFeatureProcessor = meshFeatureProcessor;
+
+        // Instances never move, and there can be a lot of them, so they're kept out of ray tracing and the reflection probes.
+        AZ::Render::MeshHandleDescriptor meshDescriptor(m_modelAsset);
+        meshDescriptor.m_isRayTracingEnabled = false;
+        meshDescriptor.m_excludeFromReflectionCubeMaps = true;
+        instance->m_meshHandle = meshFeatureProcessor->AcquireMesh(meshDescriptor);
+        meshFeatureProcessor->SetTransform(instance->m_meshHandle, world);
+
+        m_instances.emplace(instance);
+        return instance;
+    }
+
+    void MeshInstanceSpawner::ReleaseMesh(MeshInstance& instance)
+    {
+        if (instance.m_meshFeatureProcessor)
+        {
+            instance.m_meshFeatureProcessor->ReleaseMesh(instance.m_meshHandle);
+            instance.m_meshFeatureProcessor = nullptr;
+        }
+    }
+
+    void MeshInstanceSpawner::DestroyInstance([[maybe_unused]] InstanceId id, InstancePtr opaqueInstance)
+    {
+        if (opaqueInstance)
+        {
+            auto instance = reinterpret_cast<MeshInstance*>(opaqueInstance);
+
+            auto foundInstance = m_instances.find(instance);
+            AZ_Assert(foundInstance != m_instances.end(), "Couldn't find CreateInstance entry for the mesh instance.");
+            if (foundInstance != m_instances.end())
+            {
+                ReleaseMesh(*instance);
+                m_instances.erase(foundInstance);
+            }
+
+            // The vegetation system has stopped tracking this instance, so it's now safe to delete it.
+            delete instance;
+        }
+    }
+} // namespace Vegetation
@@ -18,6 +18,7 @@
 #include <Vegetation/Ebuses/InstanceSystemRequestBus.h>
 #include <Vegetation/InstanceSpawner.h>
 #include <Vegetation/EmptyInstanceSpawner.h>
+#include <Vegetation/MeshInstanceSpawner.h>
 #include <Vegetation/PrefabInstanceSpawner.h>
 
 AZ_DEFINE_BUDGET(Vegetation);
@@ -83,6 +84,7 @@ namespace Vegetation
         InstanceSpawner::Reflect(context);
         EmptyInstanceSpawner::Reflect(context);
         PrefabInstanceSpawner::Reflect(context);
+        MeshInstanceSpawner::Reflect(context);
         Descriptor::Reflect(context);
         AreaConfig::Reflect(context);
         AreaComponentBase::Reflect(context);
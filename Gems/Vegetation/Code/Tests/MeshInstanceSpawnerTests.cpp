@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "VegetationTest.h"
+#include "VegetationMocks.h"
+
+#include <AzCore/Component/Entity.h>
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Vegetation/MeshInstanceSpawner.h>
+#include <Vegetation/EmptyInstanceSpawner.h>
+
+namespace UnitTest
+{
+    // Mock VegetationSystemComponent is needed to reflect only the MeshInstanceSpawner.
+    class MockMeshInstanceVegetationSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MockMeshInstanceVegetationSystemComponent, "{0B8E5E6C-3F0D-4A57-8C39-7D2C1E4A9F62}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflect)
+        {
+            Vegetation::InstanceSpawner::Reflect(reflect);
+            Vegetation::MeshInstanceSpawner::Reflect(reflect);
+            Vegetation::EmptyInstanceSpawner::Reflect(reflect);
+        }
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("VegetationSystemService"));
+        }
+    };
+
+    class MeshInstanceSpawnerTests
+        : public VegetationComponentTests
+    {
+    public:
+        void RegisterComponentDescriptors() override
+        {
+            m_app.RegisterComponentDescriptor(MockMeshInstanceVegetationSystemComponent::CreateDescriptor());
+        }
+    };
+
+    TEST_F(MeshInstanceSpawnerTests, BasicInitializationTest)
+    {
+        // Basic test to make sure we can construct / destroy without errors.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        EXPECT_TRUE(instanceSpawner.HasEmptyAssetReferences());
+        EXPECT_FALSE(instanceSpawner.IsLoaded());
+        EXPECT_FALSE(instanceSpawner.IsSpawnable());
+        EXPECT_TRUE(instanceSpawner.HasRadiusData());
+        EXPECT_EQ(instanceSpawner.GetRadius(), 0.0f);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DefaultSpawnersAreEqual)
+    {
+        // Two different instances of the default MeshInstanceSpawner should be considered data-equivalent.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::MeshInstanceSpawner instanceSpawner2;
+
+        EXPECT_TRUE(instanceSpawner1 == instanceSpawner2);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DifferentSpawnerTypesAreNotEqual)
+    {
+        // A MeshInstanceSpawner should never be data-equivalent to a different type of spawner.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner1;
+        Vegetation::EmptyInstanceSpawner instanceSpawner2;
+
+        // The test is written this way because only the == operator is overloaded.
+        EXPECT_TRUE(!(instanceSpawner1 == instanceSpawner2));
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, CreateInstanceWithoutModelFails)
+    {
+        // Without a loaded model there's nothing to render, so no instance should get created.
+
+        Vegetation::MeshInstanceSpawner instanceSpawner;
+        Vegetation::InstanceData instanceData;
+        Vegetation::InstancePtr instance = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_FALSE(instance);
+        instanceSpawner.DestroyInstance(0, instance);
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
+    {
+        // Validate that the Descriptor successfully gets MeshInstanceSpawner registered with it,
+        // as long as InstanceSpawner and MeshInstanceSpawner have been reflected.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        descriptor.RefreshSpawnerTypeList();
+        auto spawnerTypes = descriptor.GetSpawnerTypeList();
+        EXPECT_TRUE(spawnerTypes.size() > 0);
+        const auto& meshSpawnerEntry = AZStd::find(
+            spawnerTypes.begin(), spawnerTypes.end(),
+            AZStd::pair<AZ::TypeId, AZStd::string>(Vegetation::MeshInstanceSpawner::RTTI_Type(), "MeshInstanceSpawner"));
+        EXPECT_NE(meshSpawnerEntry, spawnerTypes.end());
+    }
+
+    TEST_F(MeshInstanceSpawnerTests, DescriptorCreatesCorrectSpawner)
+    {
+        // Validate that the Descriptor successfully creates a new MeshInstanceSpawner if we change
+        // the spawner type on the Descriptor.
+
+        MockMeshInstanceVegetationSystemComponent* component = nullptr;
+        auto entity = CreateEntity(&component);
+
+        Vegetation::Descriptor descriptor;
+        EXPECT_NE(azrtti_typeid(*(descriptor.GetInstanceSpawner())), Vegetation::MeshInstanceSpawner::RTTI_Type());
+        descriptor.m_spawnerType = Vegetation::MeshInstanceSpawner::RTTI_Type();
+        descriptor.RefreshSpawnerTypeList();
+        descriptor.SpawnerTypeChanged();
+        EXPECT_EQ(azrtti_typeid(*(descriptor.GetInstanceSpawner())), Vegetation::MeshInstanceSpawner::RTTI_Type());
+    }
+}
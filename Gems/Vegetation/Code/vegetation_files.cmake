@@ -12,6 +12,7 @@ set(FILES
     Include/Vegetation/InstanceData.h
     Include/Vegetation/InstanceSpawner.h
     Include/Vegetation/EmptyInstanceSpawner.h
+    Include/Vegetation/MeshInstanceSpawner.h
     Include/Vegetation/PrefabInstanceSpawner.h
     Include/Vegetation/AreaComponentBase.h
     Include/Vegetation/Ebuses/AreaSystemRequestBus.h
@@ -93,6 +94,7 @@ set(FILES
     Source/DescriptorListAsset.cpp
     Source/Descriptor.cpp
     Source/EmptyInstanceSpawner.cpp
+    Source/MeshInstanceSpawner.cpp
     Source/PrefabInstanceSpawner.cpp
     Source/VegetationSystemComponent.cpp
     Source/VegetationSystemComponent.h